@@ -257,6 +257,12 @@ UINT status;
     nx_azure_iot_ptr -> nx_azure_iot_pool_ptr = pool_ptr;
     nx_azure_iot_ptr -> nx_azure_iot_unix_time_get = unix_time_callback;
 
+#if NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0
+    /* Clear the TLS session cache.  */
+    memset(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache, 0,
+           sizeof(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache));
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0 */
+
     status = nx_cloud_create(&nx_azure_iot_ptr -> nx_azure_iot_cloud, (CHAR *)name_ptr, stack_memory_ptr,
                              stack_memory_size, priority);
     if (status)
@@ -334,6 +340,12 @@ UINT status;
 
     _nx_azure_iot_created_ptr = NX_NULL;
 
+#if NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0
+    /* Clear the master secrets held by the TLS session cache.  */
+    memset(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache, 0,
+           sizeof(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache));
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0 */
+
     return(NX_AZURE_IOT_SUCCESS);
 }
 
@@ -609,12 +621,129 @@ UINT old_threshold;
 }
 #endif /* NX_AZURE_IOT_DISABLE_CERTIFICATE_DATE */
 
+#if NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0
+static ULONG nx_azure_iot_tls_session_cache_key(NX_AZURE_IOT_RESOURCE *resource_ptr)
+{
+ULONG key = 2166136261UL;
+UINT i;
+
+    /* FNV-1a hash over hostname and client ID, so sessions are never shared across devices.  */
+    for (i = 0; i < resource_ptr -> resource_hostname_length; i++)
+    {
+        key = (key ^ resource_ptr -> resource_hostname[i]) * 16777619UL;
+    }
+
+    key = (key ^ '/') * 16777619UL;
+
+    for (i = 0; i < resource_ptr -> resource_mqtt_client_id_length; i++)
+    {
+        key = (key ^ resource_ptr -> resource_mqtt_client_id[i]) * 16777619UL;
+    }
+
+    key &= 0xFFFFFFFFUL;
+
+    /* Zero marks an empty entry.  */
+    if (key == 0)
+    {
+        key = 1;
+    }
+
+    return(key);
+}
+
+static UINT nx_azure_iot_tls_session_cache_match(NX_AZURE_IOT_TLS_SESSION_ENTRY *entry_ptr,
+                                                 NX_AZURE_IOT_RESOURCE *resource_ptr, ULONG key)
+{
+
+    /* The key only filters; the full names decide.  */
+    return((entry_ptr -> entry_key == key) &&
+           (entry_ptr -> entry_hostname_length == resource_ptr -> resource_hostname_length) &&
+           (entry_ptr -> entry_client_id_length == resource_ptr -> resource_mqtt_client_id_length) &&
+           !memcmp(entry_ptr -> entry_hostname, resource_ptr -> resource_hostname,
+                   resource_ptr -> resource_hostname_length) &&
+           !memcmp(entry_ptr -> entry_client_id, resource_ptr -> resource_mqtt_client_id,
+                   resource_ptr -> resource_mqtt_client_id_length));
+}
+
+static NX_AZURE_IOT_TLS_SESSION_ENTRY *nx_azure_iot_tls_session_cache_find(NX_AZURE_IOT *nx_azure_iot_ptr,
+                                                                          NX_AZURE_IOT_RESOURCE *resource_ptr)
+{
+NX_AZURE_IOT_TLS_SESSION_ENTRY *entry_ptr = NX_NULL;
+NX_AZURE_IOT_TLS_SESSION_ENTRY *current_ptr;
+ULONG current_time;
+ULONG key;
+UINT i;
+
+    /* Names that do not fit in an entry can not be matched, so their sessions are not cached.  */
+    if ((resource_ptr -> resource_hostname_length > NX_AZURE_IOT_TLS_SESSION_CACHE_HOSTNAME_SIZE) ||
+        (resource_ptr -> resource_mqtt_client_id_length > NX_AZURE_IOT_TLS_SESSION_CACHE_CLIENT_ID_SIZE))
+    {
+        return(NX_NULL);
+    }
+
+    /* Sessions can not be aged without a clock.  */
+    if (nx_azure_iot_unix_time_get(nx_azure_iot_ptr, &current_time))
+    {
+        return(NX_NULL);
+    }
+
+    key = nx_azure_iot_tls_session_cache_key(resource_ptr);
+
+    /* TLS writes the entries under its own protection when a handshake completes.  */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    for (i = 0; i < NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE; i++)
+    {
+        current_ptr = &(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache[i]);
+        if (nx_azure_iot_tls_session_cache_match(current_ptr, resource_ptr, key))
+        {
+            entry_ptr = current_ptr;
+            break;
+        }
+
+        /* Otherwise pick an empty or the oldest entry.  */
+        if ((entry_ptr == NX_NULL) ||
+            (entry_ptr -> entry_resumption.nx_secure_tls_resumption_session_id_length &&
+             ((current_ptr -> entry_resumption.nx_secure_tls_resumption_session_id_length == 0) ||
+              (current_ptr -> entry_resumption.nx_secure_tls_resumption_time <
+               entry_ptr -> entry_resumption.nx_secure_tls_resumption_time))))
+        {
+            entry_ptr = current_ptr;
+        }
+    }
+
+    if (!nx_azure_iot_tls_session_cache_match(entry_ptr, resource_ptr, key) ||
+        (entry_ptr -> entry_resumption.nx_secure_tls_resumption_session_id_length == 0) ||
+        ((current_time - entry_ptr -> entry_resumption.nx_secure_tls_resumption_time) >
+         NX_AZURE_IOT_TLS_SESSION_CACHE_LIFETIME))
+    {
+
+        /* Start a new session. TLS fills the entry and stamps its time when the full handshake completes.  */
+        memset(entry_ptr, 0, sizeof(NX_AZURE_IOT_TLS_SESSION_ENTRY));
+        entry_ptr -> entry_key = key;
+        memcpy(entry_ptr -> entry_hostname, resource_ptr -> resource_hostname, /* Use case of memcpy is verified.  */
+               resource_ptr -> resource_hostname_length);
+        entry_ptr -> entry_hostname_length = resource_ptr -> resource_hostname_length;
+        memcpy(entry_ptr -> entry_client_id, resource_ptr -> resource_mqtt_client_id, /* Use case of memcpy is verified.  */
+               resource_ptr -> resource_mqtt_client_id_length);
+        entry_ptr -> entry_client_id_length = resource_ptr -> resource_mqtt_client_id_length;
+    }
+
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(entry_ptr);
+}
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0 */
+
 UINT nx_azure_iot_mqtt_tls_setup(NXD_MQTT_CLIENT *client_ptr, NX_SECURE_TLS_SESSION *tls_session,
                                  NX_SECURE_X509_CERT *certificate,
                                  NX_SECURE_X509_CERT *trusted_certificate)
 {
 UINT status;
 NX_AZURE_IOT_RESOURCE *resource_ptr;
+#if NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0
+NX_AZURE_IOT_TLS_SESSION_ENTRY *entry_ptr;
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0 */
 
     NX_PARAMETER_NOT_USED(certificate);
     NX_PARAMETER_NOT_USED(trusted_certificate);
@@ -688,6 +817,30 @@ NX_AZURE_IOT_RESOURCE *resource_ptr;
     nx_secure_tls_session_time_function_set(tls_session, nx_azure_iot_tls_time_function);
 #endif /* NX_AZURE_IOT_DISABLE_CERTIFICATE_DATE */
 
+#if NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0
+    /* Offer the cached session on reconnect to skip the full handshake.  */
+    entry_ptr = nx_azure_iot_tls_session_cache_find(_nx_azure_iot_created_ptr, resource_ptr);
+    if (entry_ptr)
+    {
+        status = nx_secure_tls_session_resumption_set(tls_session, &(entry_ptr -> entry_resumption));
+        if (status)
+        {
+            LogError(LogLiteralArgs("Failed to set the session resumption entry: status: %d"), status);
+            return(status);
+        }
+    }
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0 */
+
+#if NX_AZURE_IOT_TLS_MAX_FRAGMENT_LENGTH > 0
+    /* Ask the server for smaller records so a smaller TLS packet buffer can be used.  */
+    status = nx_secure_tls_session_max_fragment_length_set(tls_session, NX_AZURE_IOT_TLS_MAX_FRAGMENT_LENGTH);
+    if (status)
+    {
+        LogError(LogLiteralArgs("Failed to set the max fragment length: status: %d"), status);
+        return(status);
+    }
+#endif /* NX_AZURE_IOT_TLS_MAX_FRAGMENT_LENGTH > 0 */
+
     return(NX_AZURE_IOT_SUCCESS);
 }
 
@@ -705,6 +858,98 @@ UINT nx_azure_iot_unix_time_get(NX_AZURE_IOT *nx_azure_iot_ptr, ULONG *unix_time
     return(nx_azure_iot_ptr -> nx_azure_iot_unix_time_get(unix_time));
 }
 
+UINT nx_azure_iot_tls_session_cache_export(NX_AZURE_IOT *nx_azure_iot_ptr, UCHAR *buffer_ptr,
+                                           UINT buffer_size, UINT *bytes_copied)
+{
+#if NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0
+ULONG header[2];
+
+    if ((nx_azure_iot_ptr == NX_NULL) || (buffer_ptr == NX_NULL) || (bytes_copied == NX_NULL))
+    {
+        LogError(LogLiteralArgs("TLS session cache export fail: INVALID POINTER"));
+        return(NX_AZURE_IOT_INVALID_PARAMETER);
+    }
+
+    if (buffer_size < (sizeof(header) + sizeof(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache)))
+    {
+        LogError(LogLiteralArgs("TLS session cache export fail: INSUFFICIENT BUFFER SPACE"));
+        return(NX_AZURE_IOT_INSUFFICIENT_BUFFER_SPACE);
+    }
+
+    /* Entry size and count guard against importing into a different build.  */
+    header[0] = sizeof(NX_AZURE_IOT_TLS_SESSION_ENTRY);
+    header[1] = NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE;
+
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+    memcpy(buffer_ptr, header, sizeof(header)); /* Use case of memcpy is verified.  */
+    memcpy(buffer_ptr + sizeof(header), nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache, /* Use case of memcpy is verified.  */
+           sizeof(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache));
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    *bytes_copied = (UINT)(sizeof(header) + sizeof(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache));
+
+    return(NX_AZURE_IOT_SUCCESS);
+#else
+    NX_PARAMETER_NOT_USED(nx_azure_iot_ptr);
+    NX_PARAMETER_NOT_USED(buffer_ptr);
+    NX_PARAMETER_NOT_USED(buffer_size);
+    NX_PARAMETER_NOT_USED(bytes_copied);
+
+    return(NX_AZURE_IOT_NOT_ENABLED);
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0 */
+}
+
+UINT nx_azure_iot_tls_session_cache_import(NX_AZURE_IOT *nx_azure_iot_ptr, const UCHAR *buffer_ptr,
+                                           UINT buffer_size)
+{
+#if NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0
+ULONG header[2];
+NX_AZURE_IOT_TLS_SESSION_ENTRY *entry_ptr;
+UINT i;
+
+    if ((nx_azure_iot_ptr == NX_NULL) || (buffer_ptr == NX_NULL) ||
+        (buffer_size != (sizeof(header) + sizeof(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache))))
+    {
+        LogError(LogLiteralArgs("TLS session cache import fail: INVALID PARAMETER"));
+        return(NX_AZURE_IOT_INVALID_PARAMETER);
+    }
+
+    memcpy(header, buffer_ptr, sizeof(header)); /* Use case of memcpy is verified.  */
+    if ((header[0] != sizeof(NX_AZURE_IOT_TLS_SESSION_ENTRY)) ||
+        (header[1] != NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE))
+    {
+        LogError(LogLiteralArgs("TLS session cache import fail: INVALID DATA"));
+        return(NX_AZURE_IOT_INVALID_PARAMETER);
+    }
+
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+    memcpy(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache, buffer_ptr + sizeof(header), /* Use case of memcpy is verified.  */
+           sizeof(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache));
+
+    /* Drop entries with a corrupted session ID or name length.  */
+    for (i = 0; i < NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE; i++)
+    {
+        entry_ptr = &(nx_azure_iot_ptr -> nx_azure_iot_tls_session_cache[i]);
+        if ((entry_ptr -> entry_resumption.nx_secure_tls_resumption_session_id_length >
+             NX_SECURE_TLS_RESUMPTION_SESSION_ID_SIZE) ||
+            (entry_ptr -> entry_hostname_length > NX_AZURE_IOT_TLS_SESSION_CACHE_HOSTNAME_SIZE) ||
+            (entry_ptr -> entry_client_id_length > NX_AZURE_IOT_TLS_SESSION_CACHE_CLIENT_ID_SIZE))
+        {
+            memset(entry_ptr, 0, sizeof(NX_AZURE_IOT_TLS_SESSION_ENTRY));
+        }
+    }
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(NX_AZURE_IOT_SUCCESS);
+#else
+    NX_PARAMETER_NOT_USED(nx_azure_iot_ptr);
+    NX_PARAMETER_NOT_USED(buffer_ptr);
+    NX_PARAMETER_NOT_USED(buffer_size);
+
+    return(NX_AZURE_IOT_NOT_ENABLED);
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0 */
+}
+
 static UINT nx_azure_iot_base64_decode(CHAR *base64name, UINT length, UCHAR *name, UINT name_size, UINT *bytes_copied)
 {
 UINT    i, j;
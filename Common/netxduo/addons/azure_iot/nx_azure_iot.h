@@ -149,6 +149,47 @@ UINT nx_azure_iot_log(UCHAR *type_ptr, UINT type_len, UCHAR *msg_ptr, UINT msg_l
 /* MQTT Subscribe topic offset.  */
 #define NX_AZURE_IOT_MQTT_SUBSCRIBE_TOPIC_OFFSET          6
 
+/* Define the number of TLS sessions cached for resumption on reconnect. Each entry is keyed by
+   hostname and MQTT client ID. 0 means the cache is disabled. By default, two entries are cached,
+   one for IoT Hub and one for Device Provisioning Service. */
+#ifndef NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE
+#define NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE               2
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE */
+
+/* Cached sessions are aged by the time TLS stamps on them when the handshake completes, which
+   needs the TLS time function that is only installed when certificate dates are validated.  */
+#if defined(NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION) || defined(NX_AZURE_IOT_DISABLE_CERTIFICATE_DATE)
+#undef NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE
+#define NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE               0
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION || NX_AZURE_IOT_DISABLE_CERTIFICATE_DATE */
+
+/* Define the maximum hostname and MQTT client ID lengths stored in a TLS session cache entry.
+   Sessions of resources with longer names are not cached.  */
+#ifndef NX_AZURE_IOT_TLS_SESSION_CACHE_HOSTNAME_SIZE
+#define NX_AZURE_IOT_TLS_SESSION_CACHE_HOSTNAME_SIZE      128
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_HOSTNAME_SIZE */
+
+#ifndef NX_AZURE_IOT_TLS_SESSION_CACHE_CLIENT_ID_SIZE
+#define NX_AZURE_IOT_TLS_SESSION_CACHE_CLIENT_ID_SIZE     128
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_CLIENT_ID_SIZE */
+
+/* Define the lifetime in seconds of a cached TLS session. By default, it is 12 hours. */
+#ifndef NX_AZURE_IOT_TLS_SESSION_CACHE_LIFETIME
+#define NX_AZURE_IOT_TLS_SESSION_CACHE_LIFETIME           (60 * 60 * 12)
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_LIFETIME */
+
+/* Define the TLS record length limit (512, 1024, 2048 or 4096) requested from the server through
+   the max_fragment_length extension. The server may decline it. 0 means no limit is requested,
+   which is the default. */
+#ifndef NX_AZURE_IOT_TLS_MAX_FRAGMENT_LENGTH
+#define NX_AZURE_IOT_TLS_MAX_FRAGMENT_LENGTH              0
+#endif /* NX_AZURE_IOT_TLS_MAX_FRAGMENT_LENGTH */
+
+#ifdef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+#undef NX_AZURE_IOT_TLS_MAX_FRAGMENT_LENGTH
+#define NX_AZURE_IOT_TLS_MAX_FRAGMENT_LENGTH              0
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+
 /**
  * @brief Resource struct
  *
@@ -181,6 +222,22 @@ typedef struct NX_AZURE_IOT_RESOURCE_STRUCT
 
 } NX_AZURE_IOT_RESOURCE;
 
+#if NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0
+/**
+ * @brief TLS session cache entry
+ *
+ */
+typedef struct NX_AZURE_IOT_TLS_SESSION_ENTRY_STRUCT
+{
+    ULONG                                  entry_key;
+    UCHAR                                  entry_hostname[NX_AZURE_IOT_TLS_SESSION_CACHE_HOSTNAME_SIZE];
+    UINT                                   entry_hostname_length;
+    UCHAR                                  entry_client_id[NX_AZURE_IOT_TLS_SESSION_CACHE_CLIENT_ID_SIZE];
+    UINT                                   entry_client_id_length;
+    NX_SECURE_TLS_SESSION_RESUMPTION       entry_resumption;
+} NX_AZURE_IOT_TLS_SESSION_ENTRY;
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0 */
+
 /**
  * @brief Azure IoT Struct
  *
@@ -199,6 +256,9 @@ typedef struct NX_AZURE_IOT_STRUCT
                                           ULONG common_events, ULONG module_own_events);
     struct NX_AZURE_IOT_RESOURCE_STRUCT   *nx_azure_iot_resource_list_header;
     UINT                                 (*nx_azure_iot_unix_time_get)(ULONG *unix_time);
+#if NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0
+    NX_AZURE_IOT_TLS_SESSION_ENTRY         nx_azure_iot_tls_session_cache[NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE];
+#endif /* NX_AZURE_IOT_TLS_SESSION_CACHE_SIZE > 0 */
 } NX_AZURE_IOT;
 
 typedef struct NX_AZURE_IOT_THREAD_STRUCT
@@ -272,6 +332,44 @@ UINT nx_azure_iot_delete(NX_AZURE_IOT *nx_azure_iot_ptr);
  */
 UINT nx_azure_iot_unix_time_get(NX_AZURE_IOT *nx_azure_iot_ptr, ULONG *unix_time);
 
+/**
+ * @brief Export the TLS session cache
+ *
+ * @details This routine copies the TLS sessions cached for resumption into a buffer, so the application
+ *          can persist them across a reboot and restore them with nx_azure_iot_tls_session_cache_import.
+ *
+ * @remarks The exported data contains TLS master secrets. It must be stored in protected storage.
+ *
+ * @param[in] nx_azure_iot_ptr A pointer to a #NX_AZURE_IOT.
+ * @param[out] buffer_ptr A pointer to a buffer where the cache is written.
+ * @param[in] buffer_size Size of buffer.
+ * @param[out] bytes_copied Pointer to `UINT` where the number of bytes written is returned.
+ * @return A `UINT` with the result of the API.
+ *   @retval #NX_AZURE_IOT_SUCCESS Successfully exported the TLS session cache.
+ *   @retval #NX_AZURE_IOT_INVALID_PARAMETER Fail to export the cache due to invalid parameter.
+ *   @retval #NX_AZURE_IOT_INSUFFICIENT_BUFFER_SPACE Fail to export the cache due to insufficient buffer space.
+ *   @retval #NX_AZURE_IOT_NOT_ENABLED Fail to export the cache since the cache is disabled.
+ */
+UINT nx_azure_iot_tls_session_cache_export(NX_AZURE_IOT *nx_azure_iot_ptr, UCHAR *buffer_ptr,
+                                           UINT buffer_size, UINT *bytes_copied);
+
+/**
+ * @brief Import the TLS session cache
+ *
+ * @details This routine restores TLS sessions previously exported by nx_azure_iot_tls_session_cache_export.
+ *          It must be called before connecting to Azure IoT services.
+ *
+ * @param[in] nx_azure_iot_ptr A pointer to a #NX_AZURE_IOT.
+ * @param[in] buffer_ptr A pointer to the exported data.
+ * @param[in] buffer_size Size of exported data.
+ * @return A `UINT` with the result of the API.
+ *   @retval #NX_AZURE_IOT_SUCCESS Successfully imported the TLS session cache.
+ *   @retval #NX_AZURE_IOT_INVALID_PARAMETER Fail to import the cache due to invalid parameter or data.
+ *   @retval #NX_AZURE_IOT_NOT_ENABLED Fail to import the cache since the cache is disabled.
+ */
+UINT nx_azure_iot_tls_session_cache_import(NX_AZURE_IOT *nx_azure_iot_ptr, const UCHAR *buffer_ptr,
+                                           UINT buffer_size);
+
 /**
  * @brief Initialize logging
  *
@@ -0,0 +1,1187 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   DTLS Telemetry                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_DTLS_TELEMETRY_SOURCE_CODE
+
+
+/* Force error checking to be disabled in this module */
+
+#ifndef NX_DISABLE_ERROR_CHECKING
+#define NX_DISABLE_ERROR_CHECKING
+#endif
+
+/* Include necessary system files.  */
+
+#include "nx_dtls_telemetry.h"
+#include "nx_ip.h"
+#include <stddef.h>
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/* Define the certificate callback that checks the DNS name of the collector.  */
+
+static ULONG _nx_dtls_telemetry_certificate_verify(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_X509_CERT *certificate);
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_dtls_telemetry_create                          PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the DTLS telemetry create        */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    telemetry_name                        Name of DTLS telemetry        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    crypto_table                          Crypto table for DTLS         */
+/*    metadata_buffer                       Crypto metadata area          */
+/*    metadata_size                         Size of metadata area         */
+/*    packet_reassembly_buffer              Buffer for record reassembly  */
+/*    packet_reassembly_buffer_size         Size of reassembly buffer     */
+/*    certs_number                          Number of remote certificates */
+/*    remote_certificate_buffer             Remote certificate buffer     */
+/*    remote_certificate_buffer_size        Size of certificate buffer    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dtls_telemetry_create             Actual create function        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxe_dtls_telemetry_create(NX_DTLS_TELEMETRY *telemetry_ptr, const CHAR *telemetry_name, NX_IP *ip_ptr,
+                                NX_PACKET_POOL *pool_ptr, const NX_SECURE_TLS_CRYPTO *crypto_table,
+                                VOID *metadata_buffer, ULONG metadata_size,
+                                UCHAR *packet_reassembly_buffer, UINT packet_reassembly_buffer_size,
+                                UINT certs_number, UCHAR *remote_certificate_buffer, ULONG remote_certificate_buffer_size)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((telemetry_ptr == NX_NULL) || (ip_ptr == NX_NULL) || (ip_ptr -> nx_ip_id != NX_IP_ID) ||
+        (pool_ptr == NX_NULL) || (crypto_table == NX_NULL) || (metadata_buffer == NX_NULL) ||
+        (packet_reassembly_buffer == NX_NULL) ||
+        ((certs_number != 0) && (remote_certificate_buffer == NX_NULL)))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual DTLS telemetry create function.  */
+    status = _nx_dtls_telemetry_create(telemetry_ptr, telemetry_name, ip_ptr, pool_ptr, crypto_table,
+                                       metadata_buffer, metadata_size,
+                                       packet_reassembly_buffer, packet_reassembly_buffer_size,
+                                       certs_number, remote_certificate_buffer, remote_certificate_buffer_size);
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dtls_telemetry_create                           PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a DTLS telemetry channel. It creates the UDP  */
+/*    socket and the DTLS session used to send telemetry samples.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    telemetry_name                        Name of DTLS telemetry        */
+/*    ip_ptr                                Pointer to IP instance        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    crypto_table                          Crypto table for DTLS         */
+/*    metadata_buffer                       Crypto metadata area          */
+/*    metadata_size                         Size of metadata area         */
+/*    packet_reassembly_buffer              Buffer for record reassembly  */
+/*    packet_reassembly_buffer_size         Size of reassembly buffer     */
+/*    certs_number                          Number of remote certificates */
+/*    remote_certificate_buffer             Remote certificate buffer     */
+/*    remote_certificate_buffer_size        Size of certificate buffer    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_udp_socket_create                  Create UDP socket             */
+/*    nx_udp_socket_delete                  Delete UDP socket             */
+/*    nx_secure_dtls_session_create         Create DTLS session           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_dtls_telemetry_create(NX_DTLS_TELEMETRY *telemetry_ptr, const CHAR *telemetry_name, NX_IP *ip_ptr,
+                               NX_PACKET_POOL *pool_ptr, const NX_SECURE_TLS_CRYPTO *crypto_table,
+                               VOID *metadata_buffer, ULONG metadata_size,
+                               UCHAR *packet_reassembly_buffer, UINT packet_reassembly_buffer_size,
+                               UINT certs_number, UCHAR *remote_certificate_buffer, ULONG remote_certificate_buffer_size)
+{
+
+UINT status;
+
+
+    /* Initialize the DTLS telemetry control block to zero.  */
+    memset(telemetry_ptr, 0, sizeof(NX_DTLS_TELEMETRY));
+
+    /* Create the UDP socket. Telemetry datagrams are never fragmented, a sample that
+       does not fit in one datagram is dropped by the IP layer instead.  */
+    status = nx_udp_socket_create(ip_ptr, &(telemetry_ptr -> nx_dtls_telemetry_socket), (CHAR *)telemetry_name,
+                                  NX_IP_NORMAL, NX_DONT_FRAGMENT, NX_DTLS_TELEMETRY_TIME_TO_LIVE,
+                                  NX_DTLS_TELEMETRY_QUEUE_MAXIMUM);
+
+    /* Determine if an error occurred.  */
+    if (status)
+    {
+        return(status);
+    }
+
+    /* Create the DTLS session.  */
+    status = nx_secure_dtls_session_create(&(telemetry_ptr -> nx_dtls_telemetry_session), crypto_table,
+                                           metadata_buffer, metadata_size,
+                                           packet_reassembly_buffer, packet_reassembly_buffer_size,
+                                           certs_number, remote_certificate_buffer, remote_certificate_buffer_size);
+
+    /* Determine if an error occurred.  */
+    if (status)
+    {
+
+        /* Delete the UDP socket.  */
+        nx_udp_socket_delete(&(telemetry_ptr -> nx_dtls_telemetry_socket));
+        return(status);
+    }
+
+    /* Save the name, IP instance and packet pool.  */
+    telemetry_ptr -> nx_dtls_telemetry_name = telemetry_name;
+    telemetry_ptr -> nx_dtls_telemetry_ip_ptr = ip_ptr;
+    telemetry_ptr -> nx_dtls_telemetry_packet_pool_ptr = pool_ptr;
+
+    /* Set the DTLS telemetry ID to indicate the DTLS telemetry is valid.  */
+    telemetry_ptr -> nx_dtls_telemetry_id = NX_DTLS_TELEMETRY_ID;
+
+    /* Return success.  */
+    return(NX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_dtls_telemetry_delete                          PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the DTLS telemetry delete        */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dtls_telemetry_delete             Actual delete function        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxe_dtls_telemetry_delete(NX_DTLS_TELEMETRY *telemetry_ptr)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((telemetry_ptr == NX_NULL) || (telemetry_ptr -> nx_dtls_telemetry_id != NX_DTLS_TELEMETRY_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual DTLS telemetry delete function.  */
+    status = _nx_dtls_telemetry_delete(telemetry_ptr);
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dtls_telemetry_delete                           PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes a DTLS telemetry channel, disconnecting it    */
+/*    first if it is still connected.                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dtls_telemetry_disconnect         Disconnect DTLS telemetry     */
+/*    nx_secure_dtls_session_delete         Delete DTLS session           */
+/*    nx_udp_socket_delete                  Delete UDP socket             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_dtls_telemetry_delete(NX_DTLS_TELEMETRY *telemetry_ptr)
+{
+
+    /* Disconnect the collector if the channel is still connected.  */
+    if (telemetry_ptr -> nx_dtls_telemetry_connected)
+    {
+        _nx_dtls_telemetry_disconnect(telemetry_ptr, NX_NO_WAIT);
+    }
+
+    /* Delete the DTLS session and the UDP socket.  */
+    nx_secure_dtls_session_delete(&(telemetry_ptr -> nx_dtls_telemetry_session));
+    nx_udp_socket_delete(&(telemetry_ptr -> nx_dtls_telemetry_socket));
+
+    /* Clear the DTLS telemetry ID to indicate the DTLS telemetry is deleted.  */
+    telemetry_ptr -> nx_dtls_telemetry_id = 0;
+
+    /* Return success.  */
+    return(NX_SUCCESS);
+}
+
+
+#if defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES) || defined(NX_SECURE_ENABLE_ECJPAKE_CIPHERSUITE)
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_dtls_telemetry_psk_add                         PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the DTLS telemetry PSK add       */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    pre_shared_key                        Pointer to pre-shared key     */
+/*    psk_length                            Length of pre-shared key      */
+/*    psk_identity                          Pointer to PSK identity       */
+/*    identity_length                       Length of PSK identity        */
+/*    hint                                  Pointer to PSK hint           */
+/*    hint_length                           Length of PSK hint            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dtls_telemetry_psk_add            Actual PSK add function       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxe_dtls_telemetry_psk_add(NX_DTLS_TELEMETRY *telemetry_ptr, UCHAR *pre_shared_key, UINT psk_length,
+                                 UCHAR *psk_identity, UINT identity_length, UCHAR *hint, UINT hint_length)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((telemetry_ptr == NX_NULL) || (telemetry_ptr -> nx_dtls_telemetry_id != NX_DTLS_TELEMETRY_ID) ||
+        (pre_shared_key == NX_NULL) || (psk_identity == NX_NULL) || (hint == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Call actual DTLS telemetry PSK add function.  */
+    status = _nx_dtls_telemetry_psk_add(telemetry_ptr, pre_shared_key, psk_length,
+                                        psk_identity, identity_length, hint, hint_length);
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dtls_telemetry_psk_add                          PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a pre-shared key used to authenticate the DTLS   */
+/*    telemetry channel with the collector.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    pre_shared_key                        Pointer to pre-shared key     */
+/*    psk_length                            Length of pre-shared key      */
+/*    psk_identity                          Pointer to PSK identity       */
+/*    identity_length                       Length of PSK identity        */
+/*    hint                                  Pointer to PSK hint           */
+/*    hint_length                           Length of PSK hint            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_secure_dtls_psk_add                Add PSK to DTLS session       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_dtls_telemetry_psk_add(NX_DTLS_TELEMETRY *telemetry_ptr, UCHAR *pre_shared_key, UINT psk_length,
+                                UCHAR *psk_identity, UINT identity_length, UCHAR *hint, UINT hint_length)
+{
+
+    /* Add the PSK to the DTLS session.  */
+    return(nx_secure_dtls_psk_add(&(telemetry_ptr -> nx_dtls_telemetry_session), pre_shared_key, psk_length,
+                                  psk_identity, identity_length, hint, hint_length));
+}
+#endif /* NX_SECURE_ENABLE_PSK_CIPHERSUITES || NX_SECURE_ENABLE_ECJPAKE_CIPHERSUITE */
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_dtls_telemetry_trusted_certificate_add         PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the DTLS telemetry trusted       */
+/*    certificate add function call.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    certificate                           Pointer to CA certificate     */
+/*    server_name                           DNS name of the collector     */
+/*    server_name_length                    Length of DNS name            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dtls_telemetry_trusted_certificate_add                          */
+/*                                          Actual trusted certificate    */
+/*                                            add function                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxe_dtls_telemetry_trusted_certificate_add(NX_DTLS_TELEMETRY *telemetry_ptr, NX_SECURE_X509_CERT *certificate,
+                                                 const UCHAR *server_name, UINT server_name_length)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((telemetry_ptr == NX_NULL) || (telemetry_ptr -> nx_dtls_telemetry_id != NX_DTLS_TELEMETRY_ID) ||
+        (certificate == NX_NULL) || (server_name == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an empty DNS name.  */
+    if (server_name_length == 0)
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Call actual DTLS telemetry trusted certificate add function.  */
+    status = _nx_dtls_telemetry_trusted_certificate_add(telemetry_ptr, certificate, server_name, server_name_length);
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dtls_telemetry_trusted_certificate_add          PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds the CA certificate used to authenticate the      */
+/*    collector of the DTLS telemetry channel, and the DNS name the       */
+/*    certificate of the collector must be issued to. The handshake fails */
+/*    unless the common name or a subject alternative name of the         */
+/*    collector certificate matches it, so the CA should be one that only */
+/*    issues collector certificates. The DNS name is not copied, it must  */
+/*    stay valid while the channel is in use.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    certificate                           Pointer to CA certificate     */
+/*    server_name                           DNS name of the collector     */
+/*    server_name_length                    Length of DNS name            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_secure_dtls_session_trusted_certificate_add                      */
+/*                                          Add trusted certificate       */
+/*    nx_secure_tls_session_certificate_callback_set                      */
+/*                                          Set certificate callback      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_dtls_telemetry_trusted_certificate_add(NX_DTLS_TELEMETRY *telemetry_ptr, NX_SECURE_X509_CERT *certificate,
+                                                const UCHAR *server_name, UINT server_name_length)
+{
+
+UINT status;
+
+
+    /* Add the certificate to the trusted store of the DTLS session.  */
+    status = nx_secure_dtls_session_trusted_certificate_add(&(telemetry_ptr -> nx_dtls_telemetry_session),
+                                                            certificate, 1);
+
+    /* Determine if an error occurred.  */
+    if (status)
+    {
+        return(status);
+    }
+
+    /* Save the DNS name of the collector.  */
+    telemetry_ptr -> nx_dtls_telemetry_server_name = server_name;
+    telemetry_ptr -> nx_dtls_telemetry_server_name_length = server_name_length;
+
+    /* Check the name in the collector certificate once the chain is verified.  */
+    return(nx_secure_tls_session_certificate_callback_set(&(telemetry_ptr -> nx_dtls_telemetry_session.nx_secure_dtls_tls_session),
+                                                          _nx_dtls_telemetry_certificate_verify));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dtls_telemetry_certificate_verify               PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks that the certificate of the collector is       */
+/*    issued to the DNS name given with the CA certificate. It is called  */
+/*    by TLS once the certificate chain is verified.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS session of the channel    */
+/*    certificate                           Collector certificate         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_secure_x509_common_name_dns_check  Check DNS name of certificate */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_remote_certificate_verify                            */
+/*                                          Verify remote certificate     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static ULONG _nx_dtls_telemetry_certificate_verify(NX_SECURE_TLS_SESSION *tls_session, NX_SECURE_X509_CERT *certificate)
+{
+
+NX_DTLS_TELEMETRY *telemetry_ptr;
+
+
+    /* The TLS session is the first member of the DTLS session of the channel.  */
+    telemetry_ptr = (NX_DTLS_TELEMETRY *)(((UCHAR *)tls_session) - offsetof(NX_DTLS_TELEMETRY, nx_dtls_telemetry_session));
+
+    /* Check the common name and the subject alternative names of the certificate.  */
+    return(nx_secure_x509_common_name_dns_check(certificate, telemetry_ptr -> nx_dtls_telemetry_server_name,
+                                                telemetry_ptr -> nx_dtls_telemetry_server_name_length));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_dtls_telemetry_connect                         PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the DTLS telemetry connect       */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    server_address                        Address of the collector      */
+/*    server_port                           UDP port of the collector     */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dtls_telemetry_connect            Actual connect function       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxe_dtls_telemetry_connect(NX_DTLS_TELEMETRY *telemetry_ptr, NXD_ADDRESS *server_address, UINT server_port,
+                                 ULONG wait_option)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((telemetry_ptr == NX_NULL) || (telemetry_ptr -> nx_dtls_telemetry_id != NX_DTLS_TELEMETRY_ID) ||
+        (server_address == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid port.  */
+    if ((server_port == 0) || (server_port > (UINT)NX_MAX_PORT))
+    {
+        return(NX_INVALID_PORT);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual DTLS telemetry connect function.  */
+    status = _nx_dtls_telemetry_connect(telemetry_ptr, server_address, server_port, wait_option);
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dtls_telemetry_connect                          PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function binds the telemetry UDP socket and performs the DTLS  */
+/*    handshake with the collector.                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    server_address                        Address of the collector      */
+/*    server_port                           UDP port of the collector     */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_udp_socket_bind                    Bind UDP socket               */
+/*    nx_udp_socket_unbind                  Unbind UDP socket             */
+/*    nx_secure_dtls_client_session_start                                 */
+/*                                          Start DTLS client session     */
+/*    nx_secure_dtls_session_reset          Reset DTLS session            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_dtls_telemetry_connect(NX_DTLS_TELEMETRY *telemetry_ptr, NXD_ADDRESS *server_address, UINT server_port,
+                                ULONG wait_option)
+{
+
+UINT status;
+
+
+    /* Check if the channel is already connected.  */
+    if (telemetry_ptr -> nx_dtls_telemetry_connected)
+    {
+        return(NX_NOT_CLOSED);
+    }
+
+    /* Bind the UDP socket to any free local port.  */
+    status = nx_udp_socket_bind(&(telemetry_ptr -> nx_dtls_telemetry_socket), NX_ANY_PORT, wait_option);
+
+    /* Determine if an error occurred.  */
+    if (status)
+    {
+        return(status);
+    }
+
+    /* Perform the DTLS handshake with the collector.  */
+    status = nx_secure_dtls_client_session_start(&(telemetry_ptr -> nx_dtls_telemetry_session),
+                                                 &(telemetry_ptr -> nx_dtls_telemetry_socket),
+                                                 server_address, server_port, (UINT)wait_option);
+
+    /* Determine if an error occurred.  */
+    if (status)
+    {
+
+        /* Reset the DTLS session and unbind the UDP socket so the connect can be retried.  */
+        nx_secure_dtls_session_reset(&(telemetry_ptr -> nx_dtls_telemetry_session));
+        nx_udp_socket_unbind(&(telemetry_ptr -> nx_dtls_telemetry_socket));
+        return(status);
+    }
+
+    /* Save the collector address and port.  */
+    telemetry_ptr -> nx_dtls_telemetry_server_address = *server_address;
+    telemetry_ptr -> nx_dtls_telemetry_server_port = server_port;
+
+    /* The channel is ready for telemetry samples.  */
+    telemetry_ptr -> nx_dtls_telemetry_connected = NX_TRUE;
+
+    /* Return success.  */
+    return(NX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_dtls_telemetry_disconnect                      PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the DTLS telemetry disconnect    */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dtls_telemetry_disconnect         Actual disconnect function    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxe_dtls_telemetry_disconnect(NX_DTLS_TELEMETRY *telemetry_ptr, ULONG wait_option)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((telemetry_ptr == NX_NULL) || (telemetry_ptr -> nx_dtls_telemetry_id != NX_DTLS_TELEMETRY_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual DTLS telemetry disconnect function.  */
+    status = _nx_dtls_telemetry_disconnect(telemetry_ptr, wait_option);
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dtls_telemetry_disconnect                       PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends a close-notify alert to the collector, resets   */
+/*    the DTLS session and unbinds the telemetry UDP socket.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_secure_dtls_session_end            End DTLS session              */
+/*    nx_secure_dtls_session_reset          Reset DTLS session            */
+/*    nx_udp_socket_unbind                  Unbind UDP socket             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_dtls_telemetry_delete             Delete DTLS telemetry         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_dtls_telemetry_disconnect(NX_DTLS_TELEMETRY *telemetry_ptr, ULONG wait_option)
+{
+
+UINT status;
+
+
+    /* Check if the channel is connected.  */
+    if (!telemetry_ptr -> nx_dtls_telemetry_connected)
+    {
+        return(NX_NOT_CONNECTED);
+    }
+
+    /* Send the close-notify alert. Collectors often do not answer it, so the session
+       is reset below whatever the outcome.  */
+    status = nx_secure_dtls_session_end(&(telemetry_ptr -> nx_dtls_telemetry_session), (UINT)wait_option);
+
+    /* Reset the DTLS session and unbind the UDP socket.  */
+    nx_secure_dtls_session_reset(&(telemetry_ptr -> nx_dtls_telemetry_session));
+    nx_udp_socket_unbind(&(telemetry_ptr -> nx_dtls_telemetry_socket));
+
+    /* The channel is disconnected.  */
+    telemetry_ptr -> nx_dtls_telemetry_connected = NX_FALSE;
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_dtls_telemetry_send                            PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the DTLS telemetry send          */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    data                                  Pointer to telemetry sample   */
+/*    data_size                             Size of telemetry sample      */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_dtls_telemetry_send               Actual send function          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nxe_dtls_telemetry_send(NX_DTLS_TELEMETRY *telemetry_ptr, const UCHAR *data, UINT data_size, ULONG wait_option)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((telemetry_ptr == NX_NULL) || (telemetry_ptr -> nx_dtls_telemetry_id != NX_DTLS_TELEMETRY_ID) ||
+        (data == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an empty sample.  */
+    if (data_size == 0)
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_THREADS_ONLY_CALLER_CHECKING
+
+    /* Call actual DTLS telemetry send function.  */
+    status = _nx_dtls_telemetry_send(telemetry_ptr, data, data_size, wait_option);
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_dtls_telemetry_send                             PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends one telemetry sample to the collector in a      */
+/*    single DTLS record. The sample is not retransmitted if the          */
+/*    datagram is lost, and it is counted as dropped if it cannot be      */
+/*    sent. Records queued by the collector are processed first, so an   */
+/*    alert such as close_notify is seen on the next send. An alert or a  */
+/*    failed send disconnects the channel and the error is returned, so   */
+/*    the caller can send the sample over another transport or connect   */
+/*    again.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    telemetry_ptr                         Pointer to DTLS telemetry     */
+/*    data                                  Pointer to telemetry sample   */
+/*    data_size                             Size of telemetry sample      */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_secure_dtls_session_receive        Receive DTLS record           */
+/*    nx_secure_dtls_packet_allocate        Allocate DTLS packet          */
+/*    nx_packet_data_append                 Append data to packet         */
+/*    nx_packet_release                     Release packet                */
+/*    nx_secure_dtls_session_send           Send DTLS record              */
+/*    _nx_dtls_telemetry_disconnect         Disconnect the collector      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_dtls_telemetry_send(NX_DTLS_TELEMETRY *telemetry_ptr, const UCHAR *data, UINT data_size, ULONG wait_option)
+{
+
+UINT       status;
+NX_PACKET *packet_ptr;
+
+
+    /* Check if the channel is connected.  */
+    if (!telemetry_ptr -> nx_dtls_telemetry_connected)
+    {
+        return(NX_NOT_CONNECTED);
+    }
+
+    /* Process the records queued by the collector. It does not send application data,
+       so anything other than an empty queue means the session is no longer usable.  */
+    do
+    {
+        status = nx_secure_dtls_session_receive(&(telemetry_ptr -> nx_dtls_telemetry_session), &packet_ptr, NX_NO_WAIT);
+
+        /* Discard unexpected data from the collector.  */
+        if (status == NX_SUCCESS)
+        {
+            nx_packet_release(packet_ptr);
+        }
+    } while (status == NX_SUCCESS);
+
+    /* Determine if an alert or an error was received.  */
+    if (status != NX_NO_PACKET)
+    {
+        _nx_dtls_telemetry_disconnect(telemetry_ptr, NX_NO_WAIT);
+        telemetry_ptr -> nx_dtls_telemetry_samples_dropped++;
+        return(status);
+    }
+
+    /* Allocate a packet with room for the DTLS record header.  */
+    status = nx_secure_dtls_packet_allocate(&(telemetry_ptr -> nx_dtls_telemetry_session),
+                                            telemetry_ptr -> nx_dtls_telemetry_packet_pool_ptr,
+                                            &packet_ptr, wait_option);
+
+    /* Determine if an error occurred.  */
+    if (status)
+    {
+        telemetry_ptr -> nx_dtls_telemetry_samples_dropped++;
+        return(status);
+    }
+
+    /* Copy the sample into the packet.  */
+    status = nx_packet_data_append(packet_ptr, (VOID *)data, data_size,
+                                   telemetry_ptr -> nx_dtls_telemetry_packet_pool_ptr, wait_option);
+
+    /* Determine if an error occurred.  */
+    if (status)
+    {
+        nx_packet_release(packet_ptr);
+        telemetry_ptr -> nx_dtls_telemetry_samples_dropped++;
+        return(status);
+    }
+
+    /* Send the sample in one DTLS record.  */
+    status = nx_secure_dtls_session_send(&(telemetry_ptr -> nx_dtls_telemetry_session), packet_ptr,
+                                         &(telemetry_ptr -> nx_dtls_telemetry_server_address),
+                                         telemetry_ptr -> nx_dtls_telemetry_server_port);
+
+    /* Determine if an error occurred.  */
+    if (status)
+    {
+
+        /* The packet is already released when the UDP send itself failed.  */
+        if (status != NX_SECURE_TLS_TCP_SEND_FAILED)
+        {
+            nx_packet_release(packet_ptr);
+        }
+
+        /* The record could not be sent, the session is no longer usable.  */
+        _nx_dtls_telemetry_disconnect(telemetry_ptr, NX_NO_WAIT);
+        telemetry_ptr -> nx_dtls_telemetry_samples_dropped++;
+        return(status);
+    }
+
+    /* Update the number of samples sent.  */
+    telemetry_ptr -> nx_dtls_telemetry_samples_sent++;
+
+    /* Return success.  */
+    return(NX_SUCCESS);
+}
@@ -0,0 +1,226 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   DTLS Telemetry                                                      */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  APPLICATION INTERFACE DEFINITION                       RELEASE        */
+/*                                                                        */
+/*    nx_dtls_telemetry.h                                 PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the NetX DTLS Telemetry component, a datagram     */
+/*    channel that sends telemetry samples to a collector over DTLS 1.2.  */
+/*    Each sample is carried in a single DTLS record and is never         */
+/*    retransmitted, so a lost sample does not delay the ones after it.   */
+/*    A send that fails, or an alert from the collector, disconnects the  */
+/*    channel so that the application can fall back to another transport  */
+/*    or connect again.                                                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef NX_DTLS_TELEMETRY_H
+#define NX_DTLS_TELEMETRY_H
+
+/* Determine if a C++ compiler is being used.  If so, ensure that standard
+   C is used to process the API information.  */
+
+#ifdef __cplusplus
+
+   /* Yes, C++ compiler is present.  Use standard C.  */
+extern   "C" {
+
+#endif
+
+/* Include the ThreadX, NetX and DTLS API files.  */
+
+#include "tx_api.h"
+#include "nx_api.h"
+#include "nx_secure_dtls_api.h"
+
+
+/* Define DTLS telemetry constants.  */
+#define NX_DTLS_TELEMETRY_ID                            ((ULONG)0x44544C54)
+
+
+/* Define the maximum number of datagrams queued on the telemetry UDP socket. The collector
+   only sends handshake messages and alerts, so a short queue is enough.  */
+#ifndef NX_DTLS_TELEMETRY_QUEUE_MAXIMUM
+#define NX_DTLS_TELEMETRY_QUEUE_MAXIMUM                 4
+#endif /* NX_DTLS_TELEMETRY_QUEUE_MAXIMUM */
+
+/* Define the time to live of telemetry datagrams.  */
+#ifndef NX_DTLS_TELEMETRY_TIME_TO_LIVE
+#define NX_DTLS_TELEMETRY_TIME_TO_LIVE                  0x80
+#endif /* NX_DTLS_TELEMETRY_TIME_TO_LIVE */
+
+
+typedef struct NX_DTLS_TELEMETRY_STRUCT
+{
+
+    /* Define the DTLS telemetry ID.  */
+    ULONG                           nx_dtls_telemetry_id;
+
+    /* Define the DTLS telemetry name.  */
+    const CHAR                     *nx_dtls_telemetry_name;
+
+    /* Define the IP instance and the packet pool used for telemetry samples.  */
+    NX_IP                          *nx_dtls_telemetry_ip_ptr;
+    NX_PACKET_POOL                 *nx_dtls_telemetry_packet_pool_ptr;
+
+    /* Define the UDP socket that carries the DTLS records.  */
+    NX_UDP_SOCKET                   nx_dtls_telemetry_socket;
+
+    /* Define the DTLS session.  */
+    NX_SECURE_DTLS_SESSION          nx_dtls_telemetry_session;
+
+    /* Define the DNS name the collector certificate must be issued to.  */
+    const UCHAR                    *nx_dtls_telemetry_server_name;
+    UINT                            nx_dtls_telemetry_server_name_length;
+
+    /* Define the collector address and port.  */
+    NXD_ADDRESS                     nx_dtls_telemetry_server_address;
+    UINT                            nx_dtls_telemetry_server_port;
+
+    /* Define the connection state.  */
+    UINT                            nx_dtls_telemetry_connected;
+
+    /* Define the number of samples sent and the number of samples dropped.  */
+    ULONG                           nx_dtls_telemetry_samples_sent;
+    ULONG                           nx_dtls_telemetry_samples_dropped;
+
+} NX_DTLS_TELEMETRY;
+
+
+#ifndef NX_DTLS_TELEMETRY_SOURCE_CODE
+
+/* Application caller is present, perform API mapping.  */
+
+/* Determine if error checking is desired.  If so, map DTLS telemetry API functions
+   to the appropriate error checking front-ends.  Otherwise, map API
+   functions to the core functions that actually perform the work.
+   Note: error checking is enabled by default.  */
+
+#ifdef NX_DISABLE_ERROR_CHECKING
+
+/* Services without error checking.  */
+
+#define nx_dtls_telemetry_create                        _nx_dtls_telemetry_create
+#define nx_dtls_telemetry_delete                        _nx_dtls_telemetry_delete
+#define nx_dtls_telemetry_psk_add                       _nx_dtls_telemetry_psk_add
+#define nx_dtls_telemetry_trusted_certificate_add       _nx_dtls_telemetry_trusted_certificate_add
+#define nx_dtls_telemetry_connect                       _nx_dtls_telemetry_connect
+#define nx_dtls_telemetry_disconnect                    _nx_dtls_telemetry_disconnect
+#define nx_dtls_telemetry_send                          _nx_dtls_telemetry_send
+
+#else
+
+/* Services with error checking.  */
+
+#define nx_dtls_telemetry_create                        _nxe_dtls_telemetry_create
+#define nx_dtls_telemetry_delete                        _nxe_dtls_telemetry_delete
+#define nx_dtls_telemetry_psk_add                       _nxe_dtls_telemetry_psk_add
+#define nx_dtls_telemetry_trusted_certificate_add       _nxe_dtls_telemetry_trusted_certificate_add
+#define nx_dtls_telemetry_connect                       _nxe_dtls_telemetry_connect
+#define nx_dtls_telemetry_disconnect                    _nxe_dtls_telemetry_disconnect
+#define nx_dtls_telemetry_send                          _nxe_dtls_telemetry_send
+
+#endif
+
+/* Define the prototypes accessible to the application software.  */
+
+/* Create/delete DTLS telemetry channel.  */
+UINT nx_dtls_telemetry_create(NX_DTLS_TELEMETRY *telemetry_ptr, const CHAR *telemetry_name, NX_IP *ip_ptr,
+                              NX_PACKET_POOL *pool_ptr, const NX_SECURE_TLS_CRYPTO *crypto_table,
+                              VOID *metadata_buffer, ULONG metadata_size,
+                              UCHAR *packet_reassembly_buffer, UINT packet_reassembly_buffer_size,
+                              UINT certs_number, UCHAR *remote_certificate_buffer, ULONG remote_certificate_buffer_size);
+UINT nx_dtls_telemetry_delete(NX_DTLS_TELEMETRY *telemetry_ptr);
+
+/* Configure authentication with the collector.  */
+UINT nx_dtls_telemetry_psk_add(NX_DTLS_TELEMETRY *telemetry_ptr, UCHAR *pre_shared_key, UINT psk_length,
+                               UCHAR *psk_identity, UINT identity_length, UCHAR *hint, UINT hint_length);
+UINT nx_dtls_telemetry_trusted_certificate_add(NX_DTLS_TELEMETRY *telemetry_ptr, NX_SECURE_X509_CERT *certificate,
+                                               const UCHAR *server_name, UINT server_name_length);
+
+/* Connect/disconnect the collector.  */
+UINT nx_dtls_telemetry_connect(NX_DTLS_TELEMETRY *telemetry_ptr, NXD_ADDRESS *server_address, UINT server_port,
+                               ULONG wait_option);
+UINT nx_dtls_telemetry_disconnect(NX_DTLS_TELEMETRY *telemetry_ptr, ULONG wait_option);
+
+/* Send one telemetry sample.  */
+UINT nx_dtls_telemetry_send(NX_DTLS_TELEMETRY *telemetry_ptr, const UCHAR *data, UINT data_size, ULONG wait_option);
+
+#else
+
+/* DTLS telemetry source code is being compiled, do not perform any API mapping.  */
+
+UINT _nxe_dtls_telemetry_create(NX_DTLS_TELEMETRY *telemetry_ptr, const CHAR *telemetry_name, NX_IP *ip_ptr,
+                                NX_PACKET_POOL *pool_ptr, const NX_SECURE_TLS_CRYPTO *crypto_table,
+                                VOID *metadata_buffer, ULONG metadata_size,
+                                UCHAR *packet_reassembly_buffer, UINT packet_reassembly_buffer_size,
+                                UINT certs_number, UCHAR *remote_certificate_buffer, ULONG remote_certificate_buffer_size);
+UINT _nx_dtls_telemetry_create(NX_DTLS_TELEMETRY *telemetry_ptr, const CHAR *telemetry_name, NX_IP *ip_ptr,
+                               NX_PACKET_POOL *pool_ptr, const NX_SECURE_TLS_CRYPTO *crypto_table,
+                               VOID *metadata_buffer, ULONG metadata_size,
+                               UCHAR *packet_reassembly_buffer, UINT packet_reassembly_buffer_size,
+                               UINT certs_number, UCHAR *remote_certificate_buffer, ULONG remote_certificate_buffer_size);
+UINT _nxe_dtls_telemetry_delete(NX_DTLS_TELEMETRY *telemetry_ptr);
+UINT _nx_dtls_telemetry_delete(NX_DTLS_TELEMETRY *telemetry_ptr);
+UINT _nxe_dtls_telemetry_psk_add(NX_DTLS_TELEMETRY *telemetry_ptr, UCHAR *pre_shared_key, UINT psk_length,
+                                 UCHAR *psk_identity, UINT identity_length, UCHAR *hint, UINT hint_length);
+UINT _nx_dtls_telemetry_psk_add(NX_DTLS_TELEMETRY *telemetry_ptr, UCHAR *pre_shared_key, UINT psk_length,
+                                UCHAR *psk_identity, UINT identity_length, UCHAR *hint, UINT hint_length);
+UINT _nxe_dtls_telemetry_trusted_certificate_add(NX_DTLS_TELEMETRY *telemetry_ptr, NX_SECURE_X509_CERT *certificate,
+                                                 const UCHAR *server_name, UINT server_name_length);
+UINT _nx_dtls_telemetry_trusted_certificate_add(NX_DTLS_TELEMETRY *telemetry_ptr, NX_SECURE_X509_CERT *certificate,
+                                                const UCHAR *server_name, UINT server_name_length);
+UINT _nxe_dtls_telemetry_connect(NX_DTLS_TELEMETRY *telemetry_ptr, NXD_ADDRESS *server_address, UINT server_port,
+                                 ULONG wait_option);
+UINT _nx_dtls_telemetry_connect(NX_DTLS_TELEMETRY *telemetry_ptr, NXD_ADDRESS *server_address, UINT server_port,
+                                ULONG wait_option);
+UINT _nxe_dtls_telemetry_disconnect(NX_DTLS_TELEMETRY *telemetry_ptr, ULONG wait_option);
+UINT _nx_dtls_telemetry_disconnect(NX_DTLS_TELEMETRY *telemetry_ptr, ULONG wait_option);
+UINT _nxe_dtls_telemetry_send(NX_DTLS_TELEMETRY *telemetry_ptr, const UCHAR *data, UINT data_size, ULONG wait_option);
+UINT _nx_dtls_telemetry_send(NX_DTLS_TELEMETRY *telemetry_ptr, const UCHAR *data, UINT data_size, ULONG wait_option);
+
+#endif
+
+
+/* Determine if a C++ compiler is being used.  If so, complete the standard
+   C conditional started above.  */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NX_DTLS_TELEMETRY_H  */
@@ -47,6 +47,7 @@
 #define MQTT_PING_TIMEOUT_EVENT       ((ULONG)0x00000010)
 #define MQTT_NETWORK_DISCONNECT_EVENT ((ULONG)0x00000020)
 #define MQTT_TCP_ESTABLISH_EVENT      ((ULONG)0x00000040)
+#define MQTT_TLS_FLUSH_EVENT          ((ULONG)0x00000080)
 
 static UINT _nxd_mqtt_client_create_internal(NXD_MQTT_CLIENT *client_ptr, CHAR *client_name,
                                              CHAR *client_id, UINT client_id_length,
@@ -59,6 +60,13 @@ static VOID _nxd_mqtt_release_transmit_packet(NXD_MQTT_CLIENT *client_ptr, NX_PA
 static VOID _nxd_mqtt_release_receive_packet(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, NX_PACKET *previous_packet_ptr);
 static UINT _nxd_mqtt_client_retransmit_message(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option);
 static UINT _nxd_mqtt_client_connect_packet_send(NXD_MQTT_CLIENT *client_ptr, ULONG wait_option);
+#ifdef NX_SECURE_ENABLE
+static UINT _nxd_mqtt_client_tls_send(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, UINT coalesce, ULONG wait_option);
+#ifdef NXD_MQTT_TLS_COALESCE_ENABLE
+static VOID _nxd_mqtt_client_tls_flush(NXD_MQTT_CLIENT *client_ptr);
+static VOID _nxd_mqtt_client_tls_coalesce_timer_entry(ULONG client);
+#endif /* NXD_MQTT_TLS_COALESCE_ENABLE */
+#endif /* NX_SECURE_ENABLE */
 
 /**************************************************************************/
 /*                                                                        */
@@ -241,6 +249,309 @@ ULONG  bytes_copied;
 
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_tls_send                           PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function sends an MQTT packet over the TLS session.   */
+/*    With NXD_MQTT_TLS_COALESCE_ENABLE, small packets marked as          */
+/*    coalescable are held and the packets that follow are copied behind  */
+/*    them, so several MQTT packets go out in one TLS record. Held        */
+/*    packets are always sent before any other packet.                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*    packet_ptr                            Pointer to packet to send     */
+/*    coalesce                              Packet may be held back       */
+/*    wait_option                           Wait option                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                                                        */
+/*    tx_mutex_put                                                        */
+/*    tx_timer_create                                                     */
+/*    tx_timer_change                                                     */
+/*    tx_timer_activate                                                   */
+/*    tx_timer_deactivate                                                 */
+/*    nx_secure_tls_session_max_fragment_length_get                       */
+/*    nx_secure_tls_session_send                                          */
+/*    nx_packet_release                                                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_sub_unsub                                          */
+/*    _nxd_mqtt_process_publish                                           */
+/*    _nxd_mqtt_process_publish_response                                  */
+/*    _nxd_mqtt_client_retransmit_message                                 */
+/*    _nxd_mqtt_client_connect_packet_send                                */
+/*    _nxd_mqtt_client_publish_packet_send                                */
+/*    _nxd_mqtt_send_simple_message                                       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_ENABLE
+static UINT _nxd_mqtt_client_tls_send(NXD_MQTT_CLIENT *client_ptr, NX_PACKET *packet_ptr, UINT coalesce, ULONG wait_option)
+{
+#ifdef NXD_MQTT_TLS_COALESCE_ENABLE
+UINT       status;
+NX_PACKET *pending_ptr;
+NX_PACKET *held_ptr = NX_NULL;
+ULONG      limit = NXD_MQTT_TLS_COALESCE_SIZE;
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+UINT       fragment_length;
+
+
+    /* Never build a record larger than the negotiated max_fragment_length. */
+    if ((nx_secure_tls_session_max_fragment_length_get(&(client_ptr -> nxd_mqtt_tls_session), &fragment_length) == NX_SUCCESS) &&
+        (fragment_length < limit))
+    {
+        limit = fragment_length;
+    }
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+
+    /* Only small, unchained packets are gathered. */
+    if ((packet_ptr -> nx_packet_next != NX_NULL) || (packet_ptr -> nx_packet_length >= limit))
+    {
+        coalesce = NX_FALSE;
+    }
+
+    /* Obtain the mutex. */
+    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
+
+    pending_ptr = client_ptr -> nxd_mqtt_tls_coalesce_packet;
+
+    /* Copy the packet behind the held ones if it fits in both the record and the buffer. */
+    if (coalesce && (pending_ptr != NX_NULL) &&
+        ((pending_ptr -> nx_packet_length + packet_ptr -> nx_packet_length) <= limit) &&
+        (packet_ptr -> nx_packet_length <= (ULONG)(pending_ptr -> nx_packet_data_end - pending_ptr -> nx_packet_append_ptr)))
+    {
+        memcpy(pending_ptr -> nx_packet_append_ptr, packet_ptr -> nx_packet_prepend_ptr, packet_ptr -> nx_packet_length); /* Use case of memcpy is verified. */
+        pending_ptr -> nx_packet_append_ptr += packet_ptr -> nx_packet_length;
+        pending_ptr -> nx_packet_length += packet_ptr -> nx_packet_length;
+
+        /* Release the mutex. */
+        tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+        nx_packet_release(packet_ptr);
+
+        return(NX_SUCCESS);
+    }
+
+    /* The held packets must go out first. */
+    if (pending_ptr != NX_NULL)
+    {
+        client_ptr -> nxd_mqtt_tls_coalesce_packet = NX_NULL;
+        tx_timer_deactivate(&(client_ptr -> nxd_mqtt_tls_coalesce_timer));
+    }
+
+    if (coalesce)
+    {
+
+        /* Start the flush timer and hold this packet in place of the old ones. */
+        if ((client_ptr -> nxd_mqtt_tls_coalesce_timer).tx_timer_id == 0)
+        {
+            status = tx_timer_create(&(client_ptr -> nxd_mqtt_tls_coalesce_timer), "MQTT TLS Coalesce Timer",
+                                     _nxd_mqtt_client_tls_coalesce_timer_entry, (ULONG)client_ptr,
+                                     NXD_MQTT_TLS_COALESCE_TIMEOUT, 0, TX_AUTO_ACTIVATE);
+        }
+        else
+        {
+            tx_timer_change(&(client_ptr -> nxd_mqtt_tls_coalesce_timer), NXD_MQTT_TLS_COALESCE_TIMEOUT, 0);
+            status = tx_timer_activate(&(client_ptr -> nxd_mqtt_tls_coalesce_timer));
+        }
+
+        if (status == TX_SUCCESS)
+        {
+            client_ptr -> nxd_mqtt_tls_coalesce_packet = packet_ptr;
+            held_ptr = packet_ptr;
+        }
+    }
+
+    /* Release the mutex. */
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+    if (pending_ptr != NX_NULL)
+    {
+        status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), pending_ptr, wait_option);
+
+        if (status)
+        {
+            nx_packet_release(pending_ptr);
+
+            if (held_ptr == NX_NULL)
+            {
+                return(status);
+            }
+
+            /* Give the held packet back to the caller unless it has already been sent. */
+            tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
+            if (client_ptr -> nxd_mqtt_tls_coalesce_packet == held_ptr)
+            {
+                client_ptr -> nxd_mqtt_tls_coalesce_packet = NX_NULL;
+                tx_timer_deactivate(&(client_ptr -> nxd_mqtt_tls_coalesce_timer));
+                held_ptr = NX_NULL;
+            }
+            tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+            if (held_ptr == NX_NULL)
+            {
+                return(status);
+            }
+        }
+    }
+
+    if (held_ptr != NX_NULL)
+    {
+        return(NX_SUCCESS);
+    }
+#else
+    NX_PARAMETER_NOT_USED(coalesce);
+#endif /* NXD_MQTT_TLS_COALESCE_ENABLE */
+
+    return(nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, wait_option));
+}
+
+
+#ifdef NXD_MQTT_TLS_COALESCE_ENABLE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_tls_flush                          PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function sends the MQTT packets held back by          */
+/*    _nxd_mqtt_client_tls_send.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client_ptr                            Pointer to MQTT Client        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                                                        */
+/*    tx_mutex_put                                                        */
+/*    nx_secure_tls_session_send                                          */
+/*    nx_packet_release                                                   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nxd_mqtt_client_event_process                                      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nxd_mqtt_client_tls_flush(NXD_MQTT_CLIENT *client_ptr)
+{
+NX_PACKET *pending_ptr;
+
+
+    /* Obtain the mutex. */
+    tx_mutex_get(client_ptr -> nxd_mqtt_client_mutex_ptr, TX_WAIT_FOREVER);
+
+    pending_ptr = client_ptr -> nxd_mqtt_tls_coalesce_packet;
+    client_ptr -> nxd_mqtt_tls_coalesce_packet = NX_NULL;
+
+    /* Release the mutex. */
+    tx_mutex_put(client_ptr -> nxd_mqtt_client_mutex_ptr);
+
+    if (pending_ptr == NX_NULL)
+    {
+        return;
+    }
+
+    if (nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), pending_ptr, NX_WAIT_FOREVER))
+    {
+        nx_packet_release(pending_ptr);
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_mqtt_client_tls_coalesce_timer_entry           PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This internal function runs when held MQTT packets have waited      */
+/*    NXD_MQTT_TLS_COALESCE_TIMEOUT ticks. It wakes the MQTT thread to    */
+/*    send them.                                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    client                                Pointer to MQTT Client        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_event_flags_set                                                  */
+/*    nx_cloud_module_event_set                                           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX timer                                                       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nxd_mqtt_client_tls_coalesce_timer_entry(ULONG client)
+{
+NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)client;
+
+#ifndef NXD_MQTT_CLOUD_ENABLE
+    tx_event_flags_set(&client_ptr -> nxd_mqtt_events, MQTT_TLS_FLUSH_EVENT, TX_OR);
+#else
+    nx_cloud_module_event_set(&(client_ptr -> nxd_mqtt_client_cloud_module), MQTT_TLS_FLUSH_EVENT);
+#endif /* NXD_MQTT_CLOUD_ENABLE */
+}
+#endif /* NXD_MQTT_TLS_COALESCE_ENABLE */
+#endif /* NX_SECURE_ENABLE */
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -283,7 +594,7 @@ ULONG  bytes_copied;
 /*    _nxd_mqtt_client_append_message                                     */
 /*    tx_mutex_put                                                        */
 /*    nx_tcp_socket_send                                                  */
-/*    nx_secure_tls_session_send                                          */
+/*    _nxd_mqtt_client_tls_send                                           */
 /*    nx_packet_release                                                   */
 /*    _nxd_mqtt_copy_transmit_packet                                      */
 /*                                                                        */
@@ -464,7 +775,7 @@ UCHAR               temp_data[2];
 #ifdef NX_SECURE_ENABLE
     if (client_ptr -> nxd_mqtt_client_use_tls)
     {
-        status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, NX_WAIT_FOREVER);
+        status = _nxd_mqtt_client_tls_send(client_ptr, packet_ptr, NX_FALSE, NX_WAIT_FOREVER);
     }
     else
     {
@@ -1195,7 +1506,7 @@ ULONG  bytes_copied;
 /*    _nxd_mqtt_packet_allocate                                           */
 /*    nx_tcp_socket_send                                                  */
 /*    nx_packet_release                                                   */
-/*    nx_secure_tls_session_send                                          */
+/*    _nxd_mqtt_client_tls_send                                           */
 /*    _nxd_mqtt_process_publish_packet                                    */
 /*    _nxd_mqtt_copy_transmit_packet                                      */
 /*                                                                        */
@@ -1399,7 +1710,7 @@ ULONG                         bytes_copied;
 #ifdef NX_SECURE_ENABLE
     if (client_ptr -> nxd_mqtt_client_use_tls)
     {
-        status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, NX_WAIT_FOREVER);
+        status = _nxd_mqtt_client_tls_send(client_ptr, packet_ptr, NX_TRUE, NX_WAIT_FOREVER);
     }
     else
     {
@@ -1457,7 +1768,7 @@ ULONG                         bytes_copied;
 /*                                            callback function           */
 /*    _nxd_mqtt_release_transmit_packet                                   */
 /*    nx_tcp_socket_send                                                  */
-/*    nx_secure_tls_session_send                                          */
+/*    _nxd_mqtt_client_tls_send                                           */
 /*                                                                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -1577,7 +1888,7 @@ USHORT                        transmit_packet_id;
 #ifdef NX_SECURE_ENABLE
                     if (client_ptr -> nxd_mqtt_client_use_tls)
                     {
-                        ret = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), response_packet, NX_WAIT_FOREVER);
+                        ret = _nxd_mqtt_client_tls_send(client_ptr, response_packet, NX_TRUE, NX_WAIT_FOREVER);
                     }
                     else
                     {
@@ -2544,6 +2855,7 @@ UCHAR len[2];
 /*    nx_tcp_socket_disconnect              Close TCP connection          */
 /*    nx_tcp_client_socket_unbind           Unbind TCP socket             */
 /*    tx_timer_delete                       Delete timer                  */
+/*    nx_packet_release                     Release packet                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -2574,6 +2886,19 @@ VOID _nxd_mqtt_client_connection_end(NXD_MQTT_CLIENT *client_ptr, ULONG wait_opt
 #ifdef NX_SECURE_ENABLE
     if (client_ptr -> nxd_mqtt_client_use_tls)
     {
+#ifdef NXD_MQTT_TLS_COALESCE_ENABLE
+
+        /* Drop the packets still held for coalescing. */
+        if ((client_ptr -> nxd_mqtt_tls_coalesce_timer).tx_timer_id != 0)
+        {
+            tx_timer_delete(&(client_ptr -> nxd_mqtt_tls_coalesce_timer));
+        }
+        if (client_ptr -> nxd_mqtt_tls_coalesce_packet)
+        {
+            nx_packet_release(client_ptr -> nxd_mqtt_tls_coalesce_packet);
+            client_ptr -> nxd_mqtt_tls_coalesce_packet = NX_NULL;
+        }
+#endif /* NXD_MQTT_TLS_COALESCE_ENABLE */
         nx_secure_tls_session_end(&(client_ptr -> nxd_mqtt_tls_session), wait_option);
         nx_secure_tls_session_delete(&(client_ptr -> nxd_mqtt_tls_session));
     }
@@ -2707,6 +3032,7 @@ NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)client;
 /*    _nxd_mqtt_send_simple_message                                       */
 /*    _nxd_mqtt_process_disconnect                                        */
 /*    _nxd_mqtt_packet_receive_process                                    */
+/*    _nxd_mqtt_client_tls_flush                                          */
 /*    tx_timer_delete                                                     */
 /*    tx_event_flags_delete                                               */
 /*    nx_tcp_socket_delete                                                */
@@ -2766,6 +3092,14 @@ NXD_MQTT_CLIENT *client_ptr = (NXD_MQTT_CLIENT *)mqtt_client;
         _nxd_mqtt_packet_receive_process(client_ptr);
     }
 
+#if defined(NX_SECURE_ENABLE) && defined(NXD_MQTT_TLS_COALESCE_ENABLE)
+    if (module_own_events & MQTT_TLS_FLUSH_EVENT)
+    {
+        /* Send the MQTT packets held back for TLS record coalescing. */
+        _nxd_mqtt_client_tls_flush(client_ptr);
+    }
+#endif /* NX_SECURE_ENABLE && NXD_MQTT_TLS_COALESCE_ENABLE */
+
     if (module_own_events & MQTT_PING_TIMEOUT_EVENT)
     {
         /* The server/broker didn't respond to our ping request message. Disconnect from the server. */
@@ -3579,7 +3913,7 @@ UINT _nxde_mqtt_client_login_set(NXD_MQTT_CLIENT *client_ptr,
 /*                                                                        */
 /*    tx_mutex_get                                                        */
 /*    tx_mutex_put                                                        */
-/*    nx_secure_tls_session_send                                          */
+/*    _nxd_mqtt_client_tls_send                                           */
 /*    nx_tcp_socket_send                                                  */
 /*    nx_packet_release                                                   */
 /*    tx_time_get                                                         */
@@ -3631,7 +3965,7 @@ UCHAR               fixed_header;
 #ifdef NX_SECURE_ENABLE
             if (client_ptr -> nxd_mqtt_client_use_tls)
             {
-                status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, wait_option);
+                status = _nxd_mqtt_client_tls_send(client_ptr, packet_ptr, NX_FALSE, wait_option);
             }
             else
             {
@@ -4040,7 +4374,7 @@ UINT                 old_priority;
 /*                                                                        */
 /*    nx_packet_release                                                   */
 /*    nx_tcp_socket_send                                                  */
-/*    nx_secure_tls_session_send                                          */
+/*    _nxd_mqtt_client_tls_send                                           */
 /*    _nxd_mqtt_packet_allocate                                           */
 /*    _nxd_mqtt_release_transmit_packet                                   */
 /*    _nxd_mqtt_client_connection_end                                     */
@@ -4236,7 +4570,7 @@ UINT                 keepalive = (client_ptr -> nxd_mqtt_keepalive/NX_IP_PERIODI
 #ifdef NX_SECURE_ENABLE
     if (client_ptr -> nxd_mqtt_client_use_tls)
     {
-        status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, wait_option);
+        status = _nxd_mqtt_client_tls_send(client_ptr, packet_ptr, NX_FALSE, wait_option);
     }
     else
     {
@@ -4457,7 +4791,7 @@ UINT _nxd_mqtt_client_delete(NXD_MQTT_CLIENT *client_ptr)
 /*    tx_mutex_get                                                        */
 /*    tx_mutex_put                                                        */
 /*    nx_tcp_socket_send                                                  */
-/*    nx_secure_tls_session_send                                          */
+/*    _nxd_mqtt_client_tls_send                                           */
 /*    nx_packet_release                                                   */
 /*    _nxd_mqtt_copy_transmit_packet                                      */
 /*                                                                        */
@@ -4535,7 +4869,7 @@ UINT       ret = NXD_MQTT_SUCCESS;
 #ifdef NX_SECURE_ENABLE
     if (client_ptr -> nxd_mqtt_client_use_tls)
     {
-        status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, wait_option);
+        status = _nxd_mqtt_client_tls_send(client_ptr, packet_ptr, NX_TRUE, wait_option);
     }
     else
     {
@@ -4913,7 +5247,7 @@ UINT _nxd_mqtt_client_unsubscribe(NXD_MQTT_CLIENT *client_ptr, CHAR *topic_name,
 /*    _nxd_mqtt_packet_allocate                                           */
 /*    tx_mutex_put                                                        */
 /*    nx_tcp_socket_send                                                  */
-/*    nx_secure_tls_session_send                                          */
+/*    _nxd_mqtt_client_tls_send                                           */
 /*    nx_packet_release                                                   */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -4966,7 +5300,7 @@ UCHAR     *byte;
 #ifdef NX_SECURE_ENABLE
     if (client_ptr -> nxd_mqtt_client_use_tls)
     {
-        status = nx_secure_tls_session_send(&(client_ptr -> nxd_mqtt_tls_session), packet_ptr, NX_WAIT_FOREVER);
+        status = _nxd_mqtt_client_tls_send(client_ptr, packet_ptr, NX_FALSE, NX_WAIT_FOREVER);
     }
     else
     {
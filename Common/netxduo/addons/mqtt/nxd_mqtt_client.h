@@ -142,6 +142,22 @@ extern   "C" {
 #define NXD_MQTT_SOCKET_TIMEOUT                                         NX_WAIT_FOREVER
 #endif
 
+/* Define NXD_MQTT_TLS_COALESCE_ENABLE to gather small MQTT packets sent over TLS into
+   one TLS record. PUBLISH packets and publish acknowledgements are held back until
+   NXD_MQTT_TLS_COALESCE_SIZE bytes are waiting or NXD_MQTT_TLS_COALESCE_TIMEOUT ticks
+   have passed. Any other packet sends the waiting ones first, so the order on the
+   wire is kept. Records never exceed a max_fragment_length negotiated by TLS. */
+
+/* Set the number of bytes gathered into one TLS record. */
+#ifndef NXD_MQTT_TLS_COALESCE_SIZE
+#define NXD_MQTT_TLS_COALESCE_SIZE                                     1024
+#endif
+
+/* Set how long gathered packets may wait, in ThreadX timer ticks. The default is 50 ms. */
+#ifndef NXD_MQTT_TLS_COALESCE_TIMEOUT
+#define NXD_MQTT_TLS_COALESCE_TIMEOUT                                  ((NX_IP_PERIODIC_RATE / 20) + 1)
+#endif
+
 /* Define the default MQTT TLS (secure) port number */
 #define NXD_MQTT_TLS_PORT                                              8883
 
@@ -350,6 +366,10 @@ typedef struct NXD_MQTT_CLIENT_STRUCT
     NX_SECURE_X509_CERT            nxd_mqtt_tls_trusted_certificate;
     NX_SECURE_TLS_SESSION          nxd_mqtt_tls_session;
     UINT                           nxd_mqtt_tls_in_progress;
+#ifdef NXD_MQTT_TLS_COALESCE_ENABLE
+    NX_PACKET                     *nxd_mqtt_tls_coalesce_packet;                    /* Packets waiting to be sent in one TLS record. */
+    TX_TIMER                       nxd_mqtt_tls_coalesce_timer;                     /* Sends the waiting packets on timeout. */
+#endif /* NXD_MQTT_TLS_COALESCE_ENABLE */
 #endif
 } NXD_MQTT_CLIENT;
 
@@ -451,6 +451,17 @@ VOID _nx_trace_event_update(TX_TRACE_BUFFER_ENTRY *event, ULONG timestamp, ULONG
 #define NX_PACKET_ALIGNMENT                      sizeof(ULONG)
 #endif /* NX_PACKET_ALIGNMENT */
 
+/* Define the number of packet owners, threads or ISRs, that packet tracking keeps statistics for
+   in each packet pool. The default is 8. */
+#ifndef NX_PACKET_TRACK_MAX_OWNERS
+#define NX_PACKET_TRACK_MAX_OWNERS               8
+#endif /* NX_PACKET_TRACK_MAX_OWNERS */
+
+/* Define the maximum number of packet pools in a packet pool group. The default is 4. */
+#ifndef NX_PACKET_POOL_GROUP_MAX_POOLS
+#define NX_PACKET_POOL_GROUP_MAX_POOLS           4
+#endif /* NX_PACKET_POOL_GROUP_MAX_POOLS */
+
 
 /* Define basic constants for the NetX TCP/IP Stack.  */
 #define AZURE_RTOS_NETXDUO
@@ -1532,6 +1543,12 @@ typedef  struct NX_PACKET_STRUCT
     ULONG       nx_packet_debug_line;
 #endif /* NX_ENABLE_PACKET_DEBUG_INFO */
 
+#ifdef NX_ENABLE_PACKET_TRACKING
+    /* Define the owner slot in the packet pool and the time the packet was allocated.  */
+    ULONG       nx_packet_track_owner;
+    ULONG       nx_packet_track_time;
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
 #ifdef NX_PACKET_HEADER_PAD
 
     /* Define a pad word for 16-byte alignment, if necessary.  */
@@ -1540,6 +1557,27 @@ typedef  struct NX_PACKET_STRUCT
 } NX_PACKET;
 
 
+#ifdef NX_ENABLE_PACKET_TRACKING
+/* Define the packet tracking statistics of one packet owner, the thread that allocated the
+   packets or NX_NULL for ISRs and initialization.  */
+
+typedef struct NX_PACKET_TRACK_OWNER_STRUCT
+{
+
+    /* Define the owner thread.  */
+    TX_THREAD  *nx_packet_track_owner_thread;
+
+    /* Define the packets the owner holds now and the most it ever held.  */
+    ULONG       nx_packet_track_owner_live;
+    ULONG       nx_packet_track_owner_max_live;
+
+    /* Define the number of allocations and the longest time, in ticks, a released packet was held.  */
+    ULONG       nx_packet_track_owner_allocations;
+    ULONG       nx_packet_track_owner_max_hold;
+} NX_PACKET_TRACK_OWNER;
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
+
 /* Define the Packet Pool control block that will be used to manage each individual
    packet pool.  */
 
@@ -1589,9 +1627,111 @@ typedef struct NX_PACKET_POOL_STRUCT
     /* Low watermark. */
     UINT        nx_packet_pool_low_watermark;
 #endif /* NX_ENABLE_LOW_WATERMARK */
+
+#ifdef NX_ENABLE_PACKET_CACHE
+    /* Define the list of packet caches that hold free packets of this pool.  */
+    struct NX_PACKET_CACHE_STRUCT
+               *nx_packet_pool_cache_list;
+#endif /* NX_ENABLE_PACKET_CACHE */
+
+#ifdef NX_ENABLE_PACKET_TRACKING
+    /* Define the packet owners of this pool and the allocations that found no free owner slot.  */
+    NX_PACKET_TRACK_OWNER
+                nx_packet_pool_track_owners[NX_PACKET_TRACK_MAX_OWNERS];
+    UINT        nx_packet_pool_track_owner_count;
+    ULONG       nx_packet_pool_track_untracked;
+
+    /* Define the fewest available packets the pool ever had.  */
+    ULONG       nx_packet_pool_track_min_available;
+
+    /* Define the routine that reports the packets still held when the pool is deleted.  */
+    VOID      (*nx_packet_pool_track_report_notify)(struct NX_PACKET_POOL_STRUCT *pool_ptr, TX_THREAD *owner_thread,
+                                                    ULONG live_packets, ULONG max_live_packets, ULONG allocations,
+                                                    ULONG max_hold_ticks, ULONG oldest_hold_ticks);
+#endif /* NX_ENABLE_PACKET_TRACKING */
 } NX_PACKET_POOL;
 
 
+/* Define the Packet Pool Group control block.  A packet pool group allocates each packet from
+   the packet pool with the smallest payload size that fits the requested payload, so small
+   packets do not tie up large ones.  */
+
+typedef struct NX_PACKET_POOL_GROUP_STRUCT
+{
+
+    /* Define the packet pool group ID used for error checking.  */
+    ULONG       nx_packet_pool_group_id;
+
+    /* Define the packet pool group's name.  */
+    CHAR       *nx_packet_pool_group_name;
+
+    /* Define the packet pools of the group, in increasing order of payload size.  */
+    NX_PACKET_POOL
+               *nx_packet_pool_group_pools[NX_PACKET_POOL_GROUP_MAX_POOLS];
+    UINT        nx_packet_pool_group_pool_count;
+
+#ifndef NX_DISABLE_PACKET_INFO
+    /* Define the statistics of each packet pool of the group. Best fit allocations are served
+       by the smallest pool that fits, larger allocations by a larger pool because the smaller
+       ones were empty, and chained packets are parts of a packet chain.  */
+    ULONG       nx_packet_pool_group_best_fit_allocations[NX_PACKET_POOL_GROUP_MAX_POOLS];
+    ULONG       nx_packet_pool_group_larger_allocations[NX_PACKET_POOL_GROUP_MAX_POOLS];
+    ULONG       nx_packet_pool_group_chained_packets[NX_PACKET_POOL_GROUP_MAX_POOLS];
+    ULONG       nx_packet_pool_group_empty_requests[NX_PACKET_POOL_GROUP_MAX_POOLS];
+
+    /* Define the statistics of the group.  */
+    ULONG       nx_packet_pool_group_chained_allocations;
+    ULONG       nx_packet_pool_group_failed_allocations;
+    ULONG       nx_packet_pool_group_requested_bytes;
+    ULONG       nx_packet_pool_group_allocated_bytes;
+#endif /* NX_DISABLE_PACKET_INFO */
+} NX_PACKET_POOL_GROUP;
+
+
+/* Define the Packet Cache control block.  A packet cache keeps a few free packets of one packet
+   pool for a thread or a module, and moves them to and from the pool in batches.  */
+
+typedef struct NX_PACKET_CACHE_STRUCT
+{
+
+    /* Define the packet cache ID used for error checking.  */
+    ULONG       nx_packet_cache_id;
+
+    /* Define the packet cache's name.  */
+    CHAR       *nx_packet_cache_name;
+
+    /* Define the packet pool that the cached packets belong to.  */
+    NX_PACKET_POOL
+               *nx_packet_cache_pool;
+
+    /* Define the list of cached packets, linked through nx_packet_queue_next.  */
+    NX_PACKET  *nx_packet_cache_head;
+    NX_PACKET  *nx_packet_cache_tail;
+    ULONG       nx_packet_cache_count;
+
+    /* Define the number of packets moved at once and the most packets kept.  */
+    ULONG       nx_packet_cache_batch_size;
+    ULONG       nx_packet_cache_max_packets;
+
+#ifndef NX_DISABLE_PACKET_INFO
+    /* Define the statistics of the packet cache. Hits are allocations served by the cache and
+       misses allocations passed to the pool. Refills and drains are batches moved from and to
+       the pool, bypasses are releases sent to the pool because it was low, and reclaims count
+       the times the pool took back the cached packets because it ran empty.  */
+    ULONG       nx_packet_cache_hits;
+    ULONG       nx_packet_cache_misses;
+    ULONG       nx_packet_cache_refills;
+    ULONG       nx_packet_cache_drains;
+    ULONG       nx_packet_cache_bypasses;
+    ULONG       nx_packet_cache_reclaims;
+#endif /* NX_DISABLE_PACKET_INFO */
+
+    /* Define the next packet cache of the same packet pool.  */
+    struct NX_PACKET_CACHE_STRUCT
+               *nx_packet_cache_next;
+} NX_PACKET_CACHE;
+
+
 #ifndef NX_DISABLE_IPV4
 /* Define the Address Resolution Protocol (ARP) structure that makes up the
    route table in each IP instance.  This is how IP addresses are translated
@@ -3090,6 +3230,20 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_packet_pool_delete                           _nx_packet_pool_delete
 #define nx_packet_pool_info_get                         _nx_packet_pool_info_get
 #define nx_packet_pool_low_watermark_set                _nx_packet_pool_low_watermark_set
+#define nx_packet_pool_group_allocate                   _nx_packet_pool_group_allocate
+#define nx_packet_pool_group_create                     _nx_packet_pool_group_create
+#define nx_packet_pool_group_delete                     _nx_packet_pool_group_delete
+#define nx_packet_pool_group_info_get                   _nx_packet_pool_group_info_get
+#define nx_packet_cache_allocate                        _nx_packet_cache_allocate
+#define nx_packet_cache_create                          _nx_packet_cache_create
+#define nx_packet_cache_delete                          _nx_packet_cache_delete
+#define nx_packet_cache_info_get                        _nx_packet_cache_info_get
+#define nx_packet_cache_release                         _nx_packet_cache_release
+#define nx_packet_cache_trim                            _nx_packet_cache_trim
+#define nx_packet_pool_track_info_get                   _nx_packet_pool_track_info_get
+#define nx_packet_pool_track_notify                     _nx_packet_pool_track_notify
+#define nx_packet_pool_track_owner_get                  _nx_packet_pool_track_owner_get
+#define nx_packet_pool_track_report                     _nx_packet_pool_track_report
 #define nx_packet_release                               _nx_packet_release
 #define nx_packet_transmit_release                      _nx_packet_transmit_release
 
@@ -3296,6 +3450,20 @@ typedef struct NX_IP_DRIVER_STRUCT
 #define nx_packet_pool_delete                           _nxe_packet_pool_delete
 #define nx_packet_pool_info_get                         _nxe_packet_pool_info_get
 #define nx_packet_pool_low_watermark_set                _nxe_packet_pool_low_watermark_set
+#define nx_packet_pool_group_allocate                   _nxe_packet_pool_group_allocate
+#define nx_packet_pool_group_create                     _nxe_packet_pool_group_create
+#define nx_packet_pool_group_delete                     _nxe_packet_pool_group_delete
+#define nx_packet_pool_group_info_get                   _nxe_packet_pool_group_info_get
+#define nx_packet_cache_allocate                        _nxe_packet_cache_allocate
+#define nx_packet_cache_create                          _nxe_packet_cache_create
+#define nx_packet_cache_delete                          _nxe_packet_cache_delete
+#define nx_packet_cache_info_get                        _nxe_packet_cache_info_get
+#define nx_packet_cache_release(c, p)                   _nxe_packet_cache_release(c, &p)
+#define nx_packet_cache_trim                            _nxe_packet_cache_trim
+#define nx_packet_pool_track_info_get                   _nxe_packet_pool_track_info_get
+#define nx_packet_pool_track_notify                     _nxe_packet_pool_track_notify
+#define nx_packet_pool_track_owner_get                  _nxe_packet_pool_track_owner_get
+#define nx_packet_pool_track_report                     _nxe_packet_pool_track_report
 #define nx_packet_release(p)                            _nxe_packet_release(&p)
 #define nx_packet_transmit_release(p)                   _nxe_packet_transmit_release(&p)
 
@@ -3558,12 +3726,43 @@ UINT nx_packet_pool_info_get(NX_PACKET_POOL *pool_ptr, ULONG *total_packets, ULO
                              ULONG *empty_pool_requests, ULONG *empty_pool_suspensions,
                              ULONG *invalid_packet_releases);
 UINT nx_packet_pool_low_watermark_set(NX_PACKET_POOL *pool_ptr, ULONG low_water_mark);
+UINT nx_packet_pool_group_allocate(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET **packet_ptr,
+                                   ULONG packet_type, ULONG payload_size, ULONG wait_option);
+UINT nx_packet_pool_group_create(NX_PACKET_POOL_GROUP *group_ptr, CHAR *name,
+                                 NX_PACKET_POOL **pool_list, UINT pool_count);
+UINT nx_packet_pool_group_delete(NX_PACKET_POOL_GROUP *group_ptr);
+UINT nx_packet_pool_group_info_get(NX_PACKET_POOL_GROUP *group_ptr, UINT pool_index, NX_PACKET_POOL **pool_ptr,
+                                   ULONG *best_fit_allocations, ULONG *larger_allocations,
+                                   ULONG *chained_packets, ULONG *empty_requests);
+UINT nx_packet_cache_allocate(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr,
+                              ULONG packet_type, ULONG wait_option);
+UINT nx_packet_cache_create(NX_PACKET_CACHE *cache_ptr, CHAR *name, NX_PACKET_POOL *pool_ptr,
+                            ULONG batch_size, ULONG max_packets);
+UINT nx_packet_cache_delete(NX_PACKET_CACHE *cache_ptr);
+UINT nx_packet_cache_info_get(NX_PACKET_CACHE *cache_ptr, ULONG *cached_packets, ULONG *hits, ULONG *misses,
+                              ULONG *refills, ULONG *drains, ULONG *bypasses, ULONG *reclaims);
+UINT nx_packet_cache_trim(NX_PACKET_CACHE *cache_ptr);
+UINT nx_packet_pool_track_info_get(NX_PACKET_POOL *pool_ptr, ULONG *min_available, ULONG *owner_count,
+                                   ULONG *untracked_allocations);
+UINT nx_packet_pool_track_notify(NX_PACKET_POOL *pool_ptr,
+                                 VOID (*report_notify)(NX_PACKET_POOL *pool_ptr, TX_THREAD *owner_thread,
+                                                       ULONG live_packets, ULONG max_live_packets, ULONG allocations,
+                                                       ULONG max_hold_ticks, ULONG oldest_hold_ticks));
+UINT nx_packet_pool_track_owner_get(NX_PACKET_POOL *pool_ptr, UINT owner_index, TX_THREAD **owner_thread,
+                                    ULONG *live_packets, ULONG *max_live_packets, ULONG *allocations,
+                                    ULONG *max_hold_ticks, ULONG *oldest_hold_ticks);
+UINT nx_packet_pool_track_report(NX_PACKET_POOL *pool_ptr, UINT leaks_only,
+                                 VOID (*report_notify)(NX_PACKET_POOL *pool_ptr, TX_THREAD *owner_thread,
+                                                       ULONG live_packets, ULONG max_live_packets, ULONG allocations,
+                                                       ULONG max_hold_ticks, ULONG oldest_hold_ticks));
 #ifndef NX_DISABLE_ERROR_CHECKING
 UINT _nxe_packet_release(NX_PACKET **packet_ptr_ptr);
 UINT _nxe_packet_transmit_release(NX_PACKET **packet_ptr_ptr);
+UINT _nxe_packet_cache_release(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr_ptr);
 #else
 UINT _nx_packet_release(NX_PACKET *packet_ptr);
 UINT _nx_packet_transmit_release(NX_PACKET *packet_ptr);
+UINT _nx_packet_cache_release(NX_PACKET_CACHE *cache_ptr, NX_PACKET *packet_ptr);
 #endif
 
 /* APIs for RARP. */
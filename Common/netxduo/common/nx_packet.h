@@ -52,6 +52,14 @@
 
 
 #define NX_PACKET_POOL_ID           ((ULONG)0x5041434B)
+#define NX_PACKET_POOL_GROUP_ID     ((ULONG)0x50475250)
+#define NX_PACKET_CACHE_ID          ((ULONG)0x50434348)
+
+
+/* Define the packet owner slot of packets that are not tracked, because they are free or
+   all owner slots of the pool were taken.  */
+
+#define NX_PACKET_TRACK_NONE        ((ULONG)0xFFFFFFFF)
 
 
 /* Define constants for packet free, allocated, enqueued, and driver transmit done.
@@ -110,6 +118,40 @@ UINT _nx_packet_transmit_release(NX_PACKET *packet_ptr);
 VOID _nx_packet_pool_cleanup(TX_THREAD *thread_ptr NX_CLEANUP_PARAMETER);
 VOID _nx_packet_pool_initialize(VOID);
 UINT _nx_packet_pool_low_watermark_set(NX_PACKET_POOL *pool_ptr, ULONG low_watermark);
+UINT _nx_packet_pool_group_allocate(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET **packet_ptr,
+                                    ULONG packet_type, ULONG payload_size, ULONG wait_option);
+UINT _nx_packet_pool_group_create(NX_PACKET_POOL_GROUP *group_ptr, CHAR *name,
+                                  NX_PACKET_POOL **pool_list, UINT pool_count);
+UINT _nx_packet_pool_group_delete(NX_PACKET_POOL_GROUP *group_ptr);
+UINT _nx_packet_pool_group_info_get(NX_PACKET_POOL_GROUP *group_ptr, UINT pool_index, NX_PACKET_POOL **pool_ptr,
+                                    ULONG *best_fit_allocations, ULONG *larger_allocations,
+                                    ULONG *chained_packets, ULONG *empty_requests);
+UINT _nx_packet_cache_allocate(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr,
+                               ULONG packet_type, ULONG wait_option);
+UINT _nx_packet_cache_create(NX_PACKET_CACHE *cache_ptr, CHAR *name, NX_PACKET_POOL *pool_ptr,
+                             ULONG batch_size, ULONG max_packets);
+UINT _nx_packet_cache_delete(NX_PACKET_CACHE *cache_ptr);
+UINT _nx_packet_cache_info_get(NX_PACKET_CACHE *cache_ptr, ULONG *cached_packets, ULONG *hits, ULONG *misses,
+                               ULONG *refills, ULONG *drains, ULONG *bypasses, ULONG *reclaims);
+UINT _nx_packet_cache_release(NX_PACKET_CACHE *cache_ptr, NX_PACKET *packet_ptr);
+UINT _nx_packet_cache_trim(NX_PACKET_CACHE *cache_ptr);
+VOID _nx_packet_cache_drain(NX_PACKET_CACHE *cache_ptr, ULONG packet_count);
+VOID _nx_packet_cache_reclaim(NX_PACKET_POOL *pool_ptr);
+UINT _nx_packet_pool_track_info_get(NX_PACKET_POOL *pool_ptr, ULONG *min_available, ULONG *owner_count,
+                                    ULONG *untracked_allocations);
+UINT _nx_packet_pool_track_notify(NX_PACKET_POOL *pool_ptr,
+                                  VOID (*report_notify)(NX_PACKET_POOL *pool_ptr, TX_THREAD *owner_thread,
+                                                        ULONG live_packets, ULONG max_live_packets, ULONG allocations,
+                                                        ULONG max_hold_ticks, ULONG oldest_hold_ticks));
+UINT _nx_packet_pool_track_owner_get(NX_PACKET_POOL *pool_ptr, UINT owner_index, TX_THREAD **owner_thread,
+                                     ULONG *live_packets, ULONG *max_live_packets, ULONG *allocations,
+                                     ULONG *max_hold_ticks, ULONG *oldest_hold_ticks);
+UINT _nx_packet_pool_track_report(NX_PACKET_POOL *pool_ptr, UINT leaks_only,
+                                  VOID (*report_notify)(NX_PACKET_POOL *pool_ptr, TX_THREAD *owner_thread,
+                                                        ULONG live_packets, ULONG max_live_packets, ULONG allocations,
+                                                        ULONG max_hold_ticks, ULONG oldest_hold_ticks));
+VOID _nx_packet_pool_track_allocate(NX_PACKET_POOL *pool_ptr, NX_PACKET *packet_ptr, TX_THREAD *thread_ptr);
+VOID _nx_packet_pool_track_release(NX_PACKET_POOL *pool_ptr, NX_PACKET *packet_ptr);
 
 
 /* Define error checking shells for API services.  These are only referenced by the
@@ -133,6 +175,36 @@ UINT _nxe_packet_pool_info_get(NX_PACKET_POOL *pool_ptr, ULONG *total_packets, U
 UINT _nxe_packet_release(NX_PACKET **packet_ptr_ptr);
 UINT _nxe_packet_transmit_release(NX_PACKET **packet_ptr_ptr);
 UINT _nxe_packet_pool_low_watermark_set(NX_PACKET_POOL *pool_ptr, ULONG low_watermark);
+UINT _nxe_packet_pool_group_allocate(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET **packet_ptr,
+                                     ULONG packet_type, ULONG payload_size, ULONG wait_option);
+UINT _nxe_packet_pool_group_create(NX_PACKET_POOL_GROUP *group_ptr, CHAR *name,
+                                   NX_PACKET_POOL **pool_list, UINT pool_count);
+UINT _nxe_packet_pool_group_delete(NX_PACKET_POOL_GROUP *group_ptr);
+UINT _nxe_packet_pool_group_info_get(NX_PACKET_POOL_GROUP *group_ptr, UINT pool_index, NX_PACKET_POOL **pool_ptr,
+                                     ULONG *best_fit_allocations, ULONG *larger_allocations,
+                                     ULONG *chained_packets, ULONG *empty_requests);
+UINT _nxe_packet_cache_allocate(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr,
+                                ULONG packet_type, ULONG wait_option);
+UINT _nxe_packet_cache_create(NX_PACKET_CACHE *cache_ptr, CHAR *name, NX_PACKET_POOL *pool_ptr,
+                              ULONG batch_size, ULONG max_packets);
+UINT _nxe_packet_cache_delete(NX_PACKET_CACHE *cache_ptr);
+UINT _nxe_packet_cache_info_get(NX_PACKET_CACHE *cache_ptr, ULONG *cached_packets, ULONG *hits, ULONG *misses,
+                                ULONG *refills, ULONG *drains, ULONG *bypasses, ULONG *reclaims);
+UINT _nxe_packet_cache_release(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr_ptr);
+UINT _nxe_packet_cache_trim(NX_PACKET_CACHE *cache_ptr);
+UINT _nxe_packet_pool_track_info_get(NX_PACKET_POOL *pool_ptr, ULONG *min_available, ULONG *owner_count,
+                                     ULONG *untracked_allocations);
+UINT _nxe_packet_pool_track_notify(NX_PACKET_POOL *pool_ptr,
+                                   VOID (*report_notify)(NX_PACKET_POOL *pool_ptr, TX_THREAD *owner_thread,
+                                                         ULONG live_packets, ULONG max_live_packets, ULONG allocations,
+                                                         ULONG max_hold_ticks, ULONG oldest_hold_ticks));
+UINT _nxe_packet_pool_track_owner_get(NX_PACKET_POOL *pool_ptr, UINT owner_index, TX_THREAD **owner_thread,
+                                      ULONG *live_packets, ULONG *max_live_packets, ULONG *allocations,
+                                      ULONG *max_hold_ticks, ULONG *oldest_hold_ticks);
+UINT _nxe_packet_pool_track_report(NX_PACKET_POOL *pool_ptr, UINT leaks_only,
+                                   VOID (*report_notify)(NX_PACKET_POOL *pool_ptr, TX_THREAD *owner_thread,
+                                                         ULONG live_packets, ULONG max_live_packets, ULONG allocations,
+                                                         ULONG max_hold_ticks, ULONG oldest_hold_ticks));
 
 
 /* Packet pool management component data declarations follow.  */
@@ -58,6 +58,9 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_packet_cache_reclaim              Take back cached packets      */
+/*    _nx_packet_pool_track_allocate        Track an allocated packet     */
+/*    tx_thread_identify                    Get current thread pointer    */
 /*    _tx_thread_system_suspend             Suspend thread                */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -102,6 +105,16 @@ ULONG                  trace_timestamp;
     /* Disable interrupts to get a packet from the pool.  */
     TX_DISABLE
 
+#ifdef NX_ENABLE_PACKET_CACHE
+    /* Determine if the pool is empty while packet caches may hold some of its packets.  */
+    if ((pool_ptr -> nx_packet_pool_available == 0) && (pool_ptr -> nx_packet_pool_cache_list))
+    {
+
+        /* Take back the cached packets, so none are stranded in the caches.  */
+        _nx_packet_cache_reclaim(pool_ptr);
+    }
+#endif /* NX_ENABLE_PACKET_CACHE */
+
     /* Determine if there is an available packet.  */
     if (pool_ptr -> nx_packet_pool_available)
     {
@@ -168,6 +181,11 @@ ULONG                  trace_timestamp;
 
         /* Add debug information. */
         NX_PACKET_DEBUG(__FILE__, __LINE__, work_ptr);
+
+#ifdef NX_ENABLE_PACKET_TRACKING
+        /* Tag the packet with the thread that allocated it.  */
+        _nx_packet_pool_track_allocate(pool_ptr, work_ptr, tx_thread_identify());
+#endif /* NX_ENABLE_PACKET_TRACKING */
     }
     else
     {
@@ -0,0 +1,251 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_allocate                           PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a packet from a packet cache. An empty      */
+/*    cache is refilled with a batch of packets from its packet pool      */
+/*    in one interrupt lockout. If the pool is empty as well, the         */
+/*    packet is allocated from the pool, which takes back the packets     */
+/*    of the other caches or suspends the caller.                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Pointer to packet cache       */
+/*    packet_ptr                            Pointer to place allocated    */
+/*                                            packet pointer              */
+/*    packet_type                           Type of packet to allocate    */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_allocate                   Allocate from the pool        */
+/*    _nx_packet_pool_track_allocate        Track an allocated packet     */
+/*    tx_thread_identify                    Get current thread pointer    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_cache_allocate(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr,
+                                ULONG packet_type, ULONG wait_option)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET_POOL *pool_ptr;       /* Pool pointer            */
+NX_PACKET      *work_ptr;       /* Working packet pointer  */
+NX_PACKET      *last_ptr;       /* Last packet of a batch  */
+ULONG           count;          /* Packets in the batch    */
+ULONG           i;              /* Working index           */
+
+
+    /* Pickup the packet pool of the cache.  */
+    pool_ptr =  cache_ptr -> nx_packet_cache_pool;
+
+    /* Make sure the packet_type does not go beyond nx_packet_data_end. */
+    if (pool_ptr -> nx_packet_pool_payload_size < packet_type)
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+
+    /* Set the return pointer to NULL initially.  */
+    *packet_ptr =   NX_NULL;
+
+    /* Disable interrupts to take a packet from the cache.  */
+    TX_DISABLE
+
+    /* Determine if the cache is empty.  */
+    if (cache_ptr -> nx_packet_cache_head == NX_NULL)
+    {
+
+        /* Yes, refill it with a batch of the available packets of the pool.  */
+        count =  cache_ptr -> nx_packet_cache_batch_size;
+        if (count > pool_ptr -> nx_packet_pool_available)
+        {
+            count =  pool_ptr -> nx_packet_pool_available;
+        }
+
+        if (count)
+        {
+
+            /* Find the last packet of the batch.  */
+            last_ptr =  pool_ptr -> nx_packet_pool_available_list;
+            for (i = 1; i < count; i++)
+            {
+                last_ptr =  last_ptr -> nx_packet_queue_next;
+            }
+
+            /* Move the batch from the available list of the pool to the cache. The packets
+               stay marked as free.  */
+            cache_ptr -> nx_packet_cache_head =        pool_ptr -> nx_packet_pool_available_list;
+            cache_ptr -> nx_packet_cache_tail =        last_ptr;
+            cache_ptr -> nx_packet_cache_count =       count;
+            pool_ptr -> nx_packet_pool_available_list =  last_ptr -> nx_packet_queue_next;
+            pool_ptr -> nx_packet_pool_available =     pool_ptr -> nx_packet_pool_available - count;
+            last_ptr -> nx_packet_queue_next =         NX_NULL;
+
+#ifndef NX_DISABLE_PACKET_INFO
+            /* Increment the number of refills.  */
+            cache_ptr -> nx_packet_cache_refills++;
+#endif /* NX_DISABLE_PACKET_INFO */
+        }
+    }
+
+    /* Pickup the first cached packet.  */
+    work_ptr =  cache_ptr -> nx_packet_cache_head;
+
+    /* Determine if there is a cached packet.  */
+    if (work_ptr == NX_NULL)
+    {
+
+#ifndef NX_DISABLE_PACKET_INFO
+        /* Increment the number of misses.  */
+        cache_ptr -> nx_packet_cache_misses++;
+#endif /* NX_DISABLE_PACKET_INFO */
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* The pool is empty too, so allocate from it. It takes back the packets of the other
+           caches or suspends the caller as the wait option says.  */
+        return(_nx_packet_allocate(pool_ptr, packet_ptr, packet_type, wait_option));
+    }
+
+    /* Remove the packet from the cache.  */
+    cache_ptr -> nx_packet_cache_head =  work_ptr -> nx_packet_queue_next;
+    cache_ptr -> nx_packet_cache_count--;
+    if (cache_ptr -> nx_packet_cache_head == NX_NULL)
+    {
+        cache_ptr -> nx_packet_cache_tail =  NX_NULL;
+    }
+
+#ifndef NX_DISABLE_PACKET_INFO
+    /* Increment the number of hits.  */
+    cache_ptr -> nx_packet_cache_hits++;
+#endif /* NX_DISABLE_PACKET_INFO */
+
+#ifdef NX_ENABLE_PACKET_TRACKING
+    /* Tag the packet with the thread that allocated it.  */
+    _nx_packet_pool_track_allocate(pool_ptr, work_ptr, tx_thread_identify());
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Setup various fields for this packet outside of the interrupt lockout, the packet
+       is no longer visible to the pool.  */
+    work_ptr -> nx_packet_queue_next =   NX_NULL;
+#ifndef NX_DISABLE_PACKET_CHAIN
+    work_ptr -> nx_packet_next =         NX_NULL;
+    work_ptr -> nx_packet_last =         NX_NULL;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+    work_ptr -> nx_packet_length =       0;
+    work_ptr -> nx_packet_prepend_ptr =  work_ptr -> nx_packet_data_start + packet_type;
+    work_ptr -> nx_packet_append_ptr =   work_ptr -> nx_packet_prepend_ptr;
+    work_ptr -> nx_packet_address.nx_packet_interface_ptr = NX_NULL;
+#ifdef NX_ENABLE_INTERFACE_CAPABILITY
+    work_ptr -> nx_packet_interface_capability_flag = 0;
+#endif /* NX_ENABLE_INTERFACE_CAPABILITY */
+    /* Set the TCP queue to the value that indicates it has been allocated.  */
+    /*lint -e{923} suppress cast of ULONG to pointer.  */
+    work_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_ALLOCATED;
+
+#ifdef FEATURE_NX_IPV6
+
+    /* Clear the option state. */
+    work_ptr -> nx_packet_option_state = 0;
+#endif /* FEATURE_NX_IPV6 */
+
+#ifdef NX_IPSEC_ENABLE
+
+    /* Clear the ipsec state. */
+    work_ptr -> nx_packet_ipsec_state = 0;
+    work_ptr -> nx_packet_ipsec_sa_ptr = NX_NULL;
+#endif /* NX_IPSEC_ENABLE */
+
+#ifndef NX_DISABLE_IPV4
+    /* Initialize the IP version field */
+    work_ptr -> nx_packet_ip_version = NX_IP_VERSION_V4;
+#endif /* !NX_DISABLE_IPV4  */
+
+    /* Initialize the IP identification flag.  */
+    work_ptr -> nx_packet_identical_copy = NX_FALSE;
+
+    /* Initialize the IP header length. */
+    work_ptr -> nx_packet_ip_header_length = 0;
+
+#ifdef NX_ENABLE_THREAD
+    work_ptr -> nx_packet_type = 0;
+#endif /* NX_ENABLE_THREAD  */
+
+    /* Place the new packet pointer in the return destination.  */
+    *packet_ptr =  work_ptr;
+
+    /* Add debug information. */
+    NX_PACKET_DEBUG(__FILE__, __LINE__, work_ptr);
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(packet_ptr);
+    NX_PARAMETER_NOT_USED(packet_type);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
+
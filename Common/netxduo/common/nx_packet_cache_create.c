@@ -0,0 +1,119 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_create                             PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a packet cache that keeps up to max_packets   */
+/*    free packets of a packet pool for a thread or a module. Packets     */
+/*    move between the cache and the pool batch_size at a time.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Pointer to packet cache       */
+/*    name                                  Packet cache string name      */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    batch_size                            Packets moved at once         */
+/*    max_packets                           Most packets kept             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_cache_create(NX_PACKET_CACHE *cache_ptr, CHAR *name, NX_PACKET_POOL *pool_ptr,
+                              ULONG batch_size, ULONG max_packets)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Initialize the packet cache control block to zero.  */
+    memset((void *)cache_ptr, 0, sizeof(NX_PACKET_CACHE));
+
+    /* Save the name, the packet pool and the sizes of the cache.  */
+    cache_ptr -> nx_packet_cache_name =         name;
+    cache_ptr -> nx_packet_cache_pool =         pool_ptr;
+    cache_ptr -> nx_packet_cache_batch_size =   batch_size;
+    cache_ptr -> nx_packet_cache_max_packets =  max_packets;
+
+    /* Disable interrupts to add the cache to the caches of the pool.  */
+    TX_DISABLE
+
+    /* Place the cache at the head of the list, so the pool can take back its packets.  */
+    cache_ptr -> nx_packet_cache_next =      pool_ptr -> nx_packet_pool_cache_list;
+    pool_ptr -> nx_packet_pool_cache_list =  cache_ptr;
+
+    /* Mark the cache as created.  */
+    cache_ptr -> nx_packet_cache_id =  NX_PACKET_CACHE_ID;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(name);
+    NX_PARAMETER_NOT_USED(pool_ptr);
+    NX_PARAMETER_NOT_USED(batch_size);
+    NX_PARAMETER_NOT_USED(max_packets);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
+
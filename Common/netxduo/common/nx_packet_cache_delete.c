@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_delete                             PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes a packet cache and returns its cached         */
+/*    packets to the packet pool.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Pointer to packet cache       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_cache_drain                Return cached packets         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_cache_delete(NX_PACKET_CACHE *cache_ptr)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET_CACHE **link_ptr;     /* Working link pointer    */
+
+
+    /* Disable interrupts to remove the cache from the caches of the pool.  */
+    TX_DISABLE
+
+    /* Clear the packet cache ID to make it invalid.  */
+    cache_ptr -> nx_packet_cache_id =  0;
+
+    /* Find the link to this cache.  */
+    link_ptr =  &((cache_ptr -> nx_packet_cache_pool) -> nx_packet_pool_cache_list);
+    while ((*link_ptr) && (*link_ptr != cache_ptr))
+    {
+        link_ptr =  &((*link_ptr) -> nx_packet_cache_next);
+    }
+
+    /* Unlink the cache.  */
+    if (*link_ptr)
+    {
+        *link_ptr =  cache_ptr -> nx_packet_cache_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return the cached packets to the pool.  */
+    _nx_packet_cache_drain(cache_ptr, cache_ptr -> nx_packet_cache_count);
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
+
@@ -0,0 +1,193 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+#ifdef NX_ENABLE_PACKET_CACHE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_drain                              PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns up to packet_count packets of a packet        */
+/*    cache to its packet pool. They are moved in one interrupt lockout   */
+/*    unless threads are waiting for packets of the pool, which then      */
+/*    get them one at a time.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Pointer to packet cache       */
+/*    packet_count                          Number of packets to return   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_release                    Release to a waiting thread   */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_packet_cache_delete               Delete a packet cache         */
+/*    _nx_packet_cache_release              Release to a packet cache     */
+/*    _nx_packet_cache_trim                 Trim a packet cache           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_packet_cache_drain(NX_PACKET_CACHE *cache_ptr, ULONG packet_count)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET_POOL *pool_ptr;       /* Pool pointer            */
+NX_PACKET      *first_ptr;      /* First packet of a batch */
+NX_PACKET      *last_ptr;       /* Last packet of a batch  */
+ULONG           i;              /* Working index           */
+
+
+    /* Pickup the packet pool of the cache.  */
+    pool_ptr =  cache_ptr -> nx_packet_cache_pool;
+
+    /* Disable interrupts to return the packets.  */
+    TX_DISABLE
+
+    /* Return no more packets than are cached.  */
+    if (packet_count > cache_ptr -> nx_packet_cache_count)
+    {
+        packet_count =  cache_ptr -> nx_packet_cache_count;
+    }
+
+    /* Determine if there is nothing to return.  */
+    if (packet_count == 0)
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+        return;
+    }
+
+#ifndef NX_DISABLE_PACKET_INFO
+    /* Increment the number of drains.  */
+    cache_ptr -> nx_packet_cache_drains++;
+#endif /* NX_DISABLE_PACKET_INFO */
+
+    /* Determine if threads are waiting for packets of the pool.  */
+    if (pool_ptr -> nx_packet_pool_suspension_list == TX_NULL)
+    {
+
+        /* No, find the last packet of the batch.  */
+        first_ptr =  cache_ptr -> nx_packet_cache_head;
+        if (packet_count == cache_ptr -> nx_packet_cache_count)
+        {
+            last_ptr =  cache_ptr -> nx_packet_cache_tail;
+        }
+        else
+        {
+            last_ptr =  first_ptr;
+            for (i = 1; i < packet_count; i++)
+            {
+                last_ptr =  last_ptr -> nx_packet_queue_next;
+            }
+        }
+
+        /* Remove the batch from the cache.  */
+        cache_ptr -> nx_packet_cache_head =   last_ptr -> nx_packet_queue_next;
+        cache_ptr -> nx_packet_cache_count =  cache_ptr -> nx_packet_cache_count - packet_count;
+        if (cache_ptr -> nx_packet_cache_head == NX_NULL)
+        {
+            cache_ptr -> nx_packet_cache_tail =  NX_NULL;
+        }
+
+        /* Put the batch back in the available list. The packets are already marked as free.  */
+        last_ptr -> nx_packet_queue_next =         pool_ptr -> nx_packet_pool_available_list;
+        pool_ptr -> nx_packet_pool_available_list =  first_ptr;
+        pool_ptr -> nx_packet_pool_available =     pool_ptr -> nx_packet_pool_available + packet_count;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+        return;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Release the packets one at a time, so the waiting threads are resumed.  */
+    for (i = 0; i < packet_count; i++)
+    {
+
+        /* Disable interrupts to take the next packet from the cache.  */
+        TX_DISABLE
+
+        /* Pickup the first cached packet.  */
+        first_ptr =  cache_ptr -> nx_packet_cache_head;
+        if (first_ptr == NX_NULL)
+        {
+
+            /* The pool took the rest back already.  */
+            TX_RESTORE
+            break;
+        }
+
+        /* Remove the packet from the cache.  */
+        cache_ptr -> nx_packet_cache_head =  first_ptr -> nx_packet_queue_next;
+        cache_ptr -> nx_packet_cache_count--;
+        if (cache_ptr -> nx_packet_cache_head == NX_NULL)
+        {
+            cache_ptr -> nx_packet_cache_tail =  NX_NULL;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Make the packet look allocated, so it can be released alone.  */
+#ifndef NX_DISABLE_PACKET_CHAIN
+        first_ptr -> nx_packet_next =  NX_NULL;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+        /*lint -e{923} suppress cast of ULONG to pointer.  */
+        first_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_ALLOCATED;
+
+        /* Release the packet to the pool, or to a thread waiting for it.  */
+        _nx_packet_release(first_ptr);
+    }
+}
+#endif /* NX_ENABLE_PACKET_CACHE */
+
@@ -0,0 +1,172 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_info_get                           PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information about a packet cache.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Pointer to packet cache       */
+/*    cached_packets                        Packets in the cache          */
+/*    hits                                  Allocations from the cache    */
+/*    misses                                Allocations from the pool     */
+/*    refills                               Batches from the pool         */
+/*    drains                                Batches to the pool           */
+/*    bypasses                              Releases to a low pool        */
+/*    reclaims                              Takebacks by an empty pool    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_cache_info_get(NX_PACKET_CACHE *cache_ptr, ULONG *cached_packets, ULONG *hits, ULONG *misses,
+                                ULONG *refills, ULONG *drains, ULONG *bypasses, ULONG *reclaims)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts to get packet cache information.  */
+    TX_DISABLE
+
+    /* Determine if cached packets is wanted.  */
+    if (cached_packets)
+    {
+
+        /* Return the number of packets in the cache.  */
+        *cached_packets =  cache_ptr -> nx_packet_cache_count;
+    }
+
+#ifndef NX_DISABLE_PACKET_INFO
+    /* Determine if hits is wanted.  */
+    if (hits)
+    {
+
+        /* Return the number of allocations served by the cache.  */
+        *hits =  cache_ptr -> nx_packet_cache_hits;
+    }
+
+    /* Determine if misses is wanted.  */
+    if (misses)
+    {
+
+        /* Return the number of allocations passed to the pool.  */
+        *misses =  cache_ptr -> nx_packet_cache_misses;
+    }
+
+    /* Determine if refills is wanted.  */
+    if (refills)
+    {
+
+        /* Return the number of batches taken from the pool.  */
+        *refills =  cache_ptr -> nx_packet_cache_refills;
+    }
+
+    /* Determine if drains is wanted.  */
+    if (drains)
+    {
+
+        /* Return the number of batches returned to the pool.  */
+        *drains =  cache_ptr -> nx_packet_cache_drains;
+    }
+
+    /* Determine if bypasses is wanted.  */
+    if (bypasses)
+    {
+
+        /* Return the number of releases sent to the pool while it was low.  */
+        *bypasses =  cache_ptr -> nx_packet_cache_bypasses;
+    }
+
+    /* Determine if reclaims is wanted.  */
+    if (reclaims)
+    {
+
+        /* Return the number of times the empty pool took back the cached packets.  */
+        *reclaims =  cache_ptr -> nx_packet_cache_reclaims;
+    }
+#else
+    NX_PARAMETER_NOT_USED(hits);
+    NX_PARAMETER_NOT_USED(misses);
+    NX_PARAMETER_NOT_USED(refills);
+    NX_PARAMETER_NOT_USED(drains);
+    NX_PARAMETER_NOT_USED(bypasses);
+    NX_PARAMETER_NOT_USED(reclaims);
+#endif /* NX_DISABLE_PACKET_INFO */
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(cached_packets);
+    NX_PARAMETER_NOT_USED(hits);
+    NX_PARAMETER_NOT_USED(misses);
+    NX_PARAMETER_NOT_USED(refills);
+    NX_PARAMETER_NOT_USED(drains);
+    NX_PARAMETER_NOT_USED(bypasses);
+    NX_PARAMETER_NOT_USED(reclaims);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
+
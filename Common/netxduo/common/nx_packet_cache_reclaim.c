@@ -0,0 +1,109 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+#ifdef NX_ENABLE_PACKET_CACHE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_reclaim                            PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the packets of all caches of a packet pool    */
+/*    to the pool. It is called with interrupts disabled when the pool    */
+/*    is empty, so packets are not stranded in caches. Each cache is      */
+/*    moved in constant time.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_packet_allocate                   Allocate a packet             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_packet_cache_reclaim(NX_PACKET_POOL *pool_ptr)
+{
+
+NX_PACKET_CACHE *cache_ptr;     /* Working cache pointer   */
+
+
+    /* Walk through the caches of the pool.  */
+    cache_ptr =  pool_ptr -> nx_packet_pool_cache_list;
+    while (cache_ptr)
+    {
+
+        /* Determine if this cache holds packets.  */
+        if (cache_ptr -> nx_packet_cache_count)
+        {
+
+            /* Put all of its packets back in the available list.  */
+            (cache_ptr -> nx_packet_cache_tail) -> nx_packet_queue_next =  pool_ptr -> nx_packet_pool_available_list;
+            pool_ptr -> nx_packet_pool_available_list =  cache_ptr -> nx_packet_cache_head;
+            pool_ptr -> nx_packet_pool_available =       pool_ptr -> nx_packet_pool_available + cache_ptr -> nx_packet_cache_count;
+
+            /* Empty the cache.  */
+            cache_ptr -> nx_packet_cache_head =   NX_NULL;
+            cache_ptr -> nx_packet_cache_tail =   NX_NULL;
+            cache_ptr -> nx_packet_cache_count =  0;
+
+#ifndef NX_DISABLE_PACKET_INFO
+            /* Increment the number of reclaims.  */
+            cache_ptr -> nx_packet_cache_reclaims++;
+#endif /* NX_DISABLE_PACKET_INFO */
+        }
+
+        /* Move to the next cache.  */
+        cache_ptr =  cache_ptr -> nx_packet_cache_next;
+    }
+}
+#endif /* NX_ENABLE_PACKET_CACHE */
+
@@ -0,0 +1,222 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_cache_release                            PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases a packet, or a chain of packets, to a        */
+/*    packet cache. Packets of other pools, and all packets while the     */
+/*    pool has fewer free packets than the batch size or threads          */
+/*    waiting for a packet, go straight to their pool, and the cache      */
+/*    then returns all its packets as well. A cache that holds more       */
+/*    than its maximum returns a batch to the pool.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Pointer to packet cache       */
+/*    packet_ptr                            Packet pointer                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_release                    Release to the pool           */
+/*    _nx_packet_cache_drain                Return cached packets         */
+/*    _nx_packet_pool_track_release         Track a released packet       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_cache_release(NX_PACKET_CACHE *cache_ptr, NX_PACKET *packet_ptr)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET_POOL *pool_ptr;       /* Pool pointer            */
+UINT            cached;         /* Packet is cached        */
+UINT            pool_low;       /* Pool is running low     */
+#ifndef NX_DISABLE_PACKET_CHAIN
+NX_PACKET      *next_packet;    /* Working block pointer   */
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+
+    /* Pickup the packet pool of the cache.  */
+    pool_ptr =  cache_ptr -> nx_packet_cache_pool;
+    pool_low =  NX_FALSE;
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+    /* Loop to free all packets chained together, not assuming they are
+       from the same pool.  */
+    while (packet_ptr)
+    {
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+        /* Check to see if the packet is releasable.  */
+        /*lint -e{923} suppress cast of ULONG to pointer.  */
+        if (packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next != ((NX_PACKET *)NX_PACKET_ALLOCATED))
+        {
+
+#ifndef NX_DISABLE_PACKET_INFO
+            /* Check for a good pool pointer...  error must be the packet!  */
+            if ((packet_ptr -> nx_packet_pool_owner) &&
+                ((packet_ptr -> nx_packet_pool_owner) -> nx_packet_pool_id == NX_PACKET_POOL_ID))
+            {
+
+                /* Increment the packet pool invalid release error count.  */
+                (packet_ptr -> nx_packet_pool_owner) -> nx_packet_pool_invalid_releases++;
+            }
+#endif
+
+            /* Return an error indicating the packet could not be released.  */
+            return(NX_PTR_ERROR);
+        }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+        /* Pickup the next packet. */
+        next_packet =  packet_ptr -> nx_packet_next;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+        /* Add debug information. */
+        NX_PACKET_DEBUG(__FILE__, __LINE__, packet_ptr);
+
+        /* Determine if the packet belongs to the pool of the cache.  */
+        cached =  NX_FALSE;
+        if (packet_ptr -> nx_packet_pool_owner == pool_ptr)
+        {
+
+            /* Disable interrupts to put this packet in the cache.  */
+            TX_DISABLE
+
+            /* Determine if the pool is running low or threads are waiting for one of its packets.  */
+            if ((pool_ptr -> nx_packet_pool_available < cache_ptr -> nx_packet_cache_batch_size) ||
+                (pool_ptr -> nx_packet_pool_suspension_list))
+            {
+
+                /* Yes, the packet goes to the pool.  */
+                pool_low =  NX_TRUE;
+
+#ifndef NX_DISABLE_PACKET_INFO
+                /* Increment the number of bypasses.  */
+                cache_ptr -> nx_packet_cache_bypasses++;
+#endif /* NX_DISABLE_PACKET_INFO */
+            }
+            else
+            {
+
+#ifdef NX_ENABLE_PACKET_TRACKING
+                /* The owner no longer holds this packet.  */
+                _nx_packet_pool_track_release(pool_ptr, packet_ptr);
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
+                /* Mark the packet as free.  */
+                /*lint -e{923} suppress cast of ULONG to pointer.  */
+                packet_ptr -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_FREE;
+
+                /* Put the packet at the head of the cache.  */
+                packet_ptr -> nx_packet_queue_next =  cache_ptr -> nx_packet_cache_head;
+                if (cache_ptr -> nx_packet_cache_head == NX_NULL)
+                {
+                    cache_ptr -> nx_packet_cache_tail =  packet_ptr;
+                }
+                cache_ptr -> nx_packet_cache_head =  packet_ptr;
+                cache_ptr -> nx_packet_cache_count++;
+                cached =  NX_TRUE;
+            }
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+
+        /* Determine if the packet goes to its pool.  */
+        if (cached == NX_FALSE)
+        {
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+            /* Release this packet alone.  */
+            packet_ptr -> nx_packet_next =  NX_NULL;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+            /* Release the packet to its pool, or to a thread waiting for it.  */
+            _nx_packet_release(packet_ptr);
+        }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+        /* Move to the next packet in the list.  */
+        packet_ptr =  next_packet;
+    }
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+    /* Determine if the cached packets are needed by the pool.  */
+    if (pool_low)
+    {
+
+        /* Yes, return all of them so none are stranded in the cache.  */
+        _nx_packet_cache_drain(cache_ptr, cache_ptr -> nx_packet_cache_count);
+    }
+    else if (cache_ptr -> nx_packet_cache_count > cache_ptr -> nx_packet_cache_max_packets)
+    {
+
+        /* The cache is full, return a batch to the pool.  */
+        _nx_packet_cache_drain(cache_ptr, cache_ptr -> nx_packet_cache_batch_size);
+    }
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(packet_ptr);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
+
@@ -163,6 +163,12 @@ VOID           *rounded_pool_start;    /* Rounded stating address     */
         /*lint -e{929} -e{923} -e{740} -e{826} suppress cast of pointer to pointer, since it is necessary  */
         ((NX_PACKET *)packet_ptr) -> nx_packet_union_next.nx_packet_tcp_queue_next =  (NX_PACKET *)NX_PACKET_FREE;
 
+#ifdef NX_ENABLE_PACKET_TRACKING
+        /* The free packet has no owner.  */
+        /*lint -e{929} -e{740} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+        ((NX_PACKET *)packet_ptr) -> nx_packet_track_owner =  NX_PACKET_TRACK_NONE;
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
         /* Setup the packet data pointers.  */
         /*lint -e{929} -e{928} -e{740} -e{826} suppress cast of pointer to pointer, since it is necessary  */
         ((NX_PACKET *)packet_ptr) -> nx_packet_data_start =  (UCHAR *)(packet_ptr + header_size);
@@ -191,6 +197,11 @@ VOID           *rounded_pool_start;    /* Rounded stating address     */
     pool_ptr -> nx_packet_pool_available =  packets;
     pool_ptr -> nx_packet_pool_total =      packets;
 
+#ifdef NX_ENABLE_PACKET_TRACKING
+    /* No packet has been allocated yet.  */
+    pool_ptr -> nx_packet_pool_track_min_available =  packets;
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
     /* Set the packet pool available list.  */
     pool_ptr -> nx_packet_pool_available_list =  (NX_PACKET *)pool_start;
 
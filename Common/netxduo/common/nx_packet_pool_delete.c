@@ -55,6 +55,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_packet_pool_track_report          Report packet owners          */
 /*    _tx_thread_system_resume              Resume threads suspended      */
 /*    _tx_thread_system_preempt_check       Check for preemption          */
 /*                                                                        */
@@ -77,8 +78,21 @@ UINT  _nx_packet_pool_delete(NX_PACKET_POOL *pool_ptr)
 TX_INTERRUPT_SAVE_AREA
 
 TX_THREAD *thread_ptr;      /* Working thread pointer  */
+#ifdef NX_ENABLE_PACKET_CACHE
+NX_PACKET_CACHE *cache_ptr; /* Working cache pointer   */
+#endif /* NX_ENABLE_PACKET_CACHE */
 
 
+#ifdef NX_ENABLE_PACKET_TRACKING
+    /* Determine if the owners still holding packets are to be reported.  */
+    if (pool_ptr -> nx_packet_pool_track_report_notify)
+    {
+
+        /* Yes, report the leaks before the pool goes away.  */
+        _nx_packet_pool_track_report(pool_ptr, NX_TRUE, pool_ptr -> nx_packet_pool_track_report_notify);
+    }
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
     /* Disable interrupts to remove the packet pool from the created list.  */
     TX_DISABLE
 
@@ -88,6 +102,20 @@ TX_THREAD *thread_ptr;      /* Working thread pointer  */
     /* Clear the packet pool ID to make it invalid.  */
     pool_ptr -> nx_packet_pool_id =  0;
 
+#ifdef NX_ENABLE_PACKET_CACHE
+    /* Delete the packet caches of the pool, their packets go away with it.  */
+    cache_ptr =  pool_ptr -> nx_packet_pool_cache_list;
+    while (cache_ptr)
+    {
+        cache_ptr -> nx_packet_cache_id =     0;
+        cache_ptr -> nx_packet_cache_head =   NX_NULL;
+        cache_ptr -> nx_packet_cache_tail =   NX_NULL;
+        cache_ptr -> nx_packet_cache_count =  0;
+        cache_ptr =  cache_ptr -> nx_packet_cache_next;
+    }
+    pool_ptr -> nx_packet_pool_cache_list =  NX_NULL;
+#endif /* NX_ENABLE_PACKET_CACHE */
+
     /* See if the packet pool only one on the list.  */
     if (pool_ptr == pool_ptr -> nx_packet_pool_created_next)
     {
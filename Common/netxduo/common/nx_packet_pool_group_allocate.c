@@ -0,0 +1,310 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_group_allocate                      PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a packet from the packet pool of the group  */
+/*    with the smallest payload size that fits the packet type offset     */
+/*    and the requested payload. If that pool is empty, the next larger   */
+/*    pool with a free packet is used. If no single packet is available,  */
+/*    a chain of packets from the largest pools with free packets is      */
+/*    allocated instead. The head of such a chain has its last packet     */
+/*    pointer set to itself, so nx_packet_data_append fills the chain in  */
+/*    order. Only if that fails too, the caller suspends on the best      */
+/*    fitting pool according to the wait option.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                             Pointer to packet pool group  */
+/*    packet_ptr                            Pointer to place allocated    */
+/*                                            packet pointer              */
+/*    packet_type                           Type of packet to allocate    */
+/*    payload_size                          Size of the payload           */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_allocate                   Allocate a packet             */
+/*    _nx_packet_release                    Release a packet chain        */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_group_allocate(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET **packet_ptr,
+                                     ULONG packet_type, ULONG payload_size, ULONG wait_option)
+{
+#ifndef NX_DISABLE_PACKET_INFO
+TX_INTERRUPT_SAVE_AREA
+
+#endif /* NX_DISABLE_PACKET_INFO */
+UINT            status;
+UINT            pool_count;
+UINT            best_fit;
+UINT            pool_index;
+UINT            best_fit_empty;
+NX_PACKET_POOL *pool_ptr;
+#ifndef NX_DISABLE_PACKET_CHAIN
+NX_PACKET      *work_ptr;
+NX_PACKET      *last_ptr;
+ULONG           available_bytes;
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+
+    /* Set the return pointer to NULL initially.  */
+    *packet_ptr =  NX_NULL;
+
+    /* Pickup the number of packet pools.  */
+    pool_count =  group_ptr -> nx_packet_pool_group_pool_count;
+
+    /* Find the smallest packet pool that fits the packet type offset and the payload.  */
+    for (best_fit = 0; best_fit < pool_count; best_fit++)
+    {
+        if ((group_ptr -> nx_packet_pool_group_pools[best_fit]) -> nx_packet_pool_payload_size >=
+            (packet_type + payload_size))
+        {
+            break;
+        }
+    }
+
+    /* Allocate from the best fitting pool, or from the next larger pool with a free packet.  */
+    status =          NX_NO_PACKET;
+    best_fit_empty =  NX_FALSE;
+    for (pool_index = best_fit; pool_index < pool_count; pool_index++)
+    {
+
+        /* Remember if the best fitting pool is passed over.  */
+        if (pool_index == best_fit)
+        {
+            best_fit_empty =  NX_TRUE;
+        }
+
+        /* Skip the pool without counting an empty request if it has no free packet.  */
+        pool_ptr =  group_ptr -> nx_packet_pool_group_pools[pool_index];
+        if (pool_ptr -> nx_packet_pool_available == 0)
+        {
+            continue;
+        }
+
+        /* Allocate a packet without waiting, another thread may have taken the last one.  */
+        status =  _nx_packet_allocate(pool_ptr, packet_ptr, packet_type, NX_NO_WAIT);
+        if (status == NX_SUCCESS)
+        {
+            best_fit_empty =  (pool_index != best_fit);
+            break;
+        }
+    }
+
+#ifndef NX_DISABLE_PACKET_CHAIN
+    /* Determine if no single packet is available.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* Yes, chain packets of the largest pools with free packets until the payload fits.  */
+        last_ptr =         NX_NULL;
+        available_bytes =  0;
+        for (pool_index = pool_count; (pool_index > 0) && (available_bytes < payload_size); pool_index--)
+        {
+
+            /* Pickup the pool.  */
+            pool_ptr =  group_ptr -> nx_packet_pool_group_pools[pool_index - 1];
+
+            /* The head of the chain needs room for the packet type offset.  */
+            if ((last_ptr == NX_NULL) && (pool_ptr -> nx_packet_pool_payload_size <= packet_type))
+            {
+                break;
+            }
+
+            /* Take the free packets of this pool until the payload fits.  */
+            while ((available_bytes < payload_size) && (pool_ptr -> nx_packet_pool_available))
+            {
+
+                /* Allocate the packet, only the head has the packet type offset.  */
+                if (_nx_packet_allocate(pool_ptr, &work_ptr, (last_ptr == NX_NULL) ? packet_type : 0, NX_NO_WAIT))
+                {
+                    break;
+                }
+
+                /* Link the packet to the end of the chain.  */
+                if (last_ptr == NX_NULL)
+                {
+                    *packet_ptr =  work_ptr;
+                }
+                else
+                {
+                    last_ptr -> nx_packet_next =  work_ptr;
+                }
+                last_ptr =  work_ptr;
+
+                /* Add the room of the packet.  */
+                /*lint -e{946} -e{947} suppress pointer subtraction, since it is necessary. */
+                available_bytes =  available_bytes +
+                    (ULONG)(work_ptr -> nx_packet_data_end - work_ptr -> nx_packet_append_ptr);
+            }
+        }
+
+        /* Determine if the chain holds the payload.  */
+        if ((last_ptr != NX_NULL) && (available_bytes >= payload_size))
+        {
+
+            /* Yes, the chain is filled from the head.  */
+            if (last_ptr != *packet_ptr)
+            {
+                (*packet_ptr) -> nx_packet_last =  *packet_ptr;
+            }
+            status =  NX_SUCCESS;
+        }
+        else if (last_ptr != NX_NULL)
+        {
+
+            /* No, release the partial chain.  */
+            _nx_packet_release(*packet_ptr);
+            *packet_ptr =  NX_NULL;
+        }
+    }
+#else
+
+    /* Determine if the payload does not fit any packet pool.  */
+    if (best_fit == pool_count)
+    {
+
+        /* Packets cannot be chained, return an error.  */
+        return(NX_SIZE_ERROR);
+    }
+#endif /* NX_DISABLE_PACKET_CHAIN */
+
+    /* Determine if the caller waits for the best fitting pool.  */
+    if ((status != NX_SUCCESS) && (best_fit < pool_count) && (wait_option))
+    {
+
+        /* Yes, suspend on the best fitting pool.  */
+        status =  _nx_packet_allocate(group_ptr -> nx_packet_pool_group_pools[best_fit], packet_ptr,
+                                      packet_type, wait_option);
+    }
+
+#ifndef NX_DISABLE_PACKET_INFO
+    /* Disable interrupts to update the statistics.  */
+    TX_DISABLE
+
+    /* Determine if the best fitting pool was empty.  */
+    if (best_fit_empty)
+    {
+
+        /* Yes, it was empty.  */
+        group_ptr -> nx_packet_pool_group_empty_requests[best_fit]++;
+    }
+
+    /* Determine if the allocation failed.  */
+    if (status != NX_SUCCESS)
+    {
+
+        /* Count the failed allocation.  */
+        group_ptr -> nx_packet_pool_group_failed_allocations++;
+    }
+#ifndef NX_DISABLE_PACKET_CHAIN
+    else if ((*packet_ptr) -> nx_packet_next)
+    {
+
+        /* Count the chained allocation and its packets in each pool.  */
+        group_ptr -> nx_packet_pool_group_chained_allocations++;
+        group_ptr -> nx_packet_pool_group_requested_bytes +=  packet_type + payload_size;
+        for (work_ptr = *packet_ptr; work_ptr; work_ptr = work_ptr -> nx_packet_next)
+        {
+            pool_ptr =  work_ptr -> nx_packet_pool_owner;
+            for (pool_index = 0; pool_index < pool_count; pool_index++)
+            {
+                if (group_ptr -> nx_packet_pool_group_pools[pool_index] == pool_ptr)
+                {
+                    group_ptr -> nx_packet_pool_group_chained_packets[pool_index]++;
+                    break;
+                }
+            }
+            group_ptr -> nx_packet_pool_group_allocated_bytes +=  pool_ptr -> nx_packet_pool_payload_size;
+        }
+    }
+#endif /* NX_DISABLE_PACKET_CHAIN */
+    else
+    {
+
+        /* Find the pool of the single packet.  */
+        pool_ptr =  (*packet_ptr) -> nx_packet_pool_owner;
+        for (pool_index = 0; pool_index < pool_count; pool_index++)
+        {
+            if (group_ptr -> nx_packet_pool_group_pools[pool_index] == pool_ptr)
+            {
+                break;
+            }
+        }
+
+        /* Count the single packet allocation.  */
+        if (pool_index == best_fit)
+        {
+            group_ptr -> nx_packet_pool_group_best_fit_allocations[pool_index]++;
+        }
+        else
+        {
+            group_ptr -> nx_packet_pool_group_larger_allocations[pool_index]++;
+        }
+        group_ptr -> nx_packet_pool_group_requested_bytes +=  packet_type + payload_size;
+        group_ptr -> nx_packet_pool_group_allocated_bytes +=  pool_ptr -> nx_packet_pool_payload_size;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+#else
+    NX_PARAMETER_NOT_USED(best_fit_empty);
+#endif /* NX_DISABLE_PACKET_INFO */
+
+    /* Return completion status.  */
+    return(status);
+}
+
@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_group_create                        PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a packet pool group from packet pools that    */
+/*    have already been created, usually with different payload sizes.    */
+/*    The pools are kept in increasing order of payload size, so that     */
+/*    an allocation can pick the smallest pool that fits.                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                             Pointer to packet pool group  */
+/*    name                                  Packet pool group string name */
+/*    pool_list                             List of packet pools          */
+/*    pool_count                            Number of packet pools        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_group_create(NX_PACKET_POOL_GROUP *group_ptr, CHAR *name,
+                                   NX_PACKET_POOL **pool_list, UINT pool_count)
+{
+
+UINT            i;
+UINT            j;
+NX_PACKET_POOL *pool_ptr;
+
+
+    /* Initialize the packet pool group control block to zero.  */
+    memset((void *)group_ptr, 0, sizeof(NX_PACKET_POOL_GROUP));
+
+    /* Save the name of the group.  */
+    group_ptr -> nx_packet_pool_group_name =  name;
+
+    /* Insert each packet pool in increasing order of payload size.  */
+    for (i = 0; i < pool_count; i++)
+    {
+
+        /* Pickup the next packet pool.  */
+        pool_ptr =  pool_list[i];
+
+        /* Move the larger pools up to make room for it.  */
+        j =  i;
+        while ((j > 0) &&
+               ((group_ptr -> nx_packet_pool_group_pools[j - 1]) -> nx_packet_pool_payload_size >
+                pool_ptr -> nx_packet_pool_payload_size))
+        {
+            group_ptr -> nx_packet_pool_group_pools[j] =  group_ptr -> nx_packet_pool_group_pools[j - 1];
+            j--;
+        }
+
+        /* Place the packet pool.  */
+        group_ptr -> nx_packet_pool_group_pools[j] =  pool_ptr;
+    }
+
+    /* Save the number of packet pools.  */
+    group_ptr -> nx_packet_pool_group_pool_count =  pool_count;
+
+    /* Mark the group as created.  */
+    group_ptr -> nx_packet_pool_group_id =  NX_PACKET_POOL_GROUP_ID;
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+}
+
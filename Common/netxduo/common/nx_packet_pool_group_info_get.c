@@ -0,0 +1,146 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_group_info_get                      PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the allocation statistics of a packet pool  */
+/*    of the group. The packet pools are indexed in increasing order of   */
+/*    payload size.                                                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                             Pointer to packet pool group  */
+/*    pool_index                            Index of the packet pool      */
+/*    pool_ptr                              Destination for packet pool   */
+/*    best_fit_allocations                  Destination for the number of */
+/*                                            allocations that fit best   */
+/*    larger_allocations                    Destination for the number of */
+/*                                            allocations that smaller    */
+/*                                            empty pools passed on       */
+/*    chained_packets                       Destination for the number of */
+/*                                            packets given out in chains */
+/*    empty_requests                        Destination for the number of */
+/*                                            requests that fit best but  */
+/*                                            found the pool empty        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_group_info_get(NX_PACKET_POOL_GROUP *group_ptr, UINT pool_index, NX_PACKET_POOL **pool_ptr,
+                                     ULONG *best_fit_allocations, ULONG *larger_allocations,
+                                     ULONG *chained_packets, ULONG *empty_requests)
+{
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts to get packet pool group information.  */
+    TX_DISABLE
+
+    /* Determine if the packet pool is wanted.  */
+    if (pool_ptr)
+    {
+
+        /* Return the packet pool.  */
+        *pool_ptr =  group_ptr -> nx_packet_pool_group_pools[pool_index];
+    }
+
+#ifndef NX_DISABLE_PACKET_INFO
+    /* Determine if best fit allocations is wanted.  */
+    if (best_fit_allocations)
+    {
+
+        /* Return the number of allocations this pool fit best.  */
+        *best_fit_allocations =  group_ptr -> nx_packet_pool_group_best_fit_allocations[pool_index];
+    }
+
+    /* Determine if larger allocations is wanted.  */
+    if (larger_allocations)
+    {
+
+        /* Return the number of allocations this pool served for empty smaller pools.  */
+        *larger_allocations =  group_ptr -> nx_packet_pool_group_larger_allocations[pool_index];
+    }
+
+    /* Determine if chained packets is wanted.  */
+    if (chained_packets)
+    {
+
+        /* Return the number of packets of this pool given out in chains.  */
+        *chained_packets =  group_ptr -> nx_packet_pool_group_chained_packets[pool_index];
+    }
+
+    /* Determine if empty requests is wanted.  */
+    if (empty_requests)
+    {
+
+        /* Return the number of requests that found this pool empty.  */
+        *empty_requests =  group_ptr -> nx_packet_pool_group_empty_requests[pool_index];
+    }
+#else
+    NX_PARAMETER_NOT_USED(best_fit_allocations);
+    NX_PARAMETER_NOT_USED(larger_allocations);
+    NX_PARAMETER_NOT_USED(chained_packets);
+    NX_PARAMETER_NOT_USED(empty_requests);
+#endif /* NX_DISABLE_PACKET_INFO */
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+}
+
@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "tx_timer.h"
+
+
+#ifdef NX_ENABLE_PACKET_TRACKING
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_track_allocate                      PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function tags a packet that was just allocated with its        */
+/*    owner and the current time, and updates the statistics of the       */
+/*    owner and the fewest available packets of the pool. It is called    */
+/*    with interrupts disabled.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    packet_ptr                            Allocated packet              */
+/*    thread_ptr                            Owner thread, NX_NULL for ISR */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_packet_allocate                   Allocate a packet             */
+/*    _nx_packet_cache_allocate             Allocate from a packet cache  */
+/*    _nx_packet_release                    Release a packet              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_packet_pool_track_allocate(NX_PACKET_POOL *pool_ptr, NX_PACKET *packet_ptr, TX_THREAD *thread_ptr)
+{
+
+UINT                   i;
+NX_PACKET_TRACK_OWNER *owner_ptr;
+
+
+    /* Update the fewest available packets of the pool.  */
+    if (pool_ptr -> nx_packet_pool_available < pool_ptr -> nx_packet_pool_track_min_available)
+    {
+        pool_ptr -> nx_packet_pool_track_min_available =  pool_ptr -> nx_packet_pool_available;
+    }
+
+    /* Find the slot of the owner.  */
+    for (i = 0; i < pool_ptr -> nx_packet_pool_track_owner_count; i++)
+    {
+        if (pool_ptr -> nx_packet_pool_track_owners[i].nx_packet_track_owner_thread == thread_ptr)
+        {
+            break;
+        }
+    }
+
+    /* Determine if this is a new owner.  */
+    if (i == pool_ptr -> nx_packet_pool_track_owner_count)
+    {
+
+        /* Determine if all slots are taken.  */
+        if (i == NX_PACKET_TRACK_MAX_OWNERS)
+        {
+
+            /* Yes, the packet is not tracked.  */
+            packet_ptr -> nx_packet_track_owner =  NX_PACKET_TRACK_NONE;
+            pool_ptr -> nx_packet_pool_track_untracked++;
+            return;
+        }
+
+        /* Take the next slot.  */
+        pool_ptr -> nx_packet_pool_track_owners[i].nx_packet_track_owner_thread =  thread_ptr;
+        pool_ptr -> nx_packet_pool_track_owner_count++;
+    }
+
+    /* Update the statistics of the owner.  */
+    owner_ptr =  &(pool_ptr -> nx_packet_pool_track_owners[i]);
+    owner_ptr -> nx_packet_track_owner_allocations++;
+    owner_ptr -> nx_packet_track_owner_live++;
+    if (owner_ptr -> nx_packet_track_owner_live > owner_ptr -> nx_packet_track_owner_max_live)
+    {
+        owner_ptr -> nx_packet_track_owner_max_live =  owner_ptr -> nx_packet_track_owner_live;
+    }
+
+    /* Tag the packet with the owner and the time.  */
+    packet_ptr -> nx_packet_track_owner =  (ULONG)i;
+    packet_ptr -> nx_packet_track_time =   _tx_timer_system_clock;
+}
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
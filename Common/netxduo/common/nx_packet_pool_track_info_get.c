@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_track_info_get                      PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the packet tracking information of a        */
+/*    packet pool.                                                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    min_available                         Fewest available packets      */
+/*    owner_count                           Number of packet owners       */
+/*    untracked_allocations                 Allocations not tracked       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_track_info_get(NX_PACKET_POOL *pool_ptr, ULONG *min_available, ULONG *owner_count,
+                                     ULONG *untracked_allocations)
+{
+#ifdef NX_ENABLE_PACKET_TRACKING
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts to get packet tracking information.  */
+    TX_DISABLE
+
+    /* Determine if the fewest available packets is wanted.  */
+    if (min_available)
+    {
+
+        /* Return the fewest available packets the pool ever had.  */
+        *min_available =  pool_ptr -> nx_packet_pool_track_min_available;
+    }
+
+    /* Determine if owner count is wanted.  */
+    if (owner_count)
+    {
+
+        /* Return the number of packet owners.  */
+        *owner_count =  pool_ptr -> nx_packet_pool_track_owner_count;
+    }
+
+    /* Determine if untracked allocations is wanted.  */
+    if (untracked_allocations)
+    {
+
+        /* Return the number of allocations that found no free owner slot.  */
+        *untracked_allocations =  pool_ptr -> nx_packet_pool_track_untracked;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_TRACKING */
+    NX_PARAMETER_NOT_USED(pool_ptr);
+    NX_PARAMETER_NOT_USED(min_available);
+    NX_PARAMETER_NOT_USED(owner_count);
+    NX_PARAMETER_NOT_USED(untracked_allocations);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_TRACKING */
+}
+
@@ -0,0 +1,102 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_track_notify                        PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the routine that reports the owners still        */
+/*    holding packets when the packet pool is deleted.                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    report_notify                         Routine reporting the leaks,  */
+/*                                            NX_NULL to clear            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_track_notify(NX_PACKET_POOL *pool_ptr,
+                                   VOID (*report_notify)(NX_PACKET_POOL *pool_ptr, TX_THREAD *owner_thread,
+                                                         ULONG live_packets, ULONG max_live_packets, ULONG allocations,
+                                                         ULONG max_hold_ticks, ULONG oldest_hold_ticks))
+{
+#ifdef NX_ENABLE_PACKET_TRACKING
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts to set the routine.  */
+    TX_DISABLE
+
+    /* Save the routine that reports the leaks.  */
+    pool_ptr -> nx_packet_pool_track_report_notify =  report_notify;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_TRACKING */
+    NX_PARAMETER_NOT_USED(pool_ptr);
+    NX_PARAMETER_NOT_USED(report_notify);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_TRACKING */
+}
+
@@ -0,0 +1,207 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_track_owner_get                     PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the packet tracking statistics of one       */
+/*    owner of a packet pool. The age of the oldest packet the owner      */
+/*    still holds is found by walking through the packets of the pool.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    owner_index                           Index of the packet owner     */
+/*    owner_thread                          Owner thread, NX_NULL for ISR */
+/*    live_packets                          Packets held now              */
+/*    max_live_packets                      Most packets ever held        */
+/*    allocations                           Packets allocated             */
+/*    max_hold_ticks                        Longest hold of a released    */
+/*                                            packet                      */
+/*    oldest_hold_ticks                     Age of the oldest packet held */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_packet_pool_track_report          Report packet owners          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_track_owner_get(NX_PACKET_POOL *pool_ptr, UINT owner_index, TX_THREAD **owner_thread,
+                                      ULONG *live_packets, ULONG *max_live_packets, ULONG *allocations,
+                                      ULONG *max_hold_ticks, ULONG *oldest_hold_ticks)
+{
+#ifdef NX_ENABLE_PACKET_TRACKING
+
+TX_INTERRUPT_SAVE_AREA
+
+NX_PACKET_TRACK_OWNER *owner_ptr;
+NX_PACKET             *packet_ptr;
+ULONG                  header_size;
+ULONG                  payload_size;
+ULONG                  oldest_ticks;
+ULONG                  hold_ticks;
+ULONG                  i;
+
+
+    /* Determine if the owner exists.  */
+    if (owner_index >= pool_ptr -> nx_packet_pool_track_owner_count)
+    {
+        return(NX_NOT_FOUND);
+    }
+
+    /* Pickup the owner slot.  */
+    owner_ptr =  &(pool_ptr -> nx_packet_pool_track_owners[owner_index]);
+
+    /* Disable interrupts to get the statistics of the owner.  */
+    TX_DISABLE
+
+    /* Determine if owner thread is wanted.  */
+    if (owner_thread)
+    {
+
+        /* Return the owner thread.  */
+        *owner_thread =  owner_ptr -> nx_packet_track_owner_thread;
+    }
+
+    /* Determine if live packets is wanted.  */
+    if (live_packets)
+    {
+
+        /* Return the number of packets the owner holds.  */
+        *live_packets =  owner_ptr -> nx_packet_track_owner_live;
+    }
+
+    /* Determine if max live packets is wanted.  */
+    if (max_live_packets)
+    {
+
+        /* Return the most packets the owner ever held.  */
+        *max_live_packets =  owner_ptr -> nx_packet_track_owner_max_live;
+    }
+
+    /* Determine if allocations is wanted.  */
+    if (allocations)
+    {
+
+        /* Return the number of packets the owner allocated.  */
+        *allocations =  owner_ptr -> nx_packet_track_owner_allocations;
+    }
+
+    /* Determine if max hold ticks is wanted.  */
+    if (max_hold_ticks)
+    {
+
+        /* Return the longest time the owner held a released packet.  */
+        *max_hold_ticks =  owner_ptr -> nx_packet_track_owner_max_hold;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Determine if oldest hold ticks is wanted.  */
+    if (oldest_hold_ticks)
+    {
+
+        /* Get the first packet. */
+        packet_ptr = (NX_PACKET *)(pool_ptr -> nx_packet_pool_start);
+
+        /* Calculate header size. */
+        header_size = (ULONG)((ALIGN_TYPE)(packet_ptr -> nx_packet_data_start) - (ALIGN_TYPE)packet_ptr);
+
+        /* Round the packet size up to something that helps guarantee proper alignment for header and payload.  */
+        payload_size = (ULONG)(((pool_ptr -> nx_packet_pool_payload_size + header_size + NX_PACKET_ALIGNMENT  - 1) / NX_PACKET_ALIGNMENT) * NX_PACKET_ALIGNMENT - header_size);
+
+        /* Walk through the packets of the pool to find the oldest one the owner holds.  */
+        oldest_ticks =  0;
+        for (i = 0; i < pool_ptr -> nx_packet_pool_total; i++)
+        {
+
+            /* Calculate packet pointer. */
+            packet_ptr = (NX_PACKET *)(pool_ptr -> nx_packet_pool_start + i * (header_size + payload_size));
+
+            /* Determine if the owner holds this packet.  */
+            if (packet_ptr -> nx_packet_track_owner == (ULONG)owner_index)
+            {
+
+                /* Update the oldest packet.  */
+                hold_ticks =  tx_time_get() - packet_ptr -> nx_packet_track_time;
+                if (hold_ticks > oldest_ticks)
+                {
+                    oldest_ticks =  hold_ticks;
+                }
+            }
+        }
+
+        /* Return the age of the oldest packet the owner holds.  */
+        *oldest_hold_ticks =  oldest_ticks;
+    }
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_TRACKING */
+    NX_PARAMETER_NOT_USED(pool_ptr);
+    NX_PARAMETER_NOT_USED(owner_index);
+    NX_PARAMETER_NOT_USED(owner_thread);
+    NX_PARAMETER_NOT_USED(live_packets);
+    NX_PARAMETER_NOT_USED(max_live_packets);
+    NX_PARAMETER_NOT_USED(allocations);
+    NX_PARAMETER_NOT_USED(max_hold_ticks);
+    NX_PARAMETER_NOT_USED(oldest_hold_ticks);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_TRACKING */
+}
+
@@ -0,0 +1,103 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+#include "tx_timer.h"
+
+
+#ifdef NX_ENABLE_PACKET_TRACKING
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_track_release                       PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a packet that is being released from the      */
+/*    packets held by its owner, and updates the longest time the         */
+/*    owner held a packet. It is called with interrupts disabled.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    packet_ptr                            Released packet               */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_packet_cache_release              Release to a packet cache     */
+/*    _nx_packet_release                    Release a packet              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID  _nx_packet_pool_track_release(NX_PACKET_POOL *pool_ptr, NX_PACKET *packet_ptr)
+{
+
+NX_PACKET_TRACK_OWNER *owner_ptr;
+ULONG                  hold_ticks;
+
+
+    /* Determine if the packet is tracked.  */
+    if (packet_ptr -> nx_packet_track_owner == NX_PACKET_TRACK_NONE)
+    {
+        return;
+    }
+
+    /* The owner no longer holds the packet.  */
+    owner_ptr =  &(pool_ptr -> nx_packet_pool_track_owners[packet_ptr -> nx_packet_track_owner]);
+    owner_ptr -> nx_packet_track_owner_live--;
+
+    /* Update the longest time the owner held a packet.  */
+    hold_ticks =  _tx_timer_system_clock - packet_ptr -> nx_packet_track_time;
+    if (hold_ticks > owner_ptr -> nx_packet_track_owner_max_hold)
+    {
+        owner_ptr -> nx_packet_track_owner_max_hold =  hold_ticks;
+    }
+
+    /* Clear the owner of the packet.  */
+    packet_ptr -> nx_packet_track_owner =  NX_PACKET_TRACK_NONE;
+}
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
@@ -0,0 +1,123 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_packet_pool_track_report                        PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function reports the packet tracking statistics of the         */
+/*    owners of a packet pool, one call of report_notify per owner.       */
+/*    With leaks_only set, only the owners that still hold packets        */
+/*    are reported, which at shutdown are the leaks.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    leaks_only                            NX_TRUE for owners holding    */
+/*                                            packets only                */
+/*    report_notify                         Routine called per owner      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_pool_track_owner_get       Get owner statistics          */
+/*    (report_notify)                       Report one owner              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_packet_pool_delete                Delete a packet pool          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nx_packet_pool_track_report(NX_PACKET_POOL *pool_ptr, UINT leaks_only,
+                                   VOID (*report_notify)(NX_PACKET_POOL *pool_ptr, TX_THREAD *owner_thread,
+                                                         ULONG live_packets, ULONG max_live_packets, ULONG allocations,
+                                                         ULONG max_hold_ticks, ULONG oldest_hold_ticks))
+{
+#ifdef NX_ENABLE_PACKET_TRACKING
+
+UINT       i;
+TX_THREAD *owner_thread;
+ULONG      live_packets;
+ULONG      max_live_packets;
+ULONG      allocations;
+ULONG      max_hold_ticks;
+ULONG      oldest_hold_ticks;
+
+
+    /* Loop through the owners of the pool.  */
+    for (i = 0; i < pool_ptr -> nx_packet_pool_track_owner_count; i++)
+    {
+
+        /* Get the statistics of this owner.  */
+        _nx_packet_pool_track_owner_get(pool_ptr, i, &owner_thread, &live_packets, &max_live_packets,
+                                        &allocations, &max_hold_ticks, &oldest_hold_ticks);
+
+        /* Determine if this owner is reported.  */
+        if ((leaks_only == NX_FALSE) || (live_packets))
+        {
+
+            /* Yes, report it.  */
+            report_notify(pool_ptr, owner_thread, live_packets, max_live_packets, allocations,
+                          max_hold_ticks, oldest_hold_ticks);
+        }
+    }
+
+    /* Return completion status.  */
+    return(NX_SUCCESS);
+
+#else /* !NX_ENABLE_PACKET_TRACKING */
+    NX_PARAMETER_NOT_USED(pool_ptr);
+    NX_PARAMETER_NOT_USED(leaks_only);
+    NX_PARAMETER_NOT_USED(report_notify);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_TRACKING */
+}
+
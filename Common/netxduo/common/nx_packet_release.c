@@ -55,6 +55,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_packet_pool_track_allocate        Track an allocated packet     */
+/*    _nx_packet_pool_track_release         Track a released packet       */
 /*    _tx_thread_system_resume              Resume suspended thread       */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -129,6 +131,11 @@ NX_PACKET      *next_packet;    /* Working block pointer   */
         /* Pickup the pool pointer.  */
         pool_ptr =  packet_ptr -> nx_packet_pool_owner;
 
+#ifdef NX_ENABLE_PACKET_TRACKING
+        /* The owner no longer holds this packet.  */
+        _nx_packet_pool_track_release(pool_ptr, packet_ptr);
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
         /* Determine if there are any threads suspended on the block pool.  */
         thread_ptr =  pool_ptr -> nx_packet_pool_suspension_list;
         if (thread_ptr)
@@ -171,6 +178,11 @@ NX_PACKET      *next_packet;    /* Working block pointer   */
             /* Temporarily disable preemption.  */
             _tx_thread_preempt_disable++;
 
+#ifdef NX_ENABLE_PACKET_TRACKING
+            /* The packet goes straight to the suspended thread, which now owns it.  */
+            _nx_packet_pool_track_allocate(pool_ptr, packet_ptr, thread_ptr);
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
             /* Restore interrupts.  */
             TX_RESTORE
 
@@ -697,6 +697,33 @@
 #define NX_ENABLE_DUAL_PACKET_POOL
 */
 
+/* This define specifies the maximum number of packet pools, each with its own payload size, that a
+   packet pool group allocates from. The default value is 4.  */
+/*
+#define NX_PACKET_POOL_GROUP_MAX_POOLS  4
+*/
+
+/* Defined, packet caches are enabled. A packet cache keeps up to a given number of free packets
+   of one packet pool for a thread or a module, so most allocations and releases do not touch the
+   pool. Packets move between the cache and the pool in batches. Releases go straight to the pool
+   while it has fewer free packets than the batch size or threads waiting for a packet, and the
+   pool takes back every cached packet before an allocation from it fails. Cached packets are not
+   counted as free by nx_packet_pool_info_get. */
+/*
+#define NX_ENABLE_PACKET_CACHE
+*/
+
+/* Defined, packet tracking is enabled. Each packet is tagged with the thread that allocated it, or
+   with NX_NULL for ISRs and initialization, and the time of the allocation. Each packet pool keeps
+   the packets held by each of up to NX_PACKET_TRACK_MAX_OWNERS owners, the most they ever held,
+   the longest time a released packet was held and the fewest available packets the pool ever had.
+   nx_packet_pool_track_report reports the packets still held, and the routine set with
+   nx_packet_pool_track_notify does so when the pool is deleted. Each packet grows by 8 bytes. */
+/*
+#define NX_ENABLE_PACKET_TRACKING
+#define NX_PACKET_TRACK_MAX_OWNERS  8
+*/
+
 /* Configuration options for Others */
 
 /* Defined, this option bypasses the basic NetX error checking. This define is typically used
@@ -25,6 +25,7 @@
 #include "wifi.h"
 #include "nx_ip.h"
 #include "nx_tcp.h"
+#include "nx_udp.h"
 #include "tx_thread.h"
 #include "nx_wifi.h"
 
@@ -86,12 +87,9 @@ typedef struct NX_WIFI_SOCKET_STRUCT
     NX_PACKET   *nx_wifi_received_packet_head,
                 *nx_wifi_received_packet_tail;
 
-#ifdef NX_ENABLE_IP_PACKET_FILTER
-
     /* Define the UDP connected IP and port.  */
     ULONG       nx_wifi_udp_socket_connect_ip;
     UINT        nx_wifi_udp_socket_connect_port;
-#endif /* NX_ENABLE_IP_PACKET_FILTER */
     
 }NX_WIFI_SOCKET;
 
@@ -123,6 +121,9 @@ static UINT  nx_wifi_ip_packet_filter(ULONG source_ip, ULONG destination_ip,
                                       ULONG protocol, ULONG packet_length, UINT direction);
 #endif /* NX_ENABLE_IP_PACKET_FILTER */
 
+/* Define the function to place the UDP and IP headers in front of the data of a UDP packet.  */
+static VOID    nx_wifi_udp_header_add(NX_PACKET *packet_ptr, UINT entry_index);
+
 /* Define the wifi thread.  */
 static void    nx_wifi_thread_entry(ULONG thread_input);
 
@@ -299,8 +300,10 @@ uint8_t         ip_address[4];
                     if ((status != WIFI_STATUS_OK) || (size == 0))
                         break;
                     
-                    /* Allocate one packet to store the data.  */
-                    if (nx_packet_allocate(nx_wifi_pool, &packet_ptr,  NX_RECEIVE_PACKET, NX_NO_WAIT))
+                    /* Allocate one packet to store the data, with room for the UDP and IP headers of UDP data.  */
+                    if (nx_packet_allocate(nx_wifi_pool, &packet_ptr,
+                                           (nx_wifi_socket[i].nx_wifi_socket_type == NX_WIFI_UDP_SOCKET) ?
+                                           NX_IPv4_UDP_PACKET : NX_RECEIVE_PACKET, NX_NO_WAIT))
                         break;
                       
                     /* Set the data.  */
@@ -309,6 +312,12 @@ uint8_t         ip_address[4];
                         nx_packet_release(packet_ptr);
                         break;
                     }
+
+                    /* Place the headers in front of UDP data, for nxd_udp_source_extract.  */
+                    if (nx_wifi_socket[i].nx_wifi_socket_type == NX_WIFI_UDP_SOCKET)
+                    {
+                        nx_wifi_udp_header_add(packet_ptr, i);
+                    }
           
                     /* Check to see if the deferred processing queue is empty.  */
                     if (nx_wifi_socket[i].nx_wifi_received_packet_head)
@@ -1446,12 +1455,9 @@ NX_PACKET   *current_packet;
         /* Update the connect flag.  */
         nx_wifi_socket[entry_index].nx_wifi_socket_connected = 1;
 
-#ifdef NX_ENABLE_IP_PACKET_FILTER
-
         /* Set IP and port.  */
         nx_wifi_socket[entry_index].nx_wifi_udp_socket_connect_ip = ip_address -> nxd_ip_address.v4;
         nx_wifi_socket[entry_index].nx_wifi_udp_socket_connect_port = port;
-#endif /* NX_ENABLE_IP_PACKET_FILTER */
     }
         
     /* Initialize the current packet to the input packet pointer.  */
@@ -1497,8 +1503,11 @@ NX_PACKET   *current_packet;
 #endif /* NX_DISABLE_PACKET_CHAIN */
     }
         
-    /* Release the packet.  */
-    nx_packet_release(packet_ptr);
+    /* Leave the packet at its UDP header, as the UDP layer does, and release it. A packet DTLS
+       keeps for retransmission is only marked as sent.  */
+    packet_ptr -> nx_packet_prepend_ptr -= sizeof(NX_UDP_HEADER);
+    packet_ptr -> nx_packet_length += sizeof(NX_UDP_HEADER);
+    nx_packet_transmit_release(packet_ptr);
     
     /* Release the IP internal mutex before processing the IP event.  */
     tx_mutex_put(&(nx_wifi_ip -> nx_ip_protection));
@@ -1551,6 +1560,82 @@ UINT  nx_wifi_udp_socket_receive(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_p
 } 
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    nx_wifi_udp_header_add                              PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function places the UDP header and an IPv4 header in front of  */
+/*    the data of a UDP packet received from the WiFi module, in host     */
+/*    byte order, as the IP layer of NetX Duo leaves them. The module     */
+/*    only passes data from the peer the socket sent to, so that is the   */
+/*    source. Checksums are not filled in.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Pointer to UDP packet         */
+/*    entry_index                           Index of WiFi socket          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    nx_wifi_thread_entry                  WiFi thread entry             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static VOID  nx_wifi_udp_header_add(NX_PACKET *packet_ptr, UINT entry_index)
+{
+
+NX_UDP_SOCKET   *udp_socket;
+NX_UDP_HEADER   *udp_header_ptr;
+NX_IPV4_HEADER  *ip_header_ptr;
+ULONG            udp_length;
+
+
+    /* Get the udp socket.  */
+    udp_socket = (NX_UDP_SOCKET *)nx_wifi_socket[entry_index].nx_wifi_socket_ptr;
+
+    /* Build the UDP header in front of the data.  */
+    udp_length = packet_ptr -> nx_packet_length + sizeof(NX_UDP_HEADER);
+    udp_header_ptr = (NX_UDP_HEADER *)(packet_ptr -> nx_packet_prepend_ptr - sizeof(NX_UDP_HEADER));
+    udp_header_ptr -> nx_udp_header_word_0 = (((ULONG)nx_wifi_socket[entry_index].nx_wifi_udp_socket_connect_port) << NX_SHIFT_BY_16) |
+                                             (ULONG)udp_socket -> nx_udp_socket_port;
+    udp_header_ptr -> nx_udp_header_word_1 = udp_length << NX_SHIFT_BY_16;
+
+    /* Build the IPv4 header in front of the UDP header.  */
+    ip_header_ptr = (NX_IPV4_HEADER *)(((UCHAR *)udp_header_ptr) - sizeof(NX_IPV4_HEADER));
+    ip_header_ptr -> nx_ip_header_word_0 = (NX_IP_VERSION | (udp_length + sizeof(NX_IPV4_HEADER)));
+    ip_header_ptr -> nx_ip_header_word_1 = 0;
+    ip_header_ptr -> nx_ip_header_word_2 = NX_IP_UDP;
+    ip_header_ptr -> nx_ip_header_source_ip = nx_wifi_socket[entry_index].nx_wifi_udp_socket_connect_ip;
+    ip_header_ptr -> nx_ip_header_destination_ip = nx_wifi_ip -> nx_ip_address;
+
+    /* Setup the packet as the IP layer does.  */
+    packet_ptr -> nx_packet_ip_version = NX_IP_VERSION_V4;
+    packet_ptr -> nx_packet_ip_header = (UCHAR *)ip_header_ptr;
+    packet_ptr -> nx_packet_address.nx_packet_interface_ptr = &(nx_wifi_ip -> nx_ip_interface[0]);
+}
+
+
 #ifdef NX_ENABLE_IP_PACKET_FILTER
 /**************************************************************************/ 
 /*                                                                        */ 
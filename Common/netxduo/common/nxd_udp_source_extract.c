@@ -0,0 +1,107 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   User Datagram Protocol (UDP) for STM32L4XX                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_udp.h"
+#include "nx_ipv4.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxd_udp_source_extract                             PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function extracts the source IP address and UDP port of a      */
+/*    received UDP packet. The WiFi driver leaves the UDP header and an   */
+/*    IPv4 header in front of the data of each UDP packet it receives,    */
+/*    in host byte order, as the IP layer of NetX Duo does.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Pointer to UDP packet         */
+/*    ip_address                            Pointer to destination for    */
+/*                                            source IP address           */
+/*    port                                  Pointer to destination for    */
+/*                                            source UDP port             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*    NX_INVALID_PACKET                     Packet has no IP header       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*    _nx_secure_dtls_session_receive       Receive DTLS data             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxd_udp_source_extract(NX_PACKET *packet_ptr, NXD_ADDRESS *ip_address, UINT *port)
+{
+
+ULONG          *temp_ptr;
+NX_IPV4_HEADER *ip_header_ptr;
+
+
+    /* Check for a packet the WiFi driver did not place an IPv4 header in front of.  */
+    if ((packet_ptr -> nx_packet_ip_version != NX_IP_VERSION_V4) || (packet_ptr -> nx_packet_ip_header == NX_NULL))
+    {
+        return(NX_INVALID_PACKET);
+    }
+
+    /* Build an address to the current top of the packet, the UDP header is in front of it.  */
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    temp_ptr =  (ULONG *)packet_ptr -> nx_packet_prepend_ptr;
+
+    /* Pickup the source port.  */
+    *port =  (UINT)(*(temp_ptr - 2) >> NX_SHIFT_BY_16);
+
+    /* Pickup the source IP address.  */
+    /*lint -e{927} -e{826} suppress cast of pointer to pointer, since it is necessary  */
+    ip_header_ptr =  (NX_IPV4_HEADER *)packet_ptr -> nx_packet_ip_header;
+    ip_address -> nxd_ip_version =  NX_IP_VERSION_V4;
+    ip_address -> nxd_ip_address.v4 =  ip_header_ptr -> nx_ip_header_source_ip;
+
+    /* Return successful completion.  */
+    return(NX_SUCCESS);
+}
@@ -0,0 +1,121 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+#ifdef NX_ENABLE_PACKET_CACHE
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+#endif /* NX_ENABLE_PACKET_CACHE */
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_cache_allocate                          PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet cache allocate        */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Pointer to packet cache       */
+/*    packet_ptr                            Pointer to place allocated    */
+/*                                            packet pointer              */
+/*    packet_type                           Type of packet to allocate    */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_cache_allocate             Actual packet cache allocate  */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_cache_allocate(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr,
+                                 ULONG packet_type, ULONG wait_option)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((cache_ptr == NX_NULL) || (cache_ptr -> nx_packet_cache_id != NX_PACKET_CACHE_ID) || (packet_ptr == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid packet type - for alignment purposes, it must be evenly divisible by the size
+       of a ULONG.  */
+    if (packet_type % sizeof(ULONG))
+    {
+        return(NX_OPTION_ERROR);
+    }
+
+    /* Check for a thread caller if the wait option specifies suspension.  */
+    NX_THREAD_WAIT_CALLER_CHECKING
+
+    /* Call actual packet cache allocate function.  */
+    status =  _nx_packet_cache_allocate(cache_ptr, packet_ptr, packet_type, wait_option);
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(packet_ptr);
+    NX_PARAMETER_NOT_USED(packet_type);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
+
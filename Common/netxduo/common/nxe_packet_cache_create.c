@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+#ifdef NX_ENABLE_PACKET_CACHE
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+#endif /* NX_ENABLE_PACKET_CACHE */
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_cache_create                            PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet cache create          */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Pointer to packet cache       */
+/*    name                                  Packet cache string name      */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    batch_size                            Packets moved at once         */
+/*    max_packets                           Most packets kept             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_cache_create               Actual packet cache create    */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_cache_create(NX_PACKET_CACHE *cache_ptr, CHAR *name, NX_PACKET_POOL *pool_ptr,
+                               ULONG batch_size, ULONG max_packets)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((cache_ptr == NX_NULL) || (cache_ptr -> nx_packet_cache_id == NX_PACKET_CACHE_ID) ||
+        (pool_ptr == NX_NULL) || (pool_ptr -> nx_packet_pool_id != NX_PACKET_POOL_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid batch size or cache size.  */
+    if ((batch_size == 0) || (max_packets < batch_size))
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_INIT_AND_THREADS_CALLER_CHECKING
+
+    /* Call actual packet cache create function.  */
+    status =  _nx_packet_cache_create(cache_ptr, name, pool_ptr, batch_size, max_packets);
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(name);
+    NX_PARAMETER_NOT_USED(pool_ptr);
+    NX_PARAMETER_NOT_USED(batch_size);
+    NX_PARAMETER_NOT_USED(max_packets);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
+
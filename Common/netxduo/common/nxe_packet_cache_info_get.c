@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_cache_info_get                          PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet cache information     */
+/*    get function call.                                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Pointer to packet cache       */
+/*    cached_packets                        Packets in the cache          */
+/*    hits                                  Allocations from the cache    */
+/*    misses                                Allocations from the pool     */
+/*    refills                               Batches from the pool         */
+/*    drains                                Batches to the pool           */
+/*    bypasses                              Releases to a low pool        */
+/*    reclaims                              Takebacks by an empty pool    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_cache_info_get             Actual packet cache info get  */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_cache_info_get(NX_PACKET_CACHE *cache_ptr, ULONG *cached_packets, ULONG *hits, ULONG *misses,
+                                 ULONG *refills, ULONG *drains, ULONG *bypasses, ULONG *reclaims)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((cache_ptr == NX_NULL) || (cache_ptr -> nx_packet_cache_id != NX_PACKET_CACHE_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Call actual packet cache information get function.  */
+    status =  _nx_packet_cache_info_get(cache_ptr, cached_packets, hits, misses, refills, drains, bypasses, reclaims);
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(cached_packets);
+    NX_PARAMETER_NOT_USED(hits);
+    NX_PARAMETER_NOT_USED(misses);
+    NX_PARAMETER_NOT_USED(refills);
+    NX_PARAMETER_NOT_USED(drains);
+    NX_PARAMETER_NOT_USED(bypasses);
+    NX_PARAMETER_NOT_USED(reclaims);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
+
@@ -0,0 +1,135 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_cache_release                           PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet cache release         */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    cache_ptr                             Pointer to packet cache       */
+/*    packet_ptr_ptr                        Pointer to packet to release  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_cache_release              Actual packet cache release   */
+/*                                            function                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_cache_release(NX_PACKET_CACHE *cache_ptr, NX_PACKET **packet_ptr_ptr)
+{
+#ifdef NX_ENABLE_PACKET_CACHE
+
+UINT       status;
+NX_PACKET *packet_ptr;
+
+
+    /* Check for an invalid cache pointer.  */
+    if ((cache_ptr == NX_NULL) || (cache_ptr -> nx_packet_cache_id != NX_PACKET_CACHE_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Setup packet pointer.  */
+    packet_ptr =  *packet_ptr_ptr;
+
+    /* Simple integrity check on the packet.  */
+    if ((packet_ptr == NX_NULL) || (packet_ptr -> nx_packet_pool_owner == NX_NULL) ||
+        ((packet_ptr -> nx_packet_pool_owner) -> nx_packet_pool_id != NX_PACKET_POOL_ID))
+    {
+
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid packet prepend pointer.  */
+    /*lint -e{946} suppress pointer subtraction, since it is necessary. */
+    if (packet_ptr -> nx_packet_prepend_ptr < packet_ptr -> nx_packet_data_start)
+    {
+        return(NX_UNDERFLOW);
+    }
+
+    /* Check for an invalid packet append pointer.  */
+    /*lint -e{946} suppress pointer subtraction, since it is necessary. */
+    if (packet_ptr -> nx_packet_append_ptr > packet_ptr -> nx_packet_data_end)
+    {
+        return(NX_OVERFLOW);
+    }
+
+    /* Call actual packet cache release function.  */
+    status =  _nx_packet_cache_release(cache_ptr, packet_ptr);
+
+    /* Determine if the packet release was successful.  */
+    if (status == NX_SUCCESS)
+    {
+
+        /* Yes, now clear the application's packet pointer so it can't be accidentally
+           used again by the application.  This is only done when error checking is
+           enabled.  */
+        *packet_ptr_ptr =  NX_NULL;
+    }
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !NX_ENABLE_PACKET_CACHE */
+    NX_PARAMETER_NOT_USED(cache_ptr);
+    NX_PARAMETER_NOT_USED(packet_ptr_ptr);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_CACHE */
+}
+
@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_pool_group_allocate                     PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet pool group allocate   */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                             Pointer to packet pool group  */
+/*    packet_ptr                            Pointer to place allocated    */
+/*                                            packet pointer              */
+/*    packet_type                           Type of packet to allocate    */
+/*    payload_size                          Size of the payload           */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_pool_group_allocate        Actual packet pool group      */
+/*                                            allocate function           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_pool_group_allocate(NX_PACKET_POOL_GROUP *group_ptr, NX_PACKET **packet_ptr,
+                                      ULONG packet_type, ULONG payload_size, ULONG wait_option)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((group_ptr == NX_NULL) || (group_ptr -> nx_packet_pool_group_id != NX_PACKET_POOL_GROUP_ID) ||
+        (packet_ptr == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid packet type - for alignment purposes, it must be evenly divisible by the size
+       of a ULONG.  */
+    if (packet_type % sizeof(ULONG))
+    {
+        return(NX_OPTION_ERROR);
+    }
+
+    /* Check for a thread caller if the wait option specifies suspension.  */
+    NX_THREAD_WAIT_CALLER_CHECKING
+
+    /* Call actual packet pool group allocate function.  */
+    status =  _nx_packet_pool_group_allocate(group_ptr, packet_ptr, packet_type, payload_size, wait_option);
+
+    /* Return completion status.  */
+    return(status);
+}
+
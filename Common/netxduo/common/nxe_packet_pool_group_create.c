@@ -0,0 +1,118 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_pool_group_create                       PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet pool group create     */
+/*    function call.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                             Pointer to packet pool group  */
+/*    name                                  Packet pool group string name */
+/*    pool_list                             List of packet pools          */
+/*    pool_count                            Number of packet pools        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_pool_group_create          Actual packet pool group      */
+/*                                            create function             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_pool_group_create(NX_PACKET_POOL_GROUP *group_ptr, CHAR *name,
+                                    NX_PACKET_POOL **pool_list, UINT pool_count)
+{
+
+UINT i;
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((group_ptr == NX_NULL) || (group_ptr -> nx_packet_pool_group_id == NX_PACKET_POOL_GROUP_ID) ||
+        (pool_list == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid number of packet pools.  */
+    if ((pool_count == 0) || (pool_count > NX_PACKET_POOL_GROUP_MAX_POOLS))
+    {
+        return(NX_SIZE_ERROR);
+    }
+
+    /* Check for invalid packet pools.  */
+    for (i = 0; i < pool_count; i++)
+    {
+        if ((pool_list[i] == NX_NULL) || (pool_list[i] -> nx_packet_pool_id != NX_PACKET_POOL_ID))
+        {
+            return(NX_PTR_ERROR);
+        }
+    }
+
+    /* Check for appropriate caller.  */
+    NX_INIT_AND_THREADS_CALLER_CHECKING
+
+    /* Call actual packet pool group create function.  */
+    status =  _nx_packet_pool_group_create(group_ptr, name, pool_list, pool_count);
+
+    /* Return completion status.  */
+    return(status);
+}
+
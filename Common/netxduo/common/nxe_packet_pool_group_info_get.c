@@ -0,0 +1,118 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/* Bring in externs for caller checking code.  */
+
+NX_CALLER_CHECKING_EXTERNS
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_pool_group_info_get                     PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet pool group            */
+/*    information get function call.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                             Pointer to packet pool group  */
+/*    pool_index                            Index of the packet pool      */
+/*    pool_ptr                              Destination for packet pool   */
+/*    best_fit_allocations                  Destination for the number of */
+/*                                            allocations that fit best   */
+/*    larger_allocations                    Destination for the number of */
+/*                                            allocations that smaller    */
+/*                                            empty pools passed on       */
+/*    chained_packets                       Destination for the number of */
+/*                                            packets given out in chains */
+/*    empty_requests                        Destination for the number of */
+/*                                            requests that fit best but  */
+/*                                            found the pool empty        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_pool_group_info_get        Actual packet pool group      */
+/*                                            information get function    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_pool_group_info_get(NX_PACKET_POOL_GROUP *group_ptr, UINT pool_index, NX_PACKET_POOL **pool_ptr,
+                                      ULONG *best_fit_allocations, ULONG *larger_allocations,
+                                      ULONG *chained_packets, ULONG *empty_requests)
+{
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((group_ptr == NX_NULL) || (group_ptr -> nx_packet_pool_group_id != NX_PACKET_POOL_GROUP_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid packet pool index.  */
+    if (pool_index >= group_ptr -> nx_packet_pool_group_pool_count)
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+
+    /* Check for appropriate caller.  */
+    NX_NOT_ISR_CALLER_CHECKING
+
+    /* Call actual packet pool group information get function.  */
+    status =  _nx_packet_pool_group_info_get(group_ptr, pool_index, pool_ptr, best_fit_allocations,
+                                             larger_allocations, chained_packets, empty_requests);
+
+    /* Return completion status.  */
+    return(status);
+}
+
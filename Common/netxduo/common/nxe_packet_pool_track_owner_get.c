@@ -0,0 +1,121 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Packet Pool Management (Packet) for STM32L4XX                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "nx_api.h"
+#include "nx_packet.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nxe_packet_pool_track_owner_get                    PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks for errors in the packet pool tracking         */
+/*    owner get function call.                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                              Pointer to packet pool        */
+/*    owner_index                           Index of the packet owner     */
+/*    owner_thread                          Owner thread, NX_NULL for ISR */
+/*    live_packets                          Packets held now              */
+/*    max_live_packets                      Most packets ever held        */
+/*    allocations                           Packets allocated             */
+/*    max_hold_ticks                        Longest hold of a released    */
+/*                                            packet                      */
+/*    oldest_hold_ticks                     Age of the oldest packet held */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_packet_pool_track_owner_get       Actual packet pool tracking   */
+/*                                            owner get function          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT  _nxe_packet_pool_track_owner_get(NX_PACKET_POOL *pool_ptr, UINT owner_index, TX_THREAD **owner_thread,
+                                       ULONG *live_packets, ULONG *max_live_packets, ULONG *allocations,
+                                       ULONG *max_hold_ticks, ULONG *oldest_hold_ticks)
+{
+#ifdef NX_ENABLE_PACKET_TRACKING
+
+UINT status;
+
+
+    /* Check for invalid input pointers.  */
+    if ((pool_ptr == NX_NULL) || (pool_ptr -> nx_packet_pool_id != NX_PACKET_POOL_ID))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Check for an invalid owner index.  */
+    if (owner_index >= NX_PACKET_TRACK_MAX_OWNERS)
+    {
+        return(NX_INVALID_PARAMETERS);
+    }
+
+    /* Call actual packet pool tracking owner get function.  */
+    status =  _nx_packet_pool_track_owner_get(pool_ptr, owner_index, owner_thread, live_packets, max_live_packets,
+                                              allocations, max_hold_ticks, oldest_hold_ticks);
+
+    /* Return completion status.  */
+    return(status);
+
+#else /* !NX_ENABLE_PACKET_TRACKING */
+    NX_PARAMETER_NOT_USED(pool_ptr);
+    NX_PARAMETER_NOT_USED(owner_index);
+    NX_PARAMETER_NOT_USED(owner_thread);
+    NX_PARAMETER_NOT_USED(live_packets);
+    NX_PARAMETER_NOT_USED(max_live_packets);
+    NX_PARAMETER_NOT_USED(allocations);
+    NX_PARAMETER_NOT_USED(max_hold_ticks);
+    NX_PARAMETER_NOT_USED(oldest_hold_ticks);
+
+    return(NX_NOT_SUPPORTED);
+
+#endif /* NX_ENABLE_PACKET_TRACKING */
+}
+
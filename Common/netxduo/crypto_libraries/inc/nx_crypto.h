@@ -212,6 +212,12 @@ extern unsigned int _nx_crypto_library_state;
 #define NX_CRYPTO_PARAMETER_NOT_USED(p) ((void)(p))
 #endif /* NX_CRYPTO_PARAMETER_NOT_USED */
 
+/* Define the number of cipher blocks the CBC, CTR and GCM modes pass to the block cipher
+   in one call.  Each batched block costs one block of stack in the mode function.  */
+#ifndef NX_CRYPTO_MODE_BATCH_BLOCKS
+#define NX_CRYPTO_MODE_BATCH_BLOCKS 4
+#endif /* NX_CRYPTO_MODE_BATCH_BLOCKS */
+
 /* Note that both input and output packets are prepared by the
    caller. For encryption/decryption operations, the callee shall
    use the output buffer for encrypted or decrypted data. For
@@ -82,6 +82,10 @@ extern   "C" {
 
 /* AES Support */
 
+/* Define NX_CRYPTO_AES_CONSTANT_TIME to build AES without lookup tables. The S-box is then
+   evaluated as a bitsliced circuit over two blocks at a time, so no memory access depends
+   on the key or the data. It is slower than the table implementation. */
+
 #define NX_CRYPTO_AES_STATE_ROWS                 (4)
 #define NX_CRYPTO_AES_STATE_NB_BYTES             (4)
 
@@ -66,10 +66,43 @@ extern   "C" {
 #define NX_CRYPTO_HMAC_MAX_PAD_SIZE  (128)
 #endif
 
+/* Define the largest hash state (chaining values and bit count) that can be cached.
+   The default covers SHA-384/SHA-512.  */
+#ifndef NX_CRYPTO_HMAC_MAX_STATE_SIZE
+#define NX_CRYPTO_HMAC_MAX_STATE_SIZE  (80)
+#endif
+
+/* Define the number of keys for which the hash states after absorbing K XOR ipad and
+   K XOR opad are kept. TLS uses the same metadata for the read and write MAC keys,
+   hence the default of two. Each entry takes 296 bytes with the default sizes, so the
+   cache adds about 600 bytes to the HMAC metadata, or 480 bytes net of the K XOR ipad
+   buffer it replaces. Define NX_CRYPTO_HMAC_DISABLE_STATE_CACHE to remove the cache
+   and hash the padded keys for every message.  */
+#ifndef NX_CRYPTO_HMAC_STATE_CACHE_ENTRIES
+#define NX_CRYPTO_HMAC_STATE_CACHE_ENTRIES  (2)
+#endif
+
+#ifndef NX_CRYPTO_HMAC_DISABLE_STATE_CACHE
+#if (NX_CRYPTO_HMAC_STATE_CACHE_ENTRIES < 1)
+#error "NX_CRYPTO_HMAC_STATE_CACHE_ENTRIES must be at least 1."
+#endif
+
+/* An entry is used only if its algorithm, key length and key bytes all match. The metadata
+   area may be shared with other methods, which write it from the start, so the key is kept
+   in front of the states: a state can't be overwritten without overwriting its key too.  */
+typedef struct NX_CRYPTO_HMAC_STATE_CACHE_STRUCT
+{
+    UINT   algorithm;
+    UINT   key_length;
+    UCHAR  key[NX_CRYPTO_HMAC_MAX_PAD_SIZE];
+    ULONG  inner_state[NX_CRYPTO_HMAC_MAX_STATE_SIZE / sizeof(ULONG)];
+    ULONG  outer_state[NX_CRYPTO_HMAC_MAX_STATE_SIZE / sizeof(ULONG)];
+} NX_CRYPTO_HMAC_STATE_CACHE;
+#endif /* NX_CRYPTO_HMAC_DISABLE_STATE_CACHE */
+
 typedef struct NX_CRYPTO_HMAC_STRUCT
 {
     VOID  *context;
-    UCHAR  k_ipad[NX_CRYPTO_HMAC_MAX_PAD_SIZE];
     UCHAR  k_opad[NX_CRYPTO_HMAC_MAX_PAD_SIZE];
     UINT   algorithm;
     UINT   block_size;
@@ -79,6 +112,12 @@ typedef struct NX_CRYPTO_HMAC_STRUCT
     UINT   (*crypto_digest_calculate)(VOID *, UCHAR *, UINT);
     NX_CRYPTO_METHOD *hash_method;
     VOID *hash_context;
+#ifndef NX_CRYPTO_HMAC_DISABLE_STATE_CACHE
+    UINT   state_size;
+    UINT   state_cache_current;
+    UINT   state_cache_next;
+    NX_CRYPTO_HMAC_STATE_CACHE state_cache[NX_CRYPTO_HMAC_STATE_CACHE_ENTRIES];
+#endif /* NX_CRYPTO_HMAC_DISABLE_STATE_CACHE */
 } NX_CRYPTO_HMAC;
 
 UINT _nx_crypto_hmac(NX_CRYPTO_HMAC *crypto_matadata,
@@ -99,6 +138,8 @@ VOID _nx_crypto_hmac_metadata_set(NX_CRYPTO_HMAC *hmac_metadata,
                                   UINT (*crypto_update)(VOID *, UCHAR *, UINT),
                                   UINT (*crypto_digest_calculate)(VOID *, UCHAR *, UINT));
 
+VOID _nx_crypto_hmac_state_size_set(NX_CRYPTO_HMAC *hmac_metadata, UINT state_size);
+
 UINT _nx_crypto_hmac_hash_initialize(VOID *context, UINT algorithm);
 UINT   _nx_crypto_hmac_hash_update(VOID *context, UCHAR *input, UINT input_length);
 UINT   _nx_crypto_hmac_hash_digest_calculate(VOID *context, UCHAR *digest, UINT algorithm);
@@ -108,6 +108,38 @@ extern   "C" {
 #error "NX_CRYPTO_HUGE_NUMBER_BITS supports 16 and 32 only!"
 #endif
 
+/* Define the operand size, in digits, from which multiplication of two huge numbers of
+   similar size switches from column-wise (Comba) to Karatsuba multiplication. The default
+   corresponds to 1024-bit operands, the size of the CRT halves of an RSA-2048 key.  */
+#ifndef NX_CRYPTO_HUGE_NUMBER_KARATSUBA_THRESHOLD
+#define NX_CRYPTO_HUGE_NUMBER_KARATSUBA_THRESHOLD (1024 / NX_CRYPTO_HUGE_NUMBER_BITS)
+#endif /* NX_CRYPTO_HUGE_NUMBER_KARATSUBA_THRESHOLD */
+
+#if (NX_CRYPTO_HUGE_NUMBER_KARATSUBA_THRESHOLD < 4)
+#error "NX_CRYPTO_HUGE_NUMBER_KARATSUBA_THRESHOLD must be at least 4!"
+#endif
+
+/* Define the maximum window size, in bits, of the sliding-window exponentiation in
+   _nx_crypto_huge_number_mont_power_modulus. Each additional bit doubles the table of
+   precomputed odd powers kept in the scratch buffer. 1 selects square-and-multiply.  */
+#ifndef NX_CRYPTO_HUGE_NUMBER_WINDOW_BITS
+#define NX_CRYPTO_HUGE_NUMBER_WINDOW_BITS         4
+#endif /* NX_CRYPTO_HUGE_NUMBER_WINDOW_BITS */
+
+#if (NX_CRYPTO_HUGE_NUMBER_WINDOW_BITS < 1) || (NX_CRYPTO_HUGE_NUMBER_WINDOW_BITS > 6)
+#error "NX_CRYPTO_HUGE_NUMBER_WINDOW_BITS supports 1 to 6 only!"
+#endif
+
+/* Additional scratch, in bytes, needed by _nx_crypto_huge_number_mont_power_modulus for the
+   table of precomputed odd powers, given the buffer size of the modulus in bytes.  */
+#define NX_CRYPTO_HUGE_NUMBER_WINDOW_SCRATCH_SIZE(size) \
+    (((1u << (NX_CRYPTO_HUGE_NUMBER_WINDOW_BITS - 1)) - 1) * ((size) + sizeof(HN_UBASE)))
+
+/* Scratch, in bytes, needed by _nx_crypto_huge_number_multiply_karatsuba, given the buffer
+   size of the larger operand in bytes.  */
+#define NX_CRYPTO_HUGE_NUMBER_KARATSUBA_SCRATCH_SIZE(size) \
+    ((5 * (size)) + (64 * sizeof(HN_UBASE)))
+
 
 /* Huge number structure - contains data pointer and size. */
 typedef struct NX_CRYPTO_HUGE_NUMBER_STRUCT
@@ -190,6 +222,10 @@ VOID _nx_crypto_huge_number_multiply(NX_CRYPTO_HUGE_NUMBER *left,
 VOID _nx_crypto_huge_number_multiply_digit(NX_CRYPTO_HUGE_NUMBER *value,
                                            HN_UBASE digit,
                                            NX_CRYPTO_HUGE_NUMBER *result);
+VOID _nx_crypto_huge_number_multiply_karatsuba(NX_CRYPTO_HUGE_NUMBER *left,
+                                               NX_CRYPTO_HUGE_NUMBER *right,
+                                               NX_CRYPTO_HUGE_NUMBER *result,
+                                               HN_UBASE *scratch);
 VOID _nx_crypto_huge_number_square(NX_CRYPTO_HUGE_NUMBER *value, NX_CRYPTO_HUGE_NUMBER *result);
 VOID _nx_crypto_huge_number_modulus(NX_CRYPTO_HUGE_NUMBER *dividend, NX_CRYPTO_HUGE_NUMBER *divisor);
 VOID _nx_crypto_huge_number_shift_left(NX_CRYPTO_HUGE_NUMBER *x, UINT shift);
@@ -206,6 +242,9 @@ VOID _nx_crypto_huge_number_mont(NX_CRYPTO_HUGE_NUMBER *m, UINT mi,
                                  NX_CRYPTO_HUGE_NUMBER *x,
                                  NX_CRYPTO_HUGE_NUMBER *y,
                                  NX_CRYPTO_HUGE_NUMBER *result);
+VOID _nx_crypto_huge_number_mont_square(NX_CRYPTO_HUGE_NUMBER *m, UINT mi,
+                                        NX_CRYPTO_HUGE_NUMBER *x,
+                                        NX_CRYPTO_HUGE_NUMBER *result);
 VOID _nx_crypto_huge_number_power_modulus(NX_CRYPTO_HUGE_NUMBER *number,
                                           NX_CRYPTO_HUGE_NUMBER *exponent,
                                           NX_CRYPTO_HUGE_NUMBER *modulus,
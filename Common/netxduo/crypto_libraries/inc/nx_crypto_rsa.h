@@ -60,7 +60,7 @@ extern   "C" {
 
 /* Include the ThreadX and port-specific data type file.  */
 
-#include "nx_crypto.h"
+#include "nx_crypto_huge_number.h"
 
 /* Define the maximum size of an RSA modulus supported in bits. */
 #ifndef NX_CRYPTO_MAX_RSA_MODULUS_SIZE
@@ -68,10 +68,22 @@ extern   "C" {
 #endif
 
 
+/* Extra scratch for RSA calculations on top of the buffers of the operands: the larger of the table of
+    odd powers used by sliding-window exponentiation and the Karatsuba scratch used to recombine the CRT
+    halves. */
+#define NX_CRYPTO_RSA_SCRATCH_EXTRA_SIZE(size)                                                                 \
+    ((NX_CRYPTO_HUGE_NUMBER_WINDOW_SCRATCH_SIZE(size) > NX_CRYPTO_HUGE_NUMBER_KARATSUBA_SCRATCH_SIZE((size) >> 1)) ? \
+     NX_CRYPTO_HUGE_NUMBER_WINDOW_SCRATCH_SIZE(size) : NX_CRYPTO_HUGE_NUMBER_KARATSUBA_SCRATCH_SIZE((size) >> 1))
+
 /* Scratch buffer for RSA calculations.
-    Size must be no less than 10 * sizeof(modulus) + 24. 2584 bytes for 2048 bits cryption.
-    If CRT algorithm is not used, size must be no less than (7 * sizeof(modulus) + 8). 1800 bytes for 2048 bits cryption. */
-#define NX_CRYPTO_RSA_SCRATCH_BUFFER_SIZE (((10 * (NX_CRYPTO_MAX_RSA_MODULUS_SIZE / 8)) + 24) / sizeof(USHORT))
+    Size must be no less than 10 * sizeof(modulus) + 24 + NX_CRYPTO_RSA_SCRATCH_EXTRA_SIZE(sizeof(modulus)).
+    4404 bytes for 2048 bits cryption with the default window of 4 bits, up from 2584 bytes before
+    the window table and Karatsuba scratch were added. Define NX_CRYPTO_HUGE_NUMBER_WINDOW_BITS as 1
+    to drop the window table where RAM is tight; the Karatsuba scratch still brings 2048 bits to 3480 bytes.
+    If CRT algorithm is not used, size must be no less than (7 * sizeof(modulus) + 8) plus
+    NX_CRYPTO_HUGE_NUMBER_WINDOW_SCRATCH_SIZE(sizeof(modulus)). 3620 bytes for 2048 bits cryption. */
+#define NX_CRYPTO_RSA_SCRATCH_BUFFER_SIZE (((10 * (NX_CRYPTO_MAX_RSA_MODULUS_SIZE / 8)) + 24 + \
+                                            NX_CRYPTO_RSA_SCRATCH_EXTRA_SIZE(NX_CRYPTO_MAX_RSA_MODULUS_SIZE / 8)) / sizeof(USHORT))
 
 /* Control block for RSA cryptographic operations. */
 typedef struct NX_CRYPTO_RSA_STRUCT
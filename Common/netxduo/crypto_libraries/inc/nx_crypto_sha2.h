@@ -86,7 +86,6 @@ typedef struct NX_CRYPTO_SHA256_STRUCT
                                                         /*   where partial buffers are              */
                                                         /*   accumulated until a full block         */
                                                         /*   can be processed.                      */
-    ULONG nx_sha256_word_array[64];                     /* Working 64 word array.                   */
 } NX_CRYPTO_SHA256;
 
 
@@ -94,6 +93,7 @@ UINT _nx_crypto_sha256_initialize(NX_CRYPTO_SHA256 *context, UINT algorithm);
 UINT _nx_crypto_sha256_update(NX_CRYPTO_SHA256 *context, UCHAR *input_ptr, UINT input_length);
 UINT _nx_crypto_sha256_digest_calculate(NX_CRYPTO_SHA256 *context, UCHAR *digest, UINT algorithm);
 VOID _nx_crypto_sha256_process_buffer(NX_CRYPTO_SHA256 * context, UCHAR buffer[64]);
+VOID _nx_crypto_sha256_process_blocks(NX_CRYPTO_SHA256 *context, UCHAR *buffer, UINT blocks);
 
 UINT _nx_crypto_method_sha256_init(struct  NX_CRYPTO_METHOD_STRUCT *method,
                                    UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
@@ -80,6 +80,12 @@ typedef short                                     SHORT;
 typedef unsigned short                            USHORT;
 #endif
 
+/* Define the type that holds an address, for alignment checks.  */
+#ifndef ALIGN_TYPE_DEFINED
+#define ALIGN_TYPE_DEFINED
+#define ALIGN_TYPE                                ULONG
+#endif
+
 #endif /* NX_CRYPTO_STANDALONE_ENABLE */
 
 #endif /* _NX_CRYPTO_PORT_H_ */
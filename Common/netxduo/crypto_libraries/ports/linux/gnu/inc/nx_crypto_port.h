@@ -0,0 +1,88 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Crypto Component                                                 */
+/**                                                                       */
+/**   Crypto                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    nx_crypto_port.h                                    Linux/GNU       */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file contains data type definitions for the NetX Security      */
+/*    Encryption component on a Linux host. The types match the ThreadX   */
+/*    Linux port, so ULONG is 32 bits on 64-bit hosts as well.            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef _NX_CRYPTO_PORT_H_
+#define _NX_CRYPTO_PORT_H_
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef NX_CRYPTO_STANDALONE_ENABLE
+
+
+/* Linux hosts supported by the port are little endian.  */
+#define NX_CRYPTO_LITTLE_ENDIAN 1
+
+/* Define macros that swap the endian for little endian ports.  */
+#if NX_CRYPTO_LITTLE_ENDIAN
+#define NX_CRYPTO_CHANGE_ULONG_ENDIAN(arg)       (arg) = __builtin_bswap32(arg)
+#define NX_CRYPTO_CHANGE_USHORT_ENDIAN(arg)      (arg) = __builtin_bswap16(arg)
+#else
+#define NX_CRYPTO_CHANGE_ULONG_ENDIAN(a)
+#define NX_CRYPTO_CHANGE_USHORT_ENDIAN(a)
+#endif
+
+#ifndef VOID
+#define VOID                                      void
+typedef char                                      CHAR;
+typedef unsigned char                             UCHAR;
+typedef int                                       INT;
+typedef unsigned int                              UINT;
+typedef int                                       LONG;
+typedef unsigned int                              ULONG;
+typedef short                                     SHORT;
+typedef unsigned short                            USHORT;
+#endif
+
+/* Define the type that holds an address, for alignment checks.  */
+#ifndef ALIGN_TYPE_DEFINED
+#define ALIGN_TYPE_DEFINED
+#define ALIGN_TYPE                                unsigned long
+#endif
+
+#endif /* NX_CRYPTO_STANDALONE_ENABLE */
+
+#endif /* _NX_CRYPTO_PORT_H_ */
@@ -26,6 +26,7 @@
 #include "nx_crypto_aes.h"
 #include "nx_crypto_xcbc_mac.h"
 
+#ifndef NX_CRYPTO_AES_CONSTANT_TIME
 #if !defined(NX_CRYPTO_LITTLE_ENDIAN)
 /*
     Encryption table for BIG ENDIAN architecture.
@@ -352,6 +353,7 @@ static const UCHAR inverse_sub_bytes_sbox[] =
     0xa0, 0xe0, 0x3b, 0x4d, 0xae, 0x2a, 0xf5, 0xb0, 0xc8, 0xeb, 0xbb, 0x3c, 0x83, 0x53, 0x99, 0x61,
     0x17, 0x2b, 0x04, 0x7e, 0xba, 0x77, 0xd6, 0x26, 0xe1, 0x69, 0x14, 0x63, 0x55, 0x21, 0x0c, 0x7d
 };
+#endif /* NX_CRYPTO_AES_CONSTANT_TIME */
 
 
 /* Rcon array, used for key expansion.  Refer to Appendix A on page 27,  AES specification(Pub 197) */
@@ -400,6 +402,8 @@ static const UCHAR aes_rcon_array[] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40,
 extern UINT _nx_crypto_library_state;
 #endif /* NX_CRYPTO_FIPS */
 
+#ifndef NX_CRYPTO_AES_CONSTANT_TIME
+
 /**************************************************************************/
 /* Utility routines                                                       */
 /**************************************************************************/
@@ -988,6 +992,733 @@ ULONG  val;
 }
 
 
+#else /* NX_CRYPTO_AES_CONSTANT_TIME */
+
+/**************************************************************************/
+/* Constant time routines                                                 */
+/**************************************************************************/
+
+/* Multiply each of the four bytes packed in a word by {02}. */
+#define NX_CRYPTO_AES_XTIME(val)  ((((val) & 0x7F7F7F7FU) << 1) ^ ((((val) >> 7) & 0x01010101U) * 0x1BU))
+
+/* Masks selecting one row of a state column. */
+#define NX_CRYPTO_AES_ROW0        (SET_MSB_BYTE(0xFFU))
+#define NX_CRYPTO_AES_ROW1        (SET_2ND_BYTE(0xFFU))
+#define NX_CRYPTO_AES_ROW2        (SET_3RD_BYTE(0xFFU))
+#define NX_CRYPTO_AES_ROW3        (SET_LSB_BYTE(0xFFU))
+
+/* Exchange bit groups between two words, part of the 8x8 bit matrix transpose. */
+#define NX_CRYPTO_AES_SWAP_BITS(low_mask, shift, x, y)            \
+    {                                                             \
+        a = (x);                                                  \
+        b = (y);                                                  \
+        (x) = (a & (low_mask)) | ((b & (low_mask)) << (shift));   \
+        (y) = ((a >> (shift)) & (low_mask)) | (b & ~(low_mask));  \
+    }
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_ortho                             PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function transposes the bits of the 32 bytes held in eight     */
+/*    words, so that afterwards word i holds bit i of every byte.  The    */
+/*    transform is its own inverse and is used to enter and leave the     */
+/*    bitsliced representation.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Pointer to eight words        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_sub_bytes           Perform SubBytes operation    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_ct_ortho(UINT *q)
+{
+UINT a, b;
+
+    NX_CRYPTO_AES_SWAP_BITS(0x55555555U, 1, q[0], q[1]);
+    NX_CRYPTO_AES_SWAP_BITS(0x55555555U, 1, q[2], q[3]);
+    NX_CRYPTO_AES_SWAP_BITS(0x55555555U, 1, q[4], q[5]);
+    NX_CRYPTO_AES_SWAP_BITS(0x55555555U, 1, q[6], q[7]);
+
+    NX_CRYPTO_AES_SWAP_BITS(0x33333333U, 2, q[0], q[2]);
+    NX_CRYPTO_AES_SWAP_BITS(0x33333333U, 2, q[1], q[3]);
+    NX_CRYPTO_AES_SWAP_BITS(0x33333333U, 2, q[4], q[6]);
+    NX_CRYPTO_AES_SWAP_BITS(0x33333333U, 2, q[5], q[7]);
+
+    NX_CRYPTO_AES_SWAP_BITS(0x0F0F0F0FU, 4, q[0], q[4]);
+    NX_CRYPTO_AES_SWAP_BITS(0x0F0F0F0FU, 4, q[1], q[5]);
+    NX_CRYPTO_AES_SWAP_BITS(0x0F0F0F0FU, 4, q[2], q[6]);
+    NX_CRYPTO_AES_SWAP_BITS(0x0F0F0F0FU, 4, q[3], q[7]);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_sbox                              PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function applies the AES S-box to 32 bytes in bitsliced form,  */
+/*    using the Boyar-Peralta circuit of XOR, AND and NOT gates.  No      */
+/*    memory access or branch depends on the data.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Pointer to eight bit planes   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_sub_bytes           Perform SubBytes operation    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_ct_sbox(UINT *q)
+{
+UINT x0, x1, x2, x3, x4, x5, x6, x7;
+UINT y1, y2, y3, y4, y5, y6, y7, y8, y9;
+UINT y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+UINT y20, y21;
+UINT z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+UINT z10, z11, z12, z13, z14, z15, z16, z17;
+UINT t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+UINT t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+UINT t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+UINT t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+UINT t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+UINT t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+UINT t60, t61, t62, t63, t64, t65, t66, t67;
+UINT s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* Top linear transformation. */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* Non-linear section. */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* Bottom linear transformation. */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_inverse_affine                    PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function applies the inverse of the S-box affine transform to  */
+/*    32 bytes in bitsliced form.  The inverse S-box is computed as the   */
+/*    forward S-box wrapped in this transform on both sides.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Pointer to eight bit planes   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_sub_bytes           Perform SubBytes operation    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_ct_inverse_affine(UINT *q)
+{
+UINT q0, q1, q2, q3, q4, q5, q6, q7;
+
+    q0 = ~q[0];
+    q1 = ~q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = ~q[5];
+    q6 = ~q[6];
+    q7 = q[7];
+
+    q[7] = q1 ^ q4 ^ q6;
+    q[6] = q0 ^ q3 ^ q5;
+    q[5] = q7 ^ q2 ^ q4;
+    q[4] = q6 ^ q1 ^ q3;
+    q[3] = q5 ^ q0 ^ q2;
+    q[2] = q4 ^ q7 ^ q1;
+    q[1] = q3 ^ q6 ^ q0;
+    q[0] = q2 ^ q5 ^ q7;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_sub_bytes                         PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function implements SubBytes() or InvSubBytes() on the eight   */
+/*    state columns of two blocks without table lookups.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    q                                     Pointer to eight columns      */
+/*    inverse                               Apply the inverse S-box       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_ortho               Transpose to bit planes       */
+/*    _nx_crypto_aes_ct_inverse_affine      Inverse affine transform      */
+/*    _nx_crypto_aes_ct_sbox                Bitsliced S-box               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_encrypt_blocks      Encrypt two blocks            */
+/*    _nx_crypto_aes_ct_decrypt_blocks      Decrypt two blocks            */
+/*    _nx_crypto_aes_subword                Perform SubWord operation     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_ct_sub_bytes(UINT *q, UINT inverse)
+{
+
+    _nx_crypto_aes_ct_ortho(q);
+
+    if (inverse)
+    {
+        _nx_crypto_aes_ct_inverse_affine(q);
+        _nx_crypto_aes_ct_sbox(q);
+        _nx_crypto_aes_ct_inverse_affine(q);
+    }
+    else
+    {
+        _nx_crypto_aes_ct_sbox(q);
+    }
+
+    _nx_crypto_aes_ct_ortho(q);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_shift_rows                        PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function implements ShiftRows() or InvShiftRows() on the four  */
+/*    columns of one block.                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    s                                     Pointer to four columns       */
+/*    inverse                               Shift the rows right          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_encrypt_blocks      Encrypt two blocks            */
+/*    _nx_crypto_aes_ct_decrypt_blocks      Decrypt two blocks            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_ct_shift_rows(UINT *s, UINT inverse)
+{
+UINT s0, s1, s2, s3;
+
+    s0 = s[0];
+    s1 = s[1];
+    s2 = s[2];
+    s3 = s[3];
+
+    if (inverse)
+    {
+
+        /* Row r of column c comes from column c - r. */
+        s[0] = (s0 & NX_CRYPTO_AES_ROW0) | (s3 & NX_CRYPTO_AES_ROW1) | (s2 & NX_CRYPTO_AES_ROW2) | (s1 & NX_CRYPTO_AES_ROW3);
+        s[1] = (s1 & NX_CRYPTO_AES_ROW0) | (s0 & NX_CRYPTO_AES_ROW1) | (s3 & NX_CRYPTO_AES_ROW2) | (s2 & NX_CRYPTO_AES_ROW3);
+        s[2] = (s2 & NX_CRYPTO_AES_ROW0) | (s1 & NX_CRYPTO_AES_ROW1) | (s0 & NX_CRYPTO_AES_ROW2) | (s3 & NX_CRYPTO_AES_ROW3);
+        s[3] = (s3 & NX_CRYPTO_AES_ROW0) | (s2 & NX_CRYPTO_AES_ROW1) | (s1 & NX_CRYPTO_AES_ROW2) | (s0 & NX_CRYPTO_AES_ROW3);
+    }
+    else
+    {
+
+        /* Row r of column c comes from column c + r. */
+        s[0] = (s0 & NX_CRYPTO_AES_ROW0) | (s1 & NX_CRYPTO_AES_ROW1) | (s2 & NX_CRYPTO_AES_ROW2) | (s3 & NX_CRYPTO_AES_ROW3);
+        s[1] = (s1 & NX_CRYPTO_AES_ROW0) | (s2 & NX_CRYPTO_AES_ROW1) | (s3 & NX_CRYPTO_AES_ROW2) | (s0 & NX_CRYPTO_AES_ROW3);
+        s[2] = (s2 & NX_CRYPTO_AES_ROW0) | (s3 & NX_CRYPTO_AES_ROW1) | (s0 & NX_CRYPTO_AES_ROW2) | (s1 & NX_CRYPTO_AES_ROW3);
+        s[3] = (s3 & NX_CRYPTO_AES_ROW0) | (s0 & NX_CRYPTO_AES_ROW1) | (s1 & NX_CRYPTO_AES_ROW2) | (s2 & NX_CRYPTO_AES_ROW3);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_mix_column                        PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function implements MixColumns() on one column, computing      */
+/*    {02}*S0 ^ {03}*S1 ^ S2 ^ S3 for every row with word operations.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    column                                State column                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    column                                Mixed column                  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_encrypt_blocks      Encrypt two blocks            */
+/*    _nx_crypto_aes_ct_inv_mix_column      Perform InvMixColumns         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static UINT _nx_crypto_aes_ct_mix_column(UINT column)
+{
+UINT rotated;
+
+    /* Row r of the rotated column holds row r + 1 of the column. */
+    rotated = LEFT_ROTATE8(column);
+
+    return(NX_CRYPTO_AES_XTIME(column ^ rotated) ^ rotated ^ LEFT_ROTATE16(column) ^ LEFT_ROTATE24(column));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_inv_mix_column                    PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function implements InvMixColumns() on one column.  The        */
+/*    inverse matrix is factored as MixColumns() applied after            */
+/*    multiplying by {04}x^2 + {05}, which needs only two doublings.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    column                                State column                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    column                                Mixed column                  */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_mix_column          Perform MixColumns            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_decrypt_blocks      Decrypt two blocks            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static UINT _nx_crypto_aes_ct_inv_mix_column(UINT column)
+{
+UINT folded;
+
+    folded = column ^ LEFT_ROTATE16(column);
+    folded = NX_CRYPTO_AES_XTIME(folded);
+    folded = NX_CRYPTO_AES_XTIME(folded);
+
+    return(_nx_crypto_aes_ct_mix_column(column ^ folded));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_encrypt_blocks                    PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encrypts two blocks held as eight state columns.  The */
+/*    S-box of both blocks is evaluated in one bitsliced pass.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    aes_ptr                               Pointer to AES control block  */
+/*    q                                     Pointer to eight columns      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_sub_bytes           Perform SubBytes operation    */
+/*    _nx_crypto_aes_ct_shift_rows          Perform ShiftRows operation   */
+/*    _nx_crypto_aes_ct_mix_column          Perform MixColumns operation  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_encrypt                Perform AES mode encryption   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_ct_encrypt_blocks(NX_CRYPTO_AES *aes_ptr, UINT *q)
+{
+UINT *w = aes_ptr -> nx_crypto_aes_key_schedule;
+UINT  num_rounds = aes_ptr -> nx_crypto_aes_rounds;
+UINT  round;
+UINT  i;
+
+    for (i = 0; i < 8; i++)
+    {
+        q[i] ^= w[i & 3];
+    }
+
+    for (round = 1; round < num_rounds; round++)
+    {
+        _nx_crypto_aes_ct_sub_bytes(q, 0);
+        _nx_crypto_aes_ct_shift_rows(&q[0], 0);
+        _nx_crypto_aes_ct_shift_rows(&q[4], 0);
+
+        for (i = 0; i < 8; i++)
+        {
+            q[i] = _nx_crypto_aes_ct_mix_column(q[i]) ^ w[round * 4 + (i & 3)];
+        }
+    }
+
+    _nx_crypto_aes_ct_sub_bytes(q, 0);
+    _nx_crypto_aes_ct_shift_rows(&q[0], 0);
+    _nx_crypto_aes_ct_shift_rows(&q[4], 0);
+
+    for (i = 0; i < 8; i++)
+    {
+        q[i] ^= w[num_rounds * 4 + (i & 3)];
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_decrypt_blocks                    PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function decrypts two blocks held as eight state columns,      */
+/*    following the inverse cipher of section 5.3 of the AES              */
+/*    specification(Pub 197) with the encryption key schedule.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    aes_ptr                               Pointer to AES control block  */
+/*    q                                     Pointer to eight columns      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_aes_ct_sub_bytes           Perform InvSubBytes operation */
+/*    _nx_crypto_aes_ct_shift_rows          Perform InvShiftRows operation*/
+/*    _nx_crypto_aes_ct_inv_mix_column      Perform InvMixColumns         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_aes_decrypt                Perform AES mode decryption   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_aes_ct_decrypt_blocks(NX_CRYPTO_AES *aes_ptr, UINT *q)
+{
+UINT *w = aes_ptr -> nx_crypto_aes_key_schedule;
+UINT  num_rounds = aes_ptr -> nx_crypto_aes_rounds;
+UINT  round;
+UINT  i;
+
+    for (i = 0; i < 8; i++)
+    {
+        q[i] ^= w[num_rounds * 4 + (i & 3)];
+    }
+
+    for (round = num_rounds - 1; round >= 1; round--)
+    {
+        _nx_crypto_aes_ct_shift_rows(&q[0], 1);
+        _nx_crypto_aes_ct_shift_rows(&q[4], 1);
+        _nx_crypto_aes_ct_sub_bytes(q, 1);
+
+        for (i = 0; i < 8; i++)
+        {
+            q[i] = _nx_crypto_aes_ct_inv_mix_column(q[i] ^ w[round * 4 + (i & 3)]);
+        }
+    }
+
+    _nx_crypto_aes_ct_shift_rows(&q[0], 1);
+    _nx_crypto_aes_ct_shift_rows(&q[4], 1);
+    _nx_crypto_aes_ct_sub_bytes(q, 1);
+
+    for (i = 0; i < 8; i++)
+    {
+        q[i] ^= w[i & 3];
+    }
+}
+#endif /* NX_CRYPTO_AES_CONSTANT_TIME */
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -1000,23 +1731,30 @@ ULONG  val;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function performs AES encryption on a block of 16 byte message */
-/*    pointed to by "input", and the encrypted text is stored in buffer   */
-/*    pointed to by "output".  The size of the output buffer must be at   */
-/*    least 16 bytes.  The output buffer may point to the same input      */
-/*    buffer, in which case the encrypted text overwrites the input       */
+/*    This function performs AES encryption on one or more consecutive    */
+/*    16 byte blocks pointed to by "input", and the encrypted text is     */
+/*    stored in buffer pointed to by "output".  The number of blocks is   */
+/*    length / 16; a length shorter than 16 bytes encrypts one block.     */
+/*    Processing several blocks per call lets the block modes amortize    */
+/*    the per-call overhead.  The output buffer may point to the same     */
+/*    input buffer, in which case the encrypted text overwrites the input */
 /*    message.                                                            */
 /*                                                                        */
+/*    When NX_CRYPTO_AES_CONSTANT_TIME is defined, blocks are encrypted   */
+/*    in pairs with a bitsliced S-box and no lookup tables.               */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    aes_ptr                               Pointer to AES control block  */
 /*    input                                 Pointer to an input message   */
-/*                                            of 16 bytes.                */
+/*                                            of length bytes.            */
 /*    output                                Pointer to an output buffer   */
 /*                                            for storing the encrypted   */
 /*                                            message.  The output buffer */
-/*                                            must be at least 16 bytes.  */
-/*    length                                The length of output buffer   */
+/*                                            must be at least length     */
+/*                                            bytes.                      */
+/*    length                                Length of the input message,  */
+/*                                            a multiple of 16            */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -1029,6 +1767,8 @@ ULONG  val;
 /*                                            encryption                  */
 /*    _nx_crypto_aes_sub_shift_roundkey     Perform the last step in AES  */
 /*                                            encryption operation        */
+/*    _nx_crypto_aes_ct_encrypt_blocks      Encrypt two blocks in         */
+/*                                            constant time               */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1047,17 +1787,18 @@ ULONG  val;
 NX_CRYPTO_KEEP UINT _nx_crypto_aes_encrypt(NX_CRYPTO_AES *aes_ptr, UCHAR *input, UCHAR *output, UINT length)
 {
 UINT  num_rounds;
+UINT  blocks;
+#ifdef NX_CRYPTO_AES_CONSTANT_TIME
+UINT  q[8];
+UINT  bytes;
+#else
 UINT *w;
 #ifndef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
 UCHAR *aes_state;
 #else
 UINT *buf;
 #endif
-
-
-    NX_CRYPTO_PARAMETER_NOT_USED(length);
-
-    w = aes_ptr -> nx_crypto_aes_key_schedule;
+#endif /* NX_CRYPTO_AES_CONSTANT_TIME */
 
     num_rounds = aes_ptr -> nx_crypto_aes_rounds;
 
@@ -1066,64 +1807,102 @@ UINT *buf;
         return(NX_CRYPTO_INVALID_PARAMETER);
     }
 
+    /* A length shorter than one block still encrypts a single block. */
+    blocks = length / NX_CRYPTO_AES_BLOCK_SIZE;
+    if (blocks == 0)
+    {
+        blocks = 1;
+    }
+
+#ifdef NX_CRYPTO_AES_CONSTANT_TIME
+    while (blocks > 0)
+    {
+
+        /* Encrypt two blocks per pass; a single trailing block is paired with zeros. */
+        bytes = (blocks > 1) ? (2 * NX_CRYPTO_AES_BLOCK_SIZE) : NX_CRYPTO_AES_BLOCK_SIZE;
+        NX_CRYPTO_MEMSET(q, 0, sizeof(q));
+        NX_CRYPTO_MEMCPY(q, input, bytes); /* Use case of memcpy is verified. */
+
+        _nx_crypto_aes_ct_encrypt_blocks(aes_ptr, q);
+
+        NX_CRYPTO_MEMCPY(output, q, bytes); /* Use case of memcpy is verified. */
+
+        input += bytes;
+        output += bytes;
+        blocks -= bytes / NX_CRYPTO_AES_BLOCK_SIZE;
+    }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(q, 0, sizeof(q));
+#endif /* NX_SECURE_KEY_CLEAR  */
+#else
+    w = aes_ptr -> nx_crypto_aes_key_schedule;
+
+    for (; blocks > 0; blocks--)
+    {
 #ifndef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
-    aes_state = (UCHAR *)aes_ptr -> nx_crypto_aes_state;
-    aes_state[0] = input[0];
-    aes_state[1] = input[1];
-    aes_state[2] = input[2];
-    aes_state[3] = input[3];
-    aes_state[4] = input[4];
-    aes_state[5] = input[5];
-    aes_state[6] = input[6];
-    aes_state[7] = input[7];
-    aes_state[8] = input[8];
-    aes_state[9] = input[9];
-    aes_state[10] = input[10];
-    aes_state[11] = input[11];
-    aes_state[12] = input[12];
-    aes_state[13] = input[13];
-    aes_state[14] = input[14];
-    aes_state[15] = input[15];
+        aes_state = (UCHAR *)aes_ptr -> nx_crypto_aes_state;
+        aes_state[0] = input[0];
+        aes_state[1] = input[1];
+        aes_state[2] = input[2];
+        aes_state[3] = input[3];
+        aes_state[4] = input[4];
+        aes_state[5] = input[5];
+        aes_state[6] = input[6];
+        aes_state[7] = input[7];
+        aes_state[8] = input[8];
+        aes_state[9] = input[9];
+        aes_state[10] = input[10];
+        aes_state[11] = input[11];
+        aes_state[12] = input[12];
+        aes_state[13] = input[13];
+        aes_state[14] = input[14];
+        aes_state[15] = input[15];
 #else
-    buf = (UINT *)input;
-    aes_ptr -> nx_crypto_aes_state[0] = buf[0];
-    aes_ptr -> nx_crypto_aes_state[1] = buf[1];
-    aes_ptr -> nx_crypto_aes_state[2] = buf[2];
-    aes_ptr -> nx_crypto_aes_state[3] = buf[3];
+        buf = (UINT *)input;
+        aes_ptr -> nx_crypto_aes_state[0] = buf[0];
+        aes_ptr -> nx_crypto_aes_state[1] = buf[1];
+        aes_ptr -> nx_crypto_aes_state[2] = buf[2];
+        aes_ptr -> nx_crypto_aes_state[3] = buf[3];
 #endif
 
-    _nx_crypto_aes_add_round_key(aes_ptr, &w[0]);
+        _nx_crypto_aes_add_round_key(aes_ptr, &w[0]);
 
-    _nx_crypto_aes_encryption_round(aes_ptr, (INT)num_rounds);
+        _nx_crypto_aes_encryption_round(aes_ptr, (INT)num_rounds);
 
-    _nx_crypto_aes_sub_shift_roundkey(aes_ptr, &w[num_rounds * 4]);
+        _nx_crypto_aes_sub_shift_roundkey(aes_ptr, &w[num_rounds * 4]);
 
 
 #ifndef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
-    output[0] = aes_state[0];
-    output[1] = aes_state[1];
-    output[2] = aes_state[2];
-    output[3] = aes_state[3];
-    output[4] = aes_state[4];
-    output[5] = aes_state[5];
-    output[6] = aes_state[6];
-    output[7] = aes_state[7];
-    output[8] = aes_state[8];
-    output[9] = aes_state[9];
-    output[10] = aes_state[10];
-    output[11] = aes_state[11];
-    output[12] = aes_state[12];
-    output[13] = aes_state[13];
-    output[14] = aes_state[14];
-    output[15] = aes_state[15];
+        output[0] = aes_state[0];
+        output[1] = aes_state[1];
+        output[2] = aes_state[2];
+        output[3] = aes_state[3];
+        output[4] = aes_state[4];
+        output[5] = aes_state[5];
+        output[6] = aes_state[6];
+        output[7] = aes_state[7];
+        output[8] = aes_state[8];
+        output[9] = aes_state[9];
+        output[10] = aes_state[10];
+        output[11] = aes_state[11];
+        output[12] = aes_state[12];
+        output[13] = aes_state[13];
+        output[14] = aes_state[14];
+        output[15] = aes_state[15];
 #else
-    buf = (UINT *)output;
-    buf[0] = aes_ptr -> nx_crypto_aes_state[0];
-    buf[1] = aes_ptr -> nx_crypto_aes_state[1];
-    buf[2] = aes_ptr -> nx_crypto_aes_state[2];
-    buf[3] = aes_ptr -> nx_crypto_aes_state[3];
+        buf = (UINT *)output;
+        buf[0] = aes_ptr -> nx_crypto_aes_state[0];
+        buf[1] = aes_ptr -> nx_crypto_aes_state[1];
+        buf[2] = aes_ptr -> nx_crypto_aes_state[2];
+        buf[3] = aes_ptr -> nx_crypto_aes_state[3];
 #endif
 
+        input += NX_CRYPTO_AES_BLOCK_SIZE;
+        output += NX_CRYPTO_AES_BLOCK_SIZE;
+    }
+#endif /* NX_CRYPTO_AES_CONSTANT_TIME */
+
     return(NX_CRYPTO_SUCCESS);
 }
 
@@ -1157,7 +1936,7 @@ UINT *buf;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _nx_crypto_aes_ct_sub_bytes           Perform SubBytes operation    */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1175,11 +1954,25 @@ UINT *buf;
 NX_CRYPTO_KEEP static UINT _nx_crypto_aes_subword(UINT word)
 {
 UINT result;
+#ifdef NX_CRYPTO_AES_CONSTANT_TIME
+UINT q[8];
+
+    /* The key is secret too, so substitute without table lookups. */
+    NX_CRYPTO_MEMSET(q, 0, sizeof(q));
+    q[0] = word;
+    _nx_crypto_aes_ct_sub_bytes(q, 0);
+    result = q[0];
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(q, 0, sizeof(q));
+#endif /* NX_SECURE_KEY_CLEAR  */
+#else
 
     result = sub_bytes_sbox[word & 0xFF];
     result |= (UINT)((sub_bytes_sbox[(word & 0x0000FF00) >>  8]) <<  8);
     result |= (UINT)((sub_bytes_sbox[(word & 0x00FF0000) >> 16]) << 16);
     result |= (UINT)((sub_bytes_sbox[(word & 0xFF000000) >> 24]) << 24);
+#endif /* NX_CRYPTO_AES_CONSTANT_TIME */
     return result;
 }
 
@@ -1303,6 +2096,7 @@ UINT  key_size;
     return;
 }
 
+#ifndef NX_CRYPTO_AES_CONSTANT_TIME
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -1410,6 +2204,7 @@ ULONG key;
 
     return;
 }
+#endif /* NX_CRYPTO_AES_CONSTANT_TIME */
 
 
 /**************************************************************************/
@@ -1450,23 +2245,28 @@ ULONG key;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function performs AES decryption on a block of 16 byte message */
-/*    pointed to by "input", and the decrypted text is stored in buffer   */
-/*    pointed to by "output".  The size of the output buffer must be at   */
-/*    least 16 bytes.  The output buffer may point to the same input      */
-/*    buffer, in which case the decrypted text overwrites the input       */
-/*    message.                                                            */
+/*    This function performs AES decryption on one or more consecutive    */
+/*    16 byte blocks pointed to by "input", and the decrypted text is     */
+/*    stored in buffer pointed to by "output".  The number of blocks is   */
+/*    length / 16; a length shorter than 16 bytes decrypts one block.     */
+/*    The output buffer may point to the same input buffer, in which case */
+/*    the decrypted text overwrites the input message.                    */
+/*                                                                        */
+/*    When NX_CRYPTO_AES_CONSTANT_TIME is defined, blocks are decrypted   */
+/*    in pairs with a bitsliced S-box and no lookup tables.               */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    aes_ptr                               Pointer to AES control block  */
 /*    input                                 Pointer to an input message   */
-/*                                            of 16 bytes.                */
+/*                                            of length bytes.            */
 /*    output                                Pointer to an output buffer   */
 /*                                            for storing the decrypted   */
 /*                                            message.  The output buffer */
-/*                                            must be at least 16 bytes.  */
-/*    length                                The length of output buffer   */
+/*                                            must be at least length     */
+/*                                            bytes.                      */
+/*    length                                Length of the input message,  */
+/*                                            a multiple of 16            */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -1479,6 +2279,8 @@ ULONG key;
 /*                                            decryption                  */
 /*    _nx_crypto_aes_inv_sub_shift_roundkey Perform the last step in AES  */
 /*                                            decryption operation        */
+/*    _nx_crypto_aes_ct_decrypt_blocks      Decrypt two blocks in         */
+/*                                            constant time               */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -1496,6 +2298,11 @@ ULONG key;
 NX_CRYPTO_KEEP UINT _nx_crypto_aes_decrypt(NX_CRYPTO_AES *aes_ptr, UCHAR *input, UCHAR *output, UINT length)
 {
 UINT  num_rounds;
+UINT  blocks;
+#ifdef NX_CRYPTO_AES_CONSTANT_TIME
+UINT  q[8];
+UINT  bytes;
+#else
 UINT  round;
 UINT *w;
 UINT *v;
@@ -1504,39 +2311,7 @@ UCHAR *aes_state;
 #else
 UINT *buf;
 #endif
-
-
-    NX_CRYPTO_PARAMETER_NOT_USED(length);
-
-    w = aes_ptr -> nx_crypto_aes_decrypt_key_schedule;
-    v = aes_ptr -> nx_crypto_aes_key_schedule;
-
-#ifndef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
-    aes_state = (UCHAR *)aes_ptr -> nx_crypto_aes_state;
-    aes_state[0] = input[0];
-    aes_state[1] = input[1];
-    aes_state[2] = input[2];
-    aes_state[3] = input[3];
-    aes_state[4] = input[4];
-    aes_state[5] = input[5];
-    aes_state[6] = input[6];
-    aes_state[7] = input[7];
-    aes_state[8] = input[8];
-    aes_state[9] = input[9];
-    aes_state[10] = input[10];
-    aes_state[11] = input[11];
-    aes_state[12] = input[12];
-    aes_state[13] = input[13];
-    aes_state[14] = input[14];
-    aes_state[15] = input[15];
-#else
-    buf = (UINT *)input;
-    aes_ptr -> nx_crypto_aes_state[0] = buf[0];
-    aes_ptr -> nx_crypto_aes_state[1] = buf[1];
-    aes_ptr -> nx_crypto_aes_state[2] = buf[2];
-    aes_ptr -> nx_crypto_aes_state[3] = buf[3];
-#endif
-
+#endif /* NX_CRYPTO_AES_CONSTANT_TIME */
 
     num_rounds = aes_ptr -> nx_crypto_aes_rounds;
 
@@ -1545,42 +2320,107 @@ UINT *buf;
         return(NX_CRYPTO_INVALID_PARAMETER);
     }
 
-    _nx_crypto_aes_add_round_key(aes_ptr, &v[num_rounds * 4]);
+    /* A length shorter than one block still decrypts a single block. */
+    blocks = length / NX_CRYPTO_AES_BLOCK_SIZE;
+    if (blocks == 0)
+    {
+        blocks = 1;
+    }
 
-    for (round = num_rounds - 1; round >= 1; --round)
+#ifdef NX_CRYPTO_AES_CONSTANT_TIME
+    while (blocks > 0)
     {
 
-        _nx_crypto_aes_decryption_round(aes_ptr, (INT)round);
+        /* Decrypt two blocks per pass; a single trailing block is paired with zeros. */
+        bytes = (blocks > 1) ? (2 * NX_CRYPTO_AES_BLOCK_SIZE) : NX_CRYPTO_AES_BLOCK_SIZE;
+        NX_CRYPTO_MEMSET(q, 0, sizeof(q));
+        NX_CRYPTO_MEMCPY(q, input, bytes); /* Use case of memcpy is verified. */
+
+        _nx_crypto_aes_ct_decrypt_blocks(aes_ptr, q);
+
+        NX_CRYPTO_MEMCPY(output, q, bytes); /* Use case of memcpy is verified. */
+
+        input += bytes;
+        output += bytes;
+        blocks -= bytes / NX_CRYPTO_AES_BLOCK_SIZE;
     }
 
-    _nx_crypto_aes_inv_sub_shift_roundkey(aes_ptr, &w[0]);
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(q, 0, sizeof(q));
+#endif /* NX_SECURE_KEY_CLEAR  */
+#else
+    w = aes_ptr -> nx_crypto_aes_decrypt_key_schedule;
+    v = aes_ptr -> nx_crypto_aes_key_schedule;
+
+    for (; blocks > 0; blocks--)
+    {
+#ifndef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
+        aes_state = (UCHAR *)aes_ptr -> nx_crypto_aes_state;
+        aes_state[0] = input[0];
+        aes_state[1] = input[1];
+        aes_state[2] = input[2];
+        aes_state[3] = input[3];
+        aes_state[4] = input[4];
+        aes_state[5] = input[5];
+        aes_state[6] = input[6];
+        aes_state[7] = input[7];
+        aes_state[8] = input[8];
+        aes_state[9] = input[9];
+        aes_state[10] = input[10];
+        aes_state[11] = input[11];
+        aes_state[12] = input[12];
+        aes_state[13] = input[13];
+        aes_state[14] = input[14];
+        aes_state[15] = input[15];
+#else
+        buf = (UINT *)input;
+        aes_ptr -> nx_crypto_aes_state[0] = buf[0];
+        aes_ptr -> nx_crypto_aes_state[1] = buf[1];
+        aes_ptr -> nx_crypto_aes_state[2] = buf[2];
+        aes_ptr -> nx_crypto_aes_state[3] = buf[3];
+#endif
+
+        _nx_crypto_aes_add_round_key(aes_ptr, &v[num_rounds * 4]);
 
-    /* Extract the output encrypted block. */
+        for (round = num_rounds - 1; round >= 1; --round)
+        {
+
+            _nx_crypto_aes_decryption_round(aes_ptr, (INT)round);
+        }
+
+        _nx_crypto_aes_inv_sub_shift_roundkey(aes_ptr, &w[0]);
+
+        /* Extract the output encrypted block. */
 #ifndef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
-    output[0] = aes_state[0];
-    output[1] = aes_state[1];
-    output[2] = aes_state[2];
-    output[3] = aes_state[3];
-    output[4] = aes_state[4];
-    output[5] = aes_state[5];
-    output[6] = aes_state[6];
-    output[7] = aes_state[7];
-    output[8] = aes_state[8];
-    output[9] = aes_state[9];
-    output[10] = aes_state[10];
-    output[11] = aes_state[11];
-    output[12] = aes_state[12];
-    output[13] = aes_state[13];
-    output[14] = aes_state[14];
-    output[15] = aes_state[15];
+        output[0] = aes_state[0];
+        output[1] = aes_state[1];
+        output[2] = aes_state[2];
+        output[3] = aes_state[3];
+        output[4] = aes_state[4];
+        output[5] = aes_state[5];
+        output[6] = aes_state[6];
+        output[7] = aes_state[7];
+        output[8] = aes_state[8];
+        output[9] = aes_state[9];
+        output[10] = aes_state[10];
+        output[11] = aes_state[11];
+        output[12] = aes_state[12];
+        output[13] = aes_state[13];
+        output[14] = aes_state[14];
+        output[15] = aes_state[15];
 #else
-    buf = (UINT *)output;
-    buf[0] = aes_ptr -> nx_crypto_aes_state[0];
-    buf[1] = aes_ptr -> nx_crypto_aes_state[1];
-    buf[2] = aes_ptr -> nx_crypto_aes_state[2];
-    buf[3] = aes_ptr -> nx_crypto_aes_state[3];
+        buf = (UINT *)output;
+        buf[0] = aes_ptr -> nx_crypto_aes_state[0];
+        buf[1] = aes_ptr -> nx_crypto_aes_state[1];
+        buf[2] = aes_ptr -> nx_crypto_aes_state[2];
+        buf[3] = aes_ptr -> nx_crypto_aes_state[3];
 #endif
 
+        input += NX_CRYPTO_AES_BLOCK_SIZE;
+        output += NX_CRYPTO_AES_BLOCK_SIZE;
+    }
+#endif /* NX_CRYPTO_AES_CONSTANT_TIME */
+
     return(NX_CRYPTO_SUCCESS);
 }
 
@@ -1665,7 +2505,10 @@ UINT   i;
 
     _nx_crypto_aes_key_expansion(aes_ptr);
 
+#ifndef NX_CRYPTO_AES_CONSTANT_TIME
+    /* The constant time decryption uses the encryption key schedule directly. */
     _nx_crypto_aes_key_expansion_inverse(aes_ptr);
+#endif /* NX_CRYPTO_AES_CONSTANT_TIME */
 
     return(NX_CRYPTO_SUCCESS);
 }
@@ -186,7 +186,10 @@ UINT   i;
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function performs CBC mode decryption.                         */
+/*    This function performs CBC mode decryption.  Up to                  */
+/*    NX_CRYPTO_MODE_BATCH_BLOCKS blocks are decrypted per call to the    */
+/*    block cipher, which must process the given length as consecutive    */
+/*    blocks.                                                             */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -231,8 +234,9 @@ NX_CRYPTO_KEEP UINT _nx_crypto_cbc_decrypt(VOID *crypto_metadata, NX_CRYPTO_CBC
                                            UCHAR *input, UCHAR *output, UINT length, UCHAR block_size)
 {
 UCHAR *last_cipher;
-UCHAR save_input[16];
-UINT  i;
+UCHAR save_input[NX_CRYPTO_CBC_MAX_BLOCK_SIZE * NX_CRYPTO_MODE_BATCH_BLOCKS];
+UINT  i, j;
+UINT  batch_length;
 
     if (block_size == 0)
     {
@@ -253,19 +257,29 @@ UINT  i;
 
     last_cipher = cbc_metadata -> nx_crypto_cbc_last_block;
 
-    for (i = 0; i < length; i += block_size)
+    for (i = 0; i < length; i += batch_length)
     {
-        /* If input == output, the xor clobbers the input buffer so we need to save off our last ciphertext
-           before doing the xor. */
-        NX_CRYPTO_MEMCPY(save_input, &input[i], block_size); /* Use case of memcpy is verified. */
+        batch_length = length - i;
+        if (batch_length > (UINT)(block_size * NX_CRYPTO_MODE_BATCH_BLOCKS))
+        {
+            batch_length = (UINT)(block_size * NX_CRYPTO_MODE_BATCH_BLOCKS);
+        }
+
+        /* If input == output, the xor clobbers the input buffer so we need to save off the ciphertext
+           of the batch before doing the xor. */
+        NX_CRYPTO_MEMCPY(save_input, &input[i], batch_length); /* Use case of memcpy is verified. */
 
-        /* Decrypt the block.  */
-        crypto_function(crypto_metadata, &input[i], &output[i], block_size);
+        /* Decrypt all blocks of the batch in one call.  */
+        crypto_function(crypto_metadata, save_input, &output[i], batch_length);
 
-        /* XOR.  */
+        /* XOR each block with the previous ciphertext block.  */
         _nx_crypto_cbc_xor(&output[i], last_cipher, &output[i], block_size);
+        for (j = block_size; j < batch_length; j += block_size)
+        {
+            _nx_crypto_cbc_xor(&output[i + j], &save_input[j - block_size], &output[i + j], block_size);
+        }
 
-        NX_CRYPTO_MEMCPY(last_cipher, save_input, block_size); /* Use case of memcpy is verified. */
+        NX_CRYPTO_MEMCPY(last_cipher, &save_input[batch_length - block_size], block_size); /* Use case of memcpy is verified. */
     }
 
 #ifdef NX_SECURE_KEY_CLEAR
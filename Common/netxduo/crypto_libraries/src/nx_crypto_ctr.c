@@ -164,7 +164,8 @@ USHORT result;
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function performs CTR mode encryption, only support block of   */
-/*    16 bytes.                                                           */
+/*    16 bytes.  Up to NX_CRYPTO_MODE_BATCH_BLOCKS counter blocks are     */
+/*    encrypted per call to the block cipher.                             */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -212,8 +213,9 @@ NX_CRYPTO_KEEP UINT _nx_crypto_ctr_encrypt(VOID *crypto_metadata, NX_CRYPTO_CTR
                                            UCHAR *input, UCHAR *output, UINT length, UINT block_size)
 {
 UCHAR  *control_block = ctr_metadata -> nx_crypto_ctr_counter_block;
-UCHAR  aes_output[NX_CRYPTO_CTR_BLOCK_SIZE];
-UINT   i;
+UCHAR  aes_output[NX_CRYPTO_CTR_BLOCK_SIZE * NX_CRYPTO_MODE_BATCH_BLOCKS];
+UINT   i, j, n;
+UINT   remaining;
 
     /* Check the block size.  */
     if (block_size != NX_CRYPTO_CTR_BLOCK_SIZE)
@@ -221,23 +223,44 @@ UINT   i;
         return(NX_CRYPTO_PTR_ERROR);
     }
 
-    for (i = 0; i < length; i += block_size)
+    for (i = 0; i < length; i += n * block_size)
     {
-        if (length - i < block_size)
+
+        /* Number of counter blocks in this batch, including a trailing partial block. */
+        n = (length - i + block_size - 1) / block_size;
+        if (n > NX_CRYPTO_MODE_BATCH_BLOCKS)
         {
-            break;
+            n = NX_CRYPTO_MODE_BATCH_BLOCKS;
         }
-        crypto_function(crypto_metadata, control_block, aes_output, block_size);
-        _nx_crypto_ctr_xor(&input[i], aes_output, &output[i]);
-        _nx_crypto_ctr_add_one(control_block);
-    }
 
-    /* If the input is not an even multiple of 16 bytes, we need to truncate and xor the remainder. */
-    if (length - i != 0)
-    {
-        crypto_function(crypto_metadata, control_block, aes_output, block_size);
-        _nx_crypto_ctr_xor(&input[i], aes_output, aes_output);
-        NX_CRYPTO_MEMCPY(&output[i], aes_output, length - i); /* Use case of memcpy is verified. */
+        /* Lay out the counters. The counter is not advanced past a partial block. */
+        for (j = 0; j < n; j++)
+        {
+            NX_CRYPTO_MEMCPY(&aes_output[j * block_size], control_block, block_size); /* Use case of memcpy is verified. */
+            if (length - i - j * block_size >= block_size)
+            {
+                _nx_crypto_ctr_add_one(control_block);
+            }
+        }
+
+        /* Encrypt all counters of the batch in one call. */
+        crypto_function(crypto_metadata, aes_output, aes_output, n * block_size);
+
+        for (j = 0; j < n; j++)
+        {
+            remaining = length - i - j * block_size;
+            if (remaining >= block_size)
+            {
+                _nx_crypto_ctr_xor(&input[i + j * block_size], &aes_output[j * block_size], &output[i + j * block_size]);
+            }
+            else
+            {
+
+                /* If the input is not an even multiple of 16 bytes, we need to truncate and xor the remainder. */
+                _nx_crypto_ctr_xor(&input[i + j * block_size], &aes_output[j * block_size], &aes_output[j * block_size]);
+                NX_CRYPTO_MEMCPY(&output[i + j * block_size], &aes_output[j * block_size], remaining); /* Use case of memcpy is verified. */
+            }
+        }
     }
 
 #ifdef NX_SECURE_KEY_CLEAR
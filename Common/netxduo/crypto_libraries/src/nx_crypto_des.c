@@ -324,8 +324,9 @@ UINT   round;
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function uses the DES algorithm to encrypt 8-bytes (64-bits).  */
-/*    The result is 8 encrypted bytes. Note that the caller must make     */
-/*    sure the source and destination are 8-bytes in size!                */
+/*    The result is 8 encrypted bytes. A length of several blocks         */
+/*    encrypts consecutive blocks. Note that the caller must make sure    */
+/*    the source and destination are at least 8-bytes in size!            */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -359,10 +360,14 @@ UINT   round;
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT  _nx_crypto_des_encrypt(NX_CRYPTO_DES *context, UCHAR source[8], UCHAR destination[8], UINT length)
 {
-    NX_CRYPTO_PARAMETER_NOT_USED(length);
+UINT i;
 
-    /* Encrypt the block by supplying the encryption key set.  */
-    _nx_crypto_des_process_block(source, destination, context -> nx_des_encryption_keys);
+    /* Encrypt length / 8 consecutive blocks by supplying the encryption key set.
+       A length shorter than one block still processes a single block.  */
+    for (i = 0; (i == 0) || ((i + 8) <= length); i += 8)
+    {
+        _nx_crypto_des_process_block(&source[i], &destination[i], context -> nx_des_encryption_keys);
+    }
 
     /* Return successful completion.  */
     return(NX_CRYPTO_SUCCESS);
@@ -382,8 +387,9 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_des_encrypt(NX_CRYPTO_DES *context, UCHAR source
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function uses the DES algorithm to decrypt 8-bytes (64-bits).  */
-/*    The result is 8 original source bytes. Note that the caller must    */
-/*    make sure the source and destination are 8-bytes in size!           */
+/*    The result is 8 original source bytes. A length of several blocks   */
+/*    decrypts consecutive blocks. Note that the caller must make sure    */
+/*    the source and destination are at least 8-bytes in size!            */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -417,10 +423,14 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_des_encrypt(NX_CRYPTO_DES *context, UCHAR source
 /**************************************************************************/
 NX_CRYPTO_KEEP UINT  _nx_crypto_des_decrypt(NX_CRYPTO_DES *context, UCHAR source[8], UCHAR destination[8], UINT length)
 {
-    NX_CRYPTO_PARAMETER_NOT_USED(length);
+UINT i;
 
-    /* Decrypt the block by supplying the decryption key set.  */
-    _nx_crypto_des_process_block(source, destination, context -> nx_des_decryption_keys);
+    /* Decrypt length / 8 consecutive blocks by supplying the decryption key set.
+       A length shorter than one block still processes a single block.  */
+    for (i = 0; (i == 0) || ((i + 8) <= length); i += 8)
+    {
+        _nx_crypto_des_process_block(&source[i], &destination[i], context -> nx_des_decryption_keys);
+    }
 
     /* Return successful completion.  */
     return(NX_CRYPTO_SUCCESS);
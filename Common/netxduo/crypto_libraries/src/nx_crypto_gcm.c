@@ -183,7 +183,7 @@ USHORT result;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    _nx_crypto_gcm_xor                    Perform XOR operation         */
+/*    None                                                                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -203,47 +203,56 @@ NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_multi(UCHAR *x, UCHAR *y, UCHAR *outpu
 {
 UINT i;
 INT j;
-UCHAR v[NX_CRYPTO_GCM_BLOCK_SIZE];
-UCHAR lsb;
-UCHAR mask;
-
-    NX_CRYPTO_MEMSET(output, 0, NX_CRYPTO_GCM_BLOCK_SIZE);
-    NX_CRYPTO_MEMCPY(v, y, NX_CRYPTO_GCM_BLOCK_SIZE); /* Use case of memcpy is verified. */
-
-    mask = 0x80;
-    for (i = 0; i < NX_CRYPTO_GCM_BLOCK_SIZE_BITS; i++)
+UINT z[NX_CRYPTO_GCM_BLOCK_SIZE_INT];
+UINT v[NX_CRYPTO_GCM_BLOCK_SIZE_INT];
+UINT word;
+UINT mask;
+
+    /* Work on big endian 32-bit words. Masks replace the branches so the
+       timing does not depend on the data or the hash key. */
+    for (i = 0; i < NX_CRYPTO_GCM_BLOCK_SIZE_INT; i++)
     {
+        z[i] = 0;
+        v[i] = ((UINT)y[i << 2] << 24) | ((UINT)y[(i << 2) + 1] << 16) |
+               ((UINT)y[(i << 2) + 2] << 8) | (UINT)y[(i << 2) + 3];
+    }
 
-        /* output = output xor v when the ith bit of x is set. */
-        if (*x & mask)
-        {
-            _nx_crypto_gcm_xor(output, v, output);
-        }
-
-        /* Store the LSB before shift right. */
-        j = NX_CRYPTO_GCM_BLOCK_SIZE - 1;
-        lsb = v[j];
+    for (i = 0; i < NX_CRYPTO_GCM_BLOCK_SIZE_INT; i++)
+    {
+        word = ((UINT)x[i << 2] << 24) | ((UINT)x[(i << 2) + 1] << 16) |
+               ((UINT)x[(i << 2) + 2] << 8) | (UINT)x[(i << 2) + 3];
 
-        /* v = v >> 1 */
-        for (; j > 0; j--)
+        for (j = 31; j >= 0; j--)
         {
-            v[j] = (UCHAR)((v[j] >> 1) | (v[j - 1] << 7));
-        }
-        v[0] = v[0] >> 1;
 
-        /* v = v xor R when LSB of v is set. */
-        if (lsb & 1)
-        {
-            v[0] = v[0] ^ 0xe1;
+            /* z = z xor v when the current bit of x is set. */
+            mask = (UINT)0 - ((word >> j) & 1);
+            z[0] ^= v[0] & mask;
+            z[1] ^= v[1] & mask;
+            z[2] ^= v[2] & mask;
+            z[3] ^= v[3] & mask;
+
+            /* v = v >> 1, then v = v xor R when the LSB of v was set. */
+            mask = (UINT)0 - (v[3] & 1);
+            v[3] = (v[3] >> 1) | (v[2] << 31);
+            v[2] = (v[2] >> 1) | (v[1] << 31);
+            v[1] = (v[1] >> 1) | (v[0] << 31);
+            v[0] = (v[0] >> 1) ^ (0xE1000000 & mask);
         }
+    }
 
-        mask = mask >> 1;
-        if (!mask)
-        {
-            mask = 0x80;
-            x++;
-        }
+    for (i = 0; i < NX_CRYPTO_GCM_BLOCK_SIZE_INT; i++)
+    {
+        output[i << 2] = (UCHAR)(z[i] >> 24);
+        output[(i << 2) + 1] = (UCHAR)(z[i] >> 16);
+        output[(i << 2) + 2] = (UCHAR)(z[i] >> 8);
+        output[(i << 2) + 3] = (UCHAR)z[i];
     }
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(v, 0, sizeof(v));
+    NX_CRYPTO_MEMSET(z, 0, sizeof(z));
+#endif /* NX_SECURE_KEY_CLEAR  */
 }
 
 /**************************************************************************/
@@ -332,7 +341,9 @@ UINT i, n;
 /*  DESCRIPTION                                                           */
 /*                                                                        */
 /*    This function performs GCTR mode encryption and decryption. The     */
-/*    counter block is updated after calling this function.               */
+/*    counter block is updated after calling this function. Up to         */
+/*    NX_CRYPTO_MODE_BATCH_BLOCKS counter blocks are encrypted per call   */
+/*    to the block cipher.                                                */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -370,38 +381,62 @@ NX_CRYPTO_KEEP static VOID _nx_crypto_gcm_gctr(VOID *crypto_metadata,
                                                UINT (*crypto_function)(VOID *, UCHAR *, UCHAR *, UINT),
                                                UCHAR *input, UCHAR *output, UINT length, UCHAR *counter_block)
 {
-UCHAR aes_output[NX_CRYPTO_GCM_BLOCK_SIZE];
-UINT i, n;
+UCHAR aes_output[NX_CRYPTO_GCM_BLOCK_SIZE * NX_CRYPTO_MODE_BATCH_BLOCKS];
+UINT i, j, n;
 
-    n = length >> NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT;
-
-    for (i = 0; i < n; i++)
+    while (length > 0)
     {
 
-        /* Encrypt the counter. */
-        crypto_function(crypto_metadata, counter_block, aes_output, NX_CRYPTO_GCM_BLOCK_SIZE);
-
-        /* XOR the input with encrypted counter. */
-        _nx_crypto_gcm_xor(input, aes_output, output);
-
-        /* Increase the counter block. */
-        _nx_crypto_gcm_inc32(counter_block);
+        /* Number of counter blocks in this batch, including a trailing partial block. */
+        n = (length + NX_CRYPTO_GCM_BLOCK_SIZE - 1) >> NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT;
+        if (n > NX_CRYPTO_MODE_BATCH_BLOCKS)
+        {
+            n = NX_CRYPTO_MODE_BATCH_BLOCKS;
+        }
 
-        input += NX_CRYPTO_GCM_BLOCK_SIZE;
-        output += NX_CRYPTO_GCM_BLOCK_SIZE;
-    }
+        /* Lay out the counters. The counter is not increased past a partial block. */
+        for (i = 0; i < n; i++)
+        {
+            NX_CRYPTO_MEMCPY(&aes_output[i << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT], counter_block, NX_CRYPTO_GCM_BLOCK_SIZE); /* Use case of memcpy is verified. */
+            if (length - (i << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT) >= NX_CRYPTO_GCM_BLOCK_SIZE)
+            {
+                _nx_crypto_gcm_inc32(counter_block);
+            }
+        }
 
-    length -= n << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT;
-    if (length > 0)
-    {
-        crypto_function(crypto_metadata, counter_block, aes_output, NX_CRYPTO_GCM_BLOCK_SIZE);
+        /* Encrypt all counters of the batch in one call. */
+        crypto_function(crypto_metadata, aes_output, aes_output, n << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT);
 
-        /* Perform XOR operation on local buffer when
-            remaining input length is smaller than block size. */
-        _nx_crypto_gcm_xor(input, aes_output, aes_output);
-        NX_CRYPTO_MEMCPY(output, aes_output, length); /* Use case of memcpy is verified. */
+        for (i = 0; i < n; i++)
+        {
+            if (length >= NX_CRYPTO_GCM_BLOCK_SIZE)
+            {
+
+                /* XOR the input with encrypted counter. */
+                _nx_crypto_gcm_xor(input, &aes_output[i << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT], output);
+
+                input += NX_CRYPTO_GCM_BLOCK_SIZE;
+                output += NX_CRYPTO_GCM_BLOCK_SIZE;
+                length -= NX_CRYPTO_GCM_BLOCK_SIZE;
+            }
+            else
+            {
+
+                /* XOR the remaining bytes one at a time when the remaining
+                    input length is smaller than block size, so that no byte
+                    past the end of the input is read. */
+                for (j = 0; j < length; j++)
+                {
+                    output[j] = (UCHAR)(input[j] ^ aes_output[(i << NX_CRYPTO_GCM_BLOCK_SIZE_SHIFT) + j]);
+                }
+                length = 0;
+            }
+        }
     }
 
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_CRYPTO_MEMSET(aes_output, 0, sizeof(aes_output));
+#endif /* NX_SECURE_KEY_CLEAR  */
 }
 
 /**************************************************************************/
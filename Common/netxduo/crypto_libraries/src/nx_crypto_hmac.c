@@ -101,7 +101,9 @@ NX_CRYPTO_KEEP UINT _nx_crypto_hmac(NX_CRYPTO_HMAC *hmac_metadata,
 /*                                                                        */
 /*  DESCRIPTION                                                           */
 /*                                                                        */
-/*    This function performs HMAC initialization.                         */
+/*    This function performs HMAC initialization. When the hash state     */
+/*    cache is enabled, the hash states after K XOR ipad and K XOR opad   */
+/*    are computed once per key and restored for the following messages. */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -142,6 +144,39 @@ NX_CRYPTO_KEEP UINT _nx_crypto_hmac_initialize(NX_CRYPTO_HMAC *hmac_metadata, UC
 {
 UCHAR temp_key[128];
 UINT  i;
+#ifndef NX_CRYPTO_HMAC_DISABLE_STATE_CACHE
+NX_CRYPTO_HMAC_STATE_CACHE *entry = NX_CRYPTO_NULL;
+UINT  state_size = hmac_metadata -> state_size;
+
+    hmac_metadata -> state_cache_current = NX_CRYPTO_HMAC_STATE_CACHE_ENTRIES;
+
+    /* Keys longer than the block size are hashed first, so only shorter keys are cached.  */
+    if ((state_size != 0) && (key_length <= hmac_metadata -> block_size))
+    {
+
+        /* Look for the hash states of this key.  */
+        for (i = 0; i < NX_CRYPTO_HMAC_STATE_CACHE_ENTRIES; i++)
+        {
+            entry = &(hmac_metadata -> state_cache[i]);
+            if ((entry -> algorithm == hmac_metadata -> algorithm) &&
+                (entry -> key_length == key_length) &&
+                (NX_CRYPTO_MEMCMP(entry -> key, key_ptr, key_length) == 0))
+            {
+
+                /* Resume the inner hash after K XOR ipad.  */
+                NX_CRYPTO_MEMCPY(hmac_metadata -> context, entry -> inner_state, state_size); /* Use case of memcpy is verified. */
+                hmac_metadata -> state_cache_current = i;
+
+                return(NX_CRYPTO_SUCCESS);
+            }
+        }
+
+        /* Not found, replace the entries in turn.  */
+        i = hmac_metadata -> state_cache_next % NX_CRYPTO_HMAC_STATE_CACHE_ENTRIES;
+        hmac_metadata -> state_cache_next = i + 1;
+        entry = &(hmac_metadata -> state_cache[i]);
+    }
+#endif /* NX_CRYPTO_HMAC_DISABLE_STATE_CACHE */
 
     /* If key is longer than block size, reset it to key=CRYPTO(key). */
     if (key_length > hmac_metadata -> block_size)
@@ -169,24 +204,49 @@ UINT  i;
        opad is the byte 0x5c repeated block_size times,
        and text is the data being protected.      */
 
-    NX_CRYPTO_MEMSET(hmac_metadata -> k_ipad, 0, hmac_metadata -> block_size);
-
     NX_CRYPTO_MEMSET(hmac_metadata -> k_opad, 0, hmac_metadata -> block_size);
 
-    NX_CRYPTO_MEMCPY(hmac_metadata -> k_ipad, key_ptr, key_length); /* Use case of memcpy is verified. */
-
     NX_CRYPTO_MEMCPY(hmac_metadata -> k_opad, key_ptr, key_length); /* Use case of memcpy is verified. */
 
-
-    /* XOR key with ipad and opad values. */
+    /* XOR key with ipad value. */
     for (i = 0; i < hmac_metadata -> block_size; i++)
     {
-        hmac_metadata -> k_ipad[i] ^= 0x36;
-        hmac_metadata -> k_opad[i] ^= 0x5c;
+        hmac_metadata -> k_opad[i] ^= 0x36;
     }
 
     /* Kick off the inner hash with our padded key. */
-    hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_ipad, hmac_metadata -> block_size);
+    hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_opad, hmac_metadata -> block_size);
+
+    /* Turn K XOR ipad into K XOR opad for the outer hash. */
+    for (i = 0; i < hmac_metadata -> block_size; i++)
+    {
+        hmac_metadata -> k_opad[i] ^= (0x36 ^ 0x5c);
+    }
+
+#ifndef NX_CRYPTO_HMAC_DISABLE_STATE_CACHE
+    if (entry != NX_CRYPTO_NULL)
+    {
+
+        /* Save the inner hash state, then compute the outer hash state once for this key.  */
+        NX_CRYPTO_MEMCPY(entry -> inner_state, hmac_metadata -> context, state_size); /* Use case of memcpy is verified. */
+
+        hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
+
+        hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_opad, hmac_metadata -> block_size);
+
+        NX_CRYPTO_MEMCPY(entry -> outer_state, hmac_metadata -> context, state_size); /* Use case of memcpy is verified. */
+
+        /* Restore the inner hash state for the message.  */
+        NX_CRYPTO_MEMCPY(hmac_metadata -> context, entry -> inner_state, state_size); /* Use case of memcpy is verified. */
+
+        entry -> algorithm = hmac_metadata -> algorithm;
+        entry -> key_length = key_length;
+        NX_CRYPTO_MEMSET(entry -> key, 0, sizeof(entry -> key));
+        NX_CRYPTO_MEMCPY(entry -> key, key_ptr, key_length); /* Use case of memcpy is verified. */
+
+        hmac_metadata -> state_cache_current = (UINT)(entry - hmac_metadata -> state_cache);
+    }
+#endif /* NX_CRYPTO_HMAC_DISABLE_STATE_CACHE */
 
 #ifdef NX_SECURE_KEY_CLEAR
     NX_CRYPTO_MEMSET(temp_key, 0, sizeof(temp_key));
@@ -304,9 +364,23 @@ UCHAR icv_ptr[64];
 
     hmac_metadata -> crypto_digest_calculate(hmac_metadata -> context, icv_ptr, hmac_metadata -> algorithm);
 
-    hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
+#ifndef NX_CRYPTO_HMAC_DISABLE_STATE_CACHE
+    if ((hmac_metadata -> state_size != 0) &&
+        (hmac_metadata -> state_cache_current < NX_CRYPTO_HMAC_STATE_CACHE_ENTRIES))
+    {
 
-    hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_opad, hmac_metadata -> block_size);
+        /* Resume the outer hash after K XOR opad.  */
+        NX_CRYPTO_MEMCPY(hmac_metadata -> context,
+                         hmac_metadata -> state_cache[hmac_metadata -> state_cache_current].outer_state,
+                         hmac_metadata -> state_size); /* Use case of memcpy is verified. */
+    }
+    else
+#endif /* NX_CRYPTO_HMAC_DISABLE_STATE_CACHE */
+    {
+        hmac_metadata -> crypto_initialize(hmac_metadata -> context, hmac_metadata -> algorithm);
+
+        hmac_metadata -> crypto_update(hmac_metadata -> context, hmac_metadata -> k_opad, hmac_metadata -> block_size);
+    }
 
     hmac_metadata -> crypto_update(hmac_metadata -> context, icv_ptr, hmac_metadata -> output_length);
 
@@ -391,6 +465,74 @@ NX_CRYPTO_KEEP VOID _nx_crypto_hmac_metadata_set(NX_CRYPTO_HMAC *hmac_metadata,
     hmac_metadata -> crypto_initialize = crypto_initialize;
     hmac_metadata -> crypto_update = crypto_update;
     hmac_metadata -> crypto_digest_calculate = crypto_digest_calculate;
+#ifndef NX_CRYPTO_HMAC_DISABLE_STATE_CACHE
+    hmac_metadata -> state_size = 0;
+#endif /* NX_CRYPTO_HMAC_DISABLE_STATE_CACHE */
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_hmac_state_size_set                      PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function enables the hash state cache of the HMAC metadata.    */
+/*    state_size is the number of leading bytes of the hash context that  */
+/*    hold the chaining values and the bit count. Since the padded keys   */
+/*    fill exactly one block, these bytes are all that is needed to       */
+/*    resume the hash after K XOR ipad or K XOR opad. It must be called   */
+/*    after _nx_crypto_hmac_metadata_set, which disables the cache.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    hmac_metadata                         pointer to HMAC metadata      */
+/*    state_size                            size of the hash state        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_method_hmac_md5_operation  Handle HMAC-MD5 operation     */
+/*    _nx_crypto_method_hmac_sha1_operation Handle HMAC-SHA1 operation    */
+/*    _nx_crypto_method_hmac_sha256_operation Handle HMAC-SHA256 operation*/
+/*    _nx_crypto_method_hmac_sha512_operation Handle HMAC-SHA512 operation*/
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_hmac_state_size_set(NX_CRYPTO_HMAC *hmac_metadata, UINT state_size)
+{
+#ifndef NX_CRYPTO_HMAC_DISABLE_STATE_CACHE
+
+    /* States that do not fit are not cached.  */
+    if ((state_size > NX_CRYPTO_HMAC_MAX_STATE_SIZE) || (state_size & 0x3))
+    {
+        state_size = 0;
+    }
+
+    hmac_metadata -> state_size = state_size;
+#else
+    NX_CRYPTO_PARAMETER_NOT_USED(hmac_metadata);
+    NX_CRYPTO_PARAMETER_NOT_USED(state_size);
+#endif /* NX_CRYPTO_HMAC_DISABLE_STATE_CACHE */
 }
 
 /**************************************************************************/
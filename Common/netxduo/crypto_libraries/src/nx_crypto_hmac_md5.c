@@ -200,6 +200,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_md5_cleanup(VOID *crypto_metadata)
 /*                                                                        */
 /*    _nx_crypto_hmac                       Calculate the HMAC            */
 /*    _nx_crypto_hmac_metadata_set          Set HMAC metadata             */
+/*    _nx_crypto_hmac_state_size_set        Enable HMAC state cache       */
 /*    _nx_crypto_hmac_initialize            Perform HMAC initialization   */
 /*    _nx_crypto_hmac_update                Perform HMAC update           */
 /*    _nx_crypto_hmac_digest_calculate      Calculate HMAC digest         */
@@ -265,6 +266,11 @@ NX_CRYPTO_HMAC     *hmac_metadata;
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_md5_update,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_md5_digest_calculate);
 
+    /* Cache the hash state after the padded keys, see _nx_crypto_hmac_state_size_set.  */
+    _nx_crypto_hmac_state_size_set(hmac_metadata,
+                                   sizeof(ctx -> nx_md5_hmac_context.nx_md5_states) +
+                                   sizeof(ctx -> nx_md5_hmac_context.nx_md5_bit_count));
+
     switch (op)
     {
     case NX_CRYPTO_HASH_INITIALIZE:
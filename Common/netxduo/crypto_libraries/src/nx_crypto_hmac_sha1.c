@@ -199,6 +199,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha1_cleanup(VOID *crypto_metadata)
 /*                                                                        */
 /*    _nx_crypto_hmac                       Calculate the HMAC            */
 /*    _nx_crypto_hmac_metadata_set          Set HMAC metadata             */
+/*    _nx_crypto_hmac_state_size_set        Enable HMAC state cache       */
 /*    _nx_crypto_hmac_initialize            Perform HMAC initialization   */
 /*    _nx_crypto_hmac_update                Perform HMAC update           */
 /*    _nx_crypto_hmac_digest_calculate      Calculate HMAC digest         */
@@ -264,6 +265,11 @@ NX_CRYPTO_HMAC         *hmac_metadata;
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_sha1_update,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_sha1_digest_calculate);
 
+    /* Cache the hash state after the padded keys, see _nx_crypto_hmac_state_size_set.  */
+    _nx_crypto_hmac_state_size_set(hmac_metadata,
+                                   sizeof(ctx -> nx_sha1_hmac_context.nx_sha1_states) +
+                                   sizeof(ctx -> nx_sha1_hmac_context.nx_sha1_bit_count));
+
     switch (op)
     {
     case NX_CRYPTO_HASH_INITIALIZE:
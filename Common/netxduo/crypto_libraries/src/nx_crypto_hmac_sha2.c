@@ -200,6 +200,7 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_method_hmac_sha256_cleanup(VOID *crypto_metadata
 /*                                                                        */
 /*    _nx_crypto_hmac                       Calculate the HMAC            */
 /*    _nx_crypto_hmac_metadata_set          Set HMAC metadata             */
+/*    _nx_crypto_hmac_state_size_set        Enable HMAC state cache       */
 /*    _nx_crypto_hmac_initialize            Perform HMAC initialization   */
 /*    _nx_crypto_hmac_update                Perform HMAC update           */
 /*    _nx_crypto_hmac_digest_calculate      Calculate HMAC digest         */
@@ -281,6 +282,11 @@ UINT                    icv_length;
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_sha256_update,
                                  (UINT (*)(VOID *, UCHAR *, UINT))_nx_crypto_sha256_digest_calculate);
 
+    /* Cache the hash state after the padded keys, see _nx_crypto_hmac_state_size_set.  */
+    _nx_crypto_hmac_state_size_set(hmac_metadata,
+                                   sizeof(ctx -> nx_sha256_hmac_context.nx_sha256_states) +
+                                   sizeof(ctx -> nx_sha256_hmac_context.nx_sha256_bit_count));
+
 
     switch (op)
     {
@@ -28,6 +28,37 @@
 #include "nx_crypto.h"
 #include "nx_crypto_huge_number.h"
 
+/* Column accumulator of the product-scanning (Comba) routines.  The double digit "sum" and the
+   digit "carry" hold the running sum of one column of partial products.  Once the column is
+   complete, the low digit of sum is the output digit and the accumulator is shifted down by one
+   digit.  */
+#define HN_COMBA_MULADD(a, b, sum, carry)                                    \
+    {                                                                        \
+    HN_UBASE2 _product = (HN_UBASE2)(a) * (b);                               \
+        (sum) += _product;                                                   \
+        (carry) = (HN_UBASE)((carry) + ((sum) < _product));                  \
+    }
+
+/* Add the accumulator (sum2, carry2) to the accumulator (sum, carry). */
+#define HN_COMBA_ADD(sum2, carry2, sum, carry)                               \
+    (sum) += (sum2);                                                         \
+    (carry) = (HN_UBASE)((carry) + (carry2) + ((sum) < (sum2)));
+
+/* Double the accumulator, used for the symmetric cross products of a square. */
+#define HN_COMBA_DOUBLE(sum, carry)                                          \
+    (carry) = (HN_UBASE)(((carry) << 1) | ((sum) >> ((HN_SHIFT << 1) - 1))); \
+    (sum) <<= 1;
+
+/* Shift the accumulator down by one digit once a column has been output. */
+#define HN_COMBA_SHIFT(sum, carry)                                           \
+    (sum) = ((sum) >> HN_SHIFT) | ((HN_UBASE2)(carry) << HN_SHIFT);          \
+    (carry) = 0;
+
+/* Get bit n of a huge number. */
+#define HN_BIT(hn, n)                                                        \
+    (((hn) -> nx_crypto_huge_number_data[(n) / HN_SHIFT] >> ((n) % HN_SHIFT)) & 1)
+
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -1030,6 +1061,275 @@ UINT right_size;
 }
 
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_huge_number_comba_multiply               PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function multiplies two arrays of digits using column-wise     */
+/*    (Comba) multiplication, and places the product in the result buffer,*/
+/*    which must hold left_size + right_size digits and must not overlap  */
+/*    either operand.                                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    left                                  First operand                 */
+/*    left_size                             Number of digits of left      */
+/*    right                                 Second operand                */
+/*    right_size                            Number of digits of right     */
+/*    result                                Result buffer                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_huge_number_multiply       Multiply two huge numbers     */
+/*    _nx_crypto_huge_number_karatsuba      Multiply two arrays of        */
+/*                                            digits using Karatsuba      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_huge_number_comba_multiply(HN_UBASE *left, UINT left_size,
+                                                                 HN_UBASE *right, UINT right_size,
+                                                                 HN_UBASE *result)
+{
+UINT      column, index, last;
+HN_UBASE2 sum = 0;
+HN_UBASE  carry = 0;
+
+    if ((left_size == 0) || (right_size == 0))
+    {
+        NX_CRYPTO_MEMSET(result, 0, (left_size + right_size) << HN_SIZE_SHIFT);
+        return;
+    }
+
+    for (column = 0; column < (left_size + right_size - 1); column++)
+    {
+
+        /* Accumulate left[index] * right[column - index] for every valid index. */
+        index = (column >= right_size) ? (column - right_size + 1) : 0;
+        last = (column < left_size) ? column : (left_size - 1);
+        for (; index <= last; index++)
+        {
+            HN_COMBA_MULADD(left[index], right[column - index], sum, carry);
+        }
+
+        result[column] = (HN_UBASE)sum;
+        HN_COMBA_SHIFT(sum, carry);
+    }
+    result[column] = (HN_UBASE)sum;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_huge_number_karatsuba_subtract           PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function subtracts an array of digits from another, longer or  */
+/*    equal sized, array of digits in place. The difference must not be   */
+/*    negative.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    value                                 Minuend and result            */
+/*    value_size                            Number of digits of value     */
+/*    subtrahend                            Subtrahend                    */
+/*    subtrahend_size                       Number of digits of           */
+/*                                            subtrahend                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_huge_number_karatsuba      Multiply two arrays of        */
+/*                                            digits using Karatsuba      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_huge_number_karatsuba_subtract(HN_UBASE *value, UINT value_size,
+                                                                     HN_UBASE *subtrahend, UINT subtrahend_size)
+{
+UINT      i;
+HN_UBASE2 difference;
+HN_UBASE  borrow = 0;
+
+    for (i = 0; i < value_size; i++)
+    {
+        difference = (HN_UBASE2)value[i] - borrow;
+        if (i < subtrahend_size)
+        {
+            difference -= subtrahend[i];
+        }
+        else if (borrow == 0)
+        {
+            break;
+        }
+        value[i] = (HN_UBASE)difference;
+        borrow = (HN_UBASE)((difference >> HN_SHIFT) & 1);
+    }
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_huge_number_karatsuba                    PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function multiplies two arrays of digits of the same size using*/
+/*    Karatsuba multiplication, recursing until the operands are smaller  */
+/*    than NX_CRYPTO_HUGE_NUMBER_KARATSUBA_THRESHOLD. The result buffer   */
+/*    must hold 2 * size digits and must not overlap either operand.      */
+/*                                                                        */
+/*    Each level of recursion uses 4 * (size / 2 + 1) digits of scratch   */
+/*    for the half sums and their product.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    left                                  First operand                 */
+/*    right                                 Second operand                */
+/*    size                                  Number of digits of operands  */
+/*    result                                Result buffer                 */
+/*    scratch                               Buffer used to hold           */
+/*                                            intermediate data           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_huge_number_comba_multiply Multiply two arrays of        */
+/*                                            digits using Comba          */
+/*    _nx_crypto_huge_number_karatsuba      Multiply two arrays of        */
+/*                                            digits using Karatsuba      */
+/*    _nx_crypto_huge_number_karatsuba_subtract                           */
+/*                                          Subtract arrays of digits     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_huge_number_multiply_karatsuba                           */
+/*                                          Multiply two huge numbers     */
+/*                                            using Karatsuba             */
+/*    _nx_crypto_huge_number_karatsuba      Multiply two arrays of        */
+/*                                            digits using Karatsuba      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP static VOID _nx_crypto_huge_number_karatsuba(HN_UBASE *left, HN_UBASE *right, UINT size,
+                                                            HN_UBASE *result, HN_UBASE *scratch)
+{
+UINT      low, high, i;
+HN_UBASE *left_sum, *right_sum, *middle;
+HN_UBASE2 sum;
+
+    if (size < NX_CRYPTO_HUGE_NUMBER_KARATSUBA_THRESHOLD)
+    {
+        _nx_crypto_huge_number_comba_multiply(left, size, right, size, result);
+        return;
+    }
+
+    /* Split each operand into a low half of "low" digits and a high half of "high" digits. */
+    low = size >> 1;
+    high = size - low;
+    left_sum = scratch;
+    right_sum = left_sum + high + 1;
+    middle = right_sum + high + 1;
+
+    /* result = (left_high * right_high) << (2 * low) + left_low * right_low */
+    _nx_crypto_huge_number_karatsuba(left, right, low, result, scratch);
+    _nx_crypto_huge_number_karatsuba(left + low, right + low, high, result + (low << 1), scratch);
+
+    /* left_sum = left_low + left_high, right_sum = right_low + right_high. */
+    sum = 0;
+    for (i = 0; i < high; i++)
+    {
+        sum = (HN_UBASE2)left[low + i] + (sum >> HN_SHIFT);
+        if (i < low)
+        {
+            sum += left[i];
+        }
+        left_sum[i] = (HN_UBASE)sum;
+    }
+    left_sum[high] = (HN_UBASE)(sum >> HN_SHIFT);
+    sum = 0;
+    for (i = 0; i < high; i++)
+    {
+        sum = (HN_UBASE2)right[low + i] + (sum >> HN_SHIFT);
+        if (i < low)
+        {
+            sum += right[i];
+        }
+        right_sum[i] = (HN_UBASE)sum;
+    }
+    right_sum[high] = (HN_UBASE)(sum >> HN_SHIFT);
+
+    /* middle = left_sum * right_sum - left_low * right_low - left_high * right_high,
+       which is the cross term and is never negative.  */
+    _nx_crypto_huge_number_karatsuba(left_sum, right_sum, high + 1, middle, middle + ((high + 1) << 1));
+    _nx_crypto_huge_number_karatsuba_subtract(middle, (high + 1) << 1, result, low << 1);
+    _nx_crypto_huge_number_karatsuba_subtract(middle, (high + 1) << 1, result + (low << 1), high << 1);
+
+    /* result += middle << low. The cross term fits in size + 1 digits. */
+    sum = 0;
+    for (i = 0; i < (size + 1); i++)
+    {
+        sum = (HN_UBASE2)result[low + i] + middle[i] + (sum >> HN_SHIFT);
+        result[low + i] = (HN_UBASE)sum;
+    }
+    for (i = low + size + 1; (i < (size << 1)) && ((sum >> HN_SHIFT) != 0); i++)
+    {
+        sum = (HN_UBASE2)result[i] + (sum >> HN_SHIFT);
+        result[i] = (HN_UBASE)sum;
+    }
+}
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -1086,54 +1386,131 @@ NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_multiply(NX_CRYPTO_HUGE_NUMBER *left,
                                                     NX_CRYPTO_HUGE_NUMBER *result)
 {
 
-UINT      index, right_index; /* Loop variables */
-HN_UBASE *left_buffer, *right_buffer;
-HN_UBASE2 product;
 UINT      left_size, right_size;
-HN_UBASE *result_buffer;
-HN_UBASE *temp_ptr;
 
     left_size = left -> nx_crypto_huge_number_size;
     right_size = right -> nx_crypto_huge_number_size;
-    left_buffer = left -> nx_crypto_huge_number_data;
-    right_buffer = right -> nx_crypto_huge_number_data;
-
-    /* The temp buffer serves as "buckets".  During each itegration, the products of two digits are accumucated into
-       this buckets.  Since each "digit" is 16-bit, by using 32-bit buckets, the carry can be accumulated in to the
-       top 16-bits of the bucket.  Therefore, we don't need to worry about "carry" bit during each iteration.  */
 
-    result_buffer = result -> nx_crypto_huge_number_data;
+    /* The product is built column by column (Comba).  All partial products of a column are summed in
+       a three-digit accumulator, so each digit of the result is written exactly once and no carry has
+       to be propagated through the result buffer.  */
     result -> nx_crypto_huge_number_size = (left_size + right_size);
+    _nx_crypto_huge_number_comba_multiply(left -> nx_crypto_huge_number_data, left_size,
+                                          right -> nx_crypto_huge_number_data, right_size,
+                                          result -> nx_crypto_huge_number_data);
+
+    /* Set is_negative. */
+    if (left -> nx_crypto_huge_number_is_negative == right -> nx_crypto_huge_number_is_negative)
+    {
+        result -> nx_crypto_huge_number_is_negative = NX_CRYPTO_FALSE;
+    }
+    else
+    {
+        result -> nx_crypto_huge_number_is_negative = NX_CRYPTO_TRUE;
+    }
 
-    /* Zero out the buckets since we are going to accumulate "digits" there. */
-    NX_CRYPTO_MEMSET(result_buffer, 0, (left_size + right_size) << HN_SIZE_SHIFT);
+    _nx_crypto_huge_number_adjust_size(result);
 
-    /* Loop over the operands, grabbing a "digit" at a time and calculating the product accounting for carry. */
-    for (index = 0; index < left_size; ++index)
+    return;
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_huge_number_multiply_karatsuba           PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function multiplies two huge numbers and places the result in  */
+/*    the result buffer which must be large enough to hold the resulting  */
+/*    value. Operands of similar size at or above                         */
+/*    NX_CRYPTO_HUGE_NUMBER_KARATSUBA_THRESHOLD digits are multiplied with*/
+/*    Karatsuba, others with column-wise multiplication.                  */
+/*                                                                        */
+/*    scratch is required to be no less than                              */
+/*    NX_CRYPTO_HUGE_NUMBER_KARATSUBA_SCRATCH_SIZE of the buffer size of  */
+/*    the larger operand.                                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    left                                  First operand                 */
+/*    right                                 Second operand                */
+/*    result                                Result                        */
+/*    scratch                               Buffer used to hold           */
+/*                                            intermediate data           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_huge_number_multiply       Multiply two huge numbers     */
+/*    _nx_crypto_huge_number_karatsuba      Multiply two arrays of        */
+/*                                            digits using Karatsuba      */
+/*    _nx_crypto_huge_number_adjust_size    Adjust the size of a huge     */
+/*                                            number to remove leading    */
+/*                                            zeroes                      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_huge_number_crt_power_modulus                            */
+/*                                          Raise a huge number for CRT   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_multiply_karatsuba(NX_CRYPTO_HUGE_NUMBER *left,
+                                                              NX_CRYPTO_HUGE_NUMBER *right,
+                                                              NX_CRYPTO_HUGE_NUMBER *result,
+                                                              HN_UBASE *scratch)
+{
+UINT      size, left_size, right_size;
+HN_UBASE *left_buffer, *right_buffer;
+
+    left_size = left -> nx_crypto_huge_number_size;
+    right_size = right -> nx_crypto_huge_number_size;
+    size = (left_size > right_size) ? left_size : right_size;
+
+    /* Padding an operand to twice its size costs more than Karatsuba saves. */
+    if (((left_size << 1) <= size) || ((right_size << 1) <= size) ||
+        (size < NX_CRYPTO_HUGE_NUMBER_KARATSUBA_THRESHOLD))
     {
+        _nx_crypto_huge_number_multiply(left, right, result);
+        return;
+    }
 
-        /* If the "digit" on the left is zero, there is no need to loop through the "digits" on the right. */
-        if (left_buffer[index] == 0)
+    /* Zero-extend the shorter operand in scratch so both operands have the same number of digits. */
+    left_buffer = left -> nx_crypto_huge_number_data;
+    right_buffer = right -> nx_crypto_huge_number_data;
+    if (left_size != right_size)
+    {
+        NX_CRYPTO_MEMSET(scratch, 0, size << HN_SIZE_SHIFT);
+        if (left_size < right_size)
         {
-            /* Yes the digit ont he left is zero.  Continue to the next iteration. */
-            continue;
+            NX_CRYPTO_MEMCPY(scratch, left_buffer, left_size << HN_SIZE_SHIFT);
+            left_buffer = scratch;
         }
-
-        product = 0;
-        temp_ptr = result_buffer + index;
-        for (right_index = 0; right_index < right_size; ++right_index, ++temp_ptr)
+        else
         {
-            /* Multiple "digit" from the left with the one the left. */
-            product >>= HN_SHIFT;
-            product += (HN_UBASE2)left_buffer[index] * (HN_UBASE2)right_buffer[right_index] + *temp_ptr;
-
-            /* The result (in product) could be two parts: the top digit the the lower digit. */
-            /* Accumulate the lower digit into the "bucket" and the top digit to the next "bucket". */
-            *temp_ptr = (product & HN_MASK);
+            NX_CRYPTO_MEMCPY(scratch, right_buffer, right_size << HN_SIZE_SHIFT);
+            right_buffer = scratch;
         }
-        *temp_ptr = (HN_UBASE)((product >> HN_SHIFT));
+        scratch += size;
     }
 
+    _nx_crypto_huge_number_karatsuba(left_buffer, right_buffer, size, result -> nx_crypto_huge_number_data, scratch);
+    result -> nx_crypto_huge_number_size = (size << 1);
+
     /* Set is_negative. */
     if (left -> nx_crypto_huge_number_is_negative == right -> nx_crypto_huge_number_is_negative)
     {
@@ -1145,8 +1522,6 @@ HN_UBASE *temp_ptr;
     }
 
     _nx_crypto_huge_number_adjust_size(result);
-
-    return;
 }
 
 /**************************************************************************/
@@ -1286,50 +1661,47 @@ HN_UBASE *result_buffer;
 /**************************************************************************/
 NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_square(NX_CRYPTO_HUGE_NUMBER *value, NX_CRYPTO_HUGE_NUMBER *result)
 {
-HN_UBASE2 product;
 UINT      value_size;
-UINT      result_size;
 HN_UBASE *value_buffer;
 HN_UBASE *result_buffer;
-UINT      i, j;
+UINT      column, index, last;
+HN_UBASE2 sum = 0, cross_sum;
+HN_UBASE  carry = 0, cross_carry;
 
-    /* Using Yang et al.'s squaring algorithm. */
+    /* Column-wise squaring.  Every cross product value[i] * value[j] with i != j appears twice in
+       its column, so it is computed once into a separate accumulator which is then doubled.  */
     value_size = value -> nx_crypto_huge_number_size;
-    result_size = (value_size << 1);
-    result -> nx_crypto_huge_number_size = result_size;
+    result -> nx_crypto_huge_number_size = (value_size << 1);
     value_buffer = value -> nx_crypto_huge_number_data;
     result_buffer = result -> nx_crypto_huge_number_data;
 
-    NX_CRYPTO_MEMSET(result_buffer, 0, result_size << HN_SIZE_SHIFT);
+    if (value_size == 0)
+    {
+        return;
+    }
 
-    for (i = 0; i < value_size; i++)
+    for (column = 0; column < (value_size << 1) - 1; column++)
     {
-        product = 0;
-        for (j = i + 1; j < value_size; j++)
+        cross_sum = 0;
+        cross_carry = 0;
+        index = (column >= value_size) ? (column - value_size + 1) : 0;
+        last = (column - 1) >> 1;
+        for (; (column > 0) && (index <= last); index++)
         {
-            product >>= HN_SHIFT;
-            product += result_buffer[i + j] + (HN_UBASE2)value_buffer[i] * value_buffer[j];
-            result_buffer[i + j] = product & HN_MASK;
+            HN_COMBA_MULADD(value_buffer[index], value_buffer[column - index], cross_sum, cross_carry);
         }
-        result_buffer[i + j] = (HN_UBASE)(product >> HN_SHIFT);
-    }
+        HN_COMBA_DOUBLE(cross_sum, cross_carry);
+        HN_COMBA_ADD(cross_sum, cross_carry, sum, carry);
 
-    for (i = result_size - 1; i > 0; i--)
-    {
-        result_buffer[i] = (result_buffer[i] << 1) | (result_buffer[i - 1] >> (HN_SHIFT - 1));
-    }
-    result_buffer[0] <<= 1;
+        if ((column & 1) == 0)
+        {
+            HN_COMBA_MULADD(value_buffer[column >> 1], value_buffer[column >> 1], sum, carry);
+        }
 
-    product = 0;
-    for (i = 0; i < value_size; i++)
-    {
-        product >>= HN_SHIFT;
-        product += result_buffer[i << 1] + (HN_UBASE2)value_buffer[i] * value_buffer[i];
-        result_buffer[i << 1] = product & HN_MASK;
-        product >>= HN_SHIFT;
-        product += result_buffer[(i << 1) + 1];
-        result_buffer[(i << 1) + 1] = product & HN_MASK;
+        result_buffer[column] = (HN_UBASE)sum;
+        HN_COMBA_SHIFT(sum, carry);
     }
+    result_buffer[column] = (HN_UBASE)sum;
 
     result -> nx_crypto_huge_number_is_negative = NX_CRYPTO_FALSE;
     _nx_crypto_huge_number_adjust_size(result);
@@ -2535,6 +2907,130 @@ HN_UBASE *result_buffer = result -> nx_crypto_huge_number_data;
     }
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_huge_number_mont_square                  PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function performs Montgomery reduction for squaring.           */
+/*                      r = (x * x) * R ^ (-1) mod m                      */
+/*                                                                        */
+/*    The square and the reduction are interleaved column by column       */
+/*    (finely integrated product scanning), and each cross product of x is*/
+/*    computed once and doubled. The digits of the reduction quotient are */
+/*    kept in the result buffer, so no buffer beyond the m_len + 1 digits */
+/*    of the result is needed. x must be less than m, and result must not */
+/*    overlap x or m.                                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    m                                     Huge number m                 */
+/*    mi                                    mi = -m ^ (-1) mod radix      */
+/*    x                                     Huge number x                 */
+/*    result                                Huge number r                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_crypto_huge_number_subtract       Calculate subtraction for     */
+/*                                            huge numbers                */
+/*    _nx_crypto_huge_number_adjust_size    Adjust the size of a huge     */
+/*                                            number to remove leading    */
+/*                                            zeroes                      */
+/*    _nx_crypto_huge_number_compare        Compare two huge numbers      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_huge_number_mont_power_modulus                           */
+/*                                          Raise a huge number for       */
+/*                                            montgomery reduction        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_mont_square(NX_CRYPTO_HUGE_NUMBER *m, UINT mi,
+                                                       NX_CRYPTO_HUGE_NUMBER *x,
+                                                       NX_CRYPTO_HUGE_NUMBER *result)
+{
+UINT      i, j, last;
+HN_UBASE2 sum = 0, cross_sum;
+HN_UBASE  carry = 0, cross_carry;
+UINT      m_len = m -> nx_crypto_huge_number_size;
+UINT      x_len = x -> nx_crypto_huge_number_size;
+HN_UBASE *m_buffer = m -> nx_crypto_huge_number_data;
+HN_UBASE *x_buffer = x -> nx_crypto_huge_number_data;
+HN_UBASE *result_buffer = result -> nx_crypto_huge_number_data;
+
+    for (i = 0; i < (m_len << 1); i++)
+    {
+
+        /* Cross products x[j] * x[i - j] with j < i - j, counted twice. */
+        cross_sum = 0;
+        cross_carry = 0;
+        for (j = (i >= x_len) ? (i - x_len + 1) : 0; (j << 1) < i; j++)
+        {
+            HN_COMBA_MULADD(x_buffer[j], x_buffer[i - j], cross_sum, cross_carry);
+        }
+        HN_COMBA_DOUBLE(cross_sum, cross_carry);
+        HN_COMBA_ADD(cross_sum, cross_carry, sum, carry);
+
+        if (((i & 1) == 0) && ((i >> 1) < x_len))
+        {
+            HN_COMBA_MULADD(x_buffer[i >> 1], x_buffer[i >> 1], sum, carry);
+        }
+
+        /* Reduction terms u[j] * m[i - j], where u[j] is kept in result[j]. */
+        j = (i >= m_len) ? (i - m_len + 1) : 0;
+        last = (i < m_len) ? i : m_len;
+        for (; j < last; j++)
+        {
+            HN_COMBA_MULADD(result_buffer[j], m_buffer[i - j], sum, carry);
+        }
+
+        if (i < m_len)
+        {
+
+            /* u[i] = sum * mi mod radix clears the low digit of the column. */
+            result_buffer[i] = (HN_UBASE)((HN_UBASE)sum * mi);
+            HN_COMBA_MULADD(result_buffer[i], m_buffer[0], sum, carry);
+        }
+        else
+        {
+
+            /* u[i - m_len] is not used by any later column. */
+            result_buffer[i - m_len] = (HN_UBASE)sum;
+        }
+        HN_COMBA_SHIFT(sum, carry);
+    }
+    result_buffer[m_len] = (HN_UBASE)sum;
+
+    /* Set result size. */
+    result -> nx_crypto_huge_number_size = m_len + 1;
+    result -> nx_crypto_huge_number_is_negative = NX_CRYPTO_FALSE;
+    _nx_crypto_huge_number_adjust_size(result);
+
+    if (_nx_crypto_huge_number_compare(result, m) != NX_CRYPTO_HUGE_NUMBER_LESS)
+    {
+
+        /* r = r - m. */
+        _nx_crypto_huge_number_subtract(result, m);
+    }
+}
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -2551,7 +3047,8 @@ HN_UBASE *result_buffer = result -> nx_crypto_huge_number_data;
 /*    number using a third huge number as a modulus. The result is placed */
 /*    in a fourth huge number. Montgomery reduction is used.              */
 /*    scratch is required to be larger than twice of buffer size of m     */
-/*    plus 8 bytes.                                                       */
+/*    plus 8 bytes, plus NX_CRYPTO_HUGE_NUMBER_WINDOW_SCRATCH_SIZE of     */
+/*    buffer size of m for the table of odd powers.                       */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -2609,7 +3106,7 @@ NX_CRYPTO_KEEP VOID _nx_crypto_huge_number_mont_power_modulus(NX_CRYPTO_HUGE_NUM
                                                               HN_UBASE *scratch)
 {
 UINT                   m_len;
-NX_CRYPTO_HUGE_NUMBER  xx;
+NX_CRYPTO_HUGE_NUMBER  table[1 << (NX_CRYPTO_HUGE_NUMBER_WINDOW_BITS - 1)];
 NX_CRYPTO_HUGE_NUMBER  temp;
 NX_CRYPTO_HUGE_NUMBER  digit;
 NX_CRYPTO_HUGE_NUMBER  radix;
@@ -2619,8 +3116,8 @@ HN_UBASE               digit_value;
 HN_UBASE              *val;
 HN_UBASE               radix_buffer[2] = {0, 1};
 HN_UBASE               mm_buffer[2];
-HN_UBASE               cur_block;
-UINT                   bit, exp_size;
+UINT                   bit, i;
+UINT                   window, window_bits, window_max;
 NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
 
     /* Adjust sizes before performing the calculation. */
@@ -2644,9 +3141,45 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
     _nx_crypto_huge_number_inverse_modulus(&m0, &radix, &mi, scratch);
     mm_buffer[0] = (HN_UBASE)(HN_RADIX - mm_buffer[0]);
 
+    /* Locate the most significant set bit of the exponent.  Leading zero bits are skipped rather
+       than squaring the Montgomery form of one for each of them.  */
+    bit = e -> nx_crypto_huge_number_size * HN_SHIFT;
+    while ((bit > 0) && (HN_BIT(e, bit - 1) == 0))
+    {
+        bit--;
+    }
+
+    /* Pick the window size from the length of the exponent.  Short public exponents such as 65537
+       gain nothing from a table of powers.  */
+    if (bit > 671)
+    {
+        window_max = 6;
+    }
+    else if (bit > 239)
+    {
+        window_max = 5;
+    }
+    else if (bit > 79)
+    {
+        window_max = 4;
+    }
+    else if (bit > 23)
+    {
+        window_max = 3;
+    }
+    else
+    {
+        window_max = 1;
+    }
+    if (window_max > NX_CRYPTO_HUGE_NUMBER_WINDOW_BITS)
+    {
+        window_max = NX_CRYPTO_HUGE_NUMBER_WINDOW_BITS;
+    }
+
     /* Set buffers. */
-    /* Buffer usage: 2 * buffer_size of m + 8 */
-    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&xx, scratch, m -> nx_crypto_huge_buffer_size + sizeof(HN_UBASE));
+    /* Buffer usage: 2 * buffer_size of m + 8, plus (2 ^ (window_max - 1) - 1) * (buffer_size of m + 4)
+       for the table of odd powers (NX_CRYPTO_HUGE_NUMBER_WINDOW_SCRATCH_SIZE at most). */
+    NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&table[0], scratch, m -> nx_crypto_huge_buffer_size + sizeof(HN_UBASE));
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&temp, scratch, m -> nx_crypto_huge_buffer_size + sizeof(HN_UBASE));
     NX_CRYPTO_HUGE_NUMBER_INITIALIZE_DIGIT(&digit, &digit_value, 1);
 
@@ -2659,53 +3192,84 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
     val[m_len] = 1;
     _nx_crypto_huge_number_modulus(&temp, m);
 
-    /* xx = mont(x, radix ^ (2 * m_len) mod m)*/
+    /* table[0] = xx = mont(x, radix ^ (2 * m_len) mod m)*/
     _nx_crypto_huge_number_square(&temp, result);
     _nx_crypto_huge_number_modulus(result, m);
-    _nx_crypto_huge_number_mont(m, mm_buffer[0], x, result, &xx);
+    _nx_crypto_huge_number_mont(m, mm_buffer[0], x, result, &table[0]);
 
     /* result = x' */
     NX_CRYPTO_HUGE_NUMBER_COPY(result, &temp);
 
-    /* Clear out the result since we need it to start with a simple value. */
+    /* table[i] = xx ^ (2 * i + 1), built with temp = xx ^ 2. */
+    if (window_max > 1)
+    {
+        _nx_crypto_huge_number_mont_square(m, mm_buffer[0], &table[0], &temp);
+        for (i = 1; i < (1u << (window_max - 1)); i++)
+        {
+            NX_CRYPTO_HUGE_NUMBER_INITIALIZE(&table[i], scratch, m -> nx_crypto_huge_buffer_size + sizeof(HN_UBASE));
+            _nx_crypto_huge_number_mont(m, mm_buffer[0], &table[i - 1], &temp, &table[i]);
+        }
+    }
 
     operand = result;
     temp_result = &temp;
 
-    exp_size = e -> nx_crypto_huge_number_size;
-    m -> nx_crypto_huge_number_size = m -> nx_crypto_huge_number_size;
-    val = e -> nx_crypto_huge_number_data + (exp_size - 1);
-
-    /* Loop through the bits of the exponent. For each bit set, multiply the result by the running square. */
-    for (; (ULONG)val >= (ULONG)(e -> nx_crypto_huge_number_data); val--)
+    /* Scan the exponent from the most significant bit.  A zero bit costs a square; otherwise the
+       longest window of up to window_max bits ending in a set bit costs one square per bit and a
+       single multiplication by the matching odd power.  The first window needs no square at all.  */
+    if (bit > 0)
     {
-        /* Current byte in the exponent determines whether we multiply or not. */
-        cur_block = *val;
-
-        /* Loop over the bits in the current byte to see whether we add or not. */
-        for (bit = 0; bit < HN_SHIFT; bit++)
+        window_bits = (bit < window_max) ? bit : window_max;
+        while (HN_BIT(e, bit - window_bits) == 0)
+        {
+            window_bits--;
+        }
+        window = 0;
+        for (i = 1; i <= window_bits; i++)
         {
+            window = (window << 1) | HN_BIT(e, bit - i);
+        }
+        bit -= window_bits;
+        NX_CRYPTO_HUGE_NUMBER_COPY(operand, &table[window >> 1]);
+    }
 
-            /* A non-zero bit means we need to multiply. */
-            if (cur_block & (1u << (NX_CRYPTO_HUGE_NUMBER_BITS - (1 + bit))))
-            {
+    while (bit > 0)
+    {
+        if (HN_BIT(e, bit - 1) == 0)
+        {
 
-                /* result = mont(result, result) */
-                _nx_crypto_huge_number_mont(m, mm_buffer[0], operand, operand, temp_result);
+            /* result = mont(result, result) */
+            _nx_crypto_huge_number_mont_square(m, mm_buffer[0], operand, temp_result);
+            temp_swap = temp_result;
+            temp_result = operand;
+            operand = temp_swap;
+            bit--;
+            continue;
+        }
 
-                /* result = mont(result, xx) */
-                _nx_crypto_huge_number_mont(m, mm_buffer[0], temp_result, &xx, operand);
-            }
-            else
-            {
+        window_bits = (bit < window_max) ? bit : window_max;
+        while (HN_BIT(e, bit - window_bits) == 0)
+        {
+            window_bits--;
+        }
+        window = 0;
+        for (i = 1; i <= window_bits; i++)
+        {
+            window = (window << 1) | HN_BIT(e, bit - i);
 
-                /* result = mont(result, result) */
-                _nx_crypto_huge_number_mont(m, mm_buffer[0], operand, operand, temp_result);
-                temp_swap = temp_result;
-                temp_result = operand;
-                operand = temp_swap;
-            }
+            /* result = mont(result, result) */
+            _nx_crypto_huge_number_mont_square(m, mm_buffer[0], operand, temp_result);
+            temp_swap = temp_result;
+            temp_result = operand;
+            operand = temp_swap;
         }
+        bit -= window_bits;
+
+        /* result = mont(result, table[window / 2]) */
+        _nx_crypto_huge_number_mont(m, mm_buffer[0], operand, &table[window >> 1], temp_result);
+        temp_swap = temp_result;
+        temp_result = operand;
+        operand = temp_swap;
     }
 
     /* result = mont(result, 1) */
@@ -2737,7 +3301,9 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
 /*      1. m = p * q                                                      */
 /*      2. p and q are primes                                             */
 /*      3. scratch is required to be no less than 4 times of buffer size  */
-/*    of m plus 24 bytes.                                                 */
+/*    of m plus 24 bytes, plus the larger of                              */
+/*    NX_CRYPTO_HUGE_NUMBER_WINDOW_SCRATCH_SIZE and                       */
+/*    NX_CRYPTO_HUGE_NUMBER_KARATSUBA_SCRATCH_SIZE of buffer size of p.   */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -2766,6 +3332,9 @@ NX_CRYPTO_HUGE_NUMBER *operand, *temp_result, *temp_swap;
 /*    _nx_crypto_huge_number_subtract       Calculate subtraction for     */
 /*                                             huge numbers               */
 /*    _nx_crypto_huge_number_multiply       Multiply two huge numbers     */
+/*    _nx_crypto_huge_number_multiply_karatsuba                           */
+/*                                          Multiply two huge numbers     */
+/*                                            using Karatsuba             */
 /*    _nx_crypto_huge_number_modulus        Perform a modulus operation   */
 /*    _nx_crypto_huge_number_inverse_modulus_prime                        */
 /*                                          Perform an inverse modulus    */
@@ -2800,6 +3369,7 @@ NX_CRYPTO_HUGE_NUMBER  pi, qi;
 NX_CRYPTO_HUGE_NUMBER  temp1, temp2, temp3;
 NX_CRYPTO_HUGE_NUMBER  digit;
 HN_UBASE               digit_value;
+HN_UBASE              *karatsuba_scratch;
 
     /*****************************************
      * ep = e mod (p - 1)
@@ -2853,7 +3423,10 @@ HN_UBASE               digit_value;
     _nx_crypto_huge_number_mont_power_modulus(xp, ep, p, m1, scratch);
 
     /* m1 * qi * q */
-    _nx_crypto_huge_number_multiply(&qi, m1, &temp3);
+    /* The product of qi and m1 spills past temp3 by the buffer size of p.
+       Buffer usage: NX_CRYPTO_HUGE_NUMBER_KARATSUBA_SCRATCH_SIZE of buffer size of p after that. */
+    karatsuba_scratch = scratch + (p -> nx_crypto_huge_buffer_size >> HN_SIZE_SHIFT);
+    _nx_crypto_huge_number_multiply_karatsuba(&qi, m1, &temp3, karatsuba_scratch);
     _nx_crypto_huge_number_multiply(&temp3, q, result);
 
 
@@ -2877,7 +3450,7 @@ HN_UBASE               digit_value;
     _nx_crypto_huge_number_mont_power_modulus(xq, eq, q, m2, scratch);
 
     /* pi * p * m2 */
-    _nx_crypto_huge_number_multiply(&pi, m2, &temp3);
+    _nx_crypto_huge_number_multiply_karatsuba(&pi, m2, &temp3, karatsuba_scratch);
 
     /* Buffer of temp2 is not used anymore. It is used by temp1.
      * So buffer length of temp1 is 1.5 * buffer length of m.
@@ -132,25 +132,27 @@ NX_CRYPTO_METHOD *hash_method = phash -> nx_crypto_hmac_method;
     NX_CRYPTO_MEMCPY(temp_A, seed, seed_len); /* Use case of memcpy is verified. */
     A_len = phash -> nx_crypto_phash_seed_length;
 
+    /* Initialize the HMAC once, so the hash states of the secret computed by the first
+       HMAC are reused by all the following ones.  */
+    if (hash_method -> nx_crypto_init)
+    {
+        status = hash_method -> nx_crypto_init(hash_method,
+                                      secret,
+                                      (NX_CRYPTO_KEY_SIZE)(secret_len << 3),
+                                      &handler,
+                                      metadata,
+                                      metadata_size);
+
+        if(status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }                                                     
+    }
+
     remaining_len = desired_length;
     for (offset = 0; offset < desired_length; offset += hash_size)
     {
         /* Calculate A(i) */
-        if (hash_method -> nx_crypto_init)
-        {
-            status = hash_method -> nx_crypto_init(hash_method,
-                                          secret,
-                                          (NX_CRYPTO_KEY_SIZE)(secret_len << 3),
-                                          &handler,
-                                          metadata,
-                                          metadata_size);
-
-            if(status != NX_CRYPTO_SUCCESS)
-            {
-                return(status);
-            }                                                     
-        }
-
         status = hash_method -> nx_crypto_operation(NX_CRYPTO_AUTHENTICATE,
                                            handler,
                                            hash_method,
@@ -222,14 +224,9 @@ NX_CRYPTO_METHOD *hash_method = phash -> nx_crypto_hmac_method;
 
         /* Adjust our remaining length by the number of bytes written. */
         remaining_len -= hash_size;
-
-        status = hash_method -> nx_crypto_cleanup(metadata);
-
-        if(status != NX_CRYPTO_SUCCESS)
-        {
-            return(status);
-        }                                                     
     }
 
-    return(NX_CRYPTO_SUCCESS);
+    status = hash_method -> nx_crypto_cleanup(metadata);
+
+    return(status);
 }
@@ -37,8 +37,8 @@ const ULONG _sha2_round_constants[64] =
 
 
 /* Define the SHA2 logic functions.  */
-#define CH_FUNC(x, y, z)           (((x) & (y)) ^ ((~(x)) & (z)))
-#define MAJ_FUNC(x, y, z)          (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define CH_FUNC(x, y, z)           ((z) ^ ((x) & ((y) ^ (z))))
+#define MAJ_FUNC(x, y, z)          (((x) & (y)) | ((z) & ((x) | (y))))
 
 #define RIGHT_SHIFT_CIRCULAR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
 #define LARGE_SIGMA_0(x)           (RIGHT_SHIFT_CIRCULAR((x),  2) ^ RIGHT_SHIFT_CIRCULAR((x), 13) ^ RIGHT_SHIFT_CIRCULAR((x), 22))
@@ -46,6 +46,33 @@ const ULONG _sha2_round_constants[64] =
 #define SMALL_SIGMA_0(x)           (RIGHT_SHIFT_CIRCULAR((x),  7) ^ RIGHT_SHIFT_CIRCULAR((x), 18) ^ ((x) >> 3))
 #define SMALL_SIGMA_1(x)           (RIGHT_SHIFT_CIRCULAR((x), 17) ^ RIGHT_SHIFT_CIRCULAR((x), 19) ^ ((x) >> 10))
 
+/* Define the rolling message schedule. Only the last 16 words are kept, word t
+   overwrites word t - 16 in place.  */
+#define SCHEDULE_WORD(w, t)        ((w)[(t) & 15] += SMALL_SIGMA_1((w)[((t) - 2) & 15]) + (w)[((t) - 7) & 15] + \
+                                                     SMALL_SIGMA_0((w)[((t) - 15) & 15]))
+
+/* Define one round. Instead of shifting the eight working variables, the callers
+   rotate the argument order so that each round only updates d and h.  */
+#define ROUND(a, b, c, d, e, f, g, h, k, x)                                   \
+    temp1 = (h) + LARGE_SIGMA_1(e) + CH_FUNC(e, f, g) + (k) + (x);             \
+    (d) += temp1;                                                             \
+    (h) = temp1 + LARGE_SIGMA_0(a) + MAJ_FUNC(a, b, c);
+
+/* Define eight rounds starting at round t, after which the working variables
+   are back in their original positions.  */
+#define ROUNDS_8(t, x)                                                        \
+    ROUND(a, b, c, d, e, f, g, h, _sha2_round_constants[(t)],     x((t)));     \
+    ROUND(h, a, b, c, d, e, f, g, _sha2_round_constants[(t) + 1], x((t) + 1)); \
+    ROUND(g, h, a, b, c, d, e, f, _sha2_round_constants[(t) + 2], x((t) + 2)); \
+    ROUND(f, g, h, a, b, c, d, e, _sha2_round_constants[(t) + 3], x((t) + 3)); \
+    ROUND(e, f, g, h, a, b, c, d, _sha2_round_constants[(t) + 4], x((t) + 4)); \
+    ROUND(d, e, f, g, h, a, b, c, _sha2_round_constants[(t) + 5], x((t) + 5)); \
+    ROUND(c, d, e, f, g, h, a, b, _sha2_round_constants[(t) + 6], x((t) + 6)); \
+    ROUND(b, c, d, e, f, g, h, a, _sha2_round_constants[(t) + 7], x((t) + 7));
+
+#define MESSAGE_WORD(t)            w[(t)]
+#define EXPANDED_WORD(t)           SCHEDULE_WORD(w, (t))
+
 /* Define the padding array.  This is used to pad the message such that its length is
    64 bits shy of being a multiple of 512 bits long.  */
 const UCHAR   _nx_crypto_sha256_padding[64] = {0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
@@ -167,6 +194,8 @@ NX_CRYPTO_KEEP UINT  _nx_crypto_sha256_initialize(NX_CRYPTO_SHA256 *context, UIN
 /*                                                                        */
 /*    _nx_crypto_sha256_process_buffer      Process complete buffer       */
 /*                                            using SHA256                */
+/*    _nx_crypto_sha256_process_blocks      Process complete blocks       */
+/*                                            using SHA256                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -241,16 +270,16 @@ ULONG needed_fill_bytes;
         current_bytes =  0;
     }
 
-    /* Process any and all whole blocks of input.  */
-    while (input_length >= 64)
+    /* Process any and all whole blocks of input directly from the caller's buffer.  */
+    if (input_length >= 64)
     {
 
-        /* Process this 64-byte (512 bit) buffer.  */
-        _nx_crypto_sha256_process_buffer(context, input_ptr);
+        /* Process all the 64-byte (512 bit) blocks in one call.  */
+        _nx_crypto_sha256_process_blocks(context, input_ptr, input_length >> 6);
 
         /* Adjust the pointers and length accordingly.  */
-        input_length =  input_length - 64;
-        input_ptr =     input_ptr + 64;
+        input_ptr =     input_ptr + (input_length & ~((UINT)0x3F));
+        input_length =  input_length & 0x3F;
     }
 
     /* Determine if there is anything left.  */
@@ -413,7 +442,8 @@ ULONG padding_bytes;
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _nx_crypto_sha256_process_blocks      Process complete blocks       */
+/*                                            using SHA256                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -431,69 +461,160 @@ ULONG padding_bytes;
 /**************************************************************************/
 NX_CRYPTO_KEEP VOID _nx_crypto_sha256_process_buffer(NX_CRYPTO_SHA256 *context, UCHAR buffer[64])
 {
-ULONG *w;
-UINT   t;
-ULONG  temp1, temp2;
-ULONG  a, b, c, d, e, f, g, h;
 
+    /* Process the single 64-byte (512 bit) block.  */
+    _nx_crypto_sha256_process_blocks(context, buffer, 1);
+}
 
-    /* Setup pointers to the word array.  */
-    w =  context -> nx_sha256_word_array;
 
-    /* Initialize the first 16 words of the word array, taking care of the
-       endian issues at the same time.  */
-    for (t = 0; t < 16; t++)
-    {
-        /* Setup each entry.  */
-        w[t] =  (((ULONG)buffer[t * 4]) << 24) | (((ULONG)buffer[(t * 4) + 1]) << 16) | (((ULONG)buffer[(t * 4) + 2]) << 8) | ((ULONG)buffer[(t * 4) + 3]);
-    }
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_crypto_sha256_process_blocks                    PORTABLE C      */
+/*                                                           6.1          */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function runs the SHA256 compression function over a number   */
+/*    of consecutive 64-byte (512-bit) blocks. The state is loaded once   */
+/*    for all the blocks and the message schedule is kept as a rolling    */
+/*    16 word window on the stack, so no per-context word array is        */
+/*    needed. Word aligned input is read a word at a time when the        */
+/*    target is little endian and provides a byte reverse operation.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    context                               SHA256 context pointer        */
+/*    buffer                                Pointer to the input blocks   */
+/*    blocks                                Number of 64-byte blocks      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_crypto_sha256_update              Update the digest             */
+/*    _nx_crypto_sha256_process_buffer      Process complete buffer       */
+/*                                            using SHA256                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+NX_CRYPTO_KEEP VOID _nx_crypto_sha256_process_blocks(NX_CRYPTO_SHA256 *context, UCHAR *buffer, UINT blocks)
+{
+ULONG  w[16];
+UINT   t;
+ULONG  temp1;
+ULONG  a, b, c, d, e, f, g, h;
+ULONG  h0, h1, h2, h3, h4, h5, h6, h7;
+#if defined(NX_CRYPTO_LITTLE_ENDIAN) && defined(NX_CRYPTO_CHANGE_ULONG_ENDIAN)
+UINT   word_aligned;
+#endif /* NX_CRYPTO_LITTLE_ENDIAN && NX_CRYPTO_CHANGE_ULONG_ENDIAN */
+
+
+    /* Load the state once for all the blocks.  */
+    h0 =  context -> nx_sha256_states[0];
+    h1 =  context -> nx_sha256_states[1];
+    h2 =  context -> nx_sha256_states[2];
+    h3 =  context -> nx_sha256_states[3];
+    h4 =  context -> nx_sha256_states[4];
+    h5 =  context -> nx_sha256_states[5];
+    h6 =  context -> nx_sha256_states[6];
+    h7 =  context -> nx_sha256_states[7];
+
+#if defined(NX_CRYPTO_LITTLE_ENDIAN) && defined(NX_CRYPTO_CHANGE_ULONG_ENDIAN)
+#ifdef NX_CRYPTO_ENABLE_UNALIGNED_ACCESS
+    word_aligned = 1;
+#else
+    /* Blocks are 64 bytes long, so the alignment of the first one holds for all of them.  */
+    word_aligned = ((((ALIGN_TYPE)buffer) & 0x3) == 0);
+#endif /* NX_CRYPTO_ENABLE_UNALIGNED_ACCESS */
+#endif /* NX_CRYPTO_LITTLE_ENDIAN && NX_CRYPTO_CHANGE_ULONG_ENDIAN */
 
-    /* Setup the remaining entries of the word array.  */
-    for (t = 16; t < 64; t++)
+    while (blocks--)
     {
-        /* Setup each entry.  */
-        w[t] =  SMALL_SIGMA_1(w[t - 2]) + w[t - 7] + SMALL_SIGMA_0(w[t - 15]) + w[t - 16];
-    }
 
-    /* Initialize the state variables.  */
-    a =  context -> nx_sha256_states[0];
-    b =  context -> nx_sha256_states[1];
-    c =  context -> nx_sha256_states[2];
-    d =  context -> nx_sha256_states[3];
-    e =  context -> nx_sha256_states[4];
-    f =  context -> nx_sha256_states[5];
-    g =  context -> nx_sha256_states[6];
-    h =  context -> nx_sha256_states[7];
-
-    /* Now, perform Round operations.  */
-    for (t = 0; t < 64; t++)
-    {
-        temp1 = h + LARGE_SIGMA_1(e) + CH_FUNC(e, f, g) + _sha2_round_constants[t] + w[t];
-        temp2 = LARGE_SIGMA_0(a) + MAJ_FUNC(a, b, c);
-        h = g;
-        g = f;
-        f = e;
-        e = d + temp1;
-        d = c;
-        c = b;
-        b = a;
-        a = temp1 + temp2;
+        /* Load the 16 message words, taking care of the endian issues at the same time.  */
+#if defined(NX_CRYPTO_LITTLE_ENDIAN) && defined(NX_CRYPTO_CHANGE_ULONG_ENDIAN)
+        if (word_aligned)
+        {
+            for (t = 0; t < 16; t++)
+            {
+                w[t] = ((ULONG *)buffer)[t];
+                NX_CRYPTO_CHANGE_ULONG_ENDIAN(w[t]);
+            }
+        }
+        else
+#endif /* NX_CRYPTO_LITTLE_ENDIAN && NX_CRYPTO_CHANGE_ULONG_ENDIAN */
+        {
+            for (t = 0; t < 16; t++)
+            {
+                w[t] =  (((ULONG)buffer[t * 4]) << 24) | (((ULONG)buffer[(t * 4) + 1]) << 16) | (((ULONG)buffer[(t * 4) + 2]) << 8) | ((ULONG)buffer[(t * 4) + 3]);
+            }
+        }
+
+        /* Initialize the state variables.  */
+        a =  h0;
+        b =  h1;
+        c =  h2;
+        d =  h3;
+        e =  h4;
+        f =  h5;
+        g =  h6;
+        h =  h7;
+
+        /* The first 16 rounds use the message words directly.  */
+        ROUNDS_8(0, MESSAGE_WORD);
+        ROUNDS_8(8, MESSAGE_WORD);
+
+        /* The remaining rounds expand the schedule in place as they go.  */
+        for (t = 16; t < 64; t += 8)
+        {
+            ROUNDS_8(t, EXPANDED_WORD);
+        }
+
+        /* Add this block's result to the intermediate hash value.  */
+        h0 +=  a;
+        h1 +=  b;
+        h2 +=  c;
+        h3 +=  d;
+        h4 +=  e;
+        h5 +=  f;
+        h6 +=  g;
+        h7 +=  h;
+
+        buffer += 64;
     }
 
     /* Save the resulting in this SHA256 context.  */
-    context -> nx_sha256_states[0] +=  a;
-    context -> nx_sha256_states[1] +=  b;
-    context -> nx_sha256_states[2] +=  c;
-    context -> nx_sha256_states[3] +=  d;
-    context -> nx_sha256_states[4] +=  e;
-    context -> nx_sha256_states[5] +=  f;
-    context -> nx_sha256_states[6] +=  g;
-    context -> nx_sha256_states[7] +=  h;
+    context -> nx_sha256_states[0] =  h0;
+    context -> nx_sha256_states[1] =  h1;
+    context -> nx_sha256_states[2] =  h2;
+    context -> nx_sha256_states[3] =  h3;
+    context -> nx_sha256_states[4] =  h4;
+    context -> nx_sha256_states[5] =  h5;
+    context -> nx_sha256_states[6] =  h6;
+    context -> nx_sha256_states[7] =  h7;
 
 #ifdef NX_SECURE_KEY_CLEAR
     a = 0; b = 0; c = 0; d = 0;
     e = 0; f = 0; g = 0; h = 0;
-    temp1 = 0; temp2 = 0;
+    temp1 = 0;
+    NX_CRYPTO_MEMSET(w, 0, sizeof(w));
 #endif /* NX_SECURE_KEY_CLEAR  */
 }
 
@@ -160,6 +160,30 @@ extern   "C" {
    #define NX_SECURE_TLS_REQUIRE_RENEGOTIATION_EXT
  */
 
+/* Configuration macro: disable client-side resumption of TLS 1.0-1.2 sessions by
+   session ID (RFC 5246, Section 7.3). When enabled, the application registers an
+   NX_SECURE_TLS_SESSION_RESUMPTION entry that is filled in after a full handshake
+   and offered in the ClientHello of later connections to the same server.
+   #define NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+ */
+
+/* Configuration macro: disable client-side negotiation of the TLS 1.0-1.2
+   max_fragment_length extension (RFC 6066, Section 4). When enabled, the application
+   may ask the server to keep records at or below 512, 1024, 2048 or 4096 bytes so
+   smaller receive buffers can be used. Once the server agrees, longer sends are split
+   into records of that length and a longer record from the server is refused with a
+   record_overflow alert.
+   #define NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+ */
+
+/* Configuration macro: decrypt incoming application data records as their TCP packets
+   arrive instead of after the whole record has been queued. Received ciphertext is
+   released as it is decrypted, so a record no longer holds its ciphertext and its
+   plaintext at the same time. The AEAD tag or CBC MAC is still checked before any data
+   is returned. Not used for TLS 1.0 or for DTLS.
+   #define NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+ */
+
 /* API return values.  */
 
 #define NX_SECURE_TLS_SUCCESS                           0x00        /* Function returned successfully. */
@@ -248,6 +272,7 @@ extern   "C" {
 #define NX_SECURE_TLS_RECORD_OVERFLOW                   0x151       /* Received a TLSCiphertext record that had a length too long. */
 #define NX_SECURE_TLS_HANDSHAKE_FRAGMENT_RECEIVED       0x152       /* Received a fragmented handshake message - take appropriate action at a higher level of the state machine. */
 #define NX_SECURE_TLS_TRANSMIT_LOCKED                   0x153       /* Another thread is transmitting. */
+#define NX_SECURE_TLS_BAD_MAX_FRAGMENT_LENGTH           0x154       /* The server answered with a max_fragment_length value that was not requested. */
 
 /* NX_CONTINUE is a symbol defined in NetX Duo 5.10.  For backward compatibility, this symbol is defined here */
 #if ((__NETXDUO_MAJOR_VERSION__ == 5) && (__NETXDUO_MINOR_VERSION__ == 9))
@@ -618,6 +643,7 @@ typedef struct NX_SECURE_VERSIONS_LIST_STRUCT
 #define NX_SECURE_TLS_MAX_KEY_SIZE                         (32)  /* Maximum size of a session key in bytes. */
 #define NX_SECURE_TLS_MAX_IV_SIZE                          (16)  /* Maximum size of a session initialization vector in bytes. */
 #define NX_SECURE_TLS_SESSION_ID_SIZE                      (256) /* Maximum size of a session ID value used for renegotiation in bytes. */
+#define NX_SECURE_TLS_RESUMPTION_SESSION_ID_SIZE           (32)  /* Maximum size of a session ID a TLS 1.0-1.2 server may issue for resumption. */
 #define NX_SECURE_TLS_SEQUENCE_NUMBER_SIZE                 (2)   /* Size of sequence numbers for TLS records in 32-bit words. */
 #define NX_SECURE_TLS_RECORD_HEADER_SIZE                   (5)   /* Size of the TLS record header in bytes. */
 #define NX_SECURE_TLS_HANDSHAKE_HEADER_SIZE                (4)   /* Size of the TLS handshake record header in bytes. */
@@ -1052,6 +1078,28 @@ typedef struct NX_SECURE_TLS_HELLO_EXTENSION_STRUCT
     const UCHAR *nx_secure_tls_extension_data;
 } NX_SECURE_TLS_HELLO_EXTENSION;
 
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+/* Resumption state of a TLS 1.0-1.2 session, owned by the application so it can outlive
+   the NX_SECURE_TLS_SESSION (and be persisted across reboots if desired). TLS fills the
+   entry in at the end of each full handshake and offers it in the next ClientHello. */
+typedef struct NX_SECURE_TLS_SESSION_RESUMPTION_STRUCT
+{
+    /* Session ID issued by the server. A zero length marks the entry as empty. */
+    UCHAR  nx_secure_tls_resumption_session_id[NX_SECURE_TLS_RESUMPTION_SESSION_ID_SIZE];
+    UINT   nx_secure_tls_resumption_session_id_length;
+
+    /* Master secret of the session the ID refers to. */
+    UCHAR  nx_secure_tls_resumption_master_secret[NX_SECURE_TLS_MASTER_SIZE];
+
+    /* Ciphersuite and protocol version the session was negotiated with. */
+    USHORT nx_secure_tls_resumption_ciphersuite;
+    USHORT nx_secure_tls_resumption_protocol_version;
+
+    /* Value of the session time function when the full handshake completed, 0 without one. */
+    ULONG  nx_secure_tls_resumption_time;
+} NX_SECURE_TLS_SESSION_RESUMPTION;
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
+
 
 /* Definition of the top-level TLS session control block used by the application. */
 typedef struct NX_SECURE_TLS_SESSION_STRUCT
@@ -1066,6 +1114,18 @@ typedef struct NX_SECURE_TLS_SESSION_STRUCT
     NX_PACKET *nx_secure_record_queue_header;
     NX_PACKET *nx_secure_record_decrypted_packet;
 
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+    /* Data decrypted so far from a record whose ciphertext has been partly released. */
+    NX_PACKET *nx_secure_record_stream_packet;
+
+    /* Bytes of the current record not yet received, or 0 if no record is in progress. */
+    UINT       nx_secure_record_stream_length;
+
+    /* Header of the record in progress, needed for the MAC check. */
+    UCHAR      nx_secure_record_stream_header[NX_SECURE_TLS_RECORD_HEADER_SIZE];
+    USHORT     nx_secure_record_stream_header_length;
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
+
     /* Packet pool used by TLS stack to allocate outgoing packets used in TLS handshake. */
     NX_PACKET_POOL *nx_secure_tls_packet_pool;
 
@@ -1115,6 +1175,23 @@ typedef struct NX_SECURE_TLS_SESSION_STRUCT
     /* Session ID used for session re-negotiation. */
     UCHAR nx_secure_tls_session_id[NX_SECURE_TLS_SESSION_ID_SIZE];
 
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+    /* Application-owned resumption entry offered in the ClientHello and updated
+       after each full handshake. */
+    NX_SECURE_TLS_SESSION_RESUMPTION *nx_secure_tls_session_resumption_ptr;
+
+    /* Set when the server accepted the offered session ID (abbreviated handshake). */
+    UCHAR nx_secure_tls_session_resumed;
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
+
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+    /* The max_fragment_length code (1-4) offered in the ClientHello, 0 if none. */
+    UCHAR  nx_secure_tls_max_fragment_length_code;
+
+    /* The plaintext record length limit agreed with the server, 0 if none was negotiated. */
+    USHORT nx_secure_tls_max_fragment_length;
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+
 #ifndef NX_SECURE_TLS_DISABLE_SECURE_RENEGOTIATION
     /* This flag indicates whether the remote host supports secure renegotiation
        as indicated in the initial Hello messages (SCSV or the renegotiation
@@ -1417,10 +1494,19 @@ UINT _nx_secure_tls_record_payload_decrypt(NX_SECURE_TLS_SESSION *tls_session, N
                                            UINT offset, UINT message_length, NX_PACKET **decrypted_packet,
                                            ULONG sequence_num[NX_SECURE_TLS_SEQUENCE_NUMBER_SIZE],
                                            UCHAR record_type, UINT wait_option);                                           
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+UINT _nx_secure_tls_record_payload_decrypt_stream(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *encrypted_packet,
+                                                  UINT offset, UINT available_length, UINT message_length,
+                                                  NX_PACKET **decrypted_packet,
+                                                  ULONG sequence_num[NX_SECURE_TLS_SEQUENCE_NUMBER_SIZE],
+                                                  UCHAR record_type, UINT *bytes_processed, UINT wait_option);
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
 UINT _nx_secure_tls_record_payload_encrypt(NX_SECURE_TLS_SESSION *tls_session,
                                            NX_PACKET *send_packet,
                                            ULONG sequence_num[NX_SECURE_TLS_SEQUENCE_NUMBER_SIZE],
                                            UCHAR record_type);
+UINT _nx_secure_tls_record_payload_hash_encrypt(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet,
+                                                UCHAR *record_header, USHORT iv_size, ULONG wait_option);
 UINT _nx_secure_tls_remote_certificate_free(NX_SECURE_TLS_SESSION *tls_session,
                                             NX_SECURE_X509_DISTINGUISHED_NAME *name);
 UINT _nx_secure_tls_remote_certificate_verify(NX_SECURE_TLS_SESSION *tls_session);
@@ -1549,6 +1635,14 @@ UINT _nx_secure_tls_session_renegotiate(NX_SECURE_TLS_SESSION *tls_session,
 UINT _nx_secure_tls_session_renegotiate_callback_set(NX_SECURE_TLS_SESSION *tls_session,
                                                      ULONG (*func_ptr)(NX_SECURE_TLS_SESSION *session));
 UINT _nx_secure_tls_session_reset(NX_SECURE_TLS_SESSION *tls_session);
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+UINT _nx_secure_tls_session_max_fragment_length_get(NX_SECURE_TLS_SESSION *tls_session, UINT *max_fragment_length);
+UINT _nx_secure_tls_session_max_fragment_length_set(NX_SECURE_TLS_SESSION *tls_session, UINT max_fragment_length);
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+UINT _nx_secure_tls_session_resumption_set(NX_SECURE_TLS_SESSION *tls_session,
+                                           NX_SECURE_TLS_SESSION_RESUMPTION *resumption_entry);
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
 UINT _nx_secure_tls_session_send(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
                                  ULONG wait_option);
 UINT _nx_secure_tls_session_server_callback_set(NX_SECURE_TLS_SESSION *tls_session,
@@ -1641,6 +1735,14 @@ UINT _nxe_secure_tls_session_renegotiate(NX_SECURE_TLS_SESSION *tls_session,
 UINT _nxe_secure_tls_session_renegotiate_callback_set(NX_SECURE_TLS_SESSION *tls_session,
                                                       ULONG (*func_ptr)(NX_SECURE_TLS_SESSION *session));
 UINT _nxe_secure_tls_session_reset(NX_SECURE_TLS_SESSION *tls_session);
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+UINT _nxe_secure_tls_session_max_fragment_length_get(NX_SECURE_TLS_SESSION *tls_session, UINT *max_fragment_length);
+UINT _nxe_secure_tls_session_max_fragment_length_set(NX_SECURE_TLS_SESSION *tls_session, UINT max_fragment_length);
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+UINT _nxe_secure_tls_session_resumption_set(NX_SECURE_TLS_SESSION *tls_session,
+                                            NX_SECURE_TLS_SESSION_RESUMPTION *resumption_entry);
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
 UINT _nxe_secure_tls_session_send(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
                                   ULONG wait_option);
 UINT _nxe_secure_tls_session_server_callback_set(NX_SECURE_TLS_SESSION *tls_session,
@@ -1689,6 +1791,12 @@ TLS_DECLARE  NX_SECURE_TLS_SESSION *_nx_secure_tls_created_ptr;
 TLS_DECLARE  ULONG    _nx_secure_tls_created_count;
 TLS_DECLARE  TX_MUTEX _nx_secure_tls_protection;
 
+#ifndef NX_SECURE_X509_DISABLE_VERIFIED_CACHE
+/* Define the verified certificate cache shared by all TLS sessions, protected by _nx_secure_tls_protection.  */
+TLS_DECLARE  NX_SECURE_X509_VERIFIED_CACHE_ENTRY _nx_secure_x509_verified_cache[NX_SECURE_X509_VERIFIED_CACHE_SIZE];
+TLS_DECLARE  UINT     _nx_secure_x509_verified_cache_next;
+#endif /* NX_SECURE_X509_DISABLE_VERIFIED_CACHE */
+
 #ifdef __cplusplus
 }
 #endif
@@ -99,6 +99,13 @@ extern   "C" {
 #define nx_secure_tls_session_renegotiate                  _nx_secure_tls_session_renegotiate
 #define nx_secure_tls_session_renegotiate_callback_set     _nx_secure_tls_session_renegotiate_callback_set
 #define nx_secure_tls_session_reset                        _nx_secure_tls_session_reset
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+#define nx_secure_tls_session_max_fragment_length_get      _nx_secure_tls_session_max_fragment_length_get
+#define nx_secure_tls_session_max_fragment_length_set      _nx_secure_tls_session_max_fragment_length_set
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+#define nx_secure_tls_session_resumption_set               _nx_secure_tls_session_resumption_set
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
 #define nx_secure_tls_session_send                         _nx_secure_tls_session_send
 #define nx_secure_tls_session_server_callback_set          _nx_secure_tls_session_server_callback_set
 #define nx_secure_tls_session_sni_extension_parse          _nx_secure_tls_session_sni_extension_parse
@@ -141,6 +148,13 @@ extern   "C" {
 #define nx_secure_tls_session_renegotiate                  _nxe_secure_tls_session_renegotiate
 #define nx_secure_tls_session_renegotiate_callback_set     _nxe_secure_tls_session_renegotiate_callback_set
 #define nx_secure_tls_session_reset                        _nxe_secure_tls_session_reset
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+#define nx_secure_tls_session_max_fragment_length_get      _nxe_secure_tls_session_max_fragment_length_get
+#define nx_secure_tls_session_max_fragment_length_set      _nxe_secure_tls_session_max_fragment_length_set
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+#define nx_secure_tls_session_resumption_set               _nxe_secure_tls_session_resumption_set
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
 #define nx_secure_tls_session_send                         _nxe_secure_tls_session_send
 #define nx_secure_tls_session_server_callback_set          _nxe_secure_tls_session_server_callback_set
 #define nx_secure_tls_session_sni_extension_parse          _nxe_secure_tls_session_sni_extension_parse
@@ -226,6 +240,14 @@ UINT nx_secure_tls_session_renegotiate(NX_SECURE_TLS_SESSION *tls_session, UINT
 UINT nx_secure_tls_session_renegotiate_callback_set(NX_SECURE_TLS_SESSION *tls_session,
                                                     ULONG (*func_ptr)(NX_SECURE_TLS_SESSION *session));
 UINT nx_secure_tls_session_reset(NX_SECURE_TLS_SESSION *tls_session);
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+UINT nx_secure_tls_session_max_fragment_length_get(NX_SECURE_TLS_SESSION *tls_session, UINT *max_fragment_length);
+UINT nx_secure_tls_session_max_fragment_length_set(NX_SECURE_TLS_SESSION *tls_session, UINT max_fragment_length);
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+UINT nx_secure_tls_session_resumption_set(NX_SECURE_TLS_SESSION *tls_session,
+                                          NX_SECURE_TLS_SESSION_RESUMPTION *resumption_entry);
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
 UINT nx_secure_tls_session_send(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
                                 ULONG wait_option);
 UINT nx_secure_tls_session_server_callback_set(NX_SECURE_TLS_SESSION *tls_session,
@@ -82,6 +82,18 @@ extern   "C" {
 #define NX_SECURE_X509_CERTIFICATE_INITIALIZE_EXTENSION
 #endif /* NX_SECURE_X509_CERTIFICATE_INITIALIZE_EXTENSION */
 
+/* Define the number of issuer/subject certificate pairs whose signature verification result is cached,
+   so repeat handshakes presenting the same chain skip the public-key operations. The cache is keyed by
+   a SHA-256 fingerprint of both certificates and guarded by the TLS protection mutex. Entries are dropped
+   once either certificate is outside its validity period; lookups made without a current time (such as
+   CRL checks, or sessions without a time function) do not age entries, which then stay until replaced.
+   Define NX_SECURE_X509_DISABLE_VERIFIED_CACHE to disable it. */
+#ifndef NX_SECURE_X509_VERIFIED_CACHE_SIZE
+#define NX_SECURE_X509_VERIFIED_CACHE_SIZE                        4
+#endif /* NX_SECURE_X509_VERIFIED_CACHE_SIZE */
+
+#define NX_SECURE_X509_VERIFIED_CACHE_FINGERPRINT_SIZE            32
+
 /* Return values for X509 errors. */
 #define NX_SECURE_X509_SUCCESS                                    0     /* Successful return status. */
 #define NX_SECURE_X509_MULTIBYTE_TAG_UNSUPPORTED                  0x181 /* We encountered a multi-byte ASN.1 tag - not currently supported. */
@@ -677,6 +689,9 @@ typedef struct NX_SECURE_X509_CERT_STRUCT
     /* X509 subject - Distinguished Name of the certificate. */
     NX_SECURE_X509_DISTINGUISHED_NAME nx_secure_x509_distinguished_name;
 
+    /* Hash of the subject distinguished name, set by _nx_secure_x509_certificate_parse. 0 if not set. */
+    ULONG nx_secure_x509_distinguished_name_hash;
+
     /* Pointer to lookup table for X.509 cryptographic routines. */
     NX_SECURE_X509_CRYPTO *nx_secure_x509_cipher_table;
 
@@ -831,6 +846,19 @@ typedef struct NX_SECURE_X509_CERTIFICATE_STORE_STRUCT
     NX_SECURE_X509_CERT *nx_secure_x509_certificate_exceptions;
 } NX_SECURE_X509_CERTIFICATE_STORE;
 
+#ifndef NX_SECURE_X509_DISABLE_VERIFIED_CACHE
+/* Entry of the verified certificate cache. A valid entry records that the signature of the subject
+   certificate has been verified against the public key of the issuer certificate. */
+typedef struct NX_SECURE_X509_VERIFIED_CACHE_ENTRY_STRUCT
+{
+    /* SHA-256 over the DER encoding of the subject certificate followed by that of the issuer. */
+    UCHAR nx_secure_x509_verified_cache_fingerprint[NX_SECURE_X509_VERIFIED_CACHE_FINGERPRINT_SIZE];
+
+    /* Non-zero if this entry is in use. */
+    UINT  nx_secure_x509_verified_cache_valid;
+} NX_SECURE_X509_VERIFIED_CACHE_ENTRY;
+#endif /* NX_SECURE_X509_DISABLE_VERIFIED_CACHE */
+
 /* Get certificate for local device. */
 UINT _nx_secure_x509_local_device_certificate_get(NX_SECURE_X509_CERTIFICATE_STORE *store,
                                                   NX_SECURE_X509_DISTINGUISHED_NAME *name,
@@ -856,6 +884,9 @@ UINT _nx_secure_x509_store_certificate_remove(NX_SECURE_X509_CERTIFICATE_STORE *
 INT _nx_secure_x509_distinguished_name_compare(NX_SECURE_X509_DISTINGUISHED_NAME *name,
                                                NX_SECURE_X509_DISTINGUISHED_NAME *compare_name, ULONG compare_fields);
 
+/* Hash a distinguished name for certificate list lookups. */
+ULONG _nx_secure_x509_distinguished_name_hash(NX_SECURE_X509_DISTINGUISHED_NAME *name);
+
 /* Parse an X.509 DER-encoded distinguished name. */
 UINT _nx_secure_x509_distinguished_name_parse(const UCHAR *buffer, UINT length,
                                               UINT *bytes_processed,
@@ -877,7 +908,15 @@ UINT _nx_secure_x509_certificate_verify(NX_SECURE_X509_CERTIFICATE_STORE *store,
 
 /* Verify a given certificate chain to see if the end-entity certificate can be traced through the chain to a trust anchor. */
 UINT _nx_secure_x509_certificate_chain_verify(NX_SECURE_X509_CERTIFICATE_STORE *store,
-                                              NX_SECURE_X509_CERT *certificate);
+                                              NX_SECURE_X509_CERT *certificate, ULONG current_time);
+
+#ifndef NX_SECURE_X509_DISABLE_VERIFIED_CACHE
+/* Look up and record issuer/subject certificate pairs whose signature is already verified. */
+UINT _nx_secure_x509_verified_cache_find(NX_SECURE_X509_CERT *certificate,
+                                         NX_SECURE_X509_CERT *issuer_certificate,
+                                         ULONG current_time, UCHAR *fingerprint);
+VOID _nx_secure_x509_verified_cache_add(const UCHAR *fingerprint);
+#endif /* NX_SECURE_X509_DISABLE_VERIFIED_CACHE */
 
 /* Parse an OID string, returning an internally-used constant (defined above) for use in other parsing. */
 VOID _nx_secure_x509_oid_parse(const UCHAR *oid, ULONG length, UINT *oid_value);
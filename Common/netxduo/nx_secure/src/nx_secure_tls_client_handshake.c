@@ -24,6 +24,9 @@
 
 #include "nx_secure_tls.h"
 
+#ifndef NX_SECURE_TLS_CLIENT_DISABLED
+static UINT _nx_secure_tls_client_handshake_hash_cleanup(NX_SECURE_TLS_SESSION *tls_session);
+#endif /* NX_SECURE_TLS_CLIENT_DISABLED */
 
 /**************************************************************************/
 /*                                                                        */
@@ -56,6 +59,8 @@
 /*                                                                        */
 /*    _nx_secure_tls_allocate_handshake_packet                            */
 /*                                          Allocate TLS packet           */
+/*    _nx_secure_tls_client_handshake_hash_cleanup                        */
+/*                                          Cleanup handshake hash        */
 /*    _nx_secure_tls_generate_keys          Generate session keys         */
 /*    _nx_secure_tls_generate_premaster_secret                            */
 /*                                          Generate premaster secret     */
@@ -125,8 +130,10 @@ NX_PACKET_POOL *packet_pool;
 UINT            error_number;
 UINT            alert_number;
 UINT            alert_level;
-const NX_CRYPTO_METHOD
-               *method_ptr = NX_NULL;
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+NX_SECURE_TLS_SESSION_RESUMPTION
+               *resumption;
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
 
     /* Basic state machine for handshake:
      * 1. We have received a handshake message, now process the header.
@@ -172,6 +179,20 @@ const NX_CRYPTO_METHOD
 
         /* Process the message itself information from the header. */
         status = NX_SECURE_TLS_HANDSHAKE_FAILURE;
+
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+        /* Once the server has resumed our session, only its ChangeCipherSpec (a separate record type)
+           and the Finished behind it may follow. Anything else, such as a Certificate, means the server
+           is running a full handshake against a session we believe is abbreviated. */
+        if ((tls_session -> nx_secure_tls_session_resumed) &&
+            (tls_session -> nx_secure_tls_client_state == NX_SECURE_TLS_CLIENT_STATE_SERVERHELLO) &&
+            (message_type != NX_SECURE_TLS_FINISHED))
+        {
+            status = NX_SECURE_TLS_UNEXPECTED_MESSAGE;
+            message_type = NX_SECURE_TLS_INVALID_MESSAGE;
+        }
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
+
         switch (message_type)
         {
         case NX_SECURE_TLS_SERVER_HELLO:
@@ -200,45 +221,23 @@ const NX_CRYPTO_METHOD
             /* Final handshake message from the server, process it (verify the server handshake hash). */
             status = _nx_secure_tls_process_finished(tls_session, packet_buffer, message_length);
 
-            /* For client, cleanup hash handler after received the finished message from server. */
-            /* NOTE: we want to run all of the nx_crypto_cleanup calls regardless of the status of the finished processing above
-                     so use a secondary status to track their return status values. */
-#if (NX_SECURE_TLS_TLS_1_2_ENABLED)
-            method_ptr = tls_session -> nx_secure_tls_crypto_table -> nx_secure_tls_handshake_hash_sha256_method;
-
-            /* NOTE: we want to run all of the nx_crypto_cleanup calls regardless of the  */
-            if (method_ptr -> nx_crypto_cleanup != NX_NULL)
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+            if ((status == NX_SUCCESS) && tls_session -> nx_secure_tls_session_resumed)
             {
-                temp_status = method_ptr -> nx_crypto_cleanup(tls_session -> nx_secure_tls_handshake_hash.nx_secure_tls_handshake_hash_sha256_metadata);
-                if(temp_status != NX_CRYPTO_SUCCESS)
-                {
-                    status = temp_status;
-                }
-            }
 
-#endif /* (NX_SECURE_TLS_TLS_1_2_ENABLED) */
-
-#if (NX_SECURE_TLS_TLS_1_0_ENABLED || NX_SECURE_TLS_TLS_1_1_ENABLED)
-            method_ptr = tls_session -> nx_secure_tls_crypto_table -> nx_secure_tls_handshake_hash_md5_method;
-            if (method_ptr != NX_NULL && method_ptr -> nx_crypto_cleanup != NX_NULL)
-            {
-                temp_status = method_ptr -> nx_crypto_cleanup(tls_session -> nx_secure_tls_handshake_hash.nx_secure_tls_handshake_hash_md5_metadata);
-                if(temp_status != NX_CRYPTO_SUCCESS)
-                {
-                    status = temp_status;
-                }
+                /* In an abbreviated handshake the server Finished comes first and is covered by our
+                   own Finished, so hash it and keep the handshake hash until ours has been sent. */
+                _nx_secure_tls_handshake_hash_update(tls_session, packet_start, message_length + header_bytes);
+                break;
             }
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
 
-            method_ptr = tls_session -> nx_secure_tls_crypto_table -> nx_secure_tls_handshake_hash_sha1_method;
-            if (method_ptr != NX_NULL && method_ptr -> nx_crypto_cleanup != NX_NULL)
+            /* For client, cleanup hash handler after received the finished message from server. */
+            temp_status = _nx_secure_tls_client_handshake_hash_cleanup(tls_session);
+            if (temp_status != NX_SUCCESS)
             {
-                temp_status = method_ptr -> nx_crypto_cleanup(tls_session -> nx_secure_tls_handshake_hash.nx_secure_tls_handshake_hash_sha1_metadata);
-                if(temp_status != NX_CRYPTO_SUCCESS)
-                {
-                    status = temp_status;
-                }
+                status = temp_status;
             }
-#endif /* (NX_SECURE_TLS_TLS_1_0_ENABLED || NX_SECURE_TLS_TLS_1_1_ENABLED) */
 
             break;
         case NX_SECURE_TLS_HELLO_REQUEST:
@@ -396,6 +395,16 @@ const NX_CRYPTO_METHOD
 
                 _nx_secure_tls_handshake_hash_update(tls_session, packet_start, message_length + header_bytes);
             }
+
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+            if (tls_session -> nx_secure_tls_session_resumed)
+            {
+
+                /* The server resumed our session and continues with ChangeCipherSpec and Finished,
+                   so generate the session keys from the restored master secret right away. */
+                status = _nx_secure_tls_generate_keys(tls_session);
+            }
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
             break;
         case NX_SECURE_TLS_CLIENT_STATE_SERVER_CERTIFICATE:
             /* Processed a server certificate above. Here, we extract the public key and do any verification
@@ -566,6 +575,106 @@ const NX_CRYPTO_METHOD
         case NX_SECURE_TLS_CLIENT_STATE_HANDSHAKE_FINISHED:
             /* We processed a server finished message, completing the handshake. Verify all is good and if so,
                continue to the encrypted session. */
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+            resumption = tls_session -> nx_secure_tls_session_resumption_ptr;
+            if (tls_session -> nx_secure_tls_session_resumed)
+            {
+                if (tls_session -> nx_secure_tls_local_session_active)
+                {
+
+                    /* Our ChangeCipherSpec and Finished are already out. */
+                    break;
+                }
+
+                /* Abbreviated handshake: the server has sent ChangeCipherSpec and Finished, now
+                   respond with our own to complete the handshake. */
+
+                /* Release the protection before suspending on nx_packet_allocate. */
+                tx_mutex_put(&_nx_secure_tls_protection);
+
+                status = _nx_secure_tls_packet_allocate(tls_session, packet_pool, &send_packet, wait_option);
+
+                /* Get the protection after nx_packet_allocate. */
+                tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+                if (status != NX_SUCCESS)
+                {
+                    break;
+                }
+
+                /* ChangeCipherSpec is NOT a handshake message, so send as a normal TLS record. */
+                _nx_secure_tls_send_changecipherspec(tls_session, send_packet);
+
+                status = _nx_secure_tls_send_record(tls_session, send_packet, NX_SECURE_TLS_CHANGE_CIPHER_SPEC, wait_option);
+
+                if (status != NX_SUCCESS)
+                {
+                    /* Release packet on send error. */
+                    nx_secure_tls_packet_release(send_packet);
+                    break;
+                }
+
+                /* Reset the sequence number now that we are starting a new session. */
+                NX_SECURE_MEMSET(tls_session -> nx_secure_tls_local_sequence_number, 0, sizeof(tls_session -> nx_secure_tls_local_sequence_number));
+
+                /* Set our local session keys since we are sent a CCS message. */
+                _nx_secure_tls_session_keys_set(tls_session, NX_SECURE_TLS_KEY_SET_LOCAL);
+
+                status = _nx_secure_tls_allocate_handshake_packet(tls_session, packet_pool, &send_packet, wait_option);
+
+                if (status != NX_SUCCESS)
+                {
+                    break;
+                }
+
+                /* Generate and send the finished message, which completes the handshake. */
+                _nx_secure_tls_send_finished(tls_session, send_packet);
+
+                status = _nx_secure_tls_send_handshake_record(tls_session, send_packet, NX_SECURE_TLS_FINISHED, wait_option);
+
+                /* The handshake hash is no longer needed. */
+                temp_status = _nx_secure_tls_client_handshake_hash_cleanup(tls_session);
+                if ((status == NX_SUCCESS) && (temp_status != NX_SUCCESS))
+                {
+                    status = temp_status;
+                }
+            }
+            else if (resumption != NX_NULL)
+            {
+
+                /* Full handshake completed: remember the session so the next connection can resume it.
+                   An empty or oversized session ID means the server does not support resumption. */
+                if ((tls_session -> nx_secure_tls_session_id_length > 0) &&
+                    (tls_session -> nx_secure_tls_session_id_length <= NX_SECURE_TLS_RESUMPTION_SESSION_ID_SIZE)
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+                    && (!tls_session -> nx_secure_tls_1_3)
+#endif
+                    )
+                {
+                    NX_SECURE_MEMCPY(resumption -> nx_secure_tls_resumption_session_id, tls_session -> nx_secure_tls_session_id,
+                                     tls_session -> nx_secure_tls_session_id_length); /* Use case of memcpy is verified. */
+                    resumption -> nx_secure_tls_resumption_session_id_length = tls_session -> nx_secure_tls_session_id_length;
+                    NX_SECURE_MEMCPY(resumption -> nx_secure_tls_resumption_master_secret,
+                                     tls_session -> nx_secure_tls_key_material.nx_secure_tls_master_secret,
+                                     NX_SECURE_TLS_MASTER_SIZE); /* Use case of memcpy is verified. */
+                    resumption -> nx_secure_tls_resumption_ciphersuite =
+                        tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_ciphersuite;
+                    resumption -> nx_secure_tls_resumption_protocol_version = tls_session -> nx_secure_tls_protocol_version;
+
+                    /* Stamp the entry with the time the session was established so the application
+                       can age it out. Without a time source the stamp is 0. */
+                    resumption -> nx_secure_tls_resumption_time = 0;
+                    if (tls_session -> nx_secure_tls_session_time_function != NX_NULL)
+                    {
+                        resumption -> nx_secure_tls_resumption_time = tls_session -> nx_secure_tls_session_time_function();
+                    }
+                }
+                else
+                {
+                    resumption -> nx_secure_tls_resumption_session_id_length = 0;
+                }
+            }
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
             break;
         case NX_SECURE_TLS_CLIENT_STATE_HELLO_VERIFY: /* DTLS ONLY! */
         default:
@@ -620,3 +729,89 @@ const NX_CRYPTO_METHOD
 #endif
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_client_handshake_hash_cleanup        PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function cleans up the handshake hash handlers once the client */
+/*    no longer needs the Finished hash. All cleanup routines are run     */
+/*    regardless of individual failures, the last failure is returned.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_crypto_cleanup]                   Cleanup hash handlers         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_client_handshake       TLS client state machine      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+#ifndef NX_SECURE_TLS_CLIENT_DISABLED
+static UINT _nx_secure_tls_client_handshake_hash_cleanup(NX_SECURE_TLS_SESSION *tls_session)
+{
+UINT status = NX_SUCCESS;
+UINT temp_status;
+const NX_CRYPTO_METHOD
+    *method_ptr = NX_NULL;
+
+#if (NX_SECURE_TLS_TLS_1_2_ENABLED)
+    method_ptr = tls_session -> nx_secure_tls_crypto_table -> nx_secure_tls_handshake_hash_sha256_method;
+
+    if (method_ptr -> nx_crypto_cleanup != NX_NULL)
+    {
+        temp_status = method_ptr -> nx_crypto_cleanup(tls_session -> nx_secure_tls_handshake_hash.nx_secure_tls_handshake_hash_sha256_metadata);
+        if(temp_status != NX_CRYPTO_SUCCESS)
+        {
+            status = temp_status;
+        }
+    }
+
+#endif /* (NX_SECURE_TLS_TLS_1_2_ENABLED) */
+
+#if (NX_SECURE_TLS_TLS_1_0_ENABLED || NX_SECURE_TLS_TLS_1_1_ENABLED)
+    method_ptr = tls_session -> nx_secure_tls_crypto_table -> nx_secure_tls_handshake_hash_md5_method;
+    if (method_ptr != NX_NULL && method_ptr -> nx_crypto_cleanup != NX_NULL)
+    {
+        temp_status = method_ptr -> nx_crypto_cleanup(tls_session -> nx_secure_tls_handshake_hash.nx_secure_tls_handshake_hash_md5_metadata);
+        if(temp_status != NX_CRYPTO_SUCCESS)
+        {
+            status = temp_status;
+        }
+    }
+
+    method_ptr = tls_session -> nx_secure_tls_crypto_table -> nx_secure_tls_handshake_hash_sha1_method;
+    if (method_ptr != NX_NULL && method_ptr -> nx_crypto_cleanup != NX_NULL)
+    {
+        temp_status = method_ptr -> nx_crypto_cleanup(tls_session -> nx_secure_tls_handshake_hash.nx_secure_tls_handshake_hash_sha1_metadata);
+        if(temp_status != NX_CRYPTO_SUCCESS)
+        {
+            status = temp_status;
+        }
+    }
+#endif /* (NX_SECURE_TLS_TLS_1_0_ENABLED || NX_SECURE_TLS_TLS_1_1_ENABLED) */
+
+    return(status);
+}
+#endif /* NX_SECURE_TLS_CLIENT_DISABLED */
@@ -189,62 +189,69 @@ VOID                                 *handler = NX_NULL;
             return(NX_SECURE_TLS_PROTOCOL_VERSION_CHANGED);
         }
 
-        /* Use the PRF to generate the master secret. */
-        if (session_prf_method -> nx_crypto_init != NX_NULL)
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+        /* A resumed session reuses the master secret restored from the resumption entry
+           in the ServerHello processing, only the key block is generated below. */
+        if (!tls_session -> nx_secure_tls_session_resumed)
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
         {
-            status = session_prf_method -> nx_crypto_init((NX_CRYPTO_METHOD*)session_prf_method,
-                                                 pre_master_sec, (NX_CRYPTO_KEY_SIZE)pre_master_sec_size,
-                                                 &handler,
-                                                 tls_session -> nx_secure_tls_prf_metadata_area,
-                                                 tls_session -> nx_secure_tls_prf_metadata_size);
-
-            if(status != NX_CRYPTO_SUCCESS)
+            /* Use the PRF to generate the master secret. */
+            if (session_prf_method -> nx_crypto_init != NX_NULL)
             {
+                status = session_prf_method -> nx_crypto_init((NX_CRYPTO_METHOD*)session_prf_method,
+                                                     pre_master_sec, (NX_CRYPTO_KEY_SIZE)pre_master_sec_size,
+                                                     &handler,
+                                                     tls_session -> nx_secure_tls_prf_metadata_area,
+                                                     tls_session -> nx_secure_tls_prf_metadata_size);
+
+                if(status != NX_CRYPTO_SUCCESS)
+                {
 #ifdef NX_SECURE_KEY_CLEAR
-                NX_SECURE_MEMSET(_nx_secure_tls_gen_keys_random, 0, sizeof(_nx_secure_tls_gen_keys_random));
+                    NX_SECURE_MEMSET(_nx_secure_tls_gen_keys_random, 0, sizeof(_nx_secure_tls_gen_keys_random));
 #endif /* NX_SECURE_KEY_CLEAR  */
 
-                return(status);
-            }                                                     
-        }
+                    return(status);
+                }                                                     
+            }
 
-        if (session_prf_method -> nx_crypto_operation != NX_NULL)
-        {
-            status = session_prf_method -> nx_crypto_operation(NX_CRYPTO_PRF,
-                                                      handler,
-                                                      (NX_CRYPTO_METHOD*)session_prf_method,
-                                                      (UCHAR *)"master secret",
-                                                      13,
-                                                      _nx_secure_tls_gen_keys_random,
-                                                      64,
-                                                      NX_NULL,
-                                                      master_sec,
-                                                      48,
-                                                      tls_session -> nx_secure_tls_prf_metadata_area,
-                                                      tls_session -> nx_secure_tls_prf_metadata_size,
-                                                      NX_NULL,
-                                                      NX_NULL);
+            if (session_prf_method -> nx_crypto_operation != NX_NULL)
+            {
+                status = session_prf_method -> nx_crypto_operation(NX_CRYPTO_PRF,
+                                                          handler,
+                                                          (NX_CRYPTO_METHOD*)session_prf_method,
+                                                          (UCHAR *)"master secret",
+                                                          13,
+                                                          _nx_secure_tls_gen_keys_random,
+                                                          64,
+                                                          NX_NULL,
+                                                          master_sec,
+                                                          48,
+                                                          tls_session -> nx_secure_tls_prf_metadata_area,
+                                                          tls_session -> nx_secure_tls_prf_metadata_size,
+                                                          NX_NULL,
+                                                          NX_NULL);
 
 #ifdef NX_SECURE_KEY_CLEAR
-            NX_SECURE_MEMSET(_nx_secure_tls_gen_keys_random, 0, sizeof(_nx_secure_tls_gen_keys_random));
+                NX_SECURE_MEMSET(_nx_secure_tls_gen_keys_random, 0, sizeof(_nx_secure_tls_gen_keys_random));
 #endif /* NX_SECURE_KEY_CLEAR  */
 
-            if(status != NX_CRYPTO_SUCCESS)
-            {
-                /* Secrets cleared above. */
-                return(status);
+                if(status != NX_CRYPTO_SUCCESS)
+                {
+                    /* Secrets cleared above. */
+                    return(status);
+                }
             }
-        }
 
-        if (session_prf_method -> nx_crypto_cleanup)
-        {
-            status = session_prf_method -> nx_crypto_cleanup(tls_session -> nx_secure_tls_prf_metadata_area);
-
-            if(status != NX_CRYPTO_SUCCESS)
+            if (session_prf_method -> nx_crypto_cleanup)
             {
-                /* All secrets cleared above. */
-                return(status);
-            }                                                     
+                status = session_prf_method -> nx_crypto_cleanup(tls_session -> nx_secure_tls_prf_metadata_area);
+
+                if(status != NX_CRYPTO_SUCCESS)
+                {
+                    /* All secrets cleared above. */
+                    return(status);
+                }                                                     
+            }
         }
     }
     else
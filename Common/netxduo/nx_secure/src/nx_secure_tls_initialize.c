@@ -75,6 +75,12 @@ VOID _nx_secure_tls_initialize(VOID)
     _nx_secure_tls_created_ptr = NX_NULL;
     _nx_secure_tls_created_count = 0;
 
+#ifndef NX_SECURE_X509_DISABLE_VERIFIED_CACHE
+    /* Clear the verified certificate cache. */
+    NX_SECURE_MEMSET(_nx_secure_x509_verified_cache, 0, sizeof(_nx_secure_x509_verified_cache));
+    _nx_secure_x509_verified_cache_next = 0;
+#endif /* NX_SECURE_X509_DISABLE_VERIFIED_CACHE */
+
     /* Create the internal TLS protection mutex. */
     tx_mutex_create(&_nx_secure_tls_protection, "TLS mutex", TX_NO_INHERIT);
 }
@@ -72,6 +72,9 @@ UINT _nx_secure_tls_process_changecipherspec(NX_SECURE_TLS_SESSION *tls_session,
                                              UCHAR *packet_buffer, UINT message_length)
 {
 UINT status = NX_SUCCESS;
+#ifndef NX_SECURE_TLS_CLIENT_DISABLED
+NX_SECURE_TLS_CLIENT_STATE expected_client_state = NX_SECURE_TLS_CLIENT_STATE_SERVERHELLO_DONE;
+#endif
 
     /* Verify that we received a proper ChangeCipherSpec message. */
     if (message_length != 1)
@@ -101,8 +104,16 @@ UINT status = NX_SUCCESS;
         }
 #endif
 #ifndef NX_SECURE_TLS_CLIENT_DISABLED
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+        /* In an abbreviated handshake the server ChangeCipherSpec directly follows the ServerHello. */
+        if (tls_session -> nx_secure_tls_session_resumed)
+        {
+            expected_client_state = NX_SECURE_TLS_CLIENT_STATE_SERVERHELLO;
+        }
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
+
         if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_CLIENT &&
-            tls_session -> nx_secure_tls_client_state != NX_SECURE_TLS_CLIENT_STATE_SERVERHELLO_DONE)
+            tls_session -> nx_secure_tls_client_state != expected_client_state)
         {
             return(NX_SECURE_TLS_UNEXPECTED_MESSAGE);
         }
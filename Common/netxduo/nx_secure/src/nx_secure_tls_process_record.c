@@ -25,6 +25,12 @@
 #include "nx_secure_tls.h"
 
 static VOID _nx_secure_tls_packet_trim(NX_PACKET *packet_ptr);
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+static UINT _nx_secure_tls_process_record_stream(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
+                                                 ULONG record_offset, UCHAR *header_data, USHORT header_length,
+                                                 UINT header_bytes, USHORT message_type, UINT message_length,
+                                                 ULONG *bytes_processed, ULONG wait_option);
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
 
 /**************************************************************************/
 /*                                                                        */
@@ -61,6 +67,9 @@ static VOID _nx_secure_tls_packet_trim(NX_PACKET *packet_ptr);
 /*                                          Process ChangeCipherSpec      */
 /*    _nx_secure_tls_process_header         Process record header         */
 /*    _nx_secure_tls_record_payload_decrypt Decrypt record data           */
+/*    _nx_secure_tls_record_payload_decrypt_stream                        */
+/*                                          Decrypt record as it arrives  */
+/*    _nx_secure_tls_process_record_stream  Decrypt partial record        */
 /*    _nx_secure_tls_server_handshake       TLS Server state machine      */
 /*    _nx_secure_tls_verify_mac             Verify record MAC checksum    */
 /*    nx_packet_allocate                    NetX Packet allocation call   */
@@ -100,6 +109,11 @@ UCHAR     *packet_data = NX_NULL;
 ULONG      record_offset = 0;
 ULONG      record_offset_next = 0;
 NX_PACKET *decrypted_packet;
+UINT       header_bytes;
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+UINT       streamed = NX_FALSE;
+UINT       stream_bytes;
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
 
     /* Basic state machine:
      * 1. Process header, which will set the state and return some data.
@@ -168,34 +182,61 @@ NX_PACKET *decrypted_packet;
         /* Get packet from record queue. */
         packet_ptr = tls_session -> nx_secure_record_queue_header;
 
-        /* Process the TLS record header, which will set the state. */
-        status = _nx_secure_tls_process_header(tls_session, packet_ptr, record_offset, &message_type, &message_length, header_data, &header_length);
-
-        if (status != NX_SECURE_TLS_SUCCESS)
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+        streamed = (tls_session -> nx_secure_record_stream_packet != NX_NULL);
+        if (streamed)
         {
-            return(status);
-        }
 
-        /* Ignore empty records. */
-        if (message_length == 0)
+            /* The header and the first part of this record were consumed on an earlier call. */
+            message_type = NX_SECURE_TLS_APPLICATION_DATA;
+            message_length = tls_session -> nx_secure_record_stream_length;
+            header_length = tls_session -> nx_secure_record_stream_header_length;
+            NX_SECURE_MEMCPY(header_data, tls_session -> nx_secure_record_stream_header, header_length); /* Use case of memcpy is verified. */
+            header_bytes = 0;
+        }
+        else
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
         {
 
-            /* Update the number of bytes we processed. */
-            *bytes_processed += (ULONG)header_length;
-            return(NX_SUCCESS);
+            /* Process the TLS record header, which will set the state. */
+            status = _nx_secure_tls_process_header(tls_session, packet_ptr, record_offset, &message_type, &message_length, header_data, &header_length);
+
+            if (status != NX_SECURE_TLS_SUCCESS)
+            {
+                return(status);
+            }
+
+            /* Ignore empty records. */
+            if (message_length == 0)
+            {
+
+                /* Update the number of bytes we processed. */
+                *bytes_processed += (ULONG)header_length;
+                return(NX_SUCCESS);
+            }
+
+            header_bytes = header_length;
         }
 
         /* Is the entire payload of the current record received? */
-        if ((header_length + record_offset + message_length) > packet_ptr -> nx_packet_length)
+        if ((header_bytes + record_offset + message_length) > packet_ptr -> nx_packet_length)
         {
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+
+            /* Decrypt what has arrived so the ciphertext can be released. */
+            return(_nx_secure_tls_process_record_stream(tls_session, packet_ptr, record_offset, header_data, header_length,
+                                                        header_bytes, message_type, message_length, bytes_processed,
+                                                        wait_option));
+#else
 
             /* Wait more TCP packets for this one record. */
             return(NX_CONTINUE);
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
         }
 
         /* Update the number of bytes we processed. */
-        *bytes_processed += (ULONG)header_length + message_length;
-        record_offset += (ULONG)header_length;
+        *bytes_processed += (ULONG)header_bytes + message_length;
+        record_offset += (ULONG)header_bytes;
         record_offset_next = record_offset + message_length;
 
         /* Check for active encryption of incoming records. If encrypted, decrypt before further processing. */
@@ -224,11 +265,27 @@ NX_PACKET *decrypted_packet;
                 }
             }
 
-            /* Decrypt the record data. */
-            status = _nx_secure_tls_record_payload_decrypt(tls_session, packet_ptr, record_offset,
-                                                           message_length, &decrypted_packet,
-                                                           tls_session -> nx_secure_tls_remote_sequence_number,
-                                                           (UCHAR)message_type, wait_option);
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+            if (streamed)
+            {
+
+                /* Finish the record whose first part was decrypted on an earlier call. */
+                tls_session -> nx_secure_record_stream_length = 0;
+                status = _nx_secure_tls_record_payload_decrypt_stream(tls_session, packet_ptr, record_offset,
+                                                                      message_length, message_length, &decrypted_packet,
+                                                                      tls_session -> nx_secure_tls_remote_sequence_number,
+                                                                      (UCHAR)message_type, &stream_bytes, wait_option);
+            }
+            else
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
+            {
+
+                /* Decrypt the record data. */
+                status = _nx_secure_tls_record_payload_decrypt(tls_session, packet_ptr, record_offset,
+                                                               message_length, &decrypted_packet,
+                                                               tls_session -> nx_secure_tls_remote_sequence_number,
+                                                               (UCHAR)message_type, wait_option);
+            }
 
             /* Set the error status to something appropriate. */
             error_status = NX_SECURE_TLS_SUCCESS;
@@ -295,7 +352,20 @@ NX_PACKET *decrypted_packet;
                                   the payload decryption operation. Skipping the MAC check on padding failures
                                   could enable a timing-based attack allowing an attacker to determine whether
                                   padding was valid or not, causing an information leak. */
-                    status = _nx_secure_tls_verify_mac(tls_session, header_data, header_length, packet_ptr, record_offset, &message_length);
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+                    if (streamed && (decrypted_packet != NX_NULL))
+                    {
+
+                        /* Most of the ciphertext has been released, so check the MAC over the decrypted record. */
+                        message_length = decrypted_packet -> nx_packet_length;
+                        status = _nx_secure_tls_verify_mac(tls_session, header_data, header_length, decrypted_packet, 0, &message_length);
+                        nx_secure_tls_packet_release(decrypted_packet);
+                    }
+                    else
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
+                    {
+                        status = _nx_secure_tls_verify_mac(tls_session, header_data, header_length, packet_ptr, record_offset, &message_length);
+                    }
                 }
                 else
                 {
@@ -319,7 +389,13 @@ NX_PACKET *decrypted_packet;
 
             if (status != NX_SECURE_TLS_SUCCESS)
             {
-                /* MAC verification failed. */
+
+                /* MAC verification failed. Clear the plaintext now rather than hold it until the next record. */
+                if (tls_session -> nx_secure_record_decrypted_packet)
+                {
+                    nx_secure_tls_packet_release(tls_session -> nx_secure_record_decrypted_packet);
+                    tls_session -> nx_secure_record_decrypted_packet = NX_NULL;
+                }
                 return(status);
             }
 
@@ -332,6 +408,16 @@ NX_PACKET *decrypted_packet;
             _nx_secure_tls_packet_trim(decrypted_packet);
         }
 
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+        /* Once a fragment length is negotiated, no record from the server may be longer, whether
+           encrypted or not (RFC 6066). The caller answers with a record_overflow alert. */
+        if ((tls_session -> nx_secure_tls_max_fragment_length != 0) &&
+            (message_length > tls_session -> nx_secure_tls_max_fragment_length))
+        {
+            return(NX_SECURE_TLS_RECORD_OVERFLOW);
+        }
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+
         if (message_type != NX_SECURE_TLS_APPLICATION_DATA)
         {
 
@@ -567,3 +653,130 @@ NX_PACKET *current_ptr;
         message_length -= (ULONG)(current_ptr -> nx_packet_append_ptr - current_ptr -> nx_packet_prepend_ptr);
     }
 }
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_process_record_stream                PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function decrypts the part of an encrypted application data    */
+/*    record received so far, so the ciphertext can be released before    */
+/*    the rest of the record arrives. Records that cannot be decrypted    */
+/*    this way are left in the queue until they are complete.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           Pointer to TLS control block  */
+/*    packet_ptr                            NX_PACKET containing a record */
+/*    record_offset                         Offset of record in packet    */
+/*    header_data                           Record header                 */
+/*    header_length                         Length of record header       */
+/*    header_bytes                          Header bytes still in packet  */
+/*    message_type                          Record type                   */
+/*    message_length                        Record bytes not yet consumed */
+/*    bytes_processed                       Return for size of packet     */
+/*    wait_option                           Control timeout options       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_record_payload_decrypt_stream                        */
+/*                                          Decrypt record as it arrives  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_process_record         Process TLS records           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+static UINT _nx_secure_tls_process_record_stream(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *packet_ptr,
+                                                 ULONG record_offset, UCHAR *header_data, USHORT header_length,
+                                                 UINT header_bytes, USHORT message_type, UINT message_length,
+                                                 ULONG *bytes_processed, ULONG wait_option)
+{
+UINT status;
+UINT stream_bytes;
+
+    /* Only encrypted application data records are decrypted as they arrive. */
+    if ((!tls_session -> nx_secure_tls_remote_session_active) || (message_type != NX_SECURE_TLS_APPLICATION_DATA) ||
+        (tls_session -> nx_secure_tls_session_ciphersuite == NX_NULL) ||
+        (tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher -> nx_crypto_operation == NX_NULL))
+    {
+
+        /* Wait more TCP packets for this one record. */
+        return(NX_CONTINUE);
+    }
+
+#if (NX_SECURE_TLS_TLS_1_0_ENABLED)
+    /* TLS 1.0 takes the next IV from the last ciphertext block of the record, so keep it all. */
+    if (tls_session -> nx_secure_tls_protocol_version == NX_SECURE_TLS_VERSION_TLS_1_0)
+    {
+        return(NX_CONTINUE);
+    }
+#endif
+
+    /* Check the record length before holding any of it. */
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+    if (tls_session -> nx_secure_tls_1_3)
+    {
+        if (message_length > NX_SECURE_TLS_MAX_CIPHERTEXT_LENGTH_1_3)
+        {
+            return(NX_SECURE_TLS_RECORD_OVERFLOW);
+        }
+    }
+    else
+#endif
+    {
+        if (message_length > NX_SECURE_TLS_MAX_CIPHERTEXT_LENGTH)
+        {
+            return(NX_SECURE_TLS_RECORD_OVERFLOW);
+        }
+    }
+
+    record_offset += header_bytes;
+    status = _nx_secure_tls_record_payload_decrypt_stream(tls_session, packet_ptr, record_offset,
+                                                          packet_ptr -> nx_packet_length - record_offset,
+                                                          message_length, NX_NULL,
+                                                          tls_session -> nx_secure_tls_remote_sequence_number,
+                                                          (UCHAR)message_type, &stream_bytes, wait_option);
+    if (status != NX_CONTINUE)
+    {
+        tls_session -> nx_secure_record_stream_length = 0;
+        return(status);
+    }
+
+    if (tls_session -> nx_secure_record_stream_packet)
+    {
+        if (header_bytes)
+        {
+
+            /* Keep the header for the MAC check once the record is complete. */
+            NX_SECURE_MEMCPY(tls_session -> nx_secure_record_stream_header, header_data, header_length); /* Use case of memcpy is verified. */
+            tls_session -> nx_secure_record_stream_header_length = header_length;
+        }
+
+        /* Let the caller release the header and the decrypted ciphertext. */
+        tls_session -> nx_secure_record_stream_length = message_length - stream_bytes;
+        *bytes_processed += header_bytes + stream_bytes;
+    }
+
+    /* Wait more TCP packets for this one record. */
+    return(NX_CONTINUE);
+}
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
@@ -91,6 +91,10 @@ USHORT                                ciphersuite;
 USHORT                                ciphersuite_priority;
 NX_SECURE_TLS_HELLO_EXTENSION         extension_data[NX_SECURE_TLS_HELLO_EXTENSIONS_MAX];
 UINT                                  num_extensions;
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+UINT                                  offered_id_length = tls_session -> nx_secure_tls_session_id_length;
+NX_SECURE_TLS_SESSION_RESUMPTION     *resumption;
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
 USHORT                                tls_1_3 = tls_session -> nx_secure_tls_1_3;
 NX_SECURE_TLS_SERVER_STATE            old_client_state = tls_session -> nx_secure_tls_client_state;
@@ -197,6 +201,36 @@ NX_SECURE_TLS_SERVER_STATE            old_client_state = tls_session -> nx_secur
         return(NX_SECURE_TLS_UNKNOWN_CIPHERSUITE);
     }
 
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+    /* The server resumes the session we offered by echoing its session ID (RFC 5246, Section 7.4.1.3).
+       In that case the handshake continues directly with the server ChangeCipherSpec and Finished,
+       keyed from the master secret of the original session. */
+    tls_session -> nx_secure_tls_session_resumed = NX_FALSE;
+    resumption = tls_session -> nx_secure_tls_session_resumption_ptr;
+    if ((resumption != NX_NULL) && (offered_id_length > 0) &&
+        (offered_id_length == tls_session -> nx_secure_tls_session_id_length) &&
+        (offered_id_length == resumption -> nx_secure_tls_resumption_session_id_length) &&
+        (NX_SECURE_MEMCMP(tls_session -> nx_secure_tls_session_id, resumption -> nx_secure_tls_resumption_session_id,
+                          offered_id_length) == 0))
+    {
+
+        /* A resumed session must keep the parameters it was established with. */
+        if ((ciphersuite != resumption -> nx_secure_tls_resumption_ciphersuite) ||
+            (version != resumption -> nx_secure_tls_resumption_protocol_version))
+        {
+            return(NX_SECURE_TLS_HANDSHAKE_FAILURE);
+        }
+
+        NX_SECURE_MEMCPY(tls_session -> nx_secure_tls_key_material.nx_secure_tls_master_secret,
+                         resumption -> nx_secure_tls_resumption_master_secret, NX_SECURE_TLS_MASTER_SIZE); /* Use case of memcpy is verified. */
+
+        /* The server authenticated itself in the original handshake and proves possession of the
+           same master secret with its Finished message. */
+        tls_session -> nx_secure_tls_received_remote_credentials = NX_TRUE;
+        tls_session -> nx_secure_tls_session_resumed = NX_TRUE;
+    }
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
+
     /* Compression method - for now this should be NULL. */
     compression_method = packet_buffer[length];
 
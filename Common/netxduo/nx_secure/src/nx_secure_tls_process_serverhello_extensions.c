@@ -288,6 +288,23 @@ USHORT                                supported_version = tls_session -> nx_secu
                 return(NX_SECURE_TLS_INCORRECT_MESSAGE_LENGTH);
             }
 
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+            if (extension_id == NX_SECURE_TLS_EXTENSION_MAX_FRAGMENT_LENGTH)
+            {
+
+                /* RFC 6066 section 4: the server may only echo the code the client offered. */
+                if ((extension_length != 1) ||
+                    (tls_session -> nx_secure_tls_max_fragment_length_code == 0) ||
+                    (packet_buffer[offset] != tls_session -> nx_secure_tls_max_fragment_length_code))
+                {
+                    return(NX_SECURE_TLS_BAD_MAX_FRAGMENT_LENGTH);
+                }
+
+                /* Records in both directions are now limited to 2^(8 + code) bytes. */
+                tls_session -> nx_secure_tls_max_fragment_length = (USHORT)(1u << (8 + packet_buffer[offset]));
+            }
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+
             if (*num_extensions < NX_SECURE_TLS_HELLO_EXTENSIONS_MAX)
             {
                 extensions[*num_extensions].nx_secure_tls_extension_id = extension_id;
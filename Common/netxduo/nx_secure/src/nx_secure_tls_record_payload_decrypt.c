@@ -40,6 +40,22 @@ static UINT _nx_secure_tls_record_packet_decrypt(NX_SECURE_TLS_SESSION *tls_sess
                                                  UINT wait_option);
 static UINT _nx_secure_tls_data_decrypt(NX_SECURE_TLS_SESSION *tls_session,
                                         UCHAR *input, UCHAR *output, UINT length);
+static UINT _nx_secure_tls_record_decrypt_setup(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *encrypted_packet,
+                                                UINT *offset, UINT *message_length,
+                                                ULONG sequence_num[NX_SECURE_TLS_SEQUENCE_NUMBER_SIZE],
+                                                UCHAR record_type, UCHAR *additional_data,
+                                                UINT *additional_data_size, UCHAR *nonce, UCHAR **iv_ptr);
+static UINT _nx_secure_tls_record_decrypt_begin(NX_SECURE_TLS_SESSION *tls_session,
+                                                UCHAR *additional_data, UINT additional_data_size,
+                                                UCHAR *iv, UINT message_length,
+                                                NX_PACKET **decrypted_packet, UINT wait_option);
+static UINT _nx_secure_tls_record_decrypt_blocks(NX_SECURE_TLS_SESSION *tls_session,
+                                                 NX_PACKET *encrypted_packet, UINT offset,
+                                                 UINT message_length, NX_PACKET *decrypted_packet,
+                                                 UINT wait_option);
+static UINT _nx_secure_tls_record_decrypt_end(NX_SECURE_TLS_SESSION *tls_session,
+                                              NX_PACKET *encrypted_packet, UINT icv_offset, UINT icv_size);
+static UINT _nx_secure_tls_record_padding_check(NX_PACKET *decrypted_packet);
 
 /* Defined in nx_secure_tls_record_payload_encrypt.c */
 extern UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_SIZE];
@@ -81,10 +97,11 @@ extern UCHAR _nx_secure_tls_record_block_buffer[NX_SECURE_TLS_MAX_CIPHER_BLOCK_S
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    [nx_crypto_operation]                 Crypto operation              */
-/*    nx_secure_tls_packet_release          Release packet                */
+/*    _nx_secure_tls_record_decrypt_setup   Set up nonce or IV            */
 /*    _nx_secure_tls_record_chained_packet_decrypt                        */
 /*                                          Decrypt chained packet        */
+/*    _nx_secure_tls_record_padding_check   Check CBC padding             */
+/*    nx_secure_tls_packet_release          Release packet                */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -110,21 +127,14 @@ UINT _nx_secure_tls_record_payload_decrypt(NX_SECURE_TLS_SESSION *tls_session, N
 {
 UINT                                  status;
 UCHAR                                *iv;
-UCHAR                                 padding_length;
-UCHAR                                 copy_size;
 const NX_CRYPTO_METHOD               *session_cipher_method;
-USHORT                                iv_size;
-UINT                                  i;
-ULONG                                 bytes_copied;
-#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
-UINT                                  icv_size;
 UCHAR                                 additional_data[13];
 UINT                                  additional_data_size;
 UCHAR                                 nonce[13];
-#else
-    NX_PARAMETER_NOT_USED(sequence_num);
-    NX_PARAMETER_NOT_USED(record_type);
-#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
+#if (NX_SECURE_TLS_TLS_1_0_ENABLED)
+USHORT                                iv_size;
+ULONG                                 bytes_copied;
+#endif
 
 
     if (tls_session -> nx_secure_tls_session_ciphersuite == NX_NULL)
@@ -138,6 +148,364 @@ UCHAR                                 nonce[13];
        cipher, decrypt the data. */
     session_cipher_method = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher;
 
+    /* Build the nonce and additional data, or pick up the CBC IV. */
+    status = _nx_secure_tls_record_decrypt_setup(tls_session, encrypted_packet, &offset, &message_length,
+                                                 sequence_num, record_type, additional_data,
+                                                 &additional_data_size, nonce, &iv);
+    if (status != NX_SECURE_TLS_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Decrypt the message payload using the session crypto method, and move the decrypted data to the beginning of the buffer. */
+    status = _nx_secure_tls_record_chained_packet_decrypt(tls_session, encrypted_packet, offset,
+                                                          message_length, decrypted_packet,
+                                                          additional_data,
+                                                          additional_data_size,
+                                                          iv,
+                                                          wait_option);
+
+    /* Only AEAD ciphers have additional data. */
+    if (additional_data_size)
+    {
+#ifdef NX_SECURE_KEY_CLEAR
+        NX_SECURE_MEMSET(additional_data, 0, sizeof(additional_data));
+        NX_SECURE_MEMSET(nonce, 0, sizeof(nonce));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+        if (status == NX_CRYPTO_AUTHENTICATION_FAILED)
+        {
+            return(NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
+        }
+
+        return(status);
+    }
+
+    if(status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    if (session_cipher_method -> nx_crypto_operation == NX_NULL)
+    {
+        return(NX_SECURE_TLS_SUCCESS);
+    }
+
+#if (NX_SECURE_TLS_TLS_1_0_ENABLED)
+    /* Update our IV for CBC mode. */
+    if (tls_session -> nx_secure_tls_protocol_version == NX_SECURE_TLS_VERSION_TLS_1_0)
+    {
+        if (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CBC)
+        {
+
+            /* New IV is the last encrypted block of the output. */
+            iv_size = session_cipher_method -> nx_crypto_IV_size_in_bits >> 3;
+            status = nx_packet_data_extract_offset(encrypted_packet, (offset + message_length) - iv_size,
+                                                   iv, iv_size, &bytes_copied);
+            if (status || (bytes_copied != iv_size))
+            {
+                nx_secure_tls_packet_release(*decrypted_packet);
+                return(status);
+            }
+        }
+    }
+#endif
+
+    /* Check and remove the CBC padding. */
+    status = _nx_secure_tls_record_padding_check(*decrypted_packet);
+
+    /* Return error status if appropriate. */
+    if(status != NX_SUCCESS)
+    {
+        nx_secure_tls_packet_release(*decrypted_packet);
+        return(status);
+    }
+
+    return(NX_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_payload_decrypt_stream        PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function decrypts an incoming TLS record as its TCP packets    */
+/*    arrive. While the record is incomplete, it decrypts the whole       */
+/*    cipher blocks received so far into a packet kept in the session and */
+/*    returns NX_CONTINUE. The caller then releases the consumed          */
+/*    ciphertext. Once the rest of the record has arrived, the AEAD tag   */
+/*    or CBC padding is checked and the decrypted packet is returned. For */
+/*    CBC ciphers the packet is returned even on a padding error, so the  */
+/*    caller can run the MAC check over it before releasing it.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    encrypted_packet                      Pointer to packet containing  */
+/*                                            encrypted data              */
+/*    offset                                Offset of record data in      */
+/*                                            encrypted_packet            */
+/*    available_length                      Length of data received       */
+/*    message_length                        Length of record data not yet */
+/*                                            decrypted                   */
+/*    decrypted_packet                      Pointer to packet containing  */
+/*                                            decrypted data              */
+/*    sequence_num                          Record sequence number        */
+/*    record_type                           Record type                   */
+/*    bytes_processed                       Output bytes of record data   */
+/*                                            consumed                    */
+/*    wait_option                           Control timeout options       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_record_decrypt_setup   Set up nonce or IV            */
+/*    _nx_secure_tls_record_decrypt_begin   Initialize decryption         */
+/*    _nx_secure_tls_record_decrypt_blocks  Decrypt record data           */
+/*    _nx_secure_tls_record_decrypt_end     Check ICV                     */
+/*    _nx_secure_tls_record_padding_check   Check CBC padding             */
+/*    nx_secure_tls_packet_release          Release packet                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_process_record         Process TLS record data       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+UINT _nx_secure_tls_record_payload_decrypt_stream(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *encrypted_packet,
+                                                  UINT offset, UINT available_length, UINT message_length,
+                                                  NX_PACKET **decrypted_packet,
+                                                  ULONG sequence_num[NX_SECURE_TLS_SEQUENCE_NUMBER_SIZE],
+                                                  UCHAR record_type, UINT *bytes_processed, UINT wait_option)
+{
+UINT                    status;
+UINT                    icv_size;
+UINT                    block_size;
+UINT                    length;
+UINT                    original_length;
+UCHAR                  *iv;
+UCHAR                   additional_data[13];
+UINT                    additional_data_size;
+UCHAR                   nonce[13];
+NX_PACKET              *packet_ptr;
+const NX_CRYPTO_METHOD *session_cipher_method;
+
+    *bytes_processed = 0;
+
+    if (tls_session -> nx_secure_tls_session_ciphersuite == NX_NULL)
+    {
+
+        /* Likely internal error since at this point ciphersuite negotiation was theoretically completed. */
+        return(NX_SECURE_TLS_UNKNOWN_CIPHERSUITE);
+    }
+
+    session_cipher_method = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher;
+    icv_size = session_cipher_method -> nx_crypto_ICV_size_in_bits >> 3;
+    block_size = session_cipher_method -> nx_crypto_block_size_in_bytes;
+
+    if (tls_session -> nx_secure_record_stream_packet == NX_NULL)
+    {
+
+        /* First part of the record. Wait until the explicit nonce or IV has arrived. */
+        if (available_length < (UINT)((session_cipher_method -> nx_crypto_IV_size_in_bits >> 3) + 8))
+        {
+            return(NX_CONTINUE);
+        }
+
+        original_length = message_length;
+        status = _nx_secure_tls_record_decrypt_setup(tls_session, encrypted_packet, &offset, &message_length,
+                                                     sequence_num, record_type, additional_data,
+                                                     &additional_data_size, nonce, &iv);
+        if ((status == NX_SECURE_TLS_SUCCESS) &&
+            ((icv_size > message_length) || (icv_size > sizeof(_nx_secure_tls_record_block_buffer))))
+        {
+
+            /* Invalid packet. */
+            status = NX_SECURE_TLS_INVALID_PACKET;
+        }
+
+        if (status == NX_SECURE_TLS_SUCCESS)
+        {
+            status = _nx_secure_tls_record_decrypt_begin(tls_session, additional_data, additional_data_size,
+                                                         iv, message_length - icv_size, &packet_ptr, wait_option);
+        }
+
+#ifdef NX_SECURE_KEY_CLEAR
+        NX_SECURE_MEMSET(additional_data, 0, sizeof(additional_data));
+        NX_SECURE_MEMSET(nonce, 0, sizeof(nonce));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+        if (status)
+        {
+            return(status);
+        }
+
+        tls_session -> nx_secure_record_stream_packet = packet_ptr;
+
+        /* The explicit nonce or IV has been consumed. */
+        *bytes_processed = original_length - message_length;
+        available_length -= *bytes_processed;
+    }
+
+    packet_ptr = tls_session -> nx_secure_record_stream_packet;
+
+    if (available_length < message_length)
+    {
+
+        /* Decrypt the whole blocks received so far. The ICV or MAC is checked once the record is complete. */
+        length = message_length - icv_size;
+        if (length > available_length)
+        {
+            length = available_length;
+        }
+        if (block_size)
+        {
+            length -= length % block_size;
+        }
+
+        status = _nx_secure_tls_record_decrypt_blocks(tls_session, encrypted_packet, offset, length,
+                                                      packet_ptr, wait_option);
+        if (status)
+        {
+            tls_session -> nx_secure_record_stream_packet = NX_NULL;
+            nx_secure_tls_packet_release(packet_ptr);
+            return(status);
+        }
+
+        *bytes_processed += length;
+        return(NX_CONTINUE);
+    }
+
+    /* The rest of the record has arrived. */
+    tls_session -> nx_secure_record_stream_packet = NX_NULL;
+    length = message_length - icv_size;
+
+    status = _nx_secure_tls_record_decrypt_blocks(tls_session, encrypted_packet, offset, length,
+                                                  packet_ptr, wait_option);
+    if (status == NX_SECURE_TLS_SUCCESS)
+    {
+        status = _nx_secure_tls_record_decrypt_end(tls_session, encrypted_packet, offset + length, icv_size);
+    }
+
+    if (status)
+    {
+        nx_secure_tls_packet_release(packet_ptr);
+        return(status);
+    }
+
+    *bytes_processed += message_length;
+
+    if (icv_size == 0)
+    {
+
+        /* Check and remove the CBC padding. The packet is returned even if the padding is bad so
+           the caller can run the MAC check over the same amount of data. */
+        length = packet_ptr -> nx_packet_length;
+        status = _nx_secure_tls_record_padding_check(packet_ptr);
+        if (status)
+        {
+
+            /* Keep the full length so the MAC work does not depend on the padding byte. */
+            packet_ptr -> nx_packet_length = length;
+        }
+    }
+
+    *decrypted_packet = packet_ptr;
+    return(status);
+}
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_decrypt_setup                 PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function prepares the decryption of an incoming TLS record. For*/
+/*    AEAD ciphers it builds the nonce and additional data. For CBC       */
+/*    ciphers it reads the explicit IV. The offset and length are moved   */
+/*    past any explicit nonce or IV in the record.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    encrypted_packet                      Pointer to packet containing  */
+/*                                            encrypted data              */
+/*    offset                                Offset of record data         */
+/*    message_length                        Length of record data         */
+/*    sequence_num                          Record sequence number        */
+/*    record_type                           Record type                   */
+/*    additional_data                       Output additional data        */
+/*    additional_data_size                  Output size of additional data*/
+/*    nonce                                 Output nonce                  */
+/*    iv_ptr                                Output IV for the cipher      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_packet_data_extract_offset         Extract data from packet      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_record_payload_decrypt Decrypt TLS record payload    */
+/*    _nx_secure_tls_record_payload_decrypt_stream                        */
+/*                                          Decrypt TLS record as it      */
+/*                                            arrives                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_secure_tls_record_decrypt_setup(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *encrypted_packet,
+                                                UINT *offset, UINT *message_length,
+                                                ULONG sequence_num[NX_SECURE_TLS_SEQUENCE_NUMBER_SIZE],
+                                                UCHAR record_type, UCHAR *additional_data,
+                                                UINT *additional_data_size, UCHAR *nonce, UCHAR **iv_ptr)
+{
+UINT                                  status;
+UCHAR                                *iv;
+const NX_CRYPTO_METHOD               *session_cipher_method;
+USHORT                                iv_size;
+ULONG                                 bytes_copied;
+#ifdef NX_SECURE_ENABLE_AEAD_CIPHER
+UINT                                  icv_size;
+#else
+    NX_PARAMETER_NOT_USED(sequence_num);
+    NX_PARAMETER_NOT_USED(record_type);
+    NX_PARAMETER_NOT_USED(additional_data);
+    NX_PARAMETER_NOT_USED(nonce);
+#endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
+
+    session_cipher_method = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher;
+
     /* Get the size of the IV used by the session cipher. */
     iv_size = session_cipher_method -> nx_crypto_IV_size_in_bits >> 3;
 
@@ -155,6 +523,9 @@ UCHAR                                 nonce[13];
         iv = tls_session -> nx_secure_tls_key_material.nx_secure_tls_server_iv;
     }
 
+    /* No additional data unless an AEAD cipher is in use. */
+    *additional_data_size = 0;
+
 #ifdef NX_SECURE_ENABLE_AEAD_CIPHER
     if ((session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CCM_8) ||
         (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CCM_12) ||
@@ -219,12 +590,12 @@ UCHAR                                 nonce[13];
             additional_data[0] = record_type;
             additional_data[1] = (UCHAR)(0x03);
             additional_data[2] = (UCHAR)(0x03);
-            additional_data[3] = (UCHAR)((message_length) >> 8);
-            additional_data[4] = (UCHAR)(message_length);
+            additional_data[3] = (UCHAR)((*message_length) >> 8);
+            additional_data[4] = (UCHAR)(*message_length);
 
 
             /* We have 5 bytes of additional data. */
-            additional_data_size = 5;
+            *additional_data_size = 5;
         }
         else
 #endif
@@ -252,13 +623,13 @@ UCHAR                                 nonce[13];
 
             icv_size = (session_cipher_method -> nx_crypto_ICV_size_in_bits >> 3);
 
-            if (message_length < (8 + icv_size))
+            if (*message_length < (8 + icv_size))
             {
                 return(NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
             }
 
             /* Remove length of nonce_explicit.  */
-            message_length -= 8;
+            *message_length -= 8;
 
             /* The length of CCMClientNonce or CCMServerNonce is 12 bytes.  */
             nonce[0] = 12;
@@ -277,7 +648,7 @@ UCHAR                                 nonce[13];
             additional_data[7] = (UCHAR)(sequence_num[0]);
 
             /* Copy nonce_explicit from the data.  */
-            status = nx_packet_data_extract_offset(encrypted_packet, offset,
+            status = nx_packet_data_extract_offset(encrypted_packet, *offset,
                                                    &nonce[5], 8, &bytes_copied);
             if (status || (bytes_copied != 8))
             {
@@ -290,195 +661,71 @@ UCHAR                                 nonce[13];
             additional_data[8]  = record_type;
             additional_data[9]  = (UCHAR)(tls_session -> nx_secure_tls_protocol_version >> 8);
             additional_data[10] = (UCHAR)(tls_session -> nx_secure_tls_protocol_version);
-            additional_data[11] = (UCHAR)((message_length - icv_size) >> 8);
-            additional_data[12] = (UCHAR)(message_length - icv_size);
+            additional_data[11] = (UCHAR)(((*message_length) - icv_size) >> 8);
+            additional_data[12] = (UCHAR)((*message_length) - icv_size);
 
             /* We have 13 bytes of additional data (8 bytes seq num + 5 bytes header). */
-            additional_data_size = 13;
+            *additional_data_size = 13;
 
             /* Decrypt data following the nonce_explicit. */
-            offset += 8;
+            *offset += 8;
         }
 
-        if (message_length < icv_size)
+        if (*message_length < icv_size)
         {
             return(NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
         }
 
-        /* Decrypt the message payload using the session crypto method, and move the decrypted data to the beginning of the buffer. */
-        if (session_cipher_method -> nx_crypto_operation)
-        {
-
-            /* Decrypt the message payload using the session crypto method, and move the decrypted data to the beginning of the buffer. */
-            status = _nx_secure_tls_record_chained_packet_decrypt(tls_session, encrypted_packet, offset,
-                                                                  message_length, decrypted_packet,
-                                                                  additional_data,
-                                                                  additional_data_size,
-                                                                  nonce,
-                                                                  wait_option);
-#ifdef NX_SECURE_KEY_CLEAR
-            NX_SECURE_MEMSET(additional_data, 0, sizeof(additional_data));
-            NX_SECURE_MEMSET(nonce, 0, sizeof(nonce));
-#endif /* NX_SECURE_KEY_CLEAR  */
-
-            if (status == NX_CRYPTO_AUTHENTICATION_FAILED)
-            {
-                return(NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
-            }
+        /* The nonce is passed to the cipher in place of the IV. */
+        *iv_ptr = nonce;
 
-            if (status != NX_SECURE_TLS_SUCCESS)
-            {
-                return(status);
-            }
-        }
+        return(NX_SECURE_TLS_SUCCESS);
     }
-    else
 #endif /* NX_SECURE_ENABLE_AEAD_CIPHER */
-    {
-        /* CBC mode has a specific structure for encrypted data, so handle that here:
-               block-ciphered struct {
-                   opaque IV[CipherSpec.block_length];
-                   opaque content[TLSCompressed.length];
-                   opaque MAC[CipherSpec.hash_size];
-                   uint8 padding[GenericBlockCipher.padding_length];
-                   uint8 padding_length;
-               } GenericBlockCipher;
-         */
+
+    /* CBC mode has a specific structure for encrypted data, so handle that here:
+           block-ciphered struct {
+               opaque IV[CipherSpec.block_length];
+               opaque content[TLSCompressed.length];
+               opaque MAC[CipherSpec.hash_size];
+               uint8 padding[GenericBlockCipher.padding_length];
+               uint8 padding_length;
+           } GenericBlockCipher;
+     */
 
 #if (NX_SECURE_TLS_TLS_1_0_ENABLED)
-        if ((iv_size > message_length) ||
-            (iv_size > sizeof(save_iv)))
+    if ((iv_size > *message_length) ||
+        (iv_size > sizeof(save_iv)))
 #else
-        if (iv_size > message_length)
+    if (iv_size > *message_length)
 #endif
-        {
+    {
 
-            /* Message length error. */
-            return(NX_SECURE_TLS_PADDING_CHECK_FAILED);
-        }
+        /* Message length error. */
+        return(NX_SECURE_TLS_PADDING_CHECK_FAILED);
+    }
 
 #if (NX_SECURE_TLS_TLS_1_0_ENABLED)
-        /* TLS 1.0 does not include the IV in the record, so use the one from the session.*/
-        if (tls_session -> nx_secure_tls_protocol_version != NX_SECURE_TLS_VERSION_TLS_1_0)
+    /* TLS 1.0 does not include the IV in the record, so use the one from the session.*/
+    if (tls_session -> nx_secure_tls_protocol_version != NX_SECURE_TLS_VERSION_TLS_1_0)
 #endif
-        {
-            /* Copy IV from the beginning of the payload into our session buffer. */
-            status = nx_packet_data_extract_offset(encrypted_packet, offset,
-                                                   iv, iv_size, &bytes_copied);
-            if (status || (bytes_copied != iv_size))
-            {
-                return(status);
-            }
-            offset += iv_size;
-
-            /* Adjust payload length to account for IV that we saved off above. */
-            message_length -= iv_size;
-        }
-
-        /* Decrypt the message payload using the session crypto method, and move the decrypted data to the beginning of the buffer. */
-        status = _nx_secure_tls_record_chained_packet_decrypt(tls_session, encrypted_packet, offset,
-                                                            message_length, decrypted_packet,
-                                                            NX_NULL, 0, iv,
-                                                            wait_option);
-
-        if(status != NX_CRYPTO_SUCCESS)
+    {
+        /* Copy IV from the beginning of the payload into our session buffer. */
+        status = nx_packet_data_extract_offset(encrypted_packet, *offset,
+                                               iv, iv_size, &bytes_copied);
+        if (status || (bytes_copied != iv_size))
         {
             return(status);
         }
+        *offset += iv_size;
 
-        if (session_cipher_method -> nx_crypto_operation == NX_NULL)
-        {
-            return(NX_SECURE_TLS_SUCCESS);
-        }
-
-#if (NX_SECURE_TLS_TLS_1_0_ENABLED)
-        /* Update our IV for CBC mode. */
-        if (tls_session -> nx_secure_tls_protocol_version == NX_SECURE_TLS_VERSION_TLS_1_0)
-        {
-            if (session_cipher_method -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CBC)
-            {
-
-                /* New IV is the last encrypted block of the output. */
-                status = nx_packet_data_extract_offset(encrypted_packet, (offset + message_length) - iv_size,
-                                                       iv, iv_size, &bytes_copied);
-                if (status || (bytes_copied != iv_size))
-                {
-                    nx_secure_tls_packet_release(*decrypted_packet);
-                    return(status);
-                }
-            }
-        }
-#endif
-
-        /* Get padding length from the final byte - CBC padding consists of a number of
-           bytes each with a value equal to the padding length (e.g. 0x3 0x3 0x3 for 3 bytes of padding). */
-        message_length = (*decrypted_packet) -> nx_packet_length;
-        status = nx_packet_data_extract_offset(*decrypted_packet, message_length - 1,
-                                               &padding_length, 1, &bytes_copied);
-        if (status || (bytes_copied != 1))
-        {
-            nx_secure_tls_packet_release(*decrypted_packet);
-            return(NX_SECURE_TLS_PADDING_CHECK_FAILED);
-        }
-
-        /* If padding length is greater than our length,
-          we have an error - don't check padding. */
-        if (padding_length < message_length)
-        {
-            status = NX_SUCCESS;
-
-            /* Check all padding values. */
-            offset = (UINT)(message_length - (UINT)(1 + padding_length));
-            while ((offset < (message_length - 1)) && (status == NX_SUCCESS))
-            {
-                copy_size = (UCHAR)(((message_length - 1) - offset) & 0xFF);
-                if (copy_size > sizeof(_nx_secure_tls_record_block_buffer))
-                {
-                    copy_size = sizeof(_nx_secure_tls_record_block_buffer);
-                }
-                status = nx_packet_data_extract_offset(*decrypted_packet,
-                                                       offset, _nx_secure_tls_record_block_buffer,
-                                                       copy_size, &bytes_copied);
-                if (status)
-                {
-                    nx_secure_tls_packet_release(*decrypted_packet);
-                    return(NX_SECURE_TLS_PADDING_CHECK_FAILED);
-                }
-
-                offset += bytes_copied;
-
-                for(i = 0; i < bytes_copied; i++)
-                {
-                    if(_nx_secure_tls_record_block_buffer[i] != padding_length)
-                    {
-
-                        /* Padding byte is incorrect! */
-                        status = NX_SECURE_TLS_PADDING_CHECK_FAILED;
-                        break;
-                    }
-                }
-            }
-        }
-        else
-        {
-            /* Decryption or padding error! */
-            status = NX_SECURE_TLS_PADDING_CHECK_FAILED;
-        }
-
-        /* Adjust length to remove padding. */
-        /* Simply set packet length. The packet will be adjusted by caller. */
-        message_length -= (UINT)(padding_length + 1);
-        (*decrypted_packet) -> nx_packet_length = message_length;
-
-        /* Return error status if appropriate. */
-        if(status != NX_SUCCESS)
-        {
-            nx_secure_tls_packet_release(*decrypted_packet);
-            return(status);
-        }
+        /* Adjust payload length to account for IV that we saved off above. */
+        *message_length -= iv_size;
     }
 
-    return(NX_SUCCESS);
+    *iv_ptr = iv;
+
+    return(NX_SECURE_TLS_SUCCESS);
 }
 
 /**************************************************************************/
@@ -519,8 +766,9 @@ UCHAR                                 nonce[13];
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    [nx_crypto_operation]                 Crypto operation              */
-/*    _nx_secure_tls_record_packet_decrypt  Decrypt packet in one packet  */
+/*    _nx_secure_tls_record_decrypt_begin   Initialize decryption         */
+/*    _nx_secure_tls_record_decrypt_blocks  Decrypt record data           */
+/*    _nx_secure_tls_record_decrypt_end     Check ICV                     */
 /*    nx_secure_tls_packet_release          Release packet                */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -541,14 +789,9 @@ static UINT _nx_secure_tls_record_chained_packet_decrypt(NX_SECURE_TLS_SESSION *
                                                          UCHAR *iv, UINT wait_option)
 {
 UINT status;
-UCHAR *icv_ptr;
 UINT icv_size;
-UINT bytes_processed;
-ULONG bytes_copied;
 NX_PACKET *packet_ptr;
 UINT icv_offset = offset;
-VOID *handler = NX_NULL;
-VOID *crypto_method_metadata;
 const NX_CRYPTO_METHOD *session_cipher_method;
 
     /* Get ICV size. It is zero for CBC mode and non zero for AEAD mode. */
@@ -563,6 +806,97 @@ const NX_CRYPTO_METHOD *session_cipher_method;
     message_length -= icv_size;
     icv_offset += message_length;
 
+    /* Initialize the cipher and allocate the packet for decrypted data. */
+    status = _nx_secure_tls_record_decrypt_begin(tls_session, additional_data, additional_data_size,
+                                                 iv, message_length, &packet_ptr, wait_option);
+    if (status)
+    {
+        return(status);
+    }
+
+    /* Decrypt data in chained packet. */
+    status = _nx_secure_tls_record_decrypt_blocks(tls_session, encrypted_packet, offset, message_length,
+                                                  packet_ptr, wait_option);
+    if (status)
+    {
+        nx_secure_tls_packet_release(packet_ptr);
+        return(status);
+    }
+
+    /* Check the ICV. */
+    status = _nx_secure_tls_record_decrypt_end(tls_session, encrypted_packet, icv_offset, icv_size);
+    if (status)
+    {
+        nx_secure_tls_packet_release(packet_ptr);
+        return(status);
+    }
+
+    *decrypted_packet = packet_ptr;
+    return(NX_SECURE_TLS_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_decrypt_begin                 PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function initializes the session cipher for an incoming        */
+/*    record and allocates the packet that receives the decrypted data.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    additional_data                       Pointer to additional data    */
+/*    additional_data_size                  Size of additional data       */
+/*    iv                                    Pointer to initial vector     */
+/*    message_length                        Length of data to decrypt     */
+/*    decrypted_packet                      Output decrypted packet       */
+/*    wait_option                           Control timeout options       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_crypto_operation]                 Crypto operation              */
+/*    nx_packet_allocate                    Allocate packet               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_record_chained_packet_decrypt                        */
+/*                                          Decrypt chained packet        */
+/*    _nx_secure_tls_record_payload_decrypt_stream                        */
+/*                                          Decrypt TLS record as it      */
+/*                                            arrives                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_secure_tls_record_decrypt_begin(NX_SECURE_TLS_SESSION *tls_session,
+                                                UCHAR *additional_data, UINT additional_data_size,
+                                                UCHAR *iv, UINT message_length,
+                                                NX_PACKET **decrypted_packet, UINT wait_option)
+{
+UINT status;
+NX_PACKET *packet_ptr;
+VOID *handler = NX_NULL;
+VOID *crypto_method_metadata;
+const NX_CRYPTO_METHOD *session_cipher_method;
+
+    session_cipher_method = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher;
+
     /* Select our proper data structures. */
     if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_SERVER)
     {
@@ -611,14 +945,77 @@ const NX_CRYPTO_METHOD *session_cipher_method;
     }
     packet_ptr -> nx_packet_last = packet_ptr;
 
+    *decrypted_packet = packet_ptr;
+    return(NX_SECURE_TLS_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_decrypt_blocks                PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function decrypts record data in a chained packet and appends  */
+/*    it to the decrypted packet.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    encrypted_packet                      Pointer to packet containing  */
+/*                                            encrypted data              */
+/*    offset                                Offset of data to decrypt     */
+/*    message_length                        Length of data to decrypt     */
+/*    decrypted_packet                      Pointer to packet containing  */
+/*                                            decrypted data              */
+/*    wait_option                           Control timeout options       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_record_packet_decrypt  Decrypt packet in one packet  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_record_chained_packet_decrypt                        */
+/*                                          Decrypt chained packet        */
+/*    _nx_secure_tls_record_payload_decrypt_stream                        */
+/*                                          Decrypt TLS record as it      */
+/*                                            arrives                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_secure_tls_record_decrypt_blocks(NX_SECURE_TLS_SESSION *tls_session,
+                                                 NX_PACKET *encrypted_packet, UINT offset,
+                                                 UINT message_length, NX_PACKET *decrypted_packet,
+                                                 UINT wait_option)
+{
+UINT status;
+UINT bytes_processed;
+const NX_CRYPTO_METHOD *session_cipher_method;
+
+    session_cipher_method = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher;
+
     /* Loop to decrypt data in chained packet. */
     while (message_length > 0)
     {
         status = _nx_secure_tls_record_packet_decrypt(tls_session, session_cipher_method, encrypted_packet,
-                                                      offset, message_length, packet_ptr, &bytes_processed, wait_option);
+                                                      offset, message_length, decrypted_packet, &bytes_processed, wait_option);
         if (status)
         {
-            nx_secure_tls_packet_release(packet_ptr);
             return(status);
         }
 
@@ -626,7 +1023,6 @@ const NX_CRYPTO_METHOD *session_cipher_method;
         {
 
             /* Error. We should never hit here. */
-            nx_secure_tls_packet_release(packet_ptr);
             return(NX_SECURE_TLS_INVALID_PACKET);
         }
 
@@ -634,14 +1030,91 @@ const NX_CRYPTO_METHOD *session_cipher_method;
         message_length -= bytes_processed;
     }
 
+    return(NX_SECURE_TLS_SUCCESS);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_decrypt_end                   PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function finishes the decryption of an incoming record and     */
+/*    checks the ICV for AEAD ciphers.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    encrypted_packet                      Pointer to packet containing  */
+/*                                            encrypted data              */
+/*    icv_offset                            Offset of ICV                 */
+/*    icv_size                              Size of ICV                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_crypto_operation]                 Crypto operation              */
+/*    nx_packet_data_extract_offset         Extract data from packet      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_record_chained_packet_decrypt                        */
+/*                                          Decrypt chained packet        */
+/*    _nx_secure_tls_record_payload_decrypt_stream                        */
+/*                                          Decrypt TLS record as it      */
+/*                                            arrives                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_secure_tls_record_decrypt_end(NX_SECURE_TLS_SESSION *tls_session,
+                                              NX_PACKET *encrypted_packet, UINT icv_offset, UINT icv_size)
+{
+UINT status;
+UCHAR *icv_ptr;
+ULONG bytes_copied;
+VOID *handler = NX_NULL;
+VOID *crypto_method_metadata;
+const NX_CRYPTO_METHOD *session_cipher_method;
+
+    session_cipher_method = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher;
+
     if (session_cipher_method -> nx_crypto_operation == NX_NULL)
     {
 
         /* Nothing to do for null encryption. */
-        *decrypted_packet = packet_ptr;
         return(NX_SECURE_TLS_SUCCESS);
     }
 
+    /* Select our proper data structures. */
+    if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_SERVER)
+    {
+
+        /* The socket is a TLS server, so use the *CLIENT* cipher to decrypt. */
+        crypto_method_metadata = tls_session -> nx_secure_session_cipher_metadata_area_client;
+        handler = tls_session -> nx_secure_session_cipher_handler_client;
+    }
+    else
+    {
+
+        /* The socket is a TLS client, so use the *SERVER* cipher to decrypt. */
+        crypto_method_metadata = tls_session -> nx_secure_session_cipher_metadata_area_server;
+        handler = tls_session -> nx_secure_session_cipher_handler_server;
+    }
+
     /* Extract ICV. */
     icv_ptr = _nx_secure_tls_record_block_buffer;
     if (icv_size > 0)
@@ -650,7 +1123,6 @@ const NX_CRYPTO_METHOD *session_cipher_method;
                                                icv_ptr, icv_size, &bytes_copied);
         if (status || (bytes_copied != icv_size))
         {
-            nx_secure_tls_packet_release(packet_ptr);
             return(status);
         }
     }
@@ -668,21 +1140,125 @@ const NX_CRYPTO_METHOD *session_cipher_method;
                                                           tls_session -> nx_secure_session_cipher_metadata_size,
                                                           NX_NULL, NX_NULL);
 
-    if (status)
+    if (status == NX_CRYPTO_AUTHENTICATION_FAILED)
     {
-        nx_secure_tls_packet_release(packet_ptr);
-        if (status == NX_CRYPTO_AUTHENTICATION_FAILED)
-        {
-            return(NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
-        }
-        else
+        return(NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
+    }
+
+    return(status);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_padding_check                 PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks the CBC padding at the end of a decrypted      */
+/*    record and removes it from the packet length.                       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    decrypted_packet                      Pointer to packet containing  */
+/*                                            decrypted data              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_packet_data_extract_offset         Extract data from packet      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_record_payload_decrypt Decrypt TLS record payload    */
+/*    _nx_secure_tls_record_payload_decrypt_stream                        */
+/*                                          Decrypt TLS record as it      */
+/*                                            arrives                     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_secure_tls_record_padding_check(NX_PACKET *decrypted_packet)
+{
+UINT  status;
+UINT  message_length;
+UINT  offset;
+UINT  i;
+UCHAR padding_length;
+UCHAR copy_size;
+ULONG bytes_copied;
+
+    /* Get padding length from the final byte - CBC padding consists of a number of
+       bytes each with a value equal to the padding length (e.g. 0x3 0x3 0x3 for 3 bytes of padding). */
+    message_length = decrypted_packet -> nx_packet_length;
+    status = nx_packet_data_extract_offset(decrypted_packet, message_length - 1,
+                                           &padding_length, 1, &bytes_copied);
+    if (status || (bytes_copied != 1))
+    {
+        return(NX_SECURE_TLS_PADDING_CHECK_FAILED);
+    }
+
+    /* If padding length is greater than our length,
+      we have an error - don't check padding. */
+    if (padding_length < message_length)
+    {
+        status = NX_SUCCESS;
+
+        /* Check all padding values. */
+        offset = (UINT)(message_length - (UINT)(1 + padding_length));
+        while ((offset < (message_length - 1)) && (status == NX_SUCCESS))
         {
-            return(status);
+            copy_size = (UCHAR)(((message_length - 1) - offset) & 0xFF);
+            if (copy_size > sizeof(_nx_secure_tls_record_block_buffer))
+            {
+                copy_size = sizeof(_nx_secure_tls_record_block_buffer);
+            }
+            status = nx_packet_data_extract_offset(decrypted_packet,
+                                                   offset, _nx_secure_tls_record_block_buffer,
+                                                   copy_size, &bytes_copied);
+            if (status)
+            {
+                return(NX_SECURE_TLS_PADDING_CHECK_FAILED);
+            }
+
+            offset += bytes_copied;
+
+            for(i = 0; i < bytes_copied; i++)
+            {
+                if(_nx_secure_tls_record_block_buffer[i] != padding_length)
+                {
+
+                    /* Padding byte is incorrect! */
+                    status = NX_SECURE_TLS_PADDING_CHECK_FAILED;
+                    break;
+                }
+            }
         }
     }
+    else
+    {
+        /* Decryption or padding error! */
+        status = NX_SECURE_TLS_PADDING_CHECK_FAILED;
+    }
 
-    *decrypted_packet = packet_ptr;
-    return(NX_SECURE_TLS_SUCCESS);
+    /* Adjust length to remove padding. */
+    /* Simply set packet length. The packet will be adjusted by caller. */
+    message_length -= (UINT)(padding_length + 1);
+    decrypted_packet -> nx_packet_length = message_length;
+
+    return(status);
 }
 
 /**************************************************************************/
@@ -727,8 +1303,7 @@ const NX_CRYPTO_METHOD *session_cipher_method;
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
-/*    _nx_secure_tls_record_chained_packet_decrypt                        */
-/*                                          Decrypt chained packet        */
+/*    _nx_secure_tls_record_decrypt_blocks  Decrypt record data           */
 /*                                                                        */
 /*  RELEASE HISTORY                                                       */
 /*                                                                        */
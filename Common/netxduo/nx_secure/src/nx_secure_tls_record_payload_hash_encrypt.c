@@ -0,0 +1,427 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+
+/* Size of the buffer holding the trailing partial block, the MAC and the padding,
+   for ciphers with blocks up to 16 bytes (AES).  */
+#define NX_SECURE_TLS_RECORD_TAIL_SIZE     (NX_SECURE_TLS_MAX_HASH_SIZE + (2 * 16))
+
+static UINT _nx_secure_tls_record_chain_encrypt(NX_SECURE_TLS_SESSION *tls_session,
+                                                const NX_CRYPTO_METHOD *session_cipher_method,
+                                                VOID *handler, VOID *crypto_method_metadata,
+                                                UCHAR *data, ULONG length);
+static VOID _nx_secure_tls_record_chain_write(NX_PACKET *packet_ptr, ULONG offset, UCHAR *data, ULONG length);
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_payload_hash_encrypt          PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the MAC of an outgoing TLS record and        */
+/*    encrypts it with a CBC-mode session cipher in a single pass over the*/
+/*    packet chain. Each packet is hashed and then encrypted in place.    */
+/*    Blocks that straddle two packets are encrypted in a small carry     */
+/*    buffer and written back. The trailing partial block, the MAC and    */
+/*    the padding are encrypted together before MAC and padding are       */
+/*    appended to the record.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    send_packet                           Pointer to packet data        */
+/*    record_header                         Pointer to record header      */
+/*    iv_size                               Size of explicit IV in record */
+/*    wait_option                           Suspension option             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _nx_secure_tls_record_hash_initialize Initialize record hash        */
+/*    _nx_secure_tls_record_hash_update     Update record hash            */
+/*    _nx_secure_tls_record_hash_calculate  Calculate record hash         */
+/*    _nx_secure_tls_record_chain_encrypt   Encrypt data in place         */
+/*    _nx_secure_tls_record_chain_write     Write data into packet chain  */
+/*    nx_packet_data_append                 Append data to packet         */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_send_record            Send TLS encrypted record     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_secure_tls_record_payload_hash_encrypt(NX_SECURE_TLS_SESSION *tls_session, NX_PACKET *send_packet,
+                                                UCHAR *record_header, USHORT iv_size, ULONG wait_option)
+{
+UINT                    status;
+UCHAR                  *iv;
+UCHAR                  *mac_secret;
+VOID                   *handler;
+VOID                   *crypto_method_metadata;
+const NX_CRYPTO_METHOD *session_cipher_method;
+UINT                    block_size;
+UINT                    hash_length;
+NX_PACKET              *current_packet;
+NX_PACKET              *carry_packet = NX_NULL;
+UCHAR                  *data;
+ULONG                   data_length;
+ULONG                   rounded_length;
+ULONG                   copy_length;
+ULONG                   data_offset;
+ULONG                   carry_offset = 0;
+UINT                    carry_length = 0;
+UINT                    tail_length;
+UCHAR                   padding_length;
+UCHAR                   tail[NX_SECURE_TLS_RECORD_TAIL_SIZE];
+
+    /* Select IV, cipher and MAC secret based on the current mode. */
+    if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_SERVER)
+    {
+        iv = tls_session -> nx_secure_tls_key_material.nx_secure_tls_server_iv;
+        handler = tls_session -> nx_secure_session_cipher_handler_server;
+        crypto_method_metadata = tls_session -> nx_secure_session_cipher_metadata_area_server;
+        mac_secret = tls_session -> nx_secure_tls_key_material.nx_secure_tls_server_write_mac_secret;
+    }
+    else
+    {
+        iv = tls_session -> nx_secure_tls_key_material.nx_secure_tls_client_iv;
+        handler = tls_session -> nx_secure_session_cipher_handler_client;
+        crypto_method_metadata = tls_session -> nx_secure_session_cipher_metadata_area_client;
+        mac_secret = tls_session -> nx_secure_tls_key_material.nx_secure_tls_client_write_mac_secret;
+    }
+
+    session_cipher_method = tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher;
+    block_size = session_cipher_method -> nx_crypto_block_size_in_bytes;
+
+    /* The carried block, MAC and padding must fit the tail buffer. */
+    if ((block_size == 0) || ((2 * block_size) + NX_SECURE_TLS_MAX_HASH_SIZE > sizeof(tail)))
+    {
+        return(NX_SECURE_TLS_INVALID_STATE);
+    }
+
+    /* Copy the explicit IV (not used in TLS 1.0) to the head of the payload. */
+    if (iv_size)
+    {
+        if (iv_size != block_size)
+        {
+            return(NX_SECURE_TLS_INVALID_STATE);
+        }
+
+        NX_SECURE_MEMCPY(send_packet -> nx_packet_prepend_ptr, iv, iv_size); /* Use case of memcpy is verified. */
+    }
+
+    status = session_cipher_method -> nx_crypto_operation(NX_CRYPTO_ENCRYPT_INITIALIZE,
+                                                          handler,
+                                                          (NX_CRYPTO_METHOD*)session_cipher_method,
+                                                          NX_NULL,
+                                                          0,
+                                                          NX_NULL,
+                                                          0,
+                                                          iv,
+                                                          NX_NULL,
+                                                          0,
+                                                          crypto_method_metadata,
+                                                          tls_session -> nx_secure_session_cipher_metadata_size,
+                                                          NX_NULL, NX_NULL);
+    if (status)
+    {
+        return(status);
+    }
+
+    /* Initialize the hash routine with our MAC secret, sequence number, and header. */
+    status = _nx_secure_tls_record_hash_initialize(tls_session, tls_session -> nx_secure_tls_local_sequence_number,
+                                                   record_header, 5, &hash_length, mac_secret);
+    if (status)
+    {
+        return(status);
+    }
+
+    /* Walk the packet chain once. The plaintext of each packet is hashed before it is
+       encrypted in place. The IV at the head of the first packet is neither hashed nor encrypted. */
+    data_offset = iv_size;
+    for (current_packet = send_packet; current_packet != NX_NULL; current_packet = current_packet -> nx_packet_next)
+    {
+        data = current_packet -> nx_packet_prepend_ptr + data_offset;
+        data_length = (ULONG)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr) - data_offset;
+        data_offset = 0;
+
+        if (data_length == 0)
+        {
+            continue;
+        }
+
+        status = _nx_secure_tls_record_hash_update(tls_session, data, (UINT)data_length);
+        if (status)
+        {
+            break;
+        }
+
+        /* Complete a block carried over from the previous packets. */
+        if (carry_length)
+        {
+            copy_length = block_size - carry_length;
+            if (copy_length > data_length)
+            {
+                copy_length = data_length;
+            }
+
+            NX_SECURE_MEMCPY(&tail[carry_length], data, copy_length); /* Use case of memcpy is verified. */
+            carry_length += (UINT)copy_length;
+            data += copy_length;
+            data_length -= copy_length;
+
+            if (carry_length == block_size)
+            {
+                status = _nx_secure_tls_record_chain_encrypt(tls_session, session_cipher_method, handler,
+                                                             crypto_method_metadata, tail, block_size);
+                if (status)
+                {
+                    break;
+                }
+
+                _nx_secure_tls_record_chain_write(carry_packet, carry_offset, tail, block_size);
+                carry_length = 0;
+            }
+        }
+
+        /* Encrypt whole blocks in place. */
+        rounded_length = data_length - (data_length % block_size);
+        if (rounded_length)
+        {
+            status = _nx_secure_tls_record_chain_encrypt(tls_session, session_cipher_method, handler,
+                                                         crypto_method_metadata, data, rounded_length);
+            if (status)
+            {
+                break;
+            }
+        }
+
+        /* Carry the partial block at the end of this packet. */
+        if (data_length > rounded_length)
+        {
+            carry_packet = current_packet;
+            carry_offset = (ULONG)(data + rounded_length - current_packet -> nx_packet_prepend_ptr);
+            carry_length = (UINT)(data_length - rounded_length);
+            NX_SECURE_MEMCPY(tail, data + rounded_length, carry_length); /* Use case of memcpy is verified. */
+        }
+    }
+
+    if (status == NX_SUCCESS)
+    {
+
+        /* Build the tail: carried plaintext, MAC, then padding. */
+        status = _nx_secure_tls_record_hash_calculate(tls_session, &tail[carry_length], &hash_length);
+    }
+
+    if (status == NX_SUCCESS)
+    {
+        tail_length = carry_length + hash_length;
+        padding_length = (UCHAR)(block_size - (tail_length % block_size));
+        NX_SECURE_MEMSET(&tail[tail_length], padding_length - 1, padding_length);
+        tail_length += padding_length;
+
+        status = _nx_secure_tls_record_chain_encrypt(tls_session, session_cipher_method, handler,
+                                                     crypto_method_metadata, tail, tail_length);
+    }
+
+    if (status != NX_SUCCESS)
+    {
+#ifdef NX_SECURE_KEY_CLEAR
+        NX_SECURE_MEMSET(tail, 0, sizeof(tail));
+#endif /* NX_SECURE_KEY_CLEAR  */
+        return(status);
+    }
+
+    /* Put the encrypted carry bytes back in place. */
+    if (carry_length)
+    {
+        _nx_secure_tls_record_chain_write(carry_packet, carry_offset, tail, carry_length);
+    }
+
+    /* CBC-mode ciphers need to have their IV's updated after encryption.
+       New IV is the last encrypted block of the output. */
+    NX_SECURE_MEMCPY(iv, &tail[tail_length - block_size], block_size); /* Use case of memcpy is verified. */
+
+    /* Release the protection before suspending on nx_packet_data_append. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    /* Append the encrypted MAC and padding. */
+    status = nx_packet_data_append(send_packet, &tail[carry_length], tail_length - carry_length,
+                                   tls_session -> nx_secure_tls_packet_pool, wait_option);
+
+    /* Get the protection after nx_packet_data_append. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+#ifdef NX_SECURE_KEY_CLEAR
+    NX_SECURE_MEMSET(tail, 0, sizeof(tail));
+#endif /* NX_SECURE_KEY_CLEAR  */
+
+    return(status);
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_chain_encrypt                 PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encrypts a buffer in place with the session cipher.   */
+/*    The length must be a multiple of the cipher block size.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    session_cipher_method                 Session cipher method         */
+/*    handler                               Cipher handler                */
+/*    crypto_method_metadata                Cipher metadata               */
+/*    data                                  Pointer to data               */
+/*    length                                Length of data                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    [nx_crypto_operation]                 Encryption cipher             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_record_payload_hash_encrypt                          */
+/*                                          Hash and encrypt record       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_secure_tls_record_chain_encrypt(NX_SECURE_TLS_SESSION *tls_session,
+                                                const NX_CRYPTO_METHOD *session_cipher_method,
+                                                VOID *handler, VOID *crypto_method_metadata,
+                                                UCHAR *data, ULONG length)
+{
+
+    return(session_cipher_method -> nx_crypto_operation(NX_CRYPTO_ENCRYPT_UPDATE,
+                                                        handler,
+                                                        (NX_CRYPTO_METHOD *)session_cipher_method,
+                                                        NX_NULL,
+                                                        0,
+                                                        data,
+                                                        length,
+                                                        NX_NULL,
+                                                        data,
+                                                        length,
+                                                        crypto_method_metadata,
+                                                        tls_session -> nx_secure_session_cipher_metadata_size,
+                                                        NX_NULL, NX_NULL));
+}
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_chain_write                   PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function copies data into a packet chain starting at an offset */
+/*    into the given packet, continuing into the following packets.       */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    packet_ptr                            Pointer to first packet       */
+/*    offset                                Offset into first packet      */
+/*    data                                  Pointer to data               */
+/*    length                                Length of data                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_record_payload_hash_encrypt                          */
+/*                                          Hash and encrypt record       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static VOID _nx_secure_tls_record_chain_write(NX_PACKET *packet_ptr, ULONG offset, UCHAR *data, ULONG length)
+{
+ULONG copy_length;
+
+    while ((length > 0) && (packet_ptr != NX_NULL))
+    {
+        copy_length = (ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr) - offset;
+        if (copy_length > length)
+        {
+            copy_length = length;
+        }
+
+        NX_SECURE_MEMCPY(packet_ptr -> nx_packet_prepend_ptr + offset, data, copy_length); /* Use case of memcpy is verified. */
+        data += copy_length;
+        length -= copy_length;
+
+        /* Continue at the start of the next packet. */
+        offset = 0;
+        packet_ptr = packet_ptr -> nx_packet_next;
+    }
+}
@@ -128,7 +128,7 @@ ULONG                             current_time;
 
     /* Now verify our remote certificate chain. If the certificate can be linked to an issuer in the trusted store
        through an issuer chain, this function will return NX_SUCCESS. */
-    status = _nx_secure_x509_certificate_chain_verify(store, remote_certificate);
+    status = _nx_secure_x509_certificate_chain_verify(store, remote_certificate, current_time);
 
     if (status != NX_SUCCESS)
     {
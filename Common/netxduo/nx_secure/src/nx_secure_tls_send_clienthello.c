@@ -100,6 +100,10 @@ UINT                        status;
 UINT                        fallback_enabled = NX_FALSE;
 const NX_SECURE_TLS_CRYPTO *crypto_table;
 ULONG                      extension_length, total_extensions_length;
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+NX_SECURE_TLS_SESSION_RESUMPTION
+                           *resumption;
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
 
 
     /* ClientHello structure:
@@ -153,6 +157,28 @@ ULONG                      extension_length, total_extensions_length;
         ciphersuites_length = (USHORT)(ciphersuites_length + 2);
     }
 
+    /* No session ID is sent unless we have a previous session with this server to resume. */
+    tls_session -> nx_secure_tls_session_id_length = 0;
+
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+    /* Offer the session ID saved from an earlier full handshake, provided it was negotiated with
+       the version we are about to propose. Renegotiation always performs a full handshake. */
+    resumption = tls_session -> nx_secure_tls_session_resumption_ptr;
+    if ((resumption != NX_NULL) &&
+        (resumption -> nx_secure_tls_resumption_session_id_length > 0) &&
+        (resumption -> nx_secure_tls_resumption_session_id_length <= NX_SECURE_TLS_RESUMPTION_SESSION_ID_SIZE) &&
+        (resumption -> nx_secure_tls_resumption_protocol_version == protocol_version) &&
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+        (!tls_session -> nx_secure_tls_1_3) &&
+#endif
+        (!tls_session -> nx_secure_tls_local_session_active))
+    {
+        NX_SECURE_MEMCPY(tls_session -> nx_secure_tls_session_id, resumption -> nx_secure_tls_resumption_session_id,
+                         resumption -> nx_secure_tls_resumption_session_id_length); /* Use case of memcpy is verified. */
+        tls_session -> nx_secure_tls_session_id_length = (UCHAR)resumption -> nx_secure_tls_resumption_session_id_length;
+    }
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
+
     if (((ULONG)(send_packet -> nx_packet_data_end) - (ULONG)(send_packet -> nx_packet_append_ptr)) <
         (9u + sizeof(tls_session -> nx_secure_tls_key_material.nx_secure_tls_client_random) +
          tls_session -> nx_secure_tls_session_id_length + ciphersuites_length))
@@ -203,7 +229,6 @@ ULONG                      extension_length, total_extensions_length;
     length += sizeof(tls_session -> nx_secure_tls_key_material.nx_secure_tls_client_random);
 
     /* Session ID length is one byte. */
-    tls_session -> nx_secure_tls_session_id_length  = 0;
     packet_buffer[length] = tls_session -> nx_secure_tls_session_id_length;
     length++;
 
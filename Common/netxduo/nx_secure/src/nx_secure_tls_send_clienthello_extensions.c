@@ -76,6 +76,13 @@ static UINT _nx_secure_tls_send_clienthello_sec_reneg_extension(NX_SECURE_TLS_SE
                                                                 ULONG available_size);
 #endif
 
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+static UINT _nx_secure_tls_send_clienthello_mfl_extension(NX_SECURE_TLS_SESSION *tls_session,
+                                                          UCHAR *packet_buffer, ULONG *packet_offset,
+                                                          USHORT *extension_length,
+                                                          ULONG available_size);
+#endif
+
 
 /**************************************************************************/
 /*                                                                        */
@@ -115,6 +122,9 @@ static UINT _nx_secure_tls_send_clienthello_sec_reneg_extension(NX_SECURE_TLS_SE
 /*                                            extension                   */
 /*    _nx_secure_tls_send_clienthello_sni_extension                       */
 /*                                          Send ClientHello SNI extension*/
+/*    _nx_secure_tls_send_clienthello_mfl_extension                       */
+/*                                          Send ClientHello max fragment */
+/*                                            length extension            */
 /*    _nx_secure_tls_send_clienthello_ec_extension                        */
 /*                                          Send ClientHello EC extension */
 /*                                                                        */
@@ -243,6 +253,16 @@ UINT   status;
     total_extensions_length = (USHORT)(total_extensions_length + extension_length);
 #endif
 
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+    /* Send the max fragment length extension. */
+    status = _nx_secure_tls_send_clienthello_mfl_extension(tls_session, packet_buffer, &length, &extension_length, available_size);
+    if(status != NX_SUCCESS)
+    {
+        return(status);
+    }
+    total_extensions_length = (USHORT)(total_extensions_length + extension_length);
+#endif
+
 #if (NX_SECURE_TLS_TLS_1_3_ENABLED)
     if(tls_session->nx_secure_tls_1_3 && tls_session->nx_secure_tls_credentials.nx_secure_tls_psk_count > 0)
     {
@@ -1717,5 +1737,109 @@ NX_SECURE_TLS_ECC *ecc_info;
     return(NX_SUCCESS);
 }
 #endif /* NX_SECURE_ENABLE_ECC_CIPHERSUITE */
+
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_send_clienthello_mfl_extension       PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds the max_fragment_length extension to an outgoing */
+/*    ClientHello record if the application set a record length limit.    */
+/*    See RFC 6066 section 4. It is not offered for TLS 1.3, which carries*/
+/*    the answer in EncryptedExtensions.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    packet_buffer                         Outgoing TLS packet buffer    */
+/*    packet_offset                         Offset into packet buffer     */
+/*    extension_length                      Return length of data         */
+/*    available_size                        Available size of buffer      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_send_clienthello_extensions                          */
+/*                                          Send TLS ClientHello extension*/
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+
+static UINT _nx_secure_tls_send_clienthello_mfl_extension(NX_SECURE_TLS_SESSION *tls_session,
+                                                          UCHAR *packet_buffer, ULONG *packet_offset,
+                                                          USHORT *extension_length, ULONG available_size)
+{
+ULONG offset;
+
+    /* Max Fragment Length Extension structure:
+     * |     2      |      2        |      1      |
+     * |  Ext Type  |  Ext Length   |  Code (1-4) |
+     */
+
+    /* If no limit was set, or TLS 1.3 is offered, just return. */
+    if ((tls_session -> nx_secure_tls_max_fragment_length_code == 0)
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+        || (tls_session -> nx_secure_tls_1_3)
+#endif
+       )
+    {
+        *extension_length = 0;
+        return(NX_SUCCESS);
+    }
+
+    /* Start with our passed-in packet offset. */
+    offset = *packet_offset;
+
+    if (available_size < (offset + 5u))
+    {
+
+        /* Packet buffer too small. */
+        return(NX_SECURE_TLS_PACKET_BUFFER_TOO_SMALL);
+    }
+
+    /* Put the extension ID into the packet. */
+    packet_buffer[offset] = (UCHAR)((NX_SECURE_TLS_EXTENSION_MAX_FRAGMENT_LENGTH & 0xFF00) >> 8);
+    packet_buffer[offset + 1] = (UCHAR)(NX_SECURE_TLS_EXTENSION_MAX_FRAGMENT_LENGTH & 0x00FF);
+    offset += 2;
+
+    /* The extension data is a single byte. */
+    packet_buffer[offset] = 0;
+    packet_buffer[offset + 1] = 1;
+    offset += 2;
+
+    /* Set the requested code, the limit is 2^(8 + code) bytes. */
+    packet_buffer[offset] = tls_session -> nx_secure_tls_max_fragment_length_code;
+    offset++;
+
+    /* Return the amount of data we wrote. */
+    *extension_length = (USHORT)(offset - *packet_offset);
+
+    /* Return our updated packet offset. */
+    *packet_offset = offset;
+
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
 #endif /* NX_SECURE_TLS_CLIENT_DISABLED */
 
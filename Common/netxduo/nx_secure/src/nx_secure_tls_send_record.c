@@ -42,6 +42,14 @@
 /*    encrypted data). Also, all encryption of application                */
 /*    data is handled here.                                               */
 /*                                                                        */
+/*    Once a maximum fragment length has been negotiated (RFC 6066),      */
+/*    data longer than that length is copied into several records of at   */
+/*    most that length, handshake messages included. The transmit mutex   */
+/*    is held across all of them so no other record comes in between. If  */
+/*    an error occurs after some of them are sent, their data is trimmed  */
+/*    off the front of the packet, so the packet length left tells the    */
+/*    caller how much was consumed.                                       */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    tls_session                           Pointer to TLS session        */
@@ -55,12 +63,17 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _nx_secure_tls_packet_allocate        Allocate internal TLS packet  */
 /*    _nx_secure_tls_record_hash_calculate  Calculate hash of record      */
 /*    _nx_secure_tls_record_hash_initialize Initialize hash of record     */
 /*    _nx_secure_tls_record_hash_update     Update hash of record         */
 /*    _nx_secure_tls_record_payload_encrypt Encrypt payload               */
+/*    _nx_secure_tls_record_payload_hash_encrypt                          */
+/*                                          Hash and encrypt payload      */
+/*    _nx_secure_tls_send_record            Send each fragment record     */
 /*    _nx_secure_tls_session_iv_size_get    Get IV size for this session. */
 /*    nx_packet_data_append                 Append data to packet         */
+/*    nx_secure_tls_packet_release          Release packet                */
 /*    nx_tcp_socket_send                    Send packet                   */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
@@ -100,6 +113,15 @@ ULONG      hash_data_length;
 ULONG      length;
 USHORT     iv_size = 0;
 NX_PACKET *current_packet;
+UINT       single_pass = NX_FALSE;
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+NX_PACKET *record_packet;
+UCHAR     *data_ptr;
+ULONG      sent_length;
+ULONG      fragment_length;
+ULONG      copy_length;
+ULONG      copy_size;
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
 
     /* Length of the data in the packet. */
     length = send_packet -> nx_packet_length;
@@ -127,6 +149,119 @@ NX_PACKET *current_packet;
         return(NX_SECURE_TLS_TRANSMIT_LOCKED);
     }
 
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+    if ((tls_session -> nx_secure_tls_max_fragment_length != 0) &&
+        (length > tls_session -> nx_secure_tls_max_fragment_length))
+    {
+
+        /* No record may be longer than the length negotiated with the server, so copy the data
+           into as many records as needed and send them in order. The transmit mutex is owned
+           here already, so the nested gets for each fragment record do not suspend. */
+        current_packet = send_packet;
+        data_ptr = send_packet -> nx_packet_prepend_ptr;
+        sent_length = 0;
+
+        while (sent_length < length)
+        {
+
+            /* Release the protection before suspending on nx_packet_allocate. */
+            tx_mutex_put(&_nx_secure_tls_protection);
+
+            status = _nx_secure_tls_packet_allocate(tls_session, tls_session -> nx_secure_tls_packet_pool,
+                                                    &record_packet, wait_option);
+
+            /* Get the protection after nx_packet_allocate. */
+            tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+            if (status != NX_SUCCESS)
+            {
+                break;
+            }
+
+            fragment_length = length - sent_length;
+            if (fragment_length > tls_session -> nx_secure_tls_max_fragment_length)
+            {
+                fragment_length = tls_session -> nx_secure_tls_max_fragment_length;
+            }
+
+            /* Copy the next fragment out of the (possibly chained) packet. */
+            copy_length = fragment_length;
+            while ((status == NX_SUCCESS) && (copy_length > 0))
+            {
+                if (data_ptr >= current_packet -> nx_packet_append_ptr)
+                {
+                    current_packet = current_packet -> nx_packet_next;
+                    if (current_packet == NX_NULL)
+                    {
+                        status = NX_SECURE_TLS_INVALID_PACKET;
+                        break;
+                    }
+                    data_ptr = current_packet -> nx_packet_prepend_ptr;
+                    continue;
+                }
+
+                copy_size = (ULONG)(current_packet -> nx_packet_append_ptr - data_ptr);
+                if (copy_size > copy_length)
+                {
+                    copy_size = copy_length;
+                }
+
+                status = nx_packet_data_append(record_packet, data_ptr, copy_size,
+                                               tls_session -> nx_secure_tls_packet_pool, wait_option);
+                data_ptr += copy_size;
+                copy_length -= copy_size;
+            }
+
+            if (status == NX_SUCCESS)
+            {
+                status = _nx_secure_tls_send_record(tls_session, record_packet, record_type, wait_option);
+            }
+
+            if (status != NX_SUCCESS)
+            {
+
+                /* The record wasn't sent, so release its packet. */
+                nx_secure_tls_packet_release(record_packet);
+                break;
+            }
+
+            sent_length += fragment_length;
+        }
+
+        if (status == NX_SUCCESS)
+        {
+
+            /* All of the data went out in other packets, so the packet is consumed here just as
+               it would be by sending it as one record. */
+            nx_secure_tls_packet_release(send_packet);
+        }
+        else if (sent_length > 0)
+        {
+
+            /* Part of the data is already on the wire. Trim it off the front of the packet so
+               the caller sees from the length left how much was consumed. */
+            send_packet -> nx_packet_length -= sent_length;
+            current_packet = send_packet;
+            while ((current_packet != NX_NULL) && (sent_length > 0))
+            {
+                copy_size = (ULONG)(current_packet -> nx_packet_append_ptr - current_packet -> nx_packet_prepend_ptr);
+                if (copy_size > sent_length)
+                {
+                    copy_size = sent_length;
+                }
+                current_packet -> nx_packet_prepend_ptr += copy_size;
+                sent_length -= copy_size;
+                current_packet = current_packet -> nx_packet_next;
+            }
+        }
+
+        /* Release transmit mutex. */
+        tx_mutex_put(&(tls_session -> nx_secure_tls_session_transmit_mutex));
+
+        return(status);
+    }
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+
     /* See if this is an active session, we need to account for the IV if the session cipher
        uses one. TLS 1.3 does not use an explicit IV so don't add it.*/
     if (tls_session -> nx_secure_tls_local_session_active
@@ -233,6 +368,21 @@ NX_PACKET *current_packet;
             tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_hash -> nx_crypto_operation)
         {
 
+            /* CBC records are hashed and encrypted in one pass over the packet chain. */
+            if ((tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher -> nx_crypto_algorithm == NX_CRYPTO_ENCRYPTION_AES_CBC) &&
+                (tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_session_cipher -> nx_crypto_operation))
+            {
+                single_pass = NX_TRUE;
+            }
+        }
+
+        if (!single_pass &&
+#if (NX_SECURE_TLS_TLS_1_3_ENABLED)
+            !tls_session->nx_secure_tls_1_3 && 
+#endif
+            tls_session -> nx_secure_tls_session_ciphersuite -> nx_secure_tls_hash -> nx_crypto_operation)
+        {
+
             /***** HASHING *****/
             /* Select our proper MAC secret for hashing. */
             if (tls_session -> nx_secure_tls_socket_type == NX_SECURE_TLS_SESSION_TYPE_SERVER)
@@ -305,7 +455,14 @@ NX_PACKET *current_packet;
         /*************************************************************************************************************/
         /***** ENCRYPTION *****/
 
-        status = _nx_secure_tls_record_payload_encrypt(tls_session, send_packet, tls_session -> nx_secure_tls_local_sequence_number, record_type);
+        if (single_pass)
+        {
+            status = _nx_secure_tls_record_payload_hash_encrypt(tls_session, send_packet, record_header, iv_size, wait_option);
+        }
+        else
+        {
+            status = _nx_secure_tls_record_payload_encrypt(tls_session, send_packet, tls_session -> nx_secure_tls_local_sequence_number, record_type);
+        }
 
         if (status != NX_SUCCESS)
         {
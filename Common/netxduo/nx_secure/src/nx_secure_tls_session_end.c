@@ -98,6 +98,14 @@ NX_PACKET *tmp_ptr;
         nx_secure_tls_packet_release(tls_session -> nx_secure_record_decrypted_packet);
         tls_session -> nx_secure_record_decrypted_packet = NX_NULL;
     }
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+    if (tls_session -> nx_secure_record_stream_packet)
+    {
+        nx_secure_tls_packet_release(tls_session -> nx_secure_record_stream_packet);
+        tls_session -> nx_secure_record_stream_packet = NX_NULL;
+        tls_session -> nx_secure_record_stream_length = 0;
+    }
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
 
     /* See if we want to send a CloseNotify alert, or if there was an error, don't send
        a CloseNotify, just reset the TLS session. */
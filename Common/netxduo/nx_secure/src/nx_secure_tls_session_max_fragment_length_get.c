@@ -0,0 +1,86 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_max_fragment_length_get      PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the largest plaintext record length that may  */
+/*    be sent on a TLS session. It is the limit negotiated through the    */
+/*    max_fragment_length extension, or the TLS maximum of 16384 bytes if */
+/*    none was negotiated. Callers that gather data into records, such as */
+/*    the MQTT client, use it to size what they pass to                   */
+/*    nx_secure_tls_session_send.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    max_fragment_length                   Return record length limit    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_secure_tls_session_max_fragment_length_get(NX_SECURE_TLS_SESSION *tls_session, UINT *max_fragment_length)
+{
+
+    if (tls_session -> nx_secure_tls_max_fragment_length != 0)
+    {
+        *max_fragment_length = tls_session -> nx_secure_tls_max_fragment_length;
+    }
+    else
+    {
+        *max_fragment_length = NX_SECURE_TLS_MAX_PLAINTEXT_LENGTH;
+    }
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
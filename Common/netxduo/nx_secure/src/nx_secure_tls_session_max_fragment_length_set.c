@@ -0,0 +1,104 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_max_fragment_length_set      PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sets the maximum plaintext record length a TLS Client */
+/*    asks the server to use, through the max_fragment_length extension of*/
+/*    RFC 6066. Valid lengths are 512, 1024, 2048 and 4096 bytes; 0 stops */
+/*    the extension from being offered. The limit only takes effect if the*/
+/*    server echoes it in its ServerHello, after which both sides keep    */
+/*    records within it. The extension is not offered for TLS 1.3.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    max_fragment_length                   Record length limit, or 0     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_secure_tls_session_max_fragment_length_set(NX_SECURE_TLS_SESSION *tls_session, UINT max_fragment_length)
+{
+UCHAR code = 0;
+
+    /* Map the length to its extension code, 2^(8 + code) bytes. */
+    if (max_fragment_length != 0)
+    {
+        for (code = 1; code <= 4; code++)
+        {
+            if (max_fragment_length == (1u << (8 + code)))
+            {
+                break;
+            }
+        }
+
+        if (code > 4)
+        {
+            return(NX_INVALID_PARAMETERS);
+        }
+    }
+
+    /* Get the protection. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    /* Save the code, it is sent in the next ClientHello. */
+    tls_session -> nx_secure_tls_max_fragment_length_code = code;
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
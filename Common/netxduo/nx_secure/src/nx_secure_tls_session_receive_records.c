@@ -24,6 +24,8 @@
 
 #include "nx_secure_tls.h"
 
+static UINT _nx_secure_tls_record_queue_trim(NX_SECURE_TLS_SESSION *tls_session, ULONG bytes_processed);
+
 /**************************************************************************/
 /*                                                                        */
 /*  FUNCTION                                               RELEASE        */
@@ -56,6 +58,7 @@
 /*    _nx_secure_tls_map_error_to_alert     Map internal error to alert   */
 /*    _nx_secure_tls_packet_allocate        Allocate internal TLS packet  */
 /*    _nx_secure_tls_process_record         Process TLS record data       */
+/*    _nx_secure_tls_record_queue_trim      Remove processed record data  */
 /*    _nx_secure_tls_send_alert             Send TLS alert                */
 /*    _nx_secure_tls_send_record            Send the TLS record           */
 /*    nx_secure_tls_packet_release          Release packet                */
@@ -86,13 +89,10 @@ UINT           status;
 NX_PACKET     *packet_ptr;
 NX_TCP_SOCKET *tcp_socket;
 ULONG          bytes_processed = 0;
-ULONG          packet_fragment_length;
 NX_PACKET     *send_packet = NX_NULL;
 UINT           error_number;
 UINT           alert_number;
 UINT           alert_level;
-NX_PACKET     *current_packet;
-NX_PACKET     *previous_packet;
 UCHAR          handshake_finished = NX_FALSE;
 
     /* Get the protection. */
@@ -123,6 +123,21 @@ UCHAR          handshake_finished = NX_FALSE;
 
     while (status == NX_CONTINUE)
     {
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+
+        /* Release the ciphertext of a partial record that has already been decrypted. */
+        if (bytes_processed)
+        {
+            if (_nx_secure_tls_record_queue_trim(tls_session, bytes_processed))
+            {
+
+                /* Release the protection. */
+                tx_mutex_put(&_nx_secure_tls_protection);
+
+                return(NX_SECURE_TLS_INVALID_PACKET);
+            }
+        }
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
 
         /* Release the protection before suspending on nx_tcp_socket_receive. */
         tx_mutex_put(&_nx_secure_tls_protection);
@@ -149,54 +164,8 @@ UCHAR          handshake_finished = NX_FALSE;
     if (status == NX_SUCCESS || status == NX_SECURE_TLS_POST_HANDSHAKE_RECEIVED)
     {
 
-        /* Remove processed packets. Data in released packet will be cleared by nx_secure_tls_packet_release. */
-        tls_session -> nx_secure_record_queue_header -> nx_packet_length -= bytes_processed;
-        current_packet = tls_session -> nx_secure_record_queue_header;
-        previous_packet = NX_NULL;
-        while (current_packet)
-        {
-            packet_fragment_length = (ULONG)(current_packet -> nx_packet_append_ptr) - (ULONG)(current_packet -> nx_packet_prepend_ptr);
-
-            /* Determine if all data in the current fragment have been processed. */
-            if (packet_fragment_length <= bytes_processed)
-            {
-                bytes_processed -= packet_fragment_length;
-            }
-            else
-            {
-                current_packet -> nx_packet_prepend_ptr += bytes_processed;
-                bytes_processed = 0;
-                break;
-            }
-            previous_packet = current_packet;
-            current_packet = current_packet -> nx_packet_next;
-        }
-
-        if (!current_packet)
-        {
-            nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
-            tls_session -> nx_secure_record_queue_header = NX_NULL;
-        }
-        else if (previous_packet)
-        {
-
-            /* Release trimmed packets. */
-            /* Packets from tls_session -> nx_secure_record_queue_header till previous_packet can be trimmed. */
-            previous_packet -> nx_packet_next = NX_NULL;
-
-            /* Update the length and last packet of remaining packets. */
-            current_packet -> nx_packet_length = tls_session -> nx_secure_record_queue_header -> nx_packet_length;
-            current_packet -> nx_packet_last = tls_session -> nx_secure_record_queue_header -> nx_packet_last;
-
-            /* Correct the last packet to be trimmed. */
-            tls_session -> nx_secure_record_queue_header -> nx_packet_last = previous_packet;
-            nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
-
-            /* Update the remaining packets. */
-            tls_session -> nx_secure_record_queue_header = current_packet;
-        }
-
-        if (bytes_processed)
+        /* Remove processed packets. */
+        if (_nx_secure_tls_record_queue_trim(tls_session, bytes_processed))
         {
 
             /* Release the protection. */
@@ -291,3 +260,103 @@ UCHAR          handshake_finished = NX_FALSE;
     return(status);
 }
 
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_record_queue_trim                    PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes processed data from the front of the record   */
+/*    queue and releases the packets that are no longer needed.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    bytes_processed                       Number of bytes processed     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    nx_secure_tls_packet_release          Release packet                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_tls_session_receive_records                              */
+/*                                          Receive TLS records           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+static UINT _nx_secure_tls_record_queue_trim(NX_SECURE_TLS_SESSION *tls_session, ULONG bytes_processed)
+{
+ULONG      packet_fragment_length;
+NX_PACKET *current_packet;
+NX_PACKET *previous_packet;
+
+    /* Remove processed packets. Data in released packet will be cleared by nx_secure_tls_packet_release. */
+    tls_session -> nx_secure_record_queue_header -> nx_packet_length -= bytes_processed;
+    current_packet = tls_session -> nx_secure_record_queue_header;
+    previous_packet = NX_NULL;
+    while (current_packet)
+    {
+        packet_fragment_length = (ULONG)(current_packet -> nx_packet_append_ptr) - (ULONG)(current_packet -> nx_packet_prepend_ptr);
+
+        /* Determine if all data in the current fragment have been processed. */
+        if (packet_fragment_length <= bytes_processed)
+        {
+            bytes_processed -= packet_fragment_length;
+        }
+        else
+        {
+            current_packet -> nx_packet_prepend_ptr += bytes_processed;
+            bytes_processed = 0;
+            break;
+        }
+        previous_packet = current_packet;
+        current_packet = current_packet -> nx_packet_next;
+    }
+
+    if (!current_packet)
+    {
+        nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
+        tls_session -> nx_secure_record_queue_header = NX_NULL;
+    }
+    else if (previous_packet)
+    {
+
+        /* Release trimmed packets. */
+        /* Packets from tls_session -> nx_secure_record_queue_header till previous_packet can be trimmed. */
+        previous_packet -> nx_packet_next = NX_NULL;
+
+        /* Update the length and last packet of remaining packets. */
+        current_packet -> nx_packet_length = tls_session -> nx_secure_record_queue_header -> nx_packet_length;
+        current_packet -> nx_packet_last = tls_session -> nx_secure_record_queue_header -> nx_packet_last;
+
+        /* Correct the last packet to be trimmed. */
+        tls_session -> nx_secure_record_queue_header -> nx_packet_last = previous_packet;
+        nx_secure_tls_packet_release(tls_session -> nx_secure_record_queue_header);
+
+        /* Update the remaining packets. */
+        tls_session -> nx_secure_record_queue_header = current_packet;
+    }
+
+    if (bytes_processed)
+    {
+        return(NX_SECURE_TLS_INVALID_PACKET);
+    }
+
+    return(NX_SUCCESS);
+}
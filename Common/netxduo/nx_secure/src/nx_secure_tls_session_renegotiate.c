@@ -102,6 +102,14 @@ NX_PACKET *send_packet;
     /* Reset the record queue. */
     tls_session -> nx_secure_record_queue_header = NX_NULL;
     tls_session -> nx_secure_record_decrypted_packet = NX_NULL;
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+    if (tls_session -> nx_secure_record_stream_packet)
+    {
+        nx_secure_tls_packet_release(tls_session -> nx_secure_record_stream_packet);
+        tls_session -> nx_secure_record_stream_packet = NX_NULL;
+        tls_session -> nx_secure_record_stream_length = 0;
+    }
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
 
     /* If the session isn't active, trying to renegotiate is an error! */
     if (tls_session -> nx_secure_tls_remote_session_active != NX_TRUE || tls_session -> nx_secure_tls_local_session_active != NX_TRUE)
@@ -115,6 +115,23 @@ UINT temp_status;
         }
     }
 
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+#ifndef NX_SECURE_TLS_CLIENT_DISABLED
+    /* If the server accepted our session ID but the abbreviated handshake did not complete, the
+       saved session is likely no longer valid on the server: drop it so the next connection
+       performs a full handshake. The entry itself stays registered for reuse of the session.
+       The handshake is complete once both directions are encrypted; the client state can not
+       tell, as the close_notify sent when the session ends moves it to ALERT_SENT. */
+    if ((session_ptr -> nx_secure_tls_session_resumption_ptr != NX_NULL) &&
+        (session_ptr -> nx_secure_tls_session_resumed) &&
+        (!session_ptr -> nx_secure_tls_local_session_active || !session_ptr -> nx_secure_tls_remote_session_active))
+    {
+        session_ptr -> nx_secure_tls_session_resumption_ptr -> nx_secure_tls_resumption_session_id_length = 0;
+    }
+#endif /* NX_SECURE_TLS_CLIENT_DISABLED */
+    session_ptr -> nx_secure_tls_session_resumed = NX_FALSE;
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
+
     /* Reset socket type. */
     session_ptr -> nx_secure_tls_socket_type = NX_SECURE_TLS_SESSION_TYPE_NONE;
 
@@ -164,6 +181,11 @@ UINT temp_status;
     /* Flag to indicate when credentials have been received from the remote host. */
     session_ptr -> nx_secure_tls_received_remote_credentials = NX_FALSE;
 
+#ifndef NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH
+    /* The record length limit is negotiated again in the next handshake. */
+    session_ptr -> nx_secure_tls_max_fragment_length = 0;
+#endif /* NX_SECURE_TLS_DISABLE_MAX_FRAGMENT_LENGTH */
+
 #ifndef NX_SECURE_TLS_SERVER_DISABLED
     /* The state of the server handshake if this is a server socket. */
     session_ptr -> nx_secure_tls_server_state = NX_SECURE_TLS_SERVER_STATE_IDLE;
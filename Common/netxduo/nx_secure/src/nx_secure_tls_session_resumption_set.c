@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    Transport Layer Security (TLS)                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+
+#include "nx_secure_tls.h"
+
+#ifndef NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_tls_session_resumption_set               PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function registers an application-owned resumption entry with  */
+/*    a TLS Client session. If the entry holds a session ID from an       */
+/*    earlier full handshake with the same server, that ID is offered in  */
+/*    the ClientHello and, if the server accepts it, the abbreviated      */
+/*    handshake skips certificate verification and the key exchange.      */
+/*    After every full handshake TLS updates the entry with the session   */
+/*    ID and master secret the server issued, so the application only     */
+/*    needs to keep the entry (optionally in persistent storage) between  */
+/*    connections. Passing NX_NULL disables resumption for the session.   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    tls_session                           TLS control block             */
+/*    resumption_entry                      Resumption entry, or NX_NULL  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_secure_tls_session_resumption_set(NX_SECURE_TLS_SESSION *tls_session,
+                                           NX_SECURE_TLS_SESSION_RESUMPTION *resumption_entry)
+{
+
+    /* Get the protection. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    /* Save the entry, it is consulted when the next ClientHello is built. */
+    tls_session -> nx_secure_tls_session_resumption_ptr = resumption_entry;
+    tls_session -> nx_secure_tls_session_resumed = NX_FALSE;
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(NX_SUCCESS);
+}
+#endif /* NX_SECURE_TLS_DISABLE_CLIENT_SESSION_RESUMPTION */
@@ -40,6 +40,11 @@
 /*    all encryption and hashing before sending data over the established */
 /*    TCP socket connection.                    .                         */
 /*                                                                        */
+/*    Once a maximum fragment length has been negotiated, data longer     */
+/*    than that length is sent in several records. If an error occurs     */
+/*    after some of them are sent, their data is trimmed off the front of */
+/*    the packet, so the packet length left tells how much was consumed.  */
+/*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    tls_session                           TLS control block             */
@@ -54,6 +59,7 @@
 /*  CALLS                                                                 */
 /*                                                                        */
 /*    _nx_secure_tls_send_record            Send TLS encrypted record     */
+/*    _nx_secure_tls_session_reset          Clear out the session         */
 /*    tx_mutex_get                          Get protection mutex          */
 /*    tx_mutex_put                          Put protection mutex          */
 /*                                                                        */
@@ -100,6 +100,10 @@ NX_PACKET *send_packet;
     /* Reset the record queue. */
     tls_session -> nx_secure_record_queue_header = NX_NULL;
     tls_session -> nx_secure_record_decrypted_packet = NX_NULL;
+#ifdef NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT
+    tls_session -> nx_secure_record_stream_packet = NX_NULL;
+    tls_session -> nx_secure_record_stream_length = 0;
+#endif /* NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT */
 
     /* Make sure we are starting with a fresh session. */
     tls_session -> nx_secure_tls_local_session_active = 0;
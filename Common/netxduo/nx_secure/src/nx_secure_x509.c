@@ -90,6 +90,8 @@ static UINT _nx_secure_x509_extract_oid_data(const UCHAR *buffer, UINT oid, UINT
 /*                                            certificate                 */
 /*    _nx_secure_x509_parse_signature_data  Parse signature data in       */
 /*                                            certificate                 */
+/*    _nx_secure_x509_distinguished_name_hash                             */
+/*                                          Hash distinguished name       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -229,6 +231,9 @@ UINT         status;
         return(NX_SECURE_TLS_UNSUPPORTED_PUBLIC_CIPHER);
     }
 
+    /* Hash the subject name once so certificate lists can skip most name compares. */
+    cert -> nx_secure_x509_distinguished_name_hash = _nx_secure_x509_distinguished_name_hash(&cert -> nx_secure_x509_distinguished_name);
+
     /* Successfully parsed an X509 certificate. */
     return(NX_SECURE_X509_SUCCESS);
 }
@@ -40,11 +40,14 @@
 /*    This function verifies a certificate chain (built using the service */
 /*    nx_secure_certificate_chain_build) by checking each issuer back to  */
 /*    a certificate in the trusted store of the given X509 store.         */
+/*    Issuer/subject pairs verified by an earlier call are looked up in   */
+/*    the verified certificate cache to skip the public-key operation.    */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
 /*    store                                 Pointer to certificate store  */
 /*    certificate                           Pointer to cert chain         */
+/*    current_time                          Current GMT, 0 if unknown     */
 /*                                                                        */
 /*  OUTPUT                                                                */
 /*                                                                        */
@@ -57,6 +60,8 @@
 /*                                          Find a cert in a store        */
 /*    _nx_secure_x509_distinguished_name_compare                          */
 /*                                          Compare distinguished name    */
+/*    _nx_secure_x509_verified_cache_find   Find verified cert pair       */
+/*    _nx_secure_x509_verified_cache_add    Add verified cert pair        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -74,13 +79,17 @@
 /*                                                                        */
 /**************************************************************************/
 UINT _nx_secure_x509_certificate_chain_verify(NX_SECURE_X509_CERTIFICATE_STORE *store,
-                                              NX_SECURE_X509_CERT *certificate)
+                                              NX_SECURE_X509_CERT *certificate, ULONG current_time)
 {
 UINT                 status;
 NX_SECURE_X509_CERT *current_certificate;
 NX_SECURE_X509_CERT *issuer_certificate;
 UINT                 issuer_location = NX_SECURE_X509_CERT_LOCATION_NONE;
 INT                  compare_result;
+#ifndef NX_SECURE_X509_DISABLE_VERIFIED_CACHE
+UINT                 cache_status;
+UCHAR                fingerprint[NX_SECURE_X509_VERIFIED_CACHE_FINGERPRINT_SIZE];
+#endif /* NX_SECURE_X509_DISABLE_VERIFIED_CACHE */
 
     /* Process, following X509 basic certificate authentication (RFC 5280):
      *    1. Last certificate in chain is the end entity - start with it.
@@ -128,8 +137,32 @@ INT                  compare_result;
 #endif
         }
 
+#ifndef NX_SECURE_X509_DISABLE_VERIFIED_CACHE
+        /* Skip the signature check if this pair was verified before. */
+        cache_status = _nx_secure_x509_verified_cache_find(current_certificate, issuer_certificate,
+                                                           current_time, fingerprint);
+
+        if (cache_status == NX_SUCCESS)
+        {
+            status = NX_SUCCESS;
+        }
+        else
+        {
+            /* Verify the current certificate against its issuer certificate. */
+            status = _nx_secure_x509_certificate_verify(store, current_certificate, issuer_certificate);
+
+            /* Remember the pair if a fingerprint could be computed. */
+            if ((status == NX_SUCCESS) && (cache_status == NX_SECURE_X509_CERTIFICATE_NOT_FOUND))
+            {
+                _nx_secure_x509_verified_cache_add(fingerprint);
+            }
+        }
+#else
+        NX_PARAMETER_NOT_USED(current_time);
+
         /* Verify the current certificate against its issuer certificate. */
         status = _nx_secure_x509_certificate_verify(store, current_certificate, issuer_certificate);
+#endif /* NX_SECURE_X509_DISABLE_VERIFIED_CACHE */
 
         if (status != 0)
         {
@@ -117,9 +117,12 @@ INT                  compare_result;
 
             /* We want to be able to add duplicate entries to some of the certificate stores (e.g. the
                free certificate list which contains uninitialized certs), so conditionally allow duplicates. */
-            if (!duplicates_ok)
+            if (!duplicates_ok &&
+                (current_cert -> nx_secure_x509_distinguished_name_hash == 0 ||
+                 certificate -> nx_secure_x509_distinguished_name_hash == 0 ||
+                 current_cert -> nx_secure_x509_distinguished_name_hash == certificate -> nx_secure_x509_distinguished_name_hash))
             {
-                /* Make sure we don't try to add the same cert twice. */
+                /* Make sure we don't try to add the same cert twice. Names with different hashes never match. */
                 compare_result = _nx_secure_x509_distinguished_name_compare(&current_cert -> nx_secure_x509_distinguished_name,
                                                                             &certificate -> nx_secure_x509_distinguished_name, NX_SECURE_X509_NAME_COMMON_NAME);
 
@@ -39,6 +39,8 @@
 /*                                                                        */
 /*    This function finds a NX_SECURE_X509_CERT instance in a             */
 /*    certificate linked list, based on the common name (CN) field.       */
+/*    Certificates whose name hash differs from the hash of the name      */
+/*    searched for are skipped without a name compare.                    */
 /*                                                                        */
 /*  INPUT                                                                 */
 /*                                                                        */
@@ -55,6 +57,8 @@
 /*                                                                        */
 /*    _nx_secure_x509_distinguished_name_compare                          */
 /*                                          Compare distinguished name    */
+/*    _nx_secure_x509_distinguished_name_hash                             */
+/*                                          Hash distinguished name       */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -83,6 +87,7 @@ UINT _nx_secure_x509_certificate_list_find(NX_SECURE_X509_CERT **list_head,
 {
 NX_SECURE_X509_CERT *current_cert;
 INT                  compare_result;
+ULONG                name_hash = 0;
 
 
     /* Find out NULL pointers. */
@@ -99,6 +104,12 @@ INT                  compare_result;
         return(NX_PTR_ERROR);
     }
 
+    /* Hash the name once so most certificates are rejected without a name compare. */
+    if (name != NX_NULL)
+    {
+        name_hash = _nx_secure_x509_distinguished_name_hash(name);
+    }
+
     /* Walk the list until we find a certificate with a matching CN.
        Use a two-level pointer so we can modify the cert easily. */
     current_cert = *list_head;
@@ -111,6 +122,12 @@ INT                  compare_result;
             /* Check the cert_id against the ID in the certificate. */
             compare_result = (current_cert -> nx_secure_x509_cert_identifier == cert_id) ? 0 : 1;
         }
+        else if ((current_cert -> nx_secure_x509_distinguished_name_hash != 0) &&
+                 (current_cert -> nx_secure_x509_distinguished_name_hash != name_hash))
+        {
+            /* Different hashes, the names can not match. */
+            compare_result = 1;
+        }
         else
         {
             /* Check the common name passed in against the parsed certificate CN. */
@@ -136,8 +136,8 @@ UINT                 serial_number_length;
         return(status);
     }
 
-    /* Now, check that the issuer is valid. */
-    status = _nx_secure_x509_certificate_chain_verify(store, issuer_certificate);
+    /* Now, check that the issuer is valid. No time is available here, so cached pairs are not aged. */
+    status = _nx_secure_x509_certificate_chain_verify(store, issuer_certificate, 0);
 
     if (status != NX_SUCCESS)
     {
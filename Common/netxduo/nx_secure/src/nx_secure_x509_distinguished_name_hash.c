@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    X509 Digital Certificates                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+#include "nx_secure_x509.h"
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_x509_distinguished_name_hash             PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes a hash of the fields of a distinguished      */
+/*    name that are always compared by certificate lookups. Parsed        */
+/*    certificates keep the hash of their subject name, so list lookups   */
+/*    only call _nx_secure_x509_distinguished_name_compare on hash        */
+/*    matches. The hash is never 0, which marks a certificate without a   */
+/*    hash.                                                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    name                                  Distinguished name            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    hash                                  Hash of distinguished name    */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_x509_certificate_parse     Parse certificate             */
+/*    _nx_secure_x509_certificate_list_find                               */
+/*                                          Find cert in list             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+ULONG _nx_secure_x509_distinguished_name_hash(NX_SECURE_X509_DISTINGUISHED_NAME *name)
+{
+ULONG hash = 2166136261UL;
+UINT  i;
+
+    /* FNV-1a over the common name, which every lookup compares. Names that compare
+       equal therefore always hash equal. */
+    for (i = 0; i < name -> nx_secure_x509_common_name_length; i++)
+    {
+        hash = ((hash ^ name -> nx_secure_x509_common_name[i]) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+
+    /* Zero is reserved for certificates without a hash. */
+    if (hash == 0)
+    {
+        hash = 1;
+    }
+
+    return(hash);
+}
@@ -0,0 +1,95 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    X509 Digital Certificates                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+#include "nx_secure_x509.h"
+
+#ifndef NX_SECURE_X509_DISABLE_VERIFIED_CACHE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_x509_verified_cache_add                  PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function records a subject and issuer certificate pair whose   */
+/*    signature was verified, identified by the fingerprint computed by   */
+/*    _nx_secure_x509_verified_cache_find. The oldest entry is replaced   */
+/*    when the cache is full. The cache is guarded by the TLS protection  */
+/*    mutex, which is taken here.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    fingerprint                           Pointer to pair fingerprint   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_x509_certificate_chain_verify                            */
+/*                                          Verify cert against stores    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+VOID _nx_secure_x509_verified_cache_add(const UCHAR *fingerprint)
+{
+NX_SECURE_X509_VERIFIED_CACHE_ENTRY *entry;
+
+    /* Get the protection. The cache is shared by all TLS sessions and by CRL checks. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    /* Replace entries in the order they were added. */
+    entry = &_nx_secure_x509_verified_cache[_nx_secure_x509_verified_cache_next];
+
+    NX_SECURE_MEMCPY(entry -> nx_secure_x509_verified_cache_fingerprint, fingerprint,
+                     NX_SECURE_X509_VERIFIED_CACHE_FINGERPRINT_SIZE); /* Use case of memcpy is verified. */
+    entry -> nx_secure_x509_verified_cache_valid = NX_TRUE;
+
+    _nx_secure_x509_verified_cache_next++;
+    if (_nx_secure_x509_verified_cache_next >= NX_SECURE_X509_VERIFIED_CACHE_SIZE)
+    {
+        _nx_secure_x509_verified_cache_next = 0;
+    }
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+}
+#endif /* NX_SECURE_X509_DISABLE_VERIFIED_CACHE */
@@ -0,0 +1,216 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Secure Component                                                 */
+/**                                                                       */
+/**    X509 Digital Certificates                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define NX_SECURE_SOURCE_CODE
+
+#include "nx_secure_tls.h"
+#include "nx_secure_x509.h"
+
+#ifndef NX_SECURE_X509_DISABLE_VERIFIED_CACHE
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _nx_secure_x509_verified_cache_find                 PORTABLE C      */
+/*                                                           6.1          */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function computes the SHA-256 fingerprint of a subject and     */
+/*    issuer certificate pair and looks it up in the verified certificate */
+/*    cache. A hit means the signature of the subject was verified against*/
+/*    the issuer before, so the public-key operation can be skipped. If a */
+/*    current time is given, entries whose subject or issuer is outside of*/
+/*    its validity period are dropped. With a current time of 0 entries   */
+/*    are not aged and stay until replaced by newer pairs. The fingerprint*/
+/*    is returned so the caller can add the pair once verified. The cache */
+/*    is guarded by the TLS protection mutex, which is taken here.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    certificate                           Pointer to subject cert       */
+/*    issuer_certificate                    Pointer to issuer cert        */
+/*    current_time                          Current GMT, 0 to skip        */
+/*    fingerprint                           Fingerprint output buffer     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                                Completion status             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    tx_mutex_get                          Get protection mutex          */
+/*    tx_mutex_put                          Put protection mutex          */
+/*    _nx_secure_x509_expiration_check      Verify expiration of cert     */
+/*    [nx_crypto_init]                      Crypto initialization         */
+/*    [nx_crypto_operation]                 Crypto operation              */
+/*    [nx_crypto_cleanup]                   Crypto cleanup                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _nx_secure_x509_certificate_chain_verify                            */
+/*                                          Verify cert against stores    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+UINT _nx_secure_x509_verified_cache_find(NX_SECURE_X509_CERT *certificate,
+                                         NX_SECURE_X509_CERT *issuer_certificate,
+                                         ULONG current_time, UCHAR *fingerprint)
+{
+UINT                    status;
+UINT                    i;
+const NX_CRYPTO_METHOD *hash_method = NX_NULL;
+VOID                   *handler = NX_NULL;
+VOID                   *metadata;
+ULONG                   metadata_size;
+
+    if ((certificate -> nx_secure_x509_certificate_raw_data == NX_NULL) ||
+        (issuer_certificate -> nx_secure_x509_certificate_raw_data == NX_NULL))
+    {
+        return(NX_PTR_ERROR);
+    }
+
+    /* Find SHA-256 among the hash methods available for certificates. */
+    for (i = 0; i < certificate -> nx_secure_x509_cipher_table_size; i++)
+    {
+        if (certificate -> nx_secure_x509_cipher_table[i].nx_secure_x509_hash_method -> nx_crypto_algorithm == NX_CRYPTO_HASH_SHA256)
+        {
+            hash_method = certificate -> nx_secure_x509_cipher_table[i].nx_secure_x509_hash_method;
+            break;
+        }
+    }
+
+    if (hash_method == NX_NULL || hash_method -> nx_crypto_operation == NX_NULL)
+    {
+        return(NX_SECURE_TLS_MISSING_CRYPTO_ROUTINE);
+    }
+
+    metadata = certificate -> nx_secure_x509_hash_metadata_area;
+    metadata_size = certificate -> nx_secure_x509_hash_metadata_size;
+
+    if (metadata_size < hash_method -> nx_crypto_metadata_area_size)
+    {
+        return(NX_SECURE_TLS_INSUFFICIENT_METADATA_SPACE);
+    }
+
+    /* Hash the subject followed by the issuer, binding the signature to the issuer public key. */
+    if (hash_method -> nx_crypto_init)
+    {
+        status = hash_method -> nx_crypto_init((NX_CRYPTO_METHOD*)hash_method, NX_NULL, 0, &handler,
+                                               metadata, metadata_size);
+
+        if(status != NX_CRYPTO_SUCCESS)
+        {
+            return(status);
+        }
+    }
+
+    status = hash_method -> nx_crypto_operation(NX_CRYPTO_HASH_INITIALIZE, handler,
+                                                (NX_CRYPTO_METHOD*)hash_method, NX_NULL, 0,
+                                                NX_NULL, 0, NX_NULL, NX_NULL, 0,
+                                                metadata, metadata_size, NX_NULL, NX_NULL);
+
+    if (status == NX_CRYPTO_SUCCESS)
+    {
+        status = hash_method -> nx_crypto_operation(NX_CRYPTO_HASH_UPDATE, handler,
+                                                    (NX_CRYPTO_METHOD*)hash_method, NX_NULL, 0,
+                                                    certificate -> nx_secure_x509_certificate_raw_data,
+                                                    certificate -> nx_secure_x509_certificate_raw_data_length,
+                                                    NX_NULL, NX_NULL, 0,
+                                                    metadata, metadata_size, NX_NULL, NX_NULL);
+    }
+
+    if (status == NX_CRYPTO_SUCCESS)
+    {
+        status = hash_method -> nx_crypto_operation(NX_CRYPTO_HASH_UPDATE, handler,
+                                                    (NX_CRYPTO_METHOD*)hash_method, NX_NULL, 0,
+                                                    issuer_certificate -> nx_secure_x509_certificate_raw_data,
+                                                    issuer_certificate -> nx_secure_x509_certificate_raw_data_length,
+                                                    NX_NULL, NX_NULL, 0,
+                                                    metadata, metadata_size, NX_NULL, NX_NULL);
+    }
+
+    if (status == NX_CRYPTO_SUCCESS)
+    {
+        status = hash_method -> nx_crypto_operation(NX_CRYPTO_HASH_CALCULATE, handler,
+                                                    (NX_CRYPTO_METHOD*)hash_method, NX_NULL, 0,
+                                                    NX_NULL, 0, NX_NULL, fingerprint,
+                                                    NX_SECURE_X509_VERIFIED_CACHE_FINGERPRINT_SIZE,
+                                                    metadata, metadata_size, NX_NULL, NX_NULL);
+    }
+
+    if (hash_method -> nx_crypto_cleanup)
+    {
+        hash_method -> nx_crypto_cleanup(metadata);
+    }
+
+    if (status != NX_CRYPTO_SUCCESS)
+    {
+        return(status);
+    }
+
+    /* Get the protection. The cache is shared by all TLS sessions and by CRL checks. */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    for (i = 0; i < NX_SECURE_X509_VERIFIED_CACHE_SIZE; i++)
+    {
+        if (_nx_secure_x509_verified_cache[i].nx_secure_x509_verified_cache_valid &&
+            (NX_SECURE_MEMCMP(_nx_secure_x509_verified_cache[i].nx_secure_x509_verified_cache_fingerprint,
+                              fingerprint, NX_SECURE_X509_VERIFIED_CACHE_FINGERPRINT_SIZE) == 0))
+        {
+            break;
+        }
+    }
+
+    if (i == NX_SECURE_X509_VERIFIED_CACHE_SIZE)
+    {
+        status = NX_SECURE_X509_CERTIFICATE_NOT_FOUND;
+    }
+
+    /* The entry is only good until the earliest expiry of the pair. Without a current time
+       it cannot be aged and is kept until newer pairs replace it. */
+    else if ((current_time != 0) &&
+             ((_nx_secure_x509_expiration_check(certificate, current_time) != NX_SUCCESS) ||
+              (_nx_secure_x509_expiration_check(issuer_certificate, current_time) != NX_SUCCESS)))
+    {
+        _nx_secure_x509_verified_cache[i].nx_secure_x509_verified_cache_valid = NX_FALSE;
+        status = NX_SECURE_X509_CERTIFICATE_NOT_FOUND;
+    }
+    else
+    {
+        status = NX_SUCCESS;
+    }
+
+    /* Release the protection. */
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    return(status);
+}
+#endif /* NX_SECURE_X509_DISABLE_VERIFIED_CACHE */
@@ -0,0 +1,190 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** NetX Component                                                        */
+/**                                                                       */
+/**   Port Specific for the ThreadX Linux/GNU simulation                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  PORT SPECIFIC C INFORMATION                            RELEASE        */
+/*                                                                        */
+/*    nx_port.h                                           Linux/GNU       */
+/*                                                           6.1          */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file contains data type definitions that make the NetX         */
+/*    real-time TCP/IP function identically on a variety of different     */
+/*    processor architectures. It is used with the ThreadX Linux/GNU      */
+/*    port to build and test NetX Duo on a host.                          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version               */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef NX_PORT_H
+#define NX_PORT_H
+
+/* Determine if the optional NetX user define file should be used.  */
+
+#ifdef NX_INCLUDE_USER_DEFINE_FILE
+
+
+/* Yes, include the user defines in nx_user.h. The defines in this file may
+   alternately be defined on the command line.  */
+
+#include "nx_user.h"
+#endif
+
+
+/* Linux hosts supported by the port are little endian.  */
+
+#define NX_LITTLE_ENDIAN    1
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+
+/* Define various constants for the port.  */
+
+#ifndef NX_IP_PERIODIC_RATE
+#define NX_IP_PERIODIC_RATE 100             /* Default IP periodic rate of 1 second for
+                                               ports with 10ms timer interrupts.  This
+                                               value may be defined instead at the
+                                               command line and this value will not be
+                                               used.  */
+#endif
+
+
+/* Define macros that swap the endian for little endian ports.  */
+#ifdef NX_LITTLE_ENDIAN
+#define NX_CHANGE_ULONG_ENDIAN(arg) arg = __builtin_bswap32(arg)
+#define NX_CHANGE_USHORT_ENDIAN(arg) arg = __builtin_bswap16(arg)
+
+
+#ifndef htonl
+#define htonl(val)  __builtin_bswap32(val)
+#endif /* htonl */
+#ifndef ntohl
+#define ntohl(val)  __builtin_bswap32(val)
+#endif /* htonl */
+
+#ifndef htons
+#define htons(val)  __builtin_bswap16(val)
+#endif /*htons */
+
+#ifndef ntohs
+#define ntohs(val)  __builtin_bswap16(val)
+#endif /*htons */
+
+
+#else
+
+#define NX_CHANGE_ULONG_ENDIAN(a)
+#define NX_CHANGE_USHORT_ENDIAN(a)
+
+#ifndef htons
+#define htons(val) (val)
+#endif /* htons */
+
+#ifndef ntohs
+#define ntohs(val) (val)
+#endif /* ntohs */
+
+#ifndef ntohl
+#define ntohl(val) (val)
+#endif
+
+#ifndef htonl
+#define htonl(val) (val)
+#endif /* htonl */
+#endif
+
+
+/* Define several macros for the error checking shell in NetX.  */
+
+#ifndef TX_TIMER_PROCESS_IN_ISR
+
+#define NX_CALLER_CHECKING_EXTERNS          extern  TX_THREAD           *_tx_thread_current_ptr; \
+                                            extern  TX_THREAD           _tx_timer_thread; \
+                                            extern  volatile ULONG      _tx_thread_system_state;
+
+#define NX_THREADS_ONLY_CALLER_CHECKING     if ((TX_THREAD_GET_SYSTEM_STATE()) || \
+                                                (_tx_thread_current_ptr == TX_NULL) || \
+                                                (_tx_thread_current_ptr == &_tx_timer_thread)) \
+                                                return(NX_CALLER_ERROR);
+
+#define NX_INIT_AND_THREADS_CALLER_CHECKING if (((TX_THREAD_GET_SYSTEM_STATE()) && (TX_THREAD_GET_SYSTEM_STATE() < ((ULONG) 0xF0F0F0F0))) || \
+                                                (_tx_thread_current_ptr == &_tx_timer_thread)) \
+                                                return(NX_CALLER_ERROR);
+
+
+#define NX_NOT_ISR_CALLER_CHECKING          if ((TX_THREAD_GET_SYSTEM_STATE()) && (TX_THREAD_GET_SYSTEM_STATE() < ((ULONG) 0xF0F0F0F0))) \
+                                                return(NX_CALLER_ERROR);
+
+#define NX_THREAD_WAIT_CALLER_CHECKING      if ((wait_option) && \
+                                               ((_tx_thread_current_ptr == NX_NULL) || (TX_THREAD_GET_SYSTEM_STATE()) || (_tx_thread_current_ptr == &_tx_timer_thread))) \
+                                            return(NX_CALLER_ERROR);
+
+
+#else
+
+
+
+#define NX_CALLER_CHECKING_EXTERNS          extern  TX_THREAD           *_tx_thread_current_ptr; \
+                                            extern  volatile ULONG      _tx_thread_system_state;
+
+#define NX_THREADS_ONLY_CALLER_CHECKING     if ((TX_THREAD_GET_SYSTEM_STATE()) || \
+                                                (_tx_thread_current_ptr == TX_NULL)) \
+                                                return(NX_CALLER_ERROR);
+
+#define NX_INIT_AND_THREADS_CALLER_CHECKING if (((TX_THREAD_GET_SYSTEM_STATE()) && (TX_THREAD_GET_SYSTEM_STATE() < ((ULONG) 0xF0F0F0F0)))) \
+                                                return(NX_CALLER_ERROR);
+
+#define NX_NOT_ISR_CALLER_CHECKING          if ((TX_THREAD_GET_SYSTEM_STATE()) && (TX_THREAD_GET_SYSTEM_STATE() < ((ULONG) 0xF0F0F0F0))) \
+                                                return(NX_CALLER_ERROR);
+
+#define NX_THREAD_WAIT_CALLER_CHECKING      if ((wait_option) && \
+                                               ((_tx_thread_current_ptr == NX_NULL) || (TX_THREAD_GET_SYSTEM_STATE()))) \
+                                            return(NX_CALLER_ERROR);
+
+#endif
+
+
+/* Define the version ID of NetX.  This may be utilized by the application.  */
+
+#ifdef NX_SYSTEM_INIT
+CHAR                            _nx_version_id[] =
+                                    "Copyright (c) Microsoft Corporation. All rights reserved.  *  NetX Duo Linux/GNU Version 6.1 *";
+#else
+extern  CHAR                    _nx_version_id[];
+#endif
+
+#endif
@@ -0,0 +1,612 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks how the MQTT client gathers PUBLISH packets sent over TLS into records. The
+   client connects over TLS to a broker on the TCP loopback, which counts the records it receives
+   and the PUBLISH packets in them. A burst of 16 QoS 0 PUBLISH packets must arrive whole and in
+   order. With NXD_MQTT_TLS_COALESCE_ENABLE it must arrive in fewer records than packets, none of
+   them longer than NXD_MQTT_TLS_COALESCE_SIZE, and a single PUBLISH must be held until the flush
+   timer sets MQTT_TLS_FLUSH_EVENT, then go out on its own. Without it every PUBLISH is a record.
+   The same source is built both ways, and each reports the time of a burst from the first publish
+   to the broker having all of it, the time spent in the publish calls and the records used.  */
+
+#include "tx_api.h"
+#include "nx_api.h"
+#include "nxd_mqtt_client.h"
+#include "nx_wifi_loopback.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+#define TEST_IP_ADDRESS         IP_ADDRESS(10, 0, 0, 1)
+#define TEST_MQTT_PORT          8883
+#define TEST_PACKET_SIZE        1600
+#define TEST_PACKETS            64
+#define TEST_WAIT               (2 * NX_IP_PERIODIC_RATE)
+#define TEST_STACK_SIZE         65536
+#define TEST_ROUNDS             50
+#define TEST_BURST              16
+#define TEST_SAMPLE_SIZE        64
+#define TEST_TOPIC              "telemetry"
+#define TEST_PUBLISH_SIZE       (2 + 2 + sizeof(TEST_TOPIC) - 1 + TEST_SAMPLE_SIZE)
+
+
+extern const NX_SECURE_TLS_CRYPTO nx_crypto_tls_ciphers;
+
+static const UCHAR      test_ca_der[] =
+{
+    0x30, 0x82, 0x03, 0x51, 0x30, 0x82, 0x02, 0x39, 0xa0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x14, 0x6e,
+    0xe9, 0xda, 0x10, 0xcf, 0xa8, 0x74, 0xcd, 0x99, 0x8a, 0xeb, 0xc0, 0xb4, 0xec, 0x6f, 0x97, 0xd7,
+    0x6b, 0x5b, 0x04, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b,
+    0x05, 0x00, 0x30, 0x30, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e,
+    0x65, 0x74, 0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x1a, 0x30, 0x18, 0x06, 0x03, 0x55, 0x04,
+    0x03, 0x0c, 0x11, 0x4e, 0x65, 0x74, 0x58, 0x20, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x6f,
+    0x72, 0x20, 0x43, 0x41, 0x30, 0x1e, 0x17, 0x0d, 0x32, 0x36, 0x31, 0x30, 0x31, 0x39, 0x31, 0x33,
+    0x34, 0x37, 0x33, 0x34, 0x5a, 0x17, 0x0d, 0x34, 0x36, 0x31, 0x30, 0x31, 0x34, 0x31, 0x33, 0x34,
+    0x37, 0x33, 0x34, 0x5a, 0x30, 0x30, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c,
+    0x09, 0x4e, 0x65, 0x74, 0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x1a, 0x30, 0x18, 0x06, 0x03,
+    0x55, 0x04, 0x03, 0x0c, 0x11, 0x4e, 0x65, 0x74, 0x58, 0x20, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63,
+    0x74, 0x6f, 0x72, 0x20, 0x43, 0x41, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86,
+    0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x0f, 0x00, 0x30, 0x82,
+    0x01, 0x0a, 0x02, 0x82, 0x01, 0x01, 0x00, 0xc4, 0xae, 0x97, 0x8d, 0xe6, 0x8f, 0x32, 0x7b, 0x36,
+    0x4e, 0xac, 0x79, 0x24, 0x58, 0x6f, 0xaf, 0xda, 0x2e, 0xba, 0x1b, 0x36, 0x6c, 0xa2, 0x49, 0x08,
+    0x35, 0xa9, 0x31, 0x5c, 0xa3, 0xb2, 0x1e, 0x53, 0xcd, 0xc8, 0x95, 0x21, 0x4b, 0x1c, 0x6e, 0x2f,
+    0x1d, 0xe1, 0xc4, 0x7e, 0x92, 0x5b, 0x40, 0x53, 0xd0, 0x96, 0xc7, 0x4d, 0xf3, 0xde, 0x66, 0xc8,
+    0x7f, 0xe7, 0xf5, 0xab, 0xdc, 0x13, 0x58, 0xe3, 0x40, 0x18, 0xbc, 0x65, 0x85, 0xcc, 0xe6, 0xdc,
+    0x18, 0x3b, 0x8f, 0x01, 0x4e, 0x5e, 0x3a, 0x6b, 0xce, 0x05, 0xcb, 0xf9, 0xd0, 0x9e, 0x9b, 0x2a,
+    0xa1, 0xeb, 0x3a, 0x23, 0xf5, 0x92, 0x4b, 0xf6, 0x86, 0x83, 0x73, 0x42, 0xd7, 0x52, 0xb7, 0xf7,
+    0x21, 0xde, 0x61, 0x18, 0x5c, 0xf6, 0x46, 0x2c, 0xce, 0xa2, 0x78, 0x84, 0xe1, 0xed, 0x48, 0xbb,
+    0x36, 0x0a, 0x6f, 0xdb, 0x74, 0x17, 0x8f, 0x12, 0xb9, 0x76, 0x8c, 0x4b, 0xa3, 0x06, 0x48, 0x21,
+    0x6f, 0x40, 0x0c, 0x4b, 0xcf, 0xb5, 0xba, 0x0d, 0x0d, 0xaf, 0x9d, 0x63, 0xeb, 0x8e, 0xea, 0x11,
+    0x70, 0x3c, 0x08, 0x7b, 0xa4, 0x0c, 0xea, 0x17, 0x88, 0x4a, 0x63, 0x88, 0xff, 0x40, 0x47, 0xb1,
+    0x2b, 0xbc, 0xb2, 0x30, 0x36, 0x9e, 0x6c, 0xb2, 0xbc, 0x0f, 0x9a, 0x36, 0xc3, 0xfa, 0x9e, 0xe6,
+    0x19, 0xc8, 0xee, 0x7d, 0x98, 0x0b, 0xd6, 0xa1, 0x11, 0xb6, 0xf3, 0xc4, 0x89, 0x2e, 0x1e, 0x75,
+    0xdf, 0xe0, 0xfe, 0x3f, 0xc0, 0x15, 0xa2, 0xf3, 0x62, 0x15, 0x9a, 0xf8, 0xa3, 0x90, 0x0f, 0x0b,
+    0x03, 0xb5, 0xca, 0xfb, 0x1e, 0x12, 0x35, 0xf6, 0xc1, 0x78, 0x5f, 0x5a, 0xb2, 0x0f, 0xd6, 0x33,
+    0xa6, 0xd5, 0x3c, 0xff, 0x43, 0x24, 0xea, 0xc9, 0x2a, 0x07, 0xe2, 0x84, 0xd2, 0x85, 0x2d, 0x83,
+    0x74, 0xd9, 0xdd, 0xa7, 0x40, 0x4d, 0x0d, 0x02, 0x03, 0x01, 0x00, 0x01, 0xa3, 0x63, 0x30, 0x61,
+    0x30, 0x1d, 0x06, 0x03, 0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0x9d, 0xee, 0xa5, 0xf6, 0x86,
+    0x95, 0xfb, 0x89, 0x46, 0xf3, 0x46, 0x8d, 0x59, 0xd3, 0x1b, 0xa0, 0x22, 0xe3, 0xfe, 0xc2, 0x30,
+    0x1f, 0x06, 0x03, 0x55, 0x1d, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x9d, 0xee, 0xa5, 0xf6,
+    0x86, 0x95, 0xfb, 0x89, 0x46, 0xf3, 0x46, 0x8d, 0x59, 0xd3, 0x1b, 0xa0, 0x22, 0xe3, 0xfe, 0xc2,
+    0x30, 0x0f, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x01, 0x01, 0xff, 0x04, 0x05, 0x30, 0x03, 0x01, 0x01,
+    0xff, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04, 0x04, 0x03, 0x02, 0x02,
+    0x04, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00,
+    0x03, 0x82, 0x01, 0x01, 0x00, 0x6c, 0x3f, 0x6b, 0xa8, 0x39, 0x08, 0xef, 0xdf, 0xd7, 0x15, 0xe3,
+    0x31, 0xbc, 0x94, 0x99, 0x1c, 0x07, 0x34, 0x9d, 0x87, 0x22, 0x6c, 0x6e, 0xde, 0x9a, 0x9d, 0x5f,
+    0x3d, 0x0f, 0x3a, 0x92, 0x67, 0xa4, 0xeb, 0x90, 0xf1, 0x4f, 0x46, 0x84, 0x16, 0x76, 0x4e, 0xbf,
+    0x75, 0x1a, 0xe4, 0x05, 0x84, 0xcd, 0x2a, 0x10, 0x1d, 0x47, 0xb5, 0xb5, 0x4b, 0x06, 0x58, 0x96,
+    0x83, 0xe1, 0x5e, 0xb4, 0x29, 0xe3, 0x43, 0x05, 0x33, 0x89, 0x63, 0xa3, 0xc3, 0x8a, 0x3e, 0x01,
+    0xab, 0x3a, 0x6f, 0x80, 0x36, 0x6d, 0x4e, 0x0f, 0xcc, 0xc5, 0x6f, 0x96, 0xc0, 0x8e, 0x94, 0xac,
+    0x38, 0xfb, 0xda, 0x4d, 0xd0, 0xc7, 0xc3, 0xe8, 0x43, 0xca, 0x45, 0xae, 0x3d, 0x7d, 0x96, 0x90,
+    0x9a, 0x68, 0x1c, 0x03, 0xf2, 0xe0, 0xc7, 0xc8, 0x34, 0x71, 0x9d, 0x35, 0x60, 0x42, 0xf8, 0x8e,
+    0x8a, 0x59, 0xb6, 0x08, 0x1f, 0xdb, 0x4b, 0xf1, 0xee, 0x5d, 0x2b, 0x98, 0x59, 0x6d, 0x82, 0x09,
+    0xbb, 0x57, 0xbd, 0x29, 0x1c, 0x0d, 0xf4, 0x9c, 0x15, 0xc8, 0xe1, 0xba, 0x5a, 0x93, 0xe9, 0xb8,
+    0xc8, 0x14, 0x27, 0x9e, 0xdb, 0x1a, 0xa7, 0xe5, 0xb2, 0xd2, 0xa4, 0x85, 0x8d, 0x1d, 0xf1, 0xd7,
+    0x91, 0xc8, 0x79, 0xc4, 0xb2, 0xbe, 0x85, 0x2d, 0x00, 0x4f, 0x03, 0x0f, 0xf4, 0xb0, 0x83, 0x75,
+    0x14, 0x3c, 0xb8, 0x88, 0x92, 0xdc, 0xf7, 0x6a, 0x7f, 0x66, 0xb0, 0x8b, 0x56, 0x5d, 0x8b, 0xfb,
+    0xce, 0xfd, 0x51, 0x30, 0x59, 0xa0, 0xad, 0x64, 0xc7, 0x15, 0x87, 0x7b, 0xa1, 0x2f, 0xfe, 0x69,
+    0x93, 0xc6, 0xa3, 0x92, 0x5e, 0xd1, 0x95, 0xdc, 0x25, 0x5b, 0x4b, 0xf6, 0x6b, 0xf5, 0xdb, 0x9d,
+    0xc3, 0x42, 0x76, 0x7a, 0x50, 0x96, 0xb8, 0xf8, 0xd1, 0x9a, 0x0c, 0x16, 0x40, 0x75, 0x62, 0x90,
+    0xab, 0x6d, 0xb3, 0x14, 0x8d
+};
+
+static const UCHAR      test_server_der[] =
+{
+    0x30, 0x82, 0x03, 0x5c, 0x30, 0x82, 0x02, 0x44, 0xa0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x30,
+    0x30, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65, 0x74, 0x58,
+    0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x1a, 0x30, 0x18, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x11,
+    0x4e, 0x65, 0x74, 0x58, 0x20, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x43,
+    0x41, 0x30, 0x1e, 0x17, 0x0d, 0x32, 0x36, 0x31, 0x30, 0x31, 0x39, 0x31, 0x33, 0x34, 0x37, 0x33,
+    0x35, 0x5a, 0x17, 0x0d, 0x34, 0x36, 0x31, 0x30, 0x31, 0x34, 0x31, 0x33, 0x34, 0x37, 0x33, 0x35,
+    0x5a, 0x30, 0x2d, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65,
+    0x74, 0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x17, 0x30, 0x15, 0x06, 0x03, 0x55, 0x04, 0x03,
+    0x0c, 0x0e, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2e, 0x74, 0x65, 0x73, 0x74,
+    0x30, 0x82, 0x01, 0x22, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01,
+    0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x0f, 0x00, 0x30, 0x82, 0x01, 0x0a, 0x02, 0x82, 0x01, 0x01,
+    0x00, 0xca, 0xe0, 0xdf, 0xbf, 0x89, 0xde, 0x3c, 0xcd, 0x1b, 0xcb, 0x12, 0x80, 0x95, 0x18, 0xb7,
+    0xee, 0xc4, 0x67, 0x9f, 0xf1, 0x7f, 0x51, 0x3c, 0x22, 0xcb, 0x40, 0x10, 0x39, 0xbc, 0xce, 0x57,
+    0xa9, 0x17, 0xcc, 0xc8, 0x45, 0x35, 0x36, 0xba, 0x12, 0x96, 0xa0, 0x80, 0xd3, 0x8f, 0xe3, 0x0d,
+    0x1c, 0xd9, 0x18, 0x4a, 0x6a, 0x4b, 0xd1, 0x59, 0xcf, 0x21, 0x2d, 0x5b, 0xce, 0x1a, 0x80, 0xc7,
+    0xbf, 0xe9, 0x7d, 0x07, 0x2a, 0x4a, 0xf4, 0xaa, 0x0e, 0xf6, 0x11, 0xbf, 0x2c, 0x9f, 0x50, 0xfb,
+    0x5e, 0xc6, 0xab, 0x23, 0x0a, 0x2c, 0x96, 0xdb, 0x08, 0x96, 0x93, 0xb3, 0x37, 0x8e, 0xa1, 0x93,
+    0xcf, 0x8c, 0x6a, 0xc7, 0xd3, 0xa2, 0xb5, 0xc2, 0xab, 0xb5, 0x5d, 0x20, 0x70, 0x42, 0x0a, 0xc6,
+    0x60, 0x59, 0x4b, 0xce, 0xce, 0xac, 0x17, 0x7f, 0x7b, 0x58, 0x3a, 0x61, 0x9b, 0x19, 0x04, 0x61,
+    0x87, 0x94, 0x39, 0x25, 0x11, 0xb2, 0x15, 0x4d, 0x1b, 0xcb, 0x20, 0x41, 0xf4, 0x7f, 0x5b, 0x3f,
+    0x49, 0x1e, 0x47, 0xe0, 0x55, 0x64, 0xbe, 0x56, 0x87, 0xa1, 0x02, 0xb1, 0x0a, 0xdd, 0xcd, 0x3b,
+    0x0b, 0x49, 0xfb, 0x87, 0x96, 0x13, 0x91, 0xcb, 0xcb, 0x97, 0x65, 0xb4, 0x9e, 0x61, 0xb8, 0x2d,
+    0x68, 0x40, 0x4f, 0x9b, 0xc4, 0xa9, 0x53, 0xfc, 0x90, 0xba, 0x68, 0xfc, 0xcd, 0x65, 0xb2, 0x1d,
+    0x9e, 0xe5, 0x73, 0xbb, 0x5b, 0x85, 0x23, 0x66, 0x1f, 0x89, 0x81, 0x0b, 0x32, 0xea, 0xa8, 0x0d,
+    0x5d, 0xd2, 0x0e, 0x79, 0xe5, 0xc0, 0x31, 0x18, 0x28, 0x72, 0xa0, 0x61, 0xc0, 0x1e, 0x05, 0x03,
+    0x31, 0xe1, 0xcd, 0x40, 0xcc, 0x57, 0x36, 0x21, 0x48, 0x52, 0xc0, 0xfb, 0xd6, 0xc6, 0x6c, 0xad,
+    0xca, 0xf3, 0xa6, 0xbc, 0x1b, 0x7b, 0x98, 0x47, 0x01, 0xe4, 0x83, 0x1d, 0x42, 0x5f, 0x33, 0x0f,
+    0x47, 0x02, 0x03, 0x01, 0x00, 0x01, 0xa3, 0x81, 0x83, 0x30, 0x81, 0x80, 0x30, 0x19, 0x06, 0x03,
+    0x55, 0x1d, 0x11, 0x04, 0x12, 0x30, 0x10, 0x82, 0x0e, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74,
+    0x6f, 0x72, 0x2e, 0x74, 0x65, 0x73, 0x74, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01,
+    0xff, 0x04, 0x04, 0x03, 0x02, 0x05, 0xa0, 0x30, 0x13, 0x06, 0x03, 0x55, 0x1d, 0x25, 0x04, 0x0c,
+    0x30, 0x0a, 0x06, 0x08, 0x2b, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x01, 0x30, 0x1d, 0x06, 0x03,
+    0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0x9d, 0x83, 0x44, 0x42, 0x0c, 0x12, 0x35, 0xd4, 0xa8,
+    0x4e, 0xf5, 0xfe, 0x4c, 0xba, 0xe1, 0xa1, 0x4e, 0x2e, 0xf5, 0xa5, 0x30, 0x1f, 0x06, 0x03, 0x55,
+    0x1d, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x9d, 0xee, 0xa5, 0xf6, 0x86, 0x95, 0xfb, 0x89,
+    0x46, 0xf3, 0x46, 0x8d, 0x59, 0xd3, 0x1b, 0xa0, 0x22, 0xe3, 0xfe, 0xc2, 0x30, 0x0d, 0x06, 0x09,
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00,
+    0x4b, 0x73, 0xd4, 0xaa, 0xa3, 0xbb, 0x6e, 0x02, 0x66, 0x97, 0x07, 0x04, 0x6c, 0x95, 0xd2, 0xa8,
+    0xd3, 0xe3, 0x26, 0x1b, 0x07, 0xdd, 0xd9, 0xe7, 0x40, 0x06, 0x99, 0xa0, 0xa4, 0xf8, 0xd9, 0xf3,
+    0xe4, 0x4e, 0xaa, 0x74, 0xc8, 0xf1, 0xce, 0xad, 0x66, 0xca, 0xae, 0x9e, 0x49, 0x8b, 0x0c, 0x23,
+    0x98, 0x1c, 0xc0, 0x6d, 0x8e, 0x87, 0x90, 0xd9, 0x00, 0xca, 0x51, 0xbb, 0x63, 0x51, 0x9f, 0x6e,
+    0x82, 0x78, 0x3c, 0xb1, 0x3e, 0xbc, 0xf6, 0x31, 0x70, 0x94, 0x90, 0x47, 0xbb, 0xb3, 0x1c, 0x68,
+    0x10, 0x0e, 0x26, 0x56, 0xb9, 0xbb, 0xbd, 0xb3, 0x61, 0x13, 0xfa, 0x28, 0x8e, 0xd6, 0x12, 0xfa,
+    0xc6, 0x6a, 0xce, 0xe6, 0xe7, 0x22, 0xb0, 0x4e, 0xf1, 0x89, 0x83, 0xb7, 0x85, 0x0a, 0xb7, 0x5c,
+    0x27, 0x4d, 0xae, 0x0b, 0x26, 0x2f, 0xe7, 0xef, 0x81, 0xd7, 0xa8, 0x31, 0x03, 0x81, 0x99, 0x42,
+    0x7d, 0x52, 0x17, 0x39, 0x59, 0x8e, 0xea, 0x0a, 0x87, 0xa0, 0xc1, 0x81, 0x7c, 0x60, 0x01, 0x7f,
+    0x94, 0x6a, 0x7a, 0x30, 0x7a, 0x23, 0xe7, 0xc6, 0x46, 0x63, 0x49, 0xf8, 0xeb, 0xd7, 0x78, 0xd2,
+    0xfd, 0xee, 0x1e, 0xb6, 0x12, 0x8d, 0x17, 0x0d, 0x3e, 0xfa, 0x1f, 0x95, 0xd0, 0x8a, 0x05, 0x46,
+    0x6f, 0x61, 0x85, 0x40, 0xe9, 0xda, 0xd8, 0xbb, 0x7f, 0x2e, 0x48, 0x2b, 0xae, 0xc3, 0x56, 0x7f,
+    0x14, 0x08, 0x0e, 0xa0, 0x18, 0x45, 0x5d, 0xd7, 0x85, 0x0d, 0x7e, 0xfb, 0x92, 0xfe, 0xdb, 0xc1,
+    0x89, 0x59, 0x80, 0x97, 0x05, 0x6c, 0x6b, 0x85, 0x8b, 0x01, 0xc9, 0xd6, 0x90, 0x07, 0xd2, 0x64,
+    0xa6, 0x0c, 0x49, 0xf2, 0xb6, 0x13, 0x8f, 0x2b, 0x9a, 0xc4, 0x90, 0x77, 0xb2, 0xdf, 0xcb, 0xc7,
+    0xf2, 0xff, 0x5c, 0xb2, 0x2c, 0xc4, 0xda, 0xf6, 0x4d, 0xe8, 0xb6, 0xcf, 0x21, 0xef, 0xb8, 0x2a
+};
+
+static const UCHAR      test_server_key_der[] =
+{
+    0x30, 0x82, 0x04, 0xa3, 0x02, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01, 0x00, 0xca, 0xe0, 0xdf, 0xbf,
+    0x89, 0xde, 0x3c, 0xcd, 0x1b, 0xcb, 0x12, 0x80, 0x95, 0x18, 0xb7, 0xee, 0xc4, 0x67, 0x9f, 0xf1,
+    0x7f, 0x51, 0x3c, 0x22, 0xcb, 0x40, 0x10, 0x39, 0xbc, 0xce, 0x57, 0xa9, 0x17, 0xcc, 0xc8, 0x45,
+    0x35, 0x36, 0xba, 0x12, 0x96, 0xa0, 0x80, 0xd3, 0x8f, 0xe3, 0x0d, 0x1c, 0xd9, 0x18, 0x4a, 0x6a,
+    0x4b, 0xd1, 0x59, 0xcf, 0x21, 0x2d, 0x5b, 0xce, 0x1a, 0x80, 0xc7, 0xbf, 0xe9, 0x7d, 0x07, 0x2a,
+    0x4a, 0xf4, 0xaa, 0x0e, 0xf6, 0x11, 0xbf, 0x2c, 0x9f, 0x50, 0xfb, 0x5e, 0xc6, 0xab, 0x23, 0x0a,
+    0x2c, 0x96, 0xdb, 0x08, 0x96, 0x93, 0xb3, 0x37, 0x8e, 0xa1, 0x93, 0xcf, 0x8c, 0x6a, 0xc7, 0xd3,
+    0xa2, 0xb5, 0xc2, 0xab, 0xb5, 0x5d, 0x20, 0x70, 0x42, 0x0a, 0xc6, 0x60, 0x59, 0x4b, 0xce, 0xce,
+    0xac, 0x17, 0x7f, 0x7b, 0x58, 0x3a, 0x61, 0x9b, 0x19, 0x04, 0x61, 0x87, 0x94, 0x39, 0x25, 0x11,
+    0xb2, 0x15, 0x4d, 0x1b, 0xcb, 0x20, 0x41, 0xf4, 0x7f, 0x5b, 0x3f, 0x49, 0x1e, 0x47, 0xe0, 0x55,
+    0x64, 0xbe, 0x56, 0x87, 0xa1, 0x02, 0xb1, 0x0a, 0xdd, 0xcd, 0x3b, 0x0b, 0x49, 0xfb, 0x87, 0x96,
+    0x13, 0x91, 0xcb, 0xcb, 0x97, 0x65, 0xb4, 0x9e, 0x61, 0xb8, 0x2d, 0x68, 0x40, 0x4f, 0x9b, 0xc4,
+    0xa9, 0x53, 0xfc, 0x90, 0xba, 0x68, 0xfc, 0xcd, 0x65, 0xb2, 0x1d, 0x9e, 0xe5, 0x73, 0xbb, 0x5b,
+    0x85, 0x23, 0x66, 0x1f, 0x89, 0x81, 0x0b, 0x32, 0xea, 0xa8, 0x0d, 0x5d, 0xd2, 0x0e, 0x79, 0xe5,
+    0xc0, 0x31, 0x18, 0x28, 0x72, 0xa0, 0x61, 0xc0, 0x1e, 0x05, 0x03, 0x31, 0xe1, 0xcd, 0x40, 0xcc,
+    0x57, 0x36, 0x21, 0x48, 0x52, 0xc0, 0xfb, 0xd6, 0xc6, 0x6c, 0xad, 0xca, 0xf3, 0xa6, 0xbc, 0x1b,
+    0x7b, 0x98, 0x47, 0x01, 0xe4, 0x83, 0x1d, 0x42, 0x5f, 0x33, 0x0f, 0x47, 0x02, 0x03, 0x01, 0x00,
+    0x01, 0x02, 0x82, 0x01, 0x00, 0x30, 0x35, 0xb6, 0xc5, 0xc7, 0xc7, 0xc9, 0x4f, 0xfe, 0x42, 0x47,
+    0xef, 0xc9, 0x3e, 0x59, 0xfb, 0x01, 0xae, 0x14, 0x3a, 0x69, 0x84, 0x4e, 0xd3, 0x7f, 0xd4, 0x05,
+    0xe7, 0x0a, 0x80, 0x48, 0x21, 0x74, 0xf7, 0xe3, 0x41, 0x5a, 0xef, 0x59, 0xd1, 0x2f, 0xfd, 0x0d,
+    0x0f, 0xf9, 0x19, 0xbd, 0xd4, 0x74, 0x9c, 0x4a, 0x96, 0xae, 0xd4, 0x9d, 0x50, 0x54, 0xb4, 0x78,
+    0x23, 0xe6, 0x75, 0x62, 0xc2, 0x2e, 0x84, 0x58, 0xef, 0x0a, 0x67, 0xd0, 0x7f, 0x84, 0xa6, 0xdb,
+    0xf4, 0x89, 0x19, 0x4f, 0xda, 0x8a, 0x40, 0x41, 0xaf, 0xd9, 0xbf, 0xb1, 0x65, 0xfd, 0x8e, 0x34,
+    0xa0, 0xc7, 0xa2, 0x8a, 0xc2, 0xdf, 0xbd, 0xc2, 0x25, 0x7e, 0xfd, 0x4d, 0x38, 0xcb, 0x7c, 0xc9,
+    0x48, 0x13, 0xd1, 0x86, 0xa9, 0x7f, 0x9e, 0xbd, 0x92, 0xac, 0x1f, 0x5b, 0x5a, 0x5e, 0xb1, 0x64,
+    0xdf, 0x5b, 0xd7, 0x08, 0x2b, 0xa8, 0xb8, 0x4e, 0x75, 0x78, 0x92, 0x5f, 0x8d, 0x65, 0xb2, 0x69,
+    0xba, 0xc6, 0x46, 0x11, 0xe7, 0xb2, 0xaf, 0x5f, 0x29, 0x72, 0xbe, 0xdc, 0x6b, 0x44, 0xee, 0xd1,
+    0xb3, 0x1f, 0x9e, 0x8d, 0x9e, 0x83, 0x9e, 0x67, 0xde, 0x8c, 0xec, 0xbd, 0x0f, 0x64, 0x66, 0x75,
+    0x1a, 0x63, 0x61, 0x60, 0x1e, 0x5d, 0x1e, 0xc0, 0x09, 0xa8, 0x08, 0xd6, 0xcc, 0x27, 0x3a, 0x11,
+    0xed, 0x92, 0xbe, 0x8c, 0xbd, 0x66, 0x42, 0x83, 0x01, 0xe6, 0x2d, 0x1e, 0x33, 0xde, 0xcf, 0x06,
+    0xee, 0x1b, 0x1d, 0x4a, 0x7d, 0xb6, 0x65, 0x88, 0x82, 0x1a, 0x42, 0x75, 0xfe, 0xee, 0xd1, 0xec,
+    0xec, 0x30, 0xf5, 0xdd, 0x3e, 0x59, 0xd1, 0x98, 0xdc, 0x93, 0x0b, 0x5d, 0xc4, 0x16, 0xe9, 0xc8,
+    0xc4, 0x4f, 0x2d, 0x01, 0xa1, 0xa9, 0x49, 0xd2, 0xf8, 0x05, 0x6e, 0xf5, 0x6c, 0xcb, 0x40, 0xbe,
+    0xdc, 0xc4, 0x26, 0x08, 0x2d, 0x02, 0x81, 0x81, 0x00, 0xee, 0x56, 0x5a, 0x90, 0x87, 0xed, 0x02,
+    0x53, 0x92, 0xf7, 0xc0, 0x02, 0xa1, 0x3e, 0xb5, 0x2e, 0x6f, 0xeb, 0xbe, 0x90, 0x7b, 0xb0, 0x5d,
+    0xa5, 0x28, 0x33, 0x62, 0xf0, 0xe6, 0xd7, 0xc2, 0x41, 0x1c, 0x54, 0xa9, 0x84, 0x23, 0xad, 0x53,
+    0x8f, 0x91, 0x87, 0x7d, 0xff, 0x5d, 0xd9, 0xd2, 0xdd, 0x08, 0x87, 0xa8, 0x8c, 0xe8, 0x06, 0x95,
+    0x43, 0x94, 0x51, 0x84, 0x08, 0x99, 0x01, 0x4c, 0xe3, 0x5b, 0x33, 0x31, 0x27, 0xdf, 0x5c, 0xe3,
+    0x93, 0x55, 0x76, 0x42, 0x06, 0x89, 0x05, 0xfa, 0xe0, 0xcb, 0x0e, 0x45, 0xc8, 0xf9, 0x12, 0x12,
+    0x40, 0x7b, 0x28, 0xbd, 0xd6, 0x6f, 0xe6, 0x57, 0x82, 0xe5, 0xfb, 0xff, 0xa6, 0x5a, 0x5a, 0x13,
+    0xab, 0xa6, 0x70, 0xf3, 0x80, 0x37, 0xef, 0xfb, 0xd7, 0x0f, 0xa3, 0x6e, 0xd7, 0x05, 0x5e, 0x3f,
+    0xe2, 0x9c, 0xd6, 0x5c, 0xde, 0x7b, 0x37, 0x6f, 0x8b, 0x02, 0x81, 0x81, 0x00, 0xd9, 0xe9, 0xce,
+    0xa4, 0x74, 0xfa, 0x73, 0xc4, 0x29, 0xcb, 0x5c, 0xa2, 0xa0, 0x98, 0x1a, 0x32, 0x68, 0x7a, 0xe3,
+    0xe8, 0x34, 0x64, 0xd6, 0x49, 0xd2, 0x39, 0x4b, 0xd9, 0xaf, 0xa7, 0xc5, 0xd9, 0xd0, 0xba, 0x65,
+    0x6e, 0x54, 0xcd, 0x3c, 0x0b, 0x3e, 0x47, 0x32, 0x1c, 0x85, 0x59, 0x08, 0x26, 0xd7, 0xaa, 0x46,
+    0xcc, 0x9c, 0x1e, 0x88, 0x66, 0x57, 0x04, 0x29, 0x9d, 0xd6, 0x97, 0xb9, 0x05, 0x76, 0x69, 0xa5,
+    0xb8, 0x81, 0x91, 0xef, 0x36, 0x63, 0x38, 0xad, 0x64, 0x01, 0xe8, 0x34, 0x38, 0x2f, 0xa3, 0xe1,
+    0x4d, 0x87, 0x70, 0x4a, 0x0b, 0x4b, 0x9b, 0xc6, 0x90, 0x05, 0x20, 0x4d, 0x89, 0xdd, 0x7f, 0x7f,
+    0x09, 0x0a, 0xa9, 0x10, 0xa7, 0x5f, 0x14, 0x75, 0x28, 0x46, 0x9d, 0x3a, 0xbd, 0x81, 0x9b, 0x20,
+    0xfc, 0x4a, 0xa6, 0x3e, 0x20, 0xdf, 0x1e, 0x7e, 0x5d, 0xb5, 0xa9, 0xd6, 0xb5, 0x02, 0x81, 0x81,
+    0x00, 0xb9, 0x50, 0x81, 0x78, 0x71, 0x87, 0xb2, 0x50, 0x63, 0x2c, 0xa9, 0xaa, 0x21, 0xcf, 0xcd,
+    0x36, 0x7f, 0x25, 0x70, 0xf5, 0x8c, 0x86, 0xd4, 0x39, 0x4f, 0x69, 0xad, 0x1b, 0x9c, 0x91, 0xd4,
+    0x63, 0xa5, 0xf0, 0x9a, 0x21, 0xb9, 0x4f, 0xd2, 0x72, 0x05, 0xf8, 0xb0, 0xda, 0x37, 0x11, 0xdf,
+    0xe7, 0xa6, 0xf3, 0x3b, 0xf5, 0xdb, 0x8f, 0x0a, 0xce, 0x11, 0xeb, 0xd3, 0xda, 0x8f, 0x85, 0x38,
+    0x50, 0x6b, 0x20, 0x01, 0xaf, 0x7b, 0xf8, 0x10, 0xa7, 0x05, 0x43, 0x3f, 0x11, 0x2f, 0xc7, 0x6b,
+    0x8b, 0x0f, 0xb7, 0x58, 0x41, 0x6c, 0x90, 0x45, 0x8a, 0xc7, 0x78, 0x25, 0x2b, 0x2f, 0xb4, 0x8d,
+    0x04, 0xa5, 0x67, 0xec, 0x1e, 0x5f, 0x90, 0x3c, 0x4d, 0x31, 0xcc, 0x0f, 0x38, 0xf9, 0xc5, 0x6a,
+    0x2e, 0x8c, 0xe5, 0x49, 0x90, 0x7c, 0x87, 0x0c, 0xeb, 0x59, 0x81, 0x3f, 0x92, 0x69, 0x81, 0xf0,
+    0x03, 0x02, 0x81, 0x80, 0x63, 0x76, 0x45, 0x5c, 0x69, 0x0c, 0x3b, 0xb4, 0xc8, 0x82, 0xca, 0xd8,
+    0x6b, 0xc6, 0xa1, 0x06, 0x6b, 0x0b, 0xd4, 0x64, 0x93, 0x2d, 0x87, 0x65, 0x90, 0x6f, 0x98, 0x80,
+    0x56, 0x9d, 0x94, 0x3f, 0xd3, 0xf6, 0x8f, 0xff, 0x68, 0xf3, 0x78, 0x39, 0x85, 0x86, 0x87, 0x87,
+    0xdf, 0x11, 0x81, 0x18, 0x01, 0x8d, 0xf5, 0xdc, 0xc4, 0x51, 0x67, 0x5e, 0x96, 0xcf, 0x0e, 0x93,
+    0xbd, 0x73, 0xe8, 0xfe, 0x66, 0x4a, 0xd8, 0x5a, 0x3b, 0xc1, 0xb9, 0x56, 0xb0, 0xb9, 0x18, 0xe3,
+    0x31, 0xbf, 0xa3, 0xbe, 0x15, 0x78, 0x8e, 0x88, 0x8d, 0x8e, 0x22, 0x2d, 0xbf, 0xa7, 0xed, 0x5c,
+    0xa5, 0x0a, 0x56, 0x79, 0xdb, 0xc0, 0xaa, 0xe2, 0x1c, 0x9c, 0x88, 0x3e, 0x6c, 0xb6, 0x70, 0xb7,
+    0x1e, 0x6b, 0xfb, 0x78, 0xad, 0xe4, 0x79, 0x8c, 0xce, 0x21, 0xcc, 0xef, 0xc2, 0x07, 0x30, 0x14,
+    0x63, 0xab, 0x8e, 0x95, 0x02, 0x81, 0x80, 0x28, 0xf8, 0x5d, 0xf0, 0x12, 0x52, 0x91, 0xe0, 0x11,
+    0xa7, 0xe1, 0x4e, 0xd3, 0x78, 0x21, 0x32, 0x3f, 0x9e, 0xcf, 0xff, 0x48, 0x77, 0x25, 0x1a, 0xc5,
+    0x81, 0xd3, 0x29, 0x68, 0x46, 0x2c, 0xe9, 0xb3, 0xdd, 0xfb, 0xd6, 0x72, 0xfc, 0x78, 0x69, 0x0f,
+    0x3d, 0xe9, 0x95, 0xef, 0x9e, 0x70, 0x17, 0x12, 0x50, 0xa7, 0x3f, 0x3c, 0x75, 0x8a, 0x4f, 0xc3,
+    0xf0, 0x5d, 0xbd, 0x50, 0x45, 0x2e, 0x03, 0x66, 0xaf, 0x64, 0xb2, 0x4b, 0x82, 0xc4, 0x6e, 0x89,
+    0x88, 0x1c, 0x8e, 0xf2, 0x6b, 0x3a, 0x73, 0x61, 0xb2, 0xd1, 0x34, 0xf6, 0xbe, 0xe7, 0x95, 0x57,
+    0xc9, 0xf4, 0xf1, 0x19, 0xc1, 0xc7, 0x24, 0x15, 0x66, 0x9a, 0x12, 0x14, 0x54, 0x08, 0xa5, 0x04,
+    0x1d, 0xb0, 0x43, 0xe5, 0x6e, 0xb2, 0xa8, 0xdc, 0xa8, 0x71, 0x25, 0x2e, 0x52, 0x92, 0xa5, 0xe9,
+    0x45, 0x38, 0xd9, 0xf7, 0x04, 0x5f, 0x23
+};
+
+
+static UINT                     test_failures;
+static NX_IP                    test_ip;
+static NX_PACKET_POOL           test_pool;
+static ULONG                    test_pool_area[TEST_PACKETS * (TEST_PACKET_SIZE + sizeof(NX_PACKET)) / sizeof(ULONG)];
+static NXD_ADDRESS              test_address;
+static UCHAR                    test_sample[TEST_SAMPLE_SIZE];
+static TX_THREAD                test_thread;
+static ULONG                    test_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+
+/* MQTT client and the broker.  */
+static NXD_MQTT_CLIENT          test_mqtt;
+static ULONG                    test_mqtt_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+static ULONG                    test_mqtt_metadata[16384 / sizeof(ULONG)];
+static UCHAR                    test_mqtt_packet_buffer[4096];
+static UCHAR                    test_mqtt_cert_buffer[2048];
+static NX_TCP_SOCKET            test_broker_socket;
+static NX_SECURE_TLS_SESSION    test_broker_session;
+static NX_SECURE_X509_CERT      test_broker_cert;
+static ULONG                    test_broker_metadata[16384 / sizeof(ULONG)];
+static UCHAR                    test_broker_packet_buffer[4096];
+static UCHAR                    test_broker_record[4096];
+static TX_THREAD                test_broker_thread;
+static ULONG                    test_broker_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+
+/* What the broker has received, updated for each record.  */
+static TX_SEMAPHORE             test_received;
+static UINT                     test_records;
+static UINT                     test_publishes;
+static UINT                     test_largest_record;
+static UINT                     test_bad_publishes;
+static double                   test_received_time;
+static double                   test_times[TEST_ROUNDS];
+static double                   test_send_times[TEST_ROUNDS];
+
+
+static VOID test_check(UINT condition, const CHAR *name, UINT status)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s, status 0x%x\n", name, status);
+        test_failures++;
+    }
+}
+
+
+static double test_time_get(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec * 1e9 + (double)now.tv_nsec);
+}
+
+
+/* Count the PUBLISH packets of a record, checking each one is whole and carries the sample.  */
+
+static VOID test_record_count(UCHAR *record, ULONG length)
+{
+ULONG   offset = 0;
+
+    while (offset < length)
+    {
+        if ((offset + TEST_PUBLISH_SIZE > length) || ((record[offset] & 0xF0) != 0x30) ||
+            (record[offset + 1] != TEST_PUBLISH_SIZE - 2) ||
+            memcmp(record + offset + TEST_PUBLISH_SIZE - TEST_SAMPLE_SIZE, test_sample, TEST_SAMPLE_SIZE))
+        {
+            test_bad_publishes++;
+            return;
+        }
+        offset += TEST_PUBLISH_SIZE;
+        test_publishes++;
+    }
+}
+
+
+/* Accept the MQTT client, answer its CONNECT and count the records and PUBLISH packets that
+   follow.  */
+
+static VOID test_broker_entry(ULONG thread_input)
+{
+UINT        status;
+NX_PACKET  *packet_ptr;
+ULONG       length;
+UCHAR       connack[4] = {0x20, 0x02, 0x00, 0x00};
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    nx_wifi_loopback_accept(&test_broker_socket, NX_WAIT_FOREVER);
+    status = nx_secure_tls_session_start(&test_broker_session, &test_broker_socket, TEST_WAIT);
+    test_check(status == NX_SUCCESS, "broker handshake", status);
+    if (status)
+    {
+        return;
+    }
+
+    status = nx_secure_tls_session_receive(&test_broker_session, &packet_ptr, TEST_WAIT);
+    test_check(status == NX_SUCCESS, "broker CONNECT receive", status);
+    if (status)
+    {
+        return;
+    }
+    test_check((packet_ptr -> nx_packet_prepend_ptr[0] & 0xF0) == 0x10, "broker CONNECT", 0);
+    nx_packet_release(packet_ptr);
+
+    status = nx_secure_tls_packet_allocate(&test_broker_session, &test_pool, &packet_ptr, TEST_WAIT);
+    if (status == NX_SUCCESS)
+    {
+        nx_packet_data_append(packet_ptr, connack, sizeof(connack), &test_pool, TEST_WAIT);
+        status = nx_secure_tls_session_send(&test_broker_session, packet_ptr, TEST_WAIT);
+        if (status)
+        {
+            nx_packet_release(packet_ptr);
+        }
+    }
+    test_check(status == NX_SUCCESS, "broker CONNACK send", status);
+
+    /* Each receive returns the data of one record.  */
+    while (nx_secure_tls_session_receive(&test_broker_session, &packet_ptr, NX_WAIT_FOREVER) == NX_SUCCESS)
+    {
+        test_received_time = test_time_get();
+        nx_packet_data_extract_offset(packet_ptr, 0, test_broker_record, sizeof(test_broker_record), &length);
+        if (packet_ptr -> nx_packet_length > test_largest_record)
+        {
+            test_largest_record = packet_ptr -> nx_packet_length;
+        }
+        test_record_count(test_broker_record, length);
+        test_records++;
+        nx_packet_release(packet_ptr);
+        tx_semaphore_put(&test_received);
+    }
+}
+
+
+static UINT test_mqtt_tls_setup(NXD_MQTT_CLIENT *client_ptr, NX_SECURE_TLS_SESSION *tls_session,
+                                NX_SECURE_X509_CERT *certificate, NX_SECURE_X509_CERT *trusted_certificate)
+{
+UINT    status;
+
+    NX_PARAMETER_NOT_USED(client_ptr);
+
+    status = nx_secure_tls_session_create(tls_session, &nx_crypto_tls_ciphers,
+                                          test_mqtt_metadata, sizeof(test_mqtt_metadata));
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_packet_buffer_set(tls_session, test_mqtt_packet_buffer,
+                                                         sizeof(test_mqtt_packet_buffer));
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_remote_certificate_allocate(tls_session, certificate, test_mqtt_cert_buffer,
+                                                           sizeof(test_mqtt_cert_buffer));
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_x509_certificate_initialize(trusted_certificate, (UCHAR *)test_ca_der,
+                                                       sizeof(test_ca_der), NX_NULL, 0, NX_NULL, 0,
+                                                       NX_SECURE_X509_KEY_TYPE_NONE);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_trusted_certificate_add(tls_session, trusted_certificate);
+    }
+
+    return(status);
+}
+
+
+/* Wait until the broker has received the given number of PUBLISH packets in all.  */
+
+static UINT test_publishes_wait(UINT publishes)
+{
+
+    while (test_publishes < publishes)
+    {
+        if (tx_semaphore_get(&test_received, TEST_WAIT) != TX_SUCCESS)
+        {
+            return(NX_NOT_SUCCESSFUL);
+        }
+    }
+
+    return(NX_SUCCESS);
+}
+
+
+/* Publish a burst of QoS 0 packets and wait for the broker to have all of them.  */
+
+static UINT test_burst(UINT round)
+{
+UINT    status = NX_SUCCESS;
+UINT    publishes = test_publishes;
+UINT    i;
+double  start;
+
+    start = test_time_get();
+    for (i = 0; (status == NX_SUCCESS) && (i < TEST_BURST); i++)
+    {
+        status = nxd_mqtt_client_publish(&test_mqtt, TEST_TOPIC, sizeof(TEST_TOPIC) - 1, (CHAR *)test_sample,
+                                         TEST_SAMPLE_SIZE, NX_FALSE, 0, TEST_WAIT);
+    }
+    test_send_times[round] = test_time_get() - start;
+
+    if (status == NX_SUCCESS)
+    {
+        status = test_publishes_wait(publishes + TEST_BURST);
+    }
+    test_times[round] = test_received_time - start;
+
+    return(status);
+}
+
+
+static int test_time_compare(const void *first, const void *second)
+{
+double  difference = *(const double *)first - *(const double *)second;
+
+    return((difference > 0) - (difference < 0));
+}
+
+
+static VOID test_times_report(const CHAR *name, double *times)
+{
+double  sum = 0;
+UINT    round;
+
+    for (round = 0; round < TEST_ROUNDS; round++)
+    {
+        sum += times[round];
+    }
+    qsort(times, TEST_ROUNDS, sizeof(double), test_time_compare);
+    printf("%s: mean %8.1f us, median %8.1f us\n", name,
+           sum / TEST_ROUNDS / 1e3, times[TEST_ROUNDS / 2] / 1e3);
+}
+
+
+static VOID test_entry(ULONG thread_input)
+{
+UINT    status;
+UINT    records;
+UINT    round;
+UINT    i;
+#ifdef NXD_MQTT_TLS_COALESCE_ENABLE
+ULONG   start_time;
+#endif /* NXD_MQTT_TLS_COALESCE_ENABLE */
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    for (i = 0; i < TEST_SAMPLE_SIZE; i++)
+    {
+        test_sample[i] = (UCHAR)('a' + (i % 26));
+    }
+
+    nx_secure_tls_initialize();
+    status = nx_ip_create(&test_ip, "test", TEST_IP_ADDRESS, 0xFFFFFF00UL, &test_pool, NX_NULL, NX_NULL, 0, 1);
+    test_check(status == NX_SUCCESS, "IP create", status);
+    nx_tcp_enable(&test_ip);
+    test_address.nxd_ip_version = NX_IP_VERSION_V4;
+    test_address.nxd_ip_address.v4 = TEST_IP_ADDRESS;
+    tx_semaphore_create(&test_received, "received", 0);
+
+    /* Start the broker.  */
+    status = nx_tcp_socket_create(&test_ip, &test_broker_socket, "broker", NX_IP_NORMAL, NX_FRAGMENT_OKAY,
+                                  NX_IP_TIME_TO_LIVE, 8192, NX_NULL, NX_NULL);
+    test_check(status == NX_SUCCESS, "broker socket create", status);
+    status = nx_secure_tls_session_create(&test_broker_session, &nx_crypto_tls_ciphers,
+                                          test_broker_metadata, sizeof(test_broker_metadata));
+    test_check(status == NX_SUCCESS, "broker session create", status);
+    nx_secure_tls_session_packet_buffer_set(&test_broker_session, test_broker_packet_buffer,
+                                            sizeof(test_broker_packet_buffer));
+    nx_secure_x509_certificate_initialize(&test_broker_cert, (UCHAR *)test_server_der, sizeof(test_server_der),
+                                          NX_NULL, 0, test_server_key_der, sizeof(test_server_key_der),
+                                          NX_SECURE_X509_KEY_TYPE_RSA_PKCS1_DER);
+    status = nx_secure_tls_local_certificate_add(&test_broker_session, &test_broker_cert);
+    test_check(status == NX_SUCCESS, "broker certificate add", status);
+    nx_wifi_loopback_listen(&test_ip, &test_broker_socket, TEST_MQTT_PORT);
+    tx_thread_create(&test_broker_thread, "broker", test_broker_entry, 0, test_broker_thread_stack,
+                     sizeof(test_broker_thread_stack), 4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Connect the MQTT client.  */
+    status = nxd_mqtt_client_create(&test_mqtt, "mqtt", "device", 6, &test_ip, &test_pool,
+                                    test_mqtt_thread_stack, sizeof(test_mqtt_thread_stack), 6, NX_NULL, 0);
+    test_check(status == NX_SUCCESS, "MQTT client create", status);
+    status = nxd_mqtt_client_secure_connect(&test_mqtt, &test_address, TEST_MQTT_PORT, test_mqtt_tls_setup,
+                                            0, NX_TRUE, TEST_WAIT);
+    test_check(status == NX_SUCCESS, "MQTT connect", status);
+
+    /* A burst arrives whole, in order and, when coalesced, in fewer records than packets.  */
+    if (status == NX_SUCCESS)
+    {
+        records = test_records;
+        status = test_burst(0);
+        test_check(status == NX_SUCCESS, "burst", status);
+        test_check(test_bad_publishes == 0, "burst PUBLISH packets", test_bad_publishes);
+        records = test_records - records;
+#ifdef NXD_MQTT_TLS_COALESCE_ENABLE
+        test_check(records == (TEST_BURST + (NXD_MQTT_TLS_COALESCE_SIZE / TEST_PUBLISH_SIZE) - 1) /
+                              (NXD_MQTT_TLS_COALESCE_SIZE / TEST_PUBLISH_SIZE), "burst records", records);
+        test_check(test_largest_record <= NXD_MQTT_TLS_COALESCE_SIZE, "largest record", test_largest_record);
+#else
+        test_check(records == TEST_BURST, "burst records", records);
+#endif /* NXD_MQTT_TLS_COALESCE_ENABLE */
+    }
+
+#ifdef NXD_MQTT_TLS_COALESCE_ENABLE
+    /* A single PUBLISH is held until the flush timer fires, then goes out on its own.  */
+    if (status == NX_SUCCESS)
+    {
+        records = test_records;
+        start_time = tx_time_get();
+        status = nxd_mqtt_client_publish(&test_mqtt, TEST_TOPIC, sizeof(TEST_TOPIC) - 1, (CHAR *)test_sample,
+                                         TEST_SAMPLE_SIZE, NX_FALSE, 0, TEST_WAIT);
+        test_check(status == NX_SUCCESS, "single publish", status);
+        test_check(test_mqtt.nxd_mqtt_tls_coalesce_packet != NX_NULL, "single PUBLISH held", 0);
+        test_check(test_records == records, "single PUBLISH not sent", test_records);
+        status = test_publishes_wait(TEST_BURST + 1);
+        test_check(status == NX_SUCCESS, "single PUBLISH flushed", status);
+        test_check(tx_time_get() - start_time >= NXD_MQTT_TLS_COALESCE_TIMEOUT - 1, "flush timeout",
+                   (UINT)(tx_time_get() - start_time));
+        test_check(test_mqtt.nxd_mqtt_tls_coalesce_packet == NX_NULL, "nothing held after flush", 0);
+        test_check(test_records == records + 1, "single PUBLISH record", test_records);
+    }
+#endif /* NXD_MQTT_TLS_COALESCE_ENABLE */
+
+    /* Time bursts, and count the records they take.  */
+    if (status == NX_SUCCESS)
+    {
+        records = test_records;
+        for (round = 0; (status == NX_SUCCESS) && (round < TEST_ROUNDS); round++)
+        {
+            status = test_burst(round);
+        }
+        test_check(status == NX_SUCCESS, "benchmark bursts", status);
+        records = test_records - records;
+    }
+    if (status == NX_SUCCESS)
+    {
+        test_times_report("burst publish calls", test_send_times);
+        test_times_report("burst delivered    ", test_times);
+        printf("records per burst of %u PUBLISH packets: %u\n", TEST_BURST, records / TEST_ROUNDS);
+    }
+
+    nxd_mqtt_client_disconnect(&test_mqtt);
+
+    if (test_failures)
+    {
+        printf("nxd_mqtt_client_tls_coalesce_test: %u checks failed\n", test_failures);
+        exit(1);
+    }
+    printf("nxd_mqtt_client_tls_coalesce_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    NX_PARAMETER_NOT_USED(first_unused_memory);
+
+    nx_system_initialize();
+    nx_packet_pool_create(&test_pool, "test", TEST_PACKET_SIZE, test_pool_area, sizeof(test_pool_area));
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     8, 8, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
@@ -0,0 +1,501 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+#include "nx_api.h"
+#include "nx_ip.h"
+#include "nx_tcp.h"
+#include "nx_udp.h"
+#include "nx_wifi.h"
+#include "nx_wifi_loopback.h"
+
+
+#define NX_WIFI_LOOPBACK_SOCKETS    8
+#define NX_WIFI_LOOPBACK_LISTENERS  2
+
+
+/* Define the end of a connection. Packets received on the socket are queued here.  */
+
+typedef struct NX_WIFI_LOOPBACK_END_STRUCT
+{
+    NX_TCP_SOCKET  *nx_wifi_loopback_socket;
+    NX_TCP_SOCKET  *nx_wifi_loopback_peer;
+    NX_PACKET      *nx_wifi_loopback_head;
+    NX_PACKET      *nx_wifi_loopback_tail;
+    TX_SEMAPHORE    nx_wifi_loopback_semaphore;
+} NX_WIFI_LOOPBACK_END;
+
+static NX_WIFI_LOOPBACK_END nx_wifi_loopback_ends[NX_WIFI_LOOPBACK_SOCKETS];
+
+
+/* Define a server socket waiting for a client.  */
+
+typedef struct NX_WIFI_LOOPBACK_LISTENER_STRUCT
+{
+    NX_TCP_SOCKET  *nx_wifi_loopback_listen_socket;
+    UINT            nx_wifi_loopback_listen_port;
+} NX_WIFI_LOOPBACK_LISTENER;
+
+static NX_WIFI_LOOPBACK_LISTENER nx_wifi_loopback_listeners[NX_WIFI_LOOPBACK_LISTENERS];
+
+
+/* Define a bound UDP socket. Datagrams are queued on the socket itself, as the UDP layer does, and
+   the semaphore wakes a receiver.  */
+
+typedef struct NX_WIFI_LOOPBACK_UDP_END_STRUCT
+{
+    NX_UDP_SOCKET  *nx_wifi_loopback_udp_socket;
+    TX_SEMAPHORE    nx_wifi_loopback_udp_semaphore;
+    UINT            nx_wifi_loopback_udp_created;
+} NX_WIFI_LOOPBACK_UDP_END;
+
+static NX_WIFI_LOOPBACK_UDP_END nx_wifi_loopback_udp_ends[NX_WIFI_LOOPBACK_SOCKETS];
+
+
+/* Find the end of a socket, or a free end if the socket is NX_NULL.  */
+
+static NX_WIFI_LOOPBACK_END *nx_wifi_loopback_find(NX_TCP_SOCKET *socket_ptr)
+{
+UINT    i;
+
+    for (i = 0; i < NX_WIFI_LOOPBACK_SOCKETS; i++)
+    {
+        if (nx_wifi_loopback_ends[i].nx_wifi_loopback_socket == socket_ptr)
+        {
+            return(&nx_wifi_loopback_ends[i]);
+        }
+    }
+
+    return(NX_NULL);
+}
+
+
+static VOID nx_wifi_loopback_socket_setup(NX_IP *ip_ptr, NX_TCP_SOCKET *socket_ptr, NX_TCP_SOCKET *peer_ptr,
+                                          UINT client_type)
+{
+NX_WIFI_LOOPBACK_END *end_ptr;
+
+    /* Use the socket's end, or a free one.  */
+    end_ptr = nx_wifi_loopback_find(socket_ptr);
+    if (end_ptr == NX_NULL)
+    {
+        end_ptr = nx_wifi_loopback_find(NX_NULL);
+    }
+    if (end_ptr -> nx_wifi_loopback_socket == NX_NULL)
+    {
+        tx_semaphore_create(&end_ptr -> nx_wifi_loopback_semaphore, "loopback", 0);
+    }
+    end_ptr -> nx_wifi_loopback_socket = socket_ptr;
+    end_ptr -> nx_wifi_loopback_peer = peer_ptr;
+
+    socket_ptr -> nx_tcp_socket_id = NX_TCP_ID;
+    socket_ptr -> nx_tcp_socket_ip_ptr = ip_ptr;
+    socket_ptr -> nx_tcp_socket_client_type = client_type;
+    socket_ptr -> nx_tcp_socket_state = NX_TCP_ESTABLISHED;
+    socket_ptr -> nx_tcp_socket_connect_ip.nxd_ip_version = NX_IP_VERSION_V4;
+}
+
+
+UINT nx_wifi_loopback_connect(NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr,
+                              NX_TCP_SOCKET *client_socket, NX_TCP_SOCKET *server_socket)
+{
+
+    ip_ptr -> nx_ip_id = NX_IP_ID;
+    ip_ptr -> nx_ip_default_packet_pool = pool_ptr;
+
+    nx_wifi_loopback_socket_setup(ip_ptr, client_socket, server_socket, NX_TRUE);
+    nx_wifi_loopback_socket_setup(ip_ptr, server_socket, client_socket, NX_FALSE);
+
+    return(NX_SUCCESS);
+}
+
+
+UINT nx_wifi_loopback_listen(NX_IP *ip_ptr, NX_TCP_SOCKET *server_socket, UINT port)
+{
+UINT    i;
+
+    for (i = 0; i < NX_WIFI_LOOPBACK_LISTENERS; i++)
+    {
+        if (nx_wifi_loopback_listeners[i].nx_wifi_loopback_listen_socket == NX_NULL)
+        {
+            server_socket -> nx_tcp_socket_ip_ptr = ip_ptr;
+            server_socket -> nx_tcp_socket_port = port;
+            server_socket -> nx_tcp_socket_state = NX_TCP_LISTEN_STATE;
+            nx_wifi_loopback_listeners[i].nx_wifi_loopback_listen_port = port;
+            nx_wifi_loopback_listeners[i].nx_wifi_loopback_listen_socket = server_socket;
+            return(NX_SUCCESS);
+        }
+    }
+
+    return(NX_NO_FREE_PORTS);
+}
+
+
+UINT nx_wifi_loopback_accept(NX_TCP_SOCKET *server_socket, ULONG wait_option)
+{
+
+    /* The client sets up both ends when it connects.  */
+    while (server_socket -> nx_tcp_socket_state != NX_TCP_ESTABLISHED)
+    {
+        if (wait_option == 0)
+        {
+            return(NX_NOT_CONNECTED);
+        }
+        if (wait_option != NX_WAIT_FOREVER)
+        {
+            wait_option--;
+        }
+        tx_thread_sleep(1);
+    }
+
+    return(NX_SUCCESS);
+}
+
+
+UINT nx_wifi_initialize(NX_IP *ip_ptr, NX_PACKET_POOL *packet_pool)
+{
+
+    NX_PARAMETER_NOT_USED(ip_ptr);
+    NX_PARAMETER_NOT_USED(packet_pool);
+
+    return(NX_NOT_SUPPORTED);
+}
+
+
+UINT nx_wifi_tcp_client_socket_connect(NX_TCP_SOCKET *socket_ptr, NXD_ADDRESS *server_ip,
+                                       UINT server_port, ULONG wait_option)
+{
+UINT            i;
+NX_TCP_SOCKET  *server_socket;
+
+    NX_PARAMETER_NOT_USED(server_ip);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    /* Find the server socket listening on the port, the connection is set up at once.  */
+    for (i = 0; i < NX_WIFI_LOOPBACK_LISTENERS; i++)
+    {
+        server_socket = nx_wifi_loopback_listeners[i].nx_wifi_loopback_listen_socket;
+        if ((server_socket) && (nx_wifi_loopback_listeners[i].nx_wifi_loopback_listen_port == server_port))
+        {
+            nx_wifi_loopback_listeners[i].nx_wifi_loopback_listen_socket = NX_NULL;
+            nx_wifi_loopback_socket_setup(socket_ptr -> nx_tcp_socket_ip_ptr, socket_ptr, server_socket, NX_TRUE);
+            nx_wifi_loopback_socket_setup(server_socket -> nx_tcp_socket_ip_ptr, server_socket, socket_ptr, NX_FALSE);
+            return(NX_SUCCESS);
+        }
+    }
+
+    return(NX_NOT_CONNECTED);
+}
+
+
+UINT nx_wifi_tcp_socket_disconnect(NX_TCP_SOCKET *socket_ptr, ULONG wait_option)
+{
+
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    socket_ptr -> nx_tcp_socket_state = NX_TCP_CLOSED;
+
+    return(NX_SUCCESS);
+}
+
+
+UINT nx_wifi_tcp_socket_send(NX_TCP_SOCKET *socket_ptr, NX_PACKET *packet_ptr, ULONG wait_option)
+{
+TX_INTERRUPT_SAVE_AREA
+NX_WIFI_LOOPBACK_END *end_ptr;
+NX_WIFI_LOOPBACK_END *peer_end_ptr;
+
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    end_ptr = nx_wifi_loopback_find(socket_ptr);
+    if ((end_ptr == NX_NULL) || (socket_ptr -> nx_tcp_socket_state != NX_TCP_ESTABLISHED))
+    {
+        return(NX_NOT_CONNECTED);
+    }
+    peer_end_ptr = nx_wifi_loopback_find(end_ptr -> nx_wifi_loopback_peer);
+
+    /* Queue the packet for the peer.  */
+    TX_DISABLE
+    packet_ptr -> nx_packet_queue_next = NX_NULL;
+    if (peer_end_ptr -> nx_wifi_loopback_tail)
+    {
+        peer_end_ptr -> nx_wifi_loopback_tail -> nx_packet_queue_next = packet_ptr;
+    }
+    else
+    {
+        peer_end_ptr -> nx_wifi_loopback_head = packet_ptr;
+    }
+    peer_end_ptr -> nx_wifi_loopback_tail = packet_ptr;
+    TX_RESTORE
+
+    tx_semaphore_put(&peer_end_ptr -> nx_wifi_loopback_semaphore);
+
+    /* Notify the peer, as the WiFi thread does.  */
+    if (end_ptr -> nx_wifi_loopback_peer -> nx_tcp_receive_callback)
+    {
+        (end_ptr -> nx_wifi_loopback_peer -> nx_tcp_receive_callback)(end_ptr -> nx_wifi_loopback_peer);
+    }
+
+    return(NX_SUCCESS);
+}
+
+
+UINT nx_wifi_tcp_socket_receive(NX_TCP_SOCKET *socket_ptr, NX_PACKET **packet_ptr, ULONG wait_option)
+{
+TX_INTERRUPT_SAVE_AREA
+NX_WIFI_LOOPBACK_END *end_ptr;
+
+    end_ptr = nx_wifi_loopback_find(socket_ptr);
+    if (end_ptr == NX_NULL)
+    {
+        return(NX_NOT_CONNECTED);
+    }
+
+    if (tx_semaphore_get(&end_ptr -> nx_wifi_loopback_semaphore, wait_option) != TX_SUCCESS)
+    {
+        return(NX_NO_PACKET);
+    }
+
+    TX_DISABLE
+    *packet_ptr = end_ptr -> nx_wifi_loopback_head;
+    end_ptr -> nx_wifi_loopback_head = (*packet_ptr) -> nx_packet_queue_next;
+    if (end_ptr -> nx_wifi_loopback_head == NX_NULL)
+    {
+        end_ptr -> nx_wifi_loopback_tail = NX_NULL;
+    }
+    TX_RESTORE
+
+    (*packet_ptr) -> nx_packet_queue_next = NX_NULL;
+
+    return(NX_SUCCESS);
+}
+
+
+/* Find the end of a bound UDP socket, or a free end if the socket is NX_NULL.  */
+
+static NX_WIFI_LOOPBACK_UDP_END *nx_wifi_loopback_udp_find(NX_UDP_SOCKET *socket_ptr)
+{
+UINT    i;
+
+    for (i = 0; i < NX_WIFI_LOOPBACK_SOCKETS; i++)
+    {
+        if (nx_wifi_loopback_udp_ends[i].nx_wifi_loopback_udp_socket == socket_ptr)
+        {
+            return(&nx_wifi_loopback_udp_ends[i]);
+        }
+    }
+
+    return(NX_NULL);
+}
+
+
+UINT nx_wifi_udp_socket_bind(NX_UDP_SOCKET *socket_ptr, UINT port, ULONG wait_option)
+{
+NX_WIFI_LOOPBACK_UDP_END *end_ptr;
+
+    NX_PARAMETER_NOT_USED(port);
+    NX_PARAMETER_NOT_USED(wait_option);
+
+    /* The port is already saved in the socket.  */
+    end_ptr = nx_wifi_loopback_udp_find(NX_NULL);
+    if (end_ptr == NX_NULL)
+    {
+        return(NX_NO_FREE_PORTS);
+    }
+    if (!end_ptr -> nx_wifi_loopback_udp_created)
+    {
+        tx_semaphore_create(&end_ptr -> nx_wifi_loopback_udp_semaphore, "loopback", 0);
+        end_ptr -> nx_wifi_loopback_udp_created = NX_TRUE;
+    }
+    end_ptr -> nx_wifi_loopback_udp_socket = socket_ptr;
+
+    return(NX_SUCCESS);
+}
+
+
+UINT nx_wifi_udp_socket_unbind(NX_UDP_SOCKET *socket_ptr)
+{
+TX_INTERRUPT_SAVE_AREA
+NX_WIFI_LOOPBACK_UDP_END *end_ptr;
+NX_PACKET                *packet_ptr;
+NX_PACKET                *next_packet_ptr;
+
+    end_ptr = nx_wifi_loopback_udp_find(socket_ptr);
+    if (end_ptr == NX_NULL)
+    {
+        return(NX_NOT_BOUND);
+    }
+
+    /* Take the datagrams still queued on the socket.  */
+    TX_DISABLE
+    end_ptr -> nx_wifi_loopback_udp_socket = NX_NULL;
+    packet_ptr = socket_ptr -> nx_udp_socket_receive_head;
+    socket_ptr -> nx_udp_socket_receive_head = NX_NULL;
+    socket_ptr -> nx_udp_socket_receive_tail = NX_NULL;
+    socket_ptr -> nx_udp_socket_receive_count = 0;
+    TX_RESTORE
+
+    while (packet_ptr)
+    {
+        next_packet_ptr = packet_ptr -> nx_packet_queue_next;
+        packet_ptr -> nx_packet_queue_next = NX_NULL;
+        nx_packet_release(packet_ptr);
+        packet_ptr = next_packet_ptr;
+    }
+
+    /* Drop wake-ups left for a former receiver.  */
+    while (tx_semaphore_get(&end_ptr -> nx_wifi_loopback_udp_semaphore, TX_NO_WAIT) == TX_SUCCESS)
+    {
+    }
+
+    return(NX_SUCCESS);
+}
+
+
+UINT nx_wifi_udp_socket_send(NX_UDP_SOCKET *socket_ptr, NX_PACKET *packet_ptr,
+                             NXD_ADDRESS *ip_address, UINT port)
+{
+TX_INTERRUPT_SAVE_AREA
+NX_WIFI_LOOPBACK_UDP_END *peer_end_ptr = NX_NULL;
+NX_UDP_SOCKET            *peer_ptr;
+NX_UDP_HEADER            *udp_header_ptr;
+NX_IPV4_HEADER           *ip_header_ptr;
+NX_PACKET                *copy_ptr;
+ULONG                     udp_length;
+UINT                      i;
+
+    NX_PARAMETER_NOT_USED(ip_address);
+
+    /* Room is needed for the UDP and IPv4 headers.  */
+    if ((ULONG)(packet_ptr -> nx_packet_prepend_ptr - packet_ptr -> nx_packet_data_start) <
+        (sizeof(NX_UDP_HEADER) + sizeof(NX_IPV4_HEADER)))
+    {
+        return(NX_UNDERFLOW);
+    }
+
+    /* Find the socket bound to the destination port.  */
+    for (i = 0; i < NX_WIFI_LOOPBACK_SOCKETS; i++)
+    {
+        peer_ptr = nx_wifi_loopback_udp_ends[i].nx_wifi_loopback_udp_socket;
+        if ((peer_ptr) && (peer_ptr -> nx_udp_socket_port == port))
+        {
+            peer_end_ptr = &nx_wifi_loopback_udp_ends[i];
+            break;
+        }
+    }
+
+    /* The datagram is lost when nobody is bound to the port, or when the queue is full.  */
+    if ((peer_end_ptr == NX_NULL) ||
+        (peer_end_ptr -> nx_wifi_loopback_udp_socket -> nx_udp_socket_receive_count >=
+         peer_end_ptr -> nx_wifi_loopback_udp_socket -> nx_udp_socket_queue_maximum))
+    {
+        packet_ptr -> nx_packet_prepend_ptr -= sizeof(NX_UDP_HEADER);
+        packet_ptr -> nx_packet_length += sizeof(NX_UDP_HEADER);
+        nx_packet_transmit_release(packet_ptr);
+        return(NX_SUCCESS);
+    }
+    peer_ptr = peer_end_ptr -> nx_wifi_loopback_udp_socket;
+
+    /* The peer gets a copy, as the module sends the data and the driver releases the packet.  */
+    if (nx_packet_copy(packet_ptr, &copy_ptr, socket_ptr -> nx_udp_socket_ip_ptr -> nx_ip_default_packet_pool,
+                       NX_NO_WAIT))
+    {
+        return(NX_NO_PACKET);
+    }
+    packet_ptr -> nx_packet_prepend_ptr -= sizeof(NX_UDP_HEADER);
+    packet_ptr -> nx_packet_length += sizeof(NX_UDP_HEADER);
+    nx_packet_transmit_release(packet_ptr);
+    packet_ptr = copy_ptr;
+
+    /* Build the UDP and IPv4 headers, in host byte order, as the WiFi driver does.  */
+    udp_length = packet_ptr -> nx_packet_length + sizeof(NX_UDP_HEADER);
+    udp_header_ptr = (NX_UDP_HEADER *)(packet_ptr -> nx_packet_prepend_ptr - sizeof(NX_UDP_HEADER));
+    udp_header_ptr -> nx_udp_header_word_0 = (((ULONG)socket_ptr -> nx_udp_socket_port) << NX_SHIFT_BY_16) | (ULONG)port;
+    udp_header_ptr -> nx_udp_header_word_1 = udp_length << NX_SHIFT_BY_16;
+    ip_header_ptr = (NX_IPV4_HEADER *)(((UCHAR *)udp_header_ptr) - sizeof(NX_IPV4_HEADER));
+    ip_header_ptr -> nx_ip_header_word_0 = (NX_IP_VERSION | (udp_length + sizeof(NX_IPV4_HEADER)));
+    ip_header_ptr -> nx_ip_header_word_1 = 0;
+    ip_header_ptr -> nx_ip_header_word_2 = NX_IP_UDP;
+    ip_header_ptr -> nx_ip_header_source_ip = socket_ptr -> nx_udp_socket_ip_ptr -> nx_ip_address;
+    ip_header_ptr -> nx_ip_header_destination_ip = peer_ptr -> nx_udp_socket_ip_ptr -> nx_ip_address;
+    packet_ptr -> nx_packet_ip_version = NX_IP_VERSION_V4;
+    packet_ptr -> nx_packet_ip_header = (UCHAR *)ip_header_ptr;
+    packet_ptr -> nx_packet_address.nx_packet_interface_ptr = &(peer_ptr -> nx_udp_socket_ip_ptr -> nx_ip_interface[0]);
+
+    /* Queue the datagram from its UDP header, as the UDP layer does.  */
+    packet_ptr -> nx_packet_prepend_ptr -= sizeof(NX_UDP_HEADER);
+    packet_ptr -> nx_packet_length += sizeof(NX_UDP_HEADER);
+    packet_ptr -> nx_packet_queue_next = NX_NULL;
+    TX_DISABLE
+    if (peer_ptr -> nx_udp_socket_receive_tail)
+    {
+        peer_ptr -> nx_udp_socket_receive_tail -> nx_packet_queue_next = packet_ptr;
+    }
+    else
+    {
+        peer_ptr -> nx_udp_socket_receive_head = packet_ptr;
+    }
+    peer_ptr -> nx_udp_socket_receive_tail = packet_ptr;
+    peer_ptr -> nx_udp_socket_receive_count++;
+    TX_RESTORE
+
+    tx_semaphore_put(&peer_end_ptr -> nx_wifi_loopback_udp_semaphore);
+
+    /* Notify the peer, as the WiFi thread does.  */
+    if (peer_ptr -> nx_udp_receive_callback)
+    {
+        (peer_ptr -> nx_udp_receive_callback)(peer_ptr);
+    }
+
+    return(NX_SUCCESS);
+}
+
+
+UINT nx_wifi_udp_socket_receive(NX_UDP_SOCKET *socket_ptr, NX_PACKET **packet_ptr, ULONG wait_option)
+{
+TX_INTERRUPT_SAVE_AREA
+NX_WIFI_LOOPBACK_UDP_END *end_ptr;
+
+    end_ptr = nx_wifi_loopback_udp_find(socket_ptr);
+    if (end_ptr == NX_NULL)
+    {
+        return(NX_NOT_BOUND);
+    }
+
+    /* A receive notify may have taken the datagram a wake-up was given for, so check the queue
+       each time.  */
+    for (;;)
+    {
+        TX_DISABLE
+        *packet_ptr = socket_ptr -> nx_udp_socket_receive_head;
+        if (*packet_ptr)
+        {
+            socket_ptr -> nx_udp_socket_receive_head = (*packet_ptr) -> nx_packet_queue_next;
+            if (socket_ptr -> nx_udp_socket_receive_head == NX_NULL)
+            {
+                socket_ptr -> nx_udp_socket_receive_tail = NX_NULL;
+            }
+            socket_ptr -> nx_udp_socket_receive_count--;
+            TX_RESTORE
+
+            /* Return the data, behind the UDP header.  */
+            (*packet_ptr) -> nx_packet_queue_next = NX_NULL;
+            (*packet_ptr) -> nx_packet_prepend_ptr += sizeof(NX_UDP_HEADER);
+            (*packet_ptr) -> nx_packet_length -= sizeof(NX_UDP_HEADER);
+            return(NX_SUCCESS);
+        }
+        TX_RESTORE
+
+        if (tx_semaphore_get(&end_ptr -> nx_wifi_loopback_udp_semaphore, wait_option) != TX_SUCCESS)
+        {
+            return(NX_NO_PACKET);
+        }
+    }
+}
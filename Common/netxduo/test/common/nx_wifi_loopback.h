@@ -0,0 +1,38 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* TCP and UDP loopback for the host tests. It takes the place of the WiFi offload driver behind
+   the nx_tcp_socket_* and nx_udp_socket_* calls: a packet sent on one socket of a connected pair is
+   queued, unchanged, for receive on the other. There is no IP layer; nx_wifi_loopback_connect sets
+   up the fields of the IP instance and the sockets that NetX Duo and NX Secure use. A client socket
+   can also connect, through nxd_tcp_client_socket_connect, to a server socket that listens with
+   nx_wifi_loopback_listen, and the receive notify of the peer is called on each send.
+   A UDP datagram is given to the socket bound to the destination port, on any IP instance, with the
+   UDP and IPv4 headers the WiFi driver builds; the source address is the one of the sending IP
+   instance. A datagram to a port nobody is bound to is dropped.  */
+
+#ifndef NX_WIFI_LOOPBACK_H
+#define NX_WIFI_LOOPBACK_H
+
+#include "nx_api.h"
+
+/* Connect a client socket to a server socket, both attached to the given IP instance whose
+   default packet pool is used by TLS.  */
+UINT nx_wifi_loopback_connect(NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr,
+                              NX_TCP_SOCKET *client_socket, NX_TCP_SOCKET *server_socket);
+
+/* Let a server socket take the connection of the next client that connects to the given port.  */
+UINT nx_wifi_loopback_listen(NX_IP *ip_ptr, NX_TCP_SOCKET *server_socket, UINT port);
+
+/* Wait for a client to connect to a listening server socket.  */
+UINT nx_wifi_loopback_accept(NX_TCP_SOCKET *server_socket, ULONG wait_option);
+
+#endif /* NX_WIFI_LOOPBACK_H */
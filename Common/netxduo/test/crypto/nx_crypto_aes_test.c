@@ -0,0 +1,442 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks AES-ECB, AES-CBC and AES-CTR against the examples of NIST SP 800-38A for 128, 192
+   and 256-bit keys, and AES-GCM against test cases 4 and 16 of the GCM specification, whose 60-byte
+   plaintext ends in a partial block. Each mode runs over the whole message in one call, which the
+   modes hand to the cipher in batches of blocks, and split into several calls, and in place. The
+   GCM tag is verified on decryption, and a corrupted tag must be rejected. The test is built with
+   the table-based AES and with NX_CRYPTO_AES_CONSTANT_TIME, and reports the AES-128 throughput of
+   CTR, GCM and CBC decryption with each.  */
+
+#include "nx_crypto_aes.h"
+#include <stdio.h>
+#include <time.h>
+
+
+#define TEST_MESSAGE_SIZE       64
+#define TEST_GCM_MESSAGE_SIZE   60
+#define TEST_GCM_AAD_SIZE       20
+#define TEST_BENCHMARK_SIZE     4096
+#define TEST_BENCHMARK_ROUNDS   200
+
+
+typedef UINT (*TEST_BLOCK_FUNCTION)(VOID *, UCHAR *, UCHAR *, UINT);
+
+typedef struct TEST_VECTOR_STRUCT
+{
+    UINT            key_size;
+    UCHAR           key[32];
+    UCHAR           ecb[TEST_MESSAGE_SIZE];
+    UCHAR           cbc[TEST_MESSAGE_SIZE];
+    UCHAR           ctr[TEST_MESSAGE_SIZE];
+} TEST_VECTOR;
+
+typedef struct TEST_GCM_VECTOR_STRUCT
+{
+    UINT            key_size;
+    UCHAR           key[32];
+    UCHAR           ciphertext[TEST_GCM_MESSAGE_SIZE];
+    UCHAR           tag[16];
+} TEST_GCM_VECTOR;
+
+
+/* Define the SP 800-38A plaintext, IV and initial counter block.  */
+
+static const UCHAR      test_plaintext[TEST_MESSAGE_SIZE] =
+{
+    0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+    0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+    0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+    0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10
+};
+
+static const UCHAR      test_iv[16] =
+{
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+
+static const UCHAR      test_counter[16] =
+{
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+
+
+/* Define the SP 800-38A ciphertexts. The key size is in 32-bit words.  */
+
+static const TEST_VECTOR test_vectors[] =
+{
+    {
+        4,
+        {
+            0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x3a, 0xd7, 0x7b, 0xb4, 0x0d, 0x7a, 0x36, 0x60, 0xa8, 0x9e, 0xca, 0xf3, 0x24, 0x66, 0xef, 0x97,
+            0xf5, 0xd3, 0xd5, 0x85, 0x03, 0xb9, 0x69, 0x9d, 0xe7, 0x85, 0x89, 0x5a, 0x96, 0xfd, 0xba, 0xaf,
+            0x43, 0xb1, 0xcd, 0x7f, 0x59, 0x8e, 0xce, 0x23, 0x88, 0x1b, 0x00, 0xe3, 0xed, 0x03, 0x06, 0x88,
+            0x7b, 0x0c, 0x78, 0x5e, 0x27, 0xe8, 0xad, 0x3f, 0x82, 0x23, 0x20, 0x71, 0x04, 0x72, 0x5d, 0xd4
+        },
+        {
+            0x76, 0x49, 0xab, 0xac, 0x81, 0x19, 0xb2, 0x46, 0xce, 0xe9, 0x8e, 0x9b, 0x12, 0xe9, 0x19, 0x7d,
+            0x50, 0x86, 0xcb, 0x9b, 0x50, 0x72, 0x19, 0xee, 0x95, 0xdb, 0x11, 0x3a, 0x91, 0x76, 0x78, 0xb2,
+            0x73, 0xbe, 0xd6, 0xb8, 0xe3, 0xc1, 0x74, 0x3b, 0x71, 0x16, 0xe6, 0x9e, 0x22, 0x22, 0x95, 0x16,
+            0x3f, 0xf1, 0xca, 0xa1, 0x68, 0x1f, 0xac, 0x09, 0x12, 0x0e, 0xca, 0x30, 0x75, 0x86, 0xe1, 0xa7
+        },
+        {
+            0x87, 0x4d, 0x61, 0x91, 0xb6, 0x20, 0xe3, 0x26, 0x1b, 0xef, 0x68, 0x64, 0x99, 0x0d, 0xb6, 0xce,
+            0x98, 0x06, 0xf6, 0x6b, 0x79, 0x70, 0xfd, 0xff, 0x86, 0x17, 0x18, 0x7b, 0xb9, 0xff, 0xfd, 0xff,
+            0x5a, 0xe4, 0xdf, 0x3e, 0xdb, 0xd5, 0xd3, 0x5e, 0x5b, 0x4f, 0x09, 0x02, 0x0d, 0xb0, 0x3e, 0xab,
+            0x1e, 0x03, 0x1d, 0xda, 0x2f, 0xbe, 0x03, 0xd1, 0x79, 0x21, 0x70, 0xa0, 0xf3, 0x00, 0x9c, 0xee
+        }
+    },
+    {
+        6,
+        {
+            0x8e, 0x73, 0xb0, 0xf7, 0xda, 0x0e, 0x64, 0x52, 0xc8, 0x10, 0xf3, 0x2b, 0x80, 0x90, 0x79, 0xe5,
+            0x62, 0xf8, 0xea, 0xd2, 0x52, 0x2c, 0x6b, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0xbd, 0x33, 0x4f, 0x1d, 0x6e, 0x45, 0xf2, 0x5f, 0xf7, 0x12, 0xa2, 0x14, 0x57, 0x1f, 0xa5, 0xcc,
+            0x97, 0x41, 0x04, 0x84, 0x6d, 0x0a, 0xd3, 0xad, 0x77, 0x34, 0xec, 0xb3, 0xec, 0xee, 0x4e, 0xef,
+            0xef, 0x7a, 0xfd, 0x22, 0x70, 0xe2, 0xe6, 0x0a, 0xdc, 0xe0, 0xba, 0x2f, 0xac, 0xe6, 0x44, 0x4e,
+            0x9a, 0x4b, 0x41, 0xba, 0x73, 0x8d, 0x6c, 0x72, 0xfb, 0x16, 0x69, 0x16, 0x03, 0xc1, 0x8e, 0x0e
+        },
+        {
+            0x4f, 0x02, 0x1d, 0xb2, 0x43, 0xbc, 0x63, 0x3d, 0x71, 0x78, 0x18, 0x3a, 0x9f, 0xa0, 0x71, 0xe8,
+            0xb4, 0xd9, 0xad, 0xa9, 0xad, 0x7d, 0xed, 0xf4, 0xe5, 0xe7, 0x38, 0x76, 0x3f, 0x69, 0x14, 0x5a,
+            0x57, 0x1b, 0x24, 0x20, 0x12, 0xfb, 0x7a, 0xe0, 0x7f, 0xa9, 0xba, 0xac, 0x3d, 0xf1, 0x02, 0xe0,
+            0x08, 0xb0, 0xe2, 0x79, 0x88, 0x59, 0x88, 0x81, 0xd9, 0x20, 0xa9, 0xe6, 0x4f, 0x56, 0x15, 0xcd
+        },
+        {
+            0x1a, 0xbc, 0x93, 0x24, 0x17, 0x52, 0x1c, 0xa2, 0x4f, 0x2b, 0x04, 0x59, 0xfe, 0x7e, 0x6e, 0x0b,
+            0x09, 0x03, 0x39, 0xec, 0x0a, 0xa6, 0xfa, 0xef, 0xd5, 0xcc, 0xc2, 0xc6, 0xf4, 0xce, 0x8e, 0x94,
+            0x1e, 0x36, 0xb2, 0x6b, 0xd1, 0xeb, 0xc6, 0x70, 0xd1, 0xbd, 0x1d, 0x66, 0x56, 0x20, 0xab, 0xf7,
+            0x4f, 0x78, 0xa7, 0xf6, 0xd2, 0x98, 0x09, 0x58, 0x5a, 0x97, 0xda, 0xec, 0x58, 0xc6, 0xb0, 0x50
+        }
+    },
+    {
+        8,
+        {
+            0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+            0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4
+        },
+        {
+            0xf3, 0xee, 0xd1, 0xbd, 0xb5, 0xd2, 0xa0, 0x3c, 0x06, 0x4b, 0x5a, 0x7e, 0x3d, 0xb1, 0x81, 0xf8,
+            0x59, 0x1c, 0xcb, 0x10, 0xd4, 0x10, 0xed, 0x26, 0xdc, 0x5b, 0xa7, 0x4a, 0x31, 0x36, 0x28, 0x70,
+            0xb6, 0xed, 0x21, 0xb9, 0x9c, 0xa6, 0xf4, 0xf9, 0xf1, 0x53, 0xe7, 0xb1, 0xbe, 0xaf, 0xed, 0x1d,
+            0x23, 0x30, 0x4b, 0x7a, 0x39, 0xf9, 0xf3, 0xff, 0x06, 0x7d, 0x8d, 0x8f, 0x9e, 0x24, 0xec, 0xc7
+        },
+        {
+            0xf5, 0x8c, 0x4c, 0x04, 0xd6, 0xe5, 0xf1, 0xba, 0x77, 0x9e, 0xab, 0xfb, 0x5f, 0x7b, 0xfb, 0xd6,
+            0x9c, 0xfc, 0x4e, 0x96, 0x7e, 0xdb, 0x80, 0x8d, 0x67, 0x9f, 0x77, 0x7b, 0xc6, 0x70, 0x2c, 0x7d,
+            0x39, 0xf2, 0x33, 0x69, 0xa9, 0xd9, 0xba, 0xcf, 0xa5, 0x30, 0xe2, 0x63, 0x04, 0x23, 0x14, 0x61,
+            0xb2, 0xeb, 0x05, 0xe2, 0xc3, 0x9b, 0xe9, 0xfc, 0xda, 0x6c, 0x19, 0x07, 0x8c, 0x6a, 0x9d, 0x1b
+        },
+        {
+            0x60, 0x1e, 0xc3, 0x13, 0x77, 0x57, 0x89, 0xa5, 0xb7, 0xa7, 0xf5, 0x04, 0xbb, 0xf3, 0xd2, 0x28,
+            0xf4, 0x43, 0xe3, 0xca, 0x4d, 0x62, 0xb5, 0x9a, 0xca, 0x84, 0xe9, 0x90, 0xca, 0xca, 0xf5, 0xc5,
+            0x2b, 0x09, 0x30, 0xda, 0xa2, 0x3d, 0xe9, 0x4c, 0xe8, 0x70, 0x17, 0xba, 0x2d, 0x84, 0x98, 0x8d,
+            0xdf, 0xc9, 0xc5, 0x8d, 0xb6, 0x7a, 0xad, 0xa6, 0x13, 0xc2, 0xdd, 0x08, 0x45, 0x79, 0x41, 0xa6
+        }
+    }
+};
+
+
+/* Define the plaintext, additional data and IV of GCM test cases 4 and 16. The IV is preceded by its
+   length, as _nx_crypto_gcm_encrypt_init expects.  */
+
+static const UCHAR      test_gcm_plaintext[TEST_GCM_MESSAGE_SIZE] =
+{
+    0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+    0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+    0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+    0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39
+};
+
+static const UCHAR      test_gcm_aad[TEST_GCM_AAD_SIZE] =
+{
+    0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+    0xab, 0xad, 0xda, 0xd2
+};
+
+static const UCHAR      test_gcm_iv[13] =
+{
+    0x0c, 0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88
+};
+
+static const TEST_GCM_VECTOR test_gcm_vectors[] =
+{
+    {
+        4,
+        {
+            0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        },
+        {
+            0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+            0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0, 0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+            0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+            0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91
+        },
+        {
+            0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb, 0x94, 0xfa, 0xe9, 0x5a, 0xe7, 0x12, 0x1a, 0x47
+        }
+    },
+    {
+        8,
+        {
+            0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08,
+            0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08
+        },
+        {
+            0x52, 0x2d, 0xc1, 0xf0, 0x99, 0x56, 0x7d, 0x07, 0xf4, 0x7f, 0x37, 0xa3, 0x2a, 0x84, 0x42, 0x7d,
+            0x64, 0x3a, 0x8c, 0xdc, 0xbf, 0xe5, 0xc0, 0xc9, 0x75, 0x98, 0xa2, 0xbd, 0x25, 0x55, 0xd1, 0xaa,
+            0x8c, 0xb0, 0x8e, 0x48, 0x59, 0x0d, 0xbb, 0x3d, 0xa7, 0xb0, 0x8b, 0x10, 0x56, 0x82, 0x88, 0x38,
+            0xc5, 0xf6, 0x1e, 0x63, 0x93, 0xba, 0x7a, 0x0a, 0xbc, 0xc9, 0xf6, 0x62
+        },
+        {
+            0x76, 0xfc, 0x6e, 0xce, 0x0f, 0x4e, 0x17, 0x68, 0xcd, 0xdf, 0x88, 0x53, 0xbb, 0x2d, 0x55, 0x1b
+        }
+    }
+};
+
+
+/* Define the splits of the message into calls: the first call takes the given number of bytes and
+   the second the rest. 0 and the message size run the whole message in one call.  */
+
+static const UINT       test_splits[] = { 0, 16, 48, TEST_MESSAGE_SIZE };
+
+static NX_CRYPTO_AES    test_aes;
+static UCHAR            test_buffer[TEST_MESSAGE_SIZE + 4];
+static UCHAR            test_output[TEST_MESSAGE_SIZE];
+static UCHAR            test_benchmark_buffer[TEST_BENCHMARK_SIZE];
+static UINT             test_failures;
+
+
+/* Record a failed check.  */
+
+static VOID test_check(UINT condition, const CHAR *name, UINT key_size, UINT split)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s, %u-bit key, split at %u\n", name, key_size * 32, split);
+        test_failures++;
+    }
+}
+
+
+/* Check ECB, CBC and CTR with one key.  */
+
+static VOID test_modes(const TEST_VECTOR *vector)
+{
+NX_CRYPTO_CBC  *cbc = &test_aes.nx_crypto_aes_mode_context.cbc;
+NX_CRYPTO_CTR  *ctr = &test_aes.nx_crypto_aes_mode_context.ctr;
+UCHAR          *in_place = test_buffer + 1;
+UINT            i, split;
+
+    _nx_crypto_aes_key_set(&test_aes, (UCHAR *)vector -> key, vector -> key_size);
+    for (i = 0; i < sizeof(test_splits) / sizeof(test_splits[0]); i++)
+    {
+        split = test_splits[i];
+
+        /* ECB, in two calls.  */
+        if (split)
+        {
+            _nx_crypto_aes_encrypt(&test_aes, (UCHAR *)test_plaintext, test_output, split);
+        }
+        if (split < TEST_MESSAGE_SIZE)
+        {
+            _nx_crypto_aes_encrypt(&test_aes, (UCHAR *)test_plaintext + split, test_output + split,
+                                   TEST_MESSAGE_SIZE - split);
+        }
+        test_check(memcmp(test_output, vector -> ecb, TEST_MESSAGE_SIZE) == 0, "ECB encrypt", vector -> key_size, split);
+        memcpy(in_place, vector -> ecb, TEST_MESSAGE_SIZE);
+        _nx_crypto_aes_decrypt(&test_aes, in_place, in_place, TEST_MESSAGE_SIZE);
+        test_check(memcmp(in_place, test_plaintext, TEST_MESSAGE_SIZE) == 0, "ECB decrypt", vector -> key_size, split);
+
+        /* CBC, in two calls.  */
+        _nx_crypto_cbc_encrypt_init(cbc, (UCHAR *)test_iv, sizeof(test_iv));
+        _nx_crypto_cbc_encrypt(&test_aes, cbc, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                               (UCHAR *)test_plaintext, test_output, split, 16);
+        _nx_crypto_cbc_encrypt(&test_aes, cbc, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                               (UCHAR *)test_plaintext + split, test_output + split, TEST_MESSAGE_SIZE - split, 16);
+        test_check(memcmp(test_output, vector -> cbc, TEST_MESSAGE_SIZE) == 0, "CBC encrypt", vector -> key_size, split);
+
+        /* CBC decryption in place, in two calls.  */
+        memcpy(in_place, vector -> cbc, TEST_MESSAGE_SIZE);
+        _nx_crypto_cbc_decrypt_init(cbc, (UCHAR *)test_iv, sizeof(test_iv));
+        _nx_crypto_cbc_decrypt(&test_aes, cbc, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_decrypt,
+                               in_place, in_place, split, 16);
+        _nx_crypto_cbc_decrypt(&test_aes, cbc, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_decrypt,
+                               in_place + split, in_place + split, TEST_MESSAGE_SIZE - split, 16);
+        test_check(memcmp(in_place, test_plaintext, TEST_MESSAGE_SIZE) == 0, "CBC decrypt", vector -> key_size, split);
+
+        /* CTR in place, in two calls.  */
+        memcpy(in_place, test_plaintext, TEST_MESSAGE_SIZE);
+        memcpy(ctr -> nx_crypto_ctr_counter_block, test_counter, sizeof(test_counter));
+        _nx_crypto_ctr_encrypt(&test_aes, ctr, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                               in_place, in_place, split, 16);
+        _nx_crypto_ctr_encrypt(&test_aes, ctr, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                               in_place + split, in_place + split, TEST_MESSAGE_SIZE - split, 16);
+        test_check(memcmp(in_place, vector -> ctr, TEST_MESSAGE_SIZE) == 0, "CTR", vector -> key_size, split);
+    }
+}
+
+
+/* Check GCM encryption, decryption and tag verification with one key.  */
+
+static VOID test_gcm(const TEST_GCM_VECTOR *vector)
+{
+NX_CRYPTO_GCM  *gcm = &test_aes.nx_crypto_aes_mode_context.gcm;
+UCHAR           tag[16];
+UINT            i, split;
+
+    _nx_crypto_aes_key_set(&test_aes, (UCHAR *)vector -> key, vector -> key_size);
+    for (i = 0; i < sizeof(test_splits) / sizeof(test_splits[0]); i++)
+    {
+        split = (test_splits[i] < TEST_GCM_MESSAGE_SIZE) ? test_splits[i] : TEST_GCM_MESSAGE_SIZE;
+
+        _nx_crypto_gcm_encrypt_init(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                    (VOID *)test_gcm_aad, TEST_GCM_AAD_SIZE, (UCHAR *)test_gcm_iv, 16);
+        _nx_crypto_gcm_encrypt_update(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                      (UCHAR *)test_gcm_plaintext, test_output, split, 16);
+        _nx_crypto_gcm_encrypt_update(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                      (UCHAR *)test_gcm_plaintext + split, test_output + split,
+                                      TEST_GCM_MESSAGE_SIZE - split, 16);
+        _nx_crypto_gcm_encrypt_calculate(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt, tag, 16, 16);
+        test_check(memcmp(test_output, vector -> ciphertext, TEST_GCM_MESSAGE_SIZE) == 0, "GCM encrypt",
+                   vector -> key_size, split);
+        test_check(memcmp(tag, vector -> tag, sizeof(tag)) == 0, "GCM tag", vector -> key_size, split);
+
+        /* Decrypt in place and verify the tag.  */
+        memcpy(test_buffer, vector -> ciphertext, TEST_GCM_MESSAGE_SIZE);
+        _nx_crypto_gcm_decrypt_init(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                    (VOID *)test_gcm_aad, TEST_GCM_AAD_SIZE, (UCHAR *)test_gcm_iv, 16);
+        _nx_crypto_gcm_decrypt_update(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                      test_buffer, test_buffer, split, 16);
+        _nx_crypto_gcm_decrypt_update(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                      test_buffer + split, test_buffer + split, TEST_GCM_MESSAGE_SIZE - split, 16);
+        test_check(_nx_crypto_gcm_decrypt_calculate(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                                    (UCHAR *)vector -> tag, 16, 16) == NX_CRYPTO_SUCCESS,
+                   "GCM verify", vector -> key_size, split);
+        test_check(memcmp(test_buffer, test_gcm_plaintext, TEST_GCM_MESSAGE_SIZE) == 0, "GCM decrypt",
+                   vector -> key_size, split);
+    }
+
+    /* A corrupted tag is rejected.  */
+    memcpy(tag, vector -> tag, sizeof(tag));
+    tag[15] ^= 1;
+    memcpy(test_buffer, vector -> ciphertext, TEST_GCM_MESSAGE_SIZE);
+    _nx_crypto_gcm_decrypt_init(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                (VOID *)test_gcm_aad, TEST_GCM_AAD_SIZE, (UCHAR *)test_gcm_iv, 16);
+    _nx_crypto_gcm_decrypt_update(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                  test_buffer, test_buffer, TEST_GCM_MESSAGE_SIZE, 16);
+    test_check(_nx_crypto_gcm_decrypt_calculate(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                                tag, 16, 16) != NX_CRYPTO_SUCCESS,
+               "GCM corrupted tag", vector -> key_size, 0);
+}
+
+
+static double test_time_get(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec * 1e9 + (double)now.tv_nsec);
+}
+
+
+/* Return the throughput in MB/s of the given number of rounds, started at start.  */
+
+static double test_rate(double start)
+{
+
+    return((double)TEST_BENCHMARK_SIZE * TEST_BENCHMARK_ROUNDS * 1e3 / (test_time_get() - start));
+}
+
+
+/* Report the AES-128 throughput of CTR, GCM encryption and CBC decryption over 4 KB buffers, in place.  */
+
+static VOID test_benchmark(VOID)
+{
+NX_CRYPTO_CBC  *cbc = &test_aes.nx_crypto_aes_mode_context.cbc;
+NX_CRYPTO_CTR  *ctr = &test_aes.nx_crypto_aes_mode_context.ctr;
+NX_CRYPTO_GCM  *gcm = &test_aes.nx_crypto_aes_mode_context.gcm;
+UCHAR           tag[16];
+double          rates[3];
+double          start;
+UINT            round;
+
+    _nx_crypto_aes_key_set(&test_aes, (UCHAR *)test_vectors[0].key, test_vectors[0].key_size);
+
+    memcpy(ctr -> nx_crypto_ctr_counter_block, test_counter, sizeof(test_counter));
+    start = test_time_get();
+    for (round = 0; round < TEST_BENCHMARK_ROUNDS; round++)
+    {
+        _nx_crypto_ctr_encrypt(&test_aes, ctr, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                               test_benchmark_buffer, test_benchmark_buffer, TEST_BENCHMARK_SIZE, 16);
+    }
+    rates[0] = test_rate(start);
+
+    start = test_time_get();
+    for (round = 0; round < TEST_BENCHMARK_ROUNDS; round++)
+    {
+        _nx_crypto_gcm_encrypt_init(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                    (VOID *)test_gcm_aad, TEST_GCM_AAD_SIZE, (UCHAR *)test_gcm_iv, 16);
+        _nx_crypto_gcm_encrypt_update(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt,
+                                      test_benchmark_buffer, test_benchmark_buffer, TEST_BENCHMARK_SIZE, 16);
+        _nx_crypto_gcm_encrypt_calculate(&test_aes, gcm, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_encrypt, tag, 16, 16);
+    }
+    rates[1] = test_rate(start);
+
+    _nx_crypto_cbc_decrypt_init(cbc, (UCHAR *)test_iv, sizeof(test_iv));
+    start = test_time_get();
+    for (round = 0; round < TEST_BENCHMARK_ROUNDS; round++)
+    {
+        _nx_crypto_cbc_decrypt(&test_aes, cbc, (TEST_BLOCK_FUNCTION)_nx_crypto_aes_decrypt,
+                               test_benchmark_buffer, test_benchmark_buffer, TEST_BENCHMARK_SIZE, 16);
+    }
+    rates[2] = test_rate(start);
+
+#ifdef NX_CRYPTO_AES_CONSTANT_TIME
+    printf("constant-time AES-128, ");
+#else
+    printf("table-based AES-128, ");
+#endif
+    printf("MB/s: CTR %6.1f, GCM %6.1f, CBC decrypt %6.1f\n", rates[0], rates[1], rates[2]);
+}
+
+
+int main(void)
+{
+UINT    i;
+
+    for (i = 0; i < sizeof(test_vectors) / sizeof(test_vectors[0]); i++)
+    {
+        test_modes(&test_vectors[i]);
+    }
+    for (i = 0; i < sizeof(test_gcm_vectors) / sizeof(test_gcm_vectors[0]); i++)
+    {
+        test_gcm(&test_gcm_vectors[i]);
+    }
+    test_benchmark();
+
+    if (test_failures)
+    {
+        printf("nx_crypto_aes_test: %u checks failed\n", test_failures);
+        return(1);
+    }
+    printf("nx_crypto_aes_test: passed\n");
+    return(0);
+}
@@ -0,0 +1,481 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks HMAC with MD5, SHA-1, SHA-224, SHA-256, SHA-384 and SHA-512 on the inputs of
+   RFC 4231 test cases 1 to 4, 6 and 7. The SHA-2 answers are those of RFC 4231; the MD5 and SHA-1
+   answers for the same inputs were computed with Python's hmac module. Every case runs through one
+   metadata area, one-shot and incrementally, so the cached inner and outer hash states of a key are
+   used on repeated keys, evicted when three keys alternate, and revalidated after a plain hash has
+   used the metadata or its start has been overwritten, up to every length within the HMAC metadata.
+   Cases 6 and 7 use keys longer than the hash block, which are not cached. The time of an HMAC over
+   a 64-byte message is reported, with a fixed key as for the TLS record MAC and with a new key each
+   time. The test is also built without the cache, to compare.  */
+
+#include "nx_crypto_hmac_md5.h"
+#include "nx_crypto_hmac_sha1.h"
+#include "nx_crypto_hmac_sha2.h"
+#include "nx_crypto_hmac_sha5.h"
+#include "nx_crypto_sha2.h"
+#include <stdio.h>
+#include <time.h>
+
+
+#define TEST_CASES              6
+#define TEST_ALGORITHMS         6
+#define TEST_METADATA_SIZE      4096
+#define TEST_BENCHMARK_SIZE     64
+#define TEST_BENCHMARK_ROUNDS   100000
+
+
+extern NX_CRYPTO_METHOD crypto_method_hmac_md5;
+extern NX_CRYPTO_METHOD crypto_method_hmac_sha1;
+extern NX_CRYPTO_METHOD crypto_method_hmac_sha224;
+extern NX_CRYPTO_METHOD crypto_method_hmac_sha256;
+extern NX_CRYPTO_METHOD crypto_method_hmac_sha384;
+extern NX_CRYPTO_METHOD crypto_method_hmac_sha512;
+extern NX_CRYPTO_METHOD crypto_method_sha256;
+
+
+/* Define the keys and the data of the cases.  */
+
+static UCHAR            key_1[20];
+static UCHAR            key_2[] = "Jefe";
+static UCHAR            key_3[20];
+static UCHAR            key_4[25];
+static UCHAR            key_6[131];
+static UCHAR            data_1[] = "Hi There";
+static UCHAR            data_2[] = "what do ya want for nothing?";
+static UCHAR            data_3[50];
+static UCHAR            data_4[50];
+static UCHAR            data_6[] = "Test Using Larger Than Block-Size Key - Hash Key First";
+static UCHAR            data_7[] = "This is a test using a larger than block-size key and a larger than block-size data. "
+                                   "The key needs to be hashed before being used by the HMAC algorithm.";
+
+static UCHAR           *test_keys[TEST_CASES] = { key_1, key_2, key_3, key_4, key_6, key_6 };
+static const UINT       test_key_sizes[TEST_CASES] = { sizeof(key_1), 4, sizeof(key_3), sizeof(key_4), sizeof(key_6), sizeof(key_6) };
+static UCHAR           *test_data[TEST_CASES] = { data_1, data_2, data_3, data_4, data_6, data_7 };
+static const UINT       test_data_sizes[TEST_CASES] = { 8, 28, sizeof(data_3), sizeof(data_4), 54, 152 };
+
+/* HMAC-MD5 of the six cases.  */
+
+static const UCHAR expected_md5[TEST_CASES][16] =
+{
+    {
+        0x5c, 0xce, 0xc3, 0x4e, 0xa9, 0x65, 0x63, 0x92, 0x45, 0x7f, 0xa1, 0xac, 0x27, 0xf0, 0x8f, 0xbc
+    },
+    {
+        0x75, 0x0c, 0x78, 0x3e, 0x6a, 0xb0, 0xb5, 0x03, 0xea, 0xa8, 0x6e, 0x31, 0x0a, 0x5d, 0xb7, 0x38
+    },
+    {
+        0x2a, 0xb8, 0xb9, 0xa9, 0xf7, 0xd3, 0x89, 0x4d, 0x15, 0xad, 0x83, 0x83, 0xb9, 0x70, 0x44, 0xb2
+    },
+    {
+        0x69, 0x7e, 0xaf, 0x0a, 0xca, 0x3a, 0x3a, 0xea, 0x3a, 0x75, 0x16, 0x47, 0x46, 0xff, 0xaa, 0x79
+    },
+    {
+        0xbf, 0xec, 0xaf, 0x4e, 0xff, 0xf9, 0x0a, 0x3a, 0x66, 0x8f, 0x39, 0x22, 0xfe, 0xc3, 0x76, 0x2d
+    },
+    {
+        0x09, 0xb8, 0xae, 0x7b, 0x15, 0xad, 0xbb, 0xb2, 0x43, 0xac, 0xa3, 0x49, 0x1b, 0x51, 0x51, 0x2b
+    }
+};
+
+/* HMAC-SHA-1 of the six cases.  */
+
+static const UCHAR expected_sha1[TEST_CASES][20] =
+{
+    {
+        0xb6, 0x17, 0x31, 0x86, 0x55, 0x05, 0x72, 0x64, 0xe2, 0x8b, 0xc0, 0xb6, 0xfb, 0x37, 0x8c, 0x8e,
+        0xf1, 0x46, 0xbe, 0x00
+    },
+    {
+        0xef, 0xfc, 0xdf, 0x6a, 0xe5, 0xeb, 0x2f, 0xa2, 0xd2, 0x74, 0x16, 0xd5, 0xf1, 0x84, 0xdf, 0x9c,
+        0x25, 0x9a, 0x7c, 0x79
+    },
+    {
+        0x12, 0x5d, 0x73, 0x42, 0xb9, 0xac, 0x11, 0xcd, 0x91, 0xa3, 0x9a, 0xf4, 0x8a, 0xa1, 0x7b, 0x4f,
+        0x63, 0xf1, 0x75, 0xd3
+    },
+    {
+        0x4c, 0x90, 0x07, 0xf4, 0x02, 0x62, 0x50, 0xc6, 0xbc, 0x84, 0x14, 0xf9, 0xbf, 0x50, 0xc8, 0x6c,
+        0x2d, 0x72, 0x35, 0xda
+    },
+    {
+        0x90, 0xd0, 0xda, 0xce, 0x1c, 0x1b, 0xdc, 0x95, 0x73, 0x39, 0x30, 0x78, 0x03, 0x16, 0x03, 0x35,
+        0xbd, 0xe6, 0xdf, 0x2b
+    },
+    {
+        0x21, 0x7e, 0x44, 0xbb, 0x08, 0xb6, 0xe0, 0x6a, 0x2d, 0x6c, 0x30, 0xf3, 0xcb, 0x9f, 0x53, 0x7f,
+        0x97, 0xc6, 0x33, 0x56
+    }
+};
+
+/* HMAC-SHA-224 of the six cases.  */
+
+static const UCHAR expected_sha224[TEST_CASES][28] =
+{
+    {
+        0x89, 0x6f, 0xb1, 0x12, 0x8a, 0xbb, 0xdf, 0x19, 0x68, 0x32, 0x10, 0x7c, 0xd4, 0x9d, 0xf3, 0x3f,
+        0x47, 0xb4, 0xb1, 0x16, 0x99, 0x12, 0xba, 0x4f, 0x53, 0x68, 0x4b, 0x22
+    },
+    {
+        0xa3, 0x0e, 0x01, 0x09, 0x8b, 0xc6, 0xdb, 0xbf, 0x45, 0x69, 0x0f, 0x3a, 0x7e, 0x9e, 0x6d, 0x0f,
+        0x8b, 0xbe, 0xa2, 0xa3, 0x9e, 0x61, 0x48, 0x00, 0x8f, 0xd0, 0x5e, 0x44
+    },
+    {
+        0x7f, 0xb3, 0xcb, 0x35, 0x88, 0xc6, 0xc1, 0xf6, 0xff, 0xa9, 0x69, 0x4d, 0x7d, 0x6a, 0xd2, 0x64,
+        0x93, 0x65, 0xb0, 0xc1, 0xf6, 0x5d, 0x69, 0xd1, 0xec, 0x83, 0x33, 0xea
+    },
+    {
+        0x6c, 0x11, 0x50, 0x68, 0x74, 0x01, 0x3c, 0xac, 0x6a, 0x2a, 0xbc, 0x1b, 0xb3, 0x82, 0x62, 0x7c,
+        0xec, 0x6a, 0x90, 0xd8, 0x6e, 0xfc, 0x01, 0x2d, 0xe7, 0xaf, 0xec, 0x5a
+    },
+    {
+        0x95, 0xe9, 0xa0, 0xdb, 0x96, 0x20, 0x95, 0xad, 0xae, 0xbe, 0x9b, 0x2d, 0x6f, 0x0d, 0xbc, 0xe2,
+        0xd4, 0x99, 0xf1, 0x12, 0xf2, 0xd2, 0xb7, 0x27, 0x3f, 0xa6, 0x87, 0x0e
+    },
+    {
+        0x3a, 0x85, 0x41, 0x66, 0xac, 0x5d, 0x9f, 0x02, 0x3f, 0x54, 0xd5, 0x17, 0xd0, 0xb3, 0x9d, 0xbd,
+        0x94, 0x67, 0x70, 0xdb, 0x9c, 0x2b, 0x95, 0xc9, 0xf6, 0xf5, 0x65, 0xd1
+    }
+};
+
+/* HMAC-SHA-256 of the six cases.  */
+
+static const UCHAR expected_sha256[TEST_CASES][32] =
+{
+    {
+        0xb0, 0x34, 0x4c, 0x61, 0xd8, 0xdb, 0x38, 0x53, 0x5c, 0xa8, 0xaf, 0xce, 0xaf, 0x0b, 0xf1, 0x2b,
+        0x88, 0x1d, 0xc2, 0x00, 0xc9, 0x83, 0x3d, 0xa7, 0x26, 0xe9, 0x37, 0x6c, 0x2e, 0x32, 0xcf, 0xf7
+    },
+    {
+        0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24, 0x26, 0x08, 0x95, 0x75, 0xc7,
+        0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27, 0x39, 0x83, 0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43
+    },
+    {
+        0x77, 0x3e, 0xa9, 0x1e, 0x36, 0x80, 0x0e, 0x46, 0x85, 0x4d, 0xb8, 0xeb, 0xd0, 0x91, 0x81, 0xa7,
+        0x29, 0x59, 0x09, 0x8b, 0x3e, 0xf8, 0xc1, 0x22, 0xd9, 0x63, 0x55, 0x14, 0xce, 0xd5, 0x65, 0xfe
+    },
+    {
+        0x82, 0x55, 0x8a, 0x38, 0x9a, 0x44, 0x3c, 0x0e, 0xa4, 0xcc, 0x81, 0x98, 0x99, 0xf2, 0x08, 0x3a,
+        0x85, 0xf0, 0xfa, 0xa3, 0xe5, 0x78, 0xf8, 0x07, 0x7a, 0x2e, 0x3f, 0xf4, 0x67, 0x29, 0x66, 0x5b
+    },
+    {
+        0x60, 0xe4, 0x31, 0x59, 0x1e, 0xe0, 0xb6, 0x7f, 0x0d, 0x8a, 0x26, 0xaa, 0xcb, 0xf5, 0xb7, 0x7f,
+        0x8e, 0x0b, 0xc6, 0x21, 0x37, 0x28, 0xc5, 0x14, 0x05, 0x46, 0x04, 0x0f, 0x0e, 0xe3, 0x7f, 0x54
+    },
+    {
+        0x9b, 0x09, 0xff, 0xa7, 0x1b, 0x94, 0x2f, 0xcb, 0x27, 0x63, 0x5f, 0xbc, 0xd5, 0xb0, 0xe9, 0x44,
+        0xbf, 0xdc, 0x63, 0x64, 0x4f, 0x07, 0x13, 0x93, 0x8a, 0x7f, 0x51, 0x53, 0x5c, 0x3a, 0x35, 0xe2
+    }
+};
+
+/* HMAC-SHA-384 of the six cases.  */
+
+static const UCHAR expected_sha384[TEST_CASES][48] =
+{
+    {
+        0xaf, 0xd0, 0x39, 0x44, 0xd8, 0x48, 0x95, 0x62, 0x6b, 0x08, 0x25, 0xf4, 0xab, 0x46, 0x90, 0x7f,
+        0x15, 0xf9, 0xda, 0xdb, 0xe4, 0x10, 0x1e, 0xc6, 0x82, 0xaa, 0x03, 0x4c, 0x7c, 0xeb, 0xc5, 0x9c,
+        0xfa, 0xea, 0x9e, 0xa9, 0x07, 0x6e, 0xde, 0x7f, 0x4a, 0xf1, 0x52, 0xe8, 0xb2, 0xfa, 0x9c, 0xb6
+    },
+    {
+        0xaf, 0x45, 0xd2, 0xe3, 0x76, 0x48, 0x40, 0x31, 0x61, 0x7f, 0x78, 0xd2, 0xb5, 0x8a, 0x6b, 0x1b,
+        0x9c, 0x7e, 0xf4, 0x64, 0xf5, 0xa0, 0x1b, 0x47, 0xe4, 0x2e, 0xc3, 0x73, 0x63, 0x22, 0x44, 0x5e,
+        0x8e, 0x22, 0x40, 0xca, 0x5e, 0x69, 0xe2, 0xc7, 0x8b, 0x32, 0x39, 0xec, 0xfa, 0xb2, 0x16, 0x49
+    },
+    {
+        0x88, 0x06, 0x26, 0x08, 0xd3, 0xe6, 0xad, 0x8a, 0x0a, 0xa2, 0xac, 0xe0, 0x14, 0xc8, 0xa8, 0x6f,
+        0x0a, 0xa6, 0x35, 0xd9, 0x47, 0xac, 0x9f, 0xeb, 0xe8, 0x3e, 0xf4, 0xe5, 0x59, 0x66, 0x14, 0x4b,
+        0x2a, 0x5a, 0xb3, 0x9d, 0xc1, 0x38, 0x14, 0xb9, 0x4e, 0x3a, 0xb6, 0xe1, 0x01, 0xa3, 0x4f, 0x27
+    },
+    {
+        0x3e, 0x8a, 0x69, 0xb7, 0x78, 0x3c, 0x25, 0x85, 0x19, 0x33, 0xab, 0x62, 0x90, 0xaf, 0x6c, 0xa7,
+        0x7a, 0x99, 0x81, 0x48, 0x08, 0x50, 0x00, 0x9c, 0xc5, 0x57, 0x7c, 0x6e, 0x1f, 0x57, 0x3b, 0x4e,
+        0x68, 0x01, 0xdd, 0x23, 0xc4, 0xa7, 0xd6, 0x79, 0xcc, 0xf8, 0xa3, 0x86, 0xc6, 0x74, 0xcf, 0xfb
+    },
+    {
+        0x4e, 0xce, 0x08, 0x44, 0x85, 0x81, 0x3e, 0x90, 0x88, 0xd2, 0xc6, 0x3a, 0x04, 0x1b, 0xc5, 0xb4,
+        0x4f, 0x9e, 0xf1, 0x01, 0x2a, 0x2b, 0x58, 0x8f, 0x3c, 0xd1, 0x1f, 0x05, 0x03, 0x3a, 0xc4, 0xc6,
+        0x0c, 0x2e, 0xf6, 0xab, 0x40, 0x30, 0xfe, 0x82, 0x96, 0x24, 0x8d, 0xf1, 0x63, 0xf4, 0x49, 0x52
+    },
+    {
+        0x66, 0x17, 0x17, 0x8e, 0x94, 0x1f, 0x02, 0x0d, 0x35, 0x1e, 0x2f, 0x25, 0x4e, 0x8f, 0xd3, 0x2c,
+        0x60, 0x24, 0x20, 0xfe, 0xb0, 0xb8, 0xfb, 0x9a, 0xdc, 0xce, 0xbb, 0x82, 0x46, 0x1e, 0x99, 0xc5,
+        0xa6, 0x78, 0xcc, 0x31, 0xe7, 0x99, 0x17, 0x6d, 0x38, 0x60, 0xe6, 0x11, 0x0c, 0x46, 0x52, 0x3e
+    }
+};
+
+/* HMAC-SHA-512 of the six cases.  */
+
+static const UCHAR expected_sha512[TEST_CASES][64] =
+{
+    {
+        0x87, 0xaa, 0x7c, 0xde, 0xa5, 0xef, 0x61, 0x9d, 0x4f, 0xf0, 0xb4, 0x24, 0x1a, 0x1d, 0x6c, 0xb0,
+        0x23, 0x79, 0xf4, 0xe2, 0xce, 0x4e, 0xc2, 0x78, 0x7a, 0xd0, 0xb3, 0x05, 0x45, 0xe1, 0x7c, 0xde,
+        0xda, 0xa8, 0x33, 0xb7, 0xd6, 0xb8, 0xa7, 0x02, 0x03, 0x8b, 0x27, 0x4e, 0xae, 0xa3, 0xf4, 0xe4,
+        0xbe, 0x9d, 0x91, 0x4e, 0xeb, 0x61, 0xf1, 0x70, 0x2e, 0x69, 0x6c, 0x20, 0x3a, 0x12, 0x68, 0x54
+    },
+    {
+        0x16, 0x4b, 0x7a, 0x7b, 0xfc, 0xf8, 0x19, 0xe2, 0xe3, 0x95, 0xfb, 0xe7, 0x3b, 0x56, 0xe0, 0xa3,
+        0x87, 0xbd, 0x64, 0x22, 0x2e, 0x83, 0x1f, 0xd6, 0x10, 0x27, 0x0c, 0xd7, 0xea, 0x25, 0x05, 0x54,
+        0x97, 0x58, 0xbf, 0x75, 0xc0, 0x5a, 0x99, 0x4a, 0x6d, 0x03, 0x4f, 0x65, 0xf8, 0xf0, 0xe6, 0xfd,
+        0xca, 0xea, 0xb1, 0xa3, 0x4d, 0x4a, 0x6b, 0x4b, 0x63, 0x6e, 0x07, 0x0a, 0x38, 0xbc, 0xe7, 0x37
+    },
+    {
+        0xfa, 0x73, 0xb0, 0x08, 0x9d, 0x56, 0xa2, 0x84, 0xef, 0xb0, 0xf0, 0x75, 0x6c, 0x89, 0x0b, 0xe9,
+        0xb1, 0xb5, 0xdb, 0xdd, 0x8e, 0xe8, 0x1a, 0x36, 0x55, 0xf8, 0x3e, 0x33, 0xb2, 0x27, 0x9d, 0x39,
+        0xbf, 0x3e, 0x84, 0x82, 0x79, 0xa7, 0x22, 0xc8, 0x06, 0xb4, 0x85, 0xa4, 0x7e, 0x67, 0xc8, 0x07,
+        0xb9, 0x46, 0xa3, 0x37, 0xbe, 0xe8, 0x94, 0x26, 0x74, 0x27, 0x88, 0x59, 0xe1, 0x32, 0x92, 0xfb
+    },
+    {
+        0xb0, 0xba, 0x46, 0x56, 0x37, 0x45, 0x8c, 0x69, 0x90, 0xe5, 0xa8, 0xc5, 0xf6, 0x1d, 0x4a, 0xf7,
+        0xe5, 0x76, 0xd9, 0x7f, 0xf9, 0x4b, 0x87, 0x2d, 0xe7, 0x6f, 0x80, 0x50, 0x36, 0x1e, 0xe3, 0xdb,
+        0xa9, 0x1c, 0xa5, 0xc1, 0x1a, 0xa2, 0x5e, 0xb4, 0xd6, 0x79, 0x27, 0x5c, 0xc5, 0x78, 0x80, 0x63,
+        0xa5, 0xf1, 0x97, 0x41, 0x12, 0x0c, 0x4f, 0x2d, 0xe2, 0xad, 0xeb, 0xeb, 0x10, 0xa2, 0x98, 0xdd
+    },
+    {
+        0x80, 0xb2, 0x42, 0x63, 0xc7, 0xc1, 0xa3, 0xeb, 0xb7, 0x14, 0x93, 0xc1, 0xdd, 0x7b, 0xe8, 0xb4,
+        0x9b, 0x46, 0xd1, 0xf4, 0x1b, 0x4a, 0xee, 0xc1, 0x12, 0x1b, 0x01, 0x37, 0x83, 0xf8, 0xf3, 0x52,
+        0x6b, 0x56, 0xd0, 0x37, 0xe0, 0x5f, 0x25, 0x98, 0xbd, 0x0f, 0xd2, 0x21, 0x5d, 0x6a, 0x1e, 0x52,
+        0x95, 0xe6, 0x4f, 0x73, 0xf6, 0x3f, 0x0a, 0xec, 0x8b, 0x91, 0x5a, 0x98, 0x5d, 0x78, 0x65, 0x98
+    },
+    {
+        0xe3, 0x7b, 0x6a, 0x77, 0x5d, 0xc8, 0x7d, 0xba, 0xa4, 0xdf, 0xa9, 0xf9, 0x6e, 0x5e, 0x3f, 0xfd,
+        0xde, 0xbd, 0x71, 0xf8, 0x86, 0x72, 0x89, 0x86, 0x5d, 0xf5, 0xa3, 0x2d, 0x20, 0xcd, 0xc9, 0x44,
+        0xb6, 0x02, 0x2c, 0xac, 0x3c, 0x49, 0x82, 0xb1, 0x0d, 0x5e, 0xeb, 0x55, 0xc3, 0xe4, 0xde, 0x15,
+        0x13, 0x46, 0x76, 0xfb, 0x6d, 0xe0, 0x44, 0x60, 0x65, 0xc9, 0x74, 0x40, 0xfa, 0x8c, 0x6a, 0x58
+    }
+};
+
+
+/* Define the methods, with the expected answers of each.  */
+
+static NX_CRYPTO_METHOD *test_methods[TEST_ALGORITHMS] =
+{
+    &crypto_method_hmac_md5, &crypto_method_hmac_sha1, &crypto_method_hmac_sha224,
+    &crypto_method_hmac_sha256, &crypto_method_hmac_sha384, &crypto_method_hmac_sha512
+};
+
+static const UCHAR     *test_expected[TEST_ALGORITHMS] =
+{
+    expected_md5[0], expected_sha1[0], expected_sha224[0], expected_sha256[0], expected_sha384[0], expected_sha512[0]
+};
+
+static const UINT       test_expected_sizes[TEST_ALGORITHMS] = { 16, 20, 28, 32, 48, 64 };
+
+static ULONG            test_metadata[TEST_METADATA_SIZE / sizeof(ULONG)];
+static UINT             test_failures;
+
+
+/* Compute the HMAC of a case in the shared metadata area, one-shot or with an update per half of
+   the data, and compare it with the expected answer.  */
+
+static VOID test_hmac(UINT algorithm, UINT test_case, UINT incremental)
+{
+NX_CRYPTO_METHOD   *method = test_methods[algorithm];
+UCHAR              *key = test_keys[test_case];
+UINT                key_bits = test_key_sizes[test_case] << 3;
+UCHAR              *data = test_data[test_case];
+UINT                size = test_data_sizes[test_case];
+UCHAR               output[64];
+VOID               *handle = NX_CRYPTO_NULL;
+
+    memset(output, 0, sizeof(output));
+    method -> nx_crypto_init(method, key, key_bits, &handle, test_metadata, sizeof(test_metadata));
+    if (!incremental)
+    {
+        method -> nx_crypto_operation(NX_CRYPTO_AUTHENTICATE, handle, method, key, key_bits, data, size,
+                                      NX_CRYPTO_NULL, output, sizeof(output), test_metadata, sizeof(test_metadata),
+                                      NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    }
+    else
+    {
+        method -> nx_crypto_operation(NX_CRYPTO_HASH_INITIALIZE, handle, method, key, key_bits, NX_CRYPTO_NULL, 0,
+                                      NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0, test_metadata, sizeof(test_metadata),
+                                      NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        method -> nx_crypto_operation(NX_CRYPTO_HASH_UPDATE, handle, method, NX_CRYPTO_NULL, 0, data, size / 2,
+                                      NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0, test_metadata, sizeof(test_metadata),
+                                      NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        method -> nx_crypto_operation(NX_CRYPTO_HASH_UPDATE, handle, method, NX_CRYPTO_NULL, 0, data + (size / 2),
+                                      size - (size / 2), NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0, test_metadata,
+                                      sizeof(test_metadata), NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        method -> nx_crypto_operation(NX_CRYPTO_HASH_CALCULATE, handle, method, NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, 0,
+                                      NX_CRYPTO_NULL, output, sizeof(output), test_metadata, sizeof(test_metadata),
+                                      NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    }
+    method -> nx_crypto_cleanup(test_metadata);
+
+    if (memcmp(output, test_expected[algorithm] + (test_case * test_expected_sizes[algorithm]),
+               test_expected_sizes[algorithm]) != 0)
+    {
+        printf("FAILED: %s case %u, %s\n", (algorithm == 0) ? "HMAC-MD5" : "HMAC-SHA", test_case + 1,
+               incremental ? "incremental" : "one-shot");
+        test_failures++;
+    }
+}
+
+
+/* Hash some data with plain SHA-256 in the metadata area of the HMAC, as TLS does to hash certificates.  */
+
+static VOID test_overwrite_metadata(VOID)
+{
+NX_CRYPTO_METHOD   *method = &crypto_method_sha256;
+VOID               *handle = NX_CRYPTO_NULL;
+UCHAR               output[32];
+
+    method -> nx_crypto_init(method, NX_CRYPTO_NULL, 0, &handle, test_metadata, sizeof(test_metadata));
+    method -> nx_crypto_operation(NX_CRYPTO_AUTHENTICATE, handle, method, NX_CRYPTO_NULL, 0, data_7, sizeof(data_7),
+                                  NX_CRYPTO_NULL, output, sizeof(output), test_metadata, sizeof(test_metadata),
+                                  NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+    method -> nx_crypto_cleanup(test_metadata);
+}
+
+
+/* Overwrite the start of the metadata area, as another method with a larger context would.  */
+
+static VOID test_clobber_metadata(UINT length)
+{
+
+    memset(test_metadata, 0x5a, length);
+}
+
+
+static double test_time_get(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec * 1e9 + (double)now.tv_nsec);
+}
+
+
+/* Return the time in microseconds of one HMAC over the benchmark message, computed the way the TLS
+   record MAC is. With new_key set, the first key byte changes for every message.  */
+
+static double test_benchmark_time(NX_CRYPTO_METHOD *method, UINT new_key)
+{
+UCHAR       key[32];
+UCHAR       data[TEST_BENCHMARK_SIZE];
+UCHAR       output[64];
+VOID       *handle = NX_CRYPTO_NULL;
+double      start;
+UINT        round;
+
+    memset(key, 0x0b, sizeof(key));
+    memset(data, 0xdd, sizeof(data));
+
+    start = test_time_get();
+    for (round = 0; round < TEST_BENCHMARK_ROUNDS; round++)
+    {
+        if (new_key)
+        {
+            key[0] = (UCHAR)round;
+        }
+        method -> nx_crypto_init(method, key, sizeof(key) << 3, &handle, test_metadata, sizeof(test_metadata));
+        method -> nx_crypto_operation(NX_CRYPTO_HASH_INITIALIZE, handle, method, key, sizeof(key) << 3,
+                                      NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0, test_metadata,
+                                      sizeof(test_metadata), NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        method -> nx_crypto_operation(NX_CRYPTO_HASH_UPDATE, handle, method, NX_CRYPTO_NULL, 0, data, sizeof(data),
+                                      NX_CRYPTO_NULL, NX_CRYPTO_NULL, 0, test_metadata, sizeof(test_metadata),
+                                      NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        method -> nx_crypto_operation(NX_CRYPTO_HASH_CALCULATE, handle, method, NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, 0,
+                                      NX_CRYPTO_NULL, output, sizeof(output), test_metadata, sizeof(test_metadata),
+                                      NX_CRYPTO_NULL, NX_CRYPTO_NULL);
+        method -> nx_crypto_cleanup(test_metadata);
+    }
+
+    return((test_time_get() - start) / TEST_BENCHMARK_ROUNDS / 1e3);
+}
+
+
+/* Report the time of HMAC-SHA1, HMAC-SHA256 and HMAC-SHA384 over a 64-byte message with a fixed
+   32-byte key, of HMAC-SHA256 with a new key each time, and the size of the HMAC-SHA256 metadata.  */
+
+static VOID test_benchmark(VOID)
+{
+double  times[4];
+
+    times[0] = test_benchmark_time(&crypto_method_hmac_sha1, NX_CRYPTO_FALSE);
+    times[1] = test_benchmark_time(&crypto_method_hmac_sha256, NX_CRYPTO_FALSE);
+    times[2] = test_benchmark_time(&crypto_method_hmac_sha384, NX_CRYPTO_FALSE);
+    times[3] = test_benchmark_time(&crypto_method_hmac_sha256, NX_CRYPTO_TRUE);
+
+#ifdef NX_CRYPTO_HMAC_DISABLE_STATE_CACHE
+    printf("HMAC without state cache, ");
+#else
+    printf("HMAC with state cache, ");
+#endif
+    printf("us per 64-byte message: SHA-1 %5.2f, SHA-256 %5.2f, SHA-384 %5.2f, SHA-256 new key %5.2f\n",
+           times[0], times[1], times[2], times[3]);
+    printf("HMAC-SHA256 metadata: %u bytes\n", (UINT)sizeof(NX_CRYPTO_SHA256_HMAC));
+}
+
+
+int main(void)
+{
+UINT    algorithm, test_case, repeat, length;
+
+    memset(key_1, 0x0b, sizeof(key_1));
+    memset(key_3, 0xaa, sizeof(key_3));
+    for (test_case = 0; test_case < sizeof(key_4); test_case++)
+    {
+        key_4[test_case] = (UCHAR)(test_case + 1);
+    }
+    memset(key_6, 0xaa, sizeof(key_6));
+    memset(data_3, 0xdd, sizeof(data_3));
+    memset(data_4, 0xcd, sizeof(data_4));
+
+    for (algorithm = 0; algorithm < TEST_ALGORITHMS; algorithm++)
+    {
+
+        /* Each case twice in a row, so the second run uses the cached states.  */
+        for (test_case = 0; test_case < TEST_CASES; test_case++)
+        {
+            test_hmac(algorithm, test_case, NX_CRYPTO_FALSE);
+            test_hmac(algorithm, test_case, NX_CRYPTO_TRUE);
+        }
+
+        /* Two keys alternating fit in the cache, a third evicts one of them.  */
+        for (repeat = 0; repeat < 3; repeat++)
+        {
+            test_hmac(algorithm, 0, repeat & 1);
+            test_hmac(algorithm, 2, repeat & 1);
+            test_hmac(algorithm, 3, repeat & 1);
+            test_hmac(algorithm, 1, repeat & 1);
+        }
+
+        /* A plain hash in the same metadata must not leave a stale cached state behind.  */
+        test_hmac(algorithm, 0, NX_CRYPTO_FALSE);
+        test_overwrite_metadata();
+        test_hmac(algorithm, 0, NX_CRYPTO_TRUE);
+        test_overwrite_metadata();
+        test_hmac(algorithm, 3, NX_CRYPTO_FALSE);
+
+        /* Nor may an overwrite of the start of the metadata, wherever it ends.  */
+        for (length = 4; length <= sizeof(NX_CRYPTO_SHA512_HMAC); length += 4)
+        {
+            test_hmac(algorithm, 0, NX_CRYPTO_FALSE);
+            test_clobber_metadata(length);
+            test_hmac(algorithm, 0, NX_CRYPTO_TRUE);
+        }
+    }
+
+    test_benchmark();
+
+    if (test_failures)
+    {
+        printf("nx_crypto_hmac_test: %u checks failed\n", test_failures);
+        return(1);
+    }
+    printf("nx_crypto_hmac_test: passed\n");
+    return(0);
+}
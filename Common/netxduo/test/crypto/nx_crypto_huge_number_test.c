@@ -0,0 +1,527 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks the huge number arithmetic used by RSA, DH and ECC. Column-wise multiplication,
+   squaring and Karatsuba multiplication of random operands are compared with a schoolbook product
+   computed here, and sliding-window Montgomery exponentiation is compared with square-and-multiply
+   built from multiplication and modulus. An RSA-2048 key checks CRT and non-CRT exponentiation and
+   _nx_crypto_rsa_operation against known answers. Every function is given exactly the scratch its
+   header documents, followed by a guard that must be left untouched. The time of the RSA-2048
+   operations, and of a 2048-bit product computed column-wise and digit by digit, is reported.  */
+
+#include "nx_crypto_rsa.h"
+#include <stdio.h>
+#include <time.h>
+
+
+#define TEST_RANDOM_CASES       200
+#define TEST_POWER_CASES        40
+#define TEST_MAX_BYTES          264
+#define TEST_GUARD_SIZE         64
+#define TEST_GUARD_BYTE         0xA5
+#define TEST_KAT_BYTES          256
+#define TEST_PRODUCT_ROUNDS     20000
+#define TEST_RSA_ROUNDS         20
+
+
+/* Define the RSA-2048 known answer: p, q, their product, an input, a private exponent, the input raised
+   to the private exponent and the input raised to 65537.  */
+
+static const UCHAR kat_p[] =
+{
+    0xe7, 0x12, 0x5e, 0x0d, 0x86, 0x43, 0xe7, 0x0a, 0x06, 0xbc, 0xdd, 0x15, 0x59, 0x42, 0xde, 0x9e,
+    0x3b, 0x03, 0xb4, 0x52, 0xc4, 0x3b, 0xba, 0x35, 0x8a, 0x42, 0xd1, 0x8f, 0xb2, 0x21, 0xf2, 0x33,
+    0xa9, 0xa5, 0xe8, 0xc9, 0x1d, 0xf9, 0xb0, 0x97, 0x59, 0x67, 0x52, 0x84, 0xe2, 0x37, 0xa3, 0x5f,
+    0x99, 0x61, 0xf1, 0x83, 0x6b, 0x7a, 0xf8, 0x02, 0xbd, 0x46, 0x33, 0xc6, 0xd7, 0x64, 0x5e, 0x19,
+    0x26, 0xa9, 0xe7, 0xe6, 0x25, 0x95, 0xbd, 0xd3, 0x39, 0x54, 0x7f, 0xc4, 0xf6, 0x4e, 0x07, 0x94,
+    0xef, 0x97, 0xc8, 0xff, 0x91, 0x91, 0xf1, 0x2d, 0xd2, 0xbb, 0xbb, 0xe7, 0xcc, 0xa0, 0xb2, 0xfe,
+    0xae, 0x9b, 0xe1, 0x75, 0x58, 0xd4, 0x86, 0x36, 0x86, 0xe1, 0xde, 0x84, 0x75, 0xf0, 0x97, 0x12,
+    0x78, 0xca, 0x15, 0x08, 0x2d, 0x4d, 0x36, 0x35, 0xfd, 0xe4, 0x8d, 0xf1, 0x78, 0xa3, 0x12, 0x35
+};
+
+static const UCHAR kat_q[] =
+{
+    0xf5, 0x01, 0xe1, 0x3a, 0xa1, 0xbf, 0x1c, 0x23, 0x58, 0xd2, 0x41, 0x5d, 0xaf, 0xad, 0x64, 0x38,
+    0x18, 0xe8, 0xc7, 0xf8, 0x29, 0x67, 0x64, 0x54, 0xdd, 0xf1, 0xc6, 0x04, 0xa1, 0x5d, 0xef, 0xbd,
+    0xbd, 0xb1, 0xd5, 0x94, 0xa2, 0x79, 0x98, 0x21, 0xef, 0x6d, 0xc4, 0xb4, 0x63, 0x72, 0xc4, 0x97,
+    0x7e, 0x24, 0xa7, 0xb6, 0x94, 0xed, 0x7f, 0xb5, 0x2e, 0x20, 0x90, 0x3e, 0xe2, 0xaf, 0x28, 0x1e,
+    0x90, 0x5b, 0x5e, 0x04, 0x41, 0x02, 0x7e, 0x91, 0x59, 0x45, 0xc8, 0xf6, 0xeb, 0xd8, 0x57, 0x28,
+    0x6c, 0x20, 0x2f, 0xe8, 0x13, 0xdd, 0xf3, 0x50, 0xe7, 0xcc, 0x24, 0xcb, 0xa4, 0xe5, 0x06, 0x51,
+    0x1f, 0x0e, 0x5a, 0x12, 0x33, 0xd6, 0x1a, 0x4c, 0xa1, 0x57, 0x80, 0x1f, 0x35, 0x64, 0xa0, 0x70,
+    0xc4, 0xe3, 0x09, 0xfb, 0x5f, 0xac, 0xe6, 0x60, 0x07, 0xd8, 0x26, 0x9a, 0x44, 0x5c, 0xbe, 0x1f
+};
+
+static const UCHAR kat_modulus[] =
+{
+    0xdd, 0x26, 0x46, 0x61, 0x60, 0x5e, 0xc1, 0xb3, 0x30, 0x6f, 0x3e, 0x69, 0x4f, 0x40, 0xd4, 0xf3,
+    0xda, 0x02, 0x44, 0x5a, 0x6b, 0xa8, 0x9f, 0xfd, 0x9a, 0x46, 0x6d, 0x93, 0xcd, 0xa3, 0x4c, 0xfa,
+    0x2b, 0x19, 0x8d, 0xef, 0x97, 0x1c, 0xee, 0x6c, 0x4e, 0x44, 0xfe, 0xe0, 0x8c, 0xe1, 0xc2, 0x6f,
+    0x53, 0x29, 0x38, 0x3d, 0xcc, 0xdc, 0x5d, 0x43, 0xda, 0xaa, 0x49, 0x5b, 0xfb, 0x21, 0x39, 0x41,
+    0x8a, 0xe6, 0x51, 0x69, 0x74, 0x4e, 0xea, 0x1d, 0x84, 0x51, 0x3e, 0xa3, 0x0c, 0x6d, 0xb0, 0xda,
+    0x98, 0x30, 0xa9, 0xda, 0xfd, 0x19, 0xc0, 0x2f, 0xa9, 0x5c, 0x9c, 0x9b, 0x1b, 0xe7, 0xd4, 0xe7,
+    0x34, 0xfe, 0xf0, 0xd1, 0x2c, 0x0d, 0x49, 0x2d, 0xa8, 0x29, 0xcd, 0x52, 0x78, 0x86, 0x1b, 0x1e,
+    0x0b, 0x8d, 0x07, 0x2d, 0x0d, 0xa2, 0x5e, 0x76, 0x10, 0xbd, 0x61, 0x33, 0xc5, 0x6d, 0xcf, 0x6d,
+    0x06, 0xd9, 0xf7, 0xa5, 0x8e, 0xe1, 0xf8, 0xb3, 0xf0, 0x3b, 0x58, 0x5b, 0xba, 0x87, 0xba, 0x83,
+    0x44, 0xe1, 0x89, 0xa5, 0x2a, 0x75, 0xd5, 0x9b, 0xaa, 0x6e, 0xa2, 0x3a, 0x36, 0x13, 0xa5, 0x6f,
+    0x41, 0xc4, 0xa0, 0x59, 0x7a, 0x93, 0xe9, 0x42, 0x6a, 0xc8, 0xa3, 0xe5, 0x9b, 0x4a, 0x2c, 0x0c,
+    0xae, 0x5f, 0x63, 0x56, 0x85, 0x98, 0xe8, 0xd2, 0xef, 0x79, 0xfc, 0x57, 0xf3, 0xab, 0x79, 0xad,
+    0x82, 0x66, 0xe4, 0x3f, 0xbf, 0x16, 0x93, 0x41, 0x4f, 0xfa, 0x15, 0xa5, 0x06, 0x1e, 0x5e, 0x27,
+    0xee, 0x80, 0xb7, 0x53, 0x2a, 0xbf, 0xc2, 0xfd, 0x89, 0x75, 0xdd, 0xad, 0xc7, 0x69, 0xd9, 0x5c,
+    0x36, 0x69, 0xa3, 0xf4, 0x23, 0x1e, 0x9d, 0x0c, 0x57, 0x32, 0xb6, 0x2d, 0xfa, 0xf2, 0x19, 0xad,
+    0x88, 0xce, 0xf5, 0xdf, 0x4a, 0x25, 0x82, 0xf2, 0x1d, 0x5d, 0xe5, 0x19, 0x42, 0x4e, 0x8a, 0x6b
+};
+
+static const UCHAR kat_input[] =
+{
+    0x43, 0x43, 0x8c, 0xa3, 0x12, 0xed, 0x20, 0x83, 0x1a, 0xa5, 0xfd, 0x53, 0xba, 0x37, 0x95, 0x29,
+    0x9e, 0xb7, 0x0f, 0x9e, 0xfe, 0xac, 0x44, 0x39, 0x04, 0xb2, 0x37, 0x2b, 0x28, 0x9f, 0x3c, 0x36,
+    0x75, 0x35, 0xd0, 0x14, 0xe4, 0x51, 0xf7, 0xbd, 0x23, 0xda, 0x92, 0x5e, 0x32, 0x29, 0x64, 0xf2,
+    0x97, 0x93, 0x84, 0xae, 0xdd, 0xaa, 0x8e, 0xdc, 0x23, 0xe0, 0x6c, 0x53, 0x9b, 0xcc, 0x5b, 0x61,
+    0x85, 0xe1, 0x8f, 0xcf, 0x81, 0xdf, 0xee, 0x77, 0xf5, 0x03, 0x68, 0xbe, 0xe7, 0xb2, 0x5f, 0x44,
+    0x26, 0x5b, 0x50, 0xb0, 0x20, 0xf7, 0x1d, 0x40, 0x8b, 0xb8, 0x0e, 0xb1, 0xac, 0xbf, 0xee, 0x18,
+    0x16, 0xee, 0xb2, 0x51, 0x9b, 0xba, 0xf0, 0xb9, 0x7e, 0xea, 0x5d, 0xe5, 0x17, 0x53, 0xb6, 0xa5,
+    0xfd, 0xd1, 0x69, 0x3a, 0x9c, 0x3c, 0x4f, 0x09, 0xce, 0xc0, 0x0b, 0xa8, 0xfb, 0xb9, 0xcc, 0x72,
+    0x6e, 0x8a, 0x47, 0x73, 0x65, 0x75, 0xdd, 0x87, 0x45, 0xb2, 0x50, 0xb0, 0xf3, 0x77, 0x88, 0x0e,
+    0x27, 0x79, 0xc0, 0x00, 0xa7, 0x9c, 0x22, 0x64, 0x39, 0x8b, 0x0c, 0x2c, 0xb6, 0xc0, 0xf9, 0xd1,
+    0xae, 0xef, 0x31, 0x7b, 0x4a, 0x8f, 0x38, 0x12, 0x77, 0x24, 0xbe, 0x71, 0x09, 0xce, 0xe0, 0x4d,
+    0x9a, 0x90, 0xea, 0x47, 0x24, 0xcd, 0xeb, 0xe3, 0x8f, 0xe3, 0xe5, 0x14, 0x5e, 0xe0, 0xa2, 0x43,
+    0x74, 0x5a, 0x39, 0x54, 0xad, 0xbe, 0x8f, 0xf2, 0x1e, 0x98, 0xc7, 0xed, 0x48, 0xbf, 0xfa, 0xcf,
+    0x69, 0x54, 0xa9, 0x42, 0xed, 0xec, 0x62, 0x80, 0x9c, 0x35, 0x20, 0x43, 0x02, 0x12, 0x90, 0xdf,
+    0x3a, 0x6b, 0x0f, 0x17, 0x5d, 0x4c, 0x13, 0xaa, 0x2c, 0x56, 0x02, 0xf2, 0xf2, 0x8d, 0x10, 0x1a,
+    0x4b, 0x8f, 0x24, 0xc7, 0xeb, 0x7f, 0x1f, 0xeb, 0x74, 0xaa, 0xea, 0x1e, 0xaa, 0xb3, 0xad, 0xee
+};
+
+static const UCHAR kat_private_exponent[] =
+{
+    0xb6, 0x7d, 0xd4, 0x22, 0xc9, 0x18, 0x34, 0xec, 0x47, 0x93, 0x67, 0x93, 0x27, 0x4d, 0x6d, 0x43,
+    0x9f, 0xf0, 0x05, 0x8c, 0x33, 0x2c, 0xbd, 0x96, 0x27, 0xde, 0x7a, 0x51, 0xfc, 0xa5, 0x18, 0x33,
+    0x67, 0x5d, 0x4b, 0xd4, 0x24, 0x85, 0xc9, 0x74, 0xa3, 0xb8, 0xbc, 0x51, 0xad, 0x0c, 0x99, 0xf0,
+    0x98, 0x5e, 0xfb, 0x81, 0xf4, 0x77, 0x4c, 0xda, 0x87, 0x54, 0xfa, 0xcd, 0xef, 0xe1, 0x04, 0xa4,
+    0x66, 0x2e, 0xb4, 0x8a, 0x7c, 0x8c, 0x54, 0x58, 0x47, 0x85, 0xad, 0xab, 0xa4, 0x61, 0x04, 0x70,
+    0x5b, 0x2b, 0x41, 0x19, 0x59, 0x12, 0xdc, 0xd9, 0x4f, 0xc9, 0xc6, 0x7f, 0x98, 0xef, 0x65, 0x6c,
+    0x11, 0x04, 0xfb, 0x21, 0xe0, 0x02, 0x7d, 0xe8, 0xf8, 0xf8, 0x0f, 0xfd, 0xf2, 0xb5, 0xa8, 0xf5,
+    0x77, 0xf9, 0xe2, 0x72, 0xdf, 0xfe, 0x14, 0x4d, 0x5e, 0xb8, 0x60, 0x4e, 0x5f, 0x02, 0x38, 0x3d,
+    0xc4, 0x79, 0xb2, 0x8d, 0x4b, 0xb3, 0x35, 0xc0, 0xfc, 0x0a, 0x5f, 0x30, 0x75, 0x35, 0xc9, 0x5a,
+    0x10, 0x02, 0xb2, 0xb4, 0xbe, 0x31, 0xfc, 0x87, 0x8a, 0xb2, 0xe0, 0x32, 0x76, 0x90, 0x74, 0x23,
+    0x10, 0xaf, 0x50, 0x13, 0x01, 0x50, 0xe3, 0x32, 0xe2, 0x90, 0x26, 0x04, 0x09, 0x7e, 0x06, 0x3a,
+    0x76, 0x91, 0xab, 0x2a, 0xf1, 0x81, 0x4e, 0xc3, 0xd7, 0x14, 0xc5, 0x91, 0x50, 0x17, 0x3c, 0x37,
+    0x3a, 0xce, 0x33, 0xce, 0x47, 0x62, 0xab, 0x7b, 0x14, 0x91, 0xb0, 0x3c, 0x54, 0x7b, 0x57, 0xad,
+    0x34, 0xee, 0x73, 0x7e, 0x1d, 0x9f, 0x19, 0x88, 0x7e, 0xea, 0x3b, 0x6a, 0x2a, 0xfe, 0x62, 0xf2,
+    0x55, 0xc9, 0xa2, 0xf6, 0xd8, 0xb0, 0x50, 0x52, 0x43, 0x35, 0xef, 0x12, 0x03, 0x06, 0x6e, 0x1b,
+    0xf4, 0xf3, 0xcf, 0x33, 0xf4, 0xcb, 0x85, 0x74, 0xcd, 0xdc, 0x9d, 0xba, 0x7b, 0x29, 0xbf, 0x44
+};
+
+static const UCHAR kat_private_result[] =
+{
+    0x3c, 0x6c, 0xa9, 0xea, 0xa5, 0x8f, 0x98, 0xce, 0x15, 0x89, 0x96, 0xeb, 0x39, 0xfa, 0x48, 0x33,
+    0x15, 0x3d, 0x58, 0xcc, 0x7c, 0x5c, 0x7a, 0xfa, 0xbd, 0x57, 0x73, 0xec, 0xad, 0xef, 0x6b, 0xe1,
+    0xeb, 0xa9, 0x5e, 0xcf, 0x8c, 0x81, 0x77, 0xe6, 0xec, 0x60, 0x33, 0xd5, 0x0b, 0x8b, 0x90, 0xba,
+    0xe6, 0x51, 0x6e, 0x88, 0x53, 0x9f, 0x46, 0xd1, 0x75, 0x24, 0xf9, 0xf6, 0x80, 0x17, 0x14, 0xdb,
+    0x1d, 0x40, 0x61, 0x15, 0xf3, 0x0d, 0xe3, 0x9e, 0xc0, 0x83, 0xed, 0x81, 0xc5, 0x26, 0x34, 0x6e,
+    0xbc, 0xc6, 0x49, 0x57, 0x2d, 0x94, 0x22, 0xcd, 0x0c, 0xca, 0x07, 0x08, 0xd8, 0x0e, 0x11, 0xdf,
+    0x78, 0xc7, 0x1e, 0x13, 0x2c, 0xe9, 0x29, 0xa2, 0x0e, 0x63, 0x18, 0x90, 0xe7, 0xd7, 0x57, 0xeb,
+    0x6c, 0xe7, 0x7d, 0xeb, 0x19, 0x7a, 0x7f, 0x9f, 0x15, 0x60, 0x11, 0x0a, 0xf5, 0x3c, 0x2f, 0xb1,
+    0xde, 0x43, 0xb8, 0xc0, 0xd6, 0xa1, 0xdd, 0x0a, 0xa7, 0xab, 0xc9, 0x96, 0xfb, 0xb1, 0xd0, 0x49,
+    0xab, 0x03, 0x61, 0x74, 0x6e, 0x2c, 0xaf, 0xd5, 0x7a, 0x5d, 0x0d, 0x2e, 0x97, 0xc7, 0xef, 0x19,
+    0xb1, 0xde, 0x68, 0x9f, 0x69, 0x27, 0x1b, 0x90, 0x96, 0x4f, 0xf3, 0x0f, 0x47, 0x94, 0x13, 0xdd,
+    0x83, 0x9f, 0x6d, 0x47, 0x41, 0x21, 0x71, 0x8c, 0xcb, 0xa7, 0xef, 0xae, 0x44, 0xa0, 0x16, 0x05,
+    0x33, 0x53, 0x9a, 0x75, 0x5a, 0x6c, 0xb6, 0x4e, 0x8e, 0x43, 0xbb, 0x0e, 0x74, 0xe4, 0xff, 0x13,
+    0xb7, 0x68, 0x2f, 0xb4, 0x3c, 0x06, 0x46, 0x71, 0xba, 0xf8, 0x95, 0x3a, 0x49, 0xc8, 0x8e, 0xf5,
+    0x91, 0xc9, 0x04, 0x53, 0xbf, 0xa0, 0x0f, 0x00, 0x29, 0x0d, 0xe0, 0xbf, 0x39, 0xdd, 0x1f, 0x09,
+    0xcc, 0x71, 0x21, 0x2f, 0x5e, 0xe0, 0x81, 0x06, 0x7e, 0xaa, 0x28, 0xab, 0x48, 0x6d, 0x02, 0x02
+};
+
+static const UCHAR kat_public_result[] =
+{
+    0x7d, 0x64, 0xd7, 0xd2, 0x81, 0x1e, 0x91, 0xa1, 0x00, 0x3f, 0xa0, 0x55, 0x8f, 0xbf, 0x1d, 0x65,
+    0x5b, 0xa9, 0xc5, 0xf5, 0x3e, 0xf0, 0xa1, 0xb4, 0xcf, 0xa1, 0x33, 0xe9, 0x01, 0xac, 0xda, 0x83,
+    0x5f, 0xa8, 0x0b, 0x03, 0x33, 0x99, 0xab, 0xc3, 0xde, 0xba, 0x3e, 0x32, 0xc5, 0xb9, 0xdb, 0x50,
+    0xe3, 0xd4, 0xc9, 0x44, 0xec, 0x0c, 0xdf, 0x05, 0x01, 0xf7, 0xfc, 0x8c, 0xce, 0x29, 0x76, 0xee,
+    0xef, 0xc5, 0x48, 0x87, 0xfa, 0x86, 0x42, 0x10, 0xf9, 0xba, 0x1e, 0xa7, 0xdf, 0x84, 0xc1, 0x5b,
+    0x9d, 0x2d, 0xb5, 0x48, 0xca, 0x31, 0xf9, 0xc5, 0x1f, 0xff, 0xff, 0x34, 0xca, 0xf6, 0x52, 0x12,
+    0xeb, 0xf1, 0x81, 0x43, 0xfd, 0x75, 0xeb, 0xd8, 0x45, 0x74, 0xb7, 0x6f, 0x8c, 0x5d, 0x5d, 0x16,
+    0x3c, 0x38, 0x35, 0x36, 0xb0, 0x0d, 0x06, 0xbc, 0xb0, 0x6a, 0x73, 0xa7, 0x4b, 0x7c, 0x3f, 0x4d,
+    0x29, 0x41, 0xd2, 0x5d, 0x14, 0xde, 0x01, 0x14, 0x9e, 0x8d, 0x98, 0x23, 0xcd, 0xea, 0xee, 0x30,
+    0x44, 0xd6, 0x45, 0xfa, 0xa5, 0xd0, 0xa3, 0x14, 0x12, 0x0a, 0xff, 0x1c, 0x33, 0x1c, 0x20, 0xc3,
+    0x14, 0x5c, 0x52, 0x08, 0xfb, 0x0c, 0x29, 0xa7, 0xde, 0xbf, 0x52, 0x31, 0x64, 0xfe, 0x62, 0x9e,
+    0x4e, 0xde, 0xec, 0x5c, 0x58, 0x58, 0xa0, 0x5a, 0x31, 0xa4, 0xe6, 0x3e, 0xa4, 0x3b, 0xd2, 0x4d,
+    0xf4, 0x93, 0xf4, 0x50, 0x67, 0x7e, 0xae, 0x7b, 0x18, 0x90, 0x74, 0xf8, 0x51, 0xbc, 0x29, 0xcb,
+    0x2c, 0x28, 0xfe, 0xb2, 0x6a, 0x12, 0x35, 0xfe, 0xaf, 0x44, 0x07, 0x01, 0xe8, 0x4f, 0xc9, 0xf5,
+    0x21, 0x43, 0x18, 0x04, 0x6a, 0x2a, 0x43, 0xb3, 0x2d, 0x30, 0xb5, 0xd1, 0x34, 0xb6, 0x32, 0x75,
+    0x13, 0x91, 0x72, 0xf4, 0x2d, 0xf7, 0xb5, 0x34, 0x9e, 0x9f, 0xf0, 0x7b, 0x63, 0x55, 0x7c, 0xf1
+};
+
+static const UCHAR kat_public_exponent[] = { 0x01, 0x00, 0x01 };
+
+
+/* Define the operand buffers, the scratch buffer and the result buffers of the test.  */
+
+static HN_UBASE         left_buffer[TEST_MAX_BYTES / sizeof(HN_UBASE)];
+static HN_UBASE         right_buffer[TEST_MAX_BYTES / sizeof(HN_UBASE)];
+static HN_UBASE         modulus_buffer[TEST_MAX_BYTES / sizeof(HN_UBASE)];
+static HN_UBASE         p_buffer[TEST_MAX_BYTES / sizeof(HN_UBASE)];
+static HN_UBASE         q_buffer[TEST_MAX_BYTES / sizeof(HN_UBASE)];
+static HN_UBASE         result_buffer[2 * TEST_MAX_BYTES / sizeof(HN_UBASE)];
+static HN_UBASE         expected_buffer[2 * TEST_MAX_BYTES / sizeof(HN_UBASE)];
+static HN_UBASE         reference_buffer[2 * TEST_MAX_BYTES / sizeof(HN_UBASE)];
+static HN_UBASE         scratch_buffer[(16 * TEST_MAX_BYTES + 4096) / sizeof(HN_UBASE)];
+static UCHAR            output_bytes[TEST_KAT_BYTES];
+
+static ULONG            test_seed = 2026;
+static UINT             test_failures;
+
+
+/* Return the next value of a xorshift generator, so every run checks the same operands.  */
+
+static ULONG test_random(VOID)
+{
+
+    test_seed ^= test_seed << 13;
+    test_seed ^= test_seed >> 17;
+    test_seed ^= test_seed << 5;
+    return(test_seed);
+}
+
+
+/* Record a failed check.  */
+
+static VOID test_check(UINT condition, const CHAR *name, UINT test_case)
+{
+
+    if (!condition)
+    {
+        if (test_failures < 20)
+        {
+            printf("FAILED: %s, case %u\n", name, test_case);
+        }
+        test_failures++;
+    }
+}
+
+
+/* Set up a huge number of the given buffer size holding a random value of up to bytes bytes.  */
+
+static VOID test_random_number(NX_CRYPTO_HUGE_NUMBER *number, HN_UBASE *buffer, UINT buffer_size, UINT bytes)
+{
+UCHAR   value[TEST_MAX_BYTES];
+UINT    i;
+
+    for (i = 0; i < bytes; i++)
+    {
+        value[i] = (UCHAR)test_random();
+    }
+    number -> nx_crypto_huge_number_data = buffer;
+    number -> nx_crypto_huge_buffer_size = buffer_size;
+    _nx_crypto_huge_number_setup(number, value, bytes);
+}
+
+
+/* Set up a huge number of the given buffer size from a big endian byte string.  */
+
+static VOID test_number(NX_CRYPTO_HUGE_NUMBER *number, HN_UBASE *buffer, UINT buffer_size, const UCHAR *value, UINT bytes)
+{
+
+    number -> nx_crypto_huge_number_data = buffer;
+    number -> nx_crypto_huge_buffer_size = buffer_size;
+    _nx_crypto_huge_number_setup(number, value, bytes);
+}
+
+
+/* Compare the values of two huge numbers.  */
+
+static UINT test_equal(NX_CRYPTO_HUGE_NUMBER *left, NX_CRYPTO_HUGE_NUMBER *right)
+{
+
+    _nx_crypto_huge_number_adjust_size(left);
+    _nx_crypto_huge_number_adjust_size(right);
+    return(_nx_crypto_huge_number_compare_unsigned(left, right) == NX_CRYPTO_HUGE_NUMBER_EQUAL);
+}
+
+
+/* Fill the scratch buffer, past size bytes with the guard as well.  */
+
+static VOID test_scratch_fill(VOID)
+{
+
+    memset(scratch_buffer, TEST_GUARD_BYTE, sizeof(scratch_buffer));
+}
+
+
+/* Check that no byte past size bytes of the scratch buffer was written.  */
+
+static UINT test_scratch_guard(UINT size)
+{
+UCHAR  *guard = (UCHAR *)scratch_buffer + size;
+UINT    i;
+
+    for (i = 0; i < TEST_GUARD_SIZE; i++)
+    {
+        if (guard[i] != TEST_GUARD_BYTE)
+        {
+            return(NX_CRYPTO_FALSE);
+        }
+    }
+    return(NX_CRYPTO_TRUE);
+}
+
+
+/* Compute the product of two huge numbers digit by digit.  */
+
+static VOID test_schoolbook_multiply(NX_CRYPTO_HUGE_NUMBER *left, NX_CRYPTO_HUGE_NUMBER *right, NX_CRYPTO_HUGE_NUMBER *result)
+{
+UINT        i, j;
+HN_UBASE2   product;
+
+    memset(result -> nx_crypto_huge_number_data, 0, result -> nx_crypto_huge_buffer_size);
+    for (i = 0; i < left -> nx_crypto_huge_number_size; i++)
+    {
+        product = 0;
+        for (j = 0; j < right -> nx_crypto_huge_number_size; j++)
+        {
+            product = (HN_UBASE2)left -> nx_crypto_huge_number_data[i] * right -> nx_crypto_huge_number_data[j] +
+                      result -> nx_crypto_huge_number_data[i + j] + (product >> HN_SHIFT);
+            result -> nx_crypto_huge_number_data[i + j] = (HN_UBASE)product;
+        }
+        result -> nx_crypto_huge_number_data[i + j] = (HN_UBASE)(product >> HN_SHIFT);
+    }
+    result -> nx_crypto_huge_number_size = left -> nx_crypto_huge_number_size + right -> nx_crypto_huge_number_size;
+    result -> nx_crypto_huge_number_is_negative = NX_CRYPTO_FALSE;
+}
+
+
+/* Raise number to the power of exponent with square-and-multiply, reducing with modulus after each step.  */
+
+static VOID test_reference_power(NX_CRYPTO_HUGE_NUMBER *number, NX_CRYPTO_HUGE_NUMBER *exponent,
+                                 NX_CRYPTO_HUGE_NUMBER *modulus, NX_CRYPTO_HUGE_NUMBER *result)
+{
+NX_CRYPTO_HUGE_NUMBER   product;
+INT                     bit;
+
+    product.nx_crypto_huge_number_data = reference_buffer;
+    product.nx_crypto_huge_buffer_size = sizeof(reference_buffer);
+    NX_CRYPTO_HUGE_NUMBER_SET_DIGIT(result, 1);
+    for (bit = (INT)(exponent -> nx_crypto_huge_number_size * HN_SHIFT) - 1; bit >= 0; bit--)
+    {
+        _nx_crypto_huge_number_multiply(result, result, &product);
+        _nx_crypto_huge_number_modulus(&product, modulus);
+        NX_CRYPTO_HUGE_NUMBER_COPY(result, &product);
+        if ((exponent -> nx_crypto_huge_number_data[bit / HN_SHIFT] >> (bit % HN_SHIFT)) & 1)
+        {
+            _nx_crypto_huge_number_multiply(result, number, &product);
+            _nx_crypto_huge_number_modulus(&product, modulus);
+            NX_CRYPTO_HUGE_NUMBER_COPY(result, &product);
+        }
+    }
+}
+
+
+/* Compare column-wise multiplication, squaring and Karatsuba multiplication with the schoolbook product.  */
+
+static VOID test_multiply(VOID)
+{
+NX_CRYPTO_HUGE_NUMBER   left, right, result, expected;
+UINT                    left_bytes, right_bytes, scratch_size, i;
+
+    for (i = 0; i < TEST_RANDOM_CASES; i++)
+    {
+
+        /* Every other case multiplies operands of similar size, which Karatsuba splits.  */
+        left_bytes = 1 + (UINT)(test_random() % TEST_KAT_BYTES);
+        right_bytes = (i & 1) ? left_bytes : 1 + (UINT)(test_random() % TEST_KAT_BYTES);
+        test_random_number(&left, left_buffer, TEST_MAX_BYTES, left_bytes);
+        test_random_number(&right, right_buffer, TEST_MAX_BYTES, right_bytes);
+        result.nx_crypto_huge_number_data = result_buffer;
+        result.nx_crypto_huge_buffer_size = sizeof(result_buffer);
+        expected.nx_crypto_huge_number_data = expected_buffer;
+        expected.nx_crypto_huge_buffer_size = sizeof(expected_buffer);
+        test_schoolbook_multiply(&left, &right, &expected);
+
+        _nx_crypto_huge_number_multiply(&left, &right, &result);
+        test_check(test_equal(&result, &expected), "multiply", i);
+
+        scratch_size = NX_CRYPTO_HUGE_NUMBER_KARATSUBA_SCRATCH_SIZE(TEST_MAX_BYTES);
+        test_scratch_fill();
+        _nx_crypto_huge_number_multiply_karatsuba(&left, &right, &result, scratch_buffer);
+        test_check(test_equal(&result, &expected), "multiply_karatsuba", i);
+        test_check(test_scratch_guard(scratch_size), "multiply_karatsuba scratch", i);
+
+        test_schoolbook_multiply(&left, &left, &expected);
+        _nx_crypto_huge_number_square(&left, &result);
+        test_check(test_equal(&result, &expected), "square", i);
+    }
+}
+
+
+/* Compare sliding-window Montgomery exponentiation with square-and-multiply, for short and long exponents.  */
+
+static VOID test_power(VOID)
+{
+NX_CRYPTO_HUGE_NUMBER   number, exponent, modulus, result, expected;
+UINT                    modulus_bytes, exponent_bytes, scratch_size, i;
+
+    for (i = 0; i < TEST_POWER_CASES; i++)
+    {
+        modulus_bytes = 4 * (1 + (UINT)(test_random() % (TEST_KAT_BYTES / 4)));
+        exponent_bytes = (i & 1) ? 1 + (UINT)(test_random() % 4) : modulus_bytes;
+        test_random_number(&modulus, modulus_buffer, modulus_bytes, modulus_bytes);
+        modulus_buffer[0] |= 1;
+        test_random_number(&number, left_buffer, modulus_bytes, modulus_bytes);
+        _nx_crypto_huge_number_modulus(&number, &modulus);
+        test_random_number(&exponent, right_buffer, TEST_MAX_BYTES, exponent_bytes);
+        _nx_crypto_huge_number_adjust_size(&exponent);
+        result.nx_crypto_huge_number_data = result_buffer;
+        result.nx_crypto_huge_buffer_size = modulus_bytes * 2;
+        expected.nx_crypto_huge_number_data = expected_buffer;
+        expected.nx_crypto_huge_buffer_size = modulus_bytes * 2;
+        test_reference_power(&number, &exponent, &modulus, &expected);
+
+        scratch_size = (2 * modulus_bytes) + 8 + NX_CRYPTO_HUGE_NUMBER_WINDOW_SCRATCH_SIZE(modulus_bytes);
+        test_scratch_fill();
+        _nx_crypto_huge_number_mont_power_modulus(&number, &exponent, &modulus, &result, scratch_buffer);
+        test_check(test_equal(&result, &expected), "mont_power_modulus", i);
+        test_check(test_scratch_guard(scratch_size), "mont_power_modulus scratch", i);
+    }
+}
+
+
+/* Check the RSA-2048 known answers with and without CRT, and through the RSA operation.  */
+
+static VOID test_rsa(VOID)
+{
+NX_CRYPTO_HUGE_NUMBER   number, exponent, modulus, p, q, result, expected;
+UINT                    half = TEST_KAT_BYTES / 2;
+UINT                    scratch_size;
+
+    test_number(&modulus, modulus_buffer, TEST_KAT_BYTES, kat_modulus, sizeof(kat_modulus));
+    test_number(&p, p_buffer, half, kat_p, sizeof(kat_p));
+    test_number(&q, q_buffer, half, kat_q, sizeof(kat_q));
+    test_number(&expected, expected_buffer, TEST_KAT_BYTES, kat_private_result, sizeof(kat_private_result));
+    result.nx_crypto_huge_number_data = result_buffer;
+    result.nx_crypto_huge_buffer_size = TEST_KAT_BYTES * 2;
+
+    /* Private exponent with CRT.  */
+    test_number(&number, left_buffer, TEST_KAT_BYTES, kat_input, sizeof(kat_input));
+    test_number(&exponent, right_buffer, TEST_KAT_BYTES, kat_private_exponent, sizeof(kat_private_exponent));
+    scratch_size = (4 * TEST_KAT_BYTES) + 24 +
+                   ((NX_CRYPTO_HUGE_NUMBER_WINDOW_SCRATCH_SIZE(half) > NX_CRYPTO_HUGE_NUMBER_KARATSUBA_SCRATCH_SIZE(half)) ?
+                    NX_CRYPTO_HUGE_NUMBER_WINDOW_SCRATCH_SIZE(half) : NX_CRYPTO_HUGE_NUMBER_KARATSUBA_SCRATCH_SIZE(half));
+    test_scratch_fill();
+    _nx_crypto_huge_number_crt_power_modulus(&number, &exponent, &p, &q, &modulus, &result, scratch_buffer);
+    test_check(test_equal(&result, &expected), "crt_power_modulus", 0);
+    test_check(test_scratch_guard(scratch_size), "crt_power_modulus scratch", 0);
+
+    /* Private exponent without CRT.  */
+    test_number(&number, left_buffer, TEST_KAT_BYTES, kat_input, sizeof(kat_input));
+    scratch_size = (2 * TEST_KAT_BYTES) + 8 + NX_CRYPTO_HUGE_NUMBER_WINDOW_SCRATCH_SIZE(TEST_KAT_BYTES);
+    test_scratch_fill();
+    _nx_crypto_huge_number_mont_power_modulus(&number, &exponent, &modulus, &result, scratch_buffer);
+    test_check(test_equal(&result, &expected), "mont_power_modulus private", 0);
+    test_check(test_scratch_guard(scratch_size), "mont_power_modulus private scratch", 0);
+
+    /* The RSA operation with CRT, given the scratch of NX_CRYPTO_RSA_SCRATCH_BUFFER_SIZE for the key size.  */
+    scratch_size = (10 * TEST_KAT_BYTES) + 24 + NX_CRYPTO_RSA_SCRATCH_EXTRA_SIZE(TEST_KAT_BYTES);
+    test_scratch_fill();
+    _nx_crypto_rsa_operation(kat_private_exponent, sizeof(kat_private_exponent), kat_modulus, sizeof(kat_modulus),
+                             kat_p, sizeof(kat_p), (UCHAR *)kat_q, sizeof(kat_q), kat_input, sizeof(kat_input),
+                             output_bytes, (USHORT *)scratch_buffer, scratch_size);
+    test_check(memcmp(output_bytes, kat_private_result, TEST_KAT_BYTES) == 0, "rsa_operation private", 0);
+    test_check(test_scratch_guard(scratch_size), "rsa_operation private scratch", 0);
+
+    /* The RSA operation with the public exponent, which needs no table of odd powers.  */
+    test_scratch_fill();
+    _nx_crypto_rsa_operation(kat_public_exponent, sizeof(kat_public_exponent), kat_modulus, sizeof(kat_modulus),
+                             NX_CRYPTO_NULL, 0, NX_CRYPTO_NULL, 0, kat_input, sizeof(kat_input),
+                             output_bytes, (USHORT *)scratch_buffer, scratch_size);
+    test_check(memcmp(output_bytes, kat_public_result, TEST_KAT_BYTES) == 0, "rsa_operation public", 0);
+}
+
+
+static double test_time_get(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec * 1e9 + (double)now.tv_nsec);
+}
+
+
+/* Return the time of one RSA-2048 operation in microseconds, with or without the primes for CRT.  */
+
+static double test_rsa_time(const UCHAR *exponent, UINT exponent_length, UINT use_crt)
+{
+UINT    scratch_size = (10 * TEST_KAT_BYTES) + 24 + NX_CRYPTO_RSA_SCRATCH_EXTRA_SIZE(TEST_KAT_BYTES);
+double  start;
+UINT    round;
+
+    start = test_time_get();
+    for (round = 0; round < TEST_RSA_ROUNDS; round++)
+    {
+        _nx_crypto_rsa_operation(exponent, exponent_length, kat_modulus, sizeof(kat_modulus),
+                                 use_crt ? kat_p : NX_CRYPTO_NULL, use_crt ? sizeof(kat_p) : 0,
+                                 use_crt ? (UCHAR *)kat_q : NX_CRYPTO_NULL, use_crt ? sizeof(kat_q) : 0,
+                                 kat_input, sizeof(kat_input), output_bytes, (USHORT *)scratch_buffer, scratch_size);
+    }
+    return((test_time_get() - start) / TEST_RSA_ROUNDS / 1e3);
+}
+
+
+/* Report the time of a 2048-bit product, column-wise and digit by digit, and of the RSA-2048 public
+   operation and private operation, with and without CRT.  */
+
+static VOID test_benchmark(VOID)
+{
+NX_CRYPTO_HUGE_NUMBER   left, right, result;
+double                  times[2];
+double                  start;
+UINT                    round;
+
+    test_random_number(&left, left_buffer, TEST_MAX_BYTES, TEST_KAT_BYTES);
+    test_random_number(&right, right_buffer, TEST_MAX_BYTES, TEST_KAT_BYTES);
+    result.nx_crypto_huge_number_data = result_buffer;
+    result.nx_crypto_huge_buffer_size = sizeof(result_buffer);
+
+    start = test_time_get();
+    for (round = 0; round < TEST_PRODUCT_ROUNDS; round++)
+    {
+        _nx_crypto_huge_number_multiply(&left, &right, &result);
+    }
+    times[0] = (test_time_get() - start) / TEST_PRODUCT_ROUNDS;
+    start = test_time_get();
+    for (round = 0; round < TEST_PRODUCT_ROUNDS; round++)
+    {
+        test_schoolbook_multiply(&left, &right, &result);
+    }
+    times[1] = (test_time_get() - start) / TEST_PRODUCT_ROUNDS;
+    printf("2048-bit product: column-wise %6.0f ns, digit by digit %6.0f ns\n", times[0], times[1]);
+
+    printf("RSA-2048: public %6.1f us, private with CRT %8.1f us, private without CRT %8.1f us\n",
+           test_rsa_time(kat_public_exponent, sizeof(kat_public_exponent), NX_CRYPTO_FALSE),
+           test_rsa_time(kat_private_exponent, sizeof(kat_private_exponent), NX_CRYPTO_TRUE),
+           test_rsa_time(kat_private_exponent, sizeof(kat_private_exponent), NX_CRYPTO_FALSE));
+}
+
+
+int main(void)
+{
+
+    test_multiply();
+    test_power();
+    test_rsa();
+    test_benchmark();
+
+    if (test_failures)
+    {
+        printf("nx_crypto_huge_number_test: %u checks failed\n", test_failures);
+        return(1);
+    }
+    printf("nx_crypto_huge_number_test: passed\n");
+    return(0);
+}
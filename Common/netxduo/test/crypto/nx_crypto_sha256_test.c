@@ -0,0 +1,204 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks SHA-256 and SHA-224 against the FIPS 180-2 examples and the digest of one million
+   'a' characters. Each message is hashed in one update and in updates of several sizes, from
+   unaligned buffers, so both the whole-block path of _nx_crypto_sha256_update and the bytes it
+   keeps between updates are covered. The SHA-256 throughput over aligned and unaligned buffers is
+   reported.  */
+
+#include "nx_crypto_sha2.h"
+#include <stdio.h>
+#include <time.h>
+
+
+#define TEST_MILLION            1000000
+#define TEST_MILLION_CHUNK      1000
+#define TEST_ROUNDS             20
+
+
+typedef struct TEST_VECTOR_STRUCT
+{
+    const CHAR     *message;
+    UCHAR           sha256[32];
+    UCHAR           sha224[28];
+} TEST_VECTOR;
+
+
+/* Define the FIPS 180-2 examples.  */
+
+static const TEST_VECTOR test_vectors[] =
+{
+    {
+        "",
+        { 0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+          0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c, 0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55 },
+        { 0xd1, 0x4a, 0x02, 0x8c, 0x2a, 0x3a, 0x2b, 0xc9, 0x47, 0x61, 0x02, 0xbb, 0x28, 0x82, 0x34, 0xc4,
+          0x15, 0xa2, 0xb0, 0x1f, 0x82, 0x8e, 0xa6, 0x2a, 0xc5, 0xb3, 0xe4, 0x2f }
+    },
+    {
+        "abc",
+        { 0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+          0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad },
+        { 0x23, 0x09, 0x7d, 0x22, 0x34, 0x05, 0xd8, 0x22, 0x86, 0x42, 0xa4, 0x77, 0xbd, 0xa2, 0x55, 0xb3,
+          0x2a, 0xad, 0xbc, 0xe4, 0xbd, 0xa0, 0xb3, 0xf7, 0xe3, 0x6c, 0x9d, 0xa7 }
+    },
+    {
+        "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+        { 0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+          0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67, 0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1 },
+        { 0x75, 0x38, 0x8b, 0x16, 0x51, 0x27, 0x76, 0xcc, 0x5d, 0xba, 0x5d, 0xa1, 0xfd, 0x89, 0x01, 0x50,
+          0xb0, 0xc6, 0x45, 0x5c, 0xb4, 0xf5, 0x8b, 0x19, 0x52, 0x52, 0x25, 0x25 }
+    },
+    {
+        "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+        { 0xcf, 0x5b, 0x16, 0xa7, 0x78, 0xaf, 0x83, 0x80, 0x03, 0x6c, 0xe5, 0x9e, 0x7b, 0x04, 0x92, 0x37,
+          0x0b, 0x24, 0x9b, 0x11, 0xe8, 0xf0, 0x7a, 0x51, 0xaf, 0xac, 0x45, 0x03, 0x7a, 0xfe, 0xe9, 0xd1 },
+        { 0xc9, 0x7c, 0xa9, 0xa5, 0x59, 0x85, 0x0c, 0xe9, 0x7a, 0x04, 0xa9, 0x6d, 0xef, 0x6d, 0x99, 0xa9,
+          0xe0, 0xe0, 0xe2, 0xab, 0x14, 0xe6, 0xb8, 0xdf, 0x26, 0x5f, 0xc0, 0xb3 }
+    }
+};
+
+
+/* Define the digests of one million 'a' characters.  */
+
+static const UCHAR million_a_sha256[32] =
+{
+    0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67,
+    0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e, 0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0
+};
+
+static const UCHAR million_a_sha224[28] =
+{
+    0x20, 0x79, 0x46, 0x55, 0x98, 0x0c, 0x91, 0xd8, 0xbb, 0xb4, 0xc1, 0xea, 0x97, 0x61, 0x8a, 0x4b,
+    0xf0, 0x3f, 0x42, 0x58, 0x19, 0x48, 0xb2, 0xee, 0x4e, 0xe7, 0xad, 0x67
+};
+
+
+/* Define the update sizes. 0 hashes the message in one update.  */
+
+static const UINT       test_chunks[] = { 0, 1, 3, 63, 64, 65, 200 };
+
+static UCHAR            test_buffer[TEST_MILLION + 4];
+static UINT             test_failures;
+
+
+/* Hash length bytes of input in updates of chunk bytes and compare the digest.  */
+
+static VOID test_hash(UINT algorithm, const UCHAR *input, UINT length, UINT chunk,
+                      const UCHAR *expected, UINT expected_size, const CHAR *name)
+{
+NX_CRYPTO_SHA256    context;
+UCHAR               digest[32];
+UINT                offset, size;
+
+    _nx_crypto_sha256_initialize(&context, algorithm);
+    for (offset = 0; offset < length; offset += size)
+    {
+        size = length - offset;
+        if ((chunk != 0) && (size > chunk))
+        {
+            size = chunk;
+        }
+        _nx_crypto_sha256_update(&context, (UCHAR *)input + offset, size);
+    }
+    _nx_crypto_sha256_digest_calculate(&context, digest, algorithm);
+
+    if (memcmp(digest, expected, expected_size) != 0)
+    {
+        printf("FAILED: %s, %u bytes in updates of %u\n", name, length, chunk);
+        test_failures++;
+    }
+}
+
+
+static double test_time_get(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec * 1e9 + (double)now.tv_nsec);
+}
+
+
+/* Report the SHA-256 throughput over one million bytes, in updates of the given size, from an aligned
+   buffer and from an unaligned one.  */
+
+static VOID test_benchmark(UINT chunk)
+{
+NX_CRYPTO_SHA256    context;
+UCHAR               digest[32];
+double              rates[2];
+double              start;
+UINT                alignment, round, offset;
+
+    for (alignment = 0; alignment < 2; alignment++)
+    {
+        start = test_time_get();
+        for (round = 0; round < TEST_ROUNDS; round++)
+        {
+            _nx_crypto_sha256_initialize(&context, NX_CRYPTO_HASH_SHA256);
+            for (offset = 0; offset < TEST_MILLION; offset += chunk)
+            {
+                _nx_crypto_sha256_update(&context, test_buffer + alignment + offset, chunk);
+            }
+            _nx_crypto_sha256_digest_calculate(&context, digest, NX_CRYPTO_HASH_SHA256);
+        }
+        rates[alignment] = (double)TEST_MILLION * TEST_ROUNDS * 1e3 / (test_time_get() - start);
+    }
+    printf("SHA-256 in updates of %4u bytes: aligned %6.1f MB/s, unaligned %6.1f MB/s\n",
+           chunk, rates[0], rates[1]);
+}
+
+
+int main(void)
+{
+UINT    i, j, alignment, length;
+UCHAR  *input;
+
+    for (i = 0; i < sizeof(test_vectors) / sizeof(test_vectors[0]); i++)
+    {
+        length = (UINT)strlen(test_vectors[i].message);
+        for (alignment = 0; alignment < 4; alignment++)
+        {
+
+            /* Copy the message to an unaligned address.  */
+            input = test_buffer + alignment;
+            memcpy(input, test_vectors[i].message, length);
+            for (j = 0; j < sizeof(test_chunks) / sizeof(test_chunks[0]); j++)
+            {
+                test_hash(NX_CRYPTO_HASH_SHA256, input, length, test_chunks[j],
+                          test_vectors[i].sha256, sizeof(test_vectors[i].sha256), "SHA-256");
+                test_hash(NX_CRYPTO_HASH_SHA224, input, length, test_chunks[j],
+                          test_vectors[i].sha224, sizeof(test_vectors[i].sha224), "SHA-224");
+            }
+        }
+    }
+
+    /* One million 'a' characters, in one update and in updates of 1000 bytes from an unaligned buffer.  */
+    memset(test_buffer, 'a', sizeof(test_buffer));
+    test_hash(NX_CRYPTO_HASH_SHA256, test_buffer, TEST_MILLION, 0, million_a_sha256, sizeof(million_a_sha256), "SHA-256");
+    test_hash(NX_CRYPTO_HASH_SHA256, test_buffer + 1, TEST_MILLION, TEST_MILLION_CHUNK,
+              million_a_sha256, sizeof(million_a_sha256), "SHA-256");
+    test_hash(NX_CRYPTO_HASH_SHA224, test_buffer + 3, TEST_MILLION, TEST_MILLION_CHUNK,
+              million_a_sha224, sizeof(million_a_sha224), "SHA-224");
+
+    test_benchmark(64);
+    test_benchmark(TEST_MILLION_CHUNK);
+
+    if (test_failures)
+    {
+        printf("nx_crypto_sha256_test: %u checks failed\n", test_failures);
+        return(1);
+    }
+    printf("nx_crypto_sha256_test: passed\n");
+    return(0);
+}
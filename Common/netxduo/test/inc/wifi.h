@@ -0,0 +1,18 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* Host stand-in for the WiFi module header of the boards, included by nx_wifi.h. The host tests
+   replace the WiFi offload driver with the TCP loopback of nx_wifi_loopback.c.  */
+
+#ifndef WIFI_H
+#define WIFI_H
+
+#endif /* WIFI_H */
@@ -0,0 +1,455 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks how records are kept within a negotiated max_fragment_length (RFC 6066). A
+   client and a server session, set up with AES-128-CBC and HMAC-SHA256 keys as if the handshake had
+   finished, are connected through the TCP loopback, and the client is given a limit of 1024 bytes
+   as if the server had echoed it. Data sent by the client that is longer than the limit must
+   arrive as several records of at most 1024 bytes, in order, whether it is in one packet or a
+   chain, and data that fits must still go out as one record. Handshake messages, such as a long
+   client Certificate, must be split the same way. When the pool runs out after the first record is
+   sent, the send must fail with the data of that record trimmed off the front of the packet. A record of 2000 bytes from the
+   server must be rejected by the client with NX_SECURE_TLS_RECORD_OVERFLOW and answered with a
+   record_overflow alert. No packet may be left allocated once the sessions are ended.  */
+
+#include "tx_api.h"
+#include "nx_secure_tls_api.h"
+#include "nx_wifi_loopback.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+
+#define TEST_FRAGMENT_LENGTH    1024
+#define TEST_IV_SIZE            16
+#define TEST_MAC_SIZE           32
+#define TEST_PACKET_SIZE        1536
+#define TEST_PAYLOAD_SIZE       1400        /* Data per packet, behind the TCP header space.  */
+#define TEST_PACKETS            32
+#define TEST_DATA_SIZE          5000
+#define TEST_WAIT               100
+#define TEST_STACK_SIZE         4096
+
+
+extern NX_CRYPTO_METHOD crypto_method_aes_cbc_128;
+extern NX_CRYPTO_METHOD crypto_method_hmac_sha256;
+
+static const UCHAR      test_key[16] =
+{
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10
+};
+
+static UINT                             test_failures;
+static NX_SECURE_TLS_CIPHERSUITE_INFO   test_ciphersuite;
+static ULONG                            test_cipher_metadata[2][2][4096 / sizeof(ULONG)];
+static ULONG                            test_hash_metadata[2][4096 / sizeof(ULONG)];
+static NX_IP                            test_ip;
+static NX_PACKET_POOL                   test_pool;
+static ULONG                            test_pool_area[TEST_PACKETS * (TEST_PACKET_SIZE + sizeof(NX_PACKET)) / sizeof(ULONG)];
+static NX_TCP_SOCKET                    test_sockets[2];
+static NX_SECURE_TLS_SESSION            test_sessions[2];
+static UCHAR                            test_packet_buffers[2][4096];
+static UCHAR                            test_data[TEST_DATA_SIZE];
+static UCHAR                            test_received[TEST_DATA_SIZE];
+static TX_THREAD                        test_thread;
+static ULONG                            test_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+
+
+static VOID test_check(UINT condition, const CHAR *name, ULONG size)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s, %u bytes\n", name, size);
+        test_failures++;
+    }
+}
+
+
+/* Set up a TLS 1.2 session on a loopback socket with the handshake finished. AES-128-CBC and
+   HMAC-SHA256 are used with the same fixed keys in both directions.  */
+
+static VOID test_session_setup(UINT index, UINT socket_type)
+{
+NX_SECURE_TLS_SESSION     *session = &test_sessions[index];
+NX_SECURE_TLS_KEY_MATERIAL *keys = &session -> nx_secure_tls_key_material;
+
+    memset(session, 0, sizeof(NX_SECURE_TLS_SESSION));
+    tx_mutex_create(&session -> nx_secure_tls_session_transmit_mutex, "test", TX_NO_INHERIT);
+    session -> nx_secure_tls_id = NX_SECURE_TLS_ID;
+    session -> nx_secure_tls_socket_type = (UCHAR)socket_type;
+    session -> nx_secure_tls_client_state = NX_SECURE_TLS_CLIENT_STATE_HANDSHAKE_FINISHED;
+    session -> nx_secure_tls_server_state = NX_SECURE_TLS_SERVER_STATE_HANDSHAKE_FINISHED;
+    session -> nx_secure_tls_protocol_version = NX_SECURE_TLS_VERSION_TLS_1_2;
+    session -> nx_secure_tls_tcp_socket = &test_sockets[index];
+    session -> nx_secure_tls_packet_pool = &test_pool;
+    session -> nx_secure_tls_packet_buffer = test_packet_buffers[index];
+    session -> nx_secure_tls_packet_buffer_size = sizeof(test_packet_buffers[index]);
+    session -> nx_secure_tls_session_ciphersuite = &test_ciphersuite;
+    session -> nx_secure_session_cipher_metadata_area_client = test_cipher_metadata[index][0];
+    session -> nx_secure_session_cipher_metadata_area_server = test_cipher_metadata[index][1];
+    session -> nx_secure_session_cipher_metadata_size = sizeof(test_cipher_metadata[index][0]);
+    session -> nx_secure_hash_mac_metadata_area = test_hash_metadata[index];
+    session -> nx_secure_hash_mac_metadata_size = sizeof(test_hash_metadata[index]);
+
+    keys -> nx_secure_tls_client_write_mac_secret = keys -> nx_secure_tls_key_material_data;
+    keys -> nx_secure_tls_server_write_mac_secret = keys -> nx_secure_tls_key_material_data + TEST_MAC_SIZE;
+    keys -> nx_secure_tls_client_iv = keys -> nx_secure_tls_key_material_data + (2 * TEST_MAC_SIZE);
+    keys -> nx_secure_tls_server_iv = keys -> nx_secure_tls_key_material_data + (2 * TEST_MAC_SIZE) + TEST_IV_SIZE;
+    memset(keys -> nx_secure_tls_key_material_data, 0x09, 2 * TEST_MAC_SIZE);
+    memset(keys -> nx_secure_tls_client_iv, 0x07, 2 * TEST_IV_SIZE);
+    crypto_method_aes_cbc_128.nx_crypto_init(&crypto_method_aes_cbc_128, (UCHAR *)test_key, 128,
+                                             &session -> nx_secure_session_cipher_handler_client,
+                                             test_cipher_metadata[index][0], sizeof(test_cipher_metadata[index][0]));
+    crypto_method_aes_cbc_128.nx_crypto_init(&crypto_method_aes_cbc_128, (UCHAR *)test_key, 128,
+                                             &session -> nx_secure_session_cipher_handler_server,
+                                             test_cipher_metadata[index][1], sizeof(test_cipher_metadata[index][1]));
+    session -> nx_secure_tls_local_session_active = NX_TRUE;
+    session -> nx_secure_tls_remote_session_active = NX_TRUE;
+}
+
+
+/* Set both sessions up again, with fresh sequence numbers, and give the client the limit.  */
+
+static VOID test_sessions_restart(VOID)
+{
+
+    tx_mutex_delete(&test_sessions[0].nx_secure_tls_session_transmit_mutex);
+    tx_mutex_delete(&test_sessions[1].nx_secure_tls_session_transmit_mutex);
+    test_session_setup(0, NX_SECURE_TLS_SESSION_TYPE_CLIENT);
+    test_session_setup(1, NX_SECURE_TLS_SESSION_TYPE_SERVER);
+    test_sessions[0].nx_secure_tls_max_fragment_length = TEST_FRAGMENT_LENGTH;
+}
+
+
+/* Build application data of the given size, at the given offset into the test data, in packets of
+   at most the given size.  */
+
+static NX_PACKET *test_data_build(ULONG size, ULONG offset, ULONG packet_size)
+{
+NX_PACKET  *packet_ptr;
+NX_PACKET  *tail_ptr;
+ULONG       length;
+
+    if (nx_packet_allocate(&test_pool, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT) != NX_SUCCESS)
+    {
+        return(NX_NULL);
+    }
+    tail_ptr = packet_ptr;
+
+    while (size > 0)
+    {
+        length = (size > packet_size) ? packet_size : size;
+
+        /* Start a new packet for each piece so the data is chained.  */
+        if (packet_ptr -> nx_packet_length > 0)
+        {
+            if (nx_packet_allocate(&test_pool, &tail_ptr -> nx_packet_next, NX_TCP_PACKET, NX_NO_WAIT) != NX_SUCCESS)
+            {
+                nx_packet_release(packet_ptr);
+                return(NX_NULL);
+            }
+            tail_ptr = tail_ptr -> nx_packet_next;
+            packet_ptr -> nx_packet_last = tail_ptr;
+        }
+
+        memcpy(tail_ptr -> nx_packet_append_ptr, test_data + offset, length);
+        tail_ptr -> nx_packet_append_ptr += length;
+        packet_ptr -> nx_packet_length += length;
+        offset += length;
+        size -= length;
+    }
+
+    return(packet_ptr);
+}
+
+
+/* Send data from the client and check that the server receives it in records of at most the
+   limit, all but the last of them full.  */
+
+static VOID test_split(ULONG size, ULONG packet_size)
+{
+NX_PACKET  *packet_ptr;
+ULONG       received = 0;
+ULONG       bytes_copied;
+UINT        records = 0;
+UINT        status;
+
+    packet_ptr = test_data_build(size, 0, packet_size);
+    if (packet_ptr == NX_NULL)
+    {
+        test_check(NX_FALSE, "packet allocate", size);
+        return;
+    }
+
+    status = nx_secure_tls_session_send(&test_sessions[0], packet_ptr, NX_NO_WAIT);
+    test_check(status == NX_SUCCESS, "send", size);
+    if (status != NX_SUCCESS)
+    {
+        nx_packet_release(packet_ptr);
+        return;
+    }
+
+    while (received < size)
+    {
+        status = nx_secure_tls_session_receive(&test_sessions[1], &packet_ptr, TEST_WAIT);
+        test_check(status == NX_SUCCESS, "receive", size);
+        if (status != NX_SUCCESS)
+        {
+            return;
+        }
+
+        test_check(packet_ptr -> nx_packet_length <= TEST_FRAGMENT_LENGTH, "record length", size);
+        test_check((packet_ptr -> nx_packet_length == TEST_FRAGMENT_LENGTH) ||
+                   (received + packet_ptr -> nx_packet_length == size), "full records", size);
+        if (received + packet_ptr -> nx_packet_length <= size)
+        {
+            nx_packet_data_extract_offset(packet_ptr, 0, test_received + received,
+                                          packet_ptr -> nx_packet_length, &bytes_copied);
+        }
+        received += packet_ptr -> nx_packet_length;
+        records++;
+        nx_packet_release(packet_ptr);
+    }
+
+    test_check(received == size, "received length", size);
+    test_check(memcmp(test_received, test_data, size) == 0, "received data", size);
+    test_check(records == (size + TEST_FRAGMENT_LENGTH - 1) / TEST_FRAGMENT_LENGTH, "record count", size);
+}
+
+
+/* Send a handshake message longer than the limit from the client, as a long Certificate message
+   would be, and check on the TCP stream that it goes out as handshake records of at most the limit.
+   With AES-CBC each record carries the IV, the MAC and 1 to 16 bytes of padding.  */
+
+static VOID test_handshake(ULONG size)
+{
+NX_PACKET  *packet_ptr;
+ULONG       expected = 0;
+ULONG       received = 0;
+ULONG       offset;
+ULONG       fragment_length;
+ULONG       record_length;
+ULONG       bytes_copied;
+UINT        records = 0;
+UINT        status;
+
+    packet_ptr = test_data_build(size, 0, TEST_PAYLOAD_SIZE);
+    if (packet_ptr == NX_NULL)
+    {
+        test_check(NX_FALSE, "packet allocate", size);
+        return;
+    }
+
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+    status = _nx_secure_tls_send_record(&test_sessions[0], packet_ptr, NX_SECURE_TLS_HANDSHAKE, NX_NO_WAIT);
+    tx_mutex_put(&_nx_secure_tls_protection);
+    test_check(status == NX_SUCCESS, "handshake send", size);
+    if (status != NX_SUCCESS)
+    {
+        nx_packet_release(packet_ptr);
+        return;
+    }
+
+    for (offset = 0; offset < size; offset += TEST_FRAGMENT_LENGTH)
+    {
+        fragment_length = ((size - offset) > TEST_FRAGMENT_LENGTH) ? TEST_FRAGMENT_LENGTH : (size - offset);
+        expected += 5 + TEST_IV_SIZE + ((fragment_length + TEST_MAC_SIZE) / 16 + 1) * 16;
+    }
+    test_check(expected <= sizeof(test_received), "record buffer", size);
+
+    while ((received < expected) && (expected <= sizeof(test_received)))
+    {
+        status = nx_tcp_socket_receive(&test_sockets[1], &packet_ptr, TEST_WAIT);
+        test_check(status == NX_SUCCESS, "handshake receive", size);
+        if (status != NX_SUCCESS)
+        {
+            return;
+        }
+        test_check(received + packet_ptr -> nx_packet_length <= expected, "handshake bytes", size);
+        if (received + packet_ptr -> nx_packet_length <= expected)
+        {
+            nx_packet_data_extract_offset(packet_ptr, 0, test_received + received,
+                                          packet_ptr -> nx_packet_length, &bytes_copied);
+        }
+        received += packet_ptr -> nx_packet_length;
+        nx_packet_release(packet_ptr);
+    }
+
+    /* Walk the record headers.  */
+    for (offset = 0; (received == expected) && (offset < expected); offset += 5 + record_length)
+    {
+        fragment_length = ((size - records * TEST_FRAGMENT_LENGTH) > TEST_FRAGMENT_LENGTH) ?
+                          TEST_FRAGMENT_LENGTH : (size - records * TEST_FRAGMENT_LENGTH);
+        record_length = ((ULONG)test_received[offset + 3] << 8) | test_received[offset + 4];
+        test_check(test_received[offset] == NX_SECURE_TLS_HANDSHAKE, "handshake record type", size);
+        test_check(record_length == TEST_IV_SIZE + ((fragment_length + TEST_MAC_SIZE) / 16 + 1) * 16,
+                   "handshake record length", size);
+        records++;
+    }
+
+    test_check(received == expected, "handshake received length", size);
+    test_check(records == (size + TEST_FRAGMENT_LENGTH - 1) / TEST_FRAGMENT_LENGTH, "handshake record count", size);
+}
+
+
+/* Send data from the client with a single packet left in the pool, so only the first record can
+   be built. The send must fail, the packet handed back must hold just the data that was not sent,
+   and the server must receive the first record whole.  */
+
+static VOID test_partial(VOID)
+{
+NX_PACKET  *packet_ptr;
+NX_PACKET  *held[TEST_PACKETS];
+ULONG       bytes_copied;
+UINT        held_count = 0;
+UINT        status;
+UINT        i;
+
+    packet_ptr = test_data_build(3000, 0, 700);
+    if (packet_ptr == NX_NULL)
+    {
+        test_check(NX_FALSE, "packet allocate", 3000);
+        return;
+    }
+
+    while ((test_pool.nx_packet_pool_available > 1) &&
+           (nx_packet_allocate(&test_pool, &held[held_count], NX_TCP_PACKET, NX_NO_WAIT) == NX_SUCCESS))
+    {
+        held_count++;
+    }
+
+    status = nx_secure_tls_session_send(&test_sessions[0], packet_ptr, NX_NO_WAIT);
+    test_check(status == NX_NO_PACKET, "partial send", 3000);
+    test_check(packet_ptr -> nx_packet_length == 3000 - TEST_FRAGMENT_LENGTH, "unsent length", 3000);
+    nx_packet_data_extract_offset(packet_ptr, 0, test_received, sizeof(test_received), &bytes_copied);
+    test_check((bytes_copied == 3000 - TEST_FRAGMENT_LENGTH) &&
+               (memcmp(test_received, test_data + TEST_FRAGMENT_LENGTH, bytes_copied) == 0), "unsent data", 3000);
+    nx_packet_release(packet_ptr);
+
+    for (i = 0; i < held_count; i++)
+    {
+        nx_packet_release(held[i]);
+    }
+
+    status = nx_secure_tls_session_receive(&test_sessions[1], &packet_ptr, TEST_WAIT);
+    test_check(status == NX_SUCCESS, "partial receive", 3000);
+    if (status == NX_SUCCESS)
+    {
+        nx_packet_data_extract_offset(packet_ptr, 0, test_received, sizeof(test_received), &bytes_copied);
+        test_check((bytes_copied == TEST_FRAGMENT_LENGTH) && (memcmp(test_received, test_data, bytes_copied) == 0),
+                   "sent record", 3000);
+        nx_packet_release(packet_ptr);
+    }
+}
+
+
+/* Send a record longer than the limit from the server, which the client must refuse with an
+   alert.  */
+
+static VOID test_overflow(VOID)
+{
+NX_PACKET  *packet_ptr;
+UINT        status;
+
+    packet_ptr = test_data_build(2000, 0, TEST_PAYLOAD_SIZE);
+    if (packet_ptr == NX_NULL)
+    {
+        test_check(NX_FALSE, "packet allocate", 2000);
+        return;
+    }
+
+    status = nx_secure_tls_session_send(&test_sessions[1], packet_ptr, NX_NO_WAIT);
+    test_check(status == NX_SUCCESS, "server send", 2000);
+
+    status = nx_secure_tls_session_receive(&test_sessions[0], &packet_ptr, TEST_WAIT);
+    test_check(status == NX_SECURE_TLS_RECORD_OVERFLOW, "oversize record", 2000);
+
+    status = nx_secure_tls_session_receive(&test_sessions[1], &packet_ptr, TEST_WAIT);
+    test_check(status == NX_SECURE_TLS_ALERT_RECEIVED, "alert", 2000);
+    test_check(test_sessions[1].nx_secure_tls_received_alert_value == NX_SECURE_TLS_ALERT_RECORD_OVERFLOW,
+               "record_overflow alert", 2000);
+
+    /* Both sessions were reset by the alert, so ending them only releases the records they hold.  */
+    nx_secure_tls_session_end(&test_sessions[0], NX_NO_WAIT);
+    nx_secure_tls_session_end(&test_sessions[1], NX_NO_WAIT);
+}
+
+
+static VOID test_entry(ULONG thread_input)
+{
+ULONG   available;
+UINT    i;
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    test_ciphersuite.nx_secure_tls_session_cipher = &crypto_method_aes_cbc_128;
+    test_ciphersuite.nx_secure_tls_hash = &crypto_method_hmac_sha256;
+    test_ciphersuite.nx_secure_tls_hash_size = TEST_MAC_SIZE;
+    for (i = 0; i < TEST_DATA_SIZE; i++)
+    {
+        test_data[i] = (UCHAR)(i * 31 + 7);
+    }
+
+    nx_secure_tls_initialize();
+    nx_wifi_loopback_connect(&test_ip, &test_pool, &test_sockets[0], &test_sockets[1]);
+    test_session_setup(0, NX_SECURE_TLS_SESSION_TYPE_CLIENT);
+    test_session_setup(1, NX_SECURE_TLS_SESSION_TYPE_SERVER);
+    test_sessions[0].nx_secure_tls_max_fragment_length = TEST_FRAGMENT_LENGTH;
+    available = test_pool.nx_packet_pool_available;
+
+    test_split(100, TEST_PAYLOAD_SIZE);
+    test_split(TEST_FRAGMENT_LENGTH, TEST_PAYLOAD_SIZE);
+    test_split(TEST_FRAGMENT_LENGTH + 1, TEST_PAYLOAD_SIZE);
+    test_split(3000, TEST_PAYLOAD_SIZE);
+    test_split(3000, 700);
+    test_split(TEST_DATA_SIZE, 333);
+    test_check(test_pool.nx_packet_pool_available == available, "packets released after sends", 0);
+
+    test_sessions_restart();
+    test_handshake(3000);
+    test_check(test_pool.nx_packet_pool_available == available, "packets released after handshake", 0);
+
+    test_sessions_restart();
+    test_partial();
+    test_check(test_pool.nx_packet_pool_available == available, "packets released after partial send", 0);
+
+    test_sessions_restart();
+    test_overflow();
+    test_check(test_pool.nx_packet_pool_available == available, "packets released after overflow", 0);
+
+    if (test_failures)
+    {
+        printf("nx_secure_tls_max_fragment_length_test: %u checks failed\n", test_failures);
+        exit(1);
+    }
+    printf("nx_secure_tls_max_fragment_length_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    NX_PARAMETER_NOT_USED(first_unused_memory);
+
+    nx_system_initialize();
+    nx_packet_pool_create(&test_pool, "test", TEST_PACKET_SIZE, test_pool_area, sizeof(test_pool_area));
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
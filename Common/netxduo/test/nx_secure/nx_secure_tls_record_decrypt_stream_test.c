@@ -0,0 +1,621 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks _nx_secure_tls_record_payload_decrypt_stream, built with
+   NX_SECURE_TLS_ENABLE_STREAMING_DECRYPT, against _nx_secure_tls_record_payload_decrypt. AES-128-CBC
+   records with an HMAC-SHA256 MAC and AES-128-GCM records of 1 to 16000 bytes are decrypted once
+   after the whole record has been reassembled from 1460-byte TCP segments. They are also decrypted
+   segment by segment as the receive path does, with segments of 1460, 100 and 7 bytes and the
+   ciphertext not yet consumed handed back on the next call. Both must give the plaintext, and for
+   CBC the MAC, that were sent. For 1460-byte segments, the most packets in use at once and the time
+   spent after the last segment arrives are reported.
+   Records are then sent in segments through the TCP loopback to a session that receives them with
+   nx_secure_tls_session_receive. An intact record must arrive whole. A CBC record with a flipped MAC
+   byte, a CBC record with bad padding and a GCM record with a flipped tag byte must be refused with
+   NX_SECURE_TLS_HASH_MAC_VERIFY_FAILURE, NX_SECURE_TLS_PADDING_CHECK_FAILED and
+   NX_SECURE_TLS_AEAD_DECRYPT_FAIL. None of their plaintext may be returned or kept in the session,
+   and no packet may be left allocated once the session is ended.  */
+
+#include "tx_api.h"
+#include "nx_secure_tls_api.h"
+#include "nx_wifi_loopback.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+#define TEST_IV_SIZE            16
+#define TEST_NONCE_SIZE         8           /* Explicit nonce of a GCM record.  */
+#define TEST_MAC_SIZE           32
+#define TEST_TAG_SIZE           16
+#define TEST_HEADER_SIZE        5
+#define TEST_MAX_RECORD         16000
+#define TEST_MAX_CIPHERTEXT     (TEST_HEADER_SIZE + TEST_IV_SIZE + TEST_MAX_RECORD + TEST_MAC_SIZE + 16)
+#define TEST_PACKET_SIZE        1536
+#define TEST_PACKETS            48
+#define TEST_ROUNDS             100
+#define TEST_STACK_SIZE         16384
+
+
+extern NX_CRYPTO_METHOD crypto_method_aes_cbc_128;
+extern NX_CRYPTO_METHOD crypto_method_aes_128_gcm_16;
+extern NX_CRYPTO_METHOD crypto_method_hmac_sha256;
+extern NX_CRYPTO_METHOD crypto_method_null;
+
+static const ULONG      test_sizes[] = { 1, 100, 1024, 4096, TEST_MAX_RECORD };
+static const ULONG      test_segment_sizes[] = { 1460, 100, 7 };
+static const UCHAR      test_key[16] =
+{
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10
+};
+
+static UINT                             test_failures;
+static NX_SECURE_TLS_CIPHERSUITE_INFO   test_ciphersuite;
+static ULONG                            test_cipher_metadata[2][2][4096 / sizeof(ULONG)];
+static ULONG                            test_hash_metadata[2][4096 / sizeof(ULONG)];
+static NX_SECURE_TLS_SESSION            test_sessions[2];
+static NX_IP                            test_ip;
+static NX_PACKET_POOL                   test_pool;
+static ULONG                            test_pool_area[TEST_PACKETS * (TEST_PACKET_SIZE + sizeof(NX_PACKET)) / sizeof(ULONG)];
+static ULONG                            test_pool_low;
+static UCHAR                            test_plaintext[TEST_MAX_RECORD];
+static UCHAR                            test_ciphertext[TEST_MAX_CIPHERTEXT];
+static UCHAR                            test_decrypted[TEST_MAX_CIPHERTEXT];
+static NX_TCP_SOCKET                    test_sockets[2];
+static UCHAR                            test_packet_buffer[4096];
+static TX_THREAD                        test_thread;
+static ULONG                            test_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+
+
+static VOID test_check(UINT condition, const CHAR *name, ULONG size, ULONG segment_size)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s, %s, %u bytes in %u-byte segments\n", name,
+               (test_ciphersuite.nx_secure_tls_hash_size) ? "CBC" : "GCM", size, segment_size);
+        test_failures++;
+    }
+}
+
+
+/* Use AES-128-CBC with HMAC-SHA256, or AES-128-GCM.  */
+
+static VOID test_cipher_select(UINT gcm)
+{
+
+    if (gcm)
+    {
+        test_ciphersuite.nx_secure_tls_session_cipher = &crypto_method_aes_128_gcm_16;
+        test_ciphersuite.nx_secure_tls_hash = &crypto_method_null;
+        test_ciphersuite.nx_secure_tls_hash_size = 0;
+    }
+    else
+    {
+        test_ciphersuite.nx_secure_tls_session_cipher = &crypto_method_aes_cbc_128;
+        test_ciphersuite.nx_secure_tls_hash = &crypto_method_hmac_sha256;
+        test_ciphersuite.nx_secure_tls_hash_size = TEST_MAC_SIZE;
+    }
+}
+
+
+/* Set up a TLS 1.2 session with the selected cipher, with the same fixed keys in both
+   directions.  */
+
+static VOID test_session_setup(UINT index, UINT socket_type)
+{
+NX_SECURE_TLS_SESSION      *session = &test_sessions[index];
+NX_SECURE_TLS_KEY_MATERIAL *keys = &session -> nx_secure_tls_key_material;
+NX_CRYPTO_METHOD           *cipher = (NX_CRYPTO_METHOD *)test_ciphersuite.nx_secure_tls_session_cipher;
+
+    memset(session, 0, sizeof(NX_SECURE_TLS_SESSION));
+    session -> nx_secure_tls_socket_type = (UCHAR)socket_type;
+    session -> nx_secure_tls_protocol_version = NX_SECURE_TLS_VERSION_TLS_1_2;
+    session -> nx_secure_tls_packet_pool = &test_pool;
+    session -> nx_secure_tls_session_ciphersuite = &test_ciphersuite;
+    session -> nx_secure_session_cipher_metadata_area_client = test_cipher_metadata[index][0];
+    session -> nx_secure_session_cipher_metadata_area_server = test_cipher_metadata[index][1];
+    session -> nx_secure_session_cipher_metadata_size = sizeof(test_cipher_metadata[index][0]);
+    session -> nx_secure_hash_mac_metadata_area = test_hash_metadata[index];
+    session -> nx_secure_hash_mac_metadata_size = sizeof(test_hash_metadata[index]);
+
+    keys -> nx_secure_tls_client_write_mac_secret = keys -> nx_secure_tls_key_material_data;
+    keys -> nx_secure_tls_server_write_mac_secret = keys -> nx_secure_tls_key_material_data + TEST_MAC_SIZE;
+    keys -> nx_secure_tls_client_iv = keys -> nx_secure_tls_key_material_data + (2 * TEST_MAC_SIZE);
+    keys -> nx_secure_tls_server_iv = keys -> nx_secure_tls_key_material_data + (2 * TEST_MAC_SIZE) + TEST_IV_SIZE;
+    memset(keys -> nx_secure_tls_key_material_data, 0x09, 2 * TEST_MAC_SIZE);
+    memset(keys -> nx_secure_tls_client_iv, 0x07, 2 * TEST_IV_SIZE);
+    cipher -> nx_crypto_init(cipher, (UCHAR *)test_key, 128, &session -> nx_secure_session_cipher_handler_client,
+                             test_cipher_metadata[index][0], sizeof(test_cipher_metadata[index][0]));
+    cipher -> nx_crypto_init(cipher, (UCHAR *)test_key, 128, &session -> nx_secure_session_cipher_handler_server,
+                             test_cipher_metadata[index][1], sizeof(test_cipher_metadata[index][1]));
+    session -> nx_secure_tls_local_session_active = NX_TRUE;
+    session -> nx_secure_tls_remote_session_active = NX_TRUE;
+}
+
+
+/* Note how few packets are left in the pool.  */
+
+static VOID test_pool_sample(VOID)
+{
+
+    if (test_pool.nx_packet_pool_available < test_pool_low)
+    {
+        test_pool_low = test_pool.nx_packet_pool_available;
+    }
+}
+
+
+/* Encrypt a record of the given size from the client and return its length. The explicit IV or
+   nonce is zero.  */
+
+static ULONG test_record_encrypt(ULONG size)
+{
+UCHAR       header[5] = { NX_SECURE_TLS_APPLICATION_DATA, 3, 3, (UCHAR)(size >> 8), (UCHAR)size };
+UCHAR       iv[TEST_IV_SIZE];
+UINT        iv_size = (test_ciphersuite.nx_secure_tls_hash_size) ? TEST_IV_SIZE : TEST_NONCE_SIZE;
+NX_PACKET  *packet_ptr;
+ULONG       length = 0;
+UINT        status;
+
+    test_session_setup(0, NX_SECURE_TLS_SESSION_TYPE_CLIENT);
+    memset(iv, 0, sizeof(iv));
+
+    status = nx_packet_allocate(&test_pool, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT);
+    if (status == NX_SUCCESS)
+    {
+        status = nx_packet_data_append(packet_ptr, iv, iv_size, &test_pool, NX_NO_WAIT);
+        if (status == NX_SUCCESS)
+        {
+            status = nx_packet_data_append(packet_ptr, test_plaintext, size, &test_pool, NX_NO_WAIT);
+        }
+
+        /* Encrypt under the TLS protection, as the send path does.  */
+        tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+        if ((status == NX_SUCCESS) && (test_ciphersuite.nx_secure_tls_hash_size))
+        {
+            status = _nx_secure_tls_record_payload_hash_encrypt(&test_sessions[0], packet_ptr, header,
+                                                                TEST_IV_SIZE, NX_NO_WAIT);
+        }
+        else if (status == NX_SUCCESS)
+        {
+
+            /* The tag is written behind the record.  */
+            status = _nx_secure_tls_record_payload_encrypt(&test_sessions[0], packet_ptr,
+                                                           test_sessions[0].nx_secure_tls_local_sequence_number,
+                                                           NX_SECURE_TLS_APPLICATION_DATA);
+        }
+        tx_mutex_put(&_nx_secure_tls_protection);
+        if (status == NX_SUCCESS)
+        {
+            length = packet_ptr -> nx_packet_length;
+            status = nx_packet_data_extract_offset(packet_ptr, 0, test_ciphertext, length, &length);
+        }
+        nx_packet_release(packet_ptr);
+    }
+
+    test_check(status == NX_SUCCESS, "encrypt", size, 0);
+    return(length);
+}
+
+
+/* Put bytes of the ciphertext into a chain of packets, as a TCP segment arrives.  */
+
+static NX_PACKET *test_segment_build(ULONG start, ULONG end)
+{
+NX_PACKET  *packet_ptr;
+
+    if (nx_packet_allocate(&test_pool, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT) != NX_SUCCESS)
+    {
+        return(NX_NULL);
+    }
+
+    if (nx_packet_data_append(packet_ptr, test_ciphertext + start, end - start, &test_pool, NX_NO_WAIT) != NX_SUCCESS)
+    {
+        nx_packet_release(packet_ptr);
+        return(NX_NULL);
+    }
+
+    return(packet_ptr);
+}
+
+
+static double test_time_get(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec * 1e9 + (double)now.tv_nsec);
+}
+
+
+/* Decrypt the record after all of its segments have arrived. Return the decrypted packet.  */
+
+static NX_PACKET *test_decrypt_reassembled(ULONG length, ULONG segment_size, double *tail_time)
+{
+NX_PACKET  *record_ptr = NX_NULL;
+NX_PACKET  *segment_ptr;
+NX_PACKET  *decrypted_ptr = NX_NULL;
+ULONG       offset;
+ULONG       end;
+double      start;
+UINT        status;
+
+    for (offset = 0; offset < length; offset = end)
+    {
+        end = (offset + segment_size > length) ? length : (offset + segment_size);
+        segment_ptr = test_segment_build(offset, end);
+        if (segment_ptr == NX_NULL)
+        {
+            break;
+        }
+
+        /* Chain the segment behind the ones already received.  */
+        if (record_ptr == NX_NULL)
+        {
+            record_ptr = segment_ptr;
+        }
+        else
+        {
+            if (record_ptr -> nx_packet_last)
+            {
+                record_ptr -> nx_packet_last -> nx_packet_next = segment_ptr;
+            }
+            else
+            {
+                record_ptr -> nx_packet_next = segment_ptr;
+            }
+            record_ptr -> nx_packet_last = (segment_ptr -> nx_packet_last) ? segment_ptr -> nx_packet_last : segment_ptr;
+            record_ptr -> nx_packet_length += segment_ptr -> nx_packet_length;
+        }
+        test_pool_sample();
+    }
+
+    if ((record_ptr == NX_NULL) || (record_ptr -> nx_packet_length != length))
+    {
+        test_check(NX_FALSE, "segment allocate", length, segment_size);
+        if (record_ptr)
+        {
+            nx_packet_release(record_ptr);
+        }
+        return(NX_NULL);
+    }
+
+    start = test_time_get();
+    status = _nx_secure_tls_record_payload_decrypt(&test_sessions[1], record_ptr, 0, (UINT)length, &decrypted_ptr,
+                                                   test_sessions[1].nx_secure_tls_remote_sequence_number,
+                                                   NX_SECURE_TLS_APPLICATION_DATA, NX_NO_WAIT);
+    *tail_time += test_time_get() - start;
+    test_pool_sample();
+    nx_packet_release(record_ptr);
+
+    test_check(status == NX_SUCCESS, "reassembled decrypt", length, segment_size);
+    if (status != NX_SUCCESS)
+    {
+        return(NX_NULL);
+    }
+
+    return(decrypted_ptr);
+}
+
+
+/* Decrypt the record segment by segment. Ciphertext that was not consumed is handed back with the
+   next segment, as the record queue keeps it. Return the decrypted packet.  */
+
+static NX_PACKET *test_decrypt_streamed(ULONG length, ULONG segment_size, double *tail_time)
+{
+NX_PACKET  *segment_ptr;
+NX_PACKET  *decrypted_ptr = NX_NULL;
+ULONG       consumed = 0;
+ULONG       end;
+UINT        bytes_processed;
+double      start = 0;
+UINT        status = NX_CONTINUE;
+
+    for (end = 0; (end < length) && (status == NX_CONTINUE);)
+    {
+        end = (end + segment_size > length) ? length : (end + segment_size);
+        segment_ptr = test_segment_build(consumed, end);
+        if (segment_ptr == NX_NULL)
+        {
+            test_check(NX_FALSE, "segment allocate", length, segment_size);
+            status = NX_NO_PACKET;
+            break;
+        }
+        test_pool_sample();
+
+        if (end == length)
+        {
+            start = test_time_get();
+        }
+        status = _nx_secure_tls_record_payload_decrypt_stream(&test_sessions[1], segment_ptr, 0, (UINT)(end - consumed),
+                                                              (UINT)(length - consumed), &decrypted_ptr,
+                                                              test_sessions[1].nx_secure_tls_remote_sequence_number,
+                                                              NX_SECURE_TLS_APPLICATION_DATA, &bytes_processed, NX_NO_WAIT);
+        if (end == length)
+        {
+            *tail_time += test_time_get() - start;
+        }
+        test_pool_sample();
+        consumed += bytes_processed;
+        nx_packet_release(segment_ptr);
+    }
+
+    test_check(status == NX_SUCCESS, "streamed decrypt", length, segment_size);
+    if (status != NX_SUCCESS)
+    {
+        if (test_sessions[1].nx_secure_record_stream_packet)
+        {
+            nx_packet_release(test_sessions[1].nx_secure_record_stream_packet);
+            test_sessions[1].nx_secure_record_stream_packet = NX_NULL;
+        }
+        return(NX_NULL);
+    }
+
+    return(decrypted_ptr);
+}
+
+
+/* Decrypt a record both ways and check the output. Return the most packets in use at once and the
+   time spent after the last segment arrived.  */
+
+static VOID test_compare(ULONG size, ULONG segment_size, UINT streamed, ULONG *packets, double *tail_time)
+{
+NX_PACKET  *decrypted_ptr;
+ULONG       length;
+ULONG       bytes_copied;
+
+    length = test_record_encrypt(size);
+    if (length == 0)
+    {
+        return;
+    }
+
+    test_session_setup(1, NX_SECURE_TLS_SESSION_TYPE_SERVER);
+    test_pool_low = test_pool.nx_packet_pool_available;
+    if (streamed)
+    {
+        decrypted_ptr = test_decrypt_streamed(length, segment_size, tail_time);
+    }
+    else
+    {
+        decrypted_ptr = test_decrypt_reassembled(length, segment_size, tail_time);
+    }
+    if (test_pool.nx_packet_pool_total - test_pool_low > *packets)
+    {
+        *packets = test_pool.nx_packet_pool_total - test_pool_low;
+    }
+    if (decrypted_ptr == NX_NULL)
+    {
+        return;
+    }
+
+    /* The padding or tag has been removed; the plaintext and any MAC are left.  */
+    test_check(decrypted_ptr -> nx_packet_length == size + test_ciphersuite.nx_secure_tls_hash_size,
+               streamed ? "streamed length" : "reassembled length", size, segment_size);
+    if (decrypted_ptr -> nx_packet_length == size + test_ciphersuite.nx_secure_tls_hash_size)
+    {
+        nx_packet_data_extract_offset(decrypted_ptr, 0, test_decrypted, size, &bytes_copied);
+        test_check(memcmp(test_decrypted, test_plaintext, size) == 0,
+                   streamed ? "streamed plaintext" : "reassembled plaintext", size, segment_size);
+    }
+    nx_packet_release(decrypted_ptr);
+}
+
+
+/* Send a record in segments from the raw client socket, with a byte of its ciphertext flipped
+   unless tamper_offset is beyond it, and receive it on a server session. Check the status, that the
+   plaintext is returned only for an intact record, and that no packet is held once the session is
+   ended.  */
+
+static VOID test_receive(const CHAR *name, ULONG size, ULONG segment_size, ULONG tamper_offset, UINT expected)
+{
+NX_SECURE_TLS_SESSION  *session = &test_sessions[1];
+NX_PACKET              *packet_ptr;
+ULONG                   available;
+ULONG                   length;
+ULONG                   offset;
+ULONG                   end;
+ULONG                   bytes_copied;
+UINT                    status;
+
+    length = test_record_encrypt(size);
+    if (length == 0)
+    {
+        return;
+    }
+    if (tamper_offset < length)
+    {
+        test_ciphertext[tamper_offset] ^= 0x01;
+    }
+
+    /* The session takes the server end of the loopback, with the handshake finished.  */
+    test_session_setup(1, NX_SECURE_TLS_SESSION_TYPE_SERVER);
+    tx_mutex_create(&session -> nx_secure_tls_session_transmit_mutex, "test", TX_NO_INHERIT);
+    session -> nx_secure_tls_id = NX_SECURE_TLS_ID;
+    session -> nx_secure_tls_server_state = NX_SECURE_TLS_SERVER_STATE_HANDSHAKE_FINISHED;
+    session -> nx_secure_tls_tcp_socket = &test_sockets[1];
+    session -> nx_secure_tls_packet_buffer = test_packet_buffer;
+    session -> nx_secure_tls_packet_buffer_size = sizeof(test_packet_buffer);
+    available = test_pool.nx_packet_pool_available;
+
+    /* The header goes out in the first segment.  */
+    memmove(test_ciphertext + TEST_HEADER_SIZE, test_ciphertext, length);
+    test_ciphertext[0] = NX_SECURE_TLS_APPLICATION_DATA;
+    test_ciphertext[1] = 3;
+    test_ciphertext[2] = 3;
+    test_ciphertext[3] = (UCHAR)(length >> 8);
+    test_ciphertext[4] = (UCHAR)length;
+    length += TEST_HEADER_SIZE;
+    for (offset = 0; offset < length; offset = end)
+    {
+        end = (offset + segment_size > length) ? length : (offset + segment_size);
+        packet_ptr = test_segment_build(offset, end);
+        if ((packet_ptr == NX_NULL) || (nx_tcp_socket_send(&test_sockets[0], packet_ptr, NX_NO_WAIT) != NX_SUCCESS))
+        {
+            test_check(NX_FALSE, "segment send", size, segment_size);
+            if (packet_ptr)
+            {
+                nx_packet_release(packet_ptr);
+            }
+            break;
+        }
+    }
+
+    packet_ptr = NX_NULL;
+    status = nx_secure_tls_session_receive(session, &packet_ptr, NX_NO_WAIT);
+    test_check(status == expected, name, size, segment_size);
+    if (status == NX_SUCCESS)
+    {
+        test_check((packet_ptr != NX_NULL) && (packet_ptr -> nx_packet_length == size), "received length",
+                   size, segment_size);
+        if ((packet_ptr != NX_NULL) && (packet_ptr -> nx_packet_length == size))
+        {
+            nx_packet_data_extract_offset(packet_ptr, 0, test_decrypted, size, &bytes_copied);
+            test_check(memcmp(test_decrypted, test_plaintext, size) == 0, "received plaintext", size, segment_size);
+        }
+    }
+    else
+    {
+        test_check(packet_ptr == NX_NULL, "no plaintext returned", size, segment_size);
+        test_check((session -> nx_secure_record_decrypted_packet == NX_NULL) &&
+                   (session -> nx_secure_record_stream_packet == NX_NULL), "no plaintext kept", size, segment_size);
+    }
+    if (packet_ptr)
+    {
+        nx_packet_release(packet_ptr);
+    }
+
+    /* Drop the alert and close_notify sent back to the client.  */
+    nx_secure_tls_session_end(session, NX_NO_WAIT);
+    while (nx_tcp_socket_receive(&test_sockets[0], &packet_ptr, NX_NO_WAIT) == NX_SUCCESS)
+    {
+        nx_packet_release(packet_ptr);
+    }
+    tx_mutex_delete(&session -> nx_secure_tls_session_transmit_mutex);
+    test_check(test_pool.nx_packet_pool_available == available, "packets released after receive", size, segment_size);
+}
+
+
+static VOID test_entry(ULONG thread_input)
+{
+ULONG   packets[2];
+double  tail_times[2];
+ULONG   available;
+ULONG   length;
+UINT    gcm;
+UINT    i;
+UINT    j;
+UINT    round;
+UINT    streamed;
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    for (i = 0; i < TEST_MAX_RECORD; i++)
+    {
+        test_plaintext[i] = (UCHAR)(i * 31 + 7);
+    }
+    nx_secure_tls_initialize();
+    nx_wifi_loopback_connect(&test_ip, &test_pool, &test_sockets[0], &test_sockets[1]);
+    available = test_pool.nx_packet_pool_available;
+
+    for (gcm = 0; gcm < 2; gcm++)
+    {
+        test_cipher_select(gcm);
+        packets[0] = packets[1] = 0;
+        tail_times[0] = tail_times[1] = 0;
+        for (i = 0; i < sizeof(test_sizes) / sizeof(test_sizes[0]); i++)
+        {
+            test_compare(test_sizes[i], test_segment_sizes[0], NX_FALSE, &packets[0], &tail_times[0]);
+            for (j = 0; j < sizeof(test_segment_sizes) / sizeof(test_segment_sizes[0]); j++)
+            {
+                test_compare(test_sizes[i], test_segment_sizes[j], NX_TRUE, &packets[1], &tail_times[1]);
+            }
+            test_check(test_pool.nx_packet_pool_available == available, "packets released", test_sizes[i], 0);
+        }
+
+        /* Report for full-size TCP segments.  */
+        for (i = 0; i < sizeof(test_sizes) / sizeof(test_sizes[0]); i++)
+        {
+            for (streamed = 0; streamed < 2; streamed++)
+            {
+                packets[streamed] = 0;
+                tail_times[streamed] = 0;
+                for (round = 0; round < TEST_ROUNDS; round++)
+                {
+                    test_compare(test_sizes[i], test_segment_sizes[0], streamed, &packets[streamed], &tail_times[streamed]);
+                }
+            }
+            printf("%s %5u-byte record: reassembled %2u packets, %7.0f ns after the last segment; "
+                   "streamed %2u packets, %7.0f ns\n", (gcm) ? "GCM" : "CBC", test_sizes[i],
+                   packets[0], tail_times[0] / TEST_ROUNDS, packets[1], tail_times[1] / TEST_ROUNDS);
+        }
+    }
+
+    /* Whole and tampered records through the receive path, the long ones in full-size segments only
+       as all segments are queued before the receive. A CBC record of 100 bytes ends with the
+       32-byte MAC and 12 bytes of padding. Flipping a ciphertext byte flips the same byte of the
+       next plaintext block, so the last MAC byte, or the padding length byte, is changed through
+       the block before it.  */
+    for (j = 0; j < sizeof(test_segment_sizes) / sizeof(test_segment_sizes[0]); j++)
+    {
+        test_cipher_select(NX_FALSE);
+        length = TEST_IV_SIZE + 100 + TEST_MAC_SIZE + 12;
+        test_receive("intact record", 100, test_segment_sizes[j], length, NX_SUCCESS);
+        test_receive("tampered MAC", 100, test_segment_sizes[j], TEST_IV_SIZE + 100 + TEST_MAC_SIZE - 1 - 16,
+                     NX_SECURE_TLS_HASH_MAC_VERIFY_FAILURE);
+        test_receive("bad padding", 100, test_segment_sizes[j], length - 1 - 16, NX_SECURE_TLS_PADDING_CHECK_FAILED);
+
+        test_cipher_select(NX_TRUE);
+        length = TEST_NONCE_SIZE + 100 + TEST_TAG_SIZE;
+        test_receive("intact record", 100, test_segment_sizes[j], length, NX_SUCCESS);
+        test_receive("tampered tag", 100, test_segment_sizes[j], length - 1, NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
+    }
+    test_cipher_select(NX_FALSE);
+    length = TEST_IV_SIZE + TEST_MAX_RECORD + TEST_MAC_SIZE + 16;
+    test_receive("intact record", TEST_MAX_RECORD, test_segment_sizes[0], length, NX_SUCCESS);
+    test_receive("tampered MAC", TEST_MAX_RECORD, test_segment_sizes[0], length - 16 - 1 - 16,
+                 NX_SECURE_TLS_HASH_MAC_VERIFY_FAILURE);
+    test_receive("bad padding", TEST_MAX_RECORD, test_segment_sizes[0], length - 1 - 16,
+                 NX_SECURE_TLS_PADDING_CHECK_FAILED);
+    test_cipher_select(NX_TRUE);
+    length = TEST_NONCE_SIZE + TEST_MAX_RECORD + TEST_TAG_SIZE;
+    test_receive("intact record", TEST_MAX_RECORD, test_segment_sizes[0], length, NX_SUCCESS);
+    test_receive("tampered tag", TEST_MAX_RECORD, test_segment_sizes[0], length - 1, NX_SECURE_TLS_AEAD_DECRYPT_FAIL);
+
+    if (test_failures)
+    {
+        printf("nx_secure_tls_record_decrypt_stream_test: %u checks failed\n", test_failures);
+        exit(1);
+    }
+    printf("nx_secure_tls_record_decrypt_stream_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    NX_PARAMETER_NOT_USED(first_unused_memory);
+
+    nx_system_initialize();
+    nx_packet_pool_create(&test_pool, "test", TEST_PACKET_SIZE, test_pool_area, sizeof(test_pool_area));
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
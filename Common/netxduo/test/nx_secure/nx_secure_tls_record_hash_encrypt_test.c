@@ -0,0 +1,348 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks _nx_secure_tls_record_payload_hash_encrypt, which MACs and encrypts an AES-CBC
+   record in one pass over the packet chain, against the two passes it replaces in
+   _nx_secure_tls_send_record: the record MAC over the chain, appended, then
+   _nx_secure_tls_record_payload_encrypt. Records of 1 to 8192 bytes are built in one packet for the
+   two passes and split unevenly over 1 to 6 packets for the single pass, so cipher blocks straddle
+   packets. The records, with explicit IV, MAC and padding, and the session IV left for the next
+   record must be identical. The time per record of both paths is reported.  */
+
+#include "tx_api.h"
+#include "nx_secure_tls.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+#define TEST_IV_SIZE            16
+#define TEST_MAC_SIZE           32
+#define TEST_MAX_RECORD         8192
+#define TEST_PACKET_SIZE        (TEST_MAX_RECORD + 256)
+#define TEST_PACKETS            16
+#define TEST_MAX_SPLIT          6
+#define TEST_ROUNDS             500
+#define TEST_STACK_SIZE         4096
+
+
+extern NX_CRYPTO_METHOD crypto_method_aes_cbc_128;
+extern NX_CRYPTO_METHOD crypto_method_hmac_sha256;
+
+static const ULONG      test_sizes[] = { 1, 15, 16, 17, 255, 256, 1000, 4096, TEST_MAX_RECORD };
+static const UCHAR      test_key[16] =
+{
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10
+};
+
+static UINT                             test_failures;
+static NX_SECURE_TLS_CIPHERSUITE_INFO   test_ciphersuite;
+static ULONG                            test_cipher_metadata[2][4096 / sizeof(ULONG)];
+static ULONG                            test_hash_metadata[2][4096 / sizeof(ULONG)];
+static NX_SECURE_TLS_SESSION            test_sessions[2];
+static NX_PACKET_POOL                   test_pool;
+static ULONG                            test_pool_area[TEST_PACKETS * (TEST_PACKET_SIZE + sizeof(NX_PACKET)) / sizeof(ULONG)];
+static UCHAR                            test_plaintext[TEST_MAX_RECORD];
+static UCHAR                            test_records[2][TEST_MAX_RECORD + 256];
+static TX_THREAD                        test_thread;
+static ULONG                            test_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+
+
+static VOID test_check(UINT condition, const CHAR *name, ULONG size, UINT packets)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s, %u bytes in %u packets\n", name, size, packets);
+        test_failures++;
+    }
+}
+
+
+/* Set up a TLS 1.2 client session with AES-128-CBC and HMAC-SHA256, with fixed keys.  */
+
+static VOID test_session_setup(UINT index)
+{
+NX_SECURE_TLS_SESSION *session = &test_sessions[index];
+
+    memset(session, 0, sizeof(NX_SECURE_TLS_SESSION));
+    session -> nx_secure_tls_session_ciphersuite = &test_ciphersuite;
+    session -> nx_secure_tls_socket_type = NX_SECURE_TLS_SESSION_TYPE_CLIENT;
+    session -> nx_secure_tls_protocol_version = NX_SECURE_TLS_VERSION_TLS_1_2;
+    session -> nx_secure_tls_packet_pool = &test_pool;
+    session -> nx_secure_session_cipher_metadata_area_client = test_cipher_metadata[index];
+    session -> nx_secure_session_cipher_metadata_size = sizeof(test_cipher_metadata[index]);
+    session -> nx_secure_hash_mac_metadata_area = test_hash_metadata[index];
+    session -> nx_secure_hash_mac_metadata_size = sizeof(test_hash_metadata[index]);
+    session -> nx_secure_tls_key_material.nx_secure_tls_client_iv =
+        session -> nx_secure_tls_key_material.nx_secure_tls_key_material_data;
+    session -> nx_secure_tls_key_material.nx_secure_tls_client_write_mac_secret =
+        session -> nx_secure_tls_key_material.nx_secure_tls_key_material_data + TEST_IV_SIZE;
+    memset(session -> nx_secure_tls_key_material.nx_secure_tls_client_iv, 0x07, TEST_IV_SIZE);
+    memset(session -> nx_secure_tls_key_material.nx_secure_tls_client_write_mac_secret, 0x09, TEST_MAC_SIZE);
+    crypto_method_aes_cbc_128.nx_crypto_init(&crypto_method_aes_cbc_128, (UCHAR *)test_key, 128,
+                                             &session -> nx_secure_session_cipher_handler_client,
+                                             test_cipher_metadata[index], sizeof(test_cipher_metadata[index]));
+}
+
+
+/* Build a record of the given size behind an explicit IV of zeros, split over packets of
+   uneven size.  */
+
+static NX_PACKET *test_record_build(ULONG size, UINT packets)
+{
+NX_PACKET  *head = NX_NULL;
+NX_PACKET  *tail = NX_NULL;
+NX_PACKET  *packet_ptr;
+ULONG       offset = 0;
+ULONG       length;
+UINT        i;
+
+    for (i = 0; i < packets; i++)
+    {
+        if (nx_packet_allocate(&test_pool, &packet_ptr, NX_TCP_PACKET, NX_NO_WAIT) != NX_SUCCESS)
+        {
+            return(NX_NULL);
+        }
+
+        length = (i == packets - 1) ? (size - offset) : ((size / packets) + (i % 3));
+        if (length > size - offset)
+        {
+            length = size - offset;
+        }
+
+        if (i == 0)
+        {
+            memset(packet_ptr -> nx_packet_append_ptr, 0, TEST_IV_SIZE);
+            packet_ptr -> nx_packet_append_ptr += TEST_IV_SIZE;
+        }
+        memcpy(packet_ptr -> nx_packet_append_ptr, test_plaintext + offset, length);
+        packet_ptr -> nx_packet_append_ptr += length;
+        offset += length;
+
+        if (head == NX_NULL)
+        {
+            head = packet_ptr;
+        }
+        else
+        {
+            tail -> nx_packet_next = packet_ptr;
+        }
+        tail = packet_ptr;
+    }
+
+    head -> nx_packet_last = tail;
+    head -> nx_packet_length = size + TEST_IV_SIZE;
+
+    return(head);
+}
+
+
+/* Hash and encrypt a record in two passes, as _nx_secure_tls_send_record does for other ciphers.  */
+
+static UINT test_two_pass(NX_SECURE_TLS_SESSION *session, NX_PACKET *packet_ptr, UCHAR *header)
+{
+NX_PACKET  *current_packet = packet_ptr;
+UCHAR       mac[TEST_MAC_SIZE];
+UINT        hash_length;
+UCHAR      *data;
+UINT        status;
+
+    status = _nx_secure_tls_record_hash_initialize(session, session -> nx_secure_tls_local_sequence_number,
+                                                   header, 5, &hash_length,
+                                                   session -> nx_secure_tls_key_material.nx_secure_tls_client_write_mac_secret);
+    data = current_packet -> nx_packet_prepend_ptr + TEST_IV_SIZE;
+    while ((status == NX_SUCCESS) && (current_packet != NX_NULL))
+    {
+        status = _nx_secure_tls_record_hash_update(session, data,
+                                                   (UINT)(current_packet -> nx_packet_append_ptr - data));
+        current_packet = current_packet -> nx_packet_next;
+        if (current_packet)
+        {
+            data = current_packet -> nx_packet_prepend_ptr;
+        }
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = _nx_secure_tls_record_hash_calculate(session, mac, &hash_length);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_packet_data_append(packet_ptr, mac, hash_length, &test_pool, NX_NO_WAIT);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = _nx_secure_tls_record_payload_encrypt(session, packet_ptr, session -> nx_secure_tls_local_sequence_number,
+                                                       NX_SECURE_TLS_APPLICATION_DATA);
+    }
+
+    return(status);
+}
+
+
+static ULONG test_record_copy(NX_PACKET *packet_ptr, UCHAR *record)
+{
+ULONG   length = 0;
+
+    for (; packet_ptr != NX_NULL; packet_ptr = packet_ptr -> nx_packet_next)
+    {
+        memcpy(record + length, packet_ptr -> nx_packet_prepend_ptr,
+               (ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr));
+        length += (ULONG)(packet_ptr -> nx_packet_append_ptr - packet_ptr -> nx_packet_prepend_ptr);
+    }
+
+    return(length);
+}
+
+
+static VOID test_compare(ULONG size, UINT packets)
+{
+UCHAR       header[5] = { NX_SECURE_TLS_APPLICATION_DATA, 3, 3, (UCHAR)(size >> 8), (UCHAR)size };
+NX_PACKET  *packets_ptr[2];
+UINT        status[2];
+ULONG       length[2] = { 0, 0 };
+
+    test_session_setup(0);
+    test_session_setup(1);
+    packets_ptr[0] = test_record_build(size, 1);
+    packets_ptr[1] = test_record_build(size, packets);
+    if ((packets_ptr[0] == NX_NULL) || (packets_ptr[1] == NX_NULL))
+    {
+        test_check(NX_FALSE, "packet allocate", size, packets);
+        return;
+    }
+
+    status[0] = test_two_pass(&test_sessions[0], packets_ptr[0], header);
+    status[1] = _nx_secure_tls_record_payload_hash_encrypt(&test_sessions[1], packets_ptr[1], header, TEST_IV_SIZE, NX_NO_WAIT);
+    test_check(status[0] == NX_SUCCESS, "two-pass status", size, packets);
+    test_check(status[1] == NX_SUCCESS, "single-pass status", size, packets);
+
+    length[0] = test_record_copy(packets_ptr[0], test_records[0]);
+    length[1] = test_record_copy(packets_ptr[1], test_records[1]);
+    test_check((length[0] == length[1]) && (memcmp(test_records[0], test_records[1], length[0]) == 0),
+               "record", size, packets);
+    test_check(length[1] == packets_ptr[1] -> nx_packet_length, "record length", size, packets);
+    test_check(memcmp(test_sessions[0].nx_secure_tls_key_material.nx_secure_tls_client_iv,
+                      test_sessions[1].nx_secure_tls_key_material.nx_secure_tls_client_iv, TEST_IV_SIZE) == 0,
+               "next IV", size, packets);
+
+    nx_packet_release(packets_ptr[0]);
+    nx_packet_release(packets_ptr[1]);
+}
+
+
+static double test_time_get(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec * 1e9 + (double)now.tv_nsec);
+}
+
+
+/* Report the time per record of both paths, including the record build.  */
+
+static VOID test_timing(ULONG size, UINT packets)
+{
+UCHAR       header[5] = { NX_SECURE_TLS_APPLICATION_DATA, 3, 3, (UCHAR)(size >> 8), (UCHAR)size };
+NX_PACKET  *packet_ptr;
+double      times[2];
+double      start;
+UINT        path;
+UINT        round;
+
+    for (path = 0; path < 2; path++)
+    {
+        test_session_setup(path);
+        start = test_time_get();
+        for (round = 0; round < TEST_ROUNDS; round++)
+        {
+            packet_ptr = test_record_build(size, packets);
+            if (packet_ptr == NX_NULL)
+            {
+                test_check(NX_FALSE, "packet allocate", size, packets);
+                return;
+            }
+            if (path == 0)
+            {
+                test_two_pass(&test_sessions[path], packet_ptr, header);
+            }
+            else
+            {
+                _nx_secure_tls_record_payload_hash_encrypt(&test_sessions[path], packet_ptr, header,
+                                                           TEST_IV_SIZE, NX_NO_WAIT);
+            }
+            nx_packet_release(packet_ptr);
+        }
+        times[path] = (test_time_get() - start) / TEST_ROUNDS;
+    }
+
+    printf("%5u bytes in %u packets: two-pass %6.0f ns, single-pass %6.0f ns\n",
+           size, packets, times[0], times[1]);
+}
+
+
+static VOID test_entry(ULONG thread_input)
+{
+UINT    i;
+UINT    packets;
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    test_ciphersuite.nx_secure_tls_session_cipher = &crypto_method_aes_cbc_128;
+    test_ciphersuite.nx_secure_tls_hash = &crypto_method_hmac_sha256;
+    test_ciphersuite.nx_secure_tls_hash_size = TEST_MAC_SIZE;
+    for (i = 0; i < TEST_MAX_RECORD; i++)
+    {
+        test_plaintext[i] = (UCHAR)(i * 31 + 7);
+    }
+
+    for (i = 0; i < sizeof(test_sizes) / sizeof(test_sizes[0]); i++)
+    {
+        for (packets = 1; (packets <= TEST_MAX_SPLIT) && (packets <= test_sizes[i]); packets++)
+        {
+            test_compare(test_sizes[i], packets);
+        }
+    }
+
+    test_timing(256, 2);
+    test_timing(1024, 2);
+    test_timing(4096, TEST_MAX_SPLIT);
+    test_timing(TEST_MAX_RECORD, TEST_MAX_SPLIT);
+
+    if (test_failures)
+    {
+        printf("nx_secure_tls_record_hash_encrypt_test: %u checks failed\n", test_failures);
+        exit(1);
+    }
+    printf("nx_secure_tls_record_hash_encrypt_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    NX_PARAMETER_NOT_USED(first_unused_memory);
+
+    nx_system_initialize();
+    nx_packet_pool_create(&test_pool, "test", TEST_PACKET_SIZE, test_pool_area, sizeof(test_pool_area));
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
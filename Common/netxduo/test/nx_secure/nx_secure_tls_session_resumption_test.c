@@ -0,0 +1,662 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks client-side resumption of TLS 1.2 sessions by session ID (RFC 5246, Section
+   7.3) over the TCP loopback. The server issues a 32-byte session ID in every ServerHello. First a
+   full handshake runs: the client must store the ID, the master secret and the time of the session
+   time function in its resumption entry, and must not report the session as resumed. Then the
+   server echoes the ID and answers with ChangeCipherSpec and Finished only: the abbreviated
+   handshake must complete without the certificate callback, the session must be reported as
+   resumed, the client Finished must verify on the server, application data must arrive and the
+   entry must keep the time of the full handshake. Finally the server echoes the ID but goes on
+   with a Certificate: the client must fail with NX_SECURE_TLS_UNEXPECTED_MESSAGE and empty the
+   entry. The certificates are RSA-2048 with SHA-256.  */
+
+#include "tx_api.h"
+#include "nx_api.h"
+#include "nx_secure_tls_api.h"
+#include "nx_wifi_loopback.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+#define TEST_IP_ADDRESS         IP_ADDRESS(10, 0, 0, 1)
+#define TEST_PORT               4433
+#define TEST_PACKET_SIZE        1600
+#define TEST_PACKETS            64
+#define TEST_WAIT               (2 * NX_IP_PERIODIC_RATE)
+#define TEST_STACK_SIZE         16384
+#define TEST_TIME               1893456000UL        /* 2030-01-01, within the certificate validity.  */
+#define TEST_PHASES             3
+
+
+extern const NX_SECURE_TLS_CRYPTO nx_crypto_tls_ciphers;
+
+static const UCHAR      test_ca_der[] =
+{
+    0x30, 0x82, 0x03, 0x51, 0x30, 0x82, 0x02, 0x39, 0xa0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x14, 0x6e,
+    0xe9, 0xda, 0x10, 0xcf, 0xa8, 0x74, 0xcd, 0x99, 0x8a, 0xeb, 0xc0, 0xb4, 0xec, 0x6f, 0x97, 0xd7,
+    0x6b, 0x5b, 0x04, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b,
+    0x05, 0x00, 0x30, 0x30, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e,
+    0x65, 0x74, 0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x1a, 0x30, 0x18, 0x06, 0x03, 0x55, 0x04,
+    0x03, 0x0c, 0x11, 0x4e, 0x65, 0x74, 0x58, 0x20, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x6f,
+    0x72, 0x20, 0x43, 0x41, 0x30, 0x1e, 0x17, 0x0d, 0x32, 0x36, 0x31, 0x30, 0x31, 0x39, 0x31, 0x33,
+    0x34, 0x37, 0x33, 0x34, 0x5a, 0x17, 0x0d, 0x34, 0x36, 0x31, 0x30, 0x31, 0x34, 0x31, 0x33, 0x34,
+    0x37, 0x33, 0x34, 0x5a, 0x30, 0x30, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c,
+    0x09, 0x4e, 0x65, 0x74, 0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x1a, 0x30, 0x18, 0x06, 0x03,
+    0x55, 0x04, 0x03, 0x0c, 0x11, 0x4e, 0x65, 0x74, 0x58, 0x20, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63,
+    0x74, 0x6f, 0x72, 0x20, 0x43, 0x41, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86,
+    0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x0f, 0x00, 0x30, 0x82,
+    0x01, 0x0a, 0x02, 0x82, 0x01, 0x01, 0x00, 0xc4, 0xae, 0x97, 0x8d, 0xe6, 0x8f, 0x32, 0x7b, 0x36,
+    0x4e, 0xac, 0x79, 0x24, 0x58, 0x6f, 0xaf, 0xda, 0x2e, 0xba, 0x1b, 0x36, 0x6c, 0xa2, 0x49, 0x08,
+    0x35, 0xa9, 0x31, 0x5c, 0xa3, 0xb2, 0x1e, 0x53, 0xcd, 0xc8, 0x95, 0x21, 0x4b, 0x1c, 0x6e, 0x2f,
+    0x1d, 0xe1, 0xc4, 0x7e, 0x92, 0x5b, 0x40, 0x53, 0xd0, 0x96, 0xc7, 0x4d, 0xf3, 0xde, 0x66, 0xc8,
+    0x7f, 0xe7, 0xf5, 0xab, 0xdc, 0x13, 0x58, 0xe3, 0x40, 0x18, 0xbc, 0x65, 0x85, 0xcc, 0xe6, 0xdc,
+    0x18, 0x3b, 0x8f, 0x01, 0x4e, 0x5e, 0x3a, 0x6b, 0xce, 0x05, 0xcb, 0xf9, 0xd0, 0x9e, 0x9b, 0x2a,
+    0xa1, 0xeb, 0x3a, 0x23, 0xf5, 0x92, 0x4b, 0xf6, 0x86, 0x83, 0x73, 0x42, 0xd7, 0x52, 0xb7, 0xf7,
+    0x21, 0xde, 0x61, 0x18, 0x5c, 0xf6, 0x46, 0x2c, 0xce, 0xa2, 0x78, 0x84, 0xe1, 0xed, 0x48, 0xbb,
+    0x36, 0x0a, 0x6f, 0xdb, 0x74, 0x17, 0x8f, 0x12, 0xb9, 0x76, 0x8c, 0x4b, 0xa3, 0x06, 0x48, 0x21,
+    0x6f, 0x40, 0x0c, 0x4b, 0xcf, 0xb5, 0xba, 0x0d, 0x0d, 0xaf, 0x9d, 0x63, 0xeb, 0x8e, 0xea, 0x11,
+    0x70, 0x3c, 0x08, 0x7b, 0xa4, 0x0c, 0xea, 0x17, 0x88, 0x4a, 0x63, 0x88, 0xff, 0x40, 0x47, 0xb1,
+    0x2b, 0xbc, 0xb2, 0x30, 0x36, 0x9e, 0x6c, 0xb2, 0xbc, 0x0f, 0x9a, 0x36, 0xc3, 0xfa, 0x9e, 0xe6,
+    0x19, 0xc8, 0xee, 0x7d, 0x98, 0x0b, 0xd6, 0xa1, 0x11, 0xb6, 0xf3, 0xc4, 0x89, 0x2e, 0x1e, 0x75,
+    0xdf, 0xe0, 0xfe, 0x3f, 0xc0, 0x15, 0xa2, 0xf3, 0x62, 0x15, 0x9a, 0xf8, 0xa3, 0x90, 0x0f, 0x0b,
+    0x03, 0xb5, 0xca, 0xfb, 0x1e, 0x12, 0x35, 0xf6, 0xc1, 0x78, 0x5f, 0x5a, 0xb2, 0x0f, 0xd6, 0x33,
+    0xa6, 0xd5, 0x3c, 0xff, 0x43, 0x24, 0xea, 0xc9, 0x2a, 0x07, 0xe2, 0x84, 0xd2, 0x85, 0x2d, 0x83,
+    0x74, 0xd9, 0xdd, 0xa7, 0x40, 0x4d, 0x0d, 0x02, 0x03, 0x01, 0x00, 0x01, 0xa3, 0x63, 0x30, 0x61,
+    0x30, 0x1d, 0x06, 0x03, 0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0x9d, 0xee, 0xa5, 0xf6, 0x86,
+    0x95, 0xfb, 0x89, 0x46, 0xf3, 0x46, 0x8d, 0x59, 0xd3, 0x1b, 0xa0, 0x22, 0xe3, 0xfe, 0xc2, 0x30,
+    0x1f, 0x06, 0x03, 0x55, 0x1d, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x9d, 0xee, 0xa5, 0xf6,
+    0x86, 0x95, 0xfb, 0x89, 0x46, 0xf3, 0x46, 0x8d, 0x59, 0xd3, 0x1b, 0xa0, 0x22, 0xe3, 0xfe, 0xc2,
+    0x30, 0x0f, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x01, 0x01, 0xff, 0x04, 0x05, 0x30, 0x03, 0x01, 0x01,
+    0xff, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04, 0x04, 0x03, 0x02, 0x02,
+    0x04, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00,
+    0x03, 0x82, 0x01, 0x01, 0x00, 0x6c, 0x3f, 0x6b, 0xa8, 0x39, 0x08, 0xef, 0xdf, 0xd7, 0x15, 0xe3,
+    0x31, 0xbc, 0x94, 0x99, 0x1c, 0x07, 0x34, 0x9d, 0x87, 0x22, 0x6c, 0x6e, 0xde, 0x9a, 0x9d, 0x5f,
+    0x3d, 0x0f, 0x3a, 0x92, 0x67, 0xa4, 0xeb, 0x90, 0xf1, 0x4f, 0x46, 0x84, 0x16, 0x76, 0x4e, 0xbf,
+    0x75, 0x1a, 0xe4, 0x05, 0x84, 0xcd, 0x2a, 0x10, 0x1d, 0x47, 0xb5, 0xb5, 0x4b, 0x06, 0x58, 0x96,
+    0x83, 0xe1, 0x5e, 0xb4, 0x29, 0xe3, 0x43, 0x05, 0x33, 0x89, 0x63, 0xa3, 0xc3, 0x8a, 0x3e, 0x01,
+    0xab, 0x3a, 0x6f, 0x80, 0x36, 0x6d, 0x4e, 0x0f, 0xcc, 0xc5, 0x6f, 0x96, 0xc0, 0x8e, 0x94, 0xac,
+    0x38, 0xfb, 0xda, 0x4d, 0xd0, 0xc7, 0xc3, 0xe8, 0x43, 0xca, 0x45, 0xae, 0x3d, 0x7d, 0x96, 0x90,
+    0x9a, 0x68, 0x1c, 0x03, 0xf2, 0xe0, 0xc7, 0xc8, 0x34, 0x71, 0x9d, 0x35, 0x60, 0x42, 0xf8, 0x8e,
+    0x8a, 0x59, 0xb6, 0x08, 0x1f, 0xdb, 0x4b, 0xf1, 0xee, 0x5d, 0x2b, 0x98, 0x59, 0x6d, 0x82, 0x09,
+    0xbb, 0x57, 0xbd, 0x29, 0x1c, 0x0d, 0xf4, 0x9c, 0x15, 0xc8, 0xe1, 0xba, 0x5a, 0x93, 0xe9, 0xb8,
+    0xc8, 0x14, 0x27, 0x9e, 0xdb, 0x1a, 0xa7, 0xe5, 0xb2, 0xd2, 0xa4, 0x85, 0x8d, 0x1d, 0xf1, 0xd7,
+    0x91, 0xc8, 0x79, 0xc4, 0xb2, 0xbe, 0x85, 0x2d, 0x00, 0x4f, 0x03, 0x0f, 0xf4, 0xb0, 0x83, 0x75,
+    0x14, 0x3c, 0xb8, 0x88, 0x92, 0xdc, 0xf7, 0x6a, 0x7f, 0x66, 0xb0, 0x8b, 0x56, 0x5d, 0x8b, 0xfb,
+    0xce, 0xfd, 0x51, 0x30, 0x59, 0xa0, 0xad, 0x64, 0xc7, 0x15, 0x87, 0x7b, 0xa1, 0x2f, 0xfe, 0x69,
+    0x93, 0xc6, 0xa3, 0x92, 0x5e, 0xd1, 0x95, 0xdc, 0x25, 0x5b, 0x4b, 0xf6, 0x6b, 0xf5, 0xdb, 0x9d,
+    0xc3, 0x42, 0x76, 0x7a, 0x50, 0x96, 0xb8, 0xf8, 0xd1, 0x9a, 0x0c, 0x16, 0x40, 0x75, 0x62, 0x90,
+    0xab, 0x6d, 0xb3, 0x14, 0x8d
+};
+
+static const UCHAR      test_server_der[] =
+{
+    0x30, 0x82, 0x03, 0x5c, 0x30, 0x82, 0x02, 0x44, 0xa0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x30,
+    0x30, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65, 0x74, 0x58,
+    0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x1a, 0x30, 0x18, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x11,
+    0x4e, 0x65, 0x74, 0x58, 0x20, 0x43, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x43,
+    0x41, 0x30, 0x1e, 0x17, 0x0d, 0x32, 0x36, 0x31, 0x30, 0x31, 0x39, 0x31, 0x33, 0x34, 0x37, 0x33,
+    0x35, 0x5a, 0x17, 0x0d, 0x34, 0x36, 0x31, 0x30, 0x31, 0x34, 0x31, 0x33, 0x34, 0x37, 0x33, 0x35,
+    0x5a, 0x30, 0x2d, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65,
+    0x74, 0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x17, 0x30, 0x15, 0x06, 0x03, 0x55, 0x04, 0x03,
+    0x0c, 0x0e, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2e, 0x74, 0x65, 0x73, 0x74,
+    0x30, 0x82, 0x01, 0x22, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01,
+    0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x0f, 0x00, 0x30, 0x82, 0x01, 0x0a, 0x02, 0x82, 0x01, 0x01,
+    0x00, 0xca, 0xe0, 0xdf, 0xbf, 0x89, 0xde, 0x3c, 0xcd, 0x1b, 0xcb, 0x12, 0x80, 0x95, 0x18, 0xb7,
+    0xee, 0xc4, 0x67, 0x9f, 0xf1, 0x7f, 0x51, 0x3c, 0x22, 0xcb, 0x40, 0x10, 0x39, 0xbc, 0xce, 0x57,
+    0xa9, 0x17, 0xcc, 0xc8, 0x45, 0x35, 0x36, 0xba, 0x12, 0x96, 0xa0, 0x80, 0xd3, 0x8f, 0xe3, 0x0d,
+    0x1c, 0xd9, 0x18, 0x4a, 0x6a, 0x4b, 0xd1, 0x59, 0xcf, 0x21, 0x2d, 0x5b, 0xce, 0x1a, 0x80, 0xc7,
+    0xbf, 0xe9, 0x7d, 0x07, 0x2a, 0x4a, 0xf4, 0xaa, 0x0e, 0xf6, 0x11, 0xbf, 0x2c, 0x9f, 0x50, 0xfb,
+    0x5e, 0xc6, 0xab, 0x23, 0x0a, 0x2c, 0x96, 0xdb, 0x08, 0x96, 0x93, 0xb3, 0x37, 0x8e, 0xa1, 0x93,
+    0xcf, 0x8c, 0x6a, 0xc7, 0xd3, 0xa2, 0xb5, 0xc2, 0xab, 0xb5, 0x5d, 0x20, 0x70, 0x42, 0x0a, 0xc6,
+    0x60, 0x59, 0x4b, 0xce, 0xce, 0xac, 0x17, 0x7f, 0x7b, 0x58, 0x3a, 0x61, 0x9b, 0x19, 0x04, 0x61,
+    0x87, 0x94, 0x39, 0x25, 0x11, 0xb2, 0x15, 0x4d, 0x1b, 0xcb, 0x20, 0x41, 0xf4, 0x7f, 0x5b, 0x3f,
+    0x49, 0x1e, 0x47, 0xe0, 0x55, 0x64, 0xbe, 0x56, 0x87, 0xa1, 0x02, 0xb1, 0x0a, 0xdd, 0xcd, 0x3b,
+    0x0b, 0x49, 0xfb, 0x87, 0x96, 0x13, 0x91, 0xcb, 0xcb, 0x97, 0x65, 0xb4, 0x9e, 0x61, 0xb8, 0x2d,
+    0x68, 0x40, 0x4f, 0x9b, 0xc4, 0xa9, 0x53, 0xfc, 0x90, 0xba, 0x68, 0xfc, 0xcd, 0x65, 0xb2, 0x1d,
+    0x9e, 0xe5, 0x73, 0xbb, 0x5b, 0x85, 0x23, 0x66, 0x1f, 0x89, 0x81, 0x0b, 0x32, 0xea, 0xa8, 0x0d,
+    0x5d, 0xd2, 0x0e, 0x79, 0xe5, 0xc0, 0x31, 0x18, 0x28, 0x72, 0xa0, 0x61, 0xc0, 0x1e, 0x05, 0x03,
+    0x31, 0xe1, 0xcd, 0x40, 0xcc, 0x57, 0x36, 0x21, 0x48, 0x52, 0xc0, 0xfb, 0xd6, 0xc6, 0x6c, 0xad,
+    0xca, 0xf3, 0xa6, 0xbc, 0x1b, 0x7b, 0x98, 0x47, 0x01, 0xe4, 0x83, 0x1d, 0x42, 0x5f, 0x33, 0x0f,
+    0x47, 0x02, 0x03, 0x01, 0x00, 0x01, 0xa3, 0x81, 0x83, 0x30, 0x81, 0x80, 0x30, 0x19, 0x06, 0x03,
+    0x55, 0x1d, 0x11, 0x04, 0x12, 0x30, 0x10, 0x82, 0x0e, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74,
+    0x6f, 0x72, 0x2e, 0x74, 0x65, 0x73, 0x74, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01,
+    0xff, 0x04, 0x04, 0x03, 0x02, 0x05, 0xa0, 0x30, 0x13, 0x06, 0x03, 0x55, 0x1d, 0x25, 0x04, 0x0c,
+    0x30, 0x0a, 0x06, 0x08, 0x2b, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x01, 0x30, 0x1d, 0x06, 0x03,
+    0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0x9d, 0x83, 0x44, 0x42, 0x0c, 0x12, 0x35, 0xd4, 0xa8,
+    0x4e, 0xf5, 0xfe, 0x4c, 0xba, 0xe1, 0xa1, 0x4e, 0x2e, 0xf5, 0xa5, 0x30, 0x1f, 0x06, 0x03, 0x55,
+    0x1d, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0x9d, 0xee, 0xa5, 0xf6, 0x86, 0x95, 0xfb, 0x89,
+    0x46, 0xf3, 0x46, 0x8d, 0x59, 0xd3, 0x1b, 0xa0, 0x22, 0xe3, 0xfe, 0xc2, 0x30, 0x0d, 0x06, 0x09,
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00,
+    0x4b, 0x73, 0xd4, 0xaa, 0xa3, 0xbb, 0x6e, 0x02, 0x66, 0x97, 0x07, 0x04, 0x6c, 0x95, 0xd2, 0xa8,
+    0xd3, 0xe3, 0x26, 0x1b, 0x07, 0xdd, 0xd9, 0xe7, 0x40, 0x06, 0x99, 0xa0, 0xa4, 0xf8, 0xd9, 0xf3,
+    0xe4, 0x4e, 0xaa, 0x74, 0xc8, 0xf1, 0xce, 0xad, 0x66, 0xca, 0xae, 0x9e, 0x49, 0x8b, 0x0c, 0x23,
+    0x98, 0x1c, 0xc0, 0x6d, 0x8e, 0x87, 0x90, 0xd9, 0x00, 0xca, 0x51, 0xbb, 0x63, 0x51, 0x9f, 0x6e,
+    0x82, 0x78, 0x3c, 0xb1, 0x3e, 0xbc, 0xf6, 0x31, 0x70, 0x94, 0x90, 0x47, 0xbb, 0xb3, 0x1c, 0x68,
+    0x10, 0x0e, 0x26, 0x56, 0xb9, 0xbb, 0xbd, 0xb3, 0x61, 0x13, 0xfa, 0x28, 0x8e, 0xd6, 0x12, 0xfa,
+    0xc6, 0x6a, 0xce, 0xe6, 0xe7, 0x22, 0xb0, 0x4e, 0xf1, 0x89, 0x83, 0xb7, 0x85, 0x0a, 0xb7, 0x5c,
+    0x27, 0x4d, 0xae, 0x0b, 0x26, 0x2f, 0xe7, 0xef, 0x81, 0xd7, 0xa8, 0x31, 0x03, 0x81, 0x99, 0x42,
+    0x7d, 0x52, 0x17, 0x39, 0x59, 0x8e, 0xea, 0x0a, 0x87, 0xa0, 0xc1, 0x81, 0x7c, 0x60, 0x01, 0x7f,
+    0x94, 0x6a, 0x7a, 0x30, 0x7a, 0x23, 0xe7, 0xc6, 0x46, 0x63, 0x49, 0xf8, 0xeb, 0xd7, 0x78, 0xd2,
+    0xfd, 0xee, 0x1e, 0xb6, 0x12, 0x8d, 0x17, 0x0d, 0x3e, 0xfa, 0x1f, 0x95, 0xd0, 0x8a, 0x05, 0x46,
+    0x6f, 0x61, 0x85, 0x40, 0xe9, 0xda, 0xd8, 0xbb, 0x7f, 0x2e, 0x48, 0x2b, 0xae, 0xc3, 0x56, 0x7f,
+    0x14, 0x08, 0x0e, 0xa0, 0x18, 0x45, 0x5d, 0xd7, 0x85, 0x0d, 0x7e, 0xfb, 0x92, 0xfe, 0xdb, 0xc1,
+    0x89, 0x59, 0x80, 0x97, 0x05, 0x6c, 0x6b, 0x85, 0x8b, 0x01, 0xc9, 0xd6, 0x90, 0x07, 0xd2, 0x64,
+    0xa6, 0x0c, 0x49, 0xf2, 0xb6, 0x13, 0x8f, 0x2b, 0x9a, 0xc4, 0x90, 0x77, 0xb2, 0xdf, 0xcb, 0xc7,
+    0xf2, 0xff, 0x5c, 0xb2, 0x2c, 0xc4, 0xda, 0xf6, 0x4d, 0xe8, 0xb6, 0xcf, 0x21, 0xef, 0xb8, 0x2a
+};
+
+static const UCHAR      test_server_key_der[] =
+{
+    0x30, 0x82, 0x04, 0xa3, 0x02, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01, 0x00, 0xca, 0xe0, 0xdf, 0xbf,
+    0x89, 0xde, 0x3c, 0xcd, 0x1b, 0xcb, 0x12, 0x80, 0x95, 0x18, 0xb7, 0xee, 0xc4, 0x67, 0x9f, 0xf1,
+    0x7f, 0x51, 0x3c, 0x22, 0xcb, 0x40, 0x10, 0x39, 0xbc, 0xce, 0x57, 0xa9, 0x17, 0xcc, 0xc8, 0x45,
+    0x35, 0x36, 0xba, 0x12, 0x96, 0xa0, 0x80, 0xd3, 0x8f, 0xe3, 0x0d, 0x1c, 0xd9, 0x18, 0x4a, 0x6a,
+    0x4b, 0xd1, 0x59, 0xcf, 0x21, 0x2d, 0x5b, 0xce, 0x1a, 0x80, 0xc7, 0xbf, 0xe9, 0x7d, 0x07, 0x2a,
+    0x4a, 0xf4, 0xaa, 0x0e, 0xf6, 0x11, 0xbf, 0x2c, 0x9f, 0x50, 0xfb, 0x5e, 0xc6, 0xab, 0x23, 0x0a,
+    0x2c, 0x96, 0xdb, 0x08, 0x96, 0x93, 0xb3, 0x37, 0x8e, 0xa1, 0x93, 0xcf, 0x8c, 0x6a, 0xc7, 0xd3,
+    0xa2, 0xb5, 0xc2, 0xab, 0xb5, 0x5d, 0x20, 0x70, 0x42, 0x0a, 0xc6, 0x60, 0x59, 0x4b, 0xce, 0xce,
+    0xac, 0x17, 0x7f, 0x7b, 0x58, 0x3a, 0x61, 0x9b, 0x19, 0x04, 0x61, 0x87, 0x94, 0x39, 0x25, 0x11,
+    0xb2, 0x15, 0x4d, 0x1b, 0xcb, 0x20, 0x41, 0xf4, 0x7f, 0x5b, 0x3f, 0x49, 0x1e, 0x47, 0xe0, 0x55,
+    0x64, 0xbe, 0x56, 0x87, 0xa1, 0x02, 0xb1, 0x0a, 0xdd, 0xcd, 0x3b, 0x0b, 0x49, 0xfb, 0x87, 0x96,
+    0x13, 0x91, 0xcb, 0xcb, 0x97, 0x65, 0xb4, 0x9e, 0x61, 0xb8, 0x2d, 0x68, 0x40, 0x4f, 0x9b, 0xc4,
+    0xa9, 0x53, 0xfc, 0x90, 0xba, 0x68, 0xfc, 0xcd, 0x65, 0xb2, 0x1d, 0x9e, 0xe5, 0x73, 0xbb, 0x5b,
+    0x85, 0x23, 0x66, 0x1f, 0x89, 0x81, 0x0b, 0x32, 0xea, 0xa8, 0x0d, 0x5d, 0xd2, 0x0e, 0x79, 0xe5,
+    0xc0, 0x31, 0x18, 0x28, 0x72, 0xa0, 0x61, 0xc0, 0x1e, 0x05, 0x03, 0x31, 0xe1, 0xcd, 0x40, 0xcc,
+    0x57, 0x36, 0x21, 0x48, 0x52, 0xc0, 0xfb, 0xd6, 0xc6, 0x6c, 0xad, 0xca, 0xf3, 0xa6, 0xbc, 0x1b,
+    0x7b, 0x98, 0x47, 0x01, 0xe4, 0x83, 0x1d, 0x42, 0x5f, 0x33, 0x0f, 0x47, 0x02, 0x03, 0x01, 0x00,
+    0x01, 0x02, 0x82, 0x01, 0x00, 0x30, 0x35, 0xb6, 0xc5, 0xc7, 0xc7, 0xc9, 0x4f, 0xfe, 0x42, 0x47,
+    0xef, 0xc9, 0x3e, 0x59, 0xfb, 0x01, 0xae, 0x14, 0x3a, 0x69, 0x84, 0x4e, 0xd3, 0x7f, 0xd4, 0x05,
+    0xe7, 0x0a, 0x80, 0x48, 0x21, 0x74, 0xf7, 0xe3, 0x41, 0x5a, 0xef, 0x59, 0xd1, 0x2f, 0xfd, 0x0d,
+    0x0f, 0xf9, 0x19, 0xbd, 0xd4, 0x74, 0x9c, 0x4a, 0x96, 0xae, 0xd4, 0x9d, 0x50, 0x54, 0xb4, 0x78,
+    0x23, 0xe6, 0x75, 0x62, 0xc2, 0x2e, 0x84, 0x58, 0xef, 0x0a, 0x67, 0xd0, 0x7f, 0x84, 0xa6, 0xdb,
+    0xf4, 0x89, 0x19, 0x4f, 0xda, 0x8a, 0x40, 0x41, 0xaf, 0xd9, 0xbf, 0xb1, 0x65, 0xfd, 0x8e, 0x34,
+    0xa0, 0xc7, 0xa2, 0x8a, 0xc2, 0xdf, 0xbd, 0xc2, 0x25, 0x7e, 0xfd, 0x4d, 0x38, 0xcb, 0x7c, 0xc9,
+    0x48, 0x13, 0xd1, 0x86, 0xa9, 0x7f, 0x9e, 0xbd, 0x92, 0xac, 0x1f, 0x5b, 0x5a, 0x5e, 0xb1, 0x64,
+    0xdf, 0x5b, 0xd7, 0x08, 0x2b, 0xa8, 0xb8, 0x4e, 0x75, 0x78, 0x92, 0x5f, 0x8d, 0x65, 0xb2, 0x69,
+    0xba, 0xc6, 0x46, 0x11, 0xe7, 0xb2, 0xaf, 0x5f, 0x29, 0x72, 0xbe, 0xdc, 0x6b, 0x44, 0xee, 0xd1,
+    0xb3, 0x1f, 0x9e, 0x8d, 0x9e, 0x83, 0x9e, 0x67, 0xde, 0x8c, 0xec, 0xbd, 0x0f, 0x64, 0x66, 0x75,
+    0x1a, 0x63, 0x61, 0x60, 0x1e, 0x5d, 0x1e, 0xc0, 0x09, 0xa8, 0x08, 0xd6, 0xcc, 0x27, 0x3a, 0x11,
+    0xed, 0x92, 0xbe, 0x8c, 0xbd, 0x66, 0x42, 0x83, 0x01, 0xe6, 0x2d, 0x1e, 0x33, 0xde, 0xcf, 0x06,
+    0xee, 0x1b, 0x1d, 0x4a, 0x7d, 0xb6, 0x65, 0x88, 0x82, 0x1a, 0x42, 0x75, 0xfe, 0xee, 0xd1, 0xec,
+    0xec, 0x30, 0xf5, 0xdd, 0x3e, 0x59, 0xd1, 0x98, 0xdc, 0x93, 0x0b, 0x5d, 0xc4, 0x16, 0xe9, 0xc8,
+    0xc4, 0x4f, 0x2d, 0x01, 0xa1, 0xa9, 0x49, 0xd2, 0xf8, 0x05, 0x6e, 0xf5, 0x6c, 0xcb, 0x40, 0xbe,
+    0xdc, 0xc4, 0x26, 0x08, 0x2d, 0x02, 0x81, 0x81, 0x00, 0xee, 0x56, 0x5a, 0x90, 0x87, 0xed, 0x02,
+    0x53, 0x92, 0xf7, 0xc0, 0x02, 0xa1, 0x3e, 0xb5, 0x2e, 0x6f, 0xeb, 0xbe, 0x90, 0x7b, 0xb0, 0x5d,
+    0xa5, 0x28, 0x33, 0x62, 0xf0, 0xe6, 0xd7, 0xc2, 0x41, 0x1c, 0x54, 0xa9, 0x84, 0x23, 0xad, 0x53,
+    0x8f, 0x91, 0x87, 0x7d, 0xff, 0x5d, 0xd9, 0xd2, 0xdd, 0x08, 0x87, 0xa8, 0x8c, 0xe8, 0x06, 0x95,
+    0x43, 0x94, 0x51, 0x84, 0x08, 0x99, 0x01, 0x4c, 0xe3, 0x5b, 0x33, 0x31, 0x27, 0xdf, 0x5c, 0xe3,
+    0x93, 0x55, 0x76, 0x42, 0x06, 0x89, 0x05, 0xfa, 0xe0, 0xcb, 0x0e, 0x45, 0xc8, 0xf9, 0x12, 0x12,
+    0x40, 0x7b, 0x28, 0xbd, 0xd6, 0x6f, 0xe6, 0x57, 0x82, 0xe5, 0xfb, 0xff, 0xa6, 0x5a, 0x5a, 0x13,
+    0xab, 0xa6, 0x70, 0xf3, 0x80, 0x37, 0xef, 0xfb, 0xd7, 0x0f, 0xa3, 0x6e, 0xd7, 0x05, 0x5e, 0x3f,
+    0xe2, 0x9c, 0xd6, 0x5c, 0xde, 0x7b, 0x37, 0x6f, 0x8b, 0x02, 0x81, 0x81, 0x00, 0xd9, 0xe9, 0xce,
+    0xa4, 0x74, 0xfa, 0x73, 0xc4, 0x29, 0xcb, 0x5c, 0xa2, 0xa0, 0x98, 0x1a, 0x32, 0x68, 0x7a, 0xe3,
+    0xe8, 0x34, 0x64, 0xd6, 0x49, 0xd2, 0x39, 0x4b, 0xd9, 0xaf, 0xa7, 0xc5, 0xd9, 0xd0, 0xba, 0x65,
+    0x6e, 0x54, 0xcd, 0x3c, 0x0b, 0x3e, 0x47, 0x32, 0x1c, 0x85, 0x59, 0x08, 0x26, 0xd7, 0xaa, 0x46,
+    0xcc, 0x9c, 0x1e, 0x88, 0x66, 0x57, 0x04, 0x29, 0x9d, 0xd6, 0x97, 0xb9, 0x05, 0x76, 0x69, 0xa5,
+    0xb8, 0x81, 0x91, 0xef, 0x36, 0x63, 0x38, 0xad, 0x64, 0x01, 0xe8, 0x34, 0x38, 0x2f, 0xa3, 0xe1,
+    0x4d, 0x87, 0x70, 0x4a, 0x0b, 0x4b, 0x9b, 0xc6, 0x90, 0x05, 0x20, 0x4d, 0x89, 0xdd, 0x7f, 0x7f,
+    0x09, 0x0a, 0xa9, 0x10, 0xa7, 0x5f, 0x14, 0x75, 0x28, 0x46, 0x9d, 0x3a, 0xbd, 0x81, 0x9b, 0x20,
+    0xfc, 0x4a, 0xa6, 0x3e, 0x20, 0xdf, 0x1e, 0x7e, 0x5d, 0xb5, 0xa9, 0xd6, 0xb5, 0x02, 0x81, 0x81,
+    0x00, 0xb9, 0x50, 0x81, 0x78, 0x71, 0x87, 0xb2, 0x50, 0x63, 0x2c, 0xa9, 0xaa, 0x21, 0xcf, 0xcd,
+    0x36, 0x7f, 0x25, 0x70, 0xf5, 0x8c, 0x86, 0xd4, 0x39, 0x4f, 0x69, 0xad, 0x1b, 0x9c, 0x91, 0xd4,
+    0x63, 0xa5, 0xf0, 0x9a, 0x21, 0xb9, 0x4f, 0xd2, 0x72, 0x05, 0xf8, 0xb0, 0xda, 0x37, 0x11, 0xdf,
+    0xe7, 0xa6, 0xf3, 0x3b, 0xf5, 0xdb, 0x8f, 0x0a, 0xce, 0x11, 0xeb, 0xd3, 0xda, 0x8f, 0x85, 0x38,
+    0x50, 0x6b, 0x20, 0x01, 0xaf, 0x7b, 0xf8, 0x10, 0xa7, 0x05, 0x43, 0x3f, 0x11, 0x2f, 0xc7, 0x6b,
+    0x8b, 0x0f, 0xb7, 0x58, 0x41, 0x6c, 0x90, 0x45, 0x8a, 0xc7, 0x78, 0x25, 0x2b, 0x2f, 0xb4, 0x8d,
+    0x04, 0xa5, 0x67, 0xec, 0x1e, 0x5f, 0x90, 0x3c, 0x4d, 0x31, 0xcc, 0x0f, 0x38, 0xf9, 0xc5, 0x6a,
+    0x2e, 0x8c, 0xe5, 0x49, 0x90, 0x7c, 0x87, 0x0c, 0xeb, 0x59, 0x81, 0x3f, 0x92, 0x69, 0x81, 0xf0,
+    0x03, 0x02, 0x81, 0x80, 0x63, 0x76, 0x45, 0x5c, 0x69, 0x0c, 0x3b, 0xb4, 0xc8, 0x82, 0xca, 0xd8,
+    0x6b, 0xc6, 0xa1, 0x06, 0x6b, 0x0b, 0xd4, 0x64, 0x93, 0x2d, 0x87, 0x65, 0x90, 0x6f, 0x98, 0x80,
+    0x56, 0x9d, 0x94, 0x3f, 0xd3, 0xf6, 0x8f, 0xff, 0x68, 0xf3, 0x78, 0x39, 0x85, 0x86, 0x87, 0x87,
+    0xdf, 0x11, 0x81, 0x18, 0x01, 0x8d, 0xf5, 0xdc, 0xc4, 0x51, 0x67, 0x5e, 0x96, 0xcf, 0x0e, 0x93,
+    0xbd, 0x73, 0xe8, 0xfe, 0x66, 0x4a, 0xd8, 0x5a, 0x3b, 0xc1, 0xb9, 0x56, 0xb0, 0xb9, 0x18, 0xe3,
+    0x31, 0xbf, 0xa3, 0xbe, 0x15, 0x78, 0x8e, 0x88, 0x8d, 0x8e, 0x22, 0x2d, 0xbf, 0xa7, 0xed, 0x5c,
+    0xa5, 0x0a, 0x56, 0x79, 0xdb, 0xc0, 0xaa, 0xe2, 0x1c, 0x9c, 0x88, 0x3e, 0x6c, 0xb6, 0x70, 0xb7,
+    0x1e, 0x6b, 0xfb, 0x78, 0xad, 0xe4, 0x79, 0x8c, 0xce, 0x21, 0xcc, 0xef, 0xc2, 0x07, 0x30, 0x14,
+    0x63, 0xab, 0x8e, 0x95, 0x02, 0x81, 0x80, 0x28, 0xf8, 0x5d, 0xf0, 0x12, 0x52, 0x91, 0xe0, 0x11,
+    0xa7, 0xe1, 0x4e, 0xd3, 0x78, 0x21, 0x32, 0x3f, 0x9e, 0xcf, 0xff, 0x48, 0x77, 0x25, 0x1a, 0xc5,
+    0x81, 0xd3, 0x29, 0x68, 0x46, 0x2c, 0xe9, 0xb3, 0xdd, 0xfb, 0xd6, 0x72, 0xfc, 0x78, 0x69, 0x0f,
+    0x3d, 0xe9, 0x95, 0xef, 0x9e, 0x70, 0x17, 0x12, 0x50, 0xa7, 0x3f, 0x3c, 0x75, 0x8a, 0x4f, 0xc3,
+    0xf0, 0x5d, 0xbd, 0x50, 0x45, 0x2e, 0x03, 0x66, 0xaf, 0x64, 0xb2, 0x4b, 0x82, 0xc4, 0x6e, 0x89,
+    0x88, 0x1c, 0x8e, 0xf2, 0x6b, 0x3a, 0x73, 0x61, 0xb2, 0xd1, 0x34, 0xf6, 0xbe, 0xe7, 0x95, 0x57,
+    0xc9, 0xf4, 0xf1, 0x19, 0xc1, 0xc7, 0x24, 0x15, 0x66, 0x9a, 0x12, 0x14, 0x54, 0x08, 0xa5, 0x04,
+    0x1d, 0xb0, 0x43, 0xe5, 0x6e, 0xb2, 0xa8, 0xdc, 0xa8, 0x71, 0x25, 0x2e, 0x52, 0x92, 0xa5, 0xe9,
+    0x45, 0x38, 0xd9, 0xf7, 0x04, 0x5f, 0x23
+};
+
+
+static const UCHAR      test_session_id[NX_SECURE_TLS_RESUMPTION_SESSION_ID_SIZE] =
+{
+    0x5a, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0xa5
+};
+
+static const UCHAR      test_data[] = "resumed session data";
+
+static UINT                             test_failures;
+static ULONG                            test_time;
+static UINT                             test_certificate_callbacks;
+static NX_IP                            test_ip;
+static NX_PACKET_POOL                   test_pool;
+static ULONG                            test_pool_area[TEST_PACKETS * (TEST_PACKET_SIZE + sizeof(NX_PACKET)) / sizeof(ULONG)];
+static NXD_ADDRESS                      test_address;
+static TX_THREAD                        test_thread;
+static ULONG                            test_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+
+/* Client.  */
+static NX_TCP_SOCKET                    test_client_sockets[TEST_PHASES];
+static NX_SECURE_TLS_SESSION            test_client_session;
+static NX_SECURE_TLS_SESSION_RESUMPTION test_resumption;
+static NX_SECURE_X509_CERT              test_trusted_ca;
+static NX_SECURE_X509_CERT              test_remote_cert;
+static ULONG                            test_client_metadata[16384 / sizeof(ULONG)];
+static UCHAR                            test_client_packet_buffer[4096];
+static UCHAR                            test_client_cert_buffer[2048];
+
+/* Server.  */
+static NX_TCP_SOCKET                    test_server_sockets[TEST_PHASES];
+static NX_SECURE_TLS_SESSION            test_server_session;
+static NX_SECURE_X509_CERT              test_server_cert;
+static ULONG                            test_server_metadata[16384 / sizeof(ULONG)];
+static UCHAR                            test_server_packet_buffer[4096];
+static UCHAR                            test_master_secret[NX_SECURE_TLS_MASTER_SIZE];
+static UCHAR                            test_record[2048];
+static UINT                             test_server_status;
+static UINT                             test_offered_id;
+static TX_SEMAPHORE                     test_server_done;
+static TX_THREAD                        test_server_thread;
+static ULONG                            test_server_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+
+
+static VOID test_check(UINT condition, const CHAR *name, UINT status)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s, status 0x%x\n", name, status);
+        test_failures++;
+    }
+}
+
+
+static ULONG test_time_function(VOID)
+{
+
+    return(test_time);
+}
+
+
+static ULONG test_certificate_callback(NX_SECURE_TLS_SESSION *session, NX_SECURE_X509_CERT *certificate)
+{
+
+    NX_PARAMETER_NOT_USED(session);
+    NX_PARAMETER_NOT_USED(certificate);
+
+    test_certificate_callbacks++;
+    return(NX_SUCCESS);
+}
+
+
+/* Receive one record of application data and check it is the test data.  */
+
+static UINT test_server_data_receive(VOID)
+{
+NX_PACKET  *packet_ptr;
+ULONG       length;
+UINT        status;
+
+    status = nx_secure_tls_session_receive(&test_server_session, &packet_ptr, TEST_WAIT);
+    if (status == NX_SUCCESS)
+    {
+        nx_packet_data_extract_offset(packet_ptr, 0, test_record, sizeof(test_record), &length);
+        if ((length != sizeof(test_data)) || memcmp(test_record, test_data, sizeof(test_data)))
+        {
+            status = NX_INVALID_PACKET;
+        }
+        nx_packet_release(packet_ptr);
+    }
+
+    return(status);
+}
+
+
+/* Run the server side of a handshake that issues or echoes the test session ID. The TLS server
+   neither issues session IDs nor resumes sessions, so the flights up to the ServerHelloDone, or
+   for a resumed session up to the server Finished, are built with its internal routines. The rest
+   of the handshake is left to the TLS server as after a key exchange, so the client Finished is
+   verified against the handshake hash. For a resumed session the server then sends its
+   ChangeCipherSpec and Finished once more, which the client never reads.  */
+
+static UINT test_server_handshake(NX_TCP_SOCKET *socket_ptr, UINT resume)
+{
+NX_SECURE_TLS_SESSION  *session = &test_server_session;
+NX_PACKET              *packet_ptr;
+UCHAR                  *hello_ptr;
+ULONG                   length;
+UINT                    hello_length;
+UINT                    status;
+
+    /* The ClientHello is a single record.  */
+    status = nx_tcp_socket_receive(socket_ptr, &packet_ptr, TEST_WAIT);
+    if (status)
+    {
+        return(status);
+    }
+    nx_packet_data_extract_offset(packet_ptr, 0, test_record, sizeof(test_record), &length);
+    nx_packet_release(packet_ptr);
+    hello_length = ((UINT)test_record[6] << 16) | ((UINT)test_record[7] << 8) | test_record[8];
+    if ((test_record[0] != NX_SECURE_TLS_HANDSHAKE) || (test_record[5] != NX_SECURE_TLS_CLIENT_HELLO) ||
+        (length != 9 + hello_length))
+    {
+        return(NX_INVALID_PACKET);
+    }
+
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+
+    /* Attach the session as nx_secure_tls_session_start does.  */
+    session -> nx_secure_tls_packet_pool = &test_pool;
+    session -> nx_secure_tls_tcp_socket = socket_ptr;
+    session -> nx_secure_tls_socket_type = NX_SECURE_TLS_SESSION_TYPE_SERVER;
+    session -> nx_secure_record_queue_header = NX_NULL;
+    session -> nx_secure_record_decrypted_packet = NX_NULL;
+    session -> nx_secure_tls_local_session_active = 0;
+    session -> nx_secure_tls_remote_session_active = 0;
+
+    _nx_secure_tls_handshake_hash_init(session);
+    status = _nx_secure_tls_process_clienthello(session, test_record + 9, hello_length);
+    _nx_secure_tls_handshake_hash_update(session, test_record + 5, 4 + hello_length);
+
+    /* Remember whether the client offered the test ID, and answer with it.  */
+    test_offered_id = (session -> nx_secure_tls_session_id_length == sizeof(test_session_id)) &&
+                      !memcmp(session -> nx_secure_tls_session_id, test_session_id, sizeof(test_session_id));
+    memcpy(session -> nx_secure_tls_session_id, test_session_id, sizeof(test_session_id));
+    session -> nx_secure_tls_session_id_length = sizeof(test_session_id);
+
+    /* The ServerHello of TLS 1.2 is built with an empty session ID, so insert the test ID behind
+       the version and random.  */
+    if (status == NX_SUCCESS)
+    {
+        status = _nx_secure_tls_allocate_handshake_packet(session, &test_pool, &packet_ptr, TEST_WAIT);
+    }
+    if (status == NX_SUCCESS)
+    {
+        hello_ptr = packet_ptr -> nx_packet_append_ptr;
+        status = _nx_secure_tls_send_serverhello(session, packet_ptr);
+        if (status == NX_SUCCESS)
+        {
+            length = (ULONG)(packet_ptr -> nx_packet_append_ptr - hello_ptr);
+            memmove(hello_ptr + 35 + sizeof(test_session_id), hello_ptr + 35, length - 35);
+            hello_ptr[34] = sizeof(test_session_id);
+            memcpy(hello_ptr + 35, test_session_id, sizeof(test_session_id));
+            packet_ptr -> nx_packet_append_ptr += sizeof(test_session_id);
+            packet_ptr -> nx_packet_length += sizeof(test_session_id);
+            status = _nx_secure_tls_send_handshake_record(session, packet_ptr, NX_SECURE_TLS_SERVER_HELLO, TEST_WAIT);
+        }
+    }
+
+    if (resume)
+    {
+
+        /* Keys from the master secret of the full handshake, then ChangeCipherSpec and Finished.  */
+        if (status == NX_SUCCESS)
+        {
+            session -> nx_secure_tls_session_resumed = NX_TRUE;
+            memcpy(session -> nx_secure_tls_key_material.nx_secure_tls_master_secret, test_master_secret,
+                   sizeof(test_master_secret));
+            status = _nx_secure_tls_generate_keys(session);
+        }
+        if (status == NX_SUCCESS)
+        {
+            status = _nx_secure_tls_packet_allocate(session, &test_pool, &packet_ptr, TEST_WAIT);
+        }
+        if (status == NX_SUCCESS)
+        {
+            _nx_secure_tls_send_changecipherspec(session, packet_ptr);
+            status = _nx_secure_tls_send_record(session, packet_ptr, NX_SECURE_TLS_CHANGE_CIPHER_SPEC, TEST_WAIT);
+        }
+        if (status == NX_SUCCESS)
+        {
+            memset(session -> nx_secure_tls_local_sequence_number, 0, sizeof(session -> nx_secure_tls_local_sequence_number));
+            status = _nx_secure_tls_session_keys_set(session, NX_SECURE_TLS_KEY_SET_LOCAL);
+        }
+        if (status == NX_SUCCESS)
+        {
+            status = _nx_secure_tls_allocate_handshake_packet(session, &test_pool, &packet_ptr, TEST_WAIT);
+        }
+        if (status == NX_SUCCESS)
+        {
+            _nx_secure_tls_send_finished(session, packet_ptr);
+            status = _nx_secure_tls_send_handshake_record(session, packet_ptr, NX_SECURE_TLS_FINISHED, TEST_WAIT);
+        }
+        session -> nx_secure_tls_server_state = NX_SECURE_TLS_SERVER_STATE_KEY_EXCHANGE;
+    }
+    else
+    {
+
+        /* Certificate and ServerHelloDone.  */
+        if (status == NX_SUCCESS)
+        {
+            status = _nx_secure_tls_allocate_handshake_packet(session, &test_pool, &packet_ptr, TEST_WAIT);
+        }
+        if (status == NX_SUCCESS)
+        {
+            _nx_secure_tls_send_certificate(session, packet_ptr, TEST_WAIT);
+            status = _nx_secure_tls_send_handshake_record(session, packet_ptr, NX_SECURE_TLS_CERTIFICATE_MSG, TEST_WAIT);
+        }
+        if (status == NX_SUCCESS)
+        {
+            status = _nx_secure_tls_allocate_handshake_packet(session, &test_pool, &packet_ptr, TEST_WAIT);
+        }
+        if (status == NX_SUCCESS)
+        {
+            status = _nx_secure_tls_send_handshake_record(session, packet_ptr, NX_SECURE_TLS_SERVER_HELLO_DONE, TEST_WAIT);
+        }
+        session -> nx_secure_tls_server_state = NX_SECURE_TLS_SERVER_STATE_HELLO_SENT;
+    }
+    session -> nx_secure_tls_received_remote_credentials = NX_TRUE;
+
+    tx_mutex_put(&_nx_secure_tls_protection);
+
+    if (status == NX_SUCCESS)
+    {
+        status = _nx_secure_tls_handshake_process(session, TEST_WAIT);
+    }
+
+    return(status);
+}
+
+
+/* Run the server of a phase, with an abbreviated handshake in phase 1 and full handshakes
+   otherwise, then receive the test data.  */
+
+static VOID test_server_entry(ULONG thread_input)
+{
+
+    test_server_status = nx_wifi_loopback_accept(&test_server_sockets[thread_input], TEST_WAIT);
+    if (test_server_status == NX_SUCCESS)
+    {
+        test_server_status = test_server_handshake(&test_server_sockets[thread_input], thread_input == 1);
+    }
+    if (test_server_status == NX_SUCCESS)
+    {
+        if (thread_input == 0)
+        {
+            memcpy(test_master_secret, test_server_session.nx_secure_tls_key_material.nx_secure_tls_master_secret,
+                   sizeof(test_master_secret));
+        }
+        test_server_status = test_server_data_receive();
+    }
+    nx_secure_tls_session_end(&test_server_session, NX_NO_WAIT);
+    tx_semaphore_put(&test_server_done);
+}
+
+
+/* Connect the client to the server of the given phase, and send the test data once the handshake
+   is done.  */
+
+static UINT test_connect(UINT phase)
+{
+NX_PACKET  *packet_ptr;
+UINT        status;
+UINT        server_status;
+
+    test_server_status = NX_NOT_SUCCESSFUL;
+    nx_wifi_loopback_listen(&test_ip, &test_server_sockets[phase], TEST_PORT);
+    tx_thread_create(&test_server_thread, "server", test_server_entry, phase, test_server_thread_stack,
+                     sizeof(test_server_thread_stack), 4, 4, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    nx_tcp_client_socket_bind(&test_client_sockets[phase], NX_ANY_PORT, NX_NO_WAIT);
+    status = nxd_tcp_client_socket_connect(&test_client_sockets[phase], &test_address, TEST_PORT, TEST_WAIT);
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_session_start(&test_client_session, &test_client_sockets[phase], TEST_WAIT);
+    }
+    if (status == NX_SUCCESS)
+    {
+        status = nx_secure_tls_packet_allocate(&test_client_session, &test_pool, &packet_ptr, TEST_WAIT);
+        if (status == NX_SUCCESS)
+        {
+            nx_packet_data_append(packet_ptr, (VOID *)test_data, sizeof(test_data), &test_pool, TEST_WAIT);
+            status = nx_secure_tls_session_send(&test_client_session, packet_ptr, TEST_WAIT);
+            if (status)
+            {
+                nx_packet_release(packet_ptr);
+            }
+        }
+    }
+
+    server_status = tx_semaphore_get(&test_server_done, 4 * TEST_WAIT);
+    test_check(server_status == TX_SUCCESS, "server done", server_status);
+    tx_thread_delete(&test_server_thread);
+
+    return(status);
+}
+
+
+static VOID test_entry(ULONG thread_input)
+{
+UINT    status;
+UINT    i;
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    nx_secure_tls_initialize();
+    status = nx_ip_create(&test_ip, "test", TEST_IP_ADDRESS, 0xFFFFFF00UL, &test_pool, NX_NULL, NX_NULL, 0, 1);
+    test_check(status == NX_SUCCESS, "IP create", status);
+    nx_tcp_enable(&test_ip);
+    test_address.nxd_ip_version = NX_IP_VERSION_V4;
+    test_address.nxd_ip_address.v4 = TEST_IP_ADDRESS;
+    tx_semaphore_create(&test_server_done, "server done", 0);
+    for (i = 0; i < TEST_PHASES; i++)
+    {
+        nx_tcp_socket_create(&test_ip, &test_client_sockets[i], "client", NX_IP_NORMAL, NX_FRAGMENT_OKAY,
+                             NX_IP_TIME_TO_LIVE, 8192, NX_NULL, NX_NULL);
+        nx_tcp_socket_create(&test_ip, &test_server_sockets[i], "server", NX_IP_NORMAL, NX_FRAGMENT_OKAY,
+                             NX_IP_TIME_TO_LIVE, 8192, NX_NULL, NX_NULL);
+    }
+
+    /* Server.  */
+    status = nx_secure_tls_session_create(&test_server_session, &nx_crypto_tls_ciphers,
+                                          test_server_metadata, sizeof(test_server_metadata));
+    test_check(status == NX_SUCCESS, "server session create", status);
+    nx_secure_tls_session_packet_buffer_set(&test_server_session, test_server_packet_buffer,
+                                            sizeof(test_server_packet_buffer));
+    nx_secure_x509_certificate_initialize(&test_server_cert, (UCHAR *)test_server_der, sizeof(test_server_der),
+                                          NX_NULL, 0, test_server_key_der, sizeof(test_server_key_der),
+                                          NX_SECURE_X509_KEY_TYPE_RSA_PKCS1_DER);
+    status = nx_secure_tls_local_certificate_add(&test_server_session, &test_server_cert);
+    test_check(status == NX_SUCCESS, "server certificate add", status);
+
+    /* Client, with the resumption entry.  */
+    status = nx_secure_tls_session_create(&test_client_session, &nx_crypto_tls_ciphers,
+                                          test_client_metadata, sizeof(test_client_metadata));
+    test_check(status == NX_SUCCESS, "client session create", status);
+    nx_secure_tls_session_packet_buffer_set(&test_client_session, test_client_packet_buffer,
+                                            sizeof(test_client_packet_buffer));
+    nx_secure_tls_remote_certificate_allocate(&test_client_session, &test_remote_cert, test_client_cert_buffer,
+                                              sizeof(test_client_cert_buffer));
+    nx_secure_x509_certificate_initialize(&test_trusted_ca, (UCHAR *)test_ca_der, sizeof(test_ca_der),
+                                          NX_NULL, 0, NX_NULL, 0, NX_SECURE_X509_KEY_TYPE_NONE);
+    nx_secure_tls_trusted_certificate_add(&test_client_session, &test_trusted_ca);
+    nx_secure_tls_session_certificate_callback_set(&test_client_session, test_certificate_callback);
+    nx_secure_tls_session_time_function_set(&test_client_session, test_time_function);
+    status = nx_secure_tls_session_resumption_set(&test_client_session, &test_resumption);
+    test_check(status == NX_SUCCESS, "resumption set", status);
+
+    /* Full handshake: the entry is filled in.  */
+    test_time = TEST_TIME;
+    status = test_connect(0);
+    test_check(status == NX_SUCCESS, "full handshake", status);
+    test_check(test_server_status == NX_SUCCESS, "full handshake server", test_server_status);
+    test_check(test_client_session.nx_secure_tls_session_resumed == NX_FALSE, "full handshake not resumed", 0);
+    test_check(test_certificate_callbacks == 1, "full handshake certificate callback", test_certificate_callbacks);
+    test_check((test_resumption.nx_secure_tls_resumption_session_id_length == sizeof(test_session_id)) &&
+               !memcmp(test_resumption.nx_secure_tls_resumption_session_id, test_session_id, sizeof(test_session_id)),
+               "entry session ID", test_resumption.nx_secure_tls_resumption_session_id_length);
+    test_check(!memcmp(test_resumption.nx_secure_tls_resumption_master_secret, test_master_secret,
+                       sizeof(test_master_secret)), "entry master secret", 0);
+    test_check(test_offered_id == NX_FALSE, "full handshake offered ID", 0);
+    test_check(test_resumption.nx_secure_tls_resumption_time == TEST_TIME, "entry time", 0);
+    nx_secure_tls_session_end(&test_client_session, NX_NO_WAIT);
+
+    /* Abbreviated handshake: no certificate, and the entry keeps the time it was established.  */
+    test_time = TEST_TIME + 60;
+    status = test_connect(1);
+    test_check(status == NX_SUCCESS, "abbreviated handshake", status);
+    test_check(test_server_status == NX_SUCCESS, "abbreviated handshake server", test_server_status);
+    test_check(test_offered_id == NX_TRUE, "abbreviated handshake offered ID", 0);
+    test_check(test_client_session.nx_secure_tls_session_resumed == NX_TRUE, "abbreviated handshake resumed", 0);
+    test_check(test_certificate_callbacks == 1, "abbreviated handshake certificate callback",
+               test_certificate_callbacks);
+    test_check(test_resumption.nx_secure_tls_resumption_session_id_length == sizeof(test_session_id),
+               "entry kept", test_resumption.nx_secure_tls_resumption_session_id_length);
+    test_check(test_resumption.nx_secure_tls_resumption_time == TEST_TIME, "entry time kept", 0);
+    nx_secure_tls_session_end(&test_client_session, NX_NO_WAIT);
+
+    /* The server echoes the ID but sends a Certificate: the handshake fails and the entry is emptied.  */
+    status = test_connect(2);
+    test_check(status == NX_SECURE_TLS_UNEXPECTED_MESSAGE, "Certificate after resumed ServerHello", status);
+    test_check(test_server_status != NX_SUCCESS, "server of the failed handshake", test_server_status);
+    test_check(test_resumption.nx_secure_tls_resumption_session_id_length == 0, "entry emptied",
+               test_resumption.nx_secure_tls_resumption_session_id_length);
+
+    if (test_failures)
+    {
+        printf("nx_secure_tls_session_resumption_test: %u checks failed\n", test_failures);
+        exit(1);
+    }
+    printf("nx_secure_tls_session_resumption_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    NX_PARAMETER_NOT_USED(first_unused_memory);
+
+    nx_system_initialize();
+    nx_packet_pool_create(&test_pool, "test", TEST_PACKET_SIZE, test_pool_area, sizeof(test_pool_area));
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     8, 8, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
@@ -0,0 +1,238 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks certificate store lookups, which skip the name compare of certificates whose
+   subject name hash differs. Up to 150 trusted roots are loaded, made from one self-signed root
+   whose common name ends in three digits, "NetX Duo Test Root Certificate Authority 000", so all
+   names share a long prefix. Every root must be found by its name, a name that was not loaded must
+   not be found, a duplicate name must be rejected when added, and certificates without a hash must
+   still be compared in full. The time per lookup is reported for 50, 100 and 150 roots, with the
+   hashes set and with them cleared, which is the name compare of every certificate.  */
+
+#include "nx_secure_tls.h"
+#include <stdio.h>
+#include <time.h>
+
+
+#define TEST_ROOTS              150
+#define TEST_ROUNDS             200
+
+
+static const UCHAR      test_root_der[] =
+{
+    0x30, 0x82, 0x03, 0x53, 0x30, 0x82, 0x02, 0x3b, 0xa0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x04,
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x30,
+    0x4b, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65, 0x74, 0x58,
+    0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x35, 0x30, 0x33, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x2c,
+    0x4e, 0x65, 0x74, 0x58, 0x20, 0x44, 0x75, 0x6f, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x52, 0x6f,
+    0x6f, 0x74, 0x20, 0x43, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x41,
+    0x75, 0x74, 0x68, 0x6f, 0x72, 0x69, 0x74, 0x79, 0x20, 0x30, 0x30, 0x30, 0x30, 0x1e, 0x17, 0x0d,
+    0x32, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x17, 0x0d, 0x34,
+    0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x30, 0x4b, 0x31, 0x12,
+    0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65, 0x74, 0x58, 0x20, 0x54, 0x65,
+    0x73, 0x74, 0x31, 0x35, 0x30, 0x33, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x2c, 0x4e, 0x65, 0x74,
+    0x58, 0x20, 0x44, 0x75, 0x6f, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x52, 0x6f, 0x6f, 0x74, 0x20,
+    0x43, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x41, 0x75, 0x74, 0x68,
+    0x6f, 0x72, 0x69, 0x74, 0x79, 0x20, 0x30, 0x30, 0x30, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0d, 0x06,
+    0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x0f,
+    0x00, 0x30, 0x82, 0x01, 0x0a, 0x02, 0x82, 0x01, 0x01, 0x00, 0xb2, 0xdc, 0xef, 0x0f, 0x4b, 0xd0,
+    0xc8, 0xea, 0x6b, 0x1a, 0x2f, 0x3a, 0xce, 0x13, 0xd8, 0x15, 0x13, 0x4f, 0xc0, 0x84, 0x3d, 0xe9,
+    0x1b, 0xf2, 0x48, 0x0e, 0xdc, 0x4c, 0x47, 0x51, 0x3e, 0x14, 0x6d, 0x52, 0x9d, 0xc9, 0x98, 0x34,
+    0xf1, 0xfd, 0x52, 0x1d, 0x46, 0x02, 0x6a, 0xa0, 0x67, 0x7d, 0x96, 0xe6, 0x21, 0x66, 0x29, 0x79,
+    0x56, 0x15, 0x3e, 0x2c, 0xe9, 0x32, 0xd2, 0x4c, 0x65, 0x4a, 0xcb, 0x30, 0x1d, 0xd2, 0x87, 0x1d,
+    0xd2, 0x15, 0xef, 0x1e, 0xd2, 0x27, 0x1a, 0x49, 0xb8, 0x31, 0xa3, 0xf8, 0x6b, 0xe9, 0x4a, 0x52,
+    0x12, 0x1b, 0x7c, 0x4d, 0x55, 0x68, 0x57, 0x8b, 0x04, 0xaa, 0x50, 0x16, 0x7b, 0x3d, 0x84, 0x55,
+    0xa0, 0x34, 0x9d, 0xbd, 0xda, 0x39, 0x03, 0xf2, 0x6a, 0xca, 0x7e, 0xca, 0x9c, 0x5c, 0xda, 0x99,
+    0x13, 0xb1, 0xd8, 0x43, 0x9d, 0xd8, 0x02, 0x10, 0x9f, 0xf0, 0x6f, 0x88, 0xac, 0x03, 0xd9, 0xe8,
+    0xab, 0x4d, 0xe2, 0x72, 0xd9, 0x85, 0x19, 0x2e, 0xd9, 0xed, 0x1d, 0xc5, 0x81, 0x34, 0x55, 0x33,
+    0xba, 0x0d, 0x10, 0xf8, 0xbf, 0x00, 0x64, 0x45, 0x0f, 0x60, 0x0a, 0xd0, 0xbb, 0x06, 0x32, 0x38,
+    0x64, 0xda, 0xb0, 0xdf, 0x02, 0xac, 0x94, 0x69, 0x28, 0xaa, 0x45, 0xfa, 0xca, 0x43, 0xd6, 0x16,
+    0x49, 0x1b, 0x1f, 0xc7, 0x0d, 0xa4, 0x39, 0x31, 0xc8, 0xb2, 0x1d, 0x24, 0xf7, 0x72, 0x60, 0xea,
+    0x23, 0xe1, 0x68, 0x95, 0x70, 0x0e, 0x79, 0x2e, 0x7e, 0xd0, 0xde, 0x2f, 0x51, 0x58, 0x65, 0x70,
+    0x56, 0xc4, 0x95, 0xb8, 0x43, 0x5f, 0xe4, 0x4e, 0xc6, 0x87, 0x28, 0x72, 0xc9, 0x33, 0xd4, 0x6b,
+    0x0d, 0x6a, 0x43, 0xc9, 0xc2, 0xb2, 0xa9, 0x9c, 0x3a, 0xfe, 0x46, 0x6f, 0x47, 0xcc, 0x1a, 0xc1,
+    0x20, 0x73, 0xbf, 0x16, 0x69, 0xbc, 0x05, 0x1a, 0xe8, 0x1d, 0x02, 0x03, 0x01, 0x00, 0x01, 0xa3,
+    0x42, 0x30, 0x40, 0x30, 0x0f, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x01, 0x01, 0xff, 0x04, 0x05, 0x30,
+    0x03, 0x01, 0x01, 0xff, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04, 0x04,
+    0x03, 0x02, 0x02, 0x04, 0x30, 0x1d, 0x06, 0x03, 0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0xfa,
+    0xb0, 0x10, 0x19, 0x41, 0x4d, 0xc1, 0x43, 0xd5, 0xd0, 0xe7, 0xcb, 0x05, 0x80, 0xcd, 0xb8, 0xa3,
+    0xcc, 0xf6, 0x8f, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b,
+    0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x8b, 0x83, 0x6d, 0xa8, 0xfa, 0xbe, 0xe2, 0xce, 0x30,
+    0xe1, 0x19, 0xb5, 0x13, 0x77, 0xf4, 0x6a, 0x49, 0xd0, 0x49, 0x89, 0x24, 0x05, 0xfd, 0xf0, 0x43,
+    0xb8, 0xb2, 0xdd, 0xcf, 0xcd, 0xc3, 0x54, 0x5d, 0x64, 0x85, 0x41, 0x50, 0x70, 0xfb, 0xa9, 0xbf,
+    0x88, 0xdb, 0x28, 0xfe, 0x97, 0x31, 0x61, 0x45, 0x13, 0x4d, 0x05, 0xe3, 0x4a, 0xff, 0xbc, 0x10,
+    0xf8, 0x28, 0x93, 0x0c, 0x9a, 0x24, 0x54, 0x3f, 0x39, 0x89, 0x05, 0x5e, 0x88, 0xde, 0xbb, 0x7f,
+    0x22, 0xe1, 0xc8, 0x02, 0xad, 0x85, 0xc3, 0x05, 0x14, 0x8d, 0x81, 0x7f, 0x2e, 0x06, 0x2c, 0x1f,
+    0x59, 0xdb, 0xc9, 0xcb, 0x5c, 0x37, 0xff, 0xb8, 0x4d, 0xca, 0xdd, 0xd0, 0x0f, 0x82, 0xc9, 0x81,
+    0xef, 0x17, 0x37, 0xeb, 0xd9, 0xe6, 0xc5, 0x79, 0x54, 0x82, 0x0f, 0xc8, 0xa3, 0x59, 0x0b, 0x4d,
+    0xbf, 0x86, 0xd9, 0x3c, 0x86, 0xd2, 0x05, 0xa5, 0xb1, 0xa6, 0xcd, 0x1c, 0xff, 0xf8, 0x9b, 0xeb,
+    0x38, 0x68, 0x96, 0xd7, 0xe8, 0x83, 0x86, 0x6b, 0xf5, 0x4a, 0x85, 0x26, 0xc3, 0x55, 0xb9, 0xdb,
+    0x95, 0x37, 0xdf, 0x1c, 0x31, 0x36, 0x15, 0xff, 0x65, 0x29, 0x20, 0xce, 0xe4, 0xf9, 0xb8, 0x6d,
+    0x34, 0xd7, 0x30, 0x2a, 0x56, 0x4e, 0x2d, 0xe0, 0xde, 0x63, 0x4f, 0xaa, 0xc1, 0x6d, 0x31, 0x9a,
+    0x43, 0x43, 0xac, 0xc2, 0x8f, 0x3a, 0xdf, 0x8a, 0xdb, 0x2e, 0xa3, 0x5f, 0x61, 0x8a, 0x46, 0x86,
+    0x07, 0xd4, 0xb3, 0x75, 0xa9, 0x28, 0x5f, 0xac, 0xc8, 0x40, 0xc8, 0xff, 0x4c, 0xe6, 0x96, 0xbd,
+    0x35, 0x96, 0x44, 0x5b, 0x50, 0x4c, 0x93, 0xcf, 0x6c, 0x15, 0x3c, 0x61, 0x95, 0xec, 0xf7, 0x7b,
+    0x32, 0xf6, 0xde, 0x0f, 0x62, 0x3e, 0xd5, 0x58, 0xf4, 0x3c, 0xd6, 0x6a, 0x62, 0x5c, 0x4c, 0xf7,
+    0x18, 0x8d, 0x50, 0xa4, 0x1d, 0x88, 0x7d
+};
+
+static const CHAR       test_name_suffix[] = "Authority 000";
+
+static UINT                             test_failures;
+static UCHAR                            test_der[TEST_ROOTS + 1][sizeof(test_root_der)];
+static NX_SECURE_X509_CERT              test_roots[TEST_ROOTS + 1];
+static NX_SECURE_X509_CERTIFICATE_STORE test_store;
+
+
+static VOID test_check(UINT condition, const CHAR *name, UINT count)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s, %u roots\n", name, count);
+        test_failures++;
+    }
+}
+
+
+/* Parse a copy of the root whose issuer and subject names end in the given number.  */
+
+static UINT test_root_initialize(UINT index, UINT number)
+{
+UINT    i;
+UINT    length = sizeof(test_name_suffix) - 1;
+
+    memcpy(test_der[index], test_root_der, sizeof(test_root_der));
+    for (i = 0; i + length <= sizeof(test_root_der); i++)
+    {
+        if (memcmp(&test_der[index][i], test_name_suffix, length) == 0)
+        {
+            test_der[index][i + length - 3] = (UCHAR)('0' + (number / 100));
+            test_der[index][i + length - 2] = (UCHAR)('0' + ((number / 10) % 10));
+            test_der[index][i + length - 1] = (UCHAR)('0' + (number % 10));
+        }
+    }
+
+    return(_nx_secure_x509_certificate_initialize(&test_roots[index], test_der[index], sizeof(test_root_der),
+                                                  NX_NULL, 0, NX_NULL, 0, NX_SECURE_X509_KEY_TYPE_NONE));
+}
+
+
+static double test_time_get(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec * 1e9 + (double)now.tv_nsec);
+}
+
+
+/* Look up every root by name, and return the time per lookup in nanoseconds.  */
+
+static double test_lookups(UINT count)
+{
+NX_SECURE_X509_CERT *certificate;
+UINT                 location;
+UINT                 round;
+UINT                 i;
+double               start;
+
+    start = test_time_get();
+    for (round = 0; round < TEST_ROUNDS; round++)
+    {
+        for (i = 0; i < count; i++)
+        {
+            certificate = NX_NULL;
+            if ((_nx_secure_x509_store_certificate_find(&test_store, &test_roots[i].nx_secure_x509_distinguished_name,
+                                                        0, &certificate, &location) != NX_SUCCESS) ||
+                (certificate != &test_roots[i]) || (location != NX_SECURE_X509_CERT_LOCATION_TRUSTED))
+            {
+                test_check(NX_FALSE, "root lookup", count);
+                return(0);
+            }
+        }
+    }
+
+    return((test_time_get() - start) / (TEST_ROUNDS * count));
+}
+
+
+static VOID test_store_check(UINT count)
+{
+NX_SECURE_X509_CERT *certificate;
+UINT                 location;
+UINT                 i;
+double               hashed;
+double               compared;
+
+    memset(&test_store, 0, sizeof(test_store));
+    for (i = 0; i < count; i++)
+    {
+        test_check(_nx_secure_x509_store_certificate_add(&test_roots[i], &test_store,
+                                                         NX_SECURE_X509_CERT_LOCATION_TRUSTED) == NX_SUCCESS,
+                   "root add", count);
+    }
+
+    /* A root with a name already in the store is rejected, with and without hashes.  */
+    test_check(test_root_initialize(TEST_ROOTS, count - 1) == NX_SUCCESS, "duplicate initialize", count);
+    test_check(_nx_secure_x509_store_certificate_add(&test_roots[TEST_ROOTS], &test_store,
+                                                     NX_SECURE_X509_CERT_LOCATION_TRUSTED) == NX_INVALID_PARAMETERS,
+               "duplicate add", count);
+    test_roots[TEST_ROOTS].nx_secure_x509_distinguished_name_hash = 0;
+    test_check(_nx_secure_x509_store_certificate_add(&test_roots[TEST_ROOTS], &test_store,
+                                                     NX_SECURE_X509_CERT_LOCATION_TRUSTED) == NX_INVALID_PARAMETERS,
+               "duplicate add without hash", count);
+
+    /* A name that was not loaded is not found.  */
+    test_check(test_root_initialize(TEST_ROOTS, count) == NX_SUCCESS, "missing initialize", count);
+    test_check(_nx_secure_x509_store_certificate_find(&test_store, &test_roots[TEST_ROOTS].nx_secure_x509_distinguished_name,
+                                                      0, &certificate, &location) == NX_SECURE_TLS_CERTIFICATE_NOT_FOUND,
+               "missing lookup", count);
+
+    hashed = test_lookups(count);
+
+    /* Without hashes every certificate is compared in full.  */
+    for (i = 0; i < count; i++)
+    {
+        test_roots[i].nx_secure_x509_distinguished_name_hash = 0;
+    }
+    compared = test_lookups(count);
+    for (i = 0; i < count; i++)
+    {
+        test_roots[i].nx_secure_x509_distinguished_name_hash =
+            _nx_secure_x509_distinguished_name_hash(&test_roots[i].nx_secure_x509_distinguished_name);
+    }
+
+    printf("%3u roots: %6.0f ns per lookup with name hashes, %6.0f ns without\n", count, hashed, compared);
+}
+
+
+int main(void)
+{
+UINT    i;
+
+    for (i = 0; i < TEST_ROOTS; i++)
+    {
+        test_check(test_root_initialize(i, i) == NX_SUCCESS, "root initialize", i);
+    }
+
+    test_store_check(50);
+    test_store_check(100);
+    test_store_check(TEST_ROOTS);
+
+    if (test_failures)
+    {
+        printf("nx_secure_x509_store_find_test: %u checks failed\n", test_failures);
+        return(1);
+    }
+    printf("nx_secure_x509_store_find_test: passed\n");
+    return(0);
+}
@@ -0,0 +1,423 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks the verified certificate cache. A device certificate issued by a test CA is
+   verified with _nx_secure_x509_certificate_chain_verify through an RSA method that counts its
+   operations. The first verification checks the signature and caches the pair, and later ones
+   within the validity period hit the cache, as does a lookup without a current time, which does
+   not age entries. Once the device certificate has expired the entry is dropped and the signature
+   is checked again. A CA with the same name but another key must not hit the cached pair. Finally,
+   a lookup from another thread waits while the TLS protection mutex is held, and the holder itself
+   can verify since the mutex nests. The certificates are RSA-2048 with SHA-256; the CA is valid
+   from 2020 to 2040 and the device certificate from 2021 to 2030. The time of a verification that
+   checks the signature and of one that hits the cache is reported.  */
+
+#include "tx_api.h"
+#include "nx_secure_tls_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+#define TEST_VALID_TIME         1700000000  /* November 2023.  */
+#define TEST_EXPIRED_TIME       1900000000  /* March 2030, after the device certificate expired.  */
+#define TEST_STACK_SIZE         4096
+#define TEST_ROUNDS             200
+
+
+static const UCHAR      test_ca_der[] =
+{
+    0x30, 0x82, 0x03, 0x13, 0x30, 0x82, 0x01, 0xfb, 0xa0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x01,
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x30,
+    0x2b, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65, 0x74, 0x58,
+    0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x15, 0x30, 0x13, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x0c,
+    0x4e, 0x65, 0x74, 0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x1e, 0x17, 0x0d,
+    0x32, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x17, 0x0d, 0x34,
+    0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x30, 0x2b, 0x31, 0x12,
+    0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65, 0x74, 0x58, 0x20, 0x54, 0x65,
+    0x73, 0x74, 0x31, 0x15, 0x30, 0x13, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x0c, 0x4e, 0x65, 0x74,
+    0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0d, 0x06,
+    0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x0f,
+    0x00, 0x30, 0x82, 0x01, 0x0a, 0x02, 0x82, 0x01, 0x01, 0x00, 0xb2, 0xdc, 0xef, 0x0f, 0x4b, 0xd0,
+    0xc8, 0xea, 0x6b, 0x1a, 0x2f, 0x3a, 0xce, 0x13, 0xd8, 0x15, 0x13, 0x4f, 0xc0, 0x84, 0x3d, 0xe9,
+    0x1b, 0xf2, 0x48, 0x0e, 0xdc, 0x4c, 0x47, 0x51, 0x3e, 0x14, 0x6d, 0x52, 0x9d, 0xc9, 0x98, 0x34,
+    0xf1, 0xfd, 0x52, 0x1d, 0x46, 0x02, 0x6a, 0xa0, 0x67, 0x7d, 0x96, 0xe6, 0x21, 0x66, 0x29, 0x79,
+    0x56, 0x15, 0x3e, 0x2c, 0xe9, 0x32, 0xd2, 0x4c, 0x65, 0x4a, 0xcb, 0x30, 0x1d, 0xd2, 0x87, 0x1d,
+    0xd2, 0x15, 0xef, 0x1e, 0xd2, 0x27, 0x1a, 0x49, 0xb8, 0x31, 0xa3, 0xf8, 0x6b, 0xe9, 0x4a, 0x52,
+    0x12, 0x1b, 0x7c, 0x4d, 0x55, 0x68, 0x57, 0x8b, 0x04, 0xaa, 0x50, 0x16, 0x7b, 0x3d, 0x84, 0x55,
+    0xa0, 0x34, 0x9d, 0xbd, 0xda, 0x39, 0x03, 0xf2, 0x6a, 0xca, 0x7e, 0xca, 0x9c, 0x5c, 0xda, 0x99,
+    0x13, 0xb1, 0xd8, 0x43, 0x9d, 0xd8, 0x02, 0x10, 0x9f, 0xf0, 0x6f, 0x88, 0xac, 0x03, 0xd9, 0xe8,
+    0xab, 0x4d, 0xe2, 0x72, 0xd9, 0x85, 0x19, 0x2e, 0xd9, 0xed, 0x1d, 0xc5, 0x81, 0x34, 0x55, 0x33,
+    0xba, 0x0d, 0x10, 0xf8, 0xbf, 0x00, 0x64, 0x45, 0x0f, 0x60, 0x0a, 0xd0, 0xbb, 0x06, 0x32, 0x38,
+    0x64, 0xda, 0xb0, 0xdf, 0x02, 0xac, 0x94, 0x69, 0x28, 0xaa, 0x45, 0xfa, 0xca, 0x43, 0xd6, 0x16,
+    0x49, 0x1b, 0x1f, 0xc7, 0x0d, 0xa4, 0x39, 0x31, 0xc8, 0xb2, 0x1d, 0x24, 0xf7, 0x72, 0x60, 0xea,
+    0x23, 0xe1, 0x68, 0x95, 0x70, 0x0e, 0x79, 0x2e, 0x7e, 0xd0, 0xde, 0x2f, 0x51, 0x58, 0x65, 0x70,
+    0x56, 0xc4, 0x95, 0xb8, 0x43, 0x5f, 0xe4, 0x4e, 0xc6, 0x87, 0x28, 0x72, 0xc9, 0x33, 0xd4, 0x6b,
+    0x0d, 0x6a, 0x43, 0xc9, 0xc2, 0xb2, 0xa9, 0x9c, 0x3a, 0xfe, 0x46, 0x6f, 0x47, 0xcc, 0x1a, 0xc1,
+    0x20, 0x73, 0xbf, 0x16, 0x69, 0xbc, 0x05, 0x1a, 0xe8, 0x1d, 0x02, 0x03, 0x01, 0x00, 0x01, 0xa3,
+    0x42, 0x30, 0x40, 0x30, 0x0f, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x01, 0x01, 0xff, 0x04, 0x05, 0x30,
+    0x03, 0x01, 0x01, 0xff, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04, 0x04,
+    0x03, 0x02, 0x02, 0x04, 0x30, 0x1d, 0x06, 0x03, 0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0xfa,
+    0xb0, 0x10, 0x19, 0x41, 0x4d, 0xc1, 0x43, 0xd5, 0xd0, 0xe7, 0xcb, 0x05, 0x80, 0xcd, 0xb8, 0xa3,
+    0xcc, 0xf6, 0x8f, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b,
+    0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0xb1, 0x03, 0xf2, 0x2a, 0xae, 0xe2, 0x41, 0xd2, 0x66,
+    0x38, 0x6d, 0x0f, 0xa0, 0xda, 0x11, 0xd0, 0x74, 0x21, 0x43, 0x74, 0x9c, 0x3b, 0xd5, 0x57, 0x02,
+    0x34, 0xf5, 0x2f, 0x66, 0x34, 0xbf, 0x5d, 0xec, 0x24, 0xee, 0xa8, 0xe9, 0x3b, 0x3f, 0xf0, 0xc1,
+    0x2c, 0x78, 0x1f, 0xa7, 0x6e, 0xb0, 0xcf, 0xbf, 0x12, 0x68, 0xdb, 0xa2, 0x51, 0x83, 0x80, 0xdf,
+    0xf9, 0xab, 0x53, 0x31, 0xad, 0x86, 0x25, 0x01, 0x04, 0x3c, 0xcd, 0x74, 0xeb, 0x40, 0xbc, 0x72,
+    0x82, 0xc9, 0xb2, 0x22, 0xd3, 0xd5, 0xba, 0xfe, 0xbb, 0xa5, 0xda, 0x61, 0x5c, 0x2d, 0x08, 0x28,
+    0x3d, 0xec, 0xb3, 0x25, 0x47, 0xa2, 0x22, 0x17, 0x19, 0x05, 0x9f, 0xf0, 0x5e, 0x44, 0xb4, 0xdc,
+    0xb7, 0xff, 0xdc, 0xe6, 0x31, 0x40, 0xea, 0xd0, 0x49, 0x93, 0x1e, 0xca, 0x2e, 0xf1, 0x4d, 0x07,
+    0x4f, 0x49, 0xfb, 0xc6, 0x36, 0x73, 0x20, 0x69, 0xff, 0x41, 0x5d, 0x49, 0xfe, 0x57, 0x9c, 0x50,
+    0x83, 0xd4, 0x92, 0x43, 0x79, 0x9f, 0x1a, 0xa6, 0xba, 0x8e, 0xdc, 0xaf, 0x67, 0x35, 0x6e, 0x38,
+    0x2b, 0xd8, 0x5d, 0x32, 0xc7, 0x2d, 0x69, 0x2c, 0x6c, 0xf6, 0x84, 0x07, 0x0c, 0xa2, 0xf6, 0xf9,
+    0x76, 0xb3, 0xdd, 0xe5, 0x29, 0xe5, 0xc8, 0x87, 0x6b, 0x6c, 0x4a, 0xa2, 0x67, 0x7b, 0x93, 0xdc,
+    0xe6, 0x93, 0xc7, 0x60, 0xbc, 0x23, 0xf4, 0xbd, 0x9d, 0xfd, 0xe0, 0x9b, 0xe0, 0xf9, 0x79, 0xc2,
+    0xb7, 0xf0, 0x55, 0x23, 0xaa, 0x4a, 0xb1, 0x9e, 0x92, 0xcd, 0x19, 0x0c, 0x22, 0xf8, 0xc5, 0x6a,
+    0xce, 0xf0, 0x43, 0xee, 0x82, 0xde, 0x75, 0xd7, 0x07, 0x37, 0x5c, 0x79, 0xd4, 0x86, 0x85, 0x39,
+    0x3f, 0x66, 0xbe, 0x6e, 0x79, 0xf3, 0xc9, 0xed, 0x4d, 0xa2, 0xbd, 0xbf, 0x58, 0x53, 0xc5, 0xd5,
+    0x5a, 0xcc, 0xb2, 0x96, 0xc5, 0x0d, 0x46
+};
+
+static const UCHAR      test_other_ca_der[] =
+{
+    0x30, 0x82, 0x03, 0x13, 0x30, 0x82, 0x01, 0xfb, 0xa0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x02,
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x30,
+    0x2b, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65, 0x74, 0x58,
+    0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x15, 0x30, 0x13, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x0c,
+    0x4e, 0x65, 0x74, 0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x1e, 0x17, 0x0d,
+    0x32, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x17, 0x0d, 0x34,
+    0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x30, 0x2b, 0x31, 0x12,
+    0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65, 0x74, 0x58, 0x20, 0x54, 0x65,
+    0x73, 0x74, 0x31, 0x15, 0x30, 0x13, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x0c, 0x4e, 0x65, 0x74,
+    0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0d, 0x06,
+    0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03, 0x82, 0x01, 0x0f,
+    0x00, 0x30, 0x82, 0x01, 0x0a, 0x02, 0x82, 0x01, 0x01, 0x00, 0x95, 0x4a, 0x24, 0x0a, 0x58, 0xbb,
+    0x87, 0xfa, 0xbe, 0x9a, 0x3d, 0xda, 0x05, 0x86, 0x2b, 0x2a, 0xe3, 0x4e, 0x7c, 0x99, 0x9a, 0x9b,
+    0xb8, 0xd3, 0x3e, 0x25, 0x04, 0x27, 0x26, 0x49, 0xef, 0x7b, 0x2e, 0xd1, 0x28, 0x62, 0x1c, 0xff,
+    0xc1, 0x17, 0x73, 0x6e, 0x61, 0xae, 0x5b, 0x28, 0x93, 0xed, 0xa6, 0xee, 0x0b, 0x5b, 0x98, 0x5d,
+    0xa0, 0x8b, 0x16, 0x51, 0x1f, 0xe4, 0xe1, 0x33, 0xc4, 0x67, 0xf0, 0xbf, 0x63, 0x6f, 0x89, 0xf4,
+    0xcf, 0xa0, 0xc7, 0x60, 0x31, 0xb4, 0xab, 0x39, 0x38, 0x58, 0x41, 0x90, 0x4b, 0x69, 0xee, 0xdf,
+    0x90, 0xe6, 0x4e, 0x53, 0xcb, 0xa1, 0xdb, 0xff, 0x00, 0xaa, 0x91, 0xee, 0x89, 0xd2, 0x02, 0xa7,
+    0x30, 0x0a, 0xa2, 0xe0, 0x9f, 0xf9, 0x2a, 0x8b, 0x4d, 0xba, 0xfd, 0x56, 0x07, 0x41, 0x5d, 0xea,
+    0xa1, 0x6b, 0x54, 0xbe, 0x9c, 0xa7, 0xd9, 0x64, 0xc3, 0x1f, 0xac, 0xf7, 0x9a, 0xde, 0x05, 0x73,
+    0x24, 0x29, 0xd0, 0x3e, 0xbe, 0x6a, 0x97, 0xec, 0xdc, 0x5b, 0xb9, 0x93, 0xff, 0xd3, 0x97, 0x8e,
+    0xa2, 0x60, 0x43, 0x89, 0xa5, 0x71, 0xcc, 0x1a, 0xdb, 0x9f, 0xf7, 0x53, 0x67, 0x76, 0xa0, 0x52,
+    0x6b, 0x6f, 0xa1, 0xd5, 0xf3, 0xf8, 0x41, 0xa9, 0x11, 0x18, 0xa0, 0x31, 0xc0, 0x06, 0x4b, 0x94,
+    0x4b, 0xb3, 0x99, 0x4d, 0x69, 0xa9, 0x49, 0xdb, 0x2d, 0x90, 0xcd, 0x4a, 0x93, 0xa0, 0x67, 0x48,
+    0xd7, 0xde, 0xca, 0xd6, 0xd0, 0xfb, 0x71, 0xe7, 0xe7, 0xc7, 0x04, 0x0e, 0xd4, 0xa0, 0xc6, 0x2e,
+    0x5d, 0x78, 0xaa, 0xaa, 0xa4, 0x9c, 0x1b, 0x02, 0x1a, 0xf1, 0xc4, 0x8a, 0x4a, 0x2d, 0x2f, 0x28,
+    0x41, 0xb9, 0x39, 0x46, 0x2f, 0x41, 0x87, 0xbf, 0xd0, 0xc7, 0x75, 0xf6, 0x5c, 0x23, 0x03, 0x5c,
+    0xd5, 0x03, 0x13, 0xee, 0x69, 0xf3, 0x6e, 0x63, 0x11, 0xbf, 0x02, 0x03, 0x01, 0x00, 0x01, 0xa3,
+    0x42, 0x30, 0x40, 0x30, 0x0f, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x01, 0x01, 0xff, 0x04, 0x05, 0x30,
+    0x03, 0x01, 0x01, 0xff, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04, 0x04,
+    0x03, 0x02, 0x02, 0x04, 0x30, 0x1d, 0x06, 0x03, 0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0x75,
+    0x30, 0xff, 0x9a, 0x53, 0x4b, 0xaa, 0x96, 0xa5, 0xfa, 0x7a, 0x10, 0xb3, 0x2e, 0x5a, 0x2a, 0xb0,
+    0x4b, 0x35, 0xa9, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b,
+    0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x70, 0xbf, 0x2c, 0xfc, 0xde, 0x9e, 0xbe, 0x67, 0x74,
+    0xd5, 0x2d, 0x0a, 0xb9, 0xc1, 0x03, 0x95, 0x73, 0x7c, 0x39, 0xb0, 0xf4, 0xf4, 0xa2, 0x66, 0x00,
+    0x48, 0xec, 0xb7, 0xcb, 0x16, 0x2d, 0xe9, 0xca, 0xd4, 0x6f, 0x53, 0x9a, 0xac, 0x28, 0x67, 0xdb,
+    0x57, 0x91, 0x9c, 0x23, 0xe3, 0x47, 0x6e, 0xeb, 0x95, 0x43, 0x47, 0xaf, 0x00, 0xa9, 0xa5, 0x21,
+    0x17, 0xb0, 0x19, 0x29, 0x3b, 0x55, 0xd3, 0xed, 0x66, 0x14, 0xd5, 0x7f, 0x71, 0x99, 0x98, 0x67,
+    0xca, 0xa2, 0xf4, 0xa0, 0xbe, 0x65, 0xe6, 0x4d, 0xc1, 0x46, 0x48, 0xd2, 0x56, 0xd1, 0x98, 0x2b,
+    0xaf, 0x4a, 0x44, 0xc7, 0x61, 0xa1, 0x6d, 0xa2, 0xcd, 0x10, 0x92, 0x95, 0x76, 0xe4, 0x14, 0xb7,
+    0x39, 0xff, 0xd8, 0x35, 0x10, 0x34, 0xe8, 0x4a, 0x8c, 0x63, 0x84, 0xd8, 0x8d, 0xfd, 0xd9, 0x7a,
+    0xde, 0x83, 0xdf, 0x05, 0xaa, 0xfd, 0xe5, 0x81, 0x01, 0xac, 0x37, 0x1d, 0x7c, 0x1d, 0xb9, 0x15,
+    0xb5, 0x00, 0x09, 0x28, 0x9f, 0x73, 0x62, 0x80, 0x14, 0xaa, 0xb3, 0x4b, 0xa7, 0xbf, 0xa9, 0x39,
+    0x89, 0x85, 0x3a, 0x8b, 0x2c, 0x4a, 0xa4, 0x3d, 0x4d, 0xe2, 0x13, 0x25, 0xd9, 0xfd, 0xe5, 0xf3,
+    0x54, 0xc5, 0x32, 0x4e, 0x83, 0x2d, 0xa5, 0x1c, 0x42, 0xf6, 0x12, 0x76, 0x14, 0x7f, 0x3e, 0x1b,
+    0x70, 0x18, 0x9c, 0x5b, 0xa2, 0x7e, 0x51, 0x0c, 0x2b, 0xbf, 0x74, 0x48, 0x5b, 0xdd, 0xc6, 0xab,
+    0xff, 0xf9, 0xf3, 0xd6, 0x5d, 0x14, 0xba, 0x29, 0x68, 0xaa, 0x7a, 0x65, 0x0d, 0xb6, 0xe7, 0x27,
+    0x49, 0xe6, 0x6d, 0x7d, 0x08, 0xe0, 0xb1, 0x11, 0x1b, 0x38, 0xdb, 0x51, 0x15, 0x06, 0x85, 0x60,
+    0x3e, 0x37, 0x6f, 0x4d, 0x7b, 0xd8, 0xca, 0x9d, 0x64, 0xcd, 0x8f, 0x80, 0x89, 0x61, 0x5d, 0x90,
+    0x73, 0x5d, 0x81, 0xbd, 0xcc, 0x3e, 0xbf
+};
+
+static const UCHAR      test_device_der[] =
+{
+    0x30, 0x82, 0x03, 0x32, 0x30, 0x82, 0x02, 0x1a, 0xa0, 0x03, 0x02, 0x01, 0x02, 0x02, 0x01, 0x03,
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x30,
+    0x2b, 0x31, 0x12, 0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65, 0x74, 0x58,
+    0x20, 0x54, 0x65, 0x73, 0x74, 0x31, 0x15, 0x30, 0x13, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x0c,
+    0x4e, 0x65, 0x74, 0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x1e, 0x17, 0x0d,
+    0x32, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x17, 0x0d, 0x33,
+    0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x30, 0x2f, 0x31, 0x12,
+    0x30, 0x10, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x09, 0x4e, 0x65, 0x74, 0x58, 0x20, 0x54, 0x65,
+    0x73, 0x74, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x10, 0x4e, 0x65, 0x74,
+    0x58, 0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65, 0x30, 0x82, 0x01,
+    0x22, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00,
+    0x03, 0x82, 0x01, 0x0f, 0x00, 0x30, 0x82, 0x01, 0x0a, 0x02, 0x82, 0x01, 0x01, 0x00, 0xc1, 0xa3,
+    0x8f, 0xac, 0xf6, 0x03, 0x98, 0x7d, 0xd6, 0x93, 0x23, 0x53, 0x8f, 0xe6, 0xde, 0x42, 0x96, 0x89,
+    0x90, 0xcc, 0xad, 0xfd, 0x1f, 0x02, 0x23, 0xc1, 0x0f, 0x26, 0x31, 0xee, 0x2d, 0x4d, 0x1a, 0x49,
+    0x7d, 0xd6, 0xef, 0x09, 0x82, 0xb0, 0x43, 0x6b, 0x47, 0x24, 0x09, 0x2b, 0x30, 0xab, 0x49, 0xe1,
+    0x1b, 0x3f, 0xe8, 0x69, 0xf1, 0x53, 0xa2, 0x7b, 0x3c, 0xcc, 0x82, 0xec, 0xe6, 0x05, 0x02, 0x55,
+    0x65, 0x81, 0xf7, 0xf4, 0x1d, 0xa6, 0x31, 0xac, 0xd2, 0xf4, 0x94, 0x81, 0x68, 0x17, 0x04, 0xc9,
+    0xf5, 0xce, 0x91, 0xca, 0x88, 0x5f, 0x13, 0x26, 0x0d, 0xf1, 0x33, 0x70, 0xdb, 0xbd, 0x3c, 0x6a,
+    0x19, 0xf2, 0x36, 0xb1, 0x7e, 0x19, 0xe1, 0x2b, 0x89, 0x1b, 0xf8, 0x81, 0x2b, 0xa2, 0x3a, 0x59,
+    0x91, 0x1d, 0xe6, 0xf6, 0x10, 0x2d, 0x80, 0x30, 0xc9, 0x9f, 0x7d, 0xb5, 0x1e, 0x85, 0xe4, 0x45,
+    0x30, 0xc8, 0x1a, 0x0d, 0x72, 0xd2, 0x28, 0xc5, 0x58, 0x4f, 0xb4, 0x37, 0xda, 0xbb, 0xb7, 0x00,
+    0xc9, 0xfd, 0x35, 0xed, 0xd9, 0x67, 0x0c, 0xf8, 0x86, 0xb1, 0x14, 0xd1, 0x9e, 0x38, 0x4e, 0xd4,
+    0xc5, 0xa2, 0x61, 0xc4, 0x23, 0xb7, 0xcc, 0x23, 0xfe, 0x57, 0x9b, 0xa9, 0x96, 0x5e, 0xab, 0xfe,
+    0xde, 0x63, 0xcd, 0x28, 0xf3, 0xac, 0xf7, 0x2e, 0x4a, 0x80, 0xb5, 0xa4, 0x27, 0x7b, 0xc4, 0xb1,
+    0x43, 0x8e, 0x96, 0xbf, 0x2c, 0xf3, 0xf4, 0x02, 0xa3, 0x76, 0xa6, 0xc1, 0xd7, 0x11, 0x81, 0xf0,
+    0x8c, 0x55, 0x02, 0x0a, 0x3b, 0x01, 0x35, 0x90, 0x7a, 0x76, 0x23, 0x46, 0x6f, 0x12, 0x1e, 0x01,
+    0xbd, 0x05, 0x44, 0xa3, 0x64, 0xaf, 0x9b, 0xe3, 0x8c, 0x69, 0x78, 0x16, 0x1f, 0xf1, 0x95, 0x54,
+    0xef, 0xe8, 0xec, 0xf0, 0x78, 0x1e, 0x86, 0x28, 0x76, 0x65, 0x13, 0x9d, 0x84, 0xfd, 0x02, 0x03,
+    0x01, 0x00, 0x01, 0xa3, 0x5d, 0x30, 0x5b, 0x30, 0x09, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x04, 0x02,
+    0x30, 0x00, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04, 0x04, 0x03, 0x02,
+    0x07, 0x80, 0x30, 0x1d, 0x06, 0x03, 0x55, 0x1d, 0x0e, 0x04, 0x16, 0x04, 0x14, 0x63, 0x8c, 0x4e,
+    0x38, 0x7e, 0xb9, 0x7a, 0x44, 0x00, 0x83, 0x37, 0x31, 0x9d, 0x48, 0xdf, 0xab, 0x6d, 0x48, 0x35,
+    0x53, 0x30, 0x1f, 0x06, 0x03, 0x55, 0x1d, 0x23, 0x04, 0x18, 0x30, 0x16, 0x80, 0x14, 0xfa, 0xb0,
+    0x10, 0x19, 0x41, 0x4d, 0xc1, 0x43, 0xd5, 0xd0, 0xe7, 0xcb, 0x05, 0x80, 0xcd, 0xb8, 0xa3, 0xcc,
+    0xf6, 0x8f, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05,
+    0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x8c, 0x65, 0x86, 0xdd, 0x19, 0x6f, 0xde, 0xab, 0xab, 0x01,
+    0x44, 0xc9, 0x0a, 0x19, 0x52, 0x1c, 0x3f, 0x8a, 0xf4, 0xe7, 0xad, 0xbf, 0x12, 0x51, 0x67, 0x9d,
+    0xec, 0xf1, 0x67, 0x15, 0x59, 0xa0, 0x86, 0x9e, 0x08, 0x92, 0x7f, 0xbb, 0x8f, 0x75, 0xbf, 0x80,
+    0xb7, 0x25, 0x0e, 0x6d, 0xc8, 0xaa, 0xb6, 0x06, 0x4a, 0xe8, 0xb6, 0xba, 0x16, 0xae, 0x64, 0xae,
+    0xef, 0x4c, 0x86, 0x5d, 0xc8, 0x9e, 0xdb, 0xe9, 0xfd, 0xe0, 0x00, 0x02, 0xa2, 0xbe, 0xf2, 0xf6,
+    0xe3, 0xf9, 0x0d, 0x3d, 0x2c, 0xde, 0x60, 0x2b, 0xdd, 0x12, 0x00, 0x1a, 0xf3, 0x84, 0xed, 0x4b,
+    0xe9, 0x08, 0x04, 0x4b, 0x67, 0x83, 0xd9, 0x09, 0x80, 0xd6, 0x62, 0xe4, 0x7e, 0xa8, 0xf8, 0x5c,
+    0x12, 0xee, 0x0e, 0x28, 0x7b, 0xa6, 0xa6, 0xa9, 0x23, 0x9b, 0x0c, 0xeb, 0x10, 0xfd, 0x6d, 0xf6,
+    0xd1, 0x18, 0x9d, 0x3e, 0xd2, 0x78, 0xc0, 0x36, 0x7b, 0xee, 0xf4, 0x70, 0x27, 0x7e, 0xbe, 0xa4,
+    0x56, 0xd1, 0x87, 0x72, 0x07, 0x93, 0x53, 0xb7, 0x41, 0xbd, 0xc5, 0xc2, 0xaa, 0xd0, 0x35, 0xc9,
+    0xcc, 0x2a, 0x4b, 0x77, 0x00, 0xa3, 0xbb, 0x8d, 0x39, 0xea, 0x8a, 0x42, 0x66, 0xda, 0x69, 0xa7,
+    0xc4, 0xb7, 0xa0, 0x96, 0x0a, 0x91, 0xf9, 0xf4, 0xe7, 0x60, 0xf7, 0x28, 0xa3, 0xcb, 0x93, 0x85,
+    0x46, 0x47, 0x4a, 0x90, 0x8b, 0x2c, 0xf3, 0x94, 0x17, 0xcf, 0x35, 0x3b, 0x7c, 0x0a, 0x89, 0x39,
+    0xe7, 0x24, 0xf9, 0xf1, 0xd1, 0x95, 0x88, 0x99, 0x91, 0x3d, 0x64, 0xb3, 0xf0, 0x61, 0xf6, 0xb7,
+    0xe9, 0x2f, 0xbe, 0x1c, 0x43, 0x27, 0x4b, 0x1e, 0xda, 0xf8, 0xd1, 0x2e, 0xcc, 0xaa, 0x78, 0x82,
+    0xd0, 0x18, 0x4a, 0xe6, 0xfd, 0xb7, 0x03, 0xfc, 0xa5, 0x5b, 0x38, 0xe4, 0x16, 0xa6, 0xec, 0xb0,
+    0xff, 0x7f, 0xc8, 0xa7, 0xc8, 0x9a
+};
+
+
+extern NX_CRYPTO_METHOD crypto_method_rsa;
+extern NX_CRYPTO_METHOD crypto_method_sha256;
+
+static UINT                             test_failures;
+static UINT                             test_rsa_operations;
+static NX_CRYPTO_METHOD                 test_rsa_method;
+static NX_SECURE_X509_CRYPTO            test_x509_ciphers[1];
+static ULONG                            test_public_cipher_metadata[16384 / sizeof(ULONG)];
+static ULONG                            test_hash_metadata[1024 / sizeof(ULONG)];
+static NX_SECURE_X509_CERT              test_ca;
+static NX_SECURE_X509_CERT              test_other_ca;
+static NX_SECURE_X509_CERT              test_device;
+static NX_SECURE_X509_CERTIFICATE_STORE test_store;
+static NX_SECURE_X509_CERTIFICATE_STORE test_other_store;
+static TX_THREAD                        test_thread;
+static TX_THREAD                        test_waiter_thread;
+static ULONG                            test_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+static ULONG                            test_waiter_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+static volatile UINT                    test_waiter_done;
+static UINT                             test_waiter_status;
+
+
+static VOID test_check(UINT condition, const CHAR *name)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s\n", name);
+        test_failures++;
+    }
+}
+
+
+/* Count the RSA operations, each of which is one signature check.  */
+
+static UINT test_rsa_operation(UINT op, VOID *handler, struct NX_CRYPTO_METHOD_STRUCT *method,
+                               UCHAR *key, NX_CRYPTO_KEY_SIZE key_size_in_bits,
+                               UCHAR *input, ULONG input_length_in_byte, UCHAR *iv_ptr,
+                               UCHAR *output, ULONG output_length_in_byte,
+                               VOID *crypto_metadata, ULONG crypto_metadata_size,
+                               VOID *packet_ptr, VOID (*nx_crypto_hw_process_callback)(VOID *, UINT))
+{
+
+    test_rsa_operations++;
+    return(crypto_method_rsa.nx_crypto_operation(op, handler, method, key, key_size_in_bits,
+                                                 input, input_length_in_byte, iv_ptr,
+                                                 output, output_length_in_byte,
+                                                 crypto_metadata, crypto_metadata_size,
+                                                 packet_ptr, nx_crypto_hw_process_callback));
+}
+
+
+static VOID test_certificate_initialize(NX_SECURE_X509_CERT *certificate, const UCHAR *data, USHORT length)
+{
+
+    test_check(_nx_secure_x509_certificate_initialize(certificate, (UCHAR *)data, length, NX_NULL, 0,
+                                                      NX_NULL, 0, NX_SECURE_X509_KEY_TYPE_NONE) == NX_SUCCESS,
+               "certificate initialize");
+    certificate -> nx_secure_x509_cipher_table = test_x509_ciphers;
+    certificate -> nx_secure_x509_cipher_table_size = 1;
+    certificate -> nx_secure_x509_public_cipher_metadata_area = test_public_cipher_metadata;
+    certificate -> nx_secure_x509_public_cipher_metadata_size = sizeof(test_public_cipher_metadata);
+    certificate -> nx_secure_x509_hash_metadata_area = test_hash_metadata;
+    certificate -> nx_secure_x509_hash_metadata_size = sizeof(test_hash_metadata);
+}
+
+
+/* Verify the device certificate against a store and check the number of signature checks.  */
+
+static VOID test_verify(NX_SECURE_X509_CERTIFICATE_STORE *store, ULONG current_time, UINT expected_status,
+                        UINT expected_operations, const CHAR *name)
+{
+UINT    status;
+
+    test_rsa_operations = 0;
+    status = _nx_secure_x509_certificate_chain_verify(store, &test_device, current_time);
+    if (status != expected_status)
+    {
+        printf("FAILED: %s, status 0x%x\n", name, status);
+        test_failures++;
+    }
+    if (test_rsa_operations != expected_operations)
+    {
+        printf("FAILED: %s, %u signature checks instead of %u\n", name, test_rsa_operations, expected_operations);
+        test_failures++;
+    }
+}
+
+
+static VOID test_waiter_entry(ULONG thread_input)
+{
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    test_waiter_status = _nx_secure_x509_certificate_chain_verify(&test_store, &test_device, TEST_VALID_TIME);
+    test_waiter_done = NX_TRUE;
+}
+
+
+static double test_time_get(VOID)
+{
+struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double)now.tv_sec * 1e9 + (double)now.tv_nsec);
+}
+
+
+/* Report the time of a verification that checks the signature, with the cache emptied before each
+   one, and of a verification that hits the cache.  */
+
+static VOID test_benchmark(VOID)
+{
+double  times[2];
+double  start;
+UINT    cached;
+UINT    round;
+
+    for (cached = 0; cached < 2; cached++)
+    {
+        start = test_time_get();
+        for (round = 0; round < TEST_ROUNDS; round++)
+        {
+            if (!cached)
+            {
+                memset(_nx_secure_x509_verified_cache, 0, sizeof(_nx_secure_x509_verified_cache));
+            }
+            _nx_secure_x509_certificate_chain_verify(&test_store, &test_device, TEST_VALID_TIME);
+        }
+        times[cached] = (test_time_get() - start) / TEST_ROUNDS / 1e3;
+    }
+    printf("RSA-2048 chain verification: signature checked %7.1f us, cached %7.1f us\n", times[0], times[1]);
+}
+
+
+static VOID test_entry(ULONG thread_input)
+{
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    nx_secure_tls_initialize();
+
+    test_rsa_method = crypto_method_rsa;
+    test_rsa_method.nx_crypto_operation = test_rsa_operation;
+    test_x509_ciphers[0].nx_secure_x509_crypto_identifier = NX_SECURE_TLS_X509_TYPE_RSA_SHA_256;
+    test_x509_ciphers[0].nx_secure_x509_public_cipher_method = &test_rsa_method;
+    test_x509_ciphers[0].nx_secure_x509_hash_method = &crypto_method_sha256;
+    test_check(crypto_method_rsa.nx_crypto_metadata_area_size <= sizeof(test_public_cipher_metadata),
+               "RSA metadata size");
+    test_check(crypto_method_sha256.nx_crypto_metadata_area_size <= sizeof(test_hash_metadata),
+               "SHA-256 metadata size");
+
+    test_certificate_initialize(&test_ca, test_ca_der, sizeof(test_ca_der));
+    test_certificate_initialize(&test_other_ca, test_other_ca_der, sizeof(test_other_ca_der));
+    test_certificate_initialize(&test_device, test_device_der, sizeof(test_device_der));
+    test_check(_nx_secure_x509_store_certificate_add(&test_ca, &test_store,
+                                                     NX_SECURE_X509_CERT_LOCATION_TRUSTED) == NX_SUCCESS,
+               "CA add");
+    test_check(_nx_secure_x509_store_certificate_add(&test_other_ca, &test_other_store,
+                                                     NX_SECURE_X509_CERT_LOCATION_TRUSTED) == NX_SUCCESS,
+               "other CA add");
+
+    /* The first verification checks the signature, later ones hit the cache.  */
+    test_verify(&test_store, TEST_VALID_TIME, NX_SUCCESS, 1, "first verification");
+    test_verify(&test_store, TEST_VALID_TIME, NX_SUCCESS, 0, "cached verification");
+
+    /* Without a current time the entry is not aged.  */
+    test_verify(&test_store, 0, NX_SUCCESS, 0, "cached verification without time");
+
+    /* A CA with the same name but another key does not hit the cached pair. The signature does not
+       decrypt to a valid encoding with its key. The cached pair is left alone.  */
+    test_verify(&test_other_store, TEST_VALID_TIME, NX_SECURE_X509_PKCS7_PARSING_FAILED, 1, "other CA");
+    test_verify(&test_store, TEST_VALID_TIME, NX_SUCCESS, 0, "cached verification after other CA");
+
+    /* Once the device certificate has expired the entry is dropped. The chain itself is still
+       verified, since expiration is checked by the caller, and the pair is cached again.  */
+    test_verify(&test_store, TEST_EXPIRED_TIME, NX_SUCCESS, 1, "expired verification");
+    test_verify(&test_store, TEST_EXPIRED_TIME, NX_SUCCESS, 1, "expired verification repeated");
+    test_verify(&test_store, TEST_VALID_TIME, NX_SUCCESS, 0, "cached verification after expiry");
+
+    /* A lookup waits while another thread holds the protection.  */
+    tx_mutex_get(&_nx_secure_tls_protection, TX_WAIT_FOREVER);
+    tx_thread_create(&test_waiter_thread, "waiter", test_waiter_entry, 0,
+                     test_waiter_thread_stack, sizeof(test_waiter_thread_stack), 1, 1,
+                     TX_NO_TIME_SLICE, TX_AUTO_START);
+    tx_thread_sleep(5);
+    test_check(test_waiter_done == NX_FALSE, "lookup waits for the protection");
+
+    /* The holder can verify, the protection nests.  */
+    test_verify(&test_store, TEST_VALID_TIME, NX_SUCCESS, 0, "cached verification holding the protection");
+    tx_mutex_put(&_nx_secure_tls_protection);
+    tx_thread_sleep(5);
+    test_check(test_waiter_done == NX_TRUE, "lookup completes after the protection is released");
+    test_check(test_waiter_status == NX_SUCCESS, "waiting lookup status");
+
+    test_benchmark();
+
+    if (test_failures)
+    {
+        printf("nx_secure_x509_verified_cache_test: %u checks failed\n", test_failures);
+        exit(1);
+    }
+    printf("nx_secure_x509_verified_cache_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    NX_PARAMETER_NOT_USED(first_unused_memory);
+
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
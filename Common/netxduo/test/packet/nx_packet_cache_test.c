@@ -0,0 +1,449 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks packet caches. A cache in front of a pool of 16 packets must refill a batch at a
+   time when it is empty, keep released packets up to its limit and return a batch beyond it, send
+   releases straight to the pool while the pool runs low, and give all of its packets back on a trim.
+   An empty pool must take back the packets of every cache before it fails, a thread waiting on the
+   pool must get a packet released to a cache, and deleting the pool deletes its caches. Then four
+   threads at one priority, with one tick time slices, allocate and release bursts of packets of a
+   pool of 48, straight from the pool and through caches of several batch sizes. The burst is first
+   up to 8 packets, then up to a quarter of the pool so every packet is needed. No allocation may
+   fail and every packet must go back to the pool. The test prints the cost of an allocate and
+   release pair, and the interrupt lockouts per pair and how long they are held. The lockouts are
+   timed by wrapping the lockout functions of the ThreadX Linux port at link time, and are printed
+   next to the time of an empty lockout.  */
+
+#include "tx_api.h"
+#include "nx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+#define TEST_STACK_SIZE         4096
+#define TEST_PAYLOAD_SIZE       256
+#define TEST_PACKETS            16
+#define TEST_BENCHMARK_PACKETS  48
+#define TEST_THREADS            4
+#define TEST_PAIRS              100000
+#define TEST_WORKER_PRIORITY    10
+#define TEST_EMPTY_LOCKOUTS     1000000
+
+
+static UINT                 test_failures;
+static NX_PACKET_POOL       test_pool;
+static ULONG                test_pool_memory[(TEST_BENCHMARK_PACKETS * (TEST_PAYLOAD_SIZE + sizeof(NX_PACKET))) /
+                                             sizeof(ULONG)];
+static NX_PACKET_CACHE      test_cache[TEST_THREADS];
+static TX_THREAD            test_thread;
+static TX_THREAD            test_worker_thread[TEST_THREADS];
+static ULONG                test_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+static ULONG                test_worker_thread_stack[TEST_THREADS][TEST_STACK_SIZE / sizeof(ULONG)];
+static TX_SEMAPHORE         test_done;
+static NX_PACKET           *test_packets[TEST_PACKETS];
+static NX_PACKET           *test_waiter_packet;
+static UINT                 test_waiter_status;
+static UINT                 test_use_cache;
+static ULONG                test_max_burst;
+static volatile ULONG       test_allocate_failures;
+static volatile ULONG       test_bad_packets;
+static volatile UINT        test_lockout_timing;
+static struct timespec      test_lockout_start;
+static double               test_lockout_time;
+static double               test_lockout_max;
+static ULONG                test_lockout_count;
+
+
+/* Define the lockout functions of the ThreadX Linux port, wrapped at link time to time the
+   outermost lockouts.  */
+
+UINT    __real__tx_thread_interrupt_disable(VOID);
+VOID    __real__tx_thread_interrupt_restore(UINT previous_posture);
+UINT    __wrap__tx_thread_interrupt_disable(VOID);
+VOID    __wrap__tx_thread_interrupt_restore(UINT previous_posture);
+
+
+UINT    __wrap__tx_thread_interrupt_disable(VOID)
+{
+UINT    previous_posture;
+
+    previous_posture = __real__tx_thread_interrupt_disable();
+    if ((previous_posture == TX_INT_ENABLE) && (test_lockout_timing))
+    {
+        clock_gettime(CLOCK_MONOTONIC, &test_lockout_start);
+    }
+    return(previous_posture);
+}
+
+
+VOID    __wrap__tx_thread_interrupt_restore(UINT previous_posture)
+{
+struct timespec lockout_end;
+double          lockout_time;
+
+    if ((previous_posture == TX_INT_ENABLE) && (test_lockout_timing))
+    {
+        clock_gettime(CLOCK_MONOTONIC, &lockout_end);
+        lockout_time = ((lockout_end.tv_sec - test_lockout_start.tv_sec) * 1e9) +
+                       (lockout_end.tv_nsec - test_lockout_start.tv_nsec);
+        test_lockout_time += lockout_time;
+        test_lockout_count++;
+        if (lockout_time > test_lockout_max)
+        {
+            test_lockout_max = lockout_time;
+        }
+    }
+    __real__tx_thread_interrupt_restore(previous_posture);
+}
+
+
+static VOID test_check(UINT condition, const CHAR *name)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s\n", name);
+        test_failures++;
+    }
+}
+
+
+static double test_time_get(VOID)
+{
+struct timespec time_now;
+
+    clock_gettime(CLOCK_MONOTONIC, &time_now);
+    return(time_now.tv_sec + (time_now.tv_nsec / 1e9));
+}
+
+
+/* Check the cached packets and the counters of a cache, and the free packets of the pool.  */
+
+static VOID test_cache_check(NX_PACKET_CACHE *cache_ptr, ULONG cached, ULONG hits, ULONG misses, ULONG refills,
+                             ULONG drains, ULONG bypasses, ULONG reclaims, ULONG available, const CHAR *name)
+{
+ULONG   statistics[7];
+
+    if ((nx_packet_cache_info_get(cache_ptr, &statistics[0], &statistics[1], &statistics[2], &statistics[3],
+                                  &statistics[4], &statistics[5], &statistics[6]) != NX_SUCCESS) ||
+        (statistics[0] != cached) || (statistics[1] != hits) || (statistics[2] != misses) ||
+        (statistics[3] != refills) || (statistics[4] != drains) || (statistics[5] != bypasses) ||
+        (statistics[6] != reclaims) || (test_pool.nx_packet_pool_available != available))
+    {
+        printf("FAILED: %s, cached %lu, hits %lu, misses %lu, refills %lu, drains %lu, bypasses %lu, reclaims %lu, "
+               "pool %lu\n", name, (unsigned long)statistics[0], (unsigned long)statistics[1],
+               (unsigned long)statistics[2], (unsigned long)statistics[3], (unsigned long)statistics[4],
+               (unsigned long)statistics[5], (unsigned long)statistics[6],
+               (unsigned long)test_pool.nx_packet_pool_available);
+        test_failures++;
+    }
+}
+
+
+static VOID test_waiter_entry(ULONG thread_input)
+{
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    test_waiter_status = nx_packet_cache_allocate(&test_cache[1], &test_waiter_packet, NX_UDP_PACKET, 100);
+    tx_semaphore_put(&test_done);
+}
+
+
+/* Allocate and release bursts of packets, from the pool or through the cache of the thread. Each
+   packet is marked with the thread, so a packet given to two threads at once is found.  */
+
+static VOID test_worker_entry(ULONG thread_input)
+{
+NX_PACKET  *held[TEST_BENCHMARK_PACKETS];
+ULONG       random;
+ULONG       pairs;
+ULONG       burst;
+ULONG       i;
+UINT        status;
+
+    random = 77 + thread_input;
+    pairs = 0;
+    while (pairs < TEST_PAIRS)
+    {
+        random = (random * 1103515245UL) + 12345UL;
+        burst = 1 + ((random >> 16) % test_max_burst);
+        for (i = 0; i < burst; i++)
+        {
+            if (test_use_cache)
+            {
+                status = nx_packet_cache_allocate(&test_cache[thread_input], &held[i], NX_UDP_PACKET, NX_NO_WAIT);
+            }
+            else
+            {
+                status = nx_packet_allocate(&test_pool, &held[i], NX_UDP_PACKET, NX_NO_WAIT);
+            }
+            if (status != NX_SUCCESS)
+            {
+                test_allocate_failures++;
+                break;
+            }
+            *(held[i] -> nx_packet_append_ptr) = (UCHAR)thread_input;
+            held[i] -> nx_packet_append_ptr++;
+            held[i] -> nx_packet_length = 1;
+        }
+        burst = i;
+        for (i = 0; i < burst; i++)
+        {
+            if (*(held[i] -> nx_packet_prepend_ptr) != (UCHAR)thread_input)
+            {
+                test_bad_packets++;
+            }
+            if (test_use_cache)
+            {
+                status = nx_packet_cache_release(&test_cache[thread_input], held[i]);
+            }
+            else
+            {
+                status = nx_packet_release(held[i]);
+            }
+            if (status != NX_SUCCESS)
+            {
+                test_bad_packets++;
+            }
+        }
+        pairs += (burst != 0) ? burst : 1;
+    }
+    tx_semaphore_put(&test_done);
+}
+
+
+/* Run the workers on a new pool, through caches if the batch size is not zero, and print the cost of
+   a pair and of its lockouts. A maximum burst of zero is a quarter of the pool.  */
+
+static VOID test_benchmark(const CHAR *name, ULONG batch_size, ULONG max_packets, ULONG max_burst)
+{
+ULONG   statistics[7];
+ULONG   totals[7];
+ULONG   available;
+ULONG   i;
+ULONG   j;
+double  start;
+double  elapsed;
+
+    test_check(nx_packet_pool_create(&test_pool, "benchmark pool", TEST_PAYLOAD_SIZE, test_pool_memory,
+                                     sizeof(test_pool_memory)) == NX_SUCCESS, "benchmark pool create");
+    test_use_cache = (batch_size != 0);
+    test_max_burst = (max_burst != 0) ? max_burst : (test_pool.nx_packet_pool_total / TEST_THREADS);
+    test_allocate_failures = 0;
+    test_bad_packets = 0;
+    for (i = 0; (i < TEST_THREADS) && (test_use_cache); i++)
+    {
+        test_check(nx_packet_cache_create(&test_cache[i], "benchmark cache", &test_pool, batch_size,
+                                          max_packets) == NX_SUCCESS, "benchmark cache create");
+    }
+
+    test_lockout_time = 0;
+    test_lockout_max = 0;
+    test_lockout_count = 0;
+    test_lockout_timing = NX_TRUE;
+    start = test_time_get();
+    for (i = 0; i < TEST_THREADS; i++)
+    {
+        tx_thread_create(&test_worker_thread[i], "worker", test_worker_entry, i, test_worker_thread_stack[i],
+                         sizeof(test_worker_thread_stack[i]), TEST_WORKER_PRIORITY, TEST_WORKER_PRIORITY, 1,
+                         TX_AUTO_START);
+    }
+    for (i = 0; i < TEST_THREADS; i++)
+    {
+        tx_semaphore_get(&test_done, TX_WAIT_FOREVER);
+    }
+    elapsed = test_time_get() - start;
+    test_lockout_timing = NX_FALSE;
+
+    printf("%-24s %6.1f ns/pair, %5.2f lockouts/pair, lockout held %6.1f ns, at most %8.1f ns\n", name,
+           (elapsed * 1e9) / (TEST_THREADS * (double)TEST_PAIRS), test_lockout_count / (TEST_THREADS * (double)TEST_PAIRS),
+           test_lockout_time / test_lockout_count, test_lockout_max);
+    test_check((test_allocate_failures == 0) && (test_bad_packets == 0), "every allocation and release");
+
+    /* A worker may not have completed yet after its put, so it is terminated before the delete.  */
+    for (i = 0; i < TEST_THREADS; i++)
+    {
+        tx_thread_terminate(&test_worker_thread[i]);
+        test_check(tx_thread_delete(&test_worker_thread[i]) == TX_SUCCESS, "worker delete");
+    }
+    if (test_use_cache)
+    {
+        for (j = 0; j < 7; j++)
+        {
+            totals[j] = 0;
+        }
+        for (i = 0; i < TEST_THREADS; i++)
+        {
+            nx_packet_cache_info_get(&test_cache[i], &statistics[0], &statistics[1], &statistics[2],
+                                     &statistics[3], &statistics[4], &statistics[5], &statistics[6]);
+            for (j = 0; j < 7; j++)
+            {
+                totals[j] += statistics[j];
+            }
+        }
+        available = test_pool.nx_packet_pool_available;
+        for (i = 0; i < TEST_THREADS; i++)
+        {
+            nx_packet_cache_trim(&test_cache[i]);
+            test_check(nx_packet_cache_delete(&test_cache[i]) == NX_SUCCESS, "benchmark cache delete");
+        }
+        printf("    cached %lu, hits %lu, misses %lu, refills %lu, drains %lu, bypasses %lu, reclaims %lu, "
+               "pool %lu before trim\n", (unsigned long)totals[0], (unsigned long)totals[1], (unsigned long)totals[2],
+               (unsigned long)totals[3], (unsigned long)totals[4], (unsigned long)totals[5], (unsigned long)totals[6],
+               (unsigned long)available);
+        test_check(available + totals[0] == test_pool.nx_packet_pool_total, "cached packets accounted for");
+    }
+    test_check(test_pool.nx_packet_pool_available == test_pool.nx_packet_pool_total, "every packet back in the pool");
+    test_check(nx_packet_pool_delete(&test_pool) == NX_SUCCESS, "benchmark pool delete");
+}
+
+
+static VOID test_entry(ULONG thread_input)
+{
+TX_INTERRUPT_SAVE_AREA
+NX_PACKET  *packet_ptr;
+ULONG       i;
+double      empty_lockout;
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    nx_system_initialize();
+    tx_semaphore_create(&test_done, "done", 0);
+    test_check(nx_packet_pool_create(&test_pool, "test pool", TEST_PAYLOAD_SIZE, test_pool_memory,
+                                     TEST_PACKETS * (TEST_PAYLOAD_SIZE + sizeof(NX_PACKET))) == NX_SUCCESS,
+               "pool create");
+    test_check(test_pool.nx_packet_pool_total == TEST_PACKETS, "pool packets");
+    test_check(nx_packet_cache_create(&test_cache[0], "cache", &test_pool, 4, 8) == NX_SUCCESS, "cache create");
+    test_check(nx_packet_cache_create(&test_cache[1], "other cache", &test_pool, 4, 8) == NX_SUCCESS,
+               "other cache create");
+    test_check(nx_packet_cache_create(&test_cache[2], "bad cache", &test_pool, 4, 2) == NX_SIZE_ERROR,
+               "limit below the batch size");
+
+    /* An empty cache refills a batch, and keeps the released packet.  */
+    test_check(nx_packet_cache_allocate(&test_cache[0], &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT) == NX_SUCCESS,
+               "cache allocate");
+    test_cache_check(&test_cache[0], 3, 1, 0, 1, 0, 0, 0, TEST_PACKETS - 4, "refill");
+    test_check(packet_ptr -> nx_packet_prepend_ptr == packet_ptr -> nx_packet_data_start + NX_UDP_PACKET,
+               "packet initialized");
+    test_check(nx_packet_cache_release(&test_cache[0], packet_ptr) == NX_SUCCESS, "cache release");
+    test_cache_check(&test_cache[0], 4, 1, 0, 1, 0, 0, 0, TEST_PACKETS - 4, "release kept");
+
+    /* Beyond its limit the cache returns a batch to the pool.  */
+    for (i = 0; i < 9; i++)
+    {
+        nx_packet_cache_allocate(&test_cache[0], &test_packets[i], NX_UDP_PACKET, NX_NO_WAIT);
+    }
+    test_cache_check(&test_cache[0], 3, 10, 0, 3, 0, 0, 0, TEST_PACKETS - 12, "refills");
+    for (i = 0; i < 9; i++)
+    {
+        nx_packet_cache_release(&test_cache[0], test_packets[i]);
+    }
+    test_cache_check(&test_cache[0], 8, 10, 0, 3, 1, 0, 0, TEST_PACKETS - 8, "drain over the limit");
+
+    /* A trim returns every packet.  */
+    test_check(nx_packet_cache_trim(&test_cache[0]) == NX_SUCCESS, "cache trim");
+    test_cache_check(&test_cache[0], 0, 10, 0, 3, 2, 0, 0, TEST_PACKETS, "trim");
+
+    /* An empty pool takes back the cached packets before it fails.  */
+    nx_packet_cache_allocate(&test_cache[0], &test_packets[0], NX_UDP_PACKET, NX_NO_WAIT);
+    for (i = 1; i < TEST_PACKETS - 3; i++)
+    {
+        nx_packet_allocate(&test_pool, &test_packets[i], NX_UDP_PACKET, NX_NO_WAIT);
+    }
+    test_cache_check(&test_cache[0], 3, 11, 0, 4, 2, 0, 0, 0, "pool empty");
+    for (; i < TEST_PACKETS; i++)
+    {
+        test_check(nx_packet_allocate(&test_pool, &test_packets[i], NX_UDP_PACKET, NX_NO_WAIT) == NX_SUCCESS,
+                   "allocate from the cached packets");
+    }
+    test_cache_check(&test_cache[0], 0, 11, 0, 4, 2, 0, 1, 0, "reclaim");
+    test_check(nx_packet_allocate(&test_pool, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT) == NX_NO_PACKET,
+               "no packet left");
+
+    /* A thread waiting on the pool gets a packet released to a cache.  */
+    tx_thread_create(&test_worker_thread[0], "waiter", test_waiter_entry, 0, test_worker_thread_stack[0],
+                     sizeof(test_worker_thread_stack[0]), 1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+    test_check(test_waiter_packet == NX_NULL, "cache miss waits on the pool");
+    nx_packet_cache_release(&test_cache[0], test_packets[0]);
+    tx_semaphore_get(&test_done, TX_WAIT_FOREVER);
+    test_check((test_waiter_status == NX_SUCCESS) && (test_waiter_packet != NX_NULL), "waiter served");
+    test_cache_check(&test_cache[0], 0, 11, 0, 4, 2, 1, 1, 0, "release to the waiter");
+    test_cache_check(&test_cache[1], 0, 0, 1, 0, 0, 0, 0, 0, "waiting cache miss");
+    tx_thread_delete(&test_worker_thread[0]);
+
+    /* While the pool runs low, releases go straight to the pool.  */
+    nx_packet_cache_release(&test_cache[1], test_waiter_packet);
+    nx_packet_cache_release(&test_cache[1], test_packets[1]);
+    test_cache_check(&test_cache[1], 0, 0, 1, 0, 0, 2, 0, 2, "bypass");
+    for (i = 2; i < TEST_PACKETS; i++)
+    {
+        nx_packet_cache_release(&test_cache[1], test_packets[i]);
+    }
+    test_cache_check(&test_cache[1], 8, 0, 1, 0, 1, 4, 0, 8, "bypass, then cached");
+
+    /* Deleting the pool deletes its caches.  */
+    test_check(nx_packet_pool_delete(&test_pool) == NX_SUCCESS, "pool delete");
+    test_check(nx_packet_cache_allocate(&test_cache[0], &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT) == NX_PTR_ERROR,
+               "cache deleted with the pool");
+    test_check(nx_packet_cache_trim(&test_cache[1]) == NX_PTR_ERROR, "other cache deleted with the pool");
+
+    /* Time an empty lockout, to compare with the lockouts of the benchmark.  */
+    test_lockout_time = 0;
+    test_lockout_count = 0;
+    test_lockout_timing = NX_TRUE;
+    for (i = 0; i < TEST_EMPTY_LOCKOUTS; i++)
+    {
+        TX_DISABLE
+        TX_RESTORE
+    }
+    test_lockout_timing = NX_FALSE;
+    empty_lockout = test_lockout_time / test_lockout_count;
+    printf("%d threads, %d packets of %d bytes, %d pairs per thread, empty lockout %.1f ns\n", TEST_THREADS,
+           TEST_BENCHMARK_PACKETS, TEST_PAYLOAD_SIZE, TEST_PAIRS, empty_lockout);
+
+    printf("bursts of 1 to 8 packets\n");
+    test_benchmark("pool", 0, 0, 8);
+    test_benchmark("cache batch 4, max 8", 4, 8, 8);
+    test_benchmark("cache batch 8, max 16", 8, 16, 8);
+    test_benchmark("cache batch 16, max 32", 16, 32, 8);
+    printf("bursts of up to a quarter of the pool, so every packet is needed\n");
+    test_benchmark("pool", 0, 0, 0);
+    test_benchmark("cache batch 4, max 8", 4, 8, 0);
+    test_benchmark("cache batch 8, max 16", 8, 16, 0);
+
+    if (test_failures)
+    {
+        printf("nx_packet_cache_test: %u checks failed\n", test_failures);
+        exit(1);
+    }
+    printf("nx_packet_cache_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    NX_PARAMETER_NOT_USED(first_unused_memory);
+
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
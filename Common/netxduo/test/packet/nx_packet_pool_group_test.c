@@ -0,0 +1,437 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks packet pool groups. A group of pools of 64, 320 and 1200 bytes, given out of
+   order, must serve each request from the smallest pool that fits, pass it up to a larger pool
+   once that pool is empty, and chain packets of the largest pools with free packets once no single
+   packet fits. The data appended to a chain must read back in order, and a caller that waits is
+   served by the best fitting pool when a packet is released. The statistics of each pool must count
+   every case. Then a mixed workload of 2 to 1399 byte payloads, held for up to 40 allocations, runs
+   on a single pool of 20 packets of 1200 bytes and on two groups in about the same RAM. It prints
+   the exhaustion rate, the share of the allocated payload that was requested and the cost per
+   allocation, and checks that the groups run dry less often and waste less of their payload.  */
+
+#include "tx_api.h"
+#include "nx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+#define TEST_STACK_SIZE         4096
+#define TEST_POOL_MEMORY        32768
+#define TEST_SMALL_PACKETS      8
+#define TEST_MEDIUM_PACKETS     4
+#define TEST_LARGE_PACKETS      2
+#define TEST_WORKLOAD_STEPS     200000
+#define TEST_WORKLOAD_LIFE      40
+#define TEST_WORKLOAD_LIVE      (TEST_WORKLOAD_LIFE + 1)
+
+
+static UINT                 test_failures;
+static NX_PACKET_POOL       test_pool[NX_PACKET_POOL_GROUP_MAX_POOLS];
+static ULONG                test_pool_memory[NX_PACKET_POOL_GROUP_MAX_POOLS][TEST_POOL_MEMORY / sizeof(ULONG)];
+static NX_PACKET_POOL_GROUP test_group;
+static TX_THREAD            test_thread;
+static TX_THREAD            test_waiter_thread;
+static ULONG                test_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+static ULONG                test_waiter_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+static NX_PACKET           *test_packets[TEST_SMALL_PACKETS + TEST_MEDIUM_PACKETS + TEST_LARGE_PACKETS];
+static NX_PACKET           *test_waiter_packet;
+static UINT                 test_waiter_status;
+static UCHAR                test_data[1500];
+static UCHAR                test_read_back[1500];
+static ULONG                test_random;
+static NX_PACKET           *test_live_packet[TEST_WORKLOAD_LIVE];
+static ULONG                test_live_until[TEST_WORKLOAD_LIVE];
+
+
+static VOID test_check(UINT condition, const CHAR *name)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s\n", name);
+        test_failures++;
+    }
+}
+
+
+/* Create the packet pools of a test and the group over them. The payload sizes are given in any
+   order.  */
+
+static VOID test_group_create(UINT pool_count, const ULONG *payload_size, const ULONG *packets)
+{
+NX_PACKET_POOL *pool_list[NX_PACKET_POOL_GROUP_MAX_POOLS];
+UINT            i;
+
+    for (i = 0; i < pool_count; i++)
+    {
+        test_check(nx_packet_pool_create(&test_pool[i], "test pool", payload_size[i], test_pool_memory[i],
+                                         (payload_size[i] + sizeof(NX_PACKET)) * packets[i]) == NX_SUCCESS,
+                   "pool create");
+        test_check(test_pool[i].nx_packet_pool_total == packets[i], "pool packets");
+        pool_list[i] = &test_pool[i];
+    }
+    test_check(nx_packet_pool_group_create(&test_group, "test group", pool_list, pool_count) == NX_SUCCESS,
+               "group create");
+}
+
+
+static VOID test_group_delete(UINT pool_count)
+{
+UINT    i;
+
+    test_check(nx_packet_pool_group_delete(&test_group) == NX_SUCCESS, "group delete");
+    for (i = 0; i < pool_count; i++)
+    {
+        test_check(test_pool[i].nx_packet_pool_available == test_pool[i].nx_packet_pool_total,
+                   "every packet back in its pool");
+        test_check(nx_packet_pool_delete(&test_pool[i]) == NX_SUCCESS, "pool delete");
+    }
+}
+
+
+/* Check the statistics of the pool at an index of the group.  */
+
+static VOID test_pool_statistics(UINT pool_index, ULONG payload_size, ULONG best_fit, ULONG larger,
+                                 ULONG chained, ULONG empty, const CHAR *name)
+{
+NX_PACKET_POOL *pool_ptr;
+ULONG           best_fit_allocations;
+ULONG           larger_allocations;
+ULONG           chained_packets;
+ULONG           empty_requests;
+
+    if ((nx_packet_pool_group_info_get(&test_group, pool_index, &pool_ptr, &best_fit_allocations,
+                                       &larger_allocations, &chained_packets, &empty_requests) != NX_SUCCESS) ||
+        (pool_ptr -> nx_packet_pool_payload_size != payload_size) ||
+        (best_fit_allocations != best_fit) || (larger_allocations != larger) ||
+        (chained_packets != chained) || (empty_requests != empty))
+    {
+        printf("FAILED: %s, pool %u\n", name, pool_index);
+        test_failures++;
+    }
+}
+
+
+/* Allocate a packet of the group for a payload and append the payload, then check that it reads
+   back. It returns the packet, or NX_NULL if the group had no room.  */
+
+static NX_PACKET *test_allocate(ULONG packet_type, ULONG payload_size, ULONG wait_option)
+{
+NX_PACKET  *packet_ptr;
+ULONG       bytes;
+ULONG       i;
+
+    if (nx_packet_pool_group_allocate(&test_group, &packet_ptr, packet_type, payload_size, wait_option) != NX_SUCCESS)
+    {
+        return(NX_NULL);
+    }
+    for (i = 0; i < payload_size; i++)
+    {
+        test_data[i] = (UCHAR)(test_random + (i * 7));
+    }
+    if ((nx_packet_data_append(packet_ptr, test_data, payload_size, &test_pool[0], NX_NO_WAIT) != NX_SUCCESS) ||
+        (nx_packet_data_retrieve(packet_ptr, test_read_back, &bytes) != NX_SUCCESS) ||
+        (bytes != payload_size) || (memcmp(test_read_back, test_data, payload_size) != 0))
+    {
+        printf("FAILED: payload of %lu bytes read back\n", (unsigned long)payload_size);
+        test_failures++;
+    }
+    return(packet_ptr);
+}
+
+
+static VOID test_waiter_entry(ULONG thread_input)
+{
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    test_waiter_status = nx_packet_pool_group_allocate(&test_group, &test_waiter_packet, NX_RECEIVE_PACKET,
+                                                       200, 100);
+}
+
+
+static ULONG test_random_get(VOID)
+{
+
+    test_random = (test_random * 1103515245UL) + 12345UL;
+    return((test_random >> 8) & 0xFFFFFF);
+}
+
+
+/* Pick a payload size of the workload: 30% 2-4 bytes, 20% 48 bytes, 15% 64-127 bytes, 25% 200-599
+   bytes and 10% 1000-1399 bytes.  */
+
+static ULONG test_payload_size_get(VOID)
+{
+ULONG   share;
+
+    share = test_random_get() % 100;
+    if (share < 30)
+    {
+        return(2 + (test_random_get() % 3));
+    }
+    if (share < 50)
+    {
+        return(48);
+    }
+    if (share < 65)
+    {
+        return(64 + (test_random_get() % 64));
+    }
+    if (share < 90)
+    {
+        return(200 + (test_random_get() % 400));
+    }
+    return(1000 + (test_random_get() % 400));
+}
+
+
+/* Run the mixed workload on a group, and return its exhaustion rate in percent. The efficiency is
+   returned through a pointer.  */
+
+static double test_workload(const CHAR *name, UINT pool_count, const ULONG *payload_size, const ULONG *packets,
+                            double *efficiency)
+{
+NX_PACKET_POOL *pool_ptr;
+struct timespec time_start;
+struct timespec time_end;
+ULONG           memory;
+ULONG           step;
+ULONG           failures;
+ULONG           statistics[4];
+UINT            live;
+UINT            i;
+double          exhaustion;
+
+    test_group_create(pool_count, payload_size, packets);
+    memory = 0;
+    for (i = 0; i < pool_count; i++)
+    {
+        memory += (payload_size[i] + sizeof(NX_PACKET)) * packets[i];
+    }
+
+    /* Each step releases the packets whose time is up, and holds a new packet for 1 to 40 steps.  */
+    test_random = 12345;
+    live = 0;
+    failures = 0;
+    clock_gettime(CLOCK_MONOTONIC, &time_start);
+    for (step = 0; step < TEST_WORKLOAD_STEPS; step++)
+    {
+        for (i = 0; i < live;)
+        {
+            if (test_live_until[i] <= step)
+            {
+                nx_packet_release(test_live_packet[i]);
+                live--;
+                test_live_packet[i] = test_live_packet[live];
+                test_live_until[i] = test_live_until[live];
+            }
+            else
+            {
+                i++;
+            }
+        }
+        test_live_packet[live] = test_allocate(NX_TCP_PACKET, test_payload_size_get(), NX_NO_WAIT);
+        if (test_live_packet[live] == NX_NULL)
+        {
+            failures++;
+            continue;
+        }
+        test_live_until[live] = step + 1 + (test_random_get() % TEST_WORKLOAD_LIFE);
+        live++;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &time_end);
+
+    exhaustion = (100.0 * failures) / TEST_WORKLOAD_STEPS;
+    *efficiency = (100.0 * test_group.nx_packet_pool_group_requested_bytes) /
+                  test_group.nx_packet_pool_group_allocated_bytes;
+    test_check(test_group.nx_packet_pool_group_failed_allocations == failures, "failed allocations");
+    printf("%-36s RAM %6lu bytes, exhaustion %6.2f%%, efficiency %5.1f%%, chained %5.2f%%, %4.0f ns/allocation\n",
+           name, (unsigned long)memory, exhaustion, *efficiency,
+           (100.0 * test_group.nx_packet_pool_group_chained_allocations) / (TEST_WORKLOAD_STEPS - failures),
+           (((time_end.tv_sec - time_start.tv_sec) * 1e9) + (time_end.tv_nsec - time_start.tv_nsec)) /
+           TEST_WORKLOAD_STEPS);
+    for (i = 0; i < pool_count; i++)
+    {
+        nx_packet_pool_group_info_get(&test_group, i, &pool_ptr, &statistics[0], &statistics[1],
+                                      &statistics[2], &statistics[3]);
+        printf("    pool %4lu x %2lu: best fit %6lu, larger %6lu, chained %6lu, empty %6lu\n",
+               (unsigned long)pool_ptr -> nx_packet_pool_payload_size, (unsigned long)pool_ptr -> nx_packet_pool_total,
+               (unsigned long)statistics[0], (unsigned long)statistics[1], (unsigned long)statistics[2],
+               (unsigned long)statistics[3]);
+    }
+
+    while (live)
+    {
+        live--;
+        nx_packet_release(test_live_packet[live]);
+    }
+    test_group_delete(pool_count);
+    return(exhaustion);
+}
+
+
+static VOID test_entry(ULONG thread_input)
+{
+static const ULONG  test_sizes[3] = { 320, 1200, 64 };
+static const ULONG  test_counts[3] = { TEST_MEDIUM_PACKETS, TEST_LARGE_PACKETS, TEST_SMALL_PACKETS };
+static const ULONG  single_sizes[1] = { 1200 };
+static const ULONG  single_counts[1] = { 20 };
+static const ULONG  group_sizes[3] = { 64, 320, 1200 };
+static const ULONG  group_counts[3] = { 22, 16, 12 };
+static const ULONG  other_group_sizes[3] = { 128, 512, 1200 };
+static const ULONG  other_group_counts[3] = { 24, 12, 10 };
+NX_PACKET          *packet_ptr;
+UINT                count;
+UINT                i;
+double              single_exhaustion;
+double              single_efficiency;
+double              group_exhaustion;
+double              group_efficiency;
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    nx_system_initialize();
+
+    /* The pools are ordered by payload size.  */
+    test_group_create(3, test_sizes, test_counts);
+    test_pool_statistics(0, 64, 0, 0, 0, 0, "pool order");
+    test_pool_statistics(1, 320, 0, 0, 0, 0, "pool order");
+    test_pool_statistics(2, 1200, 0, 0, 0, 0, "pool order");
+
+    /* Each request is served by the smallest pool that fits.  */
+    test_packets[0] = test_allocate(NX_RECEIVE_PACKET, 48, NX_NO_WAIT);
+    test_packets[1] = test_allocate(NX_RECEIVE_PACKET, 300, NX_NO_WAIT);
+    test_packets[2] = test_allocate(NX_RECEIVE_PACKET, 1000, NX_NO_WAIT);
+    test_check((test_packets[0] != NX_NULL) && (test_packets[0] -> nx_packet_pool_owner == &test_pool[2]),
+               "48 bytes from the 64 byte pool");
+    test_check((test_packets[1] != NX_NULL) && (test_packets[1] -> nx_packet_pool_owner == &test_pool[0]),
+               "300 bytes from the 320 byte pool");
+    test_check((test_packets[2] != NX_NULL) && (test_packets[2] -> nx_packet_pool_owner == &test_pool[1]),
+               "1000 bytes from the 1200 byte pool");
+    test_pool_statistics(0, 64, 1, 0, 0, 0, "best fit");
+    test_pool_statistics(1, 320, 1, 0, 0, 0, "best fit");
+    test_pool_statistics(2, 1200, 1, 0, 0, 0, "best fit");
+    for (i = 0; i < 3; i++)
+    {
+        nx_packet_release(test_packets[i]);
+    }
+
+    /* Once the small pool is empty, small requests go to the next larger pool.  */
+    for (i = 0; i < TEST_SMALL_PACKETS; i++)
+    {
+        test_packets[i] = test_allocate(NX_RECEIVE_PACKET, 16, NX_NO_WAIT);
+    }
+    packet_ptr = test_allocate(NX_RECEIVE_PACKET, 16, NX_NO_WAIT);
+    test_check((packet_ptr != NX_NULL) && (packet_ptr -> nx_packet_pool_owner == &test_pool[0]),
+               "small request passed up to the 320 byte pool");
+    test_pool_statistics(0, 64, 1 + TEST_SMALL_PACKETS, 0, 0, 1, "passed up");
+    test_pool_statistics(1, 320, 1, 1, 0, 0, "passed up");
+    nx_packet_release(packet_ptr);
+    for (i = 0; i < TEST_SMALL_PACKETS; i++)
+    {
+        nx_packet_release(test_packets[i]);
+    }
+
+    /* Once the large pool is empty, a large request is a chain of the largest free packets.  */
+    for (i = 0; i < TEST_LARGE_PACKETS; i++)
+    {
+        test_packets[i] = test_allocate(NX_RECEIVE_PACKET, 1000, NX_NO_WAIT);
+    }
+    packet_ptr = test_allocate(NX_RECEIVE_PACKET, 1000, NX_NO_WAIT);
+    count = 0;
+    if (packet_ptr != NX_NULL)
+    {
+        test_check(packet_ptr -> nx_packet_pool_owner == &test_pool[0], "chain starts in the 320 byte pool");
+        for (test_packets[TEST_LARGE_PACKETS] = packet_ptr; test_packets[TEST_LARGE_PACKETS] != NX_NULL;
+             test_packets[TEST_LARGE_PACKETS] = test_packets[TEST_LARGE_PACKETS] -> nx_packet_next)
+        {
+            count++;
+        }
+    }
+    test_check(count == 4, "1000 bytes chained from four 320 byte packets");
+    test_check(test_group.nx_packet_pool_group_chained_allocations == 1, "chained allocations");
+    test_pool_statistics(1, 320, 1, 1, 4, 0, "chained");
+    test_pool_statistics(2, 1200, 1 + TEST_LARGE_PACKETS, 0, 0, 1, "chained");
+    nx_packet_release(packet_ptr);
+
+    /* With every packet allocated, the request fails, or waits for the best fitting pool.  */
+    for (i = 0; i < TEST_MEDIUM_PACKETS; i++)
+    {
+        test_packets[TEST_LARGE_PACKETS + i] = test_allocate(NX_RECEIVE_PACKET, 200, NX_NO_WAIT);
+    }
+    for (i = 0; i < TEST_SMALL_PACKETS; i++)
+    {
+        test_packets[TEST_LARGE_PACKETS + TEST_MEDIUM_PACKETS + i] = test_allocate(NX_RECEIVE_PACKET, 16,
+                                                                                   NX_NO_WAIT);
+    }
+    test_check(test_allocate(NX_RECEIVE_PACKET, 16, NX_NO_WAIT) == NX_NULL, "no packet left");
+    test_check(test_group.nx_packet_pool_group_failed_allocations == 1, "failed allocations");
+    tx_thread_create(&test_waiter_thread, "waiter", test_waiter_entry, 0,
+                     test_waiter_thread_stack, sizeof(test_waiter_thread_stack), 1, 1,
+                     TX_NO_TIME_SLICE, TX_AUTO_START);
+    test_check(test_waiter_packet == NX_NULL, "request waits for the best fitting pool");
+    nx_packet_release(test_packets[TEST_LARGE_PACKETS]);
+    test_check((test_waiter_status == NX_SUCCESS) && (test_waiter_packet != NX_NULL) &&
+               (test_waiter_packet -> nx_packet_pool_owner == &test_pool[0]),
+               "waiting request served by the released packet");
+    nx_packet_release(test_waiter_packet);
+    for (i = 0; i < TEST_SMALL_PACKETS + TEST_MEDIUM_PACKETS + TEST_LARGE_PACKETS; i++)
+    {
+        if ((i != TEST_LARGE_PACKETS) && (test_packets[i] != NX_NULL))
+        {
+            nx_packet_release(test_packets[i]);
+        }
+    }
+    tx_thread_delete(&test_waiter_thread);
+    test_group_delete(3);
+
+    /* The groups run dry less often than a single pool in about the same RAM, and waste less.  */
+    single_exhaustion = test_workload("single 20 x 1200", 1, single_sizes, single_counts, &single_efficiency);
+    group_exhaustion = test_workload("group 22 x 64, 16 x 320, 12 x 1200", 3, group_sizes, group_counts,
+                                     &group_efficiency);
+    test_check((group_exhaustion < single_exhaustion) && (group_efficiency > single_efficiency),
+               "group against a single pool");
+    group_exhaustion = test_workload("group 24 x 128, 12 x 512, 10 x 1200", 3, other_group_sizes,
+                                     other_group_counts, &group_efficiency);
+    test_check((group_exhaustion < single_exhaustion) && (group_efficiency > single_efficiency),
+               "other group against a single pool");
+
+    if (test_failures)
+    {
+        printf("nx_packet_pool_group_test: %u checks failed\n", test_failures);
+        exit(1);
+    }
+    printf("nx_packet_pool_group_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    NX_PARAMETER_NOT_USED(first_unused_memory);
+
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
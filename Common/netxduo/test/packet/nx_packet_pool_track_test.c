@@ -0,0 +1,363 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks packet tracking. A thread that keeps 5 packets, one that allocates and releases
+   1000 and one that holds a packet for 20 ticks must each be counted as an owner of the pool, with
+   their live packets, allocations, longest hold and oldest packet, and the pool must record the
+   fewest packets it had available. Once the owner table is full, the allocations of new threads are
+   counted as untracked and their releases leave the owners alone. A thread waiting on an empty pool
+   is charged for the packet it gets on a release, and deleting the pool reports only the thread that
+   still holds packets. The test is also built without packet tracking, where the tracking services
+   are not supported. Both builds print the cost of an allocate and release pair, so the cost of the
+   tracking can be compared.  */
+
+#include "tx_api.h"
+#include "nx_api.h"
+#include "nx_packet.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+#define TEST_STACK_SIZE         4096
+#define TEST_PAYLOAD_SIZE       256
+#define TEST_PACKETS            32
+#define TEST_OWNER_THREADS      12
+#define TEST_LEAKED_PACKETS     5
+#define TEST_RELEASED_PAIRS     1000
+#define TEST_HOLD_TICKS         20
+#define TEST_BENCHMARK_PAIRS    2000000
+#define TEST_WORKER_PRIORITY    10
+#define TEST_WAITER_PRIORITY    5
+
+
+static UINT                 test_failures;
+static NX_PACKET_POOL       test_pool;
+static ULONG                test_pool_memory[(TEST_PACKETS * (TEST_PAYLOAD_SIZE + sizeof(NX_PACKET))) /
+                                             sizeof(ULONG)];
+static TX_THREAD            test_thread;
+static ULONG                test_thread_stack[TEST_STACK_SIZE / sizeof(ULONG)];
+static TX_SEMAPHORE         test_done;
+#ifdef NX_ENABLE_PACKET_TRACKING
+static TX_THREAD            test_owner_thread[TEST_OWNER_THREADS];
+static ULONG                test_owner_thread_stack[TEST_OWNER_THREADS][TEST_STACK_SIZE / sizeof(ULONG)];
+static NX_PACKET           *test_leaked_packets[TEST_LEAKED_PACKETS];
+static NX_PACKET           *test_kept_packets[TEST_OWNER_THREADS];
+static NX_PACKET           *test_pool_packets[TEST_PACKETS];
+static UINT                 test_waiter_status;
+static UINT                 test_reports;
+static TX_THREAD           *test_report_thread;
+static ULONG                test_report_live;
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
+
+static VOID test_check(UINT condition, const CHAR *name)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s\n", name);
+        test_failures++;
+    }
+}
+
+
+static double test_time_get(VOID)
+{
+struct timespec time_now;
+
+    clock_gettime(CLOCK_MONOTONIC, &time_now);
+    return(time_now.tv_sec + (time_now.tv_nsec / 1e9));
+}
+
+
+/* Print the cost of an allocate and release pair on a new pool, without the error checks.  */
+
+static VOID test_benchmark(VOID)
+{
+NX_PACKET  *packet_ptr;
+ULONG       i;
+double      start;
+
+    test_check(nx_packet_pool_create(&test_pool, "benchmark pool", TEST_PAYLOAD_SIZE, test_pool_memory,
+                                     sizeof(test_pool_memory)) == NX_SUCCESS, "benchmark pool create");
+    start = test_time_get();
+    for (i = 0; i < TEST_BENCHMARK_PAIRS; i++)
+    {
+        _nx_packet_allocate(&test_pool, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT);
+        _nx_packet_release(packet_ptr);
+    }
+    printf("allocate and release: %.1f ns/pair\n", ((test_time_get() - start) * 1e9) / TEST_BENCHMARK_PAIRS);
+    test_check(nx_packet_pool_delete(&test_pool) == NX_SUCCESS, "benchmark pool delete");
+}
+
+
+#ifdef NX_ENABLE_PACKET_TRACKING
+
+/* Print an owner and remember the last one reported.  */
+
+static VOID test_report(NX_PACKET_POOL *pool_ptr, TX_THREAD *owner_thread, ULONG live_packets,
+                        ULONG max_live_packets, ULONG allocations, ULONG max_hold_ticks, ULONG oldest_hold_ticks)
+{
+
+    NX_PARAMETER_NOT_USED(pool_ptr);
+
+    printf("    %-8s live %lu, max live %lu, allocations %lu, max hold %lu, oldest %lu ticks\n",
+           (owner_thread != NX_NULL) ? owner_thread -> tx_thread_name : "(isr)", (unsigned long)live_packets,
+           (unsigned long)max_live_packets, (unsigned long)allocations, (unsigned long)max_hold_ticks,
+           (unsigned long)oldest_hold_ticks);
+    test_reports++;
+    test_report_thread = owner_thread;
+    test_report_live = live_packets;
+}
+
+
+/* Keep packets without releasing them.  */
+
+static VOID test_leaker_entry(ULONG thread_input)
+{
+ULONG       i;
+
+    for (i = 0; i < thread_input; i++)
+    {
+        nx_packet_allocate(&test_pool, &test_leaked_packets[i], NX_UDP_PACKET, NX_NO_WAIT);
+    }
+    tx_semaphore_put(&test_done);
+}
+
+
+/* Allocate and release packets one at a time.  */
+
+static VOID test_releaser_entry(ULONG thread_input)
+{
+NX_PACKET  *packet_ptr;
+ULONG       i;
+
+    for (i = 0; i < thread_input; i++)
+    {
+        nx_packet_allocate(&test_pool, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT);
+        nx_packet_release(packet_ptr);
+    }
+    tx_semaphore_put(&test_done);
+}
+
+
+/* Hold a packet for some ticks.  */
+
+static VOID test_holder_entry(ULONG thread_input)
+{
+NX_PACKET  *packet_ptr;
+
+    nx_packet_allocate(&test_pool, &packet_ptr, NX_UDP_PACKET, NX_NO_WAIT);
+    tx_thread_sleep(thread_input);
+    nx_packet_release(packet_ptr);
+    tx_semaphore_put(&test_done);
+}
+
+
+/* Keep one packet in the given slot.  */
+
+static VOID test_keeper_entry(ULONG thread_input)
+{
+
+    nx_packet_allocate(&test_pool, &test_kept_packets[thread_input], NX_UDP_PACKET, NX_NO_WAIT);
+    tx_semaphore_put(&test_done);
+}
+
+
+/* Wait on the pool for a packet, kept in the given slot.  */
+
+static VOID test_waiter_entry(ULONG thread_input)
+{
+
+    test_waiter_status = nx_packet_allocate(&test_pool, &test_kept_packets[thread_input], NX_UDP_PACKET, 100);
+    tx_semaphore_put(&test_done);
+}
+
+
+/* Create an owner thread and wait until it is done with the pool.  */
+
+static VOID test_owner_run(UINT index, CHAR *name, VOID (*entry)(ULONG), ULONG thread_input)
+{
+
+    tx_thread_create(&test_owner_thread[index], name, entry, thread_input, test_owner_thread_stack[index],
+                     sizeof(test_owner_thread_stack[index]), TEST_WORKER_PRIORITY, TEST_WORKER_PRIORITY,
+                     TX_NO_TIME_SLICE, TX_AUTO_START);
+    tx_semaphore_get(&test_done, TX_WAIT_FOREVER);
+}
+
+
+static VOID test_tracking(VOID)
+{
+TX_THREAD  *owner_thread;
+ULONG       min_available;
+ULONG       owner_count;
+ULONG       untracked;
+ULONG       live;
+ULONG       max_live;
+ULONG       allocations;
+ULONG       max_hold;
+ULONG       oldest;
+ULONG       held;
+ULONG       i;
+
+    test_check(nx_packet_pool_create(&test_pool, "test pool", TEST_PAYLOAD_SIZE, test_pool_memory,
+                                     sizeof(test_pool_memory)) == NX_SUCCESS, "pool create");
+    test_check(nx_packet_pool_track_notify(&test_pool, test_report) == NX_SUCCESS, "track notify");
+
+    /* Each thread becomes an owner of the pool.  */
+    test_owner_run(0, "leaker", test_leaker_entry, TEST_LEAKED_PACKETS);
+    test_owner_run(1, "releaser", test_releaser_entry, TEST_RELEASED_PAIRS);
+    test_owner_run(2, "holder", test_holder_entry, TEST_HOLD_TICKS);
+    tx_thread_sleep(7);
+    test_check(nx_packet_pool_track_info_get(&test_pool, &min_available, &owner_count, &untracked) == NX_SUCCESS,
+               "track info get");
+    test_check(owner_count == 3, "three owners");
+    test_check(untracked == 0, "no untracked allocation");
+    test_check(min_available == TEST_PACKETS - TEST_LEAKED_PACKETS - 1, "fewest available packets");
+
+    nx_packet_pool_track_owner_get(&test_pool, 0, &owner_thread, &live, &max_live, &allocations, &max_hold,
+                                   &oldest);
+    test_check((owner_thread == &test_owner_thread[0]) && (live == TEST_LEAKED_PACKETS) &&
+               (allocations == TEST_LEAKED_PACKETS), "leaker counted");
+    test_check(oldest >= TEST_HOLD_TICKS + 7, "age of the oldest leaked packet");
+    nx_packet_pool_track_owner_get(&test_pool, 1, &owner_thread, &live, &max_live, &allocations, &max_hold,
+                                   &oldest);
+    test_check((owner_thread == &test_owner_thread[1]) && (live == 0) && (max_live == 1) &&
+               (allocations == TEST_RELEASED_PAIRS) && (oldest == 0), "releaser counted");
+    nx_packet_pool_track_owner_get(&test_pool, 2, &owner_thread, &live, &max_live, &allocations, &max_hold,
+                                   &oldest);
+    test_check((owner_thread == &test_owner_thread[2]) && (live == 0), "holder counted");
+    test_check((max_hold >= TEST_HOLD_TICKS - 1) && (max_hold <= TEST_HOLD_TICKS + 1), "longest hold");
+
+    /* The report gives every owner, or only the owners that hold packets.  */
+    printf("owners of the pool:\n");
+    test_reports = 0;
+    test_check(nx_packet_pool_track_report(&test_pool, NX_FALSE, test_report) == NX_SUCCESS, "report");
+    test_check(test_reports == 3, "every owner reported");
+    printf("owners holding packets:\n");
+    test_reports = 0;
+    nx_packet_pool_track_report(&test_pool, NX_TRUE, test_report);
+    test_check((test_reports == 1) && (test_report_thread == &test_owner_thread[0]), "leaks reported");
+
+    /* Check the errors of the services.  */
+    test_check(nx_packet_pool_track_owner_get(&test_pool, NX_PACKET_TRACK_MAX_OWNERS, NX_NULL, NX_NULL, NX_NULL,
+                                              NX_NULL, NX_NULL, NX_NULL) == NX_INVALID_PARAMETERS,
+               "owner index beyond the table");
+    test_check(nx_packet_pool_track_owner_get(&test_pool, NX_PACKET_TRACK_MAX_OWNERS - 1, NX_NULL, NX_NULL, NX_NULL,
+                                              NX_NULL, NX_NULL, NX_NULL) == NX_NOT_FOUND, "owner not found");
+    test_check(nx_packet_pool_track_report(&test_pool, NX_FALSE, NX_NULL) == NX_PTR_ERROR, "report routine");
+    test_check(nx_packet_pool_track_info_get(NX_NULL, NX_NULL, NX_NULL, NX_NULL) == NX_PTR_ERROR, "info pool");
+
+    /* Once the owner table is full, the allocations of new threads are untracked.  */
+    for (i = 3; i < TEST_OWNER_THREADS; i++)
+    {
+        test_owner_run(i, "keeper", test_keeper_entry, i);
+    }
+    nx_packet_pool_track_info_get(&test_pool, &min_available, &owner_count, &untracked);
+    test_check(owner_count == NX_PACKET_TRACK_MAX_OWNERS, "owner table full");
+    test_check(untracked == TEST_OWNER_THREADS - NX_PACKET_TRACK_MAX_OWNERS, "untracked allocations");
+
+    /* Releasing an untracked packet leaves the owners alone.  */
+    for (i = 3; i < TEST_OWNER_THREADS; i++)
+    {
+        nx_packet_release(test_kept_packets[i]);
+    }
+    for (i = 3; i < NX_PACKET_TRACK_MAX_OWNERS; i++)
+    {
+        nx_packet_pool_track_owner_get(&test_pool, i, NX_NULL, &live, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+        test_check(live == 0, "untracked release");
+    }
+
+    /* A thread waiting on the empty pool is charged for the packet it gets on a release. The waiter
+       reuses the control block of an owner, so it is counted as that owner.  */
+    held = 0;
+    while (nx_packet_allocate(&test_pool, &test_pool_packets[held], NX_UDP_PACKET, NX_NO_WAIT) == NX_SUCCESS)
+    {
+        held++;
+    }
+    nx_packet_pool_track_info_get(&test_pool, &min_available, NX_NULL, NX_NULL);
+    test_check(min_available == 0, "pool exhausted");
+    tx_thread_terminate(&test_owner_thread[3]);
+    tx_thread_delete(&test_owner_thread[3]);
+    tx_thread_create(&test_owner_thread[3], "waiter", test_waiter_entry, 3, test_owner_thread_stack[3],
+                     sizeof(test_owner_thread_stack[3]), TEST_WAITER_PRIORITY, TEST_WAITER_PRIORITY,
+                     TX_NO_TIME_SLICE, TX_AUTO_START);
+    tx_thread_sleep(2);
+    nx_packet_release(test_pool_packets[0]);
+    tx_semaphore_get(&test_done, TX_WAIT_FOREVER);
+    test_check(test_waiter_status == NX_SUCCESS, "waiter served");
+    nx_packet_pool_track_owner_get(&test_pool, 3, &owner_thread, &live, NX_NULL, &allocations, NX_NULL, NX_NULL);
+    test_check((owner_thread == &test_owner_thread[3]) && (live == 1) && (allocations == 2), "waiter charged");
+    nx_packet_release(test_kept_packets[3]);
+    for (i = 1; i < held; i++)
+    {
+        nx_packet_release(test_pool_packets[i]);
+    }
+
+    /* Deleting the pool reports the leaks.  */
+    printf("leaks on pool delete:\n");
+    test_reports = 0;
+    test_check(nx_packet_pool_delete(&test_pool) == NX_SUCCESS, "pool delete");
+    test_check((test_reports == 1) && (test_report_thread == &test_owner_thread[0]) &&
+               (test_report_live == TEST_LEAKED_PACKETS), "leaker reported on delete");
+}
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
+
+static VOID test_entry(ULONG thread_input)
+{
+
+    NX_PARAMETER_NOT_USED(thread_input);
+
+    nx_system_initialize();
+    tx_semaphore_create(&test_done, "done", 0);
+
+    /* The first run warms up.  */
+    test_benchmark();
+    test_benchmark();
+
+#ifdef NX_ENABLE_PACKET_TRACKING
+    test_tracking();
+#else
+    test_check(nx_packet_pool_create(&test_pool, "test pool", TEST_PAYLOAD_SIZE, test_pool_memory,
+                                     sizeof(test_pool_memory)) == NX_SUCCESS, "pool create");
+    test_check(nx_packet_pool_track_info_get(&test_pool, NX_NULL, NX_NULL, NX_NULL) == NX_NOT_SUPPORTED,
+               "tracking not supported");
+    test_check(nx_packet_pool_delete(&test_pool) == NX_SUCCESS, "pool delete");
+#endif /* NX_ENABLE_PACKET_TRACKING */
+
+    if (test_failures)
+    {
+        printf("nx_packet_pool_track_test: %u checks failed\n", test_failures);
+        exit(1);
+    }
+    printf("nx_packet_pool_track_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    NX_PARAMETER_NOT_USED(first_unused_memory);
+
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
@@ -109,6 +109,7 @@ extern   "C" {
 #define TX_4_ULONG                      ((UINT)   4)
 #define TX_8_ULONG                      ((UINT)   8)
 #define TX_16_ULONG                     ((UINT)   16)
+#define TX_POINTER_ULONG                ((UINT)   (sizeof(VOID *) / sizeof(ULONG)))
 #define TX_NO_TIME_SLICE                ((ULONG)  0)
 #define TX_AUTO_START                   ((UINT)   1)
 #define TX_DONT_START                   ((UINT)   0)
@@ -197,6 +198,14 @@ extern   "C" {
 #endif
 
 
+/* Define the macro that marks a parameter as intentionally not used, so compilers do not warn
+   about it.  */
+
+#ifndef TX_PARAMETER_NOT_USED
+#define TX_PARAMETER_NOT_USED(p)        ((void) (p))
+#endif
+
+
 /* Event numbers 0 through 4095 are reserved by Azure RTOS. Specific event assignments are: 
                                 
                                 ThreadX events:     1-199 
@@ -433,6 +442,21 @@ typedef struct TX_THREAD_STRUCT
     struct TX_MUTEX_STRUCT
                         *tx_thread_owned_mutex_list;
 
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+    /* Define the time stamp of when this thread started to wait for a mutex.  */
+    ULONG               tx_thread_mutex_wait_start;
+#endif
+
+#ifdef TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+
+    /* Define the links of the event flags group bucket of the flags this thread
+       waits for, while it is suspended on an event flags group.  */
+    struct TX_THREAD_STRUCT
+                        *tx_thread_event_flags_bucket_next,
+                        *tx_thread_event_flags_bucket_previous;
+#endif
+
 #ifdef TX_THREAD_ENABLE_PERFORMANCE_INFO
 
     /* Define the number of times this thread is resumed.  */
@@ -473,6 +497,13 @@ typedef struct TX_THREAD_STRUCT
     /* Define the highest stack pointer variable.  */
     VOID                *tx_thread_stack_highest_ptr;   /* Stack highest usage pointer  */
 
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+    /* Define the lowest used stack word found by the stack monitor, which is
+       NULL until the stack monitor has scanned this thread.  */
+    VOID                *tx_thread_stack_monitor_ptr;
+#endif
+
 
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 
@@ -576,6 +607,30 @@ typedef struct TX_BLOCK_POOL_STRUCT
 #endif
 
 
+/* Determine if the two-level segregated fit (TLSF) byte pool is enabled. If so, define
+   the size classes of the free lists. Free blocks are kept in one list per size class
+   and a pair of bitmaps locates the smallest non-empty class that satisfies a request,
+   so allocate and release take constant time regardless of pool fragmentation. Each
+   first-level class covers one power of two of block sizes and is split into
+   TX_BYTE_POOL_TLSF_SL_COUNT second-level classes. The largest pool is
+   (2^(TX_BYTE_POOL_TLSF_FL_MAX + 1)) - 1 bytes.  */
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+
+#ifndef TX_BYTE_POOL_TLSF_SL_SHIFT
+#define TX_BYTE_POOL_TLSF_SL_SHIFT              2
+#endif
+
+#ifndef TX_BYTE_POOL_TLSF_FL_MAX
+#define TX_BYTE_POOL_TLSF_FL_MAX                20
+#endif
+
+#define TX_BYTE_POOL_TLSF_SL_COUNT              (1 << TX_BYTE_POOL_TLSF_SL_SHIFT)
+#define TX_BYTE_POOL_TLSF_FL_SHIFT              (TX_BYTE_POOL_TLSF_SL_SHIFT + 2)
+#define TX_BYTE_POOL_TLSF_FL_COUNT              ((TX_BYTE_POOL_TLSF_FL_MAX - TX_BYTE_POOL_TLSF_FL_SHIFT) + 2)
+#endif
+
+
 /* Define the byte memory pool structure utilized by the application.  */
 
 typedef struct TX_BYTE_POOL_STRUCT
@@ -648,6 +703,17 @@ typedef struct TX_BYTE_POOL_STRUCT
     ULONG               tx_byte_pool_performance_timeout_count;
 #endif
 
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+
+    /* Define the TLSF bitmaps of non-empty free lists. Bit n of the first-level
+       bitmap is set when second-level bitmap n is non-zero.  */
+    ULONG               tx_byte_pool_tlsf_fl_bitmap;
+    ULONG               tx_byte_pool_tlsf_sl_bitmap[TX_BYTE_POOL_TLSF_FL_COUNT];
+
+    /* Define the TLSF free list heads, one per size class.  */
+    UCHAR               *tx_byte_pool_tlsf_free_list[TX_BYTE_POOL_TLSF_FL_COUNT][TX_BYTE_POOL_TLSF_SL_COUNT];
+#endif
+
     /* Define the port extension in the byte pool control block. This 
        is typically defined to whitespace in tx_port.h.  */
     TX_BYTE_POOL_EXTENSION
@@ -655,6 +721,14 @@ typedef struct TX_BYTE_POOL_STRUCT
 } TX_BYTE_POOL;
 
 
+/* Define the number of event flags group buckets of suspended threads. Each thread waiting for a
+   single flag is in the bucket of that flag, and the threads waiting for several flags are in the
+   last bucket.  */
+
+#define TX_EVENT_FLAGS_BUCKETS                  ((UINT) 33)
+#define TX_EVENT_FLAGS_BUCKET_SEVERAL           ((UINT) 32)
+
+
 /* Define the event flags group structure utilized by the application.  */
 
 typedef struct TX_EVENT_FLAGS_GROUP_STRUCT
@@ -680,6 +754,19 @@ typedef struct TX_EVENT_FLAGS_GROUP_STRUCT
                         *tx_event_flags_group_suspension_list;
     UINT                tx_event_flags_group_suspended_count;
 
+    /* Define the flags requested by the suspended threads. This may include the
+       flags of threads no longer suspended, until the list is searched again.  */
+    ULONG               tx_event_flags_group_suspended_flags;
+
+#ifdef TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+
+    /* Define the buckets of the suspended threads by the flags they wait for,
+       along with a count of the threads waiting for several flags.  */
+    struct TX_THREAD_STRUCT
+                        *tx_event_flags_group_bucket[TX_EVENT_FLAGS_BUCKETS];
+    UINT                tx_event_flags_group_several_count;
+#endif
+
     /* Define the created list next and previous pointers.  */
     struct TX_EVENT_FLAGS_GROUP_STRUCT
                         *tx_event_flags_group_created_next,
@@ -741,6 +828,57 @@ typedef struct TX_EVENT_FLAGS_GROUP_STRUCT
 #endif
 
 
+/* Define the number of buckets of the mutex contention histograms. Bucket 0 counts the
+   durations shorter than 2^TX_MUTEX_CONTENTION_SHIFT time source units, each following
+   bucket counts durations up to twice as long as the previous one, and the last bucket
+   counts all the longer durations.  */
+
+#ifndef TX_MUTEX_CONTENTION_BUCKETS
+#define TX_MUTEX_CONTENTION_BUCKETS             16
+#endif
+
+
+/* Define the histogram of the hold or wait times of a mutex, along with the longest time
+   and the thread that held or waited for the mutex that long.  */
+
+typedef struct TX_MUTEX_CONTENTION_TIMES_STRUCT
+{
+
+    /* Define the histogram of the times.  */
+    ULONG               tx_mutex_contention_times_histogram[TX_MUTEX_CONTENTION_BUCKETS];
+
+    /* Define the longest time and its thread.  */
+    ULONG               tx_mutex_contention_times_longest;
+    struct TX_THREAD_STRUCT
+                        *tx_mutex_contention_times_longest_thread;
+
+} TX_MUTEX_CONTENTION_TIMES;
+
+
+/* Define the contention profile of a mutex, which tx_mutex_contention_info_get copies.  */
+
+typedef struct TX_MUTEX_CONTENTION_STRUCT
+{
+
+    /* Define the times the mutex was held, from get to the last put of the owner.  */
+    TX_MUTEX_CONTENTION_TIMES
+                        tx_mutex_contention_hold;
+
+    /* Define the times threads waited for the mutex, until they got it, timed out
+       or the wait was aborted.  */
+    TX_MUTEX_CONTENTION_TIMES
+                        tx_mutex_contention_wait;
+
+    /* Define the number of times a waiting thread raised the priority of the owner,
+       the highest priority the owners were raised to and the owner raised to it.  */
+    ULONG               tx_mutex_contention_inheritance_count;
+    UINT                tx_mutex_contention_inheritance_priority;
+    struct TX_THREAD_STRUCT
+                        *tx_mutex_contention_inheritance_thread;
+
+} TX_MUTEX_CONTENTION;
+
+
 /* Define the mutex structure utilized by the application.  */
 
 typedef struct TX_MUTEX_STRUCT
@@ -807,6 +945,13 @@ typedef struct TX_MUTEX_STRUCT
     ULONG               tx_mutex_performance__priority_inheritance_count;
 #endif
 
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+    /* Define the contention profile, and the time stamp of when the owner got the mutex.  */
+    TX_MUTEX_CONTENTION tx_mutex_contention;
+    ULONG               tx_mutex_contention_hold_start;
+#endif
+
     /* Define the port extension in the mutex control block. This 
        is typically defined to whitespace in tx_port.h.  */
     TX_MUTEX_EXTENSION
@@ -1007,6 +1152,8 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #endif
 #endif
 
+#define tx_mutex_contention_info_get                _tx_mutex_contention_info_get
+#define tx_mutex_contention_reset                   _tx_mutex_contention_reset
 #define tx_mutex_create                             _tx_mutex_create
 #define tx_mutex_delete                             _tx_mutex_delete
 #define tx_mutex_get                                _tx_mutex_get
@@ -1022,6 +1169,8 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_queue_info_get                           _tx_queue_info_get
 #define tx_queue_performance_info_get               _tx_queue_performance_info_get
 #define tx_queue_performance_system_info_get        _tx_queue_performance_system_info_get
+#define tx_queue_pointer_receive                    _tx_queue_pointer_receive
+#define tx_queue_pointer_send                       _tx_queue_pointer_send
 #define tx_queue_receive                            _tx_queue_receive
 #define tx_queue_send                               _tx_queue_send
 #define tx_queue_send_notify                        _tx_queue_send_notify
@@ -1053,6 +1202,9 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_thread_resume                            _tx_thread_resume
 #define tx_thread_sleep                             _tx_thread_sleep
 #define tx_thread_stack_error_notify                _tx_thread_stack_error_notify
+#define tx_thread_stack_monitor_start               _tx_thread_stack_monitor_start
+#define tx_thread_stack_monitor_stop                _tx_thread_stack_monitor_stop
+#define tx_thread_stack_monitor_info_get            _tx_thread_stack_monitor_info_get
 #define tx_thread_suspend                           _tx_thread_suspend
 #define tx_thread_terminate                         _tx_thread_terminate
 #define tx_thread_time_slice_change                 _tx_thread_time_slice_change
@@ -1077,6 +1229,10 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_trace_isr_exit_insert                    _tx_trace_isr_exit_insert
 #define tx_trace_buffer_full_notify                 _tx_trace_buffer_full_notify
 #define tx_trace_user_event_insert                  _tx_trace_user_event_insert
+#define tx_trace_stream_enable                      _tx_trace_stream_enable
+#define tx_trace_stream_disable                     _tx_trace_stream_disable
+#define tx_trace_stream_drain                       _tx_trace_stream_drain
+#define tx_trace_stream_info_get                    _tx_trace_stream_info_get
 
 #else
 
@@ -1131,6 +1287,8 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #endif
 #endif
 
+#define tx_mutex_contention_info_get                _tx_mutex_contention_info_get
+#define tx_mutex_contention_reset                   _tx_mutex_contention_reset
 #define tx_mutex_create(m,n,i)                      _txr_mutex_create((m),(n),(i),(sizeof(TX_MUTEX)))
 #define tx_mutex_delete                             _txr_mutex_delete
 #define tx_mutex_get                                _txr_mutex_get
@@ -1146,6 +1304,8 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_queue_info_get                           _txr_queue_info_get
 #define tx_queue_performance_info_get               _tx_queue_performance_info_get
 #define tx_queue_performance_system_info_get        _tx_queue_performance_system_info_get
+#define tx_queue_pointer_receive                    _txr_queue_pointer_receive
+#define tx_queue_pointer_send                       _txr_queue_pointer_send
 #define tx_queue_receive                            _txr_queue_receive
 #define tx_queue_send                               _txr_queue_send
 #define tx_queue_send_notify                        _txr_queue_send_notify
@@ -1177,6 +1337,9 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_thread_resume                            _txr_thread_resume
 #define tx_thread_sleep                             _tx_thread_sleep
 #define tx_thread_stack_error_notify                _tx_thread_stack_error_notify
+#define tx_thread_stack_monitor_start               _tx_thread_stack_monitor_start
+#define tx_thread_stack_monitor_stop                _tx_thread_stack_monitor_stop
+#define tx_thread_stack_monitor_info_get            _tx_thread_stack_monitor_info_get
 #define tx_thread_suspend                           _txr_thread_suspend
 #define tx_thread_terminate                         _txr_thread_terminate
 #define tx_thread_time_slice_change                 _txr_thread_time_slice_change
@@ -1201,6 +1364,10 @@ UINT    _tx_trace_interrupt_control(UINT new_posture);
 #define tx_trace_isr_exit_insert                    _tx_trace_isr_exit_insert
 #define tx_trace_buffer_full_notify                 _tx_trace_buffer_full_notify
 #define tx_trace_user_event_insert                  _tx_trace_user_event_insert
+#define tx_trace_stream_enable                      _tx_trace_stream_enable
+#define tx_trace_stream_disable                     _tx_trace_stream_disable
+#define tx_trace_stream_drain                       _tx_trace_stream_drain
+#define tx_trace_stream_info_get                    _tx_trace_stream_info_get
 
 #else
 
@@ -1242,6 +1409,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #endif
 #endif
 
+#define tx_mutex_contention_info_get                _tx_mutex_contention_info_get
+#define tx_mutex_contention_reset                   _tx_mutex_contention_reset
 #define tx_mutex_create(m,n,i)                      _txe_mutex_create((m),(n),(i),(sizeof(TX_MUTEX)))
 #define tx_mutex_delete                             _txe_mutex_delete
 #define tx_mutex_get                                _txe_mutex_get
@@ -1257,6 +1426,8 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_queue_info_get                           _txe_queue_info_get
 #define tx_queue_performance_info_get               _tx_queue_performance_info_get
 #define tx_queue_performance_system_info_get        _tx_queue_performance_system_info_get
+#define tx_queue_pointer_receive                    _txe_queue_pointer_receive
+#define tx_queue_pointer_send                       _txe_queue_pointer_send
 #define tx_queue_receive                            _txe_queue_receive
 #define tx_queue_send                               _txe_queue_send
 #define tx_queue_send_notify                        _txe_queue_send_notify
@@ -1288,6 +1459,9 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_thread_resume                            _txe_thread_resume
 #define tx_thread_sleep                             _tx_thread_sleep
 #define tx_thread_stack_error_notify                _tx_thread_stack_error_notify
+#define tx_thread_stack_monitor_start               _tx_thread_stack_monitor_start
+#define tx_thread_stack_monitor_stop                _tx_thread_stack_monitor_stop
+#define tx_thread_stack_monitor_info_get            _tx_thread_stack_monitor_info_get
 #define tx_thread_suspend                           _txe_thread_suspend
 #define tx_thread_terminate                         _txe_thread_terminate
 #define tx_thread_time_slice_change                 _txe_thread_time_slice_change
@@ -1312,6 +1486,10 @@ UINT    _tx_el_interrupt_control(UINT new_posture);
 #define tx_trace_isr_exit_insert                    _tx_trace_isr_exit_insert
 #define tx_trace_buffer_full_notify                 _tx_trace_buffer_full_notify
 #define tx_trace_user_event_insert                  _tx_trace_user_event_insert
+#define tx_trace_stream_enable                      _tx_trace_stream_enable
+#define tx_trace_stream_disable                     _tx_trace_stream_disable
+#define tx_trace_stream_drain                       _tx_trace_stream_drain
+#define tx_trace_stream_info_get                    _tx_trace_stream_info_get
 
 #endif
 #endif
@@ -1466,6 +1644,8 @@ VOID        _tx_initialize_kernel_enter(VOID);
 
 /* Define mutex management function prototypes.  */
 
+UINT        _tx_mutex_contention_info_get(TX_MUTEX *mutex_ptr, TX_MUTEX_CONTENTION *contention_ptr);
+UINT        _tx_mutex_contention_reset(TX_MUTEX *mutex_ptr);
 UINT        _tx_mutex_create(TX_MUTEX *mutex_ptr, CHAR *name_ptr, UINT inherit);
 UINT        _tx_mutex_delete(TX_MUTEX *mutex_ptr);
 UINT        _tx_mutex_get(TX_MUTEX *mutex_ptr, ULONG wait_option);
@@ -1517,6 +1697,8 @@ UINT        _tx_queue_performance_system_info_get(ULONG *messages_sent, ULONG *m
                     ULONG *empty_suspensions, ULONG *full_suspensions, ULONG *full_errors, ULONG *timeouts);
 UINT        _tx_queue_prioritize(TX_QUEUE *queue_ptr);
 UINT        _tx_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _tx_queue_pointer_receive(TX_QUEUE *queue_ptr, VOID **pointers, UINT count, UINT *actual_count, ULONG wait_option);
+UINT        _tx_queue_pointer_send(TX_QUEUE *queue_ptr, VOID **pointers, UINT count, UINT *actual_count, ULONG wait_option);
 UINT        _tx_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
 UINT        _tx_queue_send_notify(TX_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_QUEUE *notify_queue_ptr));
 UINT        _tx_queue_front_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
@@ -1533,6 +1715,8 @@ UINT        _txe_queue_info_get(TX_QUEUE *queue_ptr, CHAR **name, ULONG *enqueue
                     TX_THREAD **first_suspended, ULONG *suspended_count, TX_QUEUE **next_queue);
 UINT        _txe_queue_prioritize(TX_QUEUE *queue_ptr);
 UINT        _txe_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _txe_queue_pointer_receive(TX_QUEUE *queue_ptr, VOID **pointers, UINT count, UINT *actual_count, ULONG wait_option);
+UINT        _txe_queue_pointer_send(TX_QUEUE *queue_ptr, VOID **pointers, UINT count, UINT *actual_count, ULONG wait_option);
 UINT        _txe_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
 UINT        _txe_queue_send_notify(TX_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_QUEUE *notify_queue_ptr));
 UINT        _txe_queue_front_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
@@ -1545,6 +1729,8 @@ UINT        _txr_queue_info_get(TX_QUEUE *queue_ptr, CHAR **name, ULONG *enqueue
                     TX_THREAD **first_suspended, ULONG *suspended_count, TX_QUEUE **next_queue);
 UINT        _txr_queue_prioritize(TX_QUEUE *queue_ptr);
 UINT        _txr_queue_receive(TX_QUEUE *queue_ptr, VOID *destination_ptr, ULONG wait_option);
+UINT        _txr_queue_pointer_receive(TX_QUEUE *queue_ptr, VOID **pointers, UINT count, UINT *actual_count, ULONG wait_option);
+UINT        _txr_queue_pointer_send(TX_QUEUE *queue_ptr, VOID **pointers, UINT count, UINT *actual_count, ULONG wait_option);
 UINT        _txr_queue_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
 UINT        _txr_queue_send_notify(TX_QUEUE *queue_ptr, VOID (*queue_send_notify)(TX_QUEUE *notify_queue_ptr));
 UINT        _txr_queue_front_send(TX_QUEUE *queue_ptr, VOID *source_ptr, ULONG wait_option);
@@ -1627,6 +1813,10 @@ UINT        _tx_thread_reset(TX_THREAD *thread_ptr);
 UINT        _tx_thread_resume(TX_THREAD *thread_ptr);
 UINT        _tx_thread_sleep(ULONG timer_ticks);
 UINT        _tx_thread_stack_error_notify(VOID (*stack_error_handler)(TX_THREAD *thread_ptr));
+UINT        _tx_thread_stack_monitor_start(ULONG slice_words, ULONG slice_ticks, ULONG headroom_percent,
+                VOID (*headroom_notify)(TX_THREAD *thread_ptr, ULONG stack_used));
+UINT        _tx_thread_stack_monitor_stop(VOID);
+UINT        _tx_thread_stack_monitor_info_get(TX_THREAD *thread_ptr, ULONG *stack_used, ULONG *stack_headroom, ULONG *rounds);
 UINT        _tx_thread_suspend(TX_THREAD *thread_ptr);
 UINT        _tx_thread_terminate(TX_THREAD *thread_ptr);
 UINT        _tx_thread_time_slice_change(TX_THREAD *thread_ptr, ULONG new_time_slice, ULONG *old_time_slice);
@@ -1737,6 +1927,10 @@ VOID        _tx_trace_isr_exit_insert(ULONG isr_id);
 UINT        _tx_trace_buffer_full_notify(VOID (*full_buffer_callback)(VOID *buffer));
 UINT        _tx_trace_user_event_insert(ULONG event_id, ULONG info_field_1, ULONG info_field_2, ULONG info_field_3, ULONG info_field_4);
 UINT        _tx_trace_interrupt_control(UINT new_posture);
+UINT        _tx_trace_stream_enable(UCHAR *stream_buffer_start, ULONG stream_buffer_size, UINT (*stream_write_function)(UCHAR *data, ULONG size));
+UINT        _tx_trace_stream_disable(VOID);
+UINT        _tx_trace_stream_drain(ULONG *events_drained);
+UINT        _tx_trace_stream_info_get(ULONG *events_streamed, ULONG *events_dropped, ULONG *bytes_streamed);
 
 
 /* Add a default macro that can be re-defined in tx_port.h to add default processing when a thread starts. Common usage
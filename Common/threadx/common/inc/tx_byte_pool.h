@@ -68,6 +68,78 @@
 #endif
 
 
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+
+/* Define the TLSF block layout. A block keeps the "next" pointer and owner field
+   of the standard byte pool, so the header found in front of application memory
+   is the same. In addition, the word in front of each block holds a pointer to
+   the previous block, which lets a released block merge with both neighbors
+   without a search. Free blocks link into their free list through the first two
+   words of their memory area.  */
+
+#define TX_BYTE_POOL_TLSF_BLOCK_OVERHEAD        ((ULONG) ((sizeof(UCHAR *)) + (sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))))
+#define TX_BYTE_POOL_TLSF_BLOCK_MIN             ((ULONG) (TX_BYTE_POOL_TLSF_BLOCK_OVERHEAD + (sizeof(UCHAR *)) + (sizeof(UCHAR *))))
+#define TX_BYTE_POOL_TLSF_BLOCK_MAX             ((ULONG) ((((ULONG) 1) << (TX_BYTE_POOL_TLSF_FL_MAX + 1)) - ((ULONG) 1)))
+
+#define TX_BYTE_POOL_TLSF_PREVIOUS_LINK(b)      TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(TX_UCHAR_POINTER_SUB((b), (sizeof(UCHAR *))))
+#define TX_BYTE_POOL_TLSF_NEXT_LINK(b)          TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT((b))
+#define TX_BYTE_POOL_TLSF_OWNER(b)              TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(TX_UCHAR_POINTER_ADD((b), (sizeof(UCHAR *))))
+#define TX_BYTE_POOL_TLSF_FREE_NEXT_LINK(b)     TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(TX_UCHAR_POINTER_ADD((b), ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)))))
+#define TX_BYTE_POOL_TLSF_FREE_PREVIOUS_LINK(b) TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(TX_UCHAR_POINTER_ADD((b), ((sizeof(UCHAR *)) + (sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE)))))
+
+
+/* Define the highest bit set macro. Note, that this may be overridden 
+   by a port specific definition if there is supporting assembly language
+   instructions in the architecture.  */
+
+#ifndef TX_BYTE_POOL_HIGHEST_SET_BIT_CALCULATE
+#define TX_BYTE_POOL_HIGHEST_SET_BIT_CALCULATE(m, b)    \
+    (b) =  ((UINT) 0);                                  \
+    if ((m) >= ((ULONG) 0x10000))                       \
+    {                                                   \
+        (m) = (m) >> ((ULONG) 16);                      \
+        (b) = (b) + ((UINT) 16);                        \
+    }                                                   \
+    if ((m) >= ((ULONG) 0x100))                         \
+    {                                                   \
+        (m) = (m) >> ((ULONG) 8);                       \
+        (b) = (b) + ((UINT) 8);                         \
+    }                                                   \
+    if ((m) >= ((ULONG) 0x10))                          \
+    {                                                   \
+        (m) = (m) >> ((ULONG) 4);                       \
+        (b) = (b) + ((UINT) 4);                         \
+    }                                                   \
+    if ((m) >= ((ULONG) 4))                             \
+    {                                                   \
+        (m) = (m) >> ((ULONG) 2);                       \
+        (b) = (b) + ((UINT) 2);                         \
+    }                                                   \
+    (b) = (b) + ((UINT) ((m) >> ((ULONG) 1)));
+#endif
+
+
+/* Define the macro that maps a block size to its first-level and second-level
+   size class. Sizes below 2^TX_BYTE_POOL_TLSF_FL_SHIFT share first-level class 0.
+   The work variable w is destroyed.  */
+
+#define TX_BYTE_POOL_TLSF_MAPPING(s, f, l, w)                                               \
+    if ((s) < (((ULONG) 1) << TX_BYTE_POOL_TLSF_FL_SHIFT))                                  \
+    {                                                                                       \
+        (f) =  ((UINT) 0);                                                                  \
+        (l) =  (UINT) ((s) >> (TX_BYTE_POOL_TLSF_FL_SHIFT - TX_BYTE_POOL_TLSF_SL_SHIFT));   \
+    }                                                                                       \
+    else                                                                                    \
+    {                                                                                       \
+        (w) =  (s);                                                                         \
+        TX_BYTE_POOL_HIGHEST_SET_BIT_CALCULATE((w), (f))                                    \
+        (l) =  (UINT) (((s) >> ((f) - ((UINT) TX_BYTE_POOL_TLSF_SL_SHIFT))) -               \
+                       ((ULONG) TX_BYTE_POOL_TLSF_SL_COUNT));                               \
+        (f) =  ((f) - ((UINT) TX_BYTE_POOL_TLSF_FL_SHIFT)) + ((UINT) 1);                    \
+    }
+#endif
+
+
 /* Determine if in-line component initialization is supported by the 
    caller.  */
 
@@ -104,6 +176,12 @@ VOID        _tx_byte_pool_initialize(VOID);
 
 UCHAR       *_tx_byte_pool_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size);
 VOID        _tx_byte_pool_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+UCHAR       *_tx_byte_pool_tlsf_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size);
+VOID        _tx_byte_pool_tlsf_release(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+VOID        _tx_byte_pool_tlsf_insert(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+VOID        _tx_byte_pool_tlsf_remove(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr);
+#endif
 
 
 /* Byte pool management component data declarations follow.  */
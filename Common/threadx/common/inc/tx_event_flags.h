@@ -89,6 +89,10 @@ VOID        _tx_event_flags_initialize(VOID);
 /* Define internal event flags management function prototypes.  */
 
 VOID        _tx_event_flags_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
+#ifdef TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+VOID        _tx_event_flags_bucket_insert(TX_EVENT_FLAGS_GROUP *group_ptr, TX_THREAD *thread_ptr);
+VOID        _tx_event_flags_bucket_remove(TX_EVENT_FLAGS_GROUP *group_ptr, TX_THREAD *thread_ptr);
+#endif
 
 
 /* Event flags management component data declarations follow.  */
@@ -92,6 +92,36 @@ VOID        _tx_mutex_initialize(VOID);
 VOID        _tx_mutex_cleanup(TX_THREAD *thread_ptr, ULONG suspension_sequence);
 VOID        _tx_mutex_thread_release(TX_THREAD *thread_ptr);
 VOID        _tx_mutex_priority_change(TX_THREAD *thread_ptr, UINT new_priority);
+VOID        _tx_mutex_contention_times_update(TX_MUTEX_CONTENTION_TIMES *times_ptr, TX_THREAD *thread_ptr, ULONG duration);
+
+
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+/* Define the time source of the mutex contention profile, a free running counter that counts
+   up and wraps at TX_MUTEX_CONTENTION_TIME_MASK. By default, this is the trace time source of
+   the port, so hold and wait times are measured in the same units as trace time stamps.  */
+
+#ifndef TX_MUTEX_CONTENTION_TIME_SOURCE
+#define TX_MUTEX_CONTENTION_TIME_SOURCE         TX_TRACE_TIME_SOURCE
+#endif
+
+#ifndef TX_MUTEX_CONTENTION_TIME_MASK
+#define TX_MUTEX_CONTENTION_TIME_MASK           TX_TRACE_TIME_MASK
+#endif
+
+
+/* Define the shift of the first histogram bucket, which counts the durations shorter than
+   2^TX_MUTEX_CONTENTION_SHIFT time source units.  */
+
+#ifndef TX_MUTEX_CONTENTION_SHIFT
+#define TX_MUTEX_CONTENTION_SHIFT               8
+#endif
+
+
+/* Define the macro that returns the time elapsed since a time stamp.  */
+
+#define TX_MUTEX_CONTENTION_ELAPSED(n, s)       ((((ULONG) (n)) - ((ULONG) (s))) & ((ULONG) TX_MUTEX_CONTENTION_TIME_MASK))
+#endif
 
 
 /* Mutex management component data declarations follow.  */
@@ -278,6 +278,7 @@ VOID        _tx_thread_stack_analyze(TX_THREAD *thread_ptr);
 VOID        _tx_thread_stack_build(TX_THREAD *thread_ptr, VOID (*function_ptr)(VOID));
 VOID        _tx_thread_stack_error(TX_THREAD *thread_ptr);
 VOID        _tx_thread_stack_error_handler(TX_THREAD *thread_ptr);
+VOID        _tx_thread_stack_monitor_sample(ULONG monitor_input);
 VOID        _tx_thread_system_preempt_check(VOID);
 VOID        _tx_thread_system_resume(TX_THREAD *thread_ptr);
 VOID        _tx_thread_system_ni_resume(TX_THREAD *thread_ptr);
@@ -447,6 +448,53 @@ THREAD_DECLARE  VOID            (*_tx_thread_application_stack_error_handler)(TX
 
 #endif
 
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+/* The stack monitor looks for the fill pattern of the stacks, and uses a timer.  */
+
+#ifdef TX_DISABLE_STACK_FILLING
+#error "TX_THREAD_ENABLE_STACK_MONITOR requires the stack filling, TX_DISABLE_STACK_FILLING must not be defined."
+#endif
+#ifdef TX_NO_TIMER
+#error "TX_THREAD_ENABLE_STACK_MONITOR requires a timer, TX_NO_TIMER must not be defined."
+#endif
+
+
+/* Define the timer that runs the stack monitor, one slice per expiration.  */
+
+THREAD_DECLARE  TX_TIMER        _tx_thread_stack_monitor_timer;
+
+
+/* Define the thread being scanned by the stack monitor and the next stack word to scan. The
+   scan of a thread starts at the stack start when the word pointer is NULL.  */
+
+THREAD_DECLARE  TX_THREAD       *_tx_thread_stack_monitor_thread;
+THREAD_DECLARE  ULONG           *_tx_thread_stack_monitor_scan_ptr;
+
+
+/* Define the number of stack words scanned per slice, which is zero when the stack monitor is
+   stopped.  */
+
+THREAD_DECLARE  ULONG           _tx_thread_stack_monitor_slice_words;
+
+
+/* Define the headroom, in percent of the stack size, below which the application is notified.  */
+
+THREAD_DECLARE  ULONG           _tx_thread_stack_monitor_headroom_percent;
+
+
+/* Define the application function notified when the headroom of a thread drops below the
+   threshold.  */
+
+THREAD_DECLARE  VOID            (*_tx_thread_stack_monitor_notify)(TX_THREAD *thread_ptr, ULONG stack_used);
+
+
+/* Define the number of complete scans of all created threads.  */
+
+THREAD_DECLARE  ULONG           _tx_thread_stack_monitor_rounds;
+
+#endif
+
 #ifdef TX_THREAD_ENABLE_PERFORMANCE_INFO
 
 /* Define the total number of thread resumptions. Each time a thread enters the
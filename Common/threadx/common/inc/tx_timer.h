@@ -57,6 +57,72 @@
 #define TX_TIMER_ENTRIES                        ((ULONG) 32)
 
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+/* Define the number of cascade wheels above the timer list. Each wheel has TX_TIMER_ENTRIES
+   lists and each of its lists covers all the lists of the wheel below it, so the default of 3
+   wheels places timers of up to 32^4 ticks without reprocessing. The maximum is 5.  */
+
+#ifndef TX_TIMER_WHEEL_LEVELS
+#define TX_TIMER_WHEEL_LEVELS                   ((UINT) 3)
+#endif
+
+
+/* Define the shift that corresponds to TX_TIMER_ENTRIES, which is the log2 of the entries.  */
+
+#define TX_TIMER_WHEEL_SHIFT                    ((UINT) 5)
+
+
+/* Long timers are placed through _tx_timer_system_activate, so in-line reactivation is not used
+   with the cascade wheels.  */
+
+#ifdef TX_REACTIVATE_INLINE
+#undef TX_REACTIVATE_INLINE
+#endif
+
+
+/* Define the macro that determines if a list head is within the cascade wheels.  */
+
+#define TX_TIMER_WHEEL_LIST_CHECK(l)            ((TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(l) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_wheel_start)) && \
+                                                 (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(l) < TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_wheel_end)))
+#endif
+
+
+#ifdef TX_LOW_POWER
+
+/* Define the low power hooks, which are typically defined in tx_user.h or tx_port.h. 
+   TX_LOW_POWER_TIMER_SETUP stops the periodic timer interrupt and sets it up to occur next
+   after the specified number of ticks, or only on other interrupts for TX_WAIT_FOREVER. 
+   TX_LOW_POWER_USER_TIMER_ADJUST restarts the periodic timer interrupt and evaluates to the
+   number of ticks suppressed meanwhile. TX_LOW_POWER_USER_ENTER and TX_LOW_POWER_USER_EXIT
+   place the processor in and out of its low power mode.  */
+
+#ifndef TX_LOW_POWER_TIMER_SETUP
+#define TX_LOW_POWER_TIMER_SETUP(t)
+#endif
+
+#ifndef TX_LOW_POWER_USER_TIMER_ADJUST
+#define TX_LOW_POWER_USER_TIMER_ADJUST          ((ULONG) 0)
+#endif
+
+#ifndef TX_LOW_POWER_USER_ENTER
+#define TX_LOW_POWER_USER_ENTER
+#endif
+
+#ifndef TX_LOW_POWER_USER_EXIT
+#define TX_LOW_POWER_USER_EXIT
+#endif
+
+
+/* Define the minimum number of ticks until the next timer interrupt with work for the
+   periodic timer interrupt to be suppressed.  */
+
+#ifndef TX_LOW_POWER_TICKS_MINIMUM
+#define TX_LOW_POWER_TICKS_MINIMUM              ((ULONG) 2)
+#endif
+#endif
+
+
 /* Define internal timer management function prototypes.  */
 
 VOID        _tx_timer_expiration_process(VOID);
@@ -64,6 +130,18 @@ VOID        _tx_timer_initialize(VOID);
 VOID        _tx_timer_system_activate(TX_TIMER_INTERNAL *timer_ptr);
 VOID        _tx_timer_system_deactivate(TX_TIMER_INTERNAL *timer_ptr);
 VOID        _tx_timer_thread_entry(ULONG timer_thread_input);
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+VOID        _tx_timer_wheel_cascade(VOID);
+TX_TIMER_INTERNAL **_tx_timer_wheel_list_get(TX_TIMER_INTERNAL *timer_ptr);
+ULONG       _tx_timer_wheel_ticks_get(TX_TIMER_INTERNAL **list_head);
+#endif
+UINT        _tx_timer_get_next(ULONG *next_timer_tick_ptr);
+VOID        _tx_time_increment(ULONG time_increment);
+VOID        _tx_timer_ticks_advance(VOID);
+#ifdef TX_LOW_POWER
+VOID        _tx_timer_low_power_enter(VOID);
+VOID        _tx_timer_low_power_exit(VOID);
+#endif
 
 
 /* Timer management component data declarations follow.  */
@@ -116,12 +194,67 @@ TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_list_end;
 TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_current_ptr;
 
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+/* Define the cascade wheels. The lists of the first wheel follow each other, then the lists of
+   the second wheel, and so on. Every time the current timer pointer wraps, the current list
+   of the first wheel is moved down to the timer list. Every time the current list of a wheel
+   wraps, the current list of the next wheel is moved down as well.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL *_tx_timer_wheel[TX_TIMER_WHEEL_LEVELS * TX_TIMER_ENTRIES];
+
+
+/* Define the boundary pointers to the cascade wheels.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_wheel_start;
+TIMER_DECLARE TX_TIMER_INTERNAL **_tx_timer_wheel_end;
+
+
+/* Define the index of the next list to cascade in each wheel.  */
+
+TIMER_DECLARE UINT              _tx_timer_wheel_current[TX_TIMER_WHEEL_LEVELS];
+
+
+/* Define the number of timers on the cascade wheels.  */
+
+TIMER_DECLARE ULONG             _tx_timer_wheel_count;
+
+
+/* Define the cascade sentinel. While timers are on the cascade wheels, this internal timer is
+   kept on the last entry of the timer list so the timer interrupt processing calls the
+   expiration processing when the current timer pointer wraps.  */
+
+TIMER_DECLARE TX_TIMER_INTERNAL _tx_timer_wheel_sentinel;
+
+#endif
+
+
+#ifdef TX_LOW_POWER
+
+/* Define the flag that indicates the periodic timer interrupt is suppressed.  */
+
+TIMER_DECLARE UINT              _tx_timer_low_power_entered;
+
+
+/* Define the total number of timer interrupts suppressed while the system was idle.  */
+
+TIMER_DECLARE ULONG             _tx_timer_low_power_suppressed_ticks;
+
+#endif
+
+
 /* Define the timer expiration flag.  This is used to indicate that a timer 
    has expired.  */
 
 TIMER_DECLARE UINT              _tx_timer_expired;
 
 
+/* Define the ticks of _tx_time_increment that the timer list still has to advance over,
+   after the timer list entry that is being processed.  */
+
+TIMER_DECLARE ULONG             _tx_timer_increment_ticks;
+
+
 /* Define the created timer list head pointer.  */
 
 TIMER_DECLARE TX_TIMER          *_tx_timer_created_ptr;
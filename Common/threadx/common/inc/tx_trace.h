@@ -311,6 +311,8 @@ typedef struct TX_TRACE_OBJECT_ENTRY_STRUCT
 #define TX_TRACE_QUEUE_RECEIVE                              68          /* I1 = queue ptr, I2 = destination ptr, I3 = wait option, I4 = enqueued    */
 #define TX_TRACE_QUEUE_SEND                                 69          /* I1 = queue ptr, I2 = source ptr, I3 = wait option, I4 = enqueued         */
 #define TX_TRACE_QUEUE_SEND_NOTIFY                          70          /* I1 = queue ptr                                                           */
+#define TX_TRACE_QUEUE_POINTER_RECEIVE                      71          /* I1 = queue ptr, I2 = count, I3 = wait option, I4 = enqueued              */
+#define TX_TRACE_QUEUE_POINTER_SEND                         72          /* I1 = queue ptr, I2 = count, I3 = wait option, I4 = enqueued              */
 #define TX_TRACE_SEMAPHORE_CEILING_PUT                      80          /* I1 = semaphore ptr, I2 = current count, I3 = suspended count,I4 =ceiling */
 #define TX_TRACE_SEMAPHORE_CREATE                           81          /* I1 = semaphore ptr, I2 = initial count, I3 = stack ptr                   */
 #define TX_TRACE_SEMAPHORE_DELETE                           82          /* I1 = semaphore ptr, I2 = stack ptr                                       */
@@ -374,6 +376,59 @@ typedef struct TX_TRACE_BUFFER_ENTRY_STRUCT
 } TX_TRACE_BUFFER_ENTRY;
 
 
+#ifdef TX_TRACE_ENABLE_STREAMING
+
+/* Trace Stream Description. When streaming is enabled, the application periodically drains the
+   events added to the circular trace buffer since the last drain, so a trace is not limited to the
+   size of the buffer. The events are encoded into a stream buffer supplied by the application and
+   handed to its write function, which sends them over a UART, to a host file, to a socket, etc.
+   Events overwritten before they are drained are counted and reported in the stream.
+
+   The stream is a sequence of records. Each record starts with a 1-byte tag, followed by values
+   that are encoded as unsigned LEB128 varints: 7 bits per byte, least significant first, with
+   bit 7 set in all but the last byte. The records are:
+
+                Record          Tag             Contents
+
+            [Header]            0x40            "TXTS", version, time stamp mask. Sent first and
+                                                again whenever the trace is enabled, after which
+                                                the previous time stamp, thread and priority are 0.
+            [Object]            0x41            Object pointer, type byte, parameter 1, parameter 2,
+                                                and the NUL-terminated name, from the registry.
+            [Dropped]           0x42            Number of events overwritten before being drained.
+            [Event]             0x00-0x3F       Event ID, time stamp delta from the previous event
+                                                (masked with the time stamp mask), then the thread
+                                                pointer if tag bit 0 is set and the thread priority
+                                                if tag bit 1 is set (each is sent only when it
+                                                changes), then information fields 1 through 4 for
+                                                each of tag bits 2 through 5 that is set (fields
+                                                that are zero are not sent).
+
+   The thread and object pointers are the ULONG values kept in the trace buffer, so a pointer must
+   fit in a ULONG. A port where it does not, such as the Linux port on a 64-bit host, does not
+   support event trace or the stream, and stops the build instead.
+*/
+
+#define TX_TRACE_STREAM_VERSION                             ((ULONG) 1)
+#define TX_TRACE_STREAM_RECORD_EVENT                        ((UCHAR) 0x00)
+#define TX_TRACE_STREAM_RECORD_HEADER                       ((UCHAR) 0x40)
+#define TX_TRACE_STREAM_RECORD_OBJECT                       ((UCHAR) 0x41)
+#define TX_TRACE_STREAM_RECORD_DROPPED                      ((UCHAR) 0x42)
+#define TX_TRACE_STREAM_EVENT_THREAD                        ((UCHAR) 0x01)
+#define TX_TRACE_STREAM_EVENT_PRIORITY                      ((UCHAR) 0x02)
+#define TX_TRACE_STREAM_EVENT_INFO_1                        ((UCHAR) 0x04)
+#define TX_TRACE_STREAM_EVENT_INFO_2                        ((UCHAR) 0x08)
+#define TX_TRACE_STREAM_EVENT_INFO_3                        ((UCHAR) 0x10)
+#define TX_TRACE_STREAM_EVENT_INFO_4                        ((UCHAR) 0x20)
+
+
+/* Define an upper bound of the record size, which covers an event record with every value sent
+   and an object record with a full name. The stream buffer must hold at least one record.  */
+
+#define TX_TRACE_STREAM_RECORD_MAX                          ((ULONG) (TX_TRACE_OBJECT_REGISTRY_NAME + 48))
+#endif
+
+
 /* Trace management component data declarations follow.  */
 
 /* Determine if the initialization function of this component is including
@@ -450,6 +505,77 @@ TRACE_DECLARE  ULONG                             _tx_trace_available_registry_en
 TRACE_DECLARE  ULONG                             _tx_trace_registry_search_start;
 
 
+#ifdef TX_TRACE_ENABLE_STREAMING
+
+/* Define the number of times the trace buffer wrapped since the trace was enabled. Together with
+   the current pointer, it gives the position of the trace buffer writer.  */
+
+TRACE_DECLARE  ULONG                             _tx_trace_stream_buffer_wraps;
+
+
+/* Define the position of the trace stream reader, which is the next entry to drain and the number
+   of times the reader wrapped.  */
+
+TRACE_DECLARE  TX_TRACE_BUFFER_ENTRY             *_tx_trace_stream_read_ptr;
+TRACE_DECLARE  ULONG                             _tx_trace_stream_read_wraps;
+
+
+/* Define the stream buffer supplied by the application, where records are encoded before they are
+   written, and the pointer to the next free byte.  */
+
+TRACE_DECLARE  UCHAR                             *_tx_trace_stream_buffer_start;
+TRACE_DECLARE  UCHAR                             *_tx_trace_stream_buffer_end;
+TRACE_DECLARE  UCHAR                             *_tx_trace_stream_buffer_current;
+
+
+/* Define the application function that writes the encoded records. If NULL, streaming is not
+   enabled.  */
+
+TRACE_DECLARE  UINT                              (*_tx_trace_stream_write_function)(UCHAR *data, ULONG size);
+
+
+/* Define the state the next event is encoded against.  */
+
+TRACE_DECLARE  ULONG                             _tx_trace_stream_time_stamp;
+TRACE_DECLARE  ULONG                             _tx_trace_stream_thread_pointer;
+TRACE_DECLARE  ULONG                             _tx_trace_stream_thread_priority;
+TRACE_DECLARE  UINT                              _tx_trace_stream_header_pending;
+
+
+/* Define the stream statistics. Events are counted as streamed once they have been written, and
+   the events in the stream buffer are counted as dropped if the write fails.  */
+
+TRACE_DECLARE  ULONG                             _tx_trace_stream_buffer_events;
+TRACE_DECLARE  ULONG                             _tx_trace_stream_events;
+TRACE_DECLARE  ULONG                             _tx_trace_stream_dropped;
+TRACE_DECLARE  ULONG                             _tx_trace_stream_bytes;
+
+
+/* Define the macro that counts the trace buffer wraps in the event insert.  */
+
+#define TX_TRACE_STREAM_BUFFER_WRAP                             _tx_trace_stream_buffer_wraps++;
+
+
+/* Define the macro that encodes a value as an unsigned LEB128 varint in the stream buffer.  */
+
+#define TX_TRACE_STREAM_VALUE_PUT(v) \
+        { \
+        ULONG   stream_value; \
+            stream_value =  (ULONG) (v); \
+            while (stream_value >= ((ULONG) 0x80)) \
+            { \
+                *_tx_trace_stream_buffer_current =  (UCHAR) ((stream_value & ((ULONG) 0x7F)) | ((ULONG) 0x80)); \
+                _tx_trace_stream_buffer_current++; \
+                stream_value =  stream_value >> 7; \
+            } \
+            *_tx_trace_stream_buffer_current =  (UCHAR) stream_value; \
+            _tx_trace_stream_buffer_current++; \
+        }
+#else
+#define TX_TRACE_STREAM_BUFFER_WRAP
+#endif
+
+
 /* Define the event trace macros that are expanded in-line when event tracing is enabled.  */
 
 #ifdef TX_MISRA_ENABLE
@@ -502,6 +628,7 @@ TRACE_DECLARE  ULONG                             _tx_trace_registry_search_start
                     trace_event_ptr =  _tx_trace_buffer_start_ptr; \
                     _tx_trace_buffer_current_ptr =  trace_event_ptr;  \
                     _tx_trace_header_ptr -> tx_trace_header_buffer_current_pointer =  (ULONG) trace_event_ptr; \
+                    TX_TRACE_STREAM_BUFFER_WRAP \
                     if (_tx_trace_full_notify_function) \
                         (_tx_trace_full_notify_function)((VOID *) _tx_trace_header_ptr); \
                 } \
@@ -523,6 +650,8 @@ TRACE_DECLARE  ULONG                             _tx_trace_registry_search_start
 VOID    _tx_trace_initialize(VOID);
 VOID    _tx_trace_object_register(UCHAR object_type, VOID *object_ptr, CHAR *object_name, ULONG parameter_1, ULONG parameter_2);
 VOID    _tx_trace_object_unregister(VOID *object_ptr);
+UINT    _tx_trace_stream_flush(VOID);
+UINT    _tx_trace_stream_registry_send(ULONG object_pointer);
 
 
 #ifdef TX_ENABLE_EVENT_TRACE
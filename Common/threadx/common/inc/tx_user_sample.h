@@ -117,6 +117,28 @@
 #define TX_REACTIVATE_INLINE
 */
 
+/* Determine if timers longer than the timer list are placed on hierarchical cascade wheels.
+   By default, such timers are placed at the end of the timer list and processed again every
+   32 ticks until they expire. When the following is defined, they are placed on one of
+   TX_TIMER_WHEEL_LEVELS wheels and only moved down when their wheel list cascades. This
+   option replaces TX_REACTIVATE_INLINE.  */
+
+/*
+#define TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+#define TX_TIMER_WHEEL_LEVELS                   3
+*/
+
+/* Determine if the periodic timer interrupt is suppressed while the system is idle. By default,
+   the timer interrupt occurs every tick. When the following is defined, the idle processing of
+   ports that support it calls _tx_timer_low_power_enter and _tx_timer_low_power_exit, which
+   suppress the timer interrupt until the next tick with timer work and then bring the system
+   clock and timers up to date in one step. The TX_LOW_POWER_TIMER_SETUP and
+   TX_LOW_POWER_USER_TIMER_ADJUST hooks described in tx_timer.h program the hardware timer.  */
+
+/*
+#define TX_LOW_POWER
+*/
+
 /* Determine is stack filling is enabled. By default, ThreadX stack filling is enabled,
    which places an 0xEF pattern in each byte of each thread's stack.  This is used by
    debuggers with ThreadX-awareness and by the ThreadX run-time stack checking feature.  */
@@ -135,6 +157,16 @@
 #define TX_ENABLE_STACK_CHECKING
 */
 
+/* Determine whether or not the stack monitor is enabled. By default, the stack monitor is disabled.
+   When the following is defined, tx_thread_stack_monitor_start starts a timer that scans a bounded
+   number of stack words per expiration, keeping the exact stack high-water mark of every created
+   thread up to date and notifying the application when the headroom of a thread drops below a
+   threshold. The stack monitor requires the stack filling and the timer.  */
+
+/*
+#define TX_THREAD_ENABLE_STACK_MONITOR
+*/
+
 /* Determine if preemption-threshold should be disabled. By default, preemption-threshold is 
    enabled. If the application does not use preemption-threshold, it may be disabled to reduce
    code size and improve performance.  */
@@ -199,6 +231,27 @@
 */
 
 
+/* Determine if the trace buffer can be streamed. When the following is defined along with
+   TX_ENABLE_EVENT_TRACE, tx_trace_stream_drain encodes the events added to the trace buffer since
+   the last drain and hands them to a write function supplied by the application, so the trace is
+   not limited to the size of the trace buffer.  */
+
+/*
+#define TX_TRACE_ENABLE_STREAMING
+*/
+
+
+/* Determine if the port notifies thread and ISR execution changes. When the following is defined,
+   ports call _tx_execution_thread_enter, _tx_execution_thread_exit, _tx_execution_isr_enter and
+   _tx_execution_isr_exit, which the execution profile kit in utility/execution_profile_kit uses
+   to accumulate the time spent in each thread, in ISRs and idle. See tx_execution_profile.h for
+   its time source.  */
+
+/*
+#define TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+*/
+
+
 /* Determine if block pool performance gathering is required by the application. When the following is
    defined, ThreadX gathers various block pool performance information. */
 
@@ -213,6 +266,14 @@
 #define TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
 */
 
+/* Determine if byte pools use the two-level segregated fit (TLSF) allocator. When the following is
+   defined, byte allocate and release take constant time instead of searching the fragments of the
+   pool. Each byte pool control block grows by the TLSF free lists, see TX_BYTE_POOL_TLSF_FL_MAX.  */
+
+/*
+#define TX_BYTE_POOL_ENABLE_TLSF
+*/
+
 /* Determine if event flags performance gathering is required by the application. When the following is
    defined, ThreadX gathers various event flags performance information. */
 
@@ -220,6 +281,15 @@
 #define TX_EVENT_FLAGS_ENABLE_PERFORMANCE_INFO
 */
 
+/* Determine if the suspended threads of event flags groups are kept in buckets by the flags they
+   wait for. When the following is defined, a set only visits the threads waiting for one of the
+   flags set, and the threads waiting for several flags, instead of all the suspended threads. This
+   adds 33 pointers to each event flags group and two to each thread.  */
+
+/*
+#define TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+*/
+
 /* Determine if mutex performance gathering is required by the application. When the following is
    defined, ThreadX gathers various mutex performance information. */
 
@@ -227,6 +297,20 @@
 #define TX_MUTEX_ENABLE_PERFORMANCE_INFO
 */
 
+/* Determine if the mutex contention profile is required by the application. When the following is
+   defined, each mutex keeps histograms of the times it was held and of the times threads waited for
+   it, the threads that held it and waited for it the longest, and its priority inheritance events,
+   which tx_mutex_contention_info_get and tx_mutex_contention_reset retrieve and clear. Times are read
+   from TX_MUTEX_CONTENTION_TIME_SOURCE, which defaults to TX_TRACE_TIME_SOURCE, and are counted in
+   TX_MUTEX_CONTENTION_BUCKETS power of two buckets, the first of which counts the times shorter than
+   2^TX_MUTEX_CONTENTION_SHIFT units.  */
+
+/*
+#define TX_MUTEX_ENABLE_CONTENTION_PROFILE
+#define TX_MUTEX_CONTENTION_BUCKETS             16
+#define TX_MUTEX_CONTENTION_SHIFT               8
+*/
+
 /* Determine if queue performance gathering is required by the application. When the following is
    defined, ThreadX gathers various queue performance information. */
 
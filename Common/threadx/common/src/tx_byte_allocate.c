@@ -170,7 +170,11 @@ ULONG                       lower_tbu;
 
         /* At this point, the executing thread owns the pool and can perform a search
            for free memory.  */
+#ifndef TX_BYTE_POOL_ENABLE_TLSF
         work_ptr =  _tx_byte_pool_search(pool_ptr, memory_size);
+#else
+        work_ptr =  _tx_byte_pool_tlsf_search(pool_ptr, memory_size);
+#endif
 
         /* Optional processing extension.  */
         TX_BYTE_ALLOCATE_EXTENSION
@@ -80,10 +80,15 @@ TX_INTERRUPT_SAVE_AREA
 
 UCHAR               *block_ptr;
 UCHAR               **block_indirect_ptr;
-UCHAR               *temp_ptr;
 TX_BYTE_POOL        *next_pool;
 TX_BYTE_POOL        *previous_pool;
+#ifndef TX_BYTE_POOL_ENABLE_TLSF
 ALIGN_TYPE          *free_ptr;
+UCHAR               *temp_ptr;
+#else
+UCHAR               *first_ptr;
+UCHAR               *work_ptr;
+#endif
 
 
     /* Initialize the byte pool control block to all zeros.  */
@@ -100,6 +105,8 @@ ALIGN_TYPE          *free_ptr;
     pool_ptr -> tx_byte_pool_start =   TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
     pool_ptr -> tx_byte_pool_size =    pool_size;
 
+#ifndef TX_BYTE_POOL_ENABLE_TLSF
+
     /* Setup memory list to the beginning as well as the search pointer.  */
     pool_ptr -> tx_byte_pool_list =    TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
     pool_ptr -> tx_byte_pool_search =  TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
@@ -139,6 +146,39 @@ ALIGN_TYPE          *free_ptr;
     block_ptr =            TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *)));
     free_ptr =             TX_UCHAR_TO_ALIGN_TYPE_POINTER_CONVERT(block_ptr);
     *free_ptr =            TX_BYTE_BLOCK_FREE;
+#else
+
+    /* A TLSF pool has the same two blocks, but each block is preceded by a pointer
+       to the previous block.  The first block has no previous block.  */
+    block_ptr =            TX_VOID_TO_UCHAR_POINTER_CONVERT(pool_start);
+    block_indirect_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+    *block_indirect_ptr =  TX_NULL;
+    first_ptr =            TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *)));
+
+    /* Setup memory list to the first block as well as the search pointer.  */
+    pool_ptr -> tx_byte_pool_list =    first_ptr;
+    pool_ptr -> tx_byte_pool_search =  first_ptr;
+
+    /* Count the available block's header in the available bytes count, as above.  */
+    pool_ptr -> tx_byte_pool_available =   pool_size - ((sizeof(UCHAR *)) + (sizeof(VOID *)) + (sizeof(ALIGN_TYPE)));
+    pool_ptr -> tx_byte_pool_fragments =   ((UINT) 2);
+
+    /* Build the pre-allocated block at the end of the pool.  */
+    block_ptr =            TX_UCHAR_POINTER_ADD(block_ptr, pool_size);
+    block_ptr =            TX_UCHAR_POINTER_SUB(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+    work_ptr =             TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *)));
+    block_indirect_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+    *block_indirect_ptr =  TX_BYTE_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+    block_indirect_ptr =   TX_BYTE_POOL_TLSF_NEXT_LINK(block_ptr);
+    *block_indirect_ptr =  first_ptr;
+    block_indirect_ptr =   TX_BYTE_POOL_TLSF_PREVIOUS_LINK(block_ptr);
+    *block_indirect_ptr =  first_ptr;
+
+    /* Now setup the large available block in the pool and place it on its free list.  */
+    block_indirect_ptr =   TX_BYTE_POOL_TLSF_NEXT_LINK(first_ptr);
+    *block_indirect_ptr =  block_ptr;
+    _tx_byte_pool_tlsf_insert(pool_ptr, first_ptr);
+#endif
 
     /* Clear the owner id.  */
     pool_ptr -> tx_byte_pool_owner =  TX_NULL;
@@ -0,0 +1,123 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_insert                           PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function marks a byte pool block as free and places it on the  */
+/*    TLSF free list of its size class.                                   */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to the block              */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_create              Create byte pool                  */
+/*    _tx_byte_pool_tlsf_search         Search byte pool for memory       */
+/*    _tx_byte_pool_tlsf_release        Release block to byte pool        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_insert(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+UCHAR           **block_link_ptr;
+UCHAR           *next_block_ptr;
+UCHAR           *head_ptr;
+ALIGN_TYPE      *free_ptr;
+ULONG           block_size;
+ULONG           work_size;
+UINT            first_level;
+UINT            second_level;
+
+
+    /* Mark the block as free.  */
+    free_ptr =   TX_BYTE_POOL_TLSF_OWNER(block_ptr);
+    *free_ptr =  TX_BYTE_BLOCK_FREE;
+
+    /* Pickup the size of the block.  */
+    block_link_ptr =  TX_BYTE_POOL_TLSF_NEXT_LINK(block_ptr);
+    next_block_ptr =  *block_link_ptr;
+    block_size =      TX_UCHAR_POINTER_DIF(next_block_ptr, block_ptr);
+
+    /* Find the size class of the block.  */
+    TX_BYTE_POOL_TLSF_MAPPING(block_size, first_level, second_level, work_size)
+
+    /* Place the block at the head of the free list.  */
+    head_ptr =         pool_ptr -> tx_byte_pool_tlsf_free_list[first_level][second_level];
+    block_link_ptr =   TX_BYTE_POOL_TLSF_FREE_NEXT_LINK(block_ptr);
+    *block_link_ptr =  head_ptr;
+    block_link_ptr =   TX_BYTE_POOL_TLSF_FREE_PREVIOUS_LINK(block_ptr);
+    *block_link_ptr =  TX_NULL;
+    if (head_ptr != TX_NULL)
+    {
+
+        /* Link the previous head back to this block.  */
+        block_link_ptr =   TX_BYTE_POOL_TLSF_FREE_PREVIOUS_LINK(head_ptr);
+        *block_link_ptr =  block_ptr;
+    }
+    pool_ptr -> tx_byte_pool_tlsf_free_list[first_level][second_level] =  block_ptr;
+
+    /* Mark the size class as not empty.  */
+    pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] =
+        pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] | (((ULONG) 1) << second_level);
+    pool_ptr -> tx_byte_pool_tlsf_fl_bitmap =  pool_ptr -> tx_byte_pool_tlsf_fl_bitmap | (((ULONG) 1) << first_level);
+}
+#endif /* TX_BYTE_POOL_ENABLE_TLSF */
+
@@ -0,0 +1,159 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_release                          PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns an allocated block to a TLSF byte pool.  The  */
+/*    block is merged with its previous and next blocks if they are free  */
+/*    and the result is placed on the free list of its size class.        */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to the allocated block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_insert         Place block on free list          */
+/*    _tx_byte_pool_tlsf_remove         Remove block from free list       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_release(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+UCHAR           **block_link_ptr;
+UCHAR           *next_block_ptr;
+UCHAR           *neighbor_ptr;
+ALIGN_TYPE      *free_ptr;
+
+
+    /* Update the number of available bytes in the pool.  */
+    block_link_ptr =  TX_BYTE_POOL_TLSF_NEXT_LINK(block_ptr);
+    next_block_ptr =  *block_link_ptr;
+    pool_ptr -> tx_byte_pool_available =  
+        pool_ptr -> tx_byte_pool_available + TX_UCHAR_POINTER_DIF(next_block_ptr, block_ptr);
+
+    /* Determine if the next block is free.  The block at the end of the pool
+       is always allocated, so there is always a next block.  */
+    free_ptr =  TX_BYTE_POOL_TLSF_OWNER(next_block_ptr);
+    if ((*free_ptr) == TX_BYTE_BLOCK_FREE)
+    {
+
+        /* Yes, take it off its free list and merge it into this block.  */
+        _tx_byte_pool_tlsf_remove(pool_ptr, next_block_ptr);
+        block_link_ptr =   TX_BYTE_POOL_TLSF_NEXT_LINK(next_block_ptr);
+        neighbor_ptr =     *block_link_ptr;
+        block_link_ptr =   TX_BYTE_POOL_TLSF_NEXT_LINK(block_ptr);
+        *block_link_ptr =  neighbor_ptr;
+        block_link_ptr =   TX_BYTE_POOL_TLSF_PREVIOUS_LINK(neighbor_ptr);
+        *block_link_ptr =  block_ptr;
+
+        /* Reduce the fragment total.  */
+        pool_ptr -> tx_byte_pool_fragments--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total merge counter.  */
+        _tx_byte_pool_performance_merge_count++;
+
+        /* Increment the number of blocks merged on this pool.  */
+        pool_ptr -> tx_byte_pool_performance_merge_count++;
+#endif
+    }
+
+    /* Determine if the previous block is free.  The first block of the pool
+       has no previous block.  */
+    block_link_ptr =  TX_BYTE_POOL_TLSF_PREVIOUS_LINK(block_ptr);
+    neighbor_ptr =    *block_link_ptr;
+    if (neighbor_ptr != TX_NULL)
+    {
+
+        free_ptr =  TX_BYTE_POOL_TLSF_OWNER(neighbor_ptr);
+        if ((*free_ptr) == TX_BYTE_BLOCK_FREE)
+        {
+
+            /* Yes, take it off its free list and merge this block into it.  */
+            _tx_byte_pool_tlsf_remove(pool_ptr, neighbor_ptr);
+            block_link_ptr =   TX_BYTE_POOL_TLSF_NEXT_LINK(block_ptr);
+            next_block_ptr =   *block_link_ptr;
+            block_link_ptr =   TX_BYTE_POOL_TLSF_NEXT_LINK(neighbor_ptr);
+            *block_link_ptr =  next_block_ptr;
+            block_link_ptr =   TX_BYTE_POOL_TLSF_PREVIOUS_LINK(next_block_ptr);
+            *block_link_ptr =  neighbor_ptr;
+            block_ptr =        neighbor_ptr;
+
+            /* Reduce the fragment total.  */
+            pool_ptr -> tx_byte_pool_fragments--;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total merge counter.  */
+            _tx_byte_pool_performance_merge_count++;
+
+            /* Increment the number of blocks merged on this pool.  */
+            pool_ptr -> tx_byte_pool_performance_merge_count++;
+#endif
+        }
+    }
+
+    /* Place the resulting block on its free list.  */
+    _tx_byte_pool_tlsf_insert(pool_ptr, block_ptr);
+}
+#endif /* TX_BYTE_POOL_ENABLE_TLSF */
+
@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_remove                           PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a free byte pool block from the TLSF free     */
+/*    list of its size class.                                             */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    block_ptr                         Pointer to the free block         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_search         Search byte pool for memory       */
+/*    _tx_byte_pool_tlsf_release        Release block to byte pool        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_byte_pool_tlsf_remove(TX_BYTE_POOL *pool_ptr, UCHAR *block_ptr)
+{
+
+UCHAR           **block_link_ptr;
+UCHAR           *next_block_ptr;
+UCHAR           *next_free_ptr;
+UCHAR           *previous_free_ptr;
+ULONG           block_size;
+ULONG           work_size;
+UINT            first_level;
+UINT            second_level;
+
+
+    /* Pickup the size of the block.  */
+    block_link_ptr =  TX_BYTE_POOL_TLSF_NEXT_LINK(block_ptr);
+    next_block_ptr =  *block_link_ptr;
+    block_size =      TX_UCHAR_POINTER_DIF(next_block_ptr, block_ptr);
+
+    /* Find the size class of the block.  */
+    TX_BYTE_POOL_TLSF_MAPPING(block_size, first_level, second_level, work_size)
+
+    /* Pickup the neighbors on the free list.  */
+    block_link_ptr =     TX_BYTE_POOL_TLSF_FREE_NEXT_LINK(block_ptr);
+    next_free_ptr =      *block_link_ptr;
+    block_link_ptr =     TX_BYTE_POOL_TLSF_FREE_PREVIOUS_LINK(block_ptr);
+    previous_free_ptr =  *block_link_ptr;
+
+    /* Unlink the block.  */
+    if (next_free_ptr != TX_NULL)
+    {
+
+        block_link_ptr =   TX_BYTE_POOL_TLSF_FREE_PREVIOUS_LINK(next_free_ptr);
+        *block_link_ptr =  previous_free_ptr;
+    }
+
+    if (previous_free_ptr != TX_NULL)
+    {
+
+        block_link_ptr =   TX_BYTE_POOL_TLSF_FREE_NEXT_LINK(previous_free_ptr);
+        *block_link_ptr =  next_free_ptr;
+    }
+    else
+    {
+
+        /* The block is the head of the list, update the head pointer.  */
+        pool_ptr -> tx_byte_pool_tlsf_free_list[first_level][second_level] =  next_free_ptr;
+
+        /* Determine if the size class is now empty.  */
+        if (next_free_ptr == TX_NULL)
+        {
+
+            /* Yes, clear the second-level bit.  */
+            pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] =
+                pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] & (~(((ULONG) 1) << second_level));
+
+            /* Clear the first-level bit if all its classes are empty.  */
+            if (pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] == ((ULONG) 0))
+            {
+
+                pool_ptr -> tx_byte_pool_tlsf_fl_bitmap =
+                    pool_ptr -> tx_byte_pool_tlsf_fl_bitmap & (~(((ULONG) 1) << first_level));
+            }
+        }
+    }
+}
+#endif /* TX_BYTE_POOL_ENABLE_TLSF */
+
@@ -0,0 +1,267 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Byte Pool                                                           */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_byte_pool.h"
+
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_search                           PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates a block from a TLSF byte pool.  The request */
+/*    is rounded up to the next size class, so the first block on the     */
+/*    smallest non-empty class at or above it always fits.  The class is  */
+/*    found from the pool bitmaps in constant time and the block is split */
+/*    if the remainder is large enough to be a block of its own.  If no   */
+/*    class guarantees a fit, the first block of the request's own class  */
+/*    is checked before the search fails.                                 */
+/*                                                                        */
+/*    Unlike _tx_byte_pool_search, the search does not depend on the      */
+/*    number of fragments, so it runs with interrupts disabled and is     */
+/*    never restarted by a change of pool ownership.                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to pool control block     */
+/*    memory_size                       Number of bytes required          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    UCHAR *                           Pointer to the allocated memory,  */
+/*                                        if successful.  Otherwise, a    */
+/*                                        NULL is returned                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_byte_pool_tlsf_insert         Place block on free list          */
+/*    _tx_byte_pool_tlsf_remove         Remove block from free list       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_byte_allocate                 Allocate bytes of memory          */
+/*    _tx_byte_release                  Release bytes of memory           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UCHAR  *_tx_byte_pool_tlsf_search(TX_BYTE_POOL *pool_ptr, ULONG memory_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UCHAR           *block_ptr;
+UCHAR           *next_block_ptr;
+UCHAR           *split_ptr;
+UCHAR           **block_link_ptr;
+ULONG           block_size;
+ULONG           request_size;
+ULONG           class_size;
+ULONG           bitmap;
+ULONG           work_size;
+UINT            first_level;
+UINT            second_level;
+
+
+    /* Calculate the size of the block needed, including its overhead.  */
+    request_size =  memory_size + TX_BYTE_POOL_TLSF_BLOCK_OVERHEAD;
+    if (request_size < TX_BYTE_POOL_TLSF_BLOCK_MIN)
+    {
+
+        /* Every block must be able to hold the free list links once released.  */
+        request_size =  TX_BYTE_POOL_TLSF_BLOCK_MIN;
+    }
+
+    /* Round the request up to the start of the next size class.  */
+    class_size =  request_size;
+    if (class_size >= (((ULONG) 1) << TX_BYTE_POOL_TLSF_FL_SHIFT))
+    {
+
+        work_size =   class_size;
+        TX_BYTE_POOL_HIGHEST_SET_BIT_CALCULATE(work_size, first_level)
+        class_size =  class_size + ((((ULONG) 1) << (first_level - ((UINT) TX_BYTE_POOL_TLSF_SL_SHIFT))) - ((ULONG) 1));
+    }
+
+    /* Default to no block found.  */
+    block_ptr =  TX_NULL;
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* First, determine if there are enough bytes in the pool.  */
+    if ((memory_size < pool_ptr -> tx_byte_pool_available) && (request_size <= TX_BYTE_POOL_TLSF_BLOCK_MAX))
+    {
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+        /* Increment the total fragment search counter.  */
+        _tx_byte_pool_performance_search_count++;
+
+        /* Increment the number of fragments searched on this pool.  */
+        pool_ptr -> tx_byte_pool_performance_search_count++;
+#endif
+
+        /* Default to no size class found.  */
+        bitmap =  ((ULONG) 0);
+
+        /* Determine if the rounded request fits in a size class.  */
+        if (class_size <= TX_BYTE_POOL_TLSF_BLOCK_MAX)
+        {
+
+            /* Find the size class of the rounded request.  */
+            TX_BYTE_POOL_TLSF_MAPPING(class_size, first_level, second_level, work_size)
+
+            /* Look for a non-empty class at or above the request in the same
+               first-level class.  */
+            bitmap =  pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level] & ((~((ULONG) 0)) << second_level);
+            if (bitmap == ((ULONG) 0))
+            {
+
+                /* None, look for the next non-empty first-level class.  */
+                bitmap =  pool_ptr -> tx_byte_pool_tlsf_fl_bitmap & ((~((ULONG) 0)) << (first_level + ((UINT) 1)));
+                if (bitmap != ((ULONG) 0))
+                {
+
+                    /* Use its smallest non-empty second-level class.  */
+                    TX_LOWEST_SET_BIT_CALCULATE(bitmap, first_level)
+                    bitmap =  pool_ptr -> tx_byte_pool_tlsf_sl_bitmap[first_level];
+                }
+            }
+        }
+
+        /* Determine if a size class was found.  */
+        if (bitmap != ((ULONG) 0))
+        {
+
+            /* Yes, any block of the class fits, take the first one.  */
+            TX_LOWEST_SET_BIT_CALCULATE(bitmap, second_level)
+            block_ptr =  pool_ptr -> tx_byte_pool_tlsf_free_list[first_level][second_level];
+        }
+        else
+        {
+
+            /* No, the blocks of the request's own class may still fit.  Check the
+               first one so a request close to the largest free block does not fail.  */
+            TX_BYTE_POOL_TLSF_MAPPING(request_size, first_level, second_level, work_size)
+            block_ptr =  pool_ptr -> tx_byte_pool_tlsf_free_list[first_level][second_level];
+            if (block_ptr != TX_NULL)
+            {
+
+                block_link_ptr =  TX_BYTE_POOL_TLSF_NEXT_LINK(block_ptr);
+                next_block_ptr =  *block_link_ptr;
+                if (TX_UCHAR_POINTER_DIF(next_block_ptr, block_ptr) < request_size)
+                {
+
+                    /* Too small.  */
+                    block_ptr =  TX_NULL;
+                }
+            }
+        }
+
+        /* Determine if a block was found.  */
+        if (block_ptr != TX_NULL)
+        {
+
+            /* Yes, take it off its free list.  */
+            _tx_byte_pool_tlsf_remove(pool_ptr, block_ptr);
+
+            /* Pickup the size of the block.  */
+            block_link_ptr =  TX_BYTE_POOL_TLSF_NEXT_LINK(block_ptr);
+            next_block_ptr =  *block_link_ptr;
+            block_size =      TX_UCHAR_POINTER_DIF(next_block_ptr, block_ptr);
+
+            /* Determine if we need to split this block.  */
+            if ((block_size - request_size) >= TX_BYTE_POOL_TLSF_BLOCK_MIN)
+            {
+
+                /* Split the block.  */
+                split_ptr =  TX_UCHAR_POINTER_ADD(block_ptr, request_size);
+
+                /* Setup the new free block between this block and the next.  */
+                block_link_ptr =   TX_BYTE_POOL_TLSF_NEXT_LINK(split_ptr);
+                *block_link_ptr =  next_block_ptr;
+                block_link_ptr =   TX_BYTE_POOL_TLSF_PREVIOUS_LINK(split_ptr);
+                *block_link_ptr =  block_ptr;
+                block_link_ptr =   TX_BYTE_POOL_TLSF_PREVIOUS_LINK(next_block_ptr);
+                *block_link_ptr =  split_ptr;
+                block_link_ptr =   TX_BYTE_POOL_TLSF_NEXT_LINK(block_ptr);
+                *block_link_ptr =  split_ptr;
+
+                /* Place the remainder on its free list.  */
+                _tx_byte_pool_tlsf_insert(pool_ptr, split_ptr);
+
+                /* Increase the total fragment counter.  */
+                pool_ptr -> tx_byte_pool_fragments++;
+
+                /* Only the requested size is taken from the pool.  */
+                block_size =  request_size;
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+
+                /* Increment the total split counter.  */
+                _tx_byte_pool_performance_split_count++;
+
+                /* Increment the number of blocks split on this pool.  */
+                pool_ptr -> tx_byte_pool_performance_split_count++;
+#endif
+            }
+
+            /* In any case, mark the block as allocated.  */
+            split_ptr =        TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *)));
+            block_link_ptr =   TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(split_ptr);
+            *block_link_ptr =  TX_BYTE_POOL_TO_UCHAR_POINTER_CONVERT(pool_ptr);
+
+            /* Reduce the number of available bytes in the pool.  */
+            pool_ptr -> tx_byte_pool_available =  pool_ptr -> tx_byte_pool_available - block_size;
+
+            /* Adjust the pointer for the application.  */
+            block_ptr =  TX_UCHAR_POINTER_ADD(block_ptr, ((sizeof(UCHAR *)) + (sizeof(ALIGN_TYPE))));
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return the block pointer.  */
+    return(block_ptr);
+}
+#endif /* TX_BYTE_POOL_ENABLE_TLSF */
+
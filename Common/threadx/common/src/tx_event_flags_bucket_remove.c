@@ -0,0 +1,137 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Event Flags                                                         */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_event_flags.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_event_flags_bucket_remove                       PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function removes a thread that is no longer suspended on an    */
+/*    event flags group from the bucket of the flags it waits for. It is  */
+/*    called with interrupts disabled.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    group_ptr                         Pointer to group control block    */
+/*    thread_ptr                        Pointer to the suspended thread   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_event_flags_cleanup           Event flags cleanup               */
+/*    _tx_event_flags_set               Event flags set                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_event_flags_bucket_remove(TX_EVENT_FLAGS_GROUP *group_ptr, TX_THREAD *thread_ptr)
+{
+
+#ifdef TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+
+ULONG       requested_flags;
+ULONG       lowest_flag;
+UINT        bucket;
+TX_THREAD   *next_thread;
+TX_THREAD   *previous_thread;
+
+
+    /* Pickup the flags the thread waits for.  */
+    requested_flags =  thread_ptr -> tx_thread_suspend_info;
+
+    /* Determine if the thread waits for a single flag.  */
+    lowest_flag =  requested_flags & ((~requested_flags) + ((ULONG) 1));
+    if ((requested_flags != ((ULONG) 0)) && (lowest_flag == requested_flags))
+    {
+
+        /* Yes, the bucket is the one of this flag.  */
+        TX_LOWEST_SET_BIT_CALCULATE(lowest_flag, bucket)
+    }
+    else
+    {
+
+        /* No, the bucket is the one of the threads waiting for several flags.  */
+        bucket =  TX_EVENT_FLAGS_BUCKET_SEVERAL;
+
+        /* Decrement the number of threads waiting for several flags.  */
+        group_ptr -> tx_event_flags_group_several_count--;
+    }
+
+    /* Determine if the thread is the only one in the bucket.  */
+    next_thread =  thread_ptr -> tx_thread_event_flags_bucket_next;
+    if (next_thread == thread_ptr)
+    {
+
+        /* Yes, the bucket is empty now.  */
+        group_ptr -> tx_event_flags_group_bucket[bucket] =  TX_NULL;
+    }
+    else
+    {
+
+        /* No, update the links of the adjacent threads.  */
+        previous_thread =                                       thread_ptr -> tx_thread_event_flags_bucket_previous;
+        next_thread -> tx_thread_event_flags_bucket_previous =  previous_thread;
+        previous_thread -> tx_thread_event_flags_bucket_next =  next_thread;
+
+        /* Determine if the head of the bucket is removed.  */
+        if (group_ptr -> tx_event_flags_group_bucket[bucket] == thread_ptr)
+        {
+
+            /* Yes, the next thread is the head now.  */
+            group_ptr -> tx_event_flags_group_bucket[bucket] =  next_thread;
+        }
+    }
+#else
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    TX_PARAMETER_NOT_USED(group_ptr);
+    TX_PARAMETER_NOT_USED(thread_ptr);
+#endif
+}
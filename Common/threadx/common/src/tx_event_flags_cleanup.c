@@ -57,6 +57,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_event_flags_bucket_remove     Remove thread from its bucket     */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*                                                                        */
@@ -142,6 +143,12 @@ TX_THREAD                   *previous_thread;
 
                             /* Remove the suspended thread from the list.  */
 
+#ifdef TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+
+                            /* Remove the thread from its bucket as well.  */
+                            _tx_event_flags_bucket_remove(group_ptr, thread_ptr);
+#endif
+
                             /* Decrement the local suspension count.  */
                             suspended_count--;
               
@@ -156,6 +163,9 @@ TX_THREAD                   *previous_thread;
         
                                 /* Update the head pointer.  */
                                 group_ptr -> tx_event_flags_group_suspension_list =  TX_NULL;
+
+                                /* No flags are requested anymore.  */
+                                group_ptr -> tx_event_flags_group_suspended_flags =  ((ULONG) 0);
                             }
                             else
                             {
@@ -62,6 +62,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_event_flags_bucket_insert     Place thread in its bucket        */
 /*    _tx_thread_system_suspend         Suspend thread service            */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
 /*                                                                        */
@@ -348,8 +349,18 @@ UINT            interrupted_set_request;
                     next_thread -> tx_thread_suspended_previous =   thread_ptr;
                 }
 
+#ifdef TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+
+                /* Place the thread in the bucket of the flags it waits for as well.  */
+                _tx_event_flags_bucket_insert(group_ptr, thread_ptr);
+#endif
+
                 /* Increment the number of threads suspended.  */
                 group_ptr -> tx_event_flags_group_suspended_count++;
+
+                /* Add the requested flags to the flags the suspended threads are waiting for.  */
+                group_ptr -> tx_event_flags_group_suspended_flags =
+                                        group_ptr -> tx_event_flags_group_suspended_flags | requested_flags;
             
                 /* Set the state to suspended.  */
                 thread_ptr -> tx_thread_state =    TX_EVENT_FLAG;
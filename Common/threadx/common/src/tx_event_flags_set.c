@@ -60,6 +60,7 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
+/*    _tx_event_flags_bucket_remove     Remove thread from its bucket     */
 /*    _tx_thread_system_preempt_check   Check for preemption              */
 /*    _tx_thread_system_resume          Resume thread service             */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
@@ -93,6 +94,7 @@ UINT            suspended_count;
 ULONG           current_event_flags;
 ULONG           requested_flags;
 ULONG           flags_satisfied;
+ULONG           suspended_flags;
 ULONG           *suspend_info_ptr;
 UINT            and_request;
 UINT            get_option;
@@ -101,6 +103,14 @@ UINT            preempt_check;
 #ifndef TX_NOT_INTERRUPTABLE
 UINT            interrupted_set_request;
 #endif
+#ifdef TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+ULONG           bucket_flags;
+ULONG           lowest_flag;
+UINT            bucket;
+UINT            bucket_search;
+UINT            several_count;
+TX_THREAD       *several_thread;
+#endif
 #ifndef TX_DISABLE_NOTIFY_CALLBACKS
 VOID            (*events_set_notify)(struct TX_EVENT_FLAGS_GROUP_STRUCT *notify_group_ptr);
 #endif
@@ -285,6 +295,13 @@ VOID            (*events_set_notify)(struct TX_EVENT_FLAGS_GROUP_STRUCT *notify_
                     /* Clear the suspension information in the event flag group.  */
                     group_ptr -> tx_event_flags_group_suspension_list =  TX_NULL;
                     group_ptr -> tx_event_flags_group_suspended_count =  TX_NO_SUSPENSIONS;
+                    group_ptr -> tx_event_flags_group_suspended_flags =  ((ULONG) 0);
+
+#ifdef TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+
+                    /* Remove the thread from its bucket as well.  */
+                    _tx_event_flags_bucket_remove(group_ptr, thread_ptr);
+#endif
 
                     /* Clear cleanup routine to avoid timeout.  */
                     thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
@@ -312,7 +329,10 @@ VOID            (*events_set_notify)(struct TX_EVENT_FLAGS_GROUP_STRUCT *notify_
 #endif
                 }
             }
-            else
+
+            /* Determine if any of the suspended threads requested one of the flags set. If not,
+               none of their requests can be satisfied now and the search is skipped.  */
+            else if ((flags_to_set & group_ptr -> tx_event_flags_group_suspended_flags) != ((ULONG) 0))
             {
 
                 /* Otherwise, the event flag requests of multiple threads must be 
@@ -333,13 +353,242 @@ VOID            (*events_set_notify)(struct TX_EVENT_FLAGS_GROUP_STRUCT *notify_
                 /* Pickup the current event flags.  */
                 current_event_flags =  group_ptr -> tx_event_flags_group_current;
 
+                /* Collect the flags requested by the threads that remain suspended.  */
+                suspended_flags =  ((ULONG) 0);
+
                 /* Disable preemption while we process the suspended list.  */
                 _tx_thread_preempt_disable++;
 
-                /* Loop to examine all of the suspended threads. */
+#ifdef TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+
+                /* Only examine the threads in the buckets of the flags set, which are all
+                   satisfied since each waits for a single flag that is set now, and the
+                   threads waiting for several flags. The threads waiting for other flags
+                   are not visited. If the search must be reset, because an ISR set flags
+                   or lifted a suspension while interrupts were enabled, the whole suspension
+                   list is searched below instead.  */
+                bucket_flags =    flags_to_set;
+                several_count =   group_ptr -> tx_event_flags_group_several_count;
+                several_thread =  group_ptr -> tx_event_flags_group_bucket[TX_EVENT_FLAGS_BUCKET_SEVERAL];
+
+                /* The buckets of the flags set are emptied, so only the threads waiting for
+                   several flags can still request these flags.  */
+                suspended_flags =  group_ptr -> tx_event_flags_group_suspended_flags & ~flags_to_set;
+
+                /* Loop to examine the threads in the buckets.  */
+                bucket_search =  TX_TRUE;
                 do
                 {
 
+#ifndef TX_NOT_INTERRUPTABLE
+
+                    /* Restore interrupts temporarily.  */
+                    TX_RESTORE
+
+                    /* Disable interrupts again.  */
+                    TX_DISABLE
+#endif
+
+                    /* Pickup the first thread in the bucket of the lowest flag set whose bucket
+                       is not empty.  */
+                    thread_ptr =  TX_NULL;
+                    while ((thread_ptr == TX_NULL) && (bucket_flags != ((ULONG) 0)))
+                    {
+
+                        /* Pickup the bucket of the lowest flag set.  */
+                        lowest_flag =  bucket_flags;
+                        TX_LOWEST_SET_BIT_CALCULATE(lowest_flag, bucket)
+                        thread_ptr =  group_ptr -> tx_event_flags_group_bucket[bucket];
+
+                        /* Determine if the bucket is empty.  */
+                        if (thread_ptr == TX_NULL)
+                        {
+
+                            /* Yes, move on to the next flag set.  */
+                            bucket_flags =  bucket_flags & (bucket_flags - ((ULONG) 1));
+                        }
+                    }
+
+                    /* Otherwise, pickup the next thread waiting for several flags.  */
+                    if ((thread_ptr == TX_NULL) && (several_count != ((UINT) 0)))
+                    {
+
+                        /* Save the thread after it in the bucket.  */
+                        thread_ptr =      several_thread;
+                        several_thread =  thread_ptr -> tx_thread_event_flags_bucket_next;
+                        several_count--;
+                    }
+
+                    /* Determine if the search must be reset or all the threads in the buckets
+                       are examined.  */
+                    if ((group_ptr -> tx_event_flags_group_reset_search != TX_FALSE) || (thread_ptr == TX_NULL))
+                    {
+
+                        /* Yes, the search of the buckets is complete.  */
+                        bucket_search =  TX_FALSE;
+                    }
+                    else
+                    {
+
+                        /* Pickup the suspend information.  */
+                        requested_flags =  thread_ptr -> tx_thread_suspend_info;
+
+                        /* Pickup this thread's suspension get option.  */
+                        get_option =  thread_ptr -> tx_thread_suspend_option;
+
+                        /* Isolate the AND selection.  */
+                        and_request =  (get_option & TX_AND);
+
+                        /* Check for AND condition. All flags must be present to satisfy request.  */
+                        if (and_request == TX_AND)
+                        {
+
+                            /* AND request is present.  */
+
+                            /* Calculate the flags present.  */
+                            flags_satisfied =  (current_event_flags & requested_flags);
+
+                            /* Determine if they satisfy the AND request.  */
+                            if (flags_satisfied != requested_flags)
+                            {
+
+                                /* No, not all the requested flags are present. Clear the flags present variable.  */
+                                flags_satisfied =  ((ULONG) 0);
+                            }
+                        }
+                        else
+                        {
+
+                            /* OR request is present. Simply or the requested flags and the current flags.  */
+                            flags_satisfied =  (current_event_flags & requested_flags);
+                        }
+
+                        /* Check to see if the thread had a timeout or wait abort, in which case it is
+                           removed from the suspension list as well.  */
+                        if (thread_ptr -> tx_thread_state != TX_EVENT_FLAG)
+                        {
+
+                            /* Simply set the satisfied flags to 1 in order to remove the thread from the suspension list.  */
+                            flags_satisfied =  ((ULONG) 1);
+                        }
+
+                        /* Determine if the request is satisfied.  */
+                        if (flags_satisfied != ((ULONG) 0))
+                        {
+
+                            /* Yes, this request can be handled now.  */
+
+                            /* Set the preempt check flag.  */
+                            preempt_check =  TX_TRUE;
+
+                            /* Determine if the thread is still suspended on the event flag group.  */
+                            if (thread_ptr -> tx_thread_state == TX_EVENT_FLAG)
+                            {
+
+                                /* Return the actual event flags that satisfied the request.  */
+                                suspend_info_ptr =   TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_additional_suspend_info);
+                                *suspend_info_ptr =  current_event_flags;
+
+                                /* Pickup the clear bit.  */
+                                clear_request =  (get_option & TX_EVENT_FLAGS_CLEAR_MASK);
+
+                                /* Determine whether or not clearing needs to take place.  */
+                                if (clear_request == TX_TRUE)
+                                {
+
+                                    /* Yes, clear the flags that satisfied this request.  */
+                                    group_ptr -> tx_event_flags_group_current =  group_ptr -> tx_event_flags_group_current & ~requested_flags;
+                                }
+
+                                /* Clear cleanup routine to avoid timeout.  */
+                                thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
+
+                                /* Put return status into the thread control block.  */
+                                thread_ptr -> tx_thread_suspend_status =  TX_SUCCESS;
+                            }
+
+                            /* Remove the thread from its bucket.  */
+                            _tx_event_flags_bucket_remove(group_ptr, thread_ptr);
+
+                            /* See if this is the only suspended thread on the list.  */
+                            if (thread_ptr == thread_ptr -> tx_thread_suspended_next)
+                            {
+
+                                /* Yes, the only suspended thread.  */
+
+                                /* Update the head pointer.  */
+                                suspended_list =  TX_NULL;
+                            }
+                            else
+                            {
+
+                                /* At least one more thread is on the same suspension list.  */
+
+                                /* Update the links of the adjacent threads.  */
+                                next_thread =                                  thread_ptr -> tx_thread_suspended_next;
+                                previous_thread =                              thread_ptr -> tx_thread_suspended_previous;
+                                next_thread -> tx_thread_suspended_previous =  previous_thread;
+                                previous_thread -> tx_thread_suspended_next =  next_thread;
+
+                                /* Update the list head pointer, if removing the head of the
+                                   list.  */
+                                if (suspended_list == thread_ptr)
+                                {
+
+                                    /* Yes, head pointer needs to be updated.  */
+                                    suspended_list =  thread_ptr -> tx_thread_suspended_next;
+                                }
+                            }
+
+                            /* Decrement the suspension count.  */
+                            group_ptr -> tx_event_flags_group_suspended_count--;
+
+                            /* Place this thread on the satisfied list.  */
+                            if (satisfied_list == TX_NULL)
+                            {
+
+                                /* First thread on the satisfied list.  */
+                                satisfied_list =  thread_ptr;
+                            }
+                            else
+                            {
+
+                                /* Not the first thread on the satisfied list, link it up at the end.  */
+                                last_satisfied -> tx_thread_suspended_next =  thread_ptr;
+                            }
+                            thread_ptr -> tx_thread_suspended_next =  TX_NULL;
+                            last_satisfied =                          thread_ptr;
+                        }
+                        else
+                        {
+
+                            /* The thread remains suspended, remember its requested flags.  */
+                            suspended_flags =  suspended_flags | requested_flags;
+                        }
+                    }
+                } while (bucket_search == TX_TRUE);
+
+                /* Determine if the search must be reset.  */
+                if (group_ptr -> tx_event_flags_group_reset_search != TX_FALSE)
+                {
+
+                    /* Yes, search the whole suspension list, which the search below starts
+                       over with.  */
+                    thread_ptr =       suspended_list;
+                    suspended_count =  group_ptr -> tx_event_flags_group_suspended_count;
+                }
+                else
+                {
+
+                    /* No, all the threads that can be satisfied are examined.  */
+                    suspended_count =  TX_NO_SUSPENSIONS;
+                }
+#endif
+
+                /* Loop to examine all of the suspended threads. */
+                while (suspended_count != TX_NO_SUSPENSIONS)
+                {
+
 #ifndef TX_NOT_INTERRUPTABLE
 
                     /* Restore interrupts temporarily.  */
@@ -365,6 +614,9 @@ VOID            (*events_set_notify)(struct TX_EVENT_FLAGS_GROUP_STRUCT *notify_
                         /* Update the current events with any new ones that might
                            have been set in a nested set events call from an ISR.  */
                         current_event_flags =  current_event_flags | group_ptr -> tx_event_flags_group_current;
+
+                        /* Collect the requested flags again.  */
+                        suspended_flags =  ((ULONG) 0);
                     }
 
                     /* Save next thread pointer.  */
@@ -454,6 +706,12 @@ VOID            (*events_set_notify)(struct TX_EVENT_FLAGS_GROUP_STRUCT *notify_
                         /* We need to remove the thread from the suspension list and place it in the
                            expired list.  */
 
+#ifdef TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+
+                        /* Remove the thread from its bucket as well.  */
+                        _tx_event_flags_bucket_remove(group_ptr, thread_ptr);
+#endif
+
                         /* See if this is the only suspended thread on the list.  */
                         if (thread_ptr == thread_ptr -> tx_thread_suspended_next)
                         {
@@ -509,18 +767,26 @@ VOID            (*events_set_notify)(struct TX_EVENT_FLAGS_GROUP_STRUCT *notify_
                             last_satisfied =                              thread_ptr;
                         }
                     }
+                    else
+                    {
+
+                        /* The thread remains suspended, remember its requested flags.  */
+                        suspended_flags =  suspended_flags | requested_flags;
+                    }
 
                     /* Copy next thread pointer to working thread ptr.  */
                     thread_ptr =  next_thread_ptr;
 
                     /* Decrement the suspension count.  */
                     suspended_count--;
-            
-                } while (suspended_count != TX_NO_SUSPENSIONS);
+                }
 
                 /* Setup the group's suspension list head again.  */
                 group_ptr -> tx_event_flags_group_suspension_list =  suspended_list;
 
+                /* Setup the flags requested by the threads that remain suspended.  */
+                group_ptr -> tx_event_flags_group_suspended_flags =  suspended_flags;
+
 #ifndef TX_NOT_INTERRUPTABLE
 
                 /* Determine if there is any delayed event clearing to perform.  */
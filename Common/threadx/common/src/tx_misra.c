@@ -366,6 +366,7 @@ TX_THREAD                 *trace_thread_ptr;
             trace_event_ptr =  _tx_trace_buffer_start_ptr;
             _tx_trace_buffer_current_ptr =  trace_event_ptr;
             _tx_trace_header_ptr -> tx_trace_header_buffer_current_pointer =  (ULONG) trace_event_ptr;
+            TX_TRACE_STREAM_BUFFER_WRAP
             if (_tx_trace_full_notify_function)
                 (_tx_trace_full_notify_function)((VOID *) _tx_trace_header_ptr);
         }
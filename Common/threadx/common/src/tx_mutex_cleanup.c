@@ -126,6 +126,13 @@ TX_THREAD           *previous_thread;
                         /* Clear the suspension cleanup flag.  */
                         thread_ptr -> tx_thread_suspend_cleanup =  TX_NULL;
 
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+                        /* The wait for the mutex is over, add its time to the contention profile.  */
+                        _tx_mutex_contention_times_update(&(mutex_ptr -> tx_mutex_contention.tx_mutex_contention_wait), thread_ptr,
+                                                          TX_MUTEX_CONTENTION_ELAPSED(TX_MUTEX_CONTENTION_TIME_SOURCE, thread_ptr -> tx_thread_mutex_wait_start));
+#endif
+
                         /* Decrement the suspension count.  */
                         mutex_ptr -> tx_mutex_suspended_count--;
 
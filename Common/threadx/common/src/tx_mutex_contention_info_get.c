@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_mutex.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_mutex_contention_info_get                       PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves a snapshot of the contention profile of the */
+/*    specified mutex: the histograms of the times the mutex was held and */
+/*    the times threads waited for it, the longest hold and wait along    */
+/*    with their threads, and the priority inheritance events.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    mutex_ptr                         Pointer to mutex control block    */
+/*    contention_ptr                    Destination for the contention    */
+/*                                        profile                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_mutex_contention_info_get(TX_MUTEX *mutex_ptr, TX_MUTEX_CONTENTION *contention_ptr)
+{
+
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        status;
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Determine if this is a legal request.  */
+    if (mutex_ptr == TX_NULL)
+    {
+
+        /* Mutex pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Determine if the mutex ID is invalid.  */
+    else if (mutex_ptr -> tx_mutex_id != TX_MUTEX_ID)
+    {
+
+        /* Mutex pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Determine if the destination is invalid.  */
+    else if (contention_ptr == TX_NULL)
+    {
+
+        /* Destination pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Copy the contention profile, so it is consistent.  */
+        *contention_ptr =  mutex_ptr -> tx_mutex_contention;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return completion status.  */
+    return(status);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (mutex_ptr != TX_NULL)
+    {
+
+        /* Contention profile not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (contention_ptr != TX_NULL)
+    {
+
+        /* Contention profile not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Contention profile not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_mutex.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_mutex_contention_reset                          PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function clears the contention profile of the specified        */
+/*    mutex, so the next snapshot covers the time from now on. A hold     */
+/*    or wait in progress is counted when it ends.                        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    mutex_ptr                         Pointer to mutex control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_mutex_contention_reset(TX_MUTEX *mutex_ptr)
+{
+
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        status;
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Determine if this is a legal request.  */
+    if (mutex_ptr == TX_NULL)
+    {
+
+        /* Mutex pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Determine if the mutex ID is invalid.  */
+    else if (mutex_ptr -> tx_mutex_id != TX_MUTEX_ID)
+    {
+
+        /* Mutex pointer is illegal, return error.  */
+        status =  TX_PTR_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Clear the contention profile.  */
+        TX_MEMSET(&(mutex_ptr -> tx_mutex_contention), 0, (sizeof(TX_MUTEX_CONTENTION)));
+
+        /* No owner has inherited a priority yet.  */
+        mutex_ptr -> tx_mutex_contention.tx_mutex_contention_inheritance_priority =  ((UINT) TX_MAX_PRIORITIES);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return completion status.  */
+    return(status);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (mutex_ptr != TX_NULL)
+    {
+
+        /* Contention profile not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Contention profile not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
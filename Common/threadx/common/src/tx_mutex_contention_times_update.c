@@ -0,0 +1,110 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_mutex.h"
+
+
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_mutex_contention_times_update                   PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function adds a hold or wait time to a mutex contention        */
+/*    profile. The time is counted in the histogram bucket of its power   */
+/*    of two, and becomes the longest time, along with its thread, if     */
+/*    it is longer than all the previous ones. This function is called    */
+/*    with interrupts disabled.                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    times_ptr                         Pointer to hold or wait times     */
+/*    thread_ptr                        Thread that held or waited        */
+/*    duration                          Time held or waited, in time      */
+/*                                        source units                    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_mutex_cleanup                 Mutex wait cleanup                */
+/*    _tx_mutex_put                     Release a mutex                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_mutex_contention_times_update(TX_MUTEX_CONTENTION_TIMES *times_ptr, TX_THREAD *thread_ptr, ULONG duration)
+{
+
+ULONG       remaining;
+UINT        bucket;
+
+
+    /* Find the bucket of the duration, which is its number of significant bits above the shift.  */
+    remaining =  duration >> TX_MUTEX_CONTENTION_SHIFT;
+    bucket =     ((UINT) 0);
+    while ((remaining != ((ULONG) 0)) && (bucket < ((UINT) (TX_MUTEX_CONTENTION_BUCKETS - 1))))
+    {
+
+        /* Move to the next bucket.  */
+        remaining =  remaining >> 1;
+        bucket++;
+    }
+
+    /* Count the duration in its bucket.  */
+    times_ptr -> tx_mutex_contention_times_histogram[bucket]++;
+
+    /* Determine if this is the longest duration so far.  */
+    if (duration > times_ptr -> tx_mutex_contention_times_longest)
+    {
+
+        /* Yes, remember it along with its thread.  */
+        times_ptr -> tx_mutex_contention_times_longest =         duration;
+        times_ptr -> tx_mutex_contention_times_longest_thread =  thread_ptr;
+    }
+}
+#endif
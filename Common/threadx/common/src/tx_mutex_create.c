@@ -88,6 +88,12 @@ TX_MUTEX        *previous_mutex;
     /* Setup the basic mutex fields.  */
     mutex_ptr -> tx_mutex_name =             name_ptr;
     mutex_ptr -> tx_mutex_inherit =          inherit;
+
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+    /* No owner has inherited a priority yet.  */
+    mutex_ptr -> tx_mutex_contention.tx_mutex_contention_inheritance_priority =  ((UINT) TX_MAX_PRIORITIES);
+#endif
     
     /* Disable interrupts to place the mutex on the created list.  */
     TX_DISABLE
@@ -116,6 +116,12 @@ UINT            status;
         /* Set the ownership count to 1.  */
         mutex_ptr -> tx_mutex_ownership_count =  ((UINT) 1);
 
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+        /* The hold of the mutex starts now.  */
+        mutex_ptr -> tx_mutex_contention_hold_start =  (ULONG) TX_MUTEX_CONTENTION_TIME_SOURCE;
+#endif
+
         /* Remember that the calling thread owns the mutex.  */
         mutex_ptr -> tx_mutex_owner =  thread_ptr;
 
@@ -244,6 +250,12 @@ UINT            status;
                 }
 #endif
 
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+                /* The wait for the mutex starts now.  */
+                thread_ptr -> tx_thread_mutex_wait_start =  (ULONG) TX_MUTEX_CONTENTION_TIME_SOURCE;
+#endif
+
                 /* Setup cleanup routine pointer.  */
                 thread_ptr -> tx_thread_suspend_cleanup =  &(_tx_mutex_cleanup);
 
@@ -325,6 +337,21 @@ UINT            status;
                         /* Increment the number of priority inheritance situations on this mutex.  */
                         mutex_ptr -> tx_mutex_performance__priority_inheritance_count++;
 #endif
+
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+                        /* Increment the number of priority inheritance events on this mutex.  */
+                        mutex_ptr -> tx_mutex_contention.tx_mutex_contention_inheritance_count++;
+
+                        /* Determine if this is the highest priority an owner of this mutex was raised to.  */
+                        if (thread_ptr -> tx_thread_priority < mutex_ptr -> tx_mutex_contention.tx_mutex_contention_inheritance_priority)
+                        {
+
+                            /* Yes, remember it along with the owner.  */
+                            mutex_ptr -> tx_mutex_contention.tx_mutex_contention_inheritance_priority =  thread_ptr -> tx_thread_priority;
+                            mutex_ptr -> tx_mutex_contention.tx_mutex_contention_inheritance_thread =    mutex_owner;
+                        }
+#endif
                     }
                 }
 
@@ -384,6 +411,21 @@ UINT            status;
                         /* Increment the number of priority inheritance situations on this mutex.  */
                         mutex_ptr -> tx_mutex_performance__priority_inheritance_count++;
 #endif
+
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+                        /* Increment the number of priority inheritance events on this mutex.  */
+                        mutex_ptr -> tx_mutex_contention.tx_mutex_contention_inheritance_count++;
+
+                        /* Determine if this is the highest priority an owner of this mutex was raised to.  */
+                        if (thread_ptr -> tx_thread_priority < mutex_ptr -> tx_mutex_contention.tx_mutex_contention_inheritance_priority)
+                        {
+
+                            /* Yes, remember it along with the owner.  */
+                            mutex_ptr -> tx_mutex_contention.tx_mutex_contention_inheritance_priority =  thread_ptr -> tx_thread_priority;
+                            mutex_ptr -> tx_mutex_contention.tx_mutex_contention_inheritance_thread =    mutex_owner;
+                        }
+#endif
                     }
                 }
 
@@ -95,6 +95,9 @@ TX_THREAD       *next_thread;
 TX_THREAD       *previous_thread;
 TX_THREAD       *suspended_thread;
 UINT            inheritance_priority;
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+ULONG           time_stamp;
+#endif
 
 
     /* Setup status to indicate the processing is not complete.  */
@@ -168,6 +171,14 @@ UINT            inheritance_priority;
             else
             {
 
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+                /* The hold of the mutex is over, add its time to the contention profile.  */
+                time_stamp =  (ULONG) TX_MUTEX_CONTENTION_TIME_SOURCE;
+                _tx_mutex_contention_times_update(&(mutex_ptr -> tx_mutex_contention.tx_mutex_contention_hold), thread_ptr,
+                                                  TX_MUTEX_CONTENTION_ELAPSED(time_stamp, mutex_ptr -> tx_mutex_contention_hold_start));
+#endif
+
                 /* Check for a NULL thread pointer, which can only happen during initialization.   */
                 if (thread_ptr == TX_NULL)
                 {
@@ -469,6 +480,16 @@ UINT            inheritance_priority;
                             mutex_ptr -> tx_mutex_ownership_count =  (UINT) 1;
                             mutex_ptr -> tx_mutex_owner =            thread_ptr;
 
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+                            /* The wait of the new owner is over, add its time to the contention profile,
+                               and start its hold.  */
+                            time_stamp =  (ULONG) TX_MUTEX_CONTENTION_TIME_SOURCE;
+                            _tx_mutex_contention_times_update(&(mutex_ptr -> tx_mutex_contention.tx_mutex_contention_wait), thread_ptr,
+                                                              TX_MUTEX_CONTENTION_ELAPSED(time_stamp, thread_ptr -> tx_thread_mutex_wait_start));
+                            mutex_ptr -> tx_mutex_contention_hold_start =  time_stamp;
+#endif
+
                             /* Remove the suspended thread from the list.  */
 
                             /* Decrement the suspension count.  */
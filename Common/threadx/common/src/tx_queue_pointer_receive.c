@@ -0,0 +1,252 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_pointer_receive                           PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function receives a batch of pointers from a queue created     */
+/*    with TX_POINTER_ULONG messages, taking over the ownership of the    */
+/*    buffers they point to. Only the pointers are copied.                */
+/*                                                                        */
+/*    When no thread is suspended on the queue, the pointers in the queue */
+/*    are taken at once, with interrupts disabled only once for all of    */
+/*    them. Otherwise, the next pointer is received like any message,     */
+/*    so a suspended sender is resumed, or the caller suspends until a    */
+/*    pointer is sent. Only the first pointer of a batch may suspend, so  */
+/*    the receive is successful once at least one pointer is received.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    pointers                          Destination for the pointers      */
+/*    count                             Maximum number of pointers to     */
+/*                                        receive                         */
+/*    actual_count                      Destination for the number of     */
+/*                                        pointers received               */
+/*    wait_option                       Suspension option for the first   */
+/*                                        pointer                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_receive                 Receive a pointer, resuming a     */
+/*                                        sender or suspending            */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_pointer_receive(TX_QUEUE *queue_ptr, VOID **pointers, UINT count, UINT *actual_count, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG           *source;
+ULONG           *destination;
+ULONG           words;
+ULONG           span;
+UINT            batch;
+UINT            received;
+UINT            done;
+UINT            status;
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* No pointers are received yet.  */
+    received =  ((UINT) 0);
+    done =      TX_FALSE;
+
+    /* Loop until all the pointers are received, or no more can be received.  */
+    while (done == TX_FALSE)
+    {
+
+        /* Disable interrupts to receive pointers from the queue.  */
+        TX_DISABLE
+
+        /* Determine if there are pointers in the queue and no thread is suspended on it.  */
+        if ((queue_ptr -> tx_queue_suspended_count == TX_NO_SUSPENSIONS) &&
+            (queue_ptr -> tx_queue_enqueued != TX_NO_MESSAGES))
+        {
+
+            /* Yes, take as many pointers as there are in the queue at once.  */
+            batch =  count - received;
+            if (((ULONG) batch) > queue_ptr -> tx_queue_enqueued)
+            {
+                batch =  (UINT) queue_ptr -> tx_queue_enqueued;
+            }
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+            /* Increase the total messages received counter.  */
+            _tx_queue_performance__messages_received_count =  _tx_queue_performance__messages_received_count + ((ULONG) batch);
+
+            /* Increase the number of messages received from this queue.  */
+            queue_ptr -> tx_queue_performance_messages_received_count =  queue_ptr -> tx_queue_performance_messages_received_count + ((ULONG) batch);
+#endif
+
+            /* If trace is enabled, insert this event into the trace buffer.  */
+            TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_POINTER_RECEIVE, queue_ptr, batch, wait_option, queue_ptr -> tx_queue_enqueued, TX_TRACE_QUEUE_EVENTS)
+
+            /* Setup source and destination pointers.  */
+            source =       queue_ptr -> tx_queue_read;
+            destination =  TX_VOID_TO_ULONG_POINTER_CONVERT(&(pointers[received]));
+            words =        ((ULONG) batch) * ((ULONG) queue_ptr -> tx_queue_message_size);
+
+            /* Copy the pointer words, up to the end of the queue and then from its start.  */
+            while (words != ((ULONG) 0))
+            {
+
+                /* Pickup the number of words up to the end of the queue.  */
+                span =  (ULONG) TX_ULONG_POINTER_DIF(queue_ptr -> tx_queue_end, source);
+                if (span > words)
+                {
+                    span =  words;
+                }
+                words =  words - span;
+
+                /* Copy these words.  */
+                while (span != ((ULONG) 0))
+                {
+                    *destination =  *source;
+                    destination =   TX_ULONG_POINTER_ADD(destination, 1);
+                    source =        TX_ULONG_POINTER_ADD(source, 1);
+                    span--;
+                }
+
+                /* Determine if we are at the end.  */
+                if (source == queue_ptr -> tx_queue_end)
+                {
+
+                    /* Yes, wrap around to the beginning.  */
+                    source =  queue_ptr -> tx_queue_start;
+                }
+            }
+
+            /* Setup the queue read pointer.  */
+            queue_ptr -> tx_queue_read =  source;
+
+            /* Increase the amount of available storage.  */
+            queue_ptr -> tx_queue_available_storage =  queue_ptr -> tx_queue_available_storage + ((ULONG) batch);
+
+            /* Decrease the enqueued count.  */
+            queue_ptr -> tx_queue_enqueued =  queue_ptr -> tx_queue_enqueued - ((ULONG) batch);
+
+            /* Update the number of pointers received.  */
+            received =  received + batch;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+        }
+
+        /* Determine if the queue is empty after some pointers were received.  */
+        else if ((received != ((UINT) 0)) && (queue_ptr -> tx_queue_enqueued == TX_NO_MESSAGES))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Yes, there are no more pointers to receive.  */
+            done =  TX_TRUE;
+        }
+        else
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* A thread is waiting to send a message, or the queue is empty. Receive the next pointer like
+               any message, which resumes the waiting sender or waits for a pointer.  */
+            status =  _tx_queue_receive(queue_ptr, (VOID *) &(pointers[received]), wait_option);
+
+            /* Determine if a pointer was received.  */
+            if (status == TX_SUCCESS)
+            {
+
+                /* Yes, update the number of pointers received.  */
+                received++;
+            }
+            else
+            {
+
+                /* No, no more pointers can be received.  */
+                done =  TX_TRUE;
+            }
+        }
+
+        /* Only the first pointer may wait, the others are only received if they are in the queue.  */
+        wait_option =  TX_NO_WAIT;
+
+        /* Determine if all the pointers are received.  */
+        if (received == count)
+        {
+
+            /* Yes, the receive is complete.  */
+            done =  TX_TRUE;
+        }
+    }
+
+    /* Determine if some pointers were received.  */
+    if (received != ((UINT) 0))
+    {
+
+        /* Yes, the receive is successful.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return the number of pointers received.  */
+    *actual_count =  received;
+
+    /* Return completion status.  */
+    return(status);
+}
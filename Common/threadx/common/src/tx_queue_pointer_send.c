@@ -0,0 +1,274 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+#include "tx_thread.h"
+#include "tx_queue.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_queue_pointer_send                              PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function sends a batch of pointers to a queue created with     */
+/*    TX_POINTER_ULONG messages, handing the ownership of the buffers     */
+/*    they point to over to the receivers. Only the pointers are copied.  */
+/*                                                                        */
+/*    When no thread is suspended on the queue, the pointers that fit in  */
+/*    the queue are placed in it at once, with interrupts disabled only   */
+/*    once for all of them. Otherwise, the next pointer is sent like any  */
+/*    message, so it is handed to a suspended receiver, or the caller     */
+/*    suspends until there is room for it. Only the first pointer of a    */
+/*    batch may suspend, so the send is successful once at least one      */
+/*    pointer is sent, and the caller keeps the ownership of the others.  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    queue_ptr                         Pointer to queue control block    */
+/*    pointers                          Pointers to send                  */
+/*    count                             Number of pointers to send        */
+/*    actual_count                      Destination for the number of     */
+/*                                        pointers sent                   */
+/*    wait_option                       Suspension option for the first   */
+/*                                        pointer                         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    status                            Completion status                 */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_queue_send                    Send a pointer, resuming a        */
+/*                                        receiver or suspending          */
+/*    (queue_send_notify)               Application queue send notify     */
+/*                                        callback function               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_queue_pointer_send(TX_QUEUE *queue_ptr, VOID **pointers, UINT count, UINT *actual_count, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG           *source;
+ULONG           *destination;
+ULONG           words;
+ULONG           span;
+UINT            batch;
+UINT            sent;
+UINT            done;
+UINT            status;
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+VOID            (*queue_send_notify)(struct TX_QUEUE_STRUCT *notify_queue_ptr);
+#endif
+
+
+    /* Default the status to TX_SUCCESS.  */
+    status =  TX_SUCCESS;
+
+    /* No pointers are sent yet.  */
+    sent =  ((UINT) 0);
+    done =  TX_FALSE;
+
+    /* Loop until all the pointers are sent, or no more can be sent.  */
+    while (done == TX_FALSE)
+    {
+
+        /* Disable interrupts to place pointers in the queue.  */
+        TX_DISABLE
+
+        /* Determine if there is room in the queue and no thread is suspended on it.  */
+        if ((queue_ptr -> tx_queue_suspended_count == TX_NO_SUSPENSIONS) &&
+            (queue_ptr -> tx_queue_available_storage != TX_NO_MESSAGES))
+        {
+
+            /* Yes, place as many pointers as there is room for in the queue at once.  */
+            batch =  count - sent;
+            if (((ULONG) batch) > queue_ptr -> tx_queue_available_storage)
+            {
+                batch =  (UINT) queue_ptr -> tx_queue_available_storage;
+            }
+
+#ifdef TX_QUEUE_ENABLE_PERFORMANCE_INFO
+
+            /* Increase the total messages sent counter.  */
+            _tx_queue_performance_messages_sent_count =  _tx_queue_performance_messages_sent_count + ((ULONG) batch);
+
+            /* Increase the number of messages sent to this queue.  */
+            queue_ptr -> tx_queue_performance_messages_sent_count =  queue_ptr -> tx_queue_performance_messages_sent_count + ((ULONG) batch);
+#endif
+
+            /* If trace is enabled, insert this event into the trace buffer.  */
+            TX_TRACE_IN_LINE_INSERT(TX_TRACE_QUEUE_POINTER_SEND, queue_ptr, batch, wait_option, queue_ptr -> tx_queue_enqueued, TX_TRACE_QUEUE_EVENTS)
+
+            /* Reduce the amount of available storage.  */
+            queue_ptr -> tx_queue_available_storage =  queue_ptr -> tx_queue_available_storage - ((ULONG) batch);
+
+            /* Increase the enqueued count.  */
+            queue_ptr -> tx_queue_enqueued =  queue_ptr -> tx_queue_enqueued + ((ULONG) batch);
+
+            /* Setup source and destination pointers.  */
+            source =       TX_VOID_TO_ULONG_POINTER_CONVERT(&(pointers[sent]));
+            destination =  queue_ptr -> tx_queue_write;
+            words =        ((ULONG) batch) * ((ULONG) queue_ptr -> tx_queue_message_size);
+
+            /* Copy the pointer words, up to the end of the queue and then from its start.  */
+            while (words != ((ULONG) 0))
+            {
+
+                /* Pickup the number of words up to the end of the queue.  */
+                span =  (ULONG) TX_ULONG_POINTER_DIF(queue_ptr -> tx_queue_end, destination);
+                if (span > words)
+                {
+                    span =  words;
+                }
+                words =  words - span;
+
+                /* Copy these words.  */
+                while (span != ((ULONG) 0))
+                {
+                    *destination =  *source;
+                    destination =   TX_ULONG_POINTER_ADD(destination, 1);
+                    source =        TX_ULONG_POINTER_ADD(source, 1);
+                    span--;
+                }
+
+                /* Determine if we are at the end.  */
+                if (destination == queue_ptr -> tx_queue_end)
+                {
+
+                    /* Yes, wrap around to the beginning.  */
+                    destination =  queue_ptr -> tx_queue_start;
+                }
+            }
+
+            /* Adjust the write pointer.  */
+            queue_ptr -> tx_queue_write =  destination;
+
+            /* Update the number of pointers sent.  */
+            sent =  sent + batch;
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Pickup the notify callback routine for this queue.  */
+            queue_send_notify =  queue_ptr -> tx_queue_send_notify;
+#endif
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+#ifndef TX_DISABLE_NOTIFY_CALLBACKS
+
+            /* Determine if a notify callback is required.  */
+            if (queue_send_notify != TX_NULL)
+            {
+
+                /* Call application queue send notification, once for the pointers placed.  */
+                (queue_send_notify)(queue_ptr);
+            }
+#endif
+        }
+
+        /* Determine if the queue is full after some pointers were sent.  */
+        else if ((sent != ((UINT) 0)) && (queue_ptr -> tx_queue_available_storage == TX_NO_MESSAGES))
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Yes, the rest of the pointers are not sent.  */
+            done =  TX_TRUE;
+        }
+        else
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* A thread is waiting for a message, or the queue is full. Send the next pointer like any
+               message, which hands it to the waiting thread or waits for room in the queue.  */
+            status =  _tx_queue_send(queue_ptr, (VOID *) &(pointers[sent]), wait_option);
+
+            /* Determine if the pointer was sent.  */
+            if (status == TX_SUCCESS)
+            {
+
+                /* Yes, update the number of pointers sent.  */
+                sent++;
+            }
+            else
+            {
+
+                /* No, no more pointers can be sent.  */
+                done =  TX_TRUE;
+            }
+        }
+
+        /* Only the first pointer may wait, the others are only sent if there is room for them.  */
+        wait_option =  TX_NO_WAIT;
+
+        /* Determine if all the pointers are sent.  */
+        if (sent == count)
+        {
+
+            /* Yes, the send is complete.  */
+            done =  TX_TRUE;
+        }
+    }
+
+    /* Determine if some pointers were sent.  */
+    if (sent != ((UINT) 0))
+    {
+
+        /* Yes, the send is successful.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Return the number of pointers sent.  */
+    *actual_count =  sent;
+
+    /* Return completion status.  */
+    return(status);
+}
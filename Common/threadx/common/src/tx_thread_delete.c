@@ -155,6 +155,17 @@ UINT            status;
             }
         }
 
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+        /* Determine if the stack monitor is scanning this thread.  */
+        if (_tx_thread_stack_monitor_thread == thread_ptr)
+        {
+
+            /* Yes, restart the scan with the first created thread.  */
+            _tx_thread_stack_monitor_thread =  TX_NULL;
+        }
+#endif
+
         /* Execute Port-Specific completion processing. If needed, it is typically defined in tx_port.h.  */
         TX_THREAD_DELETE_PORT_COMPLETION(thread_ptr)
 
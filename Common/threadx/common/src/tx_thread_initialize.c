@@ -185,6 +185,41 @@ VOID            (*_tx_thread_application_stack_error_handler)(TX_THREAD *thread_
 
 #endif
 
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+/* Define the timer that runs the stack monitor, one slice per expiration.  */
+
+TX_TIMER        _tx_thread_stack_monitor_timer;
+
+
+/* Define the thread being scanned by the stack monitor and the next stack word to scan.  */
+
+TX_THREAD       *_tx_thread_stack_monitor_thread;
+ULONG           *_tx_thread_stack_monitor_scan_ptr;
+
+
+/* Define the number of stack words scanned per slice, zero when the stack monitor is stopped.  */
+
+ULONG           _tx_thread_stack_monitor_slice_words;
+
+
+/* Define the headroom, in percent of the stack size, below which the application is notified.  */
+
+ULONG           _tx_thread_stack_monitor_headroom_percent;
+
+
+/* Define the application function notified when the headroom of a thread drops below the
+   threshold.  */
+
+VOID            (*_tx_thread_stack_monitor_notify)(TX_THREAD *thread_ptr, ULONG stack_used);
+
+
+/* Define the number of complete scans of all created threads.  */
+
+ULONG           _tx_thread_stack_monitor_rounds;
+
+#endif
+
 #ifdef TX_THREAD_ENABLE_PERFORMANCE_INFO
 
 /* Define the total number of thread resumptions. Each time a thread enters the
@@ -362,6 +397,12 @@ VOID  _tx_thread_initialize(VOID)
     _tx_thread_application_stack_error_handler =  TX_NULL;
 #endif
 
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+    /* The stack monitor is stopped.  */
+    _tx_thread_stack_monitor_slice_words =  ((ULONG) 0);
+#endif
+
 #ifdef TX_THREAD_ENABLE_PERFORMANCE_INFO
 
     /* Clear performance counters.  */
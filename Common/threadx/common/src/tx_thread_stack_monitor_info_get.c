@@ -0,0 +1,191 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_stack_monitor_info_get                   PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the stack high-water mark of a thread found */
+/*    by the stack monitor, as the number of stack bytes used and the     */
+/*    headroom left, along with the number of complete scans of all       */
+/*    created threads. The mark is at most one scan old.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*    stack_used                        Destination for the stack bytes   */
+/*                                        used at the high-water mark     */
+/*    stack_headroom                    Destination for the stack bytes   */
+/*                                        never used                      */
+/*    rounds                            Destination for the number of     */
+/*                                        complete scans                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_stack_monitor_info_get(TX_THREAD *thread_ptr, ULONG *stack_used, ULONG *stack_headroom, ULONG *rounds)
+{
+
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+TX_INTERRUPT_SAVE_AREA
+
+ULONG       headroom;
+UINT        status;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Retrieve the number of complete scans.  */
+    if (rounds != TX_NULL)
+    {
+
+        *rounds =  _tx_thread_stack_monitor_rounds;
+    }
+
+    /* Check for an invalid thread pointer.  */
+    if (thread_ptr == TX_NULL)
+    {
+
+        /* Thread pointer is invalid, return an error.  */
+        status =  TX_THREAD_ERROR;
+    }
+    else if (thread_ptr -> tx_thread_id != TX_THREAD_ID)
+    {
+
+        /* Thread pointer is invalid, return an error.  */
+        status =  TX_THREAD_ERROR;
+    }
+
+    /* Determine if the stack monitor has scanned this thread yet.  */
+    else if (thread_ptr -> tx_thread_stack_monitor_ptr == TX_NULL)
+    {
+
+        /* No, there is no high-water mark yet.  */
+        status =  TX_NOT_DONE;
+    }
+    else
+    {
+
+        /* The headroom is the stack below the lowest used word.  */
+        headroom =  (ULONG) TX_UCHAR_POINTER_DIF(TX_VOID_TO_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_stack_monitor_ptr),
+                                                 TX_VOID_TO_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_stack_start));
+
+        /* Retrieve the stack bytes used.  */
+        if (stack_used != TX_NULL)
+        {
+
+            *stack_used =  thread_ptr -> tx_thread_stack_size - headroom;
+        }
+
+        /* Retrieve the headroom.  */
+        if (stack_headroom != TX_NULL)
+        {
+
+            *stack_headroom =  headroom;
+        }
+
+        /* Return success.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(status);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (thread_ptr != TX_NULL)
+    {
+
+        /* Stack monitor not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (stack_used != TX_NULL)
+    {
+
+        /* Stack monitor not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (stack_headroom != TX_NULL)
+    {
+
+        /* Stack monitor not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (rounds != TX_NULL)
+    {
+
+        /* Stack monitor not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Stack monitor not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
@@ -0,0 +1,289 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_stack_monitor_sample                     PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the expiration function of the stack monitor       */
+/*    timer. It scans up to the slice size of stack words for the fill    */
+/*    pattern. The words are scanned with interrupts enabled, in chunks   */
+/*    of one thread at a time. _tx_thread_delete restarts the scan when   */
+/*    it deletes the thread being scanned, so the thread is checked to    */
+/*    still be the one being scanned before its mark is updated.          */
+/*                                                                        */
+/*    The scan of a thread starts at the stack start and ends at the      */
+/*    first word that is no longer the fill pattern, which is the new     */
+/*    high-water mark, or at the previous high-water mark. The scan then  */
+/*    moves to the next created thread. The slice also ends once all      */
+/*    created threads have been scanned, so a thread is scanned at most   */
+/*    once per slice.                                                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    monitor_input                     Stack words scanned per slice     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    (_tx_thread_stack_monitor_notify) Notify the application of         */
+/*                                        low headroom                    */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_expiration_process      Timer expiration processing       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_thread_stack_monitor_sample(ULONG monitor_input)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD   *thread_ptr;
+TX_THREAD   *notify_thread_ptr;
+ULONG       *scan_ptr;
+ULONG       *scan_end_ptr;
+ULONG       *found_ptr;
+ULONG       budget;
+ULONG       words;
+ULONG       headroom;
+ULONG       stack_used;
+UINT        round_complete;
+VOID        (*notify)(TX_THREAD *thread_ptr, ULONG stack_used);
+
+
+    /* Pickup the number of words of this slice, which is the timer input.  */
+    budget =          monitor_input;
+    round_complete =  TX_FALSE;
+
+    /* Loop to scan the slice, one chunk of a thread at a time.  */
+    while ((budget != ((ULONG) 0)) && (round_complete == TX_FALSE))
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Pickup the thread being scanned.  */
+        thread_ptr =  _tx_thread_stack_monitor_thread;
+
+        /* Determine if the scan is just starting, or if the thread being scanned was deleted.  */
+        if (thread_ptr == TX_NULL)
+        {
+
+            /* Start with the first created thread.  */
+            thread_ptr =                         _tx_thread_created_ptr;
+            _tx_thread_stack_monitor_thread =    thread_ptr;
+            _tx_thread_stack_monitor_scan_ptr =  TX_NULL;
+        }
+
+        /* Determine if there is a thread to scan.  */
+        if (thread_ptr == TX_NULL)
+        {
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* No, the slice is done.  */
+            budget =  ((ULONG) 0);
+        }
+        else
+        {
+
+            /* Pickup where the scan of this thread is, which is the stack start for a new scan.  */
+            scan_ptr =  _tx_thread_stack_monitor_scan_ptr;
+            if (scan_ptr == TX_NULL)
+            {
+
+                scan_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_stack_start);
+            }
+
+            /* The scan ends at the previous high-water mark, or at the end of the stack.  */
+            scan_end_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_stack_monitor_ptr);
+            if (scan_end_ptr == TX_NULL)
+            {
+
+                scan_end_ptr =  TX_ULONG_POINTER_ADD(TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_stack_start),
+                                                     (thread_ptr -> tx_thread_stack_size / (sizeof(ULONG))));
+            }
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Compute the size of this chunk.  */
+            words =  (ULONG) TX_ULONG_POINTER_DIF(scan_end_ptr, scan_ptr);
+            if (words > budget)
+            {
+                words =  budget;
+            }
+
+            /* Each chunk costs at least one word of the budget, so a slice always ends.  */
+            if (words == ((ULONG) 0))
+            {
+                budget--;
+            }
+            else
+            {
+                budget =  budget - words;
+            }
+
+            /* Look for the first word that is no longer the fill pattern.  */
+            found_ptr =  TX_NULL;
+            while (words != ((ULONG) 0))
+            {
+
+                /* Determine if this word has been used.  */
+                if (*scan_ptr != TX_STACK_FILL)
+                {
+
+                    /* Yes, this is the new high-water mark.  */
+                    found_ptr =  scan_ptr;
+                    words =      ((ULONG) 0);
+                }
+                else
+                {
+
+                    /* Move to the next word.  */
+                    scan_ptr =  TX_ULONG_POINTER_ADD(scan_ptr, 1);
+                    words--;
+                }
+            }
+
+            /* Nobody to notify yet.  */
+            notify_thread_ptr =  TX_NULL;
+            stack_used =         ((ULONG) 0);
+
+            /* Disable interrupts.  */
+            TX_DISABLE
+
+            /* Determine if the thread is still the one being scanned, which also means it was not deleted.  */
+            if (_tx_thread_stack_monitor_thread == thread_ptr)
+            {
+
+                /* Determine if the scan found a new high-water mark.  */
+                if (found_ptr != TX_NULL)
+                {
+
+                    /* Yes, save it.  */
+                    thread_ptr -> tx_thread_stack_monitor_ptr =  found_ptr;
+
+                    /* Keep the highest stack usage of the thread up to date.  */
+                    if ((thread_ptr -> tx_thread_stack_highest_ptr == TX_NULL) ||
+                        (TX_VOID_TO_ULONG_POINTER_CONVERT(thread_ptr -> tx_thread_stack_highest_ptr) > found_ptr))
+                    {
+
+                        thread_ptr -> tx_thread_stack_highest_ptr =  found_ptr;
+                    }
+
+                    /* Determine if the headroom is below the threshold.  */
+                    headroom =  (ULONG) TX_UCHAR_POINTER_DIF(TX_VOID_TO_UCHAR_POINTER_CONVERT(found_ptr),
+                                                             TX_VOID_TO_UCHAR_POINTER_CONVERT(thread_ptr -> tx_thread_stack_start));
+                    if ((headroom * ((ULONG) 100)) < (thread_ptr -> tx_thread_stack_size * _tx_thread_stack_monitor_headroom_percent))
+                    {
+
+                        /* Yes, notify the application once interrupts are restored.  */
+                        notify_thread_ptr =  thread_ptr;
+                        stack_used =         thread_ptr -> tx_thread_stack_size - headroom;
+                    }
+
+                    /* The scan of this thread is complete.  */
+                    scan_ptr =  scan_end_ptr;
+                }
+
+                /* Determine if the scan of this thread is complete.  */
+                if (scan_ptr == scan_end_ptr)
+                {
+
+                    /* Yes, move to the next created thread.  */
+                    _tx_thread_stack_monitor_thread =    thread_ptr -> tx_thread_created_next;
+                    _tx_thread_stack_monitor_scan_ptr =  TX_NULL;
+
+                    /* Determine if all created threads have been scanned.  */
+                    if (_tx_thread_stack_monitor_thread == _tx_thread_created_ptr)
+                    {
+
+                        /* Yes, the round is complete, which also ends the slice.  */
+                        _tx_thread_stack_monitor_rounds++;
+                        round_complete =  TX_TRUE;
+                    }
+                }
+                else
+                {
+
+                    /* No, continue from here on the next chunk.  */
+                    _tx_thread_stack_monitor_scan_ptr =  scan_ptr;
+                }
+            }
+
+            /* Pickup the notify function.  */
+            notify =  _tx_thread_stack_monitor_notify;
+
+            /* Restore interrupts.  */
+            TX_RESTORE
+
+            /* Determine if the application is notified.  */
+            if ((notify_thread_ptr != TX_NULL) && (notify != TX_NULL))
+            {
+
+                /* Notify the application of the low headroom.  */
+                (notify)(notify_thread_ptr, stack_used);
+            }
+        }
+
+        /* Determine if the stack monitor was stopped.  */
+        if (_tx_thread_stack_monitor_slice_words == ((ULONG) 0))
+        {
+
+            /* Yes, end the slice.  */
+            budget =  ((ULONG) 0);
+        }
+    }
+}
+#endif
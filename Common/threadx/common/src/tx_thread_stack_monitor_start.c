@@ -0,0 +1,193 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_stack_monitor_start                      PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function starts the stack monitor, which keeps the stack       */
+/*    high-water mark of every created thread up to date. On each         */
+/*    expiration of its timer, it scans a bounded slice of stack words    */
+/*    for the fill pattern, moving from thread to thread. The scan of a   */
+/*    thread goes from the stack start up to the lowest used word found   */
+/*    so far, so the high-water mark is exact to the word, unlike the     */
+/*    best effort binary search of _tx_thread_stack_analyze.              */
+/*                                                                        */
+/*    When a scan finds a new high-water mark that leaves less headroom   */
+/*    than the threshold, the application is notified from the timer      */
+/*    expiration context. This function is called from initialization     */
+/*    or from a thread.                                                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    slice_words                       Stack words scanned per slice     */
+/*    slice_ticks                       Ticks between slices              */
+/*    headroom_percent                  Headroom threshold, in percent    */
+/*                                        of the stack size               */
+/*    headroom_notify                   Function notified when the        */
+/*                                        headroom drops below the        */
+/*                                        threshold, or TX_NULL           */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_create                  Create the monitor timer          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_stack_monitor_start(ULONG slice_words, ULONG slice_ticks, ULONG headroom_percent,
+                VOID (*headroom_notify)(TX_THREAD *thread_ptr, ULONG stack_used))
+{
+
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        status;
+
+
+    /* Check for an invalid slice.  */
+    if ((slice_words == ((ULONG) 0)) || (slice_ticks == ((ULONG) 0)))
+    {
+
+        /* Slice is invalid, return an error.  */
+        status =  TX_SIZE_ERROR;
+    }
+
+    /* Check for an invalid threshold.  */
+    else if (headroom_percent > ((ULONG) 100))
+    {
+
+        /* Threshold is invalid, return an error.  */
+        status =  TX_OPTION_ERROR;
+    }
+
+    /* Determine if the stack monitor is already started.  */
+    else if (_tx_thread_stack_monitor_slice_words != ((ULONG) 0))
+    {
+
+        /* Yes, return an error.  */
+        status =  TX_NOT_DONE;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Setup the stack monitor, which starts with the first created thread.  */
+        _tx_thread_stack_monitor_thread =            TX_NULL;
+        _tx_thread_stack_monitor_scan_ptr =          TX_NULL;
+        _tx_thread_stack_monitor_headroom_percent =  headroom_percent;
+        _tx_thread_stack_monitor_notify =            headroom_notify;
+        _tx_thread_stack_monitor_rounds =            ((ULONG) 0);
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Create the timer that runs the slices.  */
+        status =  _tx_timer_create(&_tx_thread_stack_monitor_timer, "Stack Monitor Timer", _tx_thread_stack_monitor_sample,
+                                   slice_words, slice_ticks, slice_ticks, TX_AUTO_ACTIVATE);
+
+        /* Determine if the timer was created.  */
+        if (status == TX_SUCCESS)
+        {
+
+            /* Yes, setup the slice size, which effectively starts the stack monitor.  */
+            _tx_thread_stack_monitor_slice_words =  slice_words;
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (slice_words != ((ULONG) 0))
+    {
+
+        /* Stack monitor not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (slice_ticks != ((ULONG) 0))
+    {
+
+        /* Stack monitor not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (headroom_percent != ((ULONG) 0))
+    {
+
+        /* Stack monitor not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (headroom_notify != TX_NULL)
+    {
+
+        /* Stack monitor not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Stack monitor not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
@@ -0,0 +1,104 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_stack_monitor_stop                       PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function stops the stack monitor. The high-water marks found   */
+/*    so far are kept. This function is called from a thread.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_delete                  Delete the monitor timer          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_thread_stack_monitor_stop(VOID)
+{
+
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+UINT        status;
+
+
+    /* Determine if the stack monitor is started.  */
+    if (_tx_thread_stack_monitor_slice_words == ((ULONG) 0))
+    {
+
+        /* No, return an error.  */
+        status =  TX_NOT_DONE;
+    }
+    else
+    {
+
+        /* Stop the slices, a slice that is already running stops at its next step.  */
+        _tx_thread_stack_monitor_slice_words =  ((ULONG) 0);
+
+        /* Delete the timer, which also deactivates it.  */
+        status =  _tx_timer_delete(&_tx_thread_stack_monitor_timer);
+    }
+
+    /* Return completion status.  */
+    return(status);
+
+#else
+
+    /* Stack monitor not enabled, return an error.  */
+    return(TX_FEATURE_NOT_ENABLED);
+#endif
+}
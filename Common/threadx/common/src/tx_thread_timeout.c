@@ -86,6 +86,9 @@ VOID            (*suspend_cleanup)(struct TX_THREAD_STRUCT *suspend_thread_ptr,
 ULONG           suspension_sequence;
 
 
+    /* Ports that find the thread through the expired timer do not use the timeout input.  */
+    TX_PARAMETER_NOT_USED(timeout_input);
+
     /* Pickup the thread pointer.  */
     TX_THREAD_TIMEOUT_POINTER_SETUP(thread_ptr)
 
@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_time_increment                                  PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function brings the system clock, the time-slice and the timer */
+/*    list up to date after the specified number of timer interrupts have */
+/*    been suppressed, as if they had all occurred. Expired timers and    */
+/*    time-slices are processed like in the timer interrupt, so this      */
+/*    function is called from interrupt context.                          */
+/*                                                                        */
+/*    The increment should not go past the tick returned by               */
+/*    _tx_timer_get_next. Otherwise, each entry with timers on the way is */
+/*    processed in turn before the timer list advances further, so no     */
+/*    tick is lost, but those timers expire late by the ticks after them. */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    time_increment                    Number of suppressed ticks        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_ticks_advance           Advance the timer list            */
+/*    _tx_timer_expiration_process      Timer expiration processing       */
+/*    _tx_thread_time_slice             Time slice interrupted thread     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_low_power_exit          Low power exit                    */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_time_increment(ULONG time_increment)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Determine if there are ticks to account for.  */
+    if (time_increment != ((ULONG) 0))
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Advance the system clock.  */
+        _tx_timer_system_clock =  _tx_timer_system_clock + time_increment;
+
+        /* Determine if a time-slice is active.  */
+        if (_tx_timer_time_slice != ((ULONG) 0))
+        {
+
+            /* Determine if the time-slice expired within the increment.  */
+            if (time_increment >= _tx_timer_time_slice)
+            {
+
+                /* Yes, set the time-slice expired flag.  */
+                _tx_timer_time_slice =          ((ULONG) 0);
+                _tx_timer_expired_time_slice =  TX_TRUE;
+            }
+            else
+            {
+
+                /* Decrement the time-slice.  */
+                _tx_timer_time_slice =  _tx_timer_time_slice - time_increment;
+            }
+        }
+
+        /* Advance the timer list over the ticks, up to the next entry with timers. The
+           expiration processing continues with the ticks after that entry.  */
+        _tx_timer_increment_ticks =  _tx_timer_increment_ticks + time_increment;
+        _tx_timer_ticks_advance();
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Did a timer expire?  */
+        if (_tx_timer_expired != TX_FALSE)
+        {
+
+            /* Process timer expiration.  */
+            _tx_timer_expiration_process();
+        }
+
+        /* Did time slice expire?  */
+        if (_tx_timer_expired_time_slice != TX_FALSE)
+        {
+
+            /* Time slice interrupted thread.  */
+            _tx_thread_time_slice();
+        }
+    }
+}
+#endif
@@ -54,7 +54,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_wheel_ticks_get         Get ticks until the wheel list    */
+/*                                        cascades                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -168,6 +169,20 @@ UINT                active_timer_list;
                 internal_ptr -> tx_timer_internal_remaining_ticks =  ticks_left;
             }
         }
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+        else if (TX_TIMER_WHEEL_LIST_CHECK(list_head))
+        {
+
+            /* This timer is on one of the cascade wheels. Its remaining ticks are the ticks
+               left once its wheel list cascades, so add the ticks until then.  */
+            ticks_left =  _tx_timer_wheel_ticks_get(list_head);
+            internal_ptr -> tx_timer_internal_remaining_ticks =  
+                                    internal_ptr -> tx_timer_internal_remaining_ticks + ticks_left;
+
+            /* Decrement the number of timers on the cascade wheels.  */
+            _tx_timer_wheel_count--;
+        }
+#endif
         else
         {
         
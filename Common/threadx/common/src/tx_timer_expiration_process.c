@@ -62,6 +62,8 @@
 /*    _tx_thread_system_resume          Thread resume processing          */
 /*    _tx_thread_system_ni_resume       Non-interruptable resume thread   */
 /*    _tx_timer_system_activate         Timer reactivate processing       */
+/*    _tx_timer_ticks_advance           Advance over remaining ticks      */
+/*    _tx_timer_wheel_cascade           Cascade the wheel lists           */
 /*    Timer Expiration Function                                           */
 /*                                                                        */
 /*  CALLED BY                                                             */
@@ -184,6 +186,11 @@ TX_TIMER                    *timer_ptr;
                 {
         
                     _tx_timer_current_ptr =  _tx_timer_list_start;
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+                    /* The timer list wrapped, move the next lists of the cascade wheels down.  */
+                    _tx_timer_wheel_cascade();
+#endif
                 }
 
                 /* Clear the expired flag.  */
@@ -468,6 +475,14 @@ TX_TIMER                    *timer_ptr;
 #endif
                     }
                 }
+
+                /* Determine if _tx_time_increment left ticks after this entry.  */
+                if (_tx_timer_increment_ticks != ((ULONG) 0))
+                {
+
+                    /* Advance the timer list over them, up to the next entry with timers.  */
+                    _tx_timer_ticks_advance();
+                }
             } while (_tx_timer_expired != TX_FALSE);
 
             /* Clear the timer interrupt processing active flag.  */
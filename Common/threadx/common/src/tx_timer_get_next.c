@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_get_next                                  PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of ticks until the timer interrupt */
+/*    processing next has work, which is either a time-slice expiration   */
+/*    or a timer list entry with timers. The timer interrupt can be       */
+/*    suppressed for the ticks before it, and the system clock and timers */
+/*    brought up to date afterwards with _tx_time_increment.              */
+/*                                                                        */
+/*    A timer longer than the timer list is reprocessed when its entry    */
+/*    is reached, so that entry counts as work even though the timer      */
+/*    does not expire yet.                                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    next_timer_tick_ptr               Destination for the number of     */
+/*                                        ticks until the next work       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           Timer or time-slice is active     */
+/*    TX_FALSE                          Nothing is active, the ticks      */
+/*                                        are TX_WAIT_FOREVER             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_low_power_enter         Low power entry                   */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_timer_get_next(ULONG *next_timer_tick_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TIMER_INTERNAL           **timer_list;
+ULONG                       next_tick;
+ULONG                       list_tick;
+UINT                        status;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Determine if a time-slice is active.  */
+    if (_tx_timer_time_slice != ((ULONG) 0))
+    {
+
+        /* The time-slice expires when it is decremented to zero.  */
+        next_tick =  _tx_timer_time_slice;
+    }
+    else
+    {
+
+        /* Nothing found yet.  */
+        next_tick =  TX_WAIT_FOREVER;
+    }
+
+    /* Look for the first timer list entry with timers. The current entry is processed on
+       the next tick, and each following entry one tick later.  */
+    timer_list =  _tx_timer_current_ptr;
+    list_tick =   ((ULONG) 1);
+    while ((list_tick < next_tick) && (list_tick <= TX_TIMER_ENTRIES))
+    {
+
+        /* Determine if this entry has timers.  */
+        if ((*timer_list) != TX_NULL)
+        {
+
+            /* Yes, this is the next tick with work.  */
+            next_tick =  list_tick;
+        }
+        else
+        {
+
+            /* Move to the next entry.  */
+            timer_list =  TX_TIMER_POINTER_ADD(timer_list, ((ULONG) 1));
+
+            /* Check for wrap-around.  */
+            if (timer_list == _tx_timer_list_end)
+            {
+
+                /* Wrap to beginning of list.  */
+                timer_list =  _tx_timer_list_start;
+            }
+
+            /* The next entry is processed one tick later.  */
+            list_tick++;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return the ticks until the next work.  */
+    *next_timer_tick_ptr =  next_tick;
+
+    /* Determine if anything is active.  */
+    if (next_tick == TX_WAIT_FOREVER)
+    {
+        status =  TX_FALSE;
+    }
+    else
+    {
+        status =  TX_TRUE;
+    }
+
+    /* Return status.  */
+    return(status);
+}
+#endif
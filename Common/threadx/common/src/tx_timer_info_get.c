@@ -61,7 +61,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_wheel_ticks_get         Get ticks until the wheel list    */
+/*                                        cascades                        */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -177,6 +178,15 @@ UINT                active_timer_list;
             }
 
         }
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+        else if (TX_TIMER_WHEEL_LIST_CHECK(internal_ptr -> tx_timer_internal_list_head))
+        {
+
+            /* The timer is on one of the cascade wheels, add the ticks until its wheel list
+               cascades to the ticks left once it does.  */
+            ticks_left =  ticks_left + _tx_timer_wheel_ticks_get(internal_ptr -> tx_timer_internal_list_head);
+        }
+#endif
         else
         {
     
@@ -67,12 +67,64 @@ TX_TIMER_INTERNAL   **_tx_timer_list_end;
 TX_TIMER_INTERNAL   **_tx_timer_current_ptr;
 
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+/* Define the cascade wheels. The lists of the first wheel follow each other, then the lists of
+   the second wheel, and so on.  */
+
+TX_TIMER_INTERNAL   *_tx_timer_wheel[TX_TIMER_WHEEL_LEVELS * TX_TIMER_ENTRIES];
+
+
+/* Define the boundary pointers to the cascade wheels.  */
+
+TX_TIMER_INTERNAL   **_tx_timer_wheel_start;
+TX_TIMER_INTERNAL   **_tx_timer_wheel_end;
+
+
+/* Define the index of the next list to cascade in each wheel.  */
+
+UINT                _tx_timer_wheel_current[TX_TIMER_WHEEL_LEVELS];
+
+
+/* Define the number of timers on the cascade wheels.  */
+
+ULONG               _tx_timer_wheel_count;
+
+
+/* Define the cascade sentinel, which is kept on the last entry of the timer list while
+   timers are on the cascade wheels.  */
+
+TX_TIMER_INTERNAL   _tx_timer_wheel_sentinel;
+
+#endif
+
+
+#ifdef TX_LOW_POWER
+
+/* Define the flag that indicates the periodic timer interrupt is suppressed.  */
+
+UINT                _tx_timer_low_power_entered;
+
+
+/* Define the total number of timer interrupts suppressed while the system was idle.  */
+
+ULONG               _tx_timer_low_power_suppressed_ticks;
+
+#endif
+
+
 /* Define the timer expiration flag.  This is used to indicate that a timer 
    has expired.  */
 
 UINT                _tx_timer_expired;
 
 
+/* Define the ticks of _tx_time_increment that the timer list still has to advance over,
+   after the timer list entry that is being processed.  */
+
+ULONG               _tx_timer_increment_ticks;
+
+
 /* Define the created timer list head pointer.  */
 
 TX_TIMER            *_tx_timer_created_ptr;
@@ -221,6 +273,9 @@ UINT    status;
     _tx_timer_expired_time_slice =  TX_FALSE;
     _tx_timer_expired =             TX_FALSE;
 
+    /* Clear the ticks left to advance the timer list over.  */
+    _tx_timer_increment_ticks =  ((ULONG) 0);
+
     /* Set the currently expired timer being processed pointer to NULL.  */
     _tx_timer_expired_timer_ptr =  TX_NULL;
 
@@ -228,6 +283,22 @@ UINT    status;
 
     /* First, initialize the timer list.  */
     TX_MEMSET(&_tx_timer_list[0], 0, (sizeof(_tx_timer_list)));
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+    /* Initialize the cascade wheels, their current lists and the cascade sentinel.  */
+    TX_MEMSET(&_tx_timer_wheel[0], 0, (sizeof(_tx_timer_wheel)));
+    TX_MEMSET(&_tx_timer_wheel_current[0], 0, (sizeof(_tx_timer_wheel_current)));
+    TX_MEMSET(&_tx_timer_wheel_sentinel, 0, (sizeof(TX_TIMER_INTERNAL)));
+    _tx_timer_wheel_count =  ((ULONG) 0);
+#endif
+
+#ifdef TX_LOW_POWER
+
+    /* Clear the low power state.  */
+    _tx_timer_low_power_entered =           TX_FALSE;
+    _tx_timer_low_power_suppressed_ticks =  ((ULONG) 0);
+#endif
 #endif
 
     /* Initialize all of the list pointers.  */
@@ -239,6 +310,14 @@ UINT    status;
     _tx_timer_list_end =     &_tx_timer_list[TX_TIMER_ENTRIES-((ULONG) 1)];
     _tx_timer_list_end =     TX_TIMER_POINTER_ADD(_tx_timer_list_end, ((ULONG) 1));
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+    /* Setup the boundary pointers of the cascade wheels in the same manner.  */
+    _tx_timer_wheel_start =  &_tx_timer_wheel[0];
+    _tx_timer_wheel_end =    &_tx_timer_wheel[(TX_TIMER_WHEEL_LEVELS * TX_TIMER_ENTRIES)-((ULONG) 1)];
+    _tx_timer_wheel_end =    TX_TIMER_POINTER_ADD(_tx_timer_wheel_end, ((ULONG) 1));
+#endif
+
 #ifndef TX_TIMER_PROCESS_IN_ISR
 
     /* Setup the variables associated with the system timer thread's stack and 
@@ -0,0 +1,108 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_LOW_POWER
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_low_power_enter                           PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the scheduler of the port when no thread */
+/*    is ready, with interrupts disabled. If the next tick with timer     */
+/*    work is far enough away, it suppresses the periodic timer interrupt */
+/*    until that tick. It then places the processor in low power mode.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_get_next                Get ticks until next work         */
+/*    TX_LOW_POWER_TIMER_SETUP          Suppress the timer interrupt      */
+/*    TX_LOW_POWER_USER_ENTER           Enter low power mode              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_schedule               Thread scheduling loop            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_low_power_enter(VOID)
+{
+
+ULONG       ticks;
+
+
+    /* Determine if the timer interrupt is already suppressed.  */
+    if (_tx_timer_low_power_entered == TX_FALSE)
+    {
+
+        /* Pickup the ticks until the timer interrupt processing next has work. If nothing
+           is active, the ticks are TX_WAIT_FOREVER.  */
+        _tx_timer_get_next(&ticks);
+
+        /* Determine if enough ticks can be suppressed.  */
+        if (ticks >= TX_LOW_POWER_TICKS_MINIMUM)
+        {
+
+            /* Suppress the timer interrupt until the tick with work.  */
+            TX_LOW_POWER_TIMER_SETUP(ticks)
+
+            /* Remember that the timer interrupt is suppressed.  */
+            _tx_timer_low_power_entered =  TX_TRUE;
+        }
+    }
+
+    /* Place the processor in low power mode.  */
+    TX_LOW_POWER_USER_ENTER
+}
+#endif
+#endif
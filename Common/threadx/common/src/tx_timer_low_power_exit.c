@@ -0,0 +1,106 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_LOW_POWER
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_low_power_exit                            PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the port when the processor wakes up     */
+/*    from low power mode, before any interrupt processing. If the        */
+/*    periodic timer interrupt was suppressed, it is restarted and the    */
+/*    suppressed ticks are accounted for in one step.                     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    TX_LOW_POWER_USER_EXIT            Exit low power mode               */
+/*    TX_LOW_POWER_USER_TIMER_ADJUST    Restart the timer interrupt       */
+/*    _tx_time_increment                Account for suppressed ticks      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_schedule               Thread scheduling loop            */
+/*    _tx_thread_context_save           Save interrupted context          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_low_power_exit(VOID)
+{
+
+ULONG       ticks;
+
+
+    /* Bring the processor out of low power mode.  */
+    TX_LOW_POWER_USER_EXIT
+
+    /* Determine if the timer interrupt was suppressed.  */
+    if (_tx_timer_low_power_entered == TX_TRUE)
+    {
+
+        /* Restart the timer interrupt and pickup the number of suppressed ticks.  */
+        ticks =  TX_LOW_POWER_USER_TIMER_ADJUST;
+
+        /* The timer interrupt is no longer suppressed.  */
+        _tx_timer_low_power_entered =  TX_FALSE;
+
+        /* Update the suppressed ticks statistic.  */
+        _tx_timer_low_power_suppressed_ticks =  _tx_timer_low_power_suppressed_ticks + ticks;
+
+        /* Bring the system clock, the time-slice and the timers up to date.  */
+        _tx_time_increment(ticks);
+    }
+}
+#endif
+#endif
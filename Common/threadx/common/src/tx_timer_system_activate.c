@@ -56,7 +56,8 @@
 /*                                                                        */
 /*  CALLS                                                                 */
 /*                                                                        */
-/*    None                                                                */
+/*    _tx_timer_wheel_list_get          Get list for timer on the         */
+/*                                        cascade wheels                  */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -82,9 +83,11 @@ VOID  _tx_timer_system_activate(TX_TIMER_INTERNAL *timer_ptr)
 TX_TIMER_INTERNAL           **timer_list;
 TX_TIMER_INTERNAL           *next_timer;
 TX_TIMER_INTERNAL           *previous_timer;
-ULONG                       delta;
 ULONG                       remaining_ticks;
+#ifndef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+ULONG                       delta;
 ULONG                       expiration_time;
+#endif
 
 
     /* Pickup the remaining ticks.  */
@@ -106,6 +109,13 @@ ULONG                       expiration_time;
 
                 /* Activate the timer.  */
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+                /* Calculate the proper place for the timer, which is on one of the
+                   cascade wheels if the timer is beyond the timer list.  */
+                timer_list =  _tx_timer_wheel_list_get(timer_ptr);
+#else
+
                 /* Calculate the amount of time remaining for the timer.  */
                 if (remaining_ticks > TX_TIMER_ENTRIES)
                 {
@@ -134,6 +144,7 @@ ULONG                       expiration_time;
                     delta =  TX_TIMER_POINTER_DIF(timer_list, _tx_timer_list_end);
                     timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, delta);
                 }
+#endif
     
                 /* Now put the timer on this list.  */
                 if ((*timer_list) == TX_NULL)
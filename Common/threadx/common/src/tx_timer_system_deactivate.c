@@ -88,6 +88,17 @@ TX_TIMER_INTERNAL   *previous_timer;
 
         /* Deactivate the timer.  */
 
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+        /* Determine if the timer is on one of the cascade wheels.  */
+        if (TX_TIMER_WHEEL_LIST_CHECK(list_head))
+        {
+
+            /* Decrement the number of timers on the cascade wheels.  */
+            _tx_timer_wheel_count--;
+        }
+#endif
+
         /* Pickup the next active timer.  */
         next_timer =  timer_ptr -> tx_timer_internal_active_next;
 
@@ -59,6 +59,8 @@
 /*    _tx_thread_system_suspend         Thread suspension                 */
 /*    _tx_thread_system_ni_suspend      Non-interruptable suspend thread  */
 /*    _tx_timer_system_activate         Timer reactivate processing       */
+/*    _tx_timer_ticks_advance           Advance over remaining ticks      */
+/*    _tx_timer_wheel_cascade           Cascade the wheel lists           */
 /*                                                                        */
 /*  CALLED BY                                                             */
 /*                                                                        */
@@ -134,6 +136,11 @@ TX_TIMER                    *timer_ptr;
             {
         
                 _tx_timer_current_ptr =  _tx_timer_list_start;
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+
+                /* The timer list wrapped, move the next lists of the cascade wheels down.  */
+                _tx_timer_wheel_cascade();
+#endif
             }
 
             /* Clear the expired flag.  */
@@ -424,6 +431,14 @@ TX_TIMER                    *timer_ptr;
                 TX_DISABLE
             }
 
+            /* Determine if _tx_time_increment left ticks after this entry.  */
+            if (_tx_timer_increment_ticks != ((ULONG) 0))
+            {
+
+                /* Advance the timer list over them, up to the next entry with timers.  */
+                _tx_timer_ticks_advance();
+            }
+
             /* Finally, suspend this thread and wait for the next expiration.  */
 
             /* Determine if another expiration took place while we were in this
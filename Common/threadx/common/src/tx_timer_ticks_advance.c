@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+#ifndef TX_NO_TIMER
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_ticks_advance                             PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function advances the current timer pointer over the ticks of  */
+/*    _tx_time_increment that are not yet accounted for, one entry per    */
+/*    tick. It stops at the next entry with timers and sets the timer     */
+/*    expired flag, so the entry is processed like in the timer           */
+/*    interrupt. The expiration processing calls this function again      */
+/*    once the entry is processed, until all the ticks are accounted for. */
+/*    Nothing is advanced while an expiration is pending, since the       */
+/*    current entry must be processed first.                              */
+/*                                                                        */
+/*    This function must be called with interrupts disabled.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_time_increment                Account for suppressed ticks      */
+/*    _tx_timer_expiration_process      Timer expiration processing       */
+/*    _tx_timer_thread_entry            Timer thread processing           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_ticks_advance(VOID)
+{
+
+ULONG                       ticks;
+ULONG                       empty_lists;
+
+
+    /* Advance the current timer pointer over the empty timer list entries, one per tick.  */
+    ticks =        _tx_timer_increment_ticks;
+    empty_lists =  ((ULONG) 0);
+    while ((ticks != ((ULONG) 0)) && (_tx_timer_expired == TX_FALSE))
+    {
+
+        /* One less tick to account for.  */
+        ticks--;
+
+        /* Determine if this entry has timers.  */
+        if ((*_tx_timer_current_ptr) != TX_NULL)
+        {
+
+            /* Yes, they are processed on this tick. The processing moves the
+               timer pointer to the next entry.  */
+            _tx_timer_expired =  TX_TRUE;
+        }
+        else
+        {
+
+            /* No timer expired, increment the timer pointer.  */
+            _tx_timer_current_ptr =  TX_TIMER_POINTER_ADD(_tx_timer_current_ptr, ((ULONG) 1));
+
+            /* Check for wrap-around.  */
+            if (_tx_timer_current_ptr == _tx_timer_list_end)
+            {
+
+                /* Wrap to beginning of list.  */
+                _tx_timer_current_ptr =  _tx_timer_list_start;
+            }
+
+            /* Determine if the whole timer list is empty.  */
+            empty_lists++;
+            if (empty_lists == TX_TIMER_ENTRIES)
+            {
+
+                /* Yes, only the position within the list matters for the remaining ticks.  */
+                ticks =  ticks % TX_TIMER_ENTRIES;
+            }
+        }
+    }
+
+    /* Save the ticks left for after the entry is processed.  */
+    _tx_timer_increment_ticks =  ticks;
+}
+#endif
@@ -0,0 +1,190 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_wheel_cascade                             PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called when the current timer pointer wraps. It    */
+/*    removes the cascade sentinel from the expired timers, moves the     */
+/*    timers on the current list of the first cascade wheel down and      */
+/*    advances that wheel. When the current list of a wheel wraps, the    */
+/*    current list of the next wheel is cascaded as well. Each timer is   */
+/*    placed again with the ticks it has left, so it lands on the timer   */
+/*    list or on a lower wheel. The cascade sentinel is placed back on    */
+/*    the last timer list entry if timers remain on the wheels.           */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_system_activate         Timer activate processing         */
+/*    _tx_timer_system_deactivate       Timer deactivate processing       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_expiration_process      Timer expiration processing       */
+/*    _tx_timer_thread_entry            Timer thread processing           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_timer_wheel_cascade(VOID)
+{
+
+TX_TIMER_INTERNAL           **wheel_list;
+TX_TIMER_INTERNAL           *cascade_timers;
+TX_TIMER_INTERNAL           *current_timer;
+UINT                        level;
+UINT                        wheel_wrapped;
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+TX_TIMER                    *timer_ptr;
+#endif
+
+
+    /* Remove the cascade sentinel from the expired timers.  */
+    _tx_timer_system_deactivate(&_tx_timer_wheel_sentinel);
+
+    /* Cascade the current list of the first wheel, and of each following wheel whose
+       previous wheel wrapped.  */
+    level =  ((UINT) 0);
+    do
+    {
+
+        /* Pickup the current list of this wheel.  */
+        wheel_list =  TX_TIMER_POINTER_ADD(_tx_timer_wheel_start, ((((ULONG) level) * TX_TIMER_ENTRIES) + ((ULONG) _tx_timer_wheel_current[level])));
+
+        /* Remove the timers from the list.  */
+        cascade_timers =  *wheel_list;
+        *wheel_list =  TX_NULL;
+
+        /* Advance the current list of this wheel before the timers are placed again,
+           since a timer with ticks left beyond this wheel lands on its new lists.  */
+        _tx_timer_wheel_current[level]++;
+        wheel_wrapped =  TX_FALSE;
+        if (((ULONG) _tx_timer_wheel_current[level]) == TX_TIMER_ENTRIES)
+        {
+
+            /* Wrap to the beginning of the wheel.  */
+            _tx_timer_wheel_current[level] =  ((UINT) 0);
+            wheel_wrapped =  TX_TRUE;
+        }
+
+        /* Determine if there are timers to cascade.  */
+        if (cascade_timers != TX_NULL)
+        {
+
+            /* Break the circular list so it can be walked while the timers are placed again.  */
+            current_timer =  cascade_timers -> tx_timer_internal_active_previous;
+            current_timer -> tx_timer_internal_active_next =  TX_NULL;
+        }
+
+        /* Place each timer again.  */
+        while (cascade_timers != TX_NULL)
+        {
+
+            /* Remove the timer from the cascaded list.  */
+            current_timer =   cascade_timers;
+            cascade_timers =  current_timer -> tx_timer_internal_active_next;
+
+            /* The timer is no longer on the cascade wheels.  */
+            _tx_timer_wheel_count--;
+
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+
+            /* Increment the total expiration adjustments counter.  */
+            _tx_timer_performance__expiration_adjust_count++;
+
+            /* Determine if this is an application timer.  */
+            if (current_timer -> tx_timer_internal_timeout_function != &_tx_thread_timeout)
+            {
+
+                /* Derive the application timer pointer.  */
+
+                /* Pickup the application timer pointer.  */
+                TX_USER_TIMER_POINTER_GET(current_timer, timer_ptr)
+
+                /* Increment the number of expiration adjustments on this timer.  */
+                if (timer_ptr -> tx_timer_id == TX_TIMER_ID)
+                {
+
+                    timer_ptr -> tx_timer_performance__expiration_adjust_count++;
+                }
+            }
+#endif
+
+            /* Clear the list head for the timer activate call.  */
+            current_timer -> tx_timer_internal_list_head =  TX_NULL;
+
+            /* Place the timer with the ticks it has left.  */
+            _tx_timer_system_activate(current_timer);
+        }
+
+        /* Move to the next wheel.  */
+        level++;
+
+    } while ((wheel_wrapped == TX_TRUE) && (level < TX_TIMER_WHEEL_LEVELS));
+
+    /* Determine if the cascade sentinel needs to be placed back on the last timer list entry.  */
+    if (_tx_timer_wheel_count != ((ULONG) 0))
+    {
+
+        /* The current timer pointer is at the beginning of the timer list, so a full list
+           of ticks places the sentinel on the last entry.  */
+        _tx_timer_wheel_sentinel.tx_timer_internal_remaining_ticks =  TX_TIMER_ENTRIES;
+        _tx_timer_system_activate(&_tx_timer_wheel_sentinel);
+    }
+}
+#endif /* TX_TIMER_ENABLE_HIERARCHICAL_WHEEL */
+
@@ -0,0 +1,197 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_wheel_list_get                            PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the list the specified internal timer is      */
+/*    placed on. Timers that fit in the timer list are placed on it as    */
+/*    before. Longer timers are placed on the first cascade wheel whose   */
+/*    lists cover their remaining ticks, and their remaining ticks are    */
+/*    replaced by the ticks left once that list cascades. The cascade     */
+/*    sentinel is placed on the last timer list entry if it is not        */
+/*    already there.                                                      */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_ptr                         Pointer to timer control block    */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    timer_list                        Pointer to the timer list         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_system_activate         Timer activate processing         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+TX_TIMER_INTERNAL  **_tx_timer_wheel_list_get(TX_TIMER_INTERNAL *timer_ptr)
+{
+
+TX_TIMER_INTERNAL           **timer_list;
+TX_TIMER_INTERNAL           *next_timer;
+TX_TIMER_INTERNAL           *previous_timer;
+ULONG                       remaining_ticks;
+ULONG                       ticks;
+ULONG                       list_offset;
+ULONG                       delta;
+UINT                        level;
+UINT                        shift;
+
+
+    /* Pickup the remaining ticks.  */
+    remaining_ticks =  timer_ptr -> tx_timer_internal_remaining_ticks;
+
+    /* Determine if the timer fits in the timer list.  */
+    if (remaining_ticks <= TX_TIMER_ENTRIES)
+    {
+
+        /* Calculate the proper place for the timer on the timer list.  */
+        timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_current_ptr, (remaining_ticks - ((ULONG) 1)));
+        if (TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(timer_list) >= TX_TIMER_INDIRECT_TO_VOID_POINTER_CONVERT(_tx_timer_list_end))
+        {
+
+            /* Wrap from the beginning of the list.  */
+            delta =  TX_TIMER_POINTER_DIF(timer_list, _tx_timer_list_end);
+            timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, delta);
+        }
+    }
+    else
+    {
+
+        /* The timer goes on one of the cascade wheels.  */
+
+        /* Calculate the ticks until the current timer pointer wraps, which is when the 
+           current list of the first wheel cascades.  */
+        ticks =  TX_TIMER_ENTRIES - TX_TIMER_POINTER_DIF(_tx_timer_current_ptr, _tx_timer_list_start);
+
+        /* Calculate the offset from the current list of the first wheel.  */
+        level =        ((UINT) 0);
+        shift =        TX_TIMER_WHEEL_SHIFT;
+        list_offset =  (remaining_ticks - ticks - ((ULONG) 1)) >> shift;
+
+        /* Move up the wheels until one of them covers the remaining ticks.  */
+        while ((list_offset >= TX_TIMER_ENTRIES) && (level < (TX_TIMER_WHEEL_LEVELS - ((UINT) 1))))
+        {
+
+            /* The current list of the next wheel cascades when the current list of this 
+               wheel wraps.  */
+            ticks =  ticks + ((((TX_TIMER_ENTRIES - ((ULONG) 1)) - ((ULONG) _tx_timer_wheel_current[level]))) << shift);
+
+            /* Move to the next wheel.  */
+            level++;
+            shift =        shift + TX_TIMER_WHEEL_SHIFT;
+            list_offset =  (remaining_ticks - ticks - ((ULONG) 1)) >> shift;
+        }
+
+        /* Determine if the timer is beyond the last wheel.  */
+        if (list_offset >= TX_TIMER_ENTRIES)
+        {
+
+            /* Place the timer on the last list of the last wheel. It is placed again when
+               that list cascades.  */
+            list_offset =  TX_TIMER_ENTRIES - ((ULONG) 1);
+        }
+
+        /* Leave the ticks left once the list cascades in the timer.  */
+        timer_ptr -> tx_timer_internal_remaining_ticks =  remaining_ticks - ticks - (list_offset << shift);
+
+        /* Calculate the proper list on this wheel.  */
+        list_offset =  list_offset + ((ULONG) _tx_timer_wheel_current[level]);
+        if (list_offset >= TX_TIMER_ENTRIES)
+        {
+
+            /* Wrap from the beginning of the wheel.  */
+            list_offset =  list_offset - TX_TIMER_ENTRIES;
+        }
+        timer_list =  TX_TIMER_POINTER_ADD(_tx_timer_wheel_start, ((((ULONG) level) * TX_TIMER_ENTRIES) + list_offset));
+
+        /* Increment the number of timers on the cascade wheels.  */
+        _tx_timer_wheel_count++;
+
+        /* Determine if the cascade sentinel needs to be placed on the last timer list entry.  */
+        if (_tx_timer_wheel_sentinel.tx_timer_internal_list_head == TX_NULL)
+        {
+
+            /* Pickup the last timer list entry.  */
+            _tx_timer_wheel_sentinel.tx_timer_internal_list_head =  TX_TIMER_POINTER_ADD(_tx_timer_list_start, (TX_TIMER_ENTRIES - ((ULONG) 1)));
+
+            /* Now put the sentinel on this list.  */
+            if ((*_tx_timer_wheel_sentinel.tx_timer_internal_list_head) == TX_NULL)
+            {
+
+                /* This list is NULL, just put the sentinel on it.  */
+                _tx_timer_wheel_sentinel.tx_timer_internal_active_next =      &_tx_timer_wheel_sentinel;
+                _tx_timer_wheel_sentinel.tx_timer_internal_active_previous =  &_tx_timer_wheel_sentinel;
+                *_tx_timer_wheel_sentinel.tx_timer_internal_list_head =       &_tx_timer_wheel_sentinel;
+            }
+            else
+            {
+
+                /* This list is not NULL, add the sentinel to the end.  */
+                next_timer =                                                  *_tx_timer_wheel_sentinel.tx_timer_internal_list_head;
+                previous_timer =                                              next_timer -> tx_timer_internal_active_previous;
+                previous_timer -> tx_timer_internal_active_next =             &_tx_timer_wheel_sentinel;
+                next_timer -> tx_timer_internal_active_previous =             &_tx_timer_wheel_sentinel;
+                _tx_timer_wheel_sentinel.tx_timer_internal_active_next =      next_timer;
+                _tx_timer_wheel_sentinel.tx_timer_internal_active_previous =  previous_timer;
+            }
+        }
+    }
+
+    /* Return the timer list.  */
+    return(timer_list);
+}
+#endif /* TX_TIMER_ENABLE_HIERARCHICAL_WHEEL */
+
@@ -0,0 +1,127 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_wheel_ticks_get                           PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the number of ticks until the specified       */
+/*    cascade wheel list cascades. Added to the remaining ticks of a      */
+/*    timer on that list, this gives the ticks left before the timer      */
+/*    expires.                                                            */
+/*                                                                        */
+/*    It is assumed that this function is called with interrupts          */
+/*    disabled.                                                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    list_head                         Pointer to the wheel list         */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    ticks                             Ticks until the list cascades     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_deactivate              Timer deactivate processing       */
+/*    _tx_timer_info_get                Timer information retrieval       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _tx_timer_wheel_ticks_get(TX_TIMER_INTERNAL **list_head)
+{
+
+ULONG                       ticks;
+ULONG                       list_index;
+ULONG                       list_offset;
+UINT                        level;
+UINT                        target_level;
+UINT                        shift;
+
+
+    /* Calculate the wheel and the list within the wheel.  */
+    list_index =    TX_TIMER_POINTER_DIF(list_head, _tx_timer_wheel_start);
+    target_level =  (UINT) (list_index >> TX_TIMER_WHEEL_SHIFT);
+    list_index =    list_index & (TX_TIMER_ENTRIES - ((ULONG) 1));
+
+    /* Calculate the ticks until the current timer pointer wraps, which is when the 
+       current list of the first wheel cascades.  */
+    ticks =  TX_TIMER_ENTRIES - TX_TIMER_POINTER_DIF(_tx_timer_current_ptr, _tx_timer_list_start);
+
+    /* Add the ticks until the current list of each lower wheel wraps.  */
+    shift =  TX_TIMER_WHEEL_SHIFT;
+    for (level = ((UINT) 0); level < target_level; level++)
+    {
+
+        /* The current list of the next wheel cascades when the current list of this 
+           wheel wraps.  */
+        ticks =  ticks + ((((TX_TIMER_ENTRIES - ((ULONG) 1)) - ((ULONG) _tx_timer_wheel_current[level]))) << shift);
+        shift =  shift + TX_TIMER_WHEEL_SHIFT;
+    }
+
+    /* Calculate the offset of the list from the current list of its wheel.  */
+    if (list_index >= ((ULONG) _tx_timer_wheel_current[target_level]))
+    {
+
+        /* The list is at or after the current list.  */
+        list_offset =  list_index - ((ULONG) _tx_timer_wheel_current[target_level]);
+    }
+    else
+    {
+
+        /* The list is before the current list, so the wheel wraps first.  */
+        list_offset =  (list_index + TX_TIMER_ENTRIES) - ((ULONG) _tx_timer_wheel_current[target_level]);
+    }
+
+    /* Return the ticks until the list cascades.  */
+    ticks =  ticks + (list_offset << shift);
+    return(ticks);
+}
+#endif /* TX_TIMER_ENABLE_HIERARCHICAL_WHEEL */
+
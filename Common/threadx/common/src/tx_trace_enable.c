@@ -385,6 +385,15 @@ UINT                            status;
         /* Release the preeemption.  */
         _tx_thread_preempt_disable--;
 
+#ifdef TX_TRACE_ENABLE_STREAMING
+
+        /* Restart the trace stream at the start of the buffer, with a new header.  */
+        _tx_trace_stream_buffer_wraps =    ((ULONG) 0);
+        _tx_trace_stream_read_ptr =        _tx_trace_buffer_start_ptr;
+        _tx_trace_stream_read_wraps =      ((ULONG) 0);
+        _tx_trace_stream_header_pending =  TX_TRUE;
+#endif
+
         /* Finally, setup the current buffer pointer, which effectively enables the trace!  */
         _tx_trace_buffer_current_ptr =    (TX_TRACE_BUFFER_ENTRY *) _tx_trace_buffer_start_ptr;
 
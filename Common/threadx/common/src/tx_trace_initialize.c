@@ -92,6 +92,48 @@ ULONG                             _tx_trace_available_registry_entries;
 
 ULONG                             _tx_trace_registry_search_start;
 
+
+#ifdef TX_TRACE_ENABLE_STREAMING
+
+/* Define the number of times the trace buffer wrapped since the trace was enabled.  */
+
+ULONG                             _tx_trace_stream_buffer_wraps;
+
+
+/* Define the position of the trace stream reader.  */
+
+TX_TRACE_BUFFER_ENTRY             *_tx_trace_stream_read_ptr;
+ULONG                             _tx_trace_stream_read_wraps;
+
+
+/* Define the stream buffer where records are encoded before they are written.  */
+
+UCHAR                             *_tx_trace_stream_buffer_start;
+UCHAR                             *_tx_trace_stream_buffer_end;
+UCHAR                             *_tx_trace_stream_buffer_current;
+
+
+/* Define the application function that writes the encoded records.  */
+
+UINT                              (*_tx_trace_stream_write_function)(UCHAR *data, ULONG size);
+
+
+/* Define the state the next event is encoded against.  */
+
+ULONG                             _tx_trace_stream_time_stamp;
+ULONG                             _tx_trace_stream_thread_pointer;
+ULONG                             _tx_trace_stream_thread_priority;
+UINT                              _tx_trace_stream_header_pending;
+
+
+/* Define the stream statistics.  */
+
+ULONG                             _tx_trace_stream_buffer_events;
+ULONG                             _tx_trace_stream_events;
+ULONG                             _tx_trace_stream_dropped;
+ULONG                             _tx_trace_stream_bytes;
+#endif
+
 #endif
 
 
@@ -148,6 +190,12 @@ VOID  _tx_trace_initialize(VOID)
     _tx_trace_buffer_start_ptr =    TX_NULL;
     _tx_trace_buffer_end_ptr =      TX_NULL;
     _tx_trace_buffer_current_ptr =  TX_NULL;
+#ifdef TX_TRACE_ENABLE_STREAMING
+
+    /* Streaming is not enabled.  */
+    _tx_trace_stream_write_function =  TX_NULL;
+    _tx_trace_stream_buffer_start =    TX_NULL;
+#endif
 #endif
 #endif
 }
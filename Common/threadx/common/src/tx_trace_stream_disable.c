@@ -0,0 +1,112 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Trace                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_trace_stream_disable                            PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function writes the records left in the stream buffer and      */
+/*    disables the streaming of the trace buffer. It is called from the   */
+/*    thread that drains the stream.                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_trace_stream_flush            Write the stream buffer           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_trace_stream_disable(VOID)
+{
+
+#if defined(TX_ENABLE_EVENT_TRACE) && defined(TX_TRACE_ENABLE_STREAMING)
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        status;
+
+
+    /* Determine if streaming is enabled.  */
+    if (_tx_trace_stream_write_function == TX_NULL)
+    {
+
+        /* No, streaming is not enabled.  */
+        status =  TX_NOT_DONE;
+    }
+    else
+    {
+
+        /* Write the records left in the stream buffer.  */
+        status =  _tx_trace_stream_flush();
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Clear the write function, which disables streaming.  */
+        _tx_trace_stream_write_function =  TX_NULL;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return completion status.  */
+    return(status);
+
+#else
+
+    /* Trace streaming not enabled, return an error.  */
+    return(TX_FEATURE_NOT_ENABLED);
+#endif
+}
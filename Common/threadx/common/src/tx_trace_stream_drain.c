@@ -0,0 +1,396 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Trace                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_trace_stream_drain                              PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function drains the events added to the trace buffer since the */
+/*    last drain. Each event is copied out of the trace buffer with       */
+/*    interrupts disabled and then encoded into the stream buffer with    */
+/*    its time stamp as a delta, and with its thread and priority only    */
+/*    when they change. The stream buffer is written whenever it is full  */
+/*    and at the end of the drain.                                        */
+/*                                                                        */
+/*    Events the writer overwrote before they were drained are counted as */
+/*    dropped and reported in the stream. At most one trace buffer of     */
+/*    events is drained per call, so the caller is not held by a busy     */
+/*    system. This function is called periodically from one thread, with  */
+/*    a period short enough for the trace buffer not to wrap between      */
+/*    calls.                                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    events_drained                    Destination for the number of     */
+/*                                        events drained                  */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_trace_stream_registry_send    Send registry entries             */
+/*    _tx_trace_stream_flush            Write the stream buffer           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_trace_stream_drain(ULONG *events_drained)
+{
+
+#if defined(TX_ENABLE_EVENT_TRACE) && defined(TX_TRACE_ENABLE_STREAMING)
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TRACE_BUFFER_ENTRY       entry;
+TX_TRACE_BUFFER_ENTRY       *current_ptr;
+ULONG                       entries;
+ULONG                       pending;
+ULONG                       dropped;
+ULONG                       drained;
+ULONG                       info_1;
+ULONG                       info_2;
+ULONG                       info_3;
+ULONG                       info_4;
+ULONG                       event_id;
+UINT                        header;
+UCHAR                       tag;
+UCHAR                       *tag_ptr;
+UINT                        status;
+UINT                        flush_status;
+
+
+    /* Nothing drained yet.  */
+    drained =  ((ULONG) 0);
+    status =   TX_SUCCESS;
+
+    /* Loop to drain the events.  */
+    do
+    {
+
+        /* Default to nothing to drain.  */
+        pending =  ((ULONG) 0);
+        dropped =  ((ULONG) 0);
+        header =   TX_FALSE;
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Pickup the position of the trace buffer writer.  */
+        current_ptr =  _tx_trace_buffer_current_ptr;
+
+        /* Determine if the trace and streaming are enabled.  */
+        if ((current_ptr == TX_NULL) || (_tx_trace_stream_write_function == TX_NULL))
+        {
+
+            /* No, there is nothing to drain.  */
+            status =  TX_NOT_DONE;
+        }
+        else
+        {
+
+            /* Pickup the header request.  */
+            header =  _tx_trace_stream_header_pending;
+            _tx_trace_stream_header_pending =  TX_FALSE;
+
+            /* Compute the number of events the writer is ahead of the reader. The arithmetic is modulo
+               the size of a ULONG, which is correct as long as the reader is less than 2^32 events
+               behind.  */
+            entries =  (ULONG) (_tx_trace_buffer_end_ptr - _tx_trace_buffer_start_ptr);
+            pending =  ((_tx_trace_stream_buffer_wraps - _tx_trace_stream_read_wraps) * entries) +
+                            ((ULONG) (current_ptr - _tx_trace_stream_read_ptr));
+
+            /* Determine if the writer has overwritten events the reader has not drained.  */
+            if (pending > entries)
+            {
+
+                /* Yes, these events are lost. Continue with the oldest event in the buffer, which is
+                   the one the writer overwrites next.  */
+                dropped =  pending - entries;
+                pending =  entries;
+                _tx_trace_stream_read_ptr =    current_ptr;
+                _tx_trace_stream_read_wraps =  _tx_trace_stream_buffer_wraps - ((ULONG) 1);
+            }
+
+            /* Determine if there is an event to drain in this call.  */
+            if ((pending != ((ULONG) 0)) && (drained < entries))
+            {
+
+                /* Copy the event out of the trace buffer before the writer reuses the entry.  */
+                entry =  *_tx_trace_stream_read_ptr;
+
+                /* Move the reader to the next entry.  */
+                _tx_trace_stream_read_ptr++;
+                if (_tx_trace_stream_read_ptr >= _tx_trace_buffer_end_ptr)
+                {
+
+                    /* Wrap to the beginning of the trace buffer.  */
+                    _tx_trace_stream_read_ptr =  _tx_trace_buffer_start_ptr;
+                    _tx_trace_stream_read_wraps++;
+                }
+            }
+            else
+            {
+
+                /* The drain is complete.  */
+                pending =  ((ULONG) 0);
+            }
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Determine if a header is requested.  */
+        if (header == TX_TRUE)
+        {
+
+            /* Make room for the record.  */
+            if (((ULONG) (_tx_trace_stream_buffer_end - _tx_trace_stream_buffer_current)) < TX_TRACE_STREAM_RECORD_MAX)
+            {
+
+                /* Write the stream buffer.  */
+                status =  _tx_trace_stream_flush();
+            }
+
+            /* Encode the header record.  */
+            *_tx_trace_stream_buffer_current =  TX_TRACE_STREAM_RECORD_HEADER;
+            _tx_trace_stream_buffer_current++;
+            *_tx_trace_stream_buffer_current =  ((UCHAR) 'T');
+            _tx_trace_stream_buffer_current++;
+            *_tx_trace_stream_buffer_current =  ((UCHAR) 'X');
+            _tx_trace_stream_buffer_current++;
+            *_tx_trace_stream_buffer_current =  ((UCHAR) 'T');
+            _tx_trace_stream_buffer_current++;
+            *_tx_trace_stream_buffer_current =  ((UCHAR) 'S');
+            _tx_trace_stream_buffer_current++;
+            TX_TRACE_STREAM_VALUE_PUT(TX_TRACE_STREAM_VERSION)
+            TX_TRACE_STREAM_VALUE_PUT(TX_TRACE_TIME_MASK)
+
+            /* The following events are encoded against a cleared state.  */
+            _tx_trace_stream_time_stamp =       ((ULONG) 0);
+            _tx_trace_stream_thread_pointer =   ((ULONG) 0);
+            _tx_trace_stream_thread_priority =  ((ULONG) 0);
+
+            /* Send the objects in the registry.  */
+            if (status == TX_SUCCESS)
+            {
+
+                status =  _tx_trace_stream_registry_send(((ULONG) 0));
+            }
+        }
+
+        /* Determine if events were overwritten.  */
+        if (dropped != ((ULONG) 0))
+        {
+
+            /* Make room for the record.  */
+            if (((ULONG) (_tx_trace_stream_buffer_end - _tx_trace_stream_buffer_current)) < TX_TRACE_STREAM_RECORD_MAX)
+            {
+
+                /* Write the stream buffer.  */
+                status =  _tx_trace_stream_flush();
+            }
+
+            /* Encode the dropped record.  */
+            *_tx_trace_stream_buffer_current =  TX_TRACE_STREAM_RECORD_DROPPED;
+            _tx_trace_stream_buffer_current++;
+            TX_TRACE_STREAM_VALUE_PUT(dropped)
+
+            /* Update the statistic.  */
+            _tx_trace_stream_dropped =  _tx_trace_stream_dropped + dropped;
+        }
+
+        /* Determine if an event was copied.  */
+        if (pending != ((ULONG) 0))
+        {
+
+            /* Pickup the information fields.  */
+            event_id =  entry.tx_trace_buffer_entry_event_id;
+#ifdef TX_MISRA_ENABLE
+            info_1 =    entry.tx_trace_buffer_entry_info_1;
+            info_2 =    entry.tx_trace_buffer_entry_info_2;
+            info_3 =    entry.tx_trace_buffer_entry_info_3;
+            info_4 =    entry.tx_trace_buffer_entry_info_4;
+#else
+            info_1 =    entry.tx_trace_buffer_entry_information_field_1;
+            info_2 =    entry.tx_trace_buffer_entry_information_field_2;
+            info_3 =    entry.tx_trace_buffer_entry_information_field_3;
+            info_4 =    entry.tx_trace_buffer_entry_information_field_4;
+#endif
+
+            /* Determine if this event creates an object, which is registered before the event.  */
+            if ((event_id == TX_TRACE_THREAD_CREATE) || (event_id == TX_TRACE_TIMER_CREATE) ||
+                (event_id == TX_TRACE_QUEUE_CREATE) || (event_id == TX_TRACE_SEMAPHORE_CREATE) ||
+                (event_id == TX_TRACE_MUTEX_CREATE) || (event_id == TX_TRACE_EVENT_FLAGS_CREATE) ||
+                (event_id == TX_TRACE_BLOCK_POOL_CREATE) || (event_id == TX_TRACE_BYTE_POOL_CREATE))
+            {
+
+                /* Send the object first, so it is named from its create event on.  */
+                if ((status == TX_SUCCESS) && (info_1 != ((ULONG) 0)))
+                {
+
+                    status =  _tx_trace_stream_registry_send(info_1);
+                }
+            }
+
+            /* Make room for the record.  */
+            if (((ULONG) (_tx_trace_stream_buffer_end - _tx_trace_stream_buffer_current)) < TX_TRACE_STREAM_RECORD_MAX)
+            {
+
+                /* Write the stream buffer.  */
+                status =  _tx_trace_stream_flush();
+            }
+
+            /* Reserve the tag, which is known once the event is encoded.  */
+            tag_ptr =  _tx_trace_stream_buffer_current;
+            _tx_trace_stream_buffer_current++;
+            tag =  TX_TRACE_STREAM_RECORD_EVENT;
+
+            /* Encode the event ID and the time elapsed since the previous event.  */
+            TX_TRACE_STREAM_VALUE_PUT(event_id)
+            TX_TRACE_STREAM_VALUE_PUT((entry.tx_trace_buffer_entry_time_stamp - _tx_trace_stream_time_stamp) & TX_TRACE_TIME_MASK)
+            _tx_trace_stream_time_stamp =  entry.tx_trace_buffer_entry_time_stamp;
+
+            /* Encode the thread and its priority, only when they change.  */
+            if (entry.tx_trace_buffer_entry_thread_pointer != _tx_trace_stream_thread_pointer)
+            {
+
+                tag =  tag | TX_TRACE_STREAM_EVENT_THREAD;
+                TX_TRACE_STREAM_VALUE_PUT(entry.tx_trace_buffer_entry_thread_pointer)
+                _tx_trace_stream_thread_pointer =  entry.tx_trace_buffer_entry_thread_pointer;
+            }
+            if (entry.tx_trace_buffer_entry_thread_priority != _tx_trace_stream_thread_priority)
+            {
+
+                tag =  tag | TX_TRACE_STREAM_EVENT_PRIORITY;
+                TX_TRACE_STREAM_VALUE_PUT(entry.tx_trace_buffer_entry_thread_priority)
+                _tx_trace_stream_thread_priority =  entry.tx_trace_buffer_entry_thread_priority;
+            }
+
+            /* Encode the information fields that are not zero.  */
+            if (info_1 != ((ULONG) 0))
+            {
+
+                tag =  tag | TX_TRACE_STREAM_EVENT_INFO_1;
+                TX_TRACE_STREAM_VALUE_PUT(info_1)
+            }
+            if (info_2 != ((ULONG) 0))
+            {
+
+                tag =  tag | TX_TRACE_STREAM_EVENT_INFO_2;
+                TX_TRACE_STREAM_VALUE_PUT(info_2)
+            }
+            if (info_3 != ((ULONG) 0))
+            {
+
+                tag =  tag | TX_TRACE_STREAM_EVENT_INFO_3;
+                TX_TRACE_STREAM_VALUE_PUT(info_3)
+            }
+            if (info_4 != ((ULONG) 0))
+            {
+
+                tag =  tag | TX_TRACE_STREAM_EVENT_INFO_4;
+                TX_TRACE_STREAM_VALUE_PUT(info_4)
+            }
+
+            /* Complete the record.  */
+            *tag_ptr =  tag;
+            _tx_trace_stream_buffer_events++;
+            drained++;
+        }
+
+    /* Continue until the drain is complete or a write fails.  */
+    } while ((pending != ((ULONG) 0)) && (status == TX_SUCCESS));
+
+    /* Determine if the records can still be written.  */
+    if ((status == TX_SUCCESS) || ((status == TX_NOT_DONE) && (_tx_trace_stream_write_function != TX_NULL)))
+    {
+
+        /* Write the rest of the stream buffer.  */
+        flush_status =  _tx_trace_stream_flush();
+        if (flush_status != TX_SUCCESS)
+        {
+
+            /* Return the write error.  */
+            status =  flush_status;
+        }
+    }
+
+    /* Return the number of events drained.  */
+    if (events_drained != TX_NULL)
+    {
+
+        *events_drained =  drained;
+    }
+
+    /* Return completion status.  */
+    return(status);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (events_drained != TX_NULL)
+    {
+
+        /* Trace streaming not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Trace streaming not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
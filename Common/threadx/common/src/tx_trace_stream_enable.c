@@ -0,0 +1,204 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Trace                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_trace_stream_enable                             PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function enables the streaming of the trace buffer. The events */
+/*    added to the trace buffer are then drained by the application with  */
+/*    _tx_trace_stream_drain, which encodes them into the stream buffer   */
+/*    and hands the stream buffer to the write function supplied here.    */
+/*                                                                        */
+/*    Streaming starts with the oldest event in the trace buffer, or with */
+/*    the first event if the trace is enabled later. The write function   */
+/*    sends the data over a UART, to a host file, to a socket, etc., and  */
+/*    returns TX_SUCCESS once the data is sent.                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    stream_buffer_start               Start of the stream buffer        */
+/*    stream_buffer_size                Size of the stream buffer         */
+/*    stream_write_function             Function that writes the          */
+/*                                        encoded records                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_trace_stream_enable(UCHAR *stream_buffer_start, ULONG stream_buffer_size, UINT (*stream_write_function)(UCHAR *data, ULONG size))
+{
+
+#if defined(TX_ENABLE_EVENT_TRACE) && defined(TX_TRACE_ENABLE_STREAMING)
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        status;
+
+
+    /* Check for an invalid stream buffer or write function.  */
+    if ((stream_buffer_start == TX_NULL) || (stream_write_function == TX_NULL))
+    {
+
+        /* Pointer is invalid, return an error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Check for a stream buffer that cannot hold a record.  */
+    else if (stream_buffer_size < TX_TRACE_STREAM_RECORD_MAX)
+    {
+
+        /* Stream buffer is too small, return an error.  */
+        status =  TX_SIZE_ERROR;
+    }
+    else
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Determine if streaming is already enabled.  */
+        if (_tx_trace_stream_write_function != TX_NULL)
+        {
+
+            /* Yes, streaming is already enabled.  */
+            status =  TX_NOT_DONE;
+        }
+        else
+        {
+
+            /* Setup the stream buffer.  */
+            _tx_trace_stream_buffer_start =    stream_buffer_start;
+            _tx_trace_stream_buffer_end =      TX_UCHAR_POINTER_ADD(stream_buffer_start, stream_buffer_size);
+            _tx_trace_stream_buffer_current =  stream_buffer_start;
+
+            /* Clear the statistics.  */
+            _tx_trace_stream_buffer_events =  ((ULONG) 0);
+            _tx_trace_stream_events =         ((ULONG) 0);
+            _tx_trace_stream_dropped =        ((ULONG) 0);
+            _tx_trace_stream_bytes =          ((ULONG) 0);
+
+            /* Start the stream with a header.  */
+            _tx_trace_stream_header_pending =  TX_TRUE;
+
+            /* Determine if the trace is already enabled. If not, the trace enable positions the reader.  */
+            if (_tx_trace_buffer_current_ptr != TX_NULL)
+            {
+
+                /* Determine if the trace buffer has wrapped.  */
+                if (_tx_trace_stream_buffer_wraps == ((ULONG) 0))
+                {
+
+                    /* No, the oldest event is the first one.  */
+                    _tx_trace_stream_read_ptr =    _tx_trace_buffer_start_ptr;
+                    _tx_trace_stream_read_wraps =  ((ULONG) 0);
+                }
+                else
+                {
+
+                    /* Yes, the oldest event is the one the writer overwrites next.  */
+                    _tx_trace_stream_read_ptr =    _tx_trace_buffer_current_ptr;
+                    _tx_trace_stream_read_wraps =  _tx_trace_stream_buffer_wraps - ((ULONG) 1);
+                }
+            }
+
+            /* Finally, setup the write function, which effectively enables streaming.  */
+            _tx_trace_stream_write_function =  stream_write_function;
+
+            /* Return success.  */
+            status =  TX_SUCCESS;
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return completion status.  */
+    return(status);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (stream_buffer_start != TX_NULL)
+    {
+
+        /* Trace streaming not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (stream_buffer_size == ((ULONG) 0))
+    {
+
+        /* Trace streaming not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (stream_write_function != TX_NULL)
+    {
+
+        /* Trace streaming not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Trace streaming not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
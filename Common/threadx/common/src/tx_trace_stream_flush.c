@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Trace                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+
+
+#if defined(TX_ENABLE_EVENT_TRACE) && defined(TX_TRACE_ENABLE_STREAMING)
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_trace_stream_flush                              PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function hands the records in the stream buffer to the write   */
+/*    function of the application and empties the stream buffer. If the   */
+/*    write fails, the events in the stream buffer are counted as         */
+/*    dropped.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                 Status of the write function      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    (_tx_trace_stream_write_function) Write the records                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_trace_stream_drain            Drain the trace buffer            */
+/*    _tx_trace_stream_disable          Disable streaming                 */
+/*    _tx_trace_stream_registry_send    Send registry entries             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_trace_stream_flush(VOID)
+{
+
+ULONG       size;
+UINT        status;
+
+
+    /* Pickup the number of bytes in the stream buffer.  */
+    size =  (ULONG) (_tx_trace_stream_buffer_current - _tx_trace_stream_buffer_start);
+
+    /* Default to success.  */
+    status =  TX_SUCCESS;
+
+    /* Determine if there is anything to write.  */
+    if (size != ((ULONG) 0))
+    {
+
+        /* Write the records.  */
+        status =  (_tx_trace_stream_write_function)(_tx_trace_stream_buffer_start, size);
+
+        /* Determine if the write was successful.  */
+        if (status == TX_SUCCESS)
+        {
+
+            /* Yes, the events are streamed.  */
+            _tx_trace_stream_events =  _tx_trace_stream_events + _tx_trace_stream_buffer_events;
+            _tx_trace_stream_bytes =   _tx_trace_stream_bytes + size;
+        }
+        else
+        {
+
+            /* No, the events are lost.  */
+            _tx_trace_stream_dropped =  _tx_trace_stream_dropped + _tx_trace_stream_buffer_events;
+        }
+
+        /* The stream buffer is empty.  */
+        _tx_trace_stream_buffer_current =  _tx_trace_stream_buffer_start;
+        _tx_trace_stream_buffer_events =   ((ULONG) 0);
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+#endif
@@ -0,0 +1,149 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Trace                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_trace_stream_info_get                           PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the statistics of the trace stream. Events  */
+/*    are counted as streamed once they have been written. Events that    */
+/*    were overwritten in the trace buffer before being drained, or whose */
+/*    write failed, are counted as dropped.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    events_streamed                   Destination for the number of     */
+/*                                        events written                  */
+/*    events_dropped                    Destination for the number of     */
+/*                                        events dropped                  */
+/*    bytes_streamed                    Destination for the number of     */
+/*                                        bytes written                   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                                                   */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_trace_stream_info_get(ULONG *events_streamed, ULONG *events_dropped, ULONG *bytes_streamed)
+{
+
+#if defined(TX_ENABLE_EVENT_TRACE) && defined(TX_TRACE_ENABLE_STREAMING)
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Retrieve the number of events written.  */
+    if (events_streamed != TX_NULL)
+    {
+
+        *events_streamed =  _tx_trace_stream_events;
+    }
+
+    /* Retrieve the number of events dropped.  */
+    if (events_dropped != TX_NULL)
+    {
+
+        *events_dropped =  _tx_trace_stream_dropped;
+    }
+
+    /* Retrieve the number of bytes written.  */
+    if (bytes_streamed != TX_NULL)
+    {
+
+        *bytes_streamed =  _tx_trace_stream_bytes;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+
+#else
+
+UINT        status;
+
+
+    /* Access input arguments just for the sake of lint, MISRA, etc.  */
+    if (events_streamed != TX_NULL)
+    {
+
+        /* Trace streaming not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (events_dropped != TX_NULL)
+    {
+
+        /* Trace streaming not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else if (bytes_streamed != TX_NULL)
+    {
+
+        /* Trace streaming not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+    else
+    {
+
+        /* Trace streaming not enabled, return an error.  */
+        status =  TX_FEATURE_NOT_ENABLED;
+    }
+
+    /* Return completion status.  */
+    return(status);
+#endif
+}
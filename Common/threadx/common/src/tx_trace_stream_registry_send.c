@@ -0,0 +1,160 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Trace                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_trace.h"
+
+
+#if defined(TX_ENABLE_EVENT_TRACE) && defined(TX_TRACE_ENABLE_STREAMING)
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_trace_stream_registry_send                      PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function encodes an object record for the objects in the trace */
+/*    registry, so the stream can be decoded without the trace buffer. If */
+/*    the object pointer is zero, every object is sent. Otherwise, only   */
+/*    the object with that pointer is sent.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    object_pointer                    Object to send, zero for all      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    Completion Status                 Status of the write function      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_trace_stream_flush            Write the stream buffer           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_trace_stream_drain            Drain the trace buffer            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_trace_stream_registry_send(ULONG object_pointer)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_TRACE_OBJECT_ENTRY       entry;
+TX_TRACE_OBJECT_ENTRY       *entry_ptr;
+UCHAR                       *work_ptr;
+ULONG                       i;
+ULONG                       entries;
+UINT                        name_index;
+UINT                        status;
+
+
+    /* Default to success.  */
+    status =  TX_SUCCESS;
+
+    /* Loop through the registry.  */
+    i =        ((ULONG) 0);
+    entries =  _tx_trace_total_registry_entries;
+    while ((i < entries) && (status == TX_SUCCESS))
+    {
+
+        /* Disable interrupts.  */
+        TX_DISABLE
+
+        /* Copy the registry entry, which may be changed by an object create or delete.  */
+        work_ptr =   TX_OBJECT_TO_UCHAR_POINTER_CONVERT(_tx_trace_registry_start_ptr);
+        work_ptr =   TX_UCHAR_POINTER_ADD(work_ptr, ((sizeof(TX_TRACE_OBJECT_ENTRY))*i));
+        entry_ptr =  TX_UCHAR_TO_OBJECT_POINTER_CONVERT(work_ptr);
+        entry =      *entry_ptr;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Determine if this entry is an object to send.  */
+        if ((entry.tx_trace_object_entry_available == ((UCHAR) TX_FALSE)) &&
+            ((object_pointer == ((ULONG) 0)) || (entry.tx_trace_object_entry_thread_pointer == object_pointer)))
+        {
+
+            /* Make room for the record.  */
+            if (((ULONG) (_tx_trace_stream_buffer_end - _tx_trace_stream_buffer_current)) < TX_TRACE_STREAM_RECORD_MAX)
+            {
+
+                /* Write the stream buffer.  */
+                status =  _tx_trace_stream_flush();
+            }
+
+            /* Encode the object record.  */
+            *_tx_trace_stream_buffer_current =  TX_TRACE_STREAM_RECORD_OBJECT;
+            _tx_trace_stream_buffer_current++;
+            TX_TRACE_STREAM_VALUE_PUT(entry.tx_trace_object_entry_thread_pointer)
+            *_tx_trace_stream_buffer_current =  entry.tx_trace_object_entry_type;
+            _tx_trace_stream_buffer_current++;
+            TX_TRACE_STREAM_VALUE_PUT(entry.tx_trace_object_entry_param_1)
+            TX_TRACE_STREAM_VALUE_PUT(entry.tx_trace_object_entry_param_2)
+
+            /* Copy the name, which is always NUL-terminated in the stream.  */
+            name_index =  ((UINT) 0);
+            while ((name_index < (TX_TRACE_OBJECT_REGISTRY_NAME - 1)) && (entry.tx_trace_object_entry_name[name_index] != ((UCHAR) 0)))
+            {
+
+                *_tx_trace_stream_buffer_current =  entry.tx_trace_object_entry_name[name_index];
+                _tx_trace_stream_buffer_current++;
+                name_index++;
+            }
+            *_tx_trace_stream_buffer_current =  ((UCHAR) 0);
+            _tx_trace_stream_buffer_current++;
+
+            /* Determine if only this object is sent.  */
+            if (object_pointer != ((ULONG) 0))
+            {
+
+                /* Yes, the object is found, end the search.  */
+                i =  entries;
+            }
+        }
+
+        /* Move to the next entry.  */
+        i++;
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+#endif
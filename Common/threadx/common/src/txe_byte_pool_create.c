@@ -178,6 +178,17 @@ TX_THREAD       *thread_ptr;
             /* Pool not big enough, return appropriate error.  */
             status =  TX_SIZE_ERROR;
         }
+
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+
+        /* Check for a pool larger than the largest TLSF size class.  */
+        else if (pool_size > TX_BYTE_POOL_TLSF_BLOCK_MAX)
+        {
+
+            /* Pool too big, return appropriate error.  */
+            status =  TX_SIZE_ERROR;
+        }
+#endif
         else
         {
 
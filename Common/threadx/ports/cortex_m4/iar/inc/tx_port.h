@@ -409,6 +409,7 @@ ULONG   _tx_misra_ipsr_get(VOID);
 #ifndef TX_DISABLE_INLINE
 
 #define TX_LOWEST_SET_BIT_CALCULATE(m, b)       (b) = (UINT)__CLZ(__RBIT((m)));
+#define TX_BYTE_POOL_HIGHEST_SET_BIT_CALCULATE(m, b)    (b) = ((UINT) 31) - (UINT)__CLZ((m));
 
 #endif
 
@@ -28,6 +28,10 @@
     EXTERN  _tx_execution_thread_enter
     EXTERN  _tx_execution_thread_exit
     EXTERN  _tx_thread_preempt_disable
+#ifdef TX_LOW_POWER
+    EXTERN  _tx_timer_low_power_enter
+    EXTERN  _tx_timer_low_power_exit
+#endif
 ;
 ;
     SECTION `.text`:CODE:NOROOT(2)
@@ -58,7 +62,8 @@
 ;/*                                                                        */
 ;/*  CALLS                                                                 */
 ;/*                                                                        */
-;/*    None                                                                */
+;/*    _tx_timer_low_power_enter            Suppress the timer interrupt   */
+;/*    _tx_timer_low_power_exit             Account for suppressed ticks   */
 ;/*                                                                        */
 ;/*  CALLED BY                                                             */
 ;/*                                                                        */
@@ -236,10 +241,21 @@ __tx_ts_wait:
     LDR     r1, [r2]                                ; Pickup the next thread to execute pointer
     STR     r1, [r0]                                ; Store it in the current pointer
     CBNZ    r1, __tx_ts_ready                       ; If non-NULL, a new thread is ready!
+#ifdef TX_LOW_POWER
+    PUSH    {r0-r3}                                 ; Save scratch registers
+    BL      _tx_timer_low_power_enter               ; Suppress the timer interrupt, if possible
+    POP     {r0-r3}                                 ; Recover scratch registers
+#endif
 #ifdef TX_ENABLE_WFI
     DSB                                             ; Ensure no outstanding memory transactions
     WFI                                             ; Wait for interrupt
     ISB                                             ; Ensure pipeline is flushed
+#endif
+#ifdef TX_LOW_POWER
+    PUSH    {r0-r3}                                 ; Save scratch registers
+    BL      _tx_timer_low_power_exit                ; Account for suppressed ticks before the
+                                                    ;   interrupt is processed
+    POP     {r0-r3}                                 ; Recover scratch registers
 #endif
     CPSIE   i                                       ; Enable interrupts
     B       __tx_ts_wait                            ; Loop to continue waiting
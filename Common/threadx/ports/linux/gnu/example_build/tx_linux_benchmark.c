@@ -0,0 +1,1552 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This is a smoke benchmark of the ThreadX Linux port. It measures cooperative context switches,
+   semaphore ping-pong between two threads, message queue throughput, the throughput of pointers
+   sent one at a time with tx_queue_send and in batches of 1, 4 and 16 with tx_queue_pointer_send,
+   and the hand-off of a contended mutex, each for about one second of host time, and checks that
+   the timer interrupt keeps time while they run. It then measures the latency from setting an
+   event flag to the thread waiting for it running, with 1, 8 and 32 threads each waiting for
+   their own flag, and the cost of setting a flag none of them waits for. When
+   TX_LOW_POWER is defined, it also checks that idle sleeps keep time while the timer interrupt
+   is suppressed, and counts the suppressed ticks. When TX_ENABLE_EXECUTION_CHANGE_NOTIFY is
+   defined, it runs workers that are busy part of the time and checks that the execution profile
+   kit accounts for the host time, and for the time each worker was busy. When
+   TX_TRACE_ENABLE_STREAMING is defined, the trace is enabled and a stream thread drains it to the
+   file tx_trace_stream.bin every tick while the tests run, so the tests also measure the cost of
+   streaming. The file is decoded by utility/trace_stream/tx_trace_stream_decode. The port only
+   supports the trace on 32-bit hosts, because the trace keeps pointers in ULONGs. When
+   TX_THREAD_ENABLE_STACK_MONITOR is defined, it marks single words deep in the worker stacks,
+   which the Linux port does not otherwise use, and checks that the stack monitor finds the exact
+   high-water marks and notifies the low headroom once per new mark. When
+   TX_MUTEX_ENABLE_CONTENTION_PROFILE is defined, it checks and prints the contention profile of
+   the contended mutex, so the mutex test also measures the cost of the profile. When
+   TX_ENABLE_OBJECT_POOL is defined, it churns objects of 24, 80 and 200 bytes through a byte pool
+   and through an object pool per size, in the same memory, and compares the cost of allocate and
+   free, the failures and the fragments of the byte pool, and checks the object pool statistics
+   and that frees to the wrong pool and double frees are rejected. It also runs 100 periodic
+   timers of up to three times the ticks of the test for two seconds, and checks that each expires
+   on its tick and that the remaining ticks reported by tx_timer_info_get and kept by a
+   deactivation match. The ticks are those of the timer list, which loses a tick for good when the
+   host delays the timer thread past the next tick, and the lost ticks are printed. The timers
+   longer than the timer list are on the cascade wheels when TX_TIMER_ENABLE_HIERARCHICAL_WHEEL is
+   defined. When TX_TIMER_ENABLE_PERFORMANCE_INFO is defined, it prints the most timers handled in
+   one tick. It then accounts for 100 ticks at once with _tx_time_increment, and checks that the
+   timer list advances over all of them, expiring the three timers passed, and that a timer after
+   them keeps its tick. Finally, it stresses a byte pool with random allocations of 16 bytes to
+   5 KB, held in random slots, and walks the blocks of the pool every 997 allocations to check
+   their links, their owners, and the fragment and available counts. With TX_BYTE_POOL_ENABLE_TLSF
+   defined, the walk also checks that free blocks never neighbor each other and that the free lists
+   match their bitmaps. When TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO is defined, it prints the most
+   blocks one allocation examined.  */
+
+#include "tx_api.h"
+#include "tx_byte_pool.h"
+#include "tx_timer.h"
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+#include "tx_execution_profile.h"
+#endif
+#ifdef TX_ENABLE_OBJECT_POOL
+#include "tx_object_pool.h"
+#endif
+#include <stdio.h>
+#include <time.h>
+
+
+#define BENCHMARK_STACK_SIZE        1024
+#define BENCHMARK_QUEUE_MESSAGES    16
+#define BENCHMARK_POINTER_MESSAGES  256
+#define BENCHMARK_POINTER_BATCH     16
+#define BENCHMARK_POINTER_BUFFERS   512
+#define BENCHMARK_EVENT_THREADS     32
+#define BENCHMARK_EVENT_PRIORITY    9
+#define BENCHMARK_EVENT_UNWATCHED   ((ULONG) 0x80000000UL)
+#define BENCHMARK_REPORT_PRIORITY   1
+#define BENCHMARK_WORKER_PRIORITY   10
+#define BENCHMARK_IDLE_SLEEPS       10
+#define BENCHMARK_IDLE_SLEEP_TICKS  50
+#define BENCHMARK_BUSY_TIME         0.003
+#define BENCHMARK_STREAM_PRIORITY   5
+#define BENCHMARK_TRACE_SIZE        (4 * 1024 * 1024)
+#define BENCHMARK_TRACE_REGISTRY    16
+#define BENCHMARK_STREAM_SIZE       (64 * 1024)
+#define BENCHMARK_STREAM_FILE       "tx_trace_stream.bin"
+#define BENCHMARK_MONITOR_SLICE     256
+#define BENCHMARK_MONITOR_HEADROOM  25
+#define BENCHMARK_MONITOR_DEEP      16
+#define BENCHMARK_MONITOR_DEEPER    8
+#define BENCHMARK_MONITOR_SHALLOW   200
+#define BENCHMARK_CHURN_CLASSES     3
+#define BENCHMARK_CHURN_SLOTS       64
+#define BENCHMARK_CHURN_OPERATIONS  1000000
+#define BENCHMARK_WHEEL_TIMERS      100
+#define BENCHMARK_WHEEL_TICKS       (2 * TX_TIMER_TICKS_PER_SECOND)
+#define BENCHMARK_INCREMENT_TIMERS  3
+#define BENCHMARK_INCREMENT_TICKS   100
+#define BENCHMARK_STRESS_POOL_SIZE  (256 * 1024)
+#define BENCHMARK_STRESS_SLOTS      512
+#define BENCHMARK_STRESS_OPERATIONS 400000
+#define BENCHMARK_STRESS_WALK       997
+
+
+/* Define the ThreadX objects used by the benchmark.  */
+
+TX_THREAD               report_thread;
+TX_THREAD               worker_thread_0;
+TX_THREAD               worker_thread_1;
+TX_SEMAPHORE            ping_semaphore;
+TX_SEMAPHORE            pong_semaphore;
+TX_QUEUE                message_queue;
+TX_QUEUE                pointer_queue;
+TX_MUTEX                contended_mutex;
+TX_EVENT_FLAGS_GROUP    event_group;
+TX_THREAD               event_thread[BENCHMARK_EVENT_THREADS];
+
+
+/* Define the thread stacks, the queue storage and the buffers whose pointers are passed.  */
+
+ULONG                   report_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+ULONG                   worker_stack_0[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+ULONG                   worker_stack_1[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+ULONG                   queue_storage[BENCHMARK_QUEUE_MESSAGES * TX_4_ULONG];
+VOID                   *pointer_storage[BENCHMARK_POINTER_MESSAGES];
+ULONG                   pointer_buffers[BENCHMARK_POINTER_BUFFERS][TX_4_ULONG];
+ULONG                   event_stack[BENCHMARK_EVENT_THREADS][BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+#ifdef TX_TRACE_ENABLE_STREAMING
+
+
+/* Define the stream thread, the trace buffer, the stream buffer and the stream file.  */
+
+TX_THREAD               stream_thread;
+ULONG                   stream_stack[BENCHMARK_STACK_SIZE / sizeof(ULONG)];
+ULONG                   trace_buffer[BENCHMARK_TRACE_SIZE / sizeof(ULONG)];
+UCHAR                   stream_buffer[BENCHMARK_STREAM_SIZE];
+FILE                   *stream_file;
+volatile ULONG          stream_stop;
+#endif
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+
+/* Define the low headroom notifications of each worker.  */
+
+volatile ULONG          monitor_notifications[2];
+volatile ULONG          monitor_notify_used;
+#endif
+#ifdef TX_ENABLE_OBJECT_POOL
+
+
+/* Define the object sizes of the churn, an object pool per size and a byte pool, each pool with room for
+   every slot. The byte pool gets the memory of all the object pools.  */
+
+static const ULONG      churn_sizes[BENCHMARK_CHURN_CLASSES] =  { 24, 80, 200 };
+static CHAR             *churn_names[BENCHMARK_CHURN_CLASSES] =  { "small", "medium", "large" };
+TX_OBJECT_POOL          churn_object_pool[BENCHMARK_CHURN_CLASSES];
+TX_BYTE_POOL            churn_byte_pool;
+ULONG                   churn_small_memory[BENCHMARK_CHURN_SLOTS * ((24 + sizeof(VOID *)) / sizeof(ULONG))];
+ULONG                   churn_medium_memory[BENCHMARK_CHURN_SLOTS * ((80 + sizeof(VOID *)) / sizeof(ULONG))];
+ULONG                   churn_large_memory[BENCHMARK_CHURN_SLOTS * ((200 + sizeof(VOID *)) / sizeof(ULONG))];
+ULONG                   churn_byte_memory[(sizeof(churn_small_memory) + sizeof(churn_medium_memory) +
+                                           sizeof(churn_large_memory)) / sizeof(ULONG)];
+VOID                    *churn_slots[BENCHMARK_CHURN_SLOTS];
+UINT                    churn_slot_class[BENCHMARK_CHURN_SLOTS];
+#endif
+
+
+/* Define the timers of the wheel test, the tick each expires next and its period.  */
+
+TX_TIMER                wheel_timer[BENCHMARK_WHEEL_TIMERS];
+volatile ULONG          wheel_expected[BENCHMARK_WHEEL_TIMERS];
+ULONG                   wheel_period[BENCHMARK_WHEEL_TIMERS];
+volatile ULONG          wheel_expirations;
+volatile ULONG          wheel_lag;
+ULONG                   wheel_offset;
+
+
+/* Define the ticks of the timers that a single time increment passes, and their expirations.  */
+
+static const ULONG      increment_ticks[BENCHMARK_INCREMENT_TIMERS] =  { 5, 40, 70 };
+volatile ULONG          increment_expirations;
+
+
+/* Define the byte pool of the stress, and its slots.  */
+
+TX_BYTE_POOL            stress_pool;
+ULONG                   stress_memory[BENCHMARK_STRESS_POOL_SIZE / sizeof(ULONG)];
+VOID                    *stress_slots[BENCHMARK_STRESS_SLOTS];
+
+
+/* Define the benchmark counters.  */
+
+volatile ULONG          benchmark_test;
+volatile ULONG          benchmark_count;
+volatile ULONG          benchmark_errors;
+double                  benchmark_busy_time[2];
+volatile ULONG          event_waiters;
+volatile ULONG          event_wakes;
+volatile double         event_set_time;
+double                  event_wake_time;
+double                  event_unwatched_time;
+
+
+/* Define the benchmark tests.  */
+
+#define BENCHMARK_CONTEXT_SWITCH    0
+#define BENCHMARK_SEMAPHORE         1
+#define BENCHMARK_QUEUE             2
+#define BENCHMARK_POINTER_QUEUE     3
+#define BENCHMARK_POINTER_1         4
+#define BENCHMARK_POINTER_4         5
+#define BENCHMARK_POINTER_16        6
+#define BENCHMARK_MUTEX             7
+#define BENCHMARK_PROFILE           8
+#define BENCHMARK_EVENTS            9
+
+
+/* Define thread prototypes.  */
+
+void    report_thread_entry(ULONG thread_input);
+void    worker_thread_entry(ULONG thread_input);
+void    event_thread_entry(ULONG thread_input);
+static VOID    wheel_timer_expire(ULONG timer_input);
+static ULONG   wheel_time_get(VOID);
+static VOID    increment_timer_expire(ULONG timer_input);
+#ifdef TX_TRACE_ENABLE_STREAMING
+void    stream_thread_entry(ULONG thread_input);
+static UINT    stream_write(UCHAR *data, ULONG size);
+#endif
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+static VOID    monitor_notify(TX_THREAD *thread_ptr, ULONG stack_used);
+static ULONG   monitor_rounds_wait(ULONG rounds);
+#endif
+#ifdef TX_ENABLE_OBJECT_POOL
+static ULONG   churn_run(UINT objects, ULONG *fragments);
+#endif
+static ULONG   stress_run(ULONG *worst_search);
+static ULONG   stress_walk(VOID);
+static ULONG   stress_largest_get(VOID);
+static double  benchmark_time_get(void);
+
+
+/* Define main entry point.  */
+
+int main(void)
+{
+
+    /* Enter the ThreadX kernel.  */
+    tx_kernel_enter();
+    return(0);
+}
+
+
+/* Define what the initial system looks like.  */
+
+void    tx_application_define(void *first_unused_memory)
+{
+
+ULONG   index;
+
+
+    (void) first_unused_memory;
+
+#ifdef TX_TRACE_ENABLE_STREAMING
+
+    /* Enable the trace before the objects are created, so they are registered, and stream it to a file.  */
+    stream_file =  fopen(BENCHMARK_STREAM_FILE, "wb");
+    if ((stream_file == NULL) ||
+        (tx_trace_enable(trace_buffer, sizeof(trace_buffer), BENCHMARK_TRACE_REGISTRY) != TX_SUCCESS) ||
+        (tx_trace_stream_enable(stream_buffer, sizeof(stream_buffer), stream_write) != TX_SUCCESS))
+    {
+        benchmark_errors++;
+    }
+
+    /* Create the stream thread, which drains the trace every tick.  */
+    tx_thread_create(&stream_thread, "stream", stream_thread_entry, 0,
+                     stream_stack, sizeof(stream_stack),
+                     BENCHMARK_STREAM_PRIORITY, BENCHMARK_STREAM_PRIORITY, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+#endif
+    /* Create the reporting thread, which runs the tests one after the other.  */
+    tx_thread_create(&report_thread, "report", report_thread_entry, 0,
+                     report_stack, sizeof(report_stack),
+                     BENCHMARK_REPORT_PRIORITY, BENCHMARK_REPORT_PRIORITY, TX_NO_TIME_SLICE, TX_AUTO_START);
+
+    /* Create the two worker threads, started by the reporting thread.  */
+    tx_thread_create(&worker_thread_0, "worker 0", worker_thread_entry, 0,
+                     worker_stack_0, sizeof(worker_stack_0),
+                     BENCHMARK_WORKER_PRIORITY, BENCHMARK_WORKER_PRIORITY, TX_NO_TIME_SLICE, TX_DONT_START);
+    tx_thread_create(&worker_thread_1, "worker 1", worker_thread_entry, 1,
+                     worker_stack_1, sizeof(worker_stack_1),
+                     BENCHMARK_WORKER_PRIORITY, BENCHMARK_WORKER_PRIORITY, TX_NO_TIME_SLICE, TX_DONT_START);
+
+    /* Create the event threads, which wait for their own event flag while they run.  */
+    for (index = 0; index < BENCHMARK_EVENT_THREADS; index++)
+    {
+        tx_thread_create(&event_thread[index], "event", event_thread_entry, index,
+                         event_stack[index], sizeof(event_stack[index]),
+                         BENCHMARK_EVENT_PRIORITY, BENCHMARK_EVENT_PRIORITY, TX_NO_TIME_SLICE, TX_DONT_START);
+    }
+
+    /* Create the semaphores and the queues.  */
+    tx_semaphore_create(&ping_semaphore, "ping", 0);
+    tx_semaphore_create(&pong_semaphore, "pong", 0);
+    tx_queue_create(&message_queue, "messages", TX_4_ULONG, queue_storage, sizeof(queue_storage));
+    tx_queue_create(&pointer_queue, "pointers", TX_POINTER_ULONG, pointer_storage, sizeof(pointer_storage));
+
+    /* Create the mutex the workers contend for, with priority inheritance.  */
+    tx_mutex_create(&contended_mutex, "contended", TX_INHERIT);
+
+    /* Create the event flags group of the event threads.  */
+    tx_event_flags_create(&event_group, "events");
+
+    /* Create the byte pool of the stress.  */
+    if (tx_byte_pool_create(&stress_pool, "stress", stress_memory, sizeof(stress_memory)) != TX_SUCCESS)
+    {
+        benchmark_errors++;
+    }
+#ifdef TX_ENABLE_OBJECT_POOL
+
+    /* Create the object pools and the byte pool of the churn.  */
+    if ((_tx_object_pool_create(&churn_object_pool[0], churn_names[0], churn_sizes[0], churn_small_memory, sizeof(churn_small_memory)) != TX_SUCCESS) ||
+        (_tx_object_pool_create(&churn_object_pool[1], churn_names[1], churn_sizes[1], churn_medium_memory, sizeof(churn_medium_memory)) != TX_SUCCESS) ||
+        (_tx_object_pool_create(&churn_object_pool[2], churn_names[2], churn_sizes[2], churn_large_memory, sizeof(churn_large_memory)) != TX_SUCCESS) ||
+        (tx_byte_pool_create(&churn_byte_pool, "churn", churn_byte_memory, sizeof(churn_byte_memory)) != TX_SUCCESS))
+    {
+        benchmark_errors++;
+    }
+#endif
+}
+
+
+/* Define the worker threads. Worker 0 drives each test and counts its iterations.  */
+
+void    worker_thread_entry(ULONG thread_input)
+{
+
+ULONG   message[TX_4_ULONG];
+VOID   *pointers[BENCHMARK_POINTER_BATCH];
+UINT    batch;
+UINT    actual;
+UINT    index;
+ULONG   sequence =  0;
+double  start;
+
+
+    while (1)
+    {
+
+        switch (benchmark_test)
+        {
+
+        case BENCHMARK_CONTEXT_SWITCH:
+
+            /* Give the processor to the other worker.  */
+            tx_thread_relinquish();
+            if (thread_input == 0)
+            {
+                benchmark_count++;
+            }
+            break;
+
+        case BENCHMARK_SEMAPHORE:
+
+            if (thread_input == 0)
+            {
+
+                /* Ping the other worker and wait for its answer.  */
+                tx_semaphore_put(&ping_semaphore);
+                if (tx_semaphore_get(&pong_semaphore, TX_WAIT_FOREVER) != TX_SUCCESS)
+                {
+                    benchmark_errors++;
+                }
+                benchmark_count++;
+            }
+            else
+            {
+
+                /* Answer each ping.  */
+                if (tx_semaphore_get(&ping_semaphore, TX_WAIT_FOREVER) != TX_SUCCESS)
+                {
+                    benchmark_errors++;
+                }
+                tx_semaphore_put(&pong_semaphore);
+            }
+            break;
+
+        case BENCHMARK_POINTER_QUEUE:
+
+            if (thread_input == 0)
+            {
+
+                /* Send the pointer to the next buffer, one at a time.  */
+                pointers[0] =  pointer_buffers[sequence % BENCHMARK_POINTER_BUFFERS];
+                if (tx_queue_send(&pointer_queue, pointers, TX_WAIT_FOREVER) != TX_SUCCESS)
+                {
+                    benchmark_errors++;
+                }
+                sequence++;
+            }
+            else
+            {
+
+                /* Receive the next pointer and check that none was lost.  */
+                if ((tx_queue_receive(&pointer_queue, pointers, TX_WAIT_FOREVER) != TX_SUCCESS) ||
+                    (pointers[0] != pointer_buffers[sequence % BENCHMARK_POINTER_BUFFERS]))
+                {
+                    benchmark_errors++;
+                }
+                sequence++;
+                benchmark_count++;
+            }
+            break;
+
+        case BENCHMARK_POINTER_1:
+        case BENCHMARK_POINTER_4:
+        case BENCHMARK_POINTER_16:
+
+            /* Pass 1, 4 or 16 pointers per call.  */
+            batch =  ((UINT) 1) << (2 * (benchmark_test - BENCHMARK_POINTER_1));
+            if (thread_input == 0)
+            {
+
+                /* Send the pointers to the next buffers. The pointers that are not sent are sent again.  */
+                for (index = 0; index < batch; index++)
+                {
+                    pointers[index] =  pointer_buffers[(sequence + index) % BENCHMARK_POINTER_BUFFERS];
+                }
+                if (tx_queue_pointer_send(&pointer_queue, pointers, batch, &actual, TX_WAIT_FOREVER) != TX_SUCCESS)
+                {
+                    benchmark_errors++;
+                }
+                sequence =  sequence + actual;
+            }
+            else
+            {
+
+                /* Receive the next pointers and check that none was lost.  */
+                if (tx_queue_pointer_receive(&pointer_queue, pointers, batch, &actual, TX_WAIT_FOREVER) != TX_SUCCESS)
+                {
+                    benchmark_errors++;
+                }
+                for (index = 0; index < actual; index++)
+                {
+                    if (pointers[index] != pointer_buffers[sequence % BENCHMARK_POINTER_BUFFERS])
+                    {
+                        benchmark_errors++;
+                    }
+                    sequence++;
+                }
+                benchmark_count =  benchmark_count + actual;
+            }
+            break;
+
+        case BENCHMARK_MUTEX:
+
+            /* Hold the mutex while giving the processor to the other worker, which then waits for it, so
+               every put hands the mutex to the other worker.  */
+            if (tx_mutex_get(&contended_mutex, TX_WAIT_FOREVER) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+            }
+            tx_thread_relinquish();
+            if (tx_mutex_put(&contended_mutex) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+            }
+            if (thread_input == 0)
+            {
+                benchmark_count++;
+            }
+            break;
+
+        case BENCHMARK_EVENTS:
+
+            /* Set the flag of the next event thread, which runs at once, then set a flag none of them
+               waits for, if there is one. The first call after the event thread gives the processor
+               back also waits for its host thread to block, so the second one is measured.  */
+            event_set_time =  benchmark_time_get();
+            if (tx_event_flags_set(&event_group, ((ULONG) 1) << (sequence % event_waiters), TX_OR) != TX_SUCCESS)
+            {
+                benchmark_errors++;
+            }
+            if (event_waiters < BENCHMARK_EVENT_THREADS)
+            {
+                tx_event_flags_set(&event_group, BENCHMARK_EVENT_UNWATCHED, TX_OR);
+                start =  benchmark_time_get();
+                tx_event_flags_set(&event_group, BENCHMARK_EVENT_UNWATCHED, TX_OR);
+                event_unwatched_time =  event_unwatched_time + (benchmark_time_get() - start);
+            }
+            sequence++;
+            benchmark_count++;
+            break;
+
+        case BENCHMARK_PROFILE:
+
+            /* Be busy for a while, then sleep for a tick.  */
+            start =  benchmark_time_get();
+            while ((benchmark_time_get() - start) < BENCHMARK_BUSY_TIME)
+            {
+            }
+            benchmark_busy_time[thread_input] =  benchmark_busy_time[thread_input] + (benchmark_time_get() - start);
+            if (thread_input == 0)
+            {
+                benchmark_count++;
+            }
+            tx_thread_sleep(1);
+            break;
+
+        default:
+
+            if (thread_input == 0)
+            {
+
+                /* Send the next message.  */
+                message[0] =  sequence++;
+                message[1] =  ~message[0];
+                message[2] =  0;
+                message[3] =  0;
+                if (tx_queue_send(&message_queue, message, TX_WAIT_FOREVER) != TX_SUCCESS)
+                {
+                    benchmark_errors++;
+                }
+            }
+            else
+            {
+
+                /* Receive the next message and check that none was lost or damaged.  */
+                if ((tx_queue_receive(&message_queue, message, TX_WAIT_FOREVER) != TX_SUCCESS) ||
+                    (message[0] != sequence) || (message[1] != ~sequence))
+                {
+                    benchmark_errors++;
+                }
+                sequence++;
+                benchmark_count++;
+            }
+            break;
+        }
+    }
+}
+
+
+/* Define the event threads. Each waits for its own event flag and measures how long it took to run
+   after the flag was set.  */
+
+void    event_thread_entry(ULONG thread_input)
+{
+
+ULONG   flag =  ((ULONG) 1) << thread_input;
+ULONG   actual_flags;
+
+
+    while (1)
+    {
+
+        if ((tx_event_flags_get(&event_group, flag, TX_OR_CLEAR, &actual_flags, TX_WAIT_FOREVER) != TX_SUCCESS) ||
+            ((actual_flags & flag) == 0))
+        {
+            benchmark_errors++;
+        }
+        event_wake_time =  event_wake_time + (benchmark_time_get() - event_set_time);
+        event_wakes++;
+    }
+}
+
+
+#ifdef TX_TRACE_ENABLE_STREAMING
+
+/* Define the stream thread.  */
+
+void    stream_thread_entry(ULONG thread_input)
+{
+
+    (void) thread_input;
+
+    while (stream_stop == 0)
+    {
+
+        /* Drain the events of the last tick.  */
+        if (tx_trace_stream_drain(TX_NULL) != TX_SUCCESS)
+        {
+            benchmark_errors++;
+        }
+        tx_thread_sleep(1);
+    }
+
+    /* Drain the last events and stop the stream, which writes the rest of the stream buffer.  */
+    if ((tx_trace_stream_drain(TX_NULL) != TX_SUCCESS) || (tx_trace_stream_disable() != TX_SUCCESS) ||
+        (fclose(stream_file) != 0))
+    {
+        benchmark_errors++;
+    }
+}
+
+
+/* Define the write function of the stream, which appends to the stream file.  */
+
+static UINT    stream_write(UCHAR *data, ULONG size)
+{
+
+    if (fwrite(data, 1, size, stream_file) != size)
+    {
+        return(TX_NOT_DONE);
+    }
+    return(TX_SUCCESS);
+}
+
+
+#endif
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+/* Define the low headroom notification, called from the timer thread.  */
+
+static VOID    monitor_notify(TX_THREAD *thread_ptr, ULONG stack_used)
+{
+
+    if (thread_ptr == &worker_thread_0)
+    {
+        monitor_notifications[0]++;
+    }
+    else if (thread_ptr == &worker_thread_1)
+    {
+        monitor_notifications[1]++;
+    }
+    else
+    {
+        benchmark_errors++;
+    }
+    monitor_notify_used =  stack_used;
+}
+
+
+/* Wait for two more complete scans, so marks made before the call are found, and return the scans.  */
+
+static ULONG   monitor_rounds_wait(ULONG rounds)
+{
+
+ULONG   now;
+
+
+    do
+    {
+        tx_thread_sleep(1);
+        tx_thread_stack_monitor_info_get(TX_NULL, TX_NULL, TX_NULL, &now);
+    } while (now < (rounds + 2));
+    return(now);
+}
+
+
+#endif
+#ifdef TX_ENABLE_OBJECT_POOL
+/* Define the churn, which frees the object in a random slot, or allocates one of a random size when the slot
+   is empty, from the object pools or from the byte pool. It returns the number of failed allocations, and the
+   fragments of the byte pool before the objects left are freed.  */
+
+static ULONG   churn_run(UINT objects, ULONG *fragments)
+{
+
+ULONG   random;
+ULONG   operation;
+ULONG   failures;
+UINT    slot;
+UINT    status;
+
+
+    random =    0x12345678UL;
+    failures =  0;
+    for (operation = 0; operation <= BENCHMARK_CHURN_OPERATIONS; operation++)
+    {
+
+        /* Pick a slot and a size, or free all the slots once the churn is done.  */
+        random =  (random * 1664525UL) + 1013904223UL;
+        slot =    (UINT) ((random >> 16) % BENCHMARK_CHURN_SLOTS);
+        if (operation == BENCHMARK_CHURN_OPERATIONS)
+        {
+            tx_byte_pool_info_get(&churn_byte_pool, TX_NULL, TX_NULL, fragments, TX_NULL, TX_NULL, TX_NULL);
+            for (slot = 0; slot < BENCHMARK_CHURN_SLOTS; slot++)
+            {
+                if (churn_slots[slot] != TX_NULL)
+                {
+                    status =  (objects != 0) ? _tx_object_free(&churn_object_pool[churn_slot_class[slot]], churn_slots[slot]) :
+                                               tx_byte_release(churn_slots[slot]);
+                    benchmark_errors +=  (status != TX_SUCCESS) ? 1 : 0;
+                    churn_slots[slot] =  TX_NULL;
+                }
+            }
+        }
+        else if (churn_slots[slot] != TX_NULL)
+        {
+            status =  (objects != 0) ? _tx_object_free(&churn_object_pool[churn_slot_class[slot]], churn_slots[slot]) :
+                                       tx_byte_release(churn_slots[slot]);
+            benchmark_errors +=  (status != TX_SUCCESS) ? 1 : 0;
+            churn_slots[slot] =  TX_NULL;
+        }
+        else
+        {
+            churn_slot_class[slot] =  (UINT) ((random >> 8) % BENCHMARK_CHURN_CLASSES);
+            status =  (objects != 0) ? _tx_object_allocate(&churn_object_pool[churn_slot_class[slot]], &churn_slots[slot], TX_NO_WAIT) :
+                                       tx_byte_allocate(&churn_byte_pool, &churn_slots[slot], churn_sizes[churn_slot_class[slot]], TX_NO_WAIT);
+            if (status != TX_SUCCESS)
+            {
+                churn_slots[slot] =  TX_NULL;
+                failures++;
+            }
+        }
+    }
+    return(failures);
+}
+
+
+#endif
+/* Define the expiration of the timers of the wheel test, which must be on the tick of the timer list expected.  */
+
+static VOID    wheel_timer_expire(ULONG timer_input)
+{
+
+    if (wheel_time_get() != wheel_expected[timer_input])
+    {
+        benchmark_errors++;
+    }
+    wheel_expected[timer_input] =  wheel_expected[timer_input] + wheel_period[timer_input];
+    wheel_expirations++;
+}
+
+
+/* Define the expiration of the timers that a single time increment passes, which are late by design.  */
+
+static VOID    increment_timer_expire(ULONG timer_input)
+{
+
+    (void) timer_input;
+    increment_expirations++;
+}
+
+
+/* Define the tick of the timer list, which is the clock less the ticks the list lags. A tick that comes while the
+   timer thread still processes the one before does not move the list, which then stays a tick behind the clock
+   for good. The timer thread moves the list before it calls the expirations, so the tick is the same from the
+   timer thread and from an idle system.  */
+
+static ULONG   wheel_time_get(VOID)
+{
+
+ULONG   time;
+ULONG   lag;
+
+
+    time =  tx_time_get();
+    lag =   ((time - (ULONG) (_tx_timer_current_ptr - _tx_timer_list_start)) - wheel_offset) % TX_TIMER_ENTRIES;
+    if (lag > wheel_lag)
+    {
+        wheel_lag =  lag;
+    }
+    return(time - lag);
+}
+
+
+/* Define the stress, which frees the block in a random slot, if any, and allocates a block of a random size
+   into it, mostly small blocks and some of up to 5 KB, and walks the pool every BENCHMARK_STRESS_WALK
+   allocations. It returns the number of failed allocations, and the most blocks one allocation examined.  */
+
+static ULONG   stress_run(ULONG *worst_search)
+{
+
+ULONG   random;
+ULONG   operation;
+ULONG   failures;
+ULONG   size;
+UINT    slot;
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+ULONG   searches;
+#endif
+
+
+    random =         0x87654321UL;
+    failures =       0;
+    *worst_search =  0;
+    for (operation = 0; operation < BENCHMARK_STRESS_OPERATIONS; operation++)
+    {
+
+        /* Pick a slot and free its block.  */
+        random =  (random * 1664525UL) + 1013904223UL;
+        slot =    (UINT) ((random >> 16) % BENCHMARK_STRESS_SLOTS);
+        if (stress_slots[slot] != TX_NULL)
+        {
+            benchmark_errors +=  (tx_byte_release(stress_slots[slot]) != TX_SUCCESS) ? 1 : 0;
+            stress_slots[slot] =  TX_NULL;
+        }
+
+        /* Pick a size, 60% of 16 to 127 bytes, 30% of up to 1 KB and 10% of up to 5 KB.  */
+        random =  (random * 1664525UL) + 1013904223UL;
+        size =    (random >> 8) % 100;
+        random =  (random * 1664525UL) + 1013904223UL;
+        if (size < 60)
+        {
+            size =  16 + ((random >> 8) % 112);
+        }
+        else if (size < 90)
+        {
+            size =  128 + ((random >> 8) % 896);
+        }
+        else
+        {
+            size =  1024 + ((random >> 8) % 4096);
+        }
+
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+        searches =  stress_pool.tx_byte_pool_performance_search_count;
+#endif
+        if (tx_byte_allocate(&stress_pool, &stress_slots[slot], size, TX_NO_WAIT) != TX_SUCCESS)
+        {
+            stress_slots[slot] =  TX_NULL;
+            failures++;
+        }
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+        searches =  stress_pool.tx_byte_pool_performance_search_count - searches;
+        if (searches > *worst_search)
+        {
+            *worst_search =  searches;
+        }
+#endif
+
+        /* Walk the pool from time to time.  */
+        if ((operation % BENCHMARK_STRESS_WALK) == 0)
+        {
+            benchmark_errors +=  stress_walk();
+        }
+    }
+    return(failures);
+}
+
+
+/* Define the walk of the stress pool, which follows the blocks from the start of the pool to the block at its end,
+   and checks that every block is free or owned by the pool, and that the blocks and free bytes match the fragment
+   and available counts. A TLSF pool must also have merged every free block with its free neighbors, have the same
+   blocks on its free lists, and have the bitmaps of those lists right. It returns 1 if the pool is inconsistent.  */
+
+static ULONG   stress_walk(VOID)
+{
+
+UCHAR       *block_ptr;
+UCHAR       *next_ptr;
+UCHAR       *end_ptr;
+ULONG       blocks;
+ULONG       free_blocks;
+ULONG       free_bytes;
+UINT        block_free;
+UINT        errors;
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+UINT        previous_free;
+UCHAR       *previous_ptr;
+UCHAR       *list_ptr;
+ULONG       listed;
+UINT        first_level;
+UINT        second_level;
+#endif
+
+
+    block_ptr =      stress_pool.tx_byte_pool_list;
+    end_ptr =        stress_pool.tx_byte_pool_start + stress_pool.tx_byte_pool_size;
+    blocks =         0;
+    free_blocks =    0;
+    free_bytes =     0;
+    errors =         0;
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+    previous_free =  TX_FALSE;
+    previous_ptr =   TX_NULL;
+#endif
+    do
+    {
+
+        /* Each block is either free or owned by the pool.  */
+        next_ptr =    *((UCHAR **) block_ptr);
+        block_free =  (*((ALIGN_TYPE *) (block_ptr + sizeof(UCHAR *))) == TX_BYTE_BLOCK_FREE) ? TX_TRUE : TX_FALSE;
+        if ((block_free == TX_FALSE) && (*((UCHAR **) (block_ptr + sizeof(UCHAR *))) != (UCHAR *) &stress_pool))
+        {
+            errors++;
+        }
+        if (block_free == TX_TRUE)
+        {
+            free_blocks++;
+            free_bytes +=  (ULONG) (next_ptr - block_ptr);
+        }
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+
+        /* A TLSF block links back to the block before it, and is never free next to another free block.  */
+        if ((*TX_BYTE_POOL_TLSF_PREVIOUS_LINK(block_ptr) != previous_ptr) ||
+            ((block_free == TX_TRUE) && (previous_free == TX_TRUE)))
+        {
+            errors++;
+        }
+        previous_ptr =   block_ptr;
+        previous_free =  block_free;
+#endif
+        blocks++;
+
+        /* The links must move forward within the pool, until the block at its end links back to its start.  */
+        if (next_ptr >= end_ptr)
+        {
+            errors++;
+            break;
+        }
+        block_ptr =  (next_ptr > block_ptr) ? next_ptr : TX_NULL;
+    } while (block_ptr != TX_NULL);
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+
+    /* Count the free blocks on the free lists, and check the bitmaps.  */
+    listed =  0;
+    for (first_level = 0; first_level < TX_BYTE_POOL_TLSF_FL_COUNT; first_level++)
+    {
+        if ((((stress_pool.tx_byte_pool_tlsf_fl_bitmap >> first_level) & 1) != 0) !=
+            (stress_pool.tx_byte_pool_tlsf_sl_bitmap[first_level] != 0))
+        {
+            errors++;
+        }
+        for (second_level = 0; second_level < TX_BYTE_POOL_TLSF_SL_COUNT; second_level++)
+        {
+            list_ptr =  stress_pool.tx_byte_pool_tlsf_free_list[first_level][second_level];
+            if ((((stress_pool.tx_byte_pool_tlsf_sl_bitmap[first_level] >> second_level) & 1) != 0) != (list_ptr != TX_NULL))
+            {
+                errors++;
+            }
+            while ((list_ptr != TX_NULL) && (listed <= free_blocks))
+            {
+                if (*TX_BYTE_POOL_TLSF_OWNER(list_ptr) != TX_BYTE_BLOCK_FREE)
+                {
+                    errors++;
+                }
+                listed++;
+                list_ptr =  *TX_BYTE_POOL_TLSF_FREE_NEXT_LINK(list_ptr);
+            }
+        }
+    }
+    if (listed != free_blocks)
+    {
+        errors++;
+    }
+#endif
+
+    /* The blocks and the free bytes must match the pool.  */
+    if ((blocks != stress_pool.tx_byte_pool_fragments) || (free_bytes != stress_pool.tx_byte_pool_available))
+    {
+        errors++;
+    }
+    return((errors != 0) ? 1 : 0);
+}
+
+
+/* Define the largest block the stress pool can still allocate, found by bisection.  */
+
+static ULONG   stress_largest_get(VOID)
+{
+
+ULONG   low;
+ULONG   high;
+ULONG   size;
+VOID    *block;
+
+
+    low =   0;
+    high =  stress_pool.tx_byte_pool_available;
+    while (low < high)
+    {
+        size =  low + ((high - low + 1) / 2);
+        if (tx_byte_allocate(&stress_pool, &block, size, TX_NO_WAIT) == TX_SUCCESS)
+        {
+            tx_byte_release(block);
+            low =  size;
+        }
+        else
+        {
+            high =  size - 1;
+        }
+    }
+    return(low);
+}
+
+
+/* Define the host time in seconds.  */
+
+static double  benchmark_time_get(void)
+{
+
+struct timespec     now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return((double) now.tv_sec + ((double) now.tv_nsec / 1e9));
+}
+
+
+/* Define the reporting thread.  */
+
+void    report_thread_entry(ULONG thread_input)
+{
+
+static const char  *test_names[] =  { "context switch", "semaphore ping-pong", "queue throughput", "pointer queue",
+                                      "pointer batch 1", "pointer batch 4", "pointer batch 16", "mutex hand-off" };
+static const char  *test_units[] =  { "switches", "round trips", "messages", "pointers",
+                                      "pointers", "pointers", "pointers", "round trips" };
+static const ULONG  event_threads[] =  { 1, 8, BENCHMARK_EVENT_THREADS };
+ULONG               index;
+ULONG               test;
+ULONG               count;
+ULONG               ticks;
+double              start;
+double              elapsed;
+ULONG               failures;
+ULONG               fragments;
+ULONG               search;
+ULONG               largest;
+ULONG               random;
+ULONG               remaining;
+UINT                active;
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+ULONG               work;
+ULONG               worst_work;
+#endif
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+TX_EXECUTION_SNAPSHOT   first_snapshot;
+TX_EXECUTION_SNAPSHOT   last_snapshot;
+TX_EXECUTION_SNAPSHOT   load_snapshot;
+EXECUTION_TIME          worker_time[2];
+ULONG                   load;
+double                  thread_time;
+double                  isr_time;
+double                  idle_time;
+#endif
+#ifdef TX_TRACE_ENABLE_STREAMING
+ULONG                   events;
+ULONG                   dropped;
+ULONG                   bytes;
+#endif
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+ULONG                   rounds;
+ULONG                   used[2];
+ULONG                   headroom[2];
+#endif
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+TX_MUTEX_CONTENTION     contention;
+ULONG                   holds;
+ULONG                   waits;
+UINT                    bucket;
+#endif
+#ifdef TX_ENABLE_OBJECT_POOL
+TX_OBJECT_POOL          *object_pool;
+ULONG                   in_use;
+ULONG                   high_water;
+ULONG                   allocations;
+ULONG                   corruptions;
+VOID                    *object;
+#endif
+
+
+    (void) thread_input;
+
+    printf("ThreadX Linux port benchmark, %u ticks per second\n", (unsigned) TX_TIMER_TICKS_PER_SECOND);
+
+    for (test = BENCHMARK_CONTEXT_SWITCH; test <= BENCHMARK_MUTEX; test++)
+    {
+
+        /* Start the workers on the next test.  */
+        benchmark_test =   test;
+        benchmark_count =  0;
+        ticks =  tx_time_get();
+        start =  benchmark_time_get();
+        tx_thread_resume(&worker_thread_0);
+        tx_thread_resume(&worker_thread_1);
+
+        /* Let the test run for about one second.  */
+        tx_thread_sleep(TX_TIMER_TICKS_PER_SECOND);
+
+        /* Take the contended mutex from the workers, which raises the priority of the owner, so
+           neither worker holds it when they are stopped.  */
+        if ((test == BENCHMARK_MUTEX) && (tx_mutex_get(&contended_mutex, TX_WAIT_FOREVER) != TX_SUCCESS))
+        {
+            benchmark_errors++;
+        }
+
+        /* Stop and reset the workers.  */
+        tx_thread_terminate(&worker_thread_0);
+        tx_thread_terminate(&worker_thread_1);
+        count =    benchmark_count;
+        elapsed =  benchmark_time_get() - start;
+        ticks =    tx_time_get() - ticks;
+        tx_thread_reset(&worker_thread_0);
+        tx_thread_reset(&worker_thread_1);
+        tx_semaphore_delete(&ping_semaphore);
+        tx_semaphore_delete(&pong_semaphore);
+        tx_semaphore_create(&ping_semaphore, "ping", 0);
+        tx_semaphore_create(&pong_semaphore, "pong", 0);
+        tx_queue_flush(&message_queue);
+        tx_queue_flush(&pointer_queue);
+        if ((test == BENCHMARK_MUTEX) && (tx_mutex_put(&contended_mutex) != TX_SUCCESS))
+        {
+            benchmark_errors++;
+        }
+
+        printf("%-20s %10lu %-12s in %5.3f s, %10.0f per second, %lu ticks\n", test_names[test],
+               (unsigned long) count, test_units[test], elapsed, (double) count / elapsed, (unsigned long) ticks);
+    }
+
+#ifdef TX_MUTEX_ENABLE_CONTENTION_PROFILE
+
+    /* Each round trip holds the mutex twice and hands it over twice, and the reporting thread raised the
+       priority of the owner when it took the mutex.  */
+    tx_mutex_contention_info_get(&contended_mutex, &contention);
+    holds =  0;
+    waits =  0;
+    for (bucket = 0; bucket < TX_MUTEX_CONTENTION_BUCKETS; bucket++)
+    {
+        holds =  holds + contention.tx_mutex_contention_hold.tx_mutex_contention_times_histogram[bucket];
+        waits =  waits + contention.tx_mutex_contention_wait.tx_mutex_contention_times_histogram[bucket];
+    }
+    if ((holds < (2 * count)) || (waits < (2 * count)) ||
+        (contention.tx_mutex_contention_inheritance_count == 0) ||
+        (contention.tx_mutex_contention_inheritance_priority != BENCHMARK_REPORT_PRIORITY) ||
+        ((contention.tx_mutex_contention_inheritance_thread != &worker_thread_0) &&
+         (contention.tx_mutex_contention_inheritance_thread != &worker_thread_1)) ||
+        (contention.tx_mutex_contention_hold.tx_mutex_contention_times_longest_thread == TX_NULL) ||
+        (contention.tx_mutex_contention_wait.tx_mutex_contention_times_longest_thread == TX_NULL) ||
+        (tx_mutex_contention_reset(&contended_mutex) != TX_SUCCESS))
+    {
+        benchmark_errors++;
+    }
+
+    printf("%-20s %10lu %-12s %lu waits, longest hold %.1f us by %s, longest wait %.1f us by %s\n", "  contention",
+           (unsigned long) holds, "holds", (unsigned long) waits,
+           (double) contention.tx_mutex_contention_hold.tx_mutex_contention_times_longest / 1e3,
+           contention.tx_mutex_contention_hold.tx_mutex_contention_times_longest_thread -> tx_thread_name,
+           (double) contention.tx_mutex_contention_wait.tx_mutex_contention_times_longest / 1e3,
+           contention.tx_mutex_contention_wait.tx_mutex_contention_times_longest_thread -> tx_thread_name);
+    printf("%-20s", "  hold histogram");
+    for (bucket = 0; bucket < TX_MUTEX_CONTENTION_BUCKETS; bucket++)
+    {
+        printf(" %lu", (unsigned long) contention.tx_mutex_contention_hold.tx_mutex_contention_times_histogram[bucket]);
+    }
+    printf("\n%-20s", "  wait histogram");
+    for (bucket = 0; bucket < TX_MUTEX_CONTENTION_BUCKETS; bucket++)
+    {
+        printf(" %lu", (unsigned long) contention.tx_mutex_contention_wait.tx_mutex_contention_times_histogram[bucket]);
+    }
+    printf("\n");
+#endif
+
+    for (index = 0; index < (sizeof(event_threads) / sizeof(event_threads[0])); index++)
+    {
+
+        /* Start the event threads, which wait for their flags before worker 0 sets them.  */
+        event_waiters =         event_threads[index];
+        event_wakes =           0;
+        event_wake_time =       0.0;
+        event_unwatched_time =  0.0;
+        for (test = 0; test < event_waiters; test++)
+        {
+            tx_thread_resume(&event_thread[test]);
+        }
+        benchmark_test =   BENCHMARK_EVENTS;
+        benchmark_count =  0;
+        start =  benchmark_time_get();
+        tx_thread_resume(&worker_thread_0);
+        tx_thread_sleep(TX_TIMER_TICKS_PER_SECOND);
+
+        /* Stop and reset worker 0 and the event threads.  */
+        tx_thread_terminate(&worker_thread_0);
+        count =    benchmark_count;
+        elapsed =  benchmark_time_get() - start;
+        tx_thread_reset(&worker_thread_0);
+        for (test = 0; test < event_waiters; test++)
+        {
+            tx_thread_terminate(&event_thread[test]);
+            tx_thread_reset(&event_thread[test]);
+        }
+        tx_event_flags_set(&event_group, 0, TX_AND);
+
+        /* Each set must have run exactly one event thread, but worker 0 may have been stopped before counting the last.  */
+        if ((event_wakes < count) || (event_wakes > (count + 1)))
+        {
+            benchmark_errors++;
+        }
+
+        printf("%-20s %10lu %-12s in %5.3f s, %10.0f per second, %2lu waiting, %5.2f us set to wake",
+               "event wake", (unsigned long) event_wakes, "wakes", elapsed, (double) event_wakes / elapsed,
+               (unsigned long) event_waiters, (event_wake_time * 1e6) / (double) event_wakes);
+        if (event_waiters < BENCHMARK_EVENT_THREADS)
+        {
+            printf(", %5.1f ns unwatched set", (event_unwatched_time * 1e9) / (double) count);
+        }
+        printf("\n");
+    }
+
+    /* Start the timers of the wheel test, a third short, a third up to half the test and a third longer than the
+       test once they first expire, right after a tick.  */
+    tx_thread_sleep(1);
+    random =  0x13579BDFUL;
+    for (index = 0; index < BENCHMARK_WHEEL_TIMERS; index++)
+    {
+        random =  (random * 1664525UL) + 1013904223UL;
+        switch (index % 3)
+        {
+        case 0:
+            wheel_period[index] =  1 + ((random >> 8) % TX_TIMER_ENTRIES);
+            break;
+        case 1:
+            wheel_period[index] =  1 + ((random >> 8) % (BENCHMARK_WHEEL_TICKS / 2));
+            break;
+        default:
+            wheel_period[index] =  (BENCHMARK_WHEEL_TICKS * 2) + ((random >> 8) % BENCHMARK_WHEEL_TICKS);
+            break;
+        }
+        random =  (random * 1664525UL) + 1013904223UL;
+        ticks =   1 + ((random >> 8) % BENCHMARK_WHEEL_TICKS);
+        wheel_expected[index] =  tx_time_get() + ticks;
+        if (tx_timer_create(&wheel_timer[index], "wheel", wheel_timer_expire, index,
+                            ticks, wheel_period[index], TX_AUTO_ACTIVATE) != TX_SUCCESS)
+        {
+            benchmark_errors++;
+        }
+    }
+
+    /* Check a timer after every tick, through its information and a deactivation, once the lag of the timer list
+       behind the clock is known.  */
+    wheel_offset =       tx_time_get() - (ULONG) (_tx_timer_current_ptr - _tx_timer_list_start);
+    wheel_expirations =  0;
+    wheel_lag =          0;
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+    worst_work =  0;
+    count =       _tx_timer_performance_expiration_count + _tx_timer_performance__expiration_adjust_count;
+#endif
+    start =  benchmark_time_get();
+    for (test = 0; test < BENCHMARK_WHEEL_TICKS; test++)
+    {
+        tx_thread_sleep(1);
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+        work =   (_tx_timer_performance_expiration_count + _tx_timer_performance__expiration_adjust_count) - count;
+        count += work;
+        worst_work =  (work > worst_work) ? work : worst_work;
+#endif
+        /* The remaining ticks are checked unless the timer list moved while they were read.  */
+        index =  test % BENCHMARK_WHEEL_TIMERS;
+        ticks =  wheel_time_get();
+        if ((tx_timer_info_get(&wheel_timer[index], TX_NULL, &active, &remaining, TX_NULL, TX_NULL) != TX_SUCCESS) ||
+            (active != TX_TRUE) || ((ticks == wheel_time_get()) && ((ticks + remaining) != wheel_expected[index])))
+        {
+            benchmark_errors++;
+        }
+        ticks =  wheel_time_get();
+        tx_timer_deactivate(&wheel_timer[index]);
+        if ((ticks == wheel_time_get()) &&
+            ((ticks + wheel_timer[index].tx_timer_internal.tx_timer_internal_remaining_ticks) != wheel_expected[index]))
+        {
+            benchmark_errors++;
+        }
+        tx_timer_activate(&wheel_timer[index]);
+    }
+    elapsed =  benchmark_time_get() - start;
+
+    /* Every timer must still be active, and is deleted.  */
+    for (index = 0; index < BENCHMARK_WHEEL_TIMERS; index++)
+    {
+        if ((tx_timer_info_get(&wheel_timer[index], TX_NULL, &active, TX_NULL, TX_NULL, TX_NULL) != TX_SUCCESS) ||
+            (active != TX_TRUE) || (tx_timer_delete(&wheel_timer[index]) != TX_SUCCESS))
+        {
+            benchmark_errors++;
+        }
+    }
+
+#ifdef TX_TIMER_ENABLE_HIERARCHICAL_WHEEL
+    printf("%-20s %10lu %-12s in %5.3f s, wheels, %lu ticks lost", "timer wheel",
+#else
+    printf("%-20s %10lu %-12s in %5.3f s, list, %lu ticks lost", "timer wheel",
+#endif
+           (unsigned long) wheel_expirations, "expirations", elapsed, (unsigned long) wheel_lag);
+#ifdef TX_TIMER_ENABLE_PERFORMANCE_INFO
+    printf(", %lu timers per tick at most", (unsigned long) worst_work);
+#endif
+    printf("\n");
+
+    /* Start timers that one time increment passes, and one after it, right after a tick.  */
+    tx_thread_sleep(1);
+    ticks =  wheel_time_get();
+    increment_expirations =  0;
+    for (index = 0; index < BENCHMARK_INCREMENT_TIMERS; index++)
+    {
+        if (tx_timer_create(&wheel_timer[index], "increment", increment_timer_expire, index,
+                            increment_ticks[index], 0, TX_AUTO_ACTIVATE) != TX_SUCCESS)
+        {
+            benchmark_errors++;
+        }
+    }
+    wheel_expirations =  0;
+    wheel_expected[index] =  ticks + (BENCHMARK_INCREMENT_TICKS + (BENCHMARK_INCREMENT_TICKS / 2));
+    wheel_period[index] =    0;
+    if (tx_timer_create(&wheel_timer[index], "increment", wheel_timer_expire, index,
+                        BENCHMARK_INCREMENT_TICKS + (BENCHMARK_INCREMENT_TICKS / 2), 0, TX_AUTO_ACTIVATE) != TX_SUCCESS)
+    {
+        benchmark_errors++;
+    }
+
+    /* Account for the ticks at once, as after a suppressed timer interrupt. The timer list must advance over all
+       of them, expiring each timer passed, and the last timer must keep its tick.  */
+    start =  benchmark_time_get();
+    _tx_time_increment(BENCHMARK_INCREMENT_TICKS);
+    tx_thread_sleep(1);
+    elapsed =  benchmark_time_get() - start;
+    count =    wheel_time_get() - ticks;
+    test =     increment_expirations;
+    if ((count <= BENCHMARK_INCREMENT_TICKS) || (test != BENCHMARK_INCREMENT_TIMERS) || (wheel_expirations != 0))
+    {
+        benchmark_errors++;
+    }
+    ticks =  wheel_time_get();
+    if ((tx_timer_info_get(&wheel_timer[index], TX_NULL, &active, &remaining, TX_NULL, TX_NULL) != TX_SUCCESS) ||
+        (active != TX_TRUE) || ((ticks == wheel_time_get()) && ((ticks + remaining) != wheel_expected[index])))
+    {
+        benchmark_errors++;
+    }
+    tx_thread_sleep(BENCHMARK_INCREMENT_TICKS);
+    if (wheel_expirations != 1)
+    {
+        benchmark_errors++;
+    }
+    for (index = 0; index <= BENCHMARK_INCREMENT_TIMERS; index++)
+    {
+        if (tx_timer_delete(&wheel_timer[index]) != TX_SUCCESS)
+        {
+            benchmark_errors++;
+        }
+    }
+
+    printf("%-20s %10lu %-12s in %5.3f s, %lu of %lu passed timers expired\n", "time increment",
+           (unsigned long) count, "ticks", elapsed, (unsigned long) test,
+           (unsigned long) BENCHMARK_INCREMENT_TIMERS);
+
+#ifdef TX_LOW_POWER
+
+    /* Sleep while the system is otherwise idle, so the timer interrupt is suppressed.  */
+    ticks =  tx_time_get();
+    count =  _tx_timer_low_power_suppressed_ticks;
+    start =  benchmark_time_get();
+    for (test = 0; test < BENCHMARK_IDLE_SLEEPS; test++)
+    {
+        tx_thread_sleep(BENCHMARK_IDLE_SLEEP_TICKS);
+    }
+    elapsed =  benchmark_time_get() - start;
+    ticks =    tx_time_get() - ticks;
+    count =    _tx_timer_low_power_suppressed_ticks - count;
+
+    /* The sleeps must take their ticks, and the ticks must match the host time.  */
+    if ((ticks != (BENCHMARK_IDLE_SLEEPS * BENCHMARK_IDLE_SLEEP_TICKS)) ||
+        ((elapsed * TX_TIMER_TICKS_PER_SECOND) < (double) (ticks - 2)) ||
+        ((elapsed * TX_TIMER_TICKS_PER_SECOND) > (double) (ticks + 2)))
+    {
+        benchmark_errors++;
+    }
+
+    printf("%-20s %10lu %-12s in %5.3f s, %10lu suppressed\n", "tickless idle",
+           (unsigned long) ticks, "ticks", elapsed, (unsigned long) count);
+#endif
+
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+
+    /* Run the workers busy part of the time and profile them.  */
+    benchmark_test =   BENCHMARK_PROFILE;
+    benchmark_count =  0;
+    _tx_execution_thread_time_reset(&worker_thread_0);
+    _tx_execution_thread_time_reset(&worker_thread_1);
+    _tx_execution_snapshot_get(&first_snapshot);
+    load_snapshot =  first_snapshot;
+    start =  benchmark_time_get();
+    tx_thread_resume(&worker_thread_0);
+    tx_thread_resume(&worker_thread_1);
+    tx_thread_sleep(TX_TIMER_TICKS_PER_SECOND);
+    tx_thread_terminate(&worker_thread_0);
+    tx_thread_terminate(&worker_thread_1);
+    _tx_execution_snapshot_get(&last_snapshot);
+    elapsed =  benchmark_time_get() - start;
+    _tx_execution_cpu_load_get(&load_snapshot, &load);
+    _tx_execution_thread_time_get(&worker_thread_0, &worker_time[0]);
+    _tx_execution_thread_time_get(&worker_thread_1, &worker_time[1]);
+    thread_time =  (double) (last_snapshot.tx_execution_snapshot_thread_time - first_snapshot.tx_execution_snapshot_thread_time) / 1e9;
+    isr_time =     (double) (last_snapshot.tx_execution_snapshot_isr_time - first_snapshot.tx_execution_snapshot_isr_time) / 1e9;
+    idle_time =    (double) (last_snapshot.tx_execution_snapshot_idle_time - first_snapshot.tx_execution_snapshot_idle_time) / 1e9;
+
+    /* The profile must account for the host time, and charge each worker for the time it was busy. A worker
+       terminated while busy is charged for time it has not counted yet.  */
+    if (((thread_time + isr_time + idle_time) < (elapsed * 0.99)) || ((thread_time + isr_time + idle_time) > (elapsed * 1.01)) ||
+        (load != (ULONG) (((thread_time + isr_time) * 100.0) / (thread_time + isr_time + idle_time))))
+    {
+        benchmark_errors++;
+    }
+    for (test = 0; test < 2; test++)
+    {
+        if ((((double) worker_time[test] / 1e9) < (benchmark_busy_time[test] * 0.9)) ||
+            (((double) worker_time[test] / 1e9) > ((benchmark_busy_time[test] * 1.1) + BENCHMARK_BUSY_TIME)))
+        {
+            benchmark_errors++;
+        }
+    }
+
+    printf("%-20s %10lu %-12s in %5.3f s, %3lu%% load, threads %.1f ms, ISRs %.1f us, idle %.1f ms\n", "execution profile",
+           (unsigned long) benchmark_count, "busy periods", elapsed, (unsigned long) load,
+           thread_time * 1e3, isr_time * 1e6, idle_time * 1e3);
+    printf("%-20s %10.1f ms busy, %.1f ms profiled, worker 1 %.1f ms busy, %.1f ms profiled\n", "  worker 0",
+           benchmark_busy_time[0] * 1e3, ((double) worker_time[0]) / 1e6, benchmark_busy_time[1] * 1e3, ((double) worker_time[1]) / 1e6);
+#endif
+
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+
+    /* Mark a word deep in the stack of worker 0, below the headroom threshold, and one in the stack of worker 1,
+       above it. The words above the marks are still the fill pattern.  */
+    worker_stack_0[BENCHMARK_MONITOR_DEEP] =     0;
+    worker_stack_1[BENCHMARK_MONITOR_SHALLOW] =  0;
+    start =  benchmark_time_get();
+    if (tx_thread_stack_monitor_start(BENCHMARK_MONITOR_SLICE, 1, BENCHMARK_MONITOR_HEADROOM, monitor_notify) != TX_SUCCESS)
+    {
+        benchmark_errors++;
+    }
+    rounds =   monitor_rounds_wait(0);
+    elapsed =  benchmark_time_get() - start;
+
+    /* The marks must be exact, only worker 0 must be notified, and the unused report stack has no mark.  */
+    tx_thread_stack_monitor_info_get(&worker_thread_0, &used[0], &headroom[0], TX_NULL);
+    tx_thread_stack_monitor_info_get(&worker_thread_1, &used[1], &headroom[1], TX_NULL);
+    if ((used[0] != (sizeof(worker_stack_0) - (BENCHMARK_MONITOR_DEEP * sizeof(ULONG)))) ||
+        (headroom[0] != (BENCHMARK_MONITOR_DEEP * sizeof(ULONG))) ||
+        (used[1] != (sizeof(worker_stack_1) - (BENCHMARK_MONITOR_SHALLOW * sizeof(ULONG)))) ||
+        (monitor_notifications[0] != 1) || (monitor_notifications[1] != 0) || (monitor_notify_used != used[0]) ||
+        (tx_thread_stack_monitor_info_get(&report_thread, TX_NULL, TX_NULL, TX_NULL) != TX_NOT_DONE))
+    {
+        benchmark_errors++;
+    }
+
+    /* Deepen the mark of worker 0, which must be notified once more, while the other marks stay the same.  */
+    worker_stack_0[BENCHMARK_MONITOR_DEEPER] =  0;
+    rounds =  monitor_rounds_wait(rounds);
+    tx_thread_stack_monitor_info_get(&worker_thread_0, &used[0], TX_NULL, TX_NULL);
+    if ((used[0] != (sizeof(worker_stack_0) - (BENCHMARK_MONITOR_DEEPER * sizeof(ULONG)))) ||
+        (monitor_notifications[0] != 2) || (monitor_notifications[1] != 0) ||
+        (tx_thread_stack_monitor_stop() != TX_SUCCESS))
+    {
+        benchmark_errors++;
+    }
+
+    printf("%-20s %10lu %-12s in %5.3f s to the first marks, worker 0 %lu bytes used, worker 1 %lu bytes used, %lu notified\n",
+           "stack monitor", (unsigned long) rounds, "scans", elapsed, (unsigned long) used[0], (unsigned long) used[1],
+           (unsigned long) monitor_notifications[0]);
+#endif
+
+#ifdef TX_ENABLE_OBJECT_POOL
+
+    /* Churn the same objects through the byte pool and through the object pools.  */
+    for (test = 0; test < 2; test++)
+    {
+        start =     benchmark_time_get();
+        failures =  churn_run((UINT) test, &fragments);
+        elapsed =   benchmark_time_get() - start;
+
+        /* The object pools, which have room for every slot, must never fail.  */
+        if ((test != 0) && (failures != 0))
+        {
+            benchmark_errors++;
+        }
+
+        printf("%-20s %10lu %-12s in %5.3f s, %7.1f ns per operation, %lu failed", (test == 0) ? "byte pool churn" : "object pool churn",
+               (unsigned long) BENCHMARK_CHURN_OPERATIONS, "operations", elapsed, (elapsed * 1e9) / (double) BENCHMARK_CHURN_OPERATIONS,
+               (unsigned long) failures);
+        if (test == 0)
+        {
+            printf(", %lu fragments", (unsigned long) fragments);
+        }
+        printf("\n");
+    }
+
+    /* Every object pool must be on the created list, with no object in use, no failure and no corruption.  */
+    object_pool =  _tx_object_pool_created_ptr;
+    for (index = 0; index < BENCHMARK_CHURN_CLASSES; index++)
+    {
+        if ((object_pool != &churn_object_pool[index]) ||
+            (_tx_object_pool_info_get(object_pool, TX_NULL, TX_NULL, TX_NULL, &in_use, &high_water, &object_pool) != TX_SUCCESS) ||
+            (_tx_object_pool_performance_info_get(&churn_object_pool[index], &allocations, &failures, &corruptions) != TX_SUCCESS) ||
+            (in_use != 0) || (high_water > BENCHMARK_CHURN_SLOTS) || (failures != 0) || (corruptions != 0))
+        {
+            benchmark_errors++;
+        }
+        printf("%-20s %10lu %-12s of %3lu bytes, %2lu most in use\n", churn_names[index], (unsigned long) allocations,
+               "allocations", (unsigned long) churn_sizes[index], (unsigned long) high_water);
+    }
+
+    /* Frees to the wrong pool and double frees must be rejected.  */
+    if ((_tx_object_allocate(&churn_object_pool[0], &object, TX_NO_WAIT) != TX_SUCCESS) ||
+        (_tx_object_free(&churn_object_pool[1], object) != TX_PTR_ERROR) ||
+        (_tx_object_free(&churn_object_pool[0], object) != TX_SUCCESS) ||
+        (_tx_object_free(&churn_object_pool[0], object) != TX_PTR_ERROR))
+    {
+        benchmark_errors++;
+    }
+#endif
+
+    /* Stress the byte pool, with its blocks walked as it goes.  */
+    start =     benchmark_time_get();
+    failures =  stress_run(&search);
+    elapsed =   benchmark_time_get() - start;
+    fragments = stress_pool.tx_byte_pool_fragments;
+    largest =   stress_largest_get();
+#ifdef TX_BYTE_POOL_ENABLE_TLSF
+    printf("%-20s %10lu %-12s in %5.3f s, TLSF, %lu failed, %lu fragments, %lu bytes largest", "byte pool stress",
+#else
+    printf("%-20s %10lu %-12s in %5.3f s, first-fit, %lu failed, %lu fragments, %lu bytes largest", "byte pool stress",
+#endif
+           (unsigned long) BENCHMARK_STRESS_OPERATIONS, "allocations", elapsed, (unsigned long) failures,
+           (unsigned long) fragments, (unsigned long) largest);
+#ifdef TX_BYTE_POOL_ENABLE_PERFORMANCE_INFO
+    printf(", %lu blocks searched at most", (unsigned long) search);
+#endif
+    printf("\n");
+
+    /* Once every block is released, the pool must be whole again.  */
+    for (index = 0; index < BENCHMARK_STRESS_SLOTS; index++)
+    {
+        if (stress_slots[index] != TX_NULL)
+        {
+            benchmark_errors +=  (tx_byte_release(stress_slots[index]) != TX_SUCCESS) ? 1 : 0;
+            stress_slots[index] =  TX_NULL;
+        }
+    }
+    benchmark_errors +=  stress_walk();
+    if (stress_largest_get() + (2 * sizeof(VOID *)) + sizeof(ALIGN_TYPE) < stress_pool.tx_byte_pool_available)
+    {
+        benchmark_errors++;
+    }
+
+#ifdef TX_TRACE_ENABLE_STREAMING
+
+    /* Stop the stream and wait for the stream thread to complete.  */
+    stream_stop =  1;
+    while (stream_thread.tx_thread_state != TX_COMPLETED)
+    {
+        tx_thread_sleep(1);
+    }
+    tx_trace_stream_info_get(&events, &dropped, &bytes);
+
+    /* The events must have been streamed.  */
+    if (events == 0)
+    {
+        benchmark_errors++;
+    }
+
+    printf("%-20s %10lu %-12s to %s, %lu dropped, %.2f bytes per event\n", "trace stream",
+           (unsigned long) events, "events", BENCHMARK_STREAM_FILE, (unsigned long) dropped,
+           (double) bytes / (double) events);
+#endif
+
+    printf("errors: %lu\n", (unsigned long) benchmark_errors);
+    fflush(stdout);
+    exit((benchmark_errors == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
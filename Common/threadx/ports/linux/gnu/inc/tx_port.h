@@ -0,0 +1,398 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Port Specific                                                       */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  PORT SPECIFIC C INFORMATION                            RELEASE        */
+/*                                                                        */
+/*    tx_port.h                                            Linux/GNU      */
+/*                                                           6.1.2        */
+/*                                                                        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file contains data type definitions that make the ThreadX      */
+/*    real-time kernel function identically on a variety of different     */
+/*    processor architectures.  For example, the size or number of bits   */
+/*    in an "int" data type vary between microprocessor architectures and */
+/*    even C compilers for the same microprocessor.  ThreadX does not     */
+/*    directly use native C data types.  Instead, ThreadX creates its     */
+/*    own special types that can be mapped to actual data types by this   */
+/*    file to guarantee consistency in the interface and functionality.   */
+/*                                                                        */
+/*    This port runs ThreadX as a simulation on a Linux host. Each        */
+/*    ThreadX thread is a pthread, and only the thread selected by the    */
+/*    scheduler is allowed to run. Interrupt lockout is a host mutex,     */
+/*    and the periodic timer interrupt is a pthread that wakes up every   */
+/*    tick. An interrupt stops the running thread with a signal, so       */
+/*    threads that may be interrupted must not share host library locks,  */
+/*    for example the stdio lock taken by printf.                         */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_PORT_H
+#define TX_PORT_H
+
+
+/* Determine if the optional ThreadX user define file should be used.  */
+
+#ifdef TX_INCLUDE_USER_DEFINE_FILE
+
+
+/* Yes, include the user defines in tx_user.h. The defines in this file may
+   alternately be defined on the command line.  */
+
+#include "tx_user.h"
+#endif
+
+
+/* Define compiler library include files.  */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+
+/* Define ThreadX basic types for this port. ThreadX expects ULONG to be 32 bits, so
+   LONG and ULONG map to int on 64-bit hosts as well.  */
+
+#define VOID                                    void
+typedef char                                    CHAR;
+typedef unsigned char                           UCHAR;
+typedef int                                     INT;
+typedef unsigned int                            UINT;
+typedef int                                     LONG;
+typedef unsigned int                            ULONG;
+typedef unsigned long long                      ULONG64;
+typedef short                                   SHORT;
+typedef unsigned short                          USHORT;
+#define ULONG64_DEFINED
+
+
+/* Define the alignment type, which must hold a pointer on the host.  */
+
+#define ALIGN_TYPE_DEFINED
+#define ALIGN_TYPE                              ULONG64
+
+
+/* Event trace records thread and object pointers in ULONG fields, which do not hold a pointer on
+   a 64-bit host. Event trace, and the trace stream built on it, is therefore only supported when
+   the port is built for a 32-bit host, for example with -m32.  */
+
+#if (defined(TX_ENABLE_EVENT_TRACE) || defined(TX_TRACE_ENABLE_STREAMING)) && defined(__LP64__)
+#error "Event trace is not supported by the Linux port on 64-bit hosts, build for a 32-bit host"
+#endif
+
+
+/* Stack checking aligns the stack start in tx_thread_create through a ULONG, which truncates the
+   stack address on a 64-bit host. It is therefore also only supported on a 32-bit host.  */
+
+#if defined(TX_ENABLE_STACK_CHECKING) && defined(__LP64__)
+#error "Stack checking is not supported by the Linux port on 64-bit hosts, build for a 32-bit host"
+#endif
+
+
+/* Define the priority levels for ThreadX.  Legal values range
+   from 32 to 1024 and MUST be evenly divisible by 32.  */
+
+#ifndef TX_MAX_PRIORITIES
+#define TX_MAX_PRIORITIES                       32
+#endif
+
+
+/* Define the minimum stack for a ThreadX thread on this processor. If the size supplied during
+   thread creation is less than this value, the thread create call will return an error. The
+   ThreadX stack is not used by the host thread, which runs on its own pthread stack.  */
+
+#ifndef TX_MINIMUM_STACK
+#define TX_MINIMUM_STACK                        200         /* Minimum stack size for this port  */
+#endif
+
+
+/* Define the system timer thread's default stack size and priority.  These are only applicable
+   if TX_TIMER_PROCESS_IN_ISR is not defined.  */
+
+#ifndef TX_TIMER_THREAD_STACK_SIZE
+#define TX_TIMER_THREAD_STACK_SIZE              1024        /* Default timer thread stack size  */
+#endif
+
+#ifndef TX_TIMER_THREAD_PRIORITY
+#define TX_TIMER_THREAD_PRIORITY                0           /* Default timer thread priority    */
+#endif
+
+
+/* Define the stack size of the host pthread behind each ThreadX thread.  */
+
+#ifndef TX_LINUX_THREAD_STACK_SIZE
+#define TX_LINUX_THREAD_STACK_SIZE              (256 * 1024)
+#endif
+
+
+/* Define the size of the memory handed to tx_application_define as the first unused memory.  */
+
+#ifndef TX_LINUX_MEMORY_SIZE
+#define TX_LINUX_MEMORY_SIZE                    (64 * 1024)
+#endif
+
+
+/* Define the signal used to stop a thread that is preempted by the timer interrupt.  */
+
+#ifndef TX_LINUX_PREEMPT_SIGNAL
+#define TX_LINUX_PREEMPT_SIGNAL                 SIGUSR1
+#endif
+
+
+/* Define various constants for the ThreadX Linux port.  */
+
+#define TX_INT_DISABLE                          1           /* Disable interrupts               */
+#define TX_INT_ENABLE                           0           /* Enable interrupts                */
+
+
+/* Define the clock source for trace event entry time stamp. The Linux port uses the low 32 bits
+   of the host monotonic clock in nanoseconds.  */
+
+ULONG   _tx_linux_time_stamp_get(VOID);
+
+#ifndef TX_TRACE_TIME_SOURCE
+#define TX_TRACE_TIME_SOURCE                    _tx_linux_time_stamp_get()
+#endif
+#ifndef TX_TRACE_TIME_MASK
+#define TX_TRACE_TIME_MASK                      0xFFFFFFFFUL
+#endif
+
+
+/* Define the clock source of the execution profile kit. The Linux port uses the host monotonic
+   clock in nanoseconds, which does not wrap.  */
+
+ULONG64 _tx_linux_execution_time_get(VOID);
+
+#ifndef TX_EXECUTION_TIME_SOURCE
+#define TX_EXECUTION_TIME_SOURCE_TYPE           ULONG64
+#define TX_EXECUTION_TIME_SOURCE                _tx_linux_execution_time_get()
+#define TX_EXECUTION_MAX_TIME_SOURCE            ((ULONG64) 0xFFFFFFFFFFFFFFFFULL)
+#endif
+
+
+/* Define the port specific options for the _tx_build_options variable. This variable indicates
+   how the ThreadX library was built.  */
+
+#define TX_PORT_SPECIFIC_BUILD_OPTIONS          (0)
+
+
+/* Define the in-line initialization constant so that modules with in-line
+   initialization capabilities can prevent their initialization from being
+   a function call.  */
+
+#define TX_INLINE_INITIALIZATION
+
+
+/* Determine whether or not stack checking is enabled. By default, ThreadX stack checking is
+   disabled. When the following is defined, ThreadX thread stack checking is enabled.  If stack
+   checking is enabled (TX_ENABLE_STACK_CHECKING is defined), the TX_DISABLE_STACK_FILLING
+   define is negated, thereby forcing the stack fill which is necessary for the stack checking
+   logic.  */
+
+#ifdef TX_ENABLE_STACK_CHECKING
+#undef TX_DISABLE_STACK_FILLING
+#endif
+
+
+/* Define the TX_THREAD control block extensions for this port. The first extension holds the
+   host pthread behind the thread, the semaphores it waits on while it is not scheduled, and
+   the state needed to hand it back to the scheduler.  */
+
+#define TX_THREAD_EXTENSION_0           pthread_t   tx_thread_linux_thread_id;                  \
+                                        sem_t       tx_thread_linux_thread_run_semaphore;       \
+                                        sem_t       tx_thread_linux_thread_preempt_semaphore;   \
+                                        VOID        (*tx_thread_linux_thread_entry)(VOID);      \
+                                        UINT        tx_thread_linux_thread_created;             \
+                                        UINT        tx_thread_linux_thread_preempted;           \
+                                        UINT        tx_thread_linux_thread_exit_request;        \
+                                        UINT        tx_thread_linux_int_disabled_flag;
+#define TX_THREAD_EXTENSION_1
+#define TX_THREAD_EXTENSION_2
+#ifndef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+#define TX_THREAD_EXTENSION_3
+#else
+#define TX_THREAD_EXTENSION_3           unsigned long long  tx_thread_execution_time_total; \
+                                        unsigned long long  tx_thread_execution_time_last_start;
+#endif
+
+
+/* Define the port extensions of the remaining ThreadX objects.  */
+
+#define TX_BLOCK_POOL_EXTENSION
+#define TX_BYTE_POOL_EXTENSION
+#define TX_EVENT_FLAGS_GROUP_EXTENSION
+#define TX_MUTEX_EXTENSION
+#define TX_QUEUE_EXTENSION
+#define TX_SEMAPHORE_EXTENSION
+#define TX_TIMER_EXTENSION
+
+
+/* Define the user extension field of the thread control block.  Nothing
+   additional is needed for this port so it is defined as white space.  */
+
+#ifndef TX_THREAD_USER_EXTENSION
+#define TX_THREAD_USER_EXTENSION
+#endif
+
+
+/* Pointers do not fit in a ULONG on 64-bit hosts, so the thread timeout finds its thread
+   through the internal timer extension instead of the timeout parameter.  */
+
+#define TX_TIMER_INTERNAL_EXTENSION             VOID    *tx_timer_internal_extension_ptr;
+
+#define TX_THREAD_CREATE_TIMEOUT_SETUP(t)       (t) -> tx_thread_timer.tx_timer_internal_timeout_function =  &(_tx_thread_timeout);   \
+                                                (t) -> tx_thread_timer.tx_timer_internal_timeout_param =     ((ULONG) 0);             \
+                                                (t) -> tx_thread_timer.tx_timer_internal_extension_ptr =     (VOID *) (t);
+
+#define TX_THREAD_TIMEOUT_POINTER_SETUP(t)      (t) =  (TX_THREAD *) _tx_timer_expired_timer_ptr -> tx_timer_internal_extension_ptr;
+
+
+/* Define the macros for processing extensions in tx_thread_create, tx_thread_delete,
+   tx_thread_shell_entry, and tx_thread_terminate.  */
+
+#define TX_THREAD_CREATE_EXTENSION(thread_ptr)
+#define TX_THREAD_DELETE_EXTENSION(thread_ptr)
+#define TX_THREAD_COMPLETED_EXTENSION(thread_ptr)
+#define TX_THREAD_TERMINATED_EXTENSION(thread_ptr)
+
+
+/* Define the port completion processing of thread delete and reset. The host pthread of the
+   thread is released, since a reset builds a new one.  */
+
+struct TX_THREAD_STRUCT;
+VOID    _tx_linux_thread_delete(struct TX_THREAD_STRUCT *thread_ptr);
+
+#define TX_THREAD_DELETE_PORT_COMPLETION(thread_ptr)                _tx_linux_thread_delete(thread_ptr);
+#define TX_THREAD_RESET_PORT_COMPLETION(thread_ptr)                 _tx_linux_thread_delete(thread_ptr);
+
+
+/* Define the ThreadX object creation extensions for the remaining objects.  */
+
+#define TX_BLOCK_POOL_CREATE_EXTENSION(pool_ptr)
+#define TX_BYTE_POOL_CREATE_EXTENSION(pool_ptr)
+#define TX_EVENT_FLAGS_GROUP_CREATE_EXTENSION(group_ptr)
+#define TX_MUTEX_CREATE_EXTENSION(mutex_ptr)
+#define TX_QUEUE_CREATE_EXTENSION(queue_ptr)
+#define TX_SEMAPHORE_CREATE_EXTENSION(semaphore_ptr)
+#define TX_TIMER_CREATE_EXTENSION(timer_ptr)
+
+
+/* Define the ThreadX object deletion extensions for the remaining objects.  */
+
+#define TX_BLOCK_POOL_DELETE_EXTENSION(pool_ptr)
+#define TX_BYTE_POOL_DELETE_EXTENSION(pool_ptr)
+#define TX_EVENT_FLAGS_GROUP_DELETE_EXTENSION(group_ptr)
+#define TX_MUTEX_DELETE_EXTENSION(mutex_ptr)
+#define TX_QUEUE_DELETE_EXTENSION(queue_ptr)
+#define TX_SEMAPHORE_DELETE_EXTENSION(semaphore_ptr)
+#define TX_TIMER_DELETE_EXTENSION(timer_ptr)
+
+
+/* Define ThreadX interrupt lockout and restore macros for protection on
+   access of critical kernel information.  The restore interrupt macro must
+   restore the interrupt posture of the running thread prior to the value
+   present prior to the disable macro.  In most cases, the save area macro
+   is used to define a local function save area for the disable and restore
+   macros.  */
+
+UINT    _tx_thread_interrupt_disable(VOID);
+VOID    _tx_thread_interrupt_restore(UINT previous_posture);
+
+#define TX_INTERRUPT_SAVE_AREA                  UINT interrupt_save;
+#define TX_DISABLE                              interrupt_save = _tx_thread_interrupt_disable();
+#define TX_RESTORE                              _tx_thread_interrupt_restore(interrupt_save);
+
+
+/* Define the interrupt lockout macros for each ThreadX object.  */
+
+#define TX_BLOCK_POOL_DISABLE                   TX_DISABLE
+#define TX_BYTE_POOL_DISABLE                    TX_DISABLE
+#define TX_EVENT_FLAGS_GROUP_DISABLE            TX_DISABLE
+#define TX_MUTEX_DISABLE                        TX_DISABLE
+#define TX_QUEUE_DISABLE                        TX_DISABLE
+#define TX_SEMAPHORE_DISABLE                    TX_DISABLE
+
+
+/* Define the Linux port services. An application pthread that is not a ThreadX thread, for
+   example a simulated device, calls ThreadX services the way an ISR does, between
+   _tx_thread_context_save and _tx_thread_context_restore.  */
+
+VOID    _tx_linux_mutex_obtain(VOID);
+VOID    _tx_linux_mutex_release(VOID);
+UINT    _tx_linux_mutex_owned(VOID);
+VOID    _tx_linux_thread_wait(struct TX_THREAD_STRUCT *thread_ptr);
+VOID    _tx_linux_thread_interrupt(struct TX_THREAD_STRUCT *thread_ptr);
+VOID   *_tx_linux_thread_entry(VOID *thread_input);
+VOID    _tx_linux_thread_preempt_handler(INT signal_number);
+
+
+#ifdef TX_LOW_POWER
+
+/* Define the low power hooks of the Linux port. While the timer interrupt is suppressed, the
+   timer pthread only counts the ticks.  */
+
+VOID    _tx_linux_timer_suppress(ULONG ticks);
+ULONG   _tx_linux_timer_resume(VOID);
+UINT    _tx_linux_timer_tick_suppressed(VOID);
+
+#ifndef TX_LOW_POWER_TIMER_SETUP
+#define TX_LOW_POWER_TIMER_SETUP(t)             _tx_linux_timer_suppress(t);
+#endif
+#ifndef TX_LOW_POWER_USER_TIMER_ADJUST
+#define TX_LOW_POWER_USER_TIMER_ADJUST          _tx_linux_timer_resume()
+#endif
+#endif
+
+
+/* Define the Linux port data.  */
+
+extern sem_t                    _tx_linux_scheduler_semaphore;
+extern sem_t                    _tx_linux_timer_start_semaphore;
+extern sem_t                    _tx_linux_preempt_ack_semaphore;
+
+
+/* Define the version ID of ThreadX.  This may be utilized by the application.  */
+
+#ifdef TX_THREAD_INIT
+CHAR                            _tx_version_id[] =
+                                    "Copyright (c) Microsoft Corporation. All rights reserved.  *  ThreadX Linux/GNU Version 6.1.2 *";
+#else
+extern  CHAR                    _tx_version_id[];
+#endif
+
+
+#endif
+
@@ -0,0 +1,237 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Initialize                                                          */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_initialize.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+#include <stdio.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+
+
+/* Define the period of the timer interrupt in nanoseconds.  */
+
+#define TX_LINUX_TIMER_PERIOD       (1000000000UL / ((unsigned long) TX_TIMER_TICKS_PER_SECOND))
+
+
+/* Define the timer interrupt function, which has no prototype in the common headers.  */
+
+VOID    _tx_timer_interrupt(VOID);
+
+
+/* Define the pthread that drives the timer interrupt.  */
+
+static VOID    *_tx_linux_timer_entry(VOID *timer_input);
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_initialize_low_level                            Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is responsible for any low-level processor            */
+/*    initialization, including setting up interrupt vectors, setting     */
+/*    up a periodic timer interrupt source, saving the system stack       */
+/*    pointer for use in ISR processing later, and finding the first      */
+/*    available RAM memory address for tx_application_define.             */
+/*                                                                        */
+/*    In the Linux port, the first available memory is allocated from     */
+/*    the host heap, the preemption signal handler is installed, and a    */
+/*    pthread that drives the timer interrupt is created. The timer       */
+/*    interrupt starts once the scheduler starts.                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    malloc                            Allocate the first memory         */
+/*    sigaction                         Install the preemption handler    */
+/*    pthread_create                    Create the timer pthread          */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_initialize_kernel_enter       ThreadX entry function            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_initialize_low_level(VOID)
+{
+
+struct sigaction    action;
+pthread_t           timer_id;
+
+
+    /* Allocate the memory handed to tx_application_define.  */
+    _tx_initialize_unused_memory =  malloc(TX_LINUX_MEMORY_SIZE);
+    if (_tx_initialize_unused_memory == TX_NULL)
+    {
+
+        /* The simulation cannot run without it.  */
+        fprintf(stderr, "ThreadX Linux port: unable to allocate the first available memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Create the port semaphores.  */
+    sem_init(&_tx_linux_scheduler_semaphore, 0, 0);
+    sem_init(&_tx_linux_timer_start_semaphore, 0, 0);
+    sem_init(&_tx_linux_preempt_ack_semaphore, 0, 0);
+
+    /* Install the handler that stops a thread when an interrupt begins.  */
+    memset(&action, 0, sizeof(action));
+    action.sa_handler =  _tx_linux_thread_preempt_handler;
+    sigfillset(&action.sa_mask);
+    sigaction(TX_LINUX_PREEMPT_SIGNAL, &action, TX_NULL);
+
+    /* Create the pthread that drives the timer interrupt.  */
+    if (pthread_create(&timer_id, TX_NULL, _tx_linux_timer_entry, TX_NULL) != 0)
+    {
+
+        /* The simulation cannot run without it.  */
+        fprintf(stderr, "ThreadX Linux port: unable to create the timer interrupt\n");
+        exit(EXIT_FAILURE);
+    }
+    pthread_detach(timer_id);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_timer_entry                               Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the pthread that drives the periodic timer         */
+/*    interrupt. Once the scheduler starts, it wakes up every tick and    */
+/*    runs the timer interrupt between the context save and restore, like */
+/*    the timer ISR of a target.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    timer_input                       Not used                          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_NULL                           Never returns                     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    clock_nanosleep                   Wait for the next tick            */
+/*    _tx_linux_timer_tick_suppressed   Check for a suppressed tick       */
+/*    _tx_thread_context_save           Save interrupted context          */
+/*    _tx_timer_interrupt               Process the timer interrupt       */
+/*    _tx_thread_context_restore        Restore interrupted context       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    pthread_create                                                      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+static VOID   *_tx_linux_timer_entry(VOID *timer_input)
+{
+
+struct timespec     next_tick;
+
+
+    /* Not used in this function.  */
+    (VOID) timer_input;
+
+    /* Wait for the scheduler to start.  */
+    while (sem_wait(&_tx_linux_timer_start_semaphore) != 0)
+    {
+    }
+
+    /* Pickup the time of the start.  */
+    clock_gettime(CLOCK_MONOTONIC, &next_tick);
+
+    /* Loop forever, one timer interrupt per tick.  */
+    while (1)
+    {
+
+        /* Compute the time of the next tick.  */
+        next_tick.tv_nsec =  next_tick.tv_nsec + ((long) TX_LINUX_TIMER_PERIOD);
+        while (next_tick.tv_nsec >= 1000000000L)
+        {
+            next_tick.tv_nsec =  next_tick.tv_nsec - 1000000000L;
+            next_tick.tv_sec++;
+        }
+
+        /* Wait for the next tick.  */
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_tick, TX_NULL) != 0)
+        {
+        }
+
+#ifdef TX_LOW_POWER
+
+        /* Skip the timer interrupt while it is suppressed.  */
+        if (_tx_linux_timer_tick_suppressed() == TX_TRUE)
+        {
+            continue;
+        }
+#endif
+
+        /* Process the timer interrupt.  */
+        _tx_thread_context_save();
+        _tx_timer_interrupt();
+        _tx_thread_context_restore();
+    }
+
+    /* Never reached.  */
+    return(TX_NULL);
+}
+
@@ -0,0 +1,835 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Linux Host Support                                                  */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include <stdio.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+
+
+/* Define the Linux port data.  */
+
+/* Define the host mutex that stands for interrupt lockout, and the flag that tells whether the
+   calling pthread holds it.  */
+
+static pthread_mutex_t          _tx_linux_mutex =  PTHREAD_MUTEX_INITIALIZER;
+static __thread UINT            _tx_linux_mutex_held;
+
+
+/* Define the ThreadX thread that runs on the calling pthread.  */
+
+static __thread TX_THREAD       *_tx_linux_thread_self;
+
+
+/* Define the semaphore posted whenever the scheduler should look for a thread to run.  */
+
+sem_t                           _tx_linux_scheduler_semaphore;
+
+
+/* Define the semaphore that starts the periodic timer interrupt.  */
+
+sem_t                           _tx_linux_timer_start_semaphore;
+
+
+/* Define the semaphore posted by an interrupted thread once it has stopped.  */
+
+sem_t                           _tx_linux_preempt_ack_semaphore;
+
+
+#ifdef TX_LOW_POWER
+
+/* Define the number of ticks until the next timer interrupt while the timer interrupt is
+   suppressed, and zero otherwise.  */
+
+static ULONG                    _tx_linux_timer_suppress_limit;
+
+
+/* Define the number of ticks suppressed so far.  */
+
+static ULONG                    _tx_linux_timer_suppress_count;
+
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_mutex_obtain                              Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function obtains the host mutex that stands for interrupt      */
+/*    lockout in the Linux port.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    pthread_mutex_lock                Lock the host mutex               */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX port functions                                              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_linux_mutex_obtain(VOID)
+{
+
+    /* Lock the host mutex.  */
+    pthread_mutex_lock(&_tx_linux_mutex);
+
+    /* Remember that this pthread has interrupts disabled.  */
+    _tx_linux_mutex_held =  TX_TRUE;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_mutex_release                             Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases the host mutex that stands for interrupt     */
+/*    lockout in the Linux port.                                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    pthread_mutex_unlock              Unlock the host mutex             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX port functions                                              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_linux_mutex_release(VOID)
+{
+
+    /* Clear the interrupt lockout flag of this pthread.  */
+    _tx_linux_mutex_held =  TX_FALSE;
+
+    /* Unlock the host mutex.  */
+    pthread_mutex_unlock(&_tx_linux_mutex);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_mutex_owned                               Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns whether the calling pthread holds the host    */
+/*    mutex that stands for interrupt lockout.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           Interrupts are disabled           */
+/*    TX_FALSE                          Interrupts are enabled            */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX port functions                                              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT   _tx_linux_mutex_owned(VOID)
+{
+
+    /* Return the interrupt lockout flag of this pthread.  */
+    return(_tx_linux_mutex_held);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_thread_entry                              Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the entry of the pthread behind a ThreadX thread.  */
+/*    It waits until the scheduler first runs the thread and then calls   */
+/*    the thread shell entry.                                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_input                      Pointer to the ThreadX thread     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_NULL                           Thread has completed              */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_linux_thread_wait             Wait to be scheduled              */
+/*    _tx_thread_shell_entry            Thread shell entry function       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    pthread_create                                                      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   *_tx_linux_thread_entry(VOID *thread_input)
+{
+
+TX_THREAD       *thread_ptr;
+
+
+    /* Pickup the thread pointer.  */
+    thread_ptr =  (TX_THREAD *) thread_input;
+
+    /* Remember the thread of this pthread for the preemption handler.  */
+    _tx_linux_thread_self =  thread_ptr;
+
+    /* Wait for the scheduler to run this thread for the first time.  */
+    _tx_linux_thread_wait(thread_ptr);
+
+    /* Call the entry function set up by the stack build.  */
+    (thread_ptr -> tx_thread_linux_thread_entry)();
+
+    /* The shell entry never returns.  */
+    return(TX_NULL);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_thread_wait                               Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function waits until the scheduler runs the specified thread   */
+/*    again. If the thread is deleted or reset meanwhile, its pthread     */
+/*    exits instead.                                                      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to the waiting thread     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    sem_wait                          Wait for the run semaphore        */
+/*    pthread_exit                      Exit the pthread                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_linux_thread_entry            Thread pthread entry              */
+/*    _tx_thread_system_return          Return to the system              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_linux_thread_wait(TX_THREAD *thread_ptr)
+{
+
+    /* Wait for the scheduler to post the run semaphore of this thread.  */
+    while (sem_wait(&thread_ptr -> tx_thread_linux_thread_run_semaphore) != 0)
+    {
+    }
+
+    /* Determine if the thread has been deleted or reset.  */
+    if (thread_ptr -> tx_thread_linux_thread_exit_request == TX_TRUE)
+    {
+
+        /* Yes, exit the pthread, the deleting thread joins it.  */
+        pthread_exit(TX_NULL);
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_thread_interrupt                          Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function stops the running thread when an interrupt begins. The*/
+/*    thread is stopped by a signal and stays in the signal handler until */
+/*    the interrupt either resumes it or the scheduler runs it again after*/
+/*    a preemption. The caller holds the interrupt lockout mutex, so the  */
+/*    thread is never stopped inside ThreadX.                             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to the running thread     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    pthread_kill                      Send the preemption signal        */
+/*    sem_wait                          Wait for the thread to stop       */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_context_save           Save interrupted context          */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_linux_thread_interrupt(TX_THREAD *thread_ptr)
+{
+
+    /* Send the preemption signal to the pthread of the thread.  */
+    pthread_kill(thread_ptr -> tx_thread_linux_thread_id, TX_LINUX_PREEMPT_SIGNAL);
+
+    /* Wait until the thread has stopped in the signal handler.  */
+    while (sem_wait(&_tx_linux_preempt_ack_semaphore) != 0)
+    {
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_thread_preempt_handler                    Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is the handler of the preemption signal. It tells the */
+/*    interrupt that the thread has stopped and waits until the thread is */
+/*    resumed.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    signal_number                     Preemption signal number          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    sem_post                          Acknowledge the stop              */
+/*    sem_wait                          Wait to be resumed                */
+/*    pthread_exit                      Exit the pthread                  */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Linux signal delivery                                               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_linux_thread_preempt_handler(INT signal_number)
+{
+
+TX_THREAD       *thread_ptr;
+INT             saved_errno;
+
+
+    /* Not used in this function.  */
+    (VOID) signal_number;
+
+    /* Preserve errno of the interrupted code.  */
+    saved_errno =  errno;
+
+    /* Pickup the thread of this pthread.  */
+    thread_ptr =  _tx_linux_thread_self;
+
+    /* Tell the interrupt that this thread has stopped.  */
+    sem_post(&_tx_linux_preempt_ack_semaphore);
+
+    /* Wait until the interrupt or the scheduler resumes this thread.  */
+    while (sem_wait(&thread_ptr -> tx_thread_linux_thread_preempt_semaphore) != 0)
+    {
+    }
+
+    /* Determine if the thread has been deleted or reset while it was stopped.  */
+    if (thread_ptr -> tx_thread_linux_thread_exit_request == TX_TRUE)
+    {
+
+        /* Yes, exit the pthread, the deleting thread joins it.  */
+        pthread_exit(TX_NULL);
+    }
+
+    /* Restore errno.  */
+    errno =  saved_errno;
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_thread_delete                             Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function releases the pthread behind a deleted or reset thread.*/
+/*    The thread is not running, so its pthread is waiting to be          */
+/*    scheduled. It is asked to exit, and this function joins it before   */
+/*    the semaphores it may still be leaving are released.                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to the thread             */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    sem_post                          Wake the thread pthread           */
+/*    pthread_join                      Wait for the pthread exit         */
+/*    sem_destroy                       Release the thread semaphores     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_delete                 Delete thread                     */
+/*    _tx_thread_reset                  Reset thread                      */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_linux_thread_delete(TX_THREAD *thread_ptr)
+{
+
+    /* Determine if the thread has a pthread.  */
+    if (thread_ptr -> tx_thread_linux_thread_created == TX_TRUE)
+    {
+
+        /* Ask the pthread to exit, wherever it waits.  */
+        thread_ptr -> tx_thread_linux_thread_exit_request =  TX_TRUE;
+        sem_post(&thread_ptr -> tx_thread_linux_thread_run_semaphore);
+        sem_post(&thread_ptr -> tx_thread_linux_thread_preempt_semaphore);
+
+        /* Wait until the pthread has exited. Its interrupted semaphore wait unwinds on the way
+           out, so the semaphores must not be released or created again before that.  */
+        pthread_join(thread_ptr -> tx_thread_linux_thread_id, TX_NULL);
+
+        /* Release the semaphores of the thread.  */
+        sem_destroy(&thread_ptr -> tx_thread_linux_thread_run_semaphore);
+        sem_destroy(&thread_ptr -> tx_thread_linux_thread_preempt_semaphore);
+
+        /* The thread no longer has a pthread.  */
+        thread_ptr -> tx_thread_linux_thread_created =  TX_FALSE;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_time_stamp_get                            Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the low 32 bits of the host monotonic clock in*/
+/*    nanoseconds. It is the trace time source of the Linux port.         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    time stamp                        Current time stamp                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    clock_gettime                     Read the host monotonic clock     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX trace                                                       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+ULONG   _tx_linux_time_stamp_get(VOID)
+{
+
+struct timespec     now;
+
+
+    /* Read the host monotonic clock.  */
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    /* Return the low 32 bits of the clock in nanoseconds.  */
+    return((ULONG) ((((ULONG64) now.tv_sec) * ((ULONG64) 1000000000)) + ((ULONG64) now.tv_nsec)));
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_execution_time_get                        Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the host monotonic clock in nanoseconds. It is*/
+/*    the time source of the execution profile kit in the Linux port.     */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    time                              Current time in nanoseconds       */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    clock_gettime                     Read the host monotonic clock     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Execution profile kit                                               */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+ULONG64 _tx_linux_execution_time_get(VOID)
+{
+
+struct timespec     now;
+
+
+    /* Read the host monotonic clock.  */
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    /* Return the clock in nanoseconds.  */
+    return((((ULONG64) now.tv_sec) * ((ULONG64) 1000000000)) + ((ULONG64) now.tv_nsec));
+}
+
+
+#ifdef TX_LOW_POWER
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_timer_suppress                            Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function suppresses the timer interrupt until the specified    */
+/*    number of ticks have passed. It is the TX_LOW_POWER_TIMER_SETUP     */
+/*    hook of the Linux port and is called with interrupts disabled.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    ticks                             Ticks until the next timer        */
+/*                                        interrupt, or TX_WAIT_FOREVER   */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_low_power_enter         Low power entry                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_linux_timer_suppress(ULONG ticks)
+{
+
+    /* Start counting the suppressed ticks.  */
+    _tx_linux_timer_suppress_limit =  ticks;
+    _tx_linux_timer_suppress_count =  ((ULONG) 0);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_timer_resume                              Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function restarts the timer interrupt and returns the number   */
+/*    of ticks suppressed. It is the TX_LOW_POWER_USER_TIMER_ADJUST hook  */
+/*    of the Linux port and is called with interrupts disabled.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    ticks                             Number of suppressed ticks        */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_timer_low_power_exit          Low power exit                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+ULONG  _tx_linux_timer_resume(VOID)
+{
+
+ULONG       ticks;
+
+
+    /* Pickup the number of suppressed ticks.  */
+    ticks =  _tx_linux_timer_suppress_count;
+
+    /* Stop suppressing the timer interrupt.  */
+    _tx_linux_timer_suppress_limit =  ((ULONG) 0);
+    _tx_linux_timer_suppress_count =  ((ULONG) 0);
+
+    /* Return the number of suppressed ticks.  */
+    return(ticks);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_linux_timer_tick_suppressed                     Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the timer pthread on every tick. It      */
+/*    counts the tick and returns TX_TRUE if the timer interrupt is       */
+/*    suppressed for it. The tick on which the timer interrupt processing */
+/*    has work is not suppressed.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_TRUE                           Tick is suppressed                */
+/*    TX_FALSE                          Timer interrupt is needed         */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_linux_mutex_obtain            Disable interrupts                */
+/*    _tx_linux_mutex_release           Enable interrupts                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_linux_timer_entry             Timer interrupt pthread           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT   _tx_linux_timer_tick_suppressed(VOID)
+{
+
+UINT        suppressed;
+
+
+    /* Disable interrupts.  */
+    _tx_linux_mutex_obtain();
+
+    /* Determine if the timer interrupt is suppressed and this is not the tick with work.  */
+    if ((_tx_linux_timer_suppress_limit != ((ULONG) 0)) &&
+        ((_tx_linux_timer_suppress_count + ((ULONG) 1)) < _tx_linux_timer_suppress_limit))
+    {
+
+        /* Yes, count the suppressed tick.  */
+        _tx_linux_timer_suppress_count++;
+        suppressed =  TX_TRUE;
+    }
+    else
+    {
+
+        /* No, the timer interrupt occurs on this tick.  */
+        suppressed =  TX_FALSE;
+    }
+
+    /* Enable interrupts.  */
+    _tx_linux_mutex_release();
+
+    /* Return whether the tick is suppressed.  */
+    return(suppressed);
+}
+
+#endif
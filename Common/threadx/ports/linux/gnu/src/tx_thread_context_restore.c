@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+
+/* Define the execution change notifications.  */
+
+VOID    _tx_execution_isr_exit(VOID);
+VOID    _tx_execution_thread_exit(VOID);
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_context_restore                          Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function restores the interrupt context if it is processing a  */
+/*    nested interrupt.  If not, it returns to the interrupt thread if no */
+/*    preemption is necessary.  Otherwise, if preemption is necessary or  */
+/*    if no thread was running, the function returns to the scheduler.    */
+/*                                                                        */
+/*    In the Linux port, the interrupted thread is resumed, or it is left */
+/*    stopped and the scheduler runs the thread to execute next.          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_isr_exit            Notify the ISR exit               */
+/*    _tx_execution_thread_exit         Notify the thread exit            */
+/*    sem_post                          Resume thread or scheduler        */
+/*    _tx_linux_mutex_release           Enable interrupts                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ISRs                                                                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_context_restore(VOID)
+{
+
+TX_THREAD       *thread_ptr;
+
+
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+
+    /* Call the ISR exit function to indicate an ISR is complete.  */
+    _tx_execution_isr_exit();
+#endif
+
+    /* Decrement the nested interrupt counter.  */
+    _tx_thread_system_state--;
+
+    /* Determine if this is the end of the outermost interrupt.  */
+    if (_tx_thread_system_state == ((ULONG) 0))
+    {
+
+        /* Pickup the interrupted thread.  */
+        thread_ptr =  _tx_thread_current_ptr;
+
+        /* Determine if a thread was interrupted.  */
+        if (thread_ptr != TX_NULL)
+        {
+
+            /* Determine if the interrupted thread is preempted.  */
+            if ((_tx_thread_preempt_disable == ((UINT) 0)) && (thread_ptr != _tx_thread_execute_ptr))
+            {
+
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+
+                /* Call the thread exit function to indicate the thread is no longer executing.  */
+                _tx_execution_thread_exit();
+#endif
+
+                /* Save the remaining time-slice and disable it.  */
+                thread_ptr -> tx_thread_time_slice =  _tx_timer_time_slice;
+                _tx_timer_time_slice =  ((ULONG) 0);
+
+                /* The thread stays stopped until the scheduler runs it again.  */
+                thread_ptr -> tx_thread_linux_thread_preempted =  TX_TRUE;
+
+                /* Clear the current thread pointer and return to the scheduler.  */
+                _tx_thread_current_ptr =  TX_NULL;
+                sem_post(&_tx_linux_scheduler_semaphore);
+            }
+            else
+            {
+
+                /* No preemption, resume the interrupted thread.  */
+                sem_post(&thread_ptr -> tx_thread_linux_thread_preempt_semaphore);
+            }
+        }
+        else
+        {
+
+            /* The system was idle, return to the scheduler, which runs the thread made ready
+               by the interrupt or goes idle again.  */
+            sem_post(&_tx_linux_scheduler_semaphore);
+        }
+    }
+
+    /* Enable interrupts.  */
+    _tx_linux_mutex_release();
+}
+
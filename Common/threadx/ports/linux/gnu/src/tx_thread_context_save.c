@@ -0,0 +1,118 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+
+/* Define the ISR execution change notification.  */
+
+VOID    _tx_execution_isr_enter(VOID);
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_context_save                             Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function saves the context of an executing thread in the       */
+/*    beginning of interrupt processing.  The function also ensures that  */
+/*    the system stack is used upon return to the calling ISR.            */
+/*                                                                        */
+/*    In the Linux port, an interrupt is a host pthread, for example the  */
+/*    timer pthread or a simulated device. It disables interrupts for the */
+/*    whole interrupt and stops the running thread, so ISR processing     */
+/*    never overlaps thread execution.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_linux_mutex_obtain            Disable interrupts                */
+/*    _tx_linux_thread_interrupt        Stop the running thread           */
+/*    _tx_execution_isr_enter           Notify the ISR entry              */
+/*    _tx_timer_low_power_exit          Account for suppressed ticks      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ISRs                                                                */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_context_save(VOID)
+{
+
+    /* Disable interrupts for the duration of the interrupt.  */
+    _tx_linux_mutex_obtain();
+
+    /* Determine if a thread was interrupted.  */
+    if ((_tx_thread_system_state == ((ULONG) 0)) && (_tx_thread_current_ptr != TX_NULL))
+    {
+
+        /* Yes, stop the running thread.  */
+        _tx_linux_thread_interrupt(_tx_thread_current_ptr);
+    }
+
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+
+    /* Call the ISR enter function to indicate an ISR is executing.  */
+    _tx_execution_isr_enter();
+#endif
+
+    /* Increment the nested interrupt counter.  */
+    _tx_thread_system_state++;
+
+#ifdef TX_LOW_POWER
+
+    /* Bring the system clock and timers up to date if the timer interrupt was suppressed,
+       before the interrupt processing uses them.  */
+    _tx_timer_low_power_exit();
+#endif
+}
+
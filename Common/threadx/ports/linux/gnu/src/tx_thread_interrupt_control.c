@@ -0,0 +1,105 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_interrupt_control                        Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is responsible for changing the interrupt lockout     */
+/*    posture of the system.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    new_posture                       New interrupt lockout posture     */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    old_posture                       Old interrupt lockout posture     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_linux_mutex_owned             Get the lockout posture           */
+/*    _tx_linux_mutex_obtain            Disable interrupts                */
+/*    _tx_linux_mutex_release           Enable interrupts                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT   _tx_thread_interrupt_control(UINT new_posture)
+{
+
+UINT        old_posture;
+
+
+    /* Pickup the current interrupt lockout posture.  */
+    if (_tx_linux_mutex_owned() == TX_TRUE)
+    {
+        old_posture =  TX_INT_DISABLE;
+    }
+    else
+    {
+        old_posture =  TX_INT_ENABLE;
+    }
+
+    /* Apply the new interrupt lockout posture.  */
+    if ((new_posture == TX_INT_DISABLE) && (old_posture == TX_INT_ENABLE))
+    {
+
+        /* Disable interrupts.  */
+        _tx_linux_mutex_obtain();
+    }
+    else if ((new_posture == TX_INT_ENABLE) && (old_posture == TX_INT_DISABLE))
+    {
+
+        /* Enable interrupts.  */
+        _tx_linux_mutex_release();
+    }
+
+    /* Return the previous interrupt lockout posture.  */
+    return(old_posture);
+}
+
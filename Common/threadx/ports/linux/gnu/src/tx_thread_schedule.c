@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+
+/* Define the thread execution change notification.  */
+
+VOID    _tx_execution_thread_enter(VOID);
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_schedule                                 Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function waits for a thread control block pointer to appear in */
+/*    the _tx_thread_execute_ptr variable.  Once a thread pointer appears */
+/*    in the variable, the corresponding thread is resumed.               */
+/*                                                                        */
+/*    In the Linux port, the scheduler runs on the pthread that called    */
+/*    tx_kernel_enter. It sleeps until a thread returns to the system or  */
+/*    an interrupt makes a thread ready, and then wakes up the pthread of */
+/*    the thread to execute. The timer interrupt starts here.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    sem_post                          Start the timer, resume thread    */
+/*    sem_wait                          Wait for scheduling requests      */
+/*    _tx_linux_mutex_obtain            Disable interrupts                */
+/*    _tx_linux_mutex_release           Enable interrupts                 */
+/*    _tx_execution_thread_enter        Notify the thread entry           */
+/*    _tx_timer_low_power_enter         Suppress the timer interrupt      */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_initialize_kernel_enter       ThreadX entry function            */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_schedule(VOID)
+{
+
+TX_THREAD       *thread_ptr;
+
+
+    /* Start the timer interrupt.  */
+    sem_post(&_tx_linux_timer_start_semaphore);
+
+    /* Look for a thread to execute right away.  */
+    sem_post(&_tx_linux_scheduler_semaphore);
+
+    /* Loop forever.  */
+    while (1)
+    {
+
+        /* Wait for a scheduling request.  */
+        while (sem_wait(&_tx_linux_scheduler_semaphore) != 0)
+        {
+        }
+
+        /* Disable interrupts.  */
+        _tx_linux_mutex_obtain();
+
+        /* Determine if no thread runs and a thread is ready to execute.  */
+        thread_ptr =  _tx_thread_execute_ptr;
+        if ((_tx_thread_current_ptr == TX_NULL) && (thread_ptr != TX_NULL))
+        {
+
+            /* Yes, setup the current thread pointer.  */
+            _tx_thread_current_ptr =  thread_ptr;
+
+            /* Increment the run count for this thread.  */
+            thread_ptr -> tx_thread_run_count++;
+
+            /* Setup time-slice, if present.  */
+            _tx_timer_time_slice =  thread_ptr -> tx_thread_time_slice;
+
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+
+            /* Call the thread entry function to indicate the thread is executing.  */
+            _tx_execution_thread_enter();
+#endif
+
+            /* Determine if the thread was preempted by an interrupt.  */
+            if (thread_ptr -> tx_thread_linux_thread_preempted == TX_TRUE)
+            {
+
+                /* Yes, resume it in the preemption handler.  */
+                thread_ptr -> tx_thread_linux_thread_preempted =  TX_FALSE;
+                sem_post(&thread_ptr -> tx_thread_linux_thread_preempt_semaphore);
+            }
+            else
+            {
+
+                /* No, resume it where it returned to the system.  */
+                sem_post(&thread_ptr -> tx_thread_linux_thread_run_semaphore);
+            }
+        }
+#ifdef TX_LOW_POWER
+        else if ((_tx_thread_current_ptr == TX_NULL) && (thread_ptr == TX_NULL))
+        {
+
+            /* The system is idle, suppress the timer interrupt until it has work.  */
+            _tx_timer_low_power_enter();
+        }
+#endif
+
+        /* Enable interrupts.  */
+        _tx_linux_mutex_release();
+    }
+}
+
@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include <stdio.h>
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_stack_build                              Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function builds a stack frame on the supplied thread's stack.  */
+/*    The stack frame results in a fake interrupt return to the supplied  */
+/*    function pointer.                                                   */
+/*                                                                        */
+/*    In the Linux port, the thread runs on a host pthread with its own   */
+/*    stack. The pthread is created here and waits until the scheduler    */
+/*    first runs the thread.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread control blk     */
+/*    function_ptr                      Pointer to return function        */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    sem_init                          Create the thread semaphores      */
+/*    pthread_create                    Create the thread pthread         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_thread_create                 Create thread service             */
+/*    _tx_thread_reset                  Reset thread service              */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_stack_build(TX_THREAD *thread_ptr, VOID (*function_ptr)(VOID))
+{
+
+pthread_attr_t      attributes;
+
+
+    /* Setup the function the pthread calls once the thread first runs.  */
+    thread_ptr -> tx_thread_linux_thread_entry =  function_ptr;
+
+    /* Clear the port state of the thread.  */
+    thread_ptr -> tx_thread_linux_thread_preempted =     TX_FALSE;
+    thread_ptr -> tx_thread_linux_thread_exit_request =  TX_FALSE;
+    thread_ptr -> tx_thread_linux_int_disabled_flag =    TX_FALSE;
+
+    /* Create the semaphores the thread waits on while it is not running.  */
+    sem_init(&thread_ptr -> tx_thread_linux_thread_run_semaphore, 0, 0);
+    sem_init(&thread_ptr -> tx_thread_linux_thread_preempt_semaphore, 0, 0);
+
+    /* Create the pthread of the thread.  */
+    pthread_attr_init(&attributes);
+    pthread_attr_setstacksize(&attributes, TX_LINUX_THREAD_STACK_SIZE);
+    if (pthread_create(&thread_ptr -> tx_thread_linux_thread_id, &attributes, _tx_linux_thread_entry, (VOID *) thread_ptr) != 0)
+    {
+
+        /* The simulation cannot run without it.  */
+        fprintf(stderr, "ThreadX Linux port: unable to create the pthread of a thread\n");
+        exit(EXIT_FAILURE);
+    }
+    pthread_attr_destroy(&attributes);
+    thread_ptr -> tx_thread_linux_thread_created =  TX_TRUE;
+
+    /* The ThreadX stack is not used, setup the stack pointer at its end.  */
+    thread_ptr -> tx_thread_stack_ptr =  thread_ptr -> tx_thread_stack_end;
+}
+
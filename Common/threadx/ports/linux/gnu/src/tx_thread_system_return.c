@@ -0,0 +1,134 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Thread                                                              */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_timer.h"
+
+
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+
+/* Define the thread execution change notification.  */
+
+VOID    _tx_execution_thread_exit(VOID);
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_thread_system_return                            Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is target processor specific.  It is used to transfer */
+/*    control from a thread back to the ThreadX system.  Only a           */
+/*    minimal context is saved since the compiler assumes temp registers  */
+/*    are going to get slicked by a function call anyway.                 */
+/*                                                                        */
+/*    In the Linux port, the thread gives up the processor and its        */
+/*    pthread waits until the scheduler runs the thread again. The        */
+/*    interrupt lockout posture of the thread is kept across the wait.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_linux_mutex_obtain            Disable interrupts                */
+/*    _tx_linux_mutex_release           Enable interrupts                 */
+/*    _tx_execution_thread_exit         Notify the thread exit            */
+/*    sem_post                          Return to the scheduler           */
+/*    _tx_linux_thread_wait             Wait to be scheduled              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX components                                                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_thread_system_return(VOID)
+{
+
+TX_THREAD       *thread_ptr;
+
+
+    /* Save the interrupt lockout posture of the thread and disable interrupts.  */
+    if (_tx_linux_mutex_owned() == TX_TRUE)
+    {
+        thread_ptr =  _tx_thread_current_ptr;
+        thread_ptr -> tx_thread_linux_int_disabled_flag =  TX_TRUE;
+    }
+    else
+    {
+        _tx_linux_mutex_obtain();
+        thread_ptr =  _tx_thread_current_ptr;
+        thread_ptr -> tx_thread_linux_int_disabled_flag =  TX_FALSE;
+    }
+
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+
+    /* Call the thread exit function to indicate the thread is no longer executing.  */
+    _tx_execution_thread_exit();
+#endif
+
+    /* Save the remaining time-slice and disable it.  */
+    thread_ptr -> tx_thread_time_slice =  _tx_timer_time_slice;
+    _tx_timer_time_slice =  ((ULONG) 0);
+
+    /* Clear the current thread pointer and return to the scheduler.  */
+    _tx_thread_current_ptr =  TX_NULL;
+    sem_post(&_tx_linux_scheduler_semaphore);
+
+    /* Enable interrupts while the thread waits.  */
+    _tx_linux_mutex_release();
+
+    /* Wait until the scheduler runs this thread again.  */
+    _tx_linux_thread_wait(thread_ptr);
+
+    /* Restore the interrupt lockout posture of the thread.  */
+    if (thread_ptr -> tx_thread_linux_int_disabled_flag == TX_TRUE)
+    {
+        _tx_linux_mutex_obtain();
+    }
+}
+
@@ -0,0 +1,144 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Timer                                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_timer.h"
+#include "tx_thread.h"
+
+
+/* Define the timer interrupt function, which has no prototype in the common headers.  */
+
+VOID    _tx_timer_interrupt(VOID);
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_timer_interrupt                                 Linux/GNU       */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function processes the hardware timer interrupt.  This         */
+/*    processing includes incrementing the system clock and checking for  */
+/*    time slice and/or timer expiration.  If either is found, the        */
+/*    expiration functions are called.                                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_timer_expiration_process      Timer expiration processing       */
+/*    _tx_thread_time_slice             Time slice interrupted thread     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_linux_timer_entry             Timer interrupt pthread           */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID   _tx_timer_interrupt(VOID)
+{
+
+    /* Increment the system clock.  */
+    _tx_timer_system_clock++;
+
+    /* Test for time-slice expiration.  */
+    if (_tx_timer_time_slice != ((ULONG) 0))
+    {
+
+        /* Decrement the time_slice.  */
+        _tx_timer_time_slice--;
+
+        /* Check for expiration.  */
+        if (_tx_timer_time_slice == ((ULONG) 0))
+        {
+
+            /* Set the time-slice expired flag.  */
+            _tx_timer_expired_time_slice =  TX_TRUE;
+        }
+    }
+
+    /* Test for timer expiration.  */
+    if (*_tx_timer_current_ptr != TX_NULL)
+    {
+
+        /* Set expiration flag.  */
+        _tx_timer_expired =  TX_TRUE;
+    }
+    else
+    {
+
+        /* No timer expired, increment the timer pointer.  */
+        _tx_timer_current_ptr++;
+
+        /* Check for wrap-around.  */
+        if (_tx_timer_current_ptr == _tx_timer_list_end)
+        {
+
+            /* Wrap to beginning of list.  */
+            _tx_timer_current_ptr =  _tx_timer_list_start;
+        }
+    }
+
+    /* See if anything has expired.  */
+    if ((_tx_timer_expired_time_slice != TX_FALSE) || (_tx_timer_expired != TX_FALSE))
+    {
+
+        /* Did a timer expire?  */
+        if (_tx_timer_expired != TX_FALSE)
+        {
+
+            /* Process timer expiration.  */
+            _tx_timer_expiration_process();
+        }
+
+        /* Did time slice expire?  */
+        if (_tx_timer_expired_time_slice != TX_FALSE)
+        {
+
+            /* Time slice interrupted thread.  */
+            _tx_thread_time_slice();
+        }
+    }
+}
+
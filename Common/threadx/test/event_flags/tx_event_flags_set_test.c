@@ -0,0 +1,483 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks which threads a set of event flags resumes, with and without
+   TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS. 16 threads wait for a single flag each, 4 wait for two
+   flags with AND and 4 for two flags with OR, one of which is also waited for by a single flag
+   thread, and the 4 highest flags are not waited for. A set must resume exactly the threads whose
+   request it satisfies, also when several threads wait for the same flag, and the flags set that no
+   thread waits for must stay set. Threads whose wait timed out, was aborted or that were terminated
+   must no longer be resumed. 2000 sets of random flags must resume the threads a model of the
+   group predicts. Then a periodic timer, which runs in the timer interrupt when
+   TX_TIMER_PROCESS_IN_ISR is defined, sets random flags and aborts random waits while the test
+   thread sets flags, which resets the search of sets it interrupts. Afterwards every thread must be
+   suspended again, without a request the current flags satisfy, and when the buckets are enabled,
+   each suspended thread must be in the bucket of its flags. Deleting the group resumes all the
+   threads.  */
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+
+#define TEST_STACK_WORDS        1024
+#define TEST_WAITERS            24
+#define TEST_SINGLE_WAITERS     16
+#define TEST_AND_WAITERS        4
+#define TEST_UNWATCHED_FLAGS    ((ULONG) 0xF0000000UL)
+#define TEST_RANDOM_SETS        2000
+#define TEST_STRESS_TICKS       500
+
+
+static UINT                 test_failures;
+static TX_THREAD            test_thread;
+static ULONG                test_thread_stack[TEST_STACK_WORDS];
+static TX_THREAD            test_waiter[TEST_WAITERS];
+static ULONG                test_waiter_stack[TEST_WAITERS][TEST_STACK_WORDS];
+static TX_EVENT_FLAGS_GROUP test_group;
+static TX_TIMER             test_timer;
+static ULONG                test_request[TEST_WAITERS];
+static UINT                 test_option[TEST_WAITERS];
+static ULONG                test_wait[TEST_WAITERS];
+static UINT                 test_status[TEST_WAITERS];
+static ULONG                test_actual[TEST_WAITERS];
+static ULONG                test_wakes[TEST_WAITERS];
+static ULONG                test_expected[TEST_WAITERS];
+static UINT                 test_park;
+static ULONG                test_random;
+static ULONG                test_isr_random;
+static ULONG                test_isr_sets;
+static ULONG                test_isr_aborts;
+static ULONG                test_isr_interrupted;
+
+
+static VOID test_check(UINT condition, const CHAR *name)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s\n", name);
+        test_failures++;
+    }
+}
+
+
+static ULONG test_random_get(ULONG *random)
+{
+
+    *random =  (*random * 1103515245UL) + 12345UL;
+    return((*random >> 8) ^ (*random << 16));
+}
+
+
+/* Determine if a request is satisfied by the flags.  */
+
+static UINT test_satisfied(ULONG request, UINT option, ULONG flags)
+{
+
+    if ((option == TX_AND) || (option == TX_AND_CLEAR))
+    {
+        return((flags & request) == request);
+    }
+    return((flags & request) != ((ULONG) 0));
+}
+
+
+/* Each waiter waits for its request again and again. When the test parks the waiters, a waiter
+   that is not satisfied suspends itself until the test resumes it.  */
+
+static VOID test_waiter_entry(ULONG index)
+{
+
+ULONG   actual;
+UINT    status;
+
+
+    while (1)
+    {
+        actual =  0;
+        status =  tx_event_flags_get(&test_group, test_request[index], test_option[index], &actual, test_wait[index]);
+        test_status[index] =  status;
+        test_actual[index] =  actual;
+        test_wakes[index]++;
+        if ((status != TX_SUCCESS) && (test_park == TX_TRUE))
+        {
+            tx_thread_suspend(&test_waiter[index]);
+        }
+    }
+}
+
+
+/* Set flags from the timer, in the timer interrupt when TX_TIMER_PROCESS_IN_ISR is defined, and
+   abort a wait now and then.  */
+
+static VOID test_isr(ULONG input)
+{
+
+ULONG   random;
+
+
+    TX_PARAMETER_NOT_USED(input);
+
+    /* Count the sets interrupted while they search the suspended threads.  */
+    if ((test_group.tx_event_flags_group_suspension_list == TX_NULL) &&
+        (test_group.tx_event_flags_group_suspended_count != TX_NO_SUSPENSIONS))
+    {
+        test_isr_interrupted++;
+    }
+
+    random =  test_random_get(&test_isr_random);
+    tx_event_flags_set(&test_group, random & ~TEST_UNWATCHED_FLAGS, TX_OR);
+    test_isr_sets++;
+    if ((random % 4) == 0)
+    {
+        tx_thread_wait_abort(&test_waiter[(random >> 4) % TEST_WAITERS]);
+        test_isr_aborts++;
+    }
+}
+
+
+/* Check that the expected threads were resumed since the last check, and that all the threads
+   wait again.  */
+
+static VOID test_wakes_check(const CHAR *name)
+{
+
+ULONG   suspended;
+UINT    i;
+UINT    wakes_ok;
+
+
+    wakes_ok =  TX_TRUE;
+    for (i = 0; i < TEST_WAITERS; i++)
+    {
+        if (test_wakes[i] != test_expected[i])
+        {
+            wakes_ok =  TX_FALSE;
+        }
+        test_wakes[i] =     0;
+        test_expected[i] =  0;
+    }
+    test_check(wakes_ok, name);
+    tx_event_flags_info_get(&test_group, TX_NULL, TX_NULL, TX_NULL, &suspended, TX_NULL);
+    test_check(suspended == TEST_WAITERS, "all waiting again");
+}
+
+
+/* Check that each suspended thread is in the bucket of its flags, and that the buckets hold only
+   the suspended threads.  */
+
+static VOID test_buckets_check(const CHAR *name)
+{
+
+#ifdef TX_EVENT_FLAGS_ENABLE_WAITER_BUCKETS
+
+TX_THREAD   *thread_ptr;
+ULONG       request;
+UINT        bucket;
+UINT        expected;
+UINT        count;
+UINT        several;
+UINT        buckets_ok;
+
+
+    buckets_ok =  TX_TRUE;
+    count =       0;
+    several =     0;
+    for (bucket = 0; bucket < TX_EVENT_FLAGS_BUCKETS; bucket++)
+    {
+        thread_ptr =  test_group.tx_event_flags_group_bucket[bucket];
+        while ((thread_ptr != TX_NULL) && (count <= TEST_WAITERS))
+        {
+            request =   thread_ptr -> tx_thread_suspend_info;
+            expected =  TX_EVENT_FLAGS_BUCKET_SEVERAL;
+            if ((request & (request - 1)) == 0)
+            {
+                for (expected = 0; (request >> expected) != 1; expected++)
+                {
+                }
+            }
+            if ((expected != bucket) || (thread_ptr -> tx_thread_state != TX_EVENT_FLAG) ||
+                (thread_ptr -> tx_thread_suspend_control_block != &test_group))
+            {
+                buckets_ok =  TX_FALSE;
+            }
+            count++;
+            if (bucket == TX_EVENT_FLAGS_BUCKET_SEVERAL)
+            {
+                several++;
+            }
+            thread_ptr =  thread_ptr -> tx_thread_event_flags_bucket_next;
+            if (thread_ptr == test_group.tx_event_flags_group_bucket[bucket])
+            {
+                thread_ptr =  TX_NULL;
+            }
+        }
+    }
+    test_check(buckets_ok && (count == test_group.tx_event_flags_group_suspended_count) &&
+               (several == test_group.tx_event_flags_group_several_count), name);
+#else
+
+    TX_PARAMETER_NOT_USED(name);
+#endif
+}
+
+
+/* Change the request of a waiter, and let it wait again.  */
+
+static VOID test_request_change(UINT index, ULONG request, ULONG wait)
+{
+
+    test_request[index] =  request;
+    test_wait[index] =     wait;
+    tx_thread_wait_abort(&test_waiter[index]);
+    tx_thread_resume(&test_waiter[index]);
+    test_wakes[index] =    0;
+}
+
+
+static VOID test_entry(ULONG input)
+{
+
+ULONG   current;
+ULONG   snapshot;
+ULONG   flags;
+ULONG   suspended;
+UINT    round;
+UINT    i;
+UINT    resumed_ok;
+
+
+    TX_PARAMETER_NOT_USED(input);
+
+    test_random =      1;
+    test_isr_random =  7;
+    test_check(tx_event_flags_create(&test_group, "test") == TX_SUCCESS, "create");
+    test_check(tx_timer_create(&test_timer, "isr", test_isr, 0, 1, 1, TX_NO_ACTIVATE) == TX_SUCCESS, "create timer");
+
+    /* Setup the requests: 16 single flags, 4 AND pairs of flags 16 to 23, and 4 OR pairs of one
+       of flags 0 to 3 and one of flags 24 to 27.  */
+    for (i = 0; i < TEST_WAITERS; i++)
+    {
+        if (i < TEST_SINGLE_WAITERS)
+        {
+            test_request[i] =  ((ULONG) 1) << i;
+            test_option[i] =   TX_OR_CLEAR;
+        }
+        else if (i < (TEST_SINGLE_WAITERS + TEST_AND_WAITERS))
+        {
+            test_request[i] =  ((ULONG) 3) << (16 + ((i - TEST_SINGLE_WAITERS) * 2));
+            test_option[i] =   TX_AND_CLEAR;
+        }
+        else
+        {
+            test_request[i] =  (((ULONG) 1) << (i - TEST_SINGLE_WAITERS - TEST_AND_WAITERS)) |
+                               (((ULONG) 1) << (24 + (i - TEST_SINGLE_WAITERS - TEST_AND_WAITERS)));
+            test_option[i] =   TX_OR_CLEAR;
+        }
+        test_wait[i] =  TX_WAIT_FOREVER;
+        tx_thread_create(&test_waiter[i], "waiter", test_waiter_entry, i, test_waiter_stack[i], sizeof(test_waiter_stack[i]),
+                         1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+    }
+    test_park =  TX_TRUE;
+    test_wakes_check("nothing resumed at start");
+    test_buckets_check("buckets at start");
+
+    /* A single flag resumes its thread only.  */
+    tx_event_flags_set(&test_group, ((ULONG) 1) << 5, TX_OR);
+    test_expected[5] =  1;
+    test_check((test_status[5] == TX_SUCCESS) && ((test_actual[5] & (((ULONG) 1) << 5)) != 0), "single flag status");
+    test_wakes_check("single flag");
+    tx_event_flags_info_get(&test_group, TX_NULL, &current, TX_NULL, TX_NULL, TX_NULL);
+    test_check(current == 0, "single flag cleared");
+
+    /* Flags no thread waits for resume nothing and stay set.  */
+    tx_event_flags_set(&test_group, TEST_UNWATCHED_FLAGS, TX_OR);
+    test_wakes_check("unwatched flags");
+    tx_event_flags_info_get(&test_group, TX_NULL, &current, TX_NULL, TX_NULL, TX_NULL);
+    test_check(current == TEST_UNWATCHED_FLAGS, "unwatched flags stay set");
+    tx_event_flags_set(&test_group, ~TEST_UNWATCHED_FLAGS, TX_AND);
+
+    /* An AND request is resumed once both of its flags are set.  */
+    tx_event_flags_set(&test_group, ((ULONG) 1) << 16, TX_OR);
+    test_wakes_check("half of an AND request");
+    tx_event_flags_set(&test_group, ((ULONG) 1) << 17, TX_OR);
+    test_expected[16] =  1;
+    test_check(test_actual[16] == (((ULONG) 3) << 16), "AND request actual flags");
+    test_wakes_check("AND request");
+
+    /* An OR request is resumed by either of its flags, also with the thread waiting for the same
+       single flag.  */
+    tx_event_flags_set(&test_group, ((ULONG) 1) << 24, TX_OR);
+    test_expected[20] =  1;
+    test_wakes_check("OR request");
+    tx_event_flags_set(&test_group, ((ULONG) 1) << 1, TX_OR);
+    test_expected[1] =   1;
+    test_expected[21] =  1;
+    test_wakes_check("single and OR request on the same flag");
+
+    /* Several flags resume the single, AND and OR requests they satisfy.  */
+    tx_event_flags_set(&test_group, (((ULONG) 3) << 6) | (((ULONG) 3) << 18) | (((ULONG) 1) << 25), TX_OR);
+    test_expected[6] =   1;
+    test_expected[7] =   1;
+    test_expected[17] =  1;
+    test_expected[21] =  1;
+    test_wakes_check("several flags");
+    tx_event_flags_info_get(&test_group, TX_NULL, &current, TX_NULL, TX_NULL, TX_NULL);
+    test_check(current == 0, "several flags cleared");
+    test_buckets_check("buckets after sets");
+
+    /* A thread whose wait timed out is not resumed.  */
+    test_request_change(10, ((ULONG) 1) << 10, 5);
+    tx_thread_sleep(10);
+    test_check(test_status[10] == TX_NO_EVENTS, "timeout");
+    test_check(test_waiter[10].tx_thread_state == TX_SUSPENDED, "timed out waiter parked");
+    test_buckets_check("buckets after a timeout");
+    tx_event_flags_set(&test_group, ((ULONG) 1) << 10, TX_OR);
+    tx_event_flags_info_get(&test_group, TX_NULL, &current, TX_NULL, &suspended, TX_NULL);
+    test_check((current == (((ULONG) 1) << 10)) && (suspended == (TEST_WAITERS - 1)), "flag of a timed out wait stays set");
+    tx_event_flags_set(&test_group, 0, TX_AND);
+    test_request_change(10, ((ULONG) 1) << 10, TX_WAIT_FOREVER);
+    test_wakes_check("after a timeout");
+
+    /* A thread whose wait for several flags was aborted is not resumed.  */
+    tx_thread_wait_abort(&test_waiter[18]);
+    test_check(test_status[18] == TX_WAIT_ABORTED, "wait abort");
+    test_buckets_check("buckets after a wait abort");
+    tx_event_flags_set(&test_group, ((ULONG) 3) << 20, TX_OR);
+    tx_event_flags_info_get(&test_group, TX_NULL, &current, TX_NULL, &suspended, TX_NULL);
+    test_check((current == (((ULONG) 3) << 20)) && (suspended == (TEST_WAITERS - 1)), "flags of an aborted wait stay set");
+    tx_event_flags_set(&test_group, 0, TX_AND);
+    test_request_change(18, ((ULONG) 3) << 20, TX_WAIT_FOREVER);
+    test_wakes_check("after a wait abort");
+
+    /* Two threads waiting for the same flag are both resumed, even though the first clears it.  */
+    test_request_change(11, ((ULONG) 1) << 3, TX_WAIT_FOREVER);
+    tx_event_flags_set(&test_group, ((ULONG) 1) << 3, TX_OR);
+    test_expected[3] =   1;
+    test_expected[11] =  1;
+    test_expected[23] =  1;
+    test_wakes_check("two threads on the same flag");
+    test_request_change(11, ((ULONG) 1) << 11, TX_WAIT_FOREVER);
+    test_wakes_check("after two threads on the same flag");
+
+    /* A terminated thread is not resumed.  */
+    tx_thread_terminate(&test_waiter[12]);
+    test_buckets_check("buckets after a terminate");
+    tx_event_flags_set(&test_group, ((ULONG) 1) << 12, TX_OR);
+    tx_event_flags_info_get(&test_group, TX_NULL, &current, TX_NULL, &suspended, TX_NULL);
+    test_check((current == (((ULONG) 1) << 12)) && (suspended == (TEST_WAITERS - 1)), "flag of a terminated thread stays set");
+    tx_event_flags_set(&test_group, 0, TX_AND);
+    tx_thread_reset(&test_waiter[12]);
+    tx_thread_resume(&test_waiter[12]);
+    test_wakes[12] =  0;
+    test_wakes_check("after a terminate");
+
+    /* Random flags resume the threads the model of the group predicts.  */
+    current =     0;
+    resumed_ok =  TX_TRUE;
+    for (round = 0; round < TEST_RANDOM_SETS; round++)
+    {
+        flags =     test_random_get(&test_random) & test_random_get(&test_random);
+        current =   current | flags;
+        snapshot =  current;
+        for (i = 0; i < TEST_WAITERS; i++)
+        {
+            if (test_satisfied(test_request[i], test_option[i], snapshot))
+            {
+                test_expected[i]++;
+                current =  current & ~test_request[i];
+            }
+        }
+        tx_event_flags_set(&test_group, flags, TX_OR);
+        tx_event_flags_info_get(&test_group, TX_NULL, &snapshot, TX_NULL, TX_NULL, TX_NULL);
+        if (snapshot != current)
+        {
+            resumed_ok =  TX_FALSE;
+        }
+    }
+    test_check(resumed_ok, "random flags left set");
+    test_wakes_check("random flags");
+    test_buckets_check("buckets after random flags");
+    tx_event_flags_set(&test_group, 0, TX_AND);
+
+    /* Set flags and abort waits from the timer while the test thread sets flags.  */
+    test_park =  TX_FALSE;
+    tx_timer_activate(&test_timer);
+    for (round = 0; tx_timer_info_get(&test_timer, TX_NULL, TX_NULL, TX_NULL, TX_NULL, TX_NULL) == TX_SUCCESS; round++)
+    {
+        tx_event_flags_set(&test_group, test_random_get(&test_random) & ~TEST_UNWATCHED_FLAGS, TX_OR);
+        if (test_isr_sets >= TEST_STRESS_TICKS)
+        {
+            break;
+        }
+    }
+    tx_timer_deactivate(&test_timer);
+    tx_thread_sleep(2);
+
+    /* Every thread waits again, and none for a request the current flags satisfy.  */
+    tx_event_flags_info_get(&test_group, TX_NULL, &current, TX_NULL, &suspended, TX_NULL);
+    test_check(suspended == TEST_WAITERS, "all waiting after the timer");
+    resumed_ok =  TX_TRUE;
+    for (i = 0; i < TEST_WAITERS; i++)
+    {
+        if ((test_waiter[i].tx_thread_state != TX_EVENT_FLAG) || (test_satisfied(test_request[i], test_option[i], current)))
+        {
+            resumed_ok =  TX_FALSE;
+        }
+    }
+    test_check(resumed_ok, "no request left satisfied after the timer");
+    test_buckets_check("buckets after the timer");
+
+    /* Deleting the group resumes all the threads.  */
+    test_park =  TX_TRUE;
+    for (i = 0; i < TEST_WAITERS; i++)
+    {
+        test_status[i] =  TX_SUCCESS;
+    }
+    test_check(tx_event_flags_delete(&test_group) == TX_SUCCESS, "delete");
+    resumed_ok =  TX_TRUE;
+    for (i = 0; i < TEST_WAITERS; i++)
+    {
+        if (test_status[i] != TX_DELETED)
+        {
+            resumed_ok =  TX_FALSE;
+        }
+    }
+    test_check(resumed_ok, "all resumed by the delete");
+
+    printf("%u sets in the test thread and %lu in the timer, %lu waits aborted, %lu searches interrupted\n",
+           round, (unsigned long) test_isr_sets, (unsigned long) test_isr_aborts, (unsigned long) test_isr_interrupted);
+    if (test_failures != 0)
+    {
+        exit(1);
+    }
+    printf("tx_event_flags_set_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    TX_PARAMETER_NOT_USED(first_unused_memory);
+
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
@@ -0,0 +1,226 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks the object pool kit, built with TX_OBJECT_POOL_ENABLE_POISON. Bad pools and
+   arguments are refused. A pool of 4 objects gives out 4 distinct poisoned objects and then fails
+   until an object is returned, which is given out again. Frees of objects twice, to the wrong pool
+   or outside of the pool are rejected and change nothing. A thread waiting on the empty pool gets
+   the next object returned, and a timed out allocation fails. A write to a free object is counted
+   as a corruption when it is allocated again. The objects in use, the most ever in use, the
+   allocations and the failures are counted, and pools are on the created list until deleted.  */
+
+#include "tx_api.h"
+#include "tx_object_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+
+#define TEST_STACK_WORDS        1024
+#define TEST_OBJECT_SIZE        40
+#define TEST_OBJECTS            4
+#define TEST_POOL_SIZE          ((TEST_OBJECT_SIZE + sizeof(UCHAR *)) * TEST_OBJECTS)
+
+
+static UINT             test_failures;
+static TX_THREAD        test_thread;
+static TX_THREAD        test_waiter_thread;
+static ULONG            test_thread_stack[TEST_STACK_WORDS];
+static ULONG            test_waiter_thread_stack[TEST_STACK_WORDS];
+static TX_OBJECT_POOL   test_pool;
+static TX_OBJECT_POOL   test_other_pool;
+static ULONG            test_pool_memory[TEST_POOL_SIZE / sizeof(ULONG)];
+static ULONG            test_other_pool_memory[TEST_POOL_SIZE / sizeof(ULONG)];
+static VOID             *test_objects[TEST_OBJECTS + 1];
+static VOID             *test_waiter_object;
+static UINT             test_waiter_status;
+
+
+static VOID test_check(UINT condition, const CHAR *name)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s\n", name);
+        test_failures++;
+    }
+}
+
+
+/* Check the objects in use, the most ever in use, the allocations and the failed allocations of
+   the test pool.  */
+
+static VOID test_counts_check(ULONG in_use, ULONG high_water, ULONG allocations, ULONG failures, const CHAR *name)
+{
+
+ULONG   pool_in_use;
+ULONG   pool_high_water;
+ULONG   pool_allocations;
+ULONG   pool_failures;
+
+
+    test_check((_tx_object_pool_info_get(&test_pool, TX_NULL, TX_NULL, TX_NULL, &pool_in_use, &pool_high_water, TX_NULL) == TX_SUCCESS) &&
+               (_tx_object_pool_performance_info_get(&test_pool, &pool_allocations, &pool_failures, TX_NULL) == TX_SUCCESS) &&
+               (pool_in_use == in_use) && (pool_high_water == high_water) &&
+               (pool_allocations == allocations) && (pool_failures == failures), name);
+}
+
+
+/* Determine if an object is filled with the poison pattern.  */
+
+static UINT test_poisoned(VOID *object)
+{
+
+ULONG   *word;
+UINT    i;
+
+
+    word =  (ULONG *) object;
+    for (i = 0; i < (TEST_OBJECT_SIZE / sizeof(ULONG)); i++)
+    {
+        if (word[i] != TX_OBJECT_POOL_POISON)
+        {
+            return(TX_FALSE);
+        }
+    }
+    return(TX_TRUE);
+}
+
+
+static VOID test_waiter_entry(ULONG input)
+{
+
+    TX_PARAMETER_NOT_USED(input);
+
+    test_waiter_status =  _tx_object_allocate(&test_pool, &test_waiter_object, TX_WAIT_FOREVER);
+}
+
+
+static VOID test_entry(ULONG input)
+{
+
+CHAR            *name;
+ULONG           object_size;
+ULONG           total;
+ULONG           corruptions;
+TX_OBJECT_POOL  *next_pool;
+VOID            *object;
+UINT            i;
+UINT            j;
+
+
+    TX_PARAMETER_NOT_USED(input);
+
+    /* Bad pools and arguments are refused.  */
+    test_check(_tx_object_pool_create(TX_NULL, "test", TEST_OBJECT_SIZE, test_pool_memory, sizeof(test_pool_memory)) == TX_POOL_ERROR, "create no pool");
+    test_check(_tx_object_pool_create(&test_pool, "test", TEST_OBJECT_SIZE, TX_NULL, sizeof(test_pool_memory)) == TX_PTR_ERROR, "create without memory");
+    test_check(_tx_object_pool_create(&test_pool, "test", 0, test_pool_memory, sizeof(test_pool_memory)) == TX_SIZE_ERROR, "create empty objects");
+    test_check(_tx_object_pool_create(&test_pool, "test", TEST_OBJECT_SIZE, test_pool_memory, sizeof(test_pool_memory)) == TX_SUCCESS, "create");
+    test_check(_tx_object_pool_create(&test_pool, "test", TEST_OBJECT_SIZE, test_pool_memory, sizeof(test_pool_memory)) == TX_POOL_ERROR, "create twice");
+    test_check(_tx_object_pool_create(&test_other_pool, "other", TEST_OBJECT_SIZE, test_other_pool_memory, sizeof(test_other_pool_memory)) == TX_SUCCESS, "create other");
+    test_check(_tx_object_allocate(&test_pool, TX_NULL, TX_NO_WAIT) == TX_PTR_ERROR, "allocate without destination");
+    test_check((_tx_object_pool_info_get(&test_pool, &name, &object_size, &total, TX_NULL, TX_NULL, TX_NULL) == TX_SUCCESS) &&
+               (name[0] == 't') && (object_size == TEST_OBJECT_SIZE) && (total == TEST_OBJECTS), "info");
+    test_counts_check(0, 0, 0, 0, "counts at start");
+
+    /* The pool gives out its objects, distinct and poisoned, and then runs dry.  */
+    for (i = 0; i < TEST_OBJECTS; i++)
+    {
+        test_check(_tx_object_allocate(&test_pool, &test_objects[i], TX_NO_WAIT) == TX_SUCCESS, "allocate");
+        test_check(test_poisoned(test_objects[i]), "allocated object poisoned");
+        for (j = 0; j < i; j++)
+        {
+            test_check(test_objects[i] != test_objects[j], "distinct objects");
+        }
+    }
+    test_check(_tx_object_allocate(&test_pool, &test_objects[TEST_OBJECTS], TX_NO_WAIT) == TX_NO_MEMORY, "allocate from an empty pool");
+    test_counts_check(TEST_OBJECTS, TEST_OBJECTS, TEST_OBJECTS, 1, "counts when exhausted");
+
+    /* An object returned is given out again.  */
+    test_check(_tx_object_free(&test_pool, test_objects[1]) == TX_SUCCESS, "free");
+    test_counts_check(TEST_OBJECTS - 1, TEST_OBJECTS, TEST_OBJECTS, 1, "counts after a return");
+    test_check(_tx_object_allocate(&test_pool, &object, TX_NO_WAIT) == TX_SUCCESS, "allocate after a return");
+    test_check(object == test_objects[1], "returned object given out again");
+    test_check(test_poisoned(object), "returned object poisoned");
+
+    /* Frees twice, to the wrong pool, or outside of the pool are rejected.  */
+    test_check(_tx_object_free(&test_pool, test_objects[2]) == TX_SUCCESS, "free once");
+    test_check(_tx_object_free(&test_pool, test_objects[2]) == TX_PTR_ERROR, "free twice");
+    test_check(_tx_object_free(&test_other_pool, test_objects[0]) == TX_PTR_ERROR, "free to the wrong pool");
+    test_check(_tx_object_free(&test_pool, &test_other_pool_memory[2]) == TX_PTR_ERROR, "free outside of the pool");
+    test_check(_tx_object_free(&test_pool, test_pool_memory) == TX_PTR_ERROR, "free the start of the pool");
+    test_check(_tx_object_free(TX_NULL, test_objects[0]) == TX_POOL_ERROR, "free to no pool");
+    test_counts_check(TEST_OBJECTS - 1, TEST_OBJECTS, TEST_OBJECTS + 1, 1, "counts after bad frees");
+    test_check(_tx_object_allocate(&test_pool, &test_objects[2], TX_NO_WAIT) == TX_SUCCESS, "allocate the last object");
+
+    /* A thread waiting on the empty pool gets the next object returned.  */
+    tx_thread_create(&test_waiter_thread, "waiter", test_waiter_entry, 0, test_waiter_thread_stack, sizeof(test_waiter_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+    test_check(test_waiter_object == TX_NULL, "waiter waits");
+    test_check(_tx_object_free(&test_pool, test_objects[3]) == TX_SUCCESS, "free to a waiter");
+    test_check((test_waiter_status == TX_SUCCESS) && (test_waiter_object == test_objects[3]), "waiter given the object");
+    test_counts_check(TEST_OBJECTS, TEST_OBJECTS, TEST_OBJECTS + 3, 1, "counts after a waiter");
+    tx_thread_terminate(&test_waiter_thread);
+    tx_thread_delete(&test_waiter_thread);
+
+    /* An allocation that times out fails.  */
+    test_check(_tx_object_allocate(&test_pool, &object, 5) == TX_NO_MEMORY, "allocate times out");
+    test_counts_check(TEST_OBJECTS, TEST_OBJECTS, TEST_OBJECTS + 3, 2, "counts after a timeout");
+
+    /* A write to a free object is found when it is allocated again.  */
+    test_check(_tx_object_free(&test_pool, test_objects[0]) == TX_SUCCESS, "free before a write");
+    ((ULONG *) test_objects[0])[1] =  0;
+    test_check(_tx_object_allocate(&test_pool, &object, TX_NO_WAIT) == TX_SUCCESS, "allocate a written object");
+    test_check((_tx_object_pool_performance_info_get(&test_pool, TX_NULL, TX_NULL, &corruptions) == TX_SUCCESS) &&
+               (corruptions == 1), "write to a free object counted");
+
+    /* All the objects are returned.  */
+    for (i = 0; i < TEST_OBJECTS; i++)
+    {
+        test_check(_tx_object_free(&test_pool, test_objects[i]) == TX_SUCCESS, "free all");
+    }
+    test_counts_check(0, TEST_OBJECTS, TEST_OBJECTS + 4, 2, "counts after all returned");
+
+    /* The pools are on the created list until deleted.  */
+    test_check((_tx_object_pool_created_count == 2) && (_tx_object_pool_created_ptr == &test_pool), "created list");
+    test_check((_tx_object_pool_info_get(&test_pool, TX_NULL, TX_NULL, TX_NULL, TX_NULL, TX_NULL, &next_pool) == TX_SUCCESS) &&
+               (next_pool == &test_other_pool), "next pool");
+    test_check(_tx_object_pool_delete(&test_pool) == TX_SUCCESS, "delete");
+    test_check(_tx_object_pool_delete(&test_pool) == TX_POOL_ERROR, "delete twice");
+    test_check((_tx_object_pool_created_count == 1) && (_tx_object_pool_created_ptr == &test_other_pool), "created list after delete");
+    test_check(_tx_object_allocate(&test_pool, &object, TX_NO_WAIT) == TX_POOL_ERROR, "allocate from a deleted pool");
+    test_check(_tx_object_pool_delete(&test_other_pool) == TX_SUCCESS, "delete other");
+    test_check((_tx_object_pool_created_count == 0) && (_tx_object_pool_created_ptr == TX_NULL), "created list empty");
+
+    if (test_failures != 0)
+    {
+        exit(1);
+    }
+    printf("tx_object_pool_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    TX_PARAMETER_NOT_USED(first_unused_memory);
+
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
@@ -0,0 +1,233 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks the batch pointer send and receive of queues. Bad queues and arguments are
+   refused. A batch larger than the room left in a queue of 8 pointers sends what fits, reports it
+   in actual_count and succeeds, and a batch to a full queue fails without sending anything. The
+   pointers come out in order, also when a batch wraps around the end of the queue, and mix with
+   tx_queue_send. A receiver waiting on the empty queue is handed the first pointer of a batch, and
+   a sender waiting on the full queue sends its first pointer once there is room, but the rest of
+   its batch only if there is still room. A send that times out sends nothing.  */
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+
+#define TEST_STACK_WORDS        1024
+#define TEST_QUEUE_POINTERS     8
+#define TEST_BUFFERS            32
+
+
+static UINT         test_failures;
+static TX_THREAD    test_thread;
+static TX_THREAD    test_peer_thread;
+static ULONG        test_thread_stack[TEST_STACK_WORDS];
+static ULONG        test_peer_thread_stack[TEST_STACK_WORDS];
+static TX_QUEUE     test_queue;
+static TX_QUEUE     test_ulong_queue;
+static VOID        *test_queue_storage[TEST_QUEUE_POINTERS];
+static ULONG        test_ulong_queue_storage[TEST_QUEUE_POINTERS];
+static UCHAR        test_buffers[TEST_BUFFERS];
+static VOID        *test_send[TEST_BUFFERS];
+static VOID        *test_receive[TEST_BUFFERS];
+static UINT         test_next_send;
+static UINT         test_next_receive;
+static VOID        *test_peer_pointers[TEST_BUFFERS];
+static UINT         test_peer_count;
+static UINT         test_peer_status;
+static UINT         test_peer_actual;
+
+
+static VOID test_check(UINT condition, const CHAR *name)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s\n", name);
+        test_failures++;
+    }
+}
+
+
+/* Send the next count buffers in order, and return the number sent.  */
+
+static UINT test_pointers_send(UINT count, UINT expected_status, const CHAR *name)
+{
+
+UINT    i;
+UINT    actual;
+
+
+    for (i = 0; i < count; i++)
+    {
+        test_send[i] =  &test_buffers[(test_next_send + i) % TEST_BUFFERS];
+    }
+    actual =  TEST_BUFFERS;
+    test_check(tx_queue_pointer_send(&test_queue, test_send, count, &actual, TX_NO_WAIT) == expected_status, name);
+    test_next_send =  test_next_send + actual;
+    return(actual);
+}
+
+
+/* Receive up to count buffers, check that they come out in order, and return the number received.  */
+
+static UINT test_pointers_receive(UINT count, UINT expected_status, const CHAR *name)
+{
+
+UINT    i;
+UINT    actual;
+
+
+    actual =  TEST_BUFFERS;
+    test_check(tx_queue_pointer_receive(&test_queue, test_receive, count, &actual, TX_NO_WAIT) == expected_status, name);
+    for (i = 0; i < actual; i++)
+    {
+        test_check(test_receive[i] == &test_buffers[(test_next_receive + i) % TEST_BUFFERS], "pointers in order");
+    }
+    test_next_receive =  test_next_receive + actual;
+    return(actual);
+}
+
+
+/* The peer receives or sends a batch of test_peer_count pointers, waiting for the first.  */
+
+static VOID test_receiver_entry(ULONG input)
+{
+
+    TX_PARAMETER_NOT_USED(input);
+
+    test_peer_status =  tx_queue_pointer_receive(&test_queue, test_peer_pointers, test_peer_count, &test_peer_actual, TX_WAIT_FOREVER);
+}
+
+
+static VOID test_sender_entry(ULONG input)
+{
+
+    TX_PARAMETER_NOT_USED(input);
+
+    test_peer_status =  tx_queue_pointer_send(&test_queue, test_peer_pointers, test_peer_count, &test_peer_actual, TX_WAIT_FOREVER);
+}
+
+
+static VOID test_entry(ULONG input)
+{
+
+UINT    actual;
+UINT    i;
+VOID   *pointer;
+
+
+    TX_PARAMETER_NOT_USED(input);
+
+    test_check(tx_queue_create(&test_queue, "pointers", TX_POINTER_ULONG, test_queue_storage, sizeof(test_queue_storage)) == TX_SUCCESS, "create");
+    test_check(tx_queue_create(&test_ulong_queue, "ulongs", TX_1_ULONG, test_ulong_queue_storage, sizeof(test_ulong_queue_storage)) == TX_SUCCESS, "create ULONG queue");
+
+    /* Bad queues and arguments are refused.  */
+    test_check(tx_queue_pointer_send(TX_NULL, test_send, 1, &actual, TX_NO_WAIT) == TX_QUEUE_ERROR, "send to no queue");
+    test_check(tx_queue_pointer_send(&test_ulong_queue, test_send, 1, &actual, TX_NO_WAIT) == TX_SIZE_ERROR, "send to a ULONG queue");
+    test_check(tx_queue_pointer_receive(&test_ulong_queue, test_receive, 1, &actual, TX_NO_WAIT) == TX_SIZE_ERROR, "receive from a ULONG queue");
+    test_check(tx_queue_pointer_send(&test_queue, TX_NULL, 1, &actual, TX_NO_WAIT) == TX_PTR_ERROR, "send no pointers");
+    test_check(tx_queue_pointer_send(&test_queue, test_send, 1, TX_NULL, TX_NO_WAIT) == TX_PTR_ERROR, "send without a count");
+    test_check(tx_queue_pointer_send(&test_queue, test_send, 0, &actual, TX_NO_WAIT) == TX_SIZE_ERROR, "send an empty batch");
+    test_check(tx_queue_pointer_receive(&test_queue, test_receive, 0, &actual, TX_NO_WAIT) == TX_SIZE_ERROR, "receive an empty batch");
+
+    /* An empty queue has nothing to receive.  */
+    test_check(test_pointers_receive(1, TX_QUEUE_EMPTY, "receive from an empty queue") == 0, "nothing received");
+
+    /* A batch larger than the room left sends what fits, and a full queue takes nothing.  */
+    test_check(test_pointers_send(5, TX_SUCCESS, "send 5") == 5, "5 sent");
+    test_check(test_pointers_send(5, TX_SUCCESS, "send 5 to 3 free") == 3, "partial send when the queue fills");
+    test_check(test_pointers_send(1, TX_QUEUE_FULL, "send to a full queue") == 0, "nothing sent to a full queue");
+
+    /* The batches wrap around the end of the queue in order, and a batch larger than the pointers
+       left receives what there is.  */
+    test_check(test_pointers_receive(6, TX_SUCCESS, "receive 6") == 6, "6 received");
+    test_check(test_pointers_send(4, TX_SUCCESS, "send 4 at the end") == 4, "4 sent");
+    test_check(test_pointers_receive(3, TX_SUCCESS, "receive 3 across the end") == 3, "3 received");
+    test_check(test_pointers_send(6, TX_SUCCESS, "send 6 across the end to 5 free") == 5, "partial send across the end");
+    test_check(test_pointers_receive(TEST_BUFFERS, TX_SUCCESS, "receive all") == TEST_QUEUE_POINTERS, "partial receive of all");
+
+    /* Pointers sent as messages come out of a batch receive, and the other way around.  */
+    pointer =  &test_buffers[test_next_send % TEST_BUFFERS];
+    test_check(tx_queue_send(&test_queue, &pointer, TX_NO_WAIT) == TX_SUCCESS, "send a pointer message");
+    test_next_send++;
+    test_check(test_pointers_send(1, TX_SUCCESS, "send after a message") == 1, "1 sent");
+    test_check(test_pointers_receive(1, TX_SUCCESS, "receive a pointer message") == 1, "message received");
+    test_check(tx_queue_receive(&test_queue, &pointer, TX_NO_WAIT) == TX_SUCCESS, "receive a pointer as a message");
+    test_check(pointer == &test_buffers[test_next_receive % TEST_BUFFERS], "message in order");
+    test_next_receive++;
+
+    /* A receiver waiting on the empty queue is handed the first pointer and returns with it, and the
+       rest of the batch is queued.  */
+    test_peer_count =  4;
+    tx_thread_create(&test_peer_thread, "receiver", test_receiver_entry, 0, test_peer_thread_stack, sizeof(test_peer_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+    test_check(test_pointers_send(3, TX_SUCCESS, "send to a waiting receiver") == 3, "3 sent to a waiting receiver");
+    test_check(test_peer_status == TX_SUCCESS, "receiver woken");
+    test_check((test_peer_actual == 1) && (test_peer_pointers[0] == &test_buffers[test_next_receive % TEST_BUFFERS]), "receiver handed the first pointer");
+    test_next_receive++;
+    test_check(test_pointers_receive(TEST_BUFFERS, TX_SUCCESS, "receive the rest of the batch") == 2, "rest of the batch queued");
+    tx_thread_terminate(&test_peer_thread);
+    tx_thread_delete(&test_peer_thread);
+
+    /* A sender waiting on the full queue sends its first pointer once there is room, and the rest
+       of its batch is not sent since the queue is full again.  */
+    test_check(test_pointers_send(TEST_QUEUE_POINTERS, TX_SUCCESS, "fill") == TEST_QUEUE_POINTERS, "filled");
+    for (i = 0; i < 3; i++)
+    {
+        test_peer_pointers[i] =  &test_buffers[(test_next_send + i) % TEST_BUFFERS];
+    }
+    test_peer_count =   3;
+    test_peer_status =  TX_NOT_DONE;
+    tx_thread_create(&test_peer_thread, "sender", test_sender_entry, 0, test_peer_thread_stack, sizeof(test_peer_thread_stack),
+                     1, 1, TX_NO_TIME_SLICE, TX_AUTO_START);
+    test_check(test_peer_status == TX_NOT_DONE, "sender waits");
+    test_check(test_pointers_receive(1, TX_SUCCESS, "receive from a waiting sender") == 1, "1 received from a waiting sender");
+    test_check(test_peer_status == TX_SUCCESS, "sender woken");
+    test_check(test_peer_actual == 1, "partial send of a waiting sender");
+    test_next_send++;
+    test_check(test_pointers_receive(TEST_BUFFERS, TX_SUCCESS, "receive all after the sender") == TEST_QUEUE_POINTERS, "all received after the sender");
+    tx_thread_terminate(&test_peer_thread);
+    tx_thread_delete(&test_peer_thread);
+
+    /* A send to a full queue that times out sends nothing.  */
+    test_check(test_pointers_send(TEST_QUEUE_POINTERS, TX_SUCCESS, "fill again") == TEST_QUEUE_POINTERS, "filled again");
+    actual =  TEST_BUFFERS;
+    test_check(tx_queue_pointer_send(&test_queue, test_send, 2, &actual, 5) == TX_QUEUE_FULL, "send times out");
+    test_check(actual == 0, "nothing sent after a timeout");
+    test_check(test_pointers_receive(TEST_BUFFERS, TX_SUCCESS, "receive after the timeout") == TEST_QUEUE_POINTERS, "all received after the timeout");
+
+    if (test_failures != 0)
+    {
+        exit(1);
+    }
+    printf("tx_queue_pointer_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    TX_PARAMETER_NOT_USED(first_unused_memory);
+
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
@@ -0,0 +1,227 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This test checks the stack monitor. The threads of the Linux port do not run on their ThreadX
+   stacks, so the test marks stack words by hand, the way a thread that used its stack that deep
+   would. The monitor must refuse bad slices and thresholds, report the exact bytes used and the
+   headroom of each marked thread, and notify a thread once each time its mark gets deeper than the
+   headroom threshold, but not for a mark above the threshold. A thread created while the monitor
+   runs must be scanned, a thread deleted while it runs must not be reported, and the monitor must
+   stop and start again.  */
+
+#include "tx_api.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+
+#define TEST_STACK_WORDS        1024
+#define TEST_SLICE_WORDS        512
+#define TEST_HEADROOM_PERCENT   25
+#define TEST_DEEP_WORD          64      /* 256 bytes of headroom, 6% of the stack.  */
+#define TEST_DEEPER_WORD        16      /* 64 bytes of headroom, 2% of the stack.  */
+#define TEST_SHALLOW_WORD       900     /* 3600 bytes of headroom, 88% of the stack.  */
+#define TEST_LATE_WORD          8       /* 32 bytes of headroom, 1% of the stack.  */
+#define TEST_WAIT_TICKS         1000
+
+
+static UINT         test_failures;
+static TX_THREAD    test_thread;
+static TX_THREAD    test_deep_thread;
+static TX_THREAD    test_shallow_thread;
+static TX_THREAD    test_late_thread;
+static ULONG        test_thread_stack[TEST_STACK_WORDS];
+static ULONG        test_deep_stack[TEST_STACK_WORDS];
+static ULONG        test_shallow_stack[TEST_STACK_WORDS];
+static ULONG        test_late_stack[TEST_STACK_WORDS];
+static ULONG        test_deep_notifications;
+static ULONG        test_late_notifications;
+static ULONG        test_other_notifications;
+static ULONG        test_notify_used;
+
+
+static VOID test_check(UINT condition, const CHAR *name)
+{
+
+    if (!condition)
+    {
+        printf("FAILED: %s\n", name);
+        test_failures++;
+    }
+}
+
+
+/* Count the notifications of each thread, called from the timer thread.  */
+
+static VOID test_notify(TX_THREAD *thread_ptr, ULONG stack_used)
+{
+
+    if (thread_ptr == &test_deep_thread)
+    {
+        test_deep_notifications++;
+    }
+    else if (thread_ptr == &test_late_thread)
+    {
+        test_late_notifications++;
+    }
+    else
+    {
+        test_other_notifications++;
+    }
+    test_notify_used =  stack_used;
+}
+
+
+/* Wait for two more complete scans, so marks made before the call are found, and return the scans.  */
+
+static ULONG test_rounds_wait(ULONG rounds)
+{
+
+ULONG   now;
+ULONG   ticks;
+
+
+    for (ticks = 0; ticks < TEST_WAIT_TICKS; ticks++)
+    {
+        tx_thread_sleep(1);
+        tx_thread_stack_monitor_info_get(TX_NULL, TX_NULL, TX_NULL, &now);
+        if (now >= (rounds + 2))
+        {
+            return(now);
+        }
+    }
+    test_check(0, "scans complete");
+    return(now);
+}
+
+
+/* The threads that are monitored are never started.  */
+
+static VOID test_idle_entry(ULONG input)
+{
+
+    TX_PARAMETER_NOT_USED(input);
+}
+
+
+static VOID test_entry(ULONG input)
+{
+
+ULONG   used;
+ULONG   headroom;
+ULONG   rounds;
+ULONG   before;
+
+
+    TX_PARAMETER_NOT_USED(input);
+
+    tx_thread_create(&test_deep_thread, "deep", test_idle_entry, 0, test_deep_stack, sizeof(test_deep_stack),
+                     3, 3, TX_NO_TIME_SLICE, TX_DONT_START);
+    tx_thread_create(&test_shallow_thread, "shallow", test_idle_entry, 0, test_shallow_stack, sizeof(test_shallow_stack),
+                     3, 3, TX_NO_TIME_SLICE, TX_DONT_START);
+
+    /* Bad slices and thresholds are refused, and nothing is scanned before the monitor starts.  */
+    test_check(tx_thread_stack_monitor_start(0, 1, TEST_HEADROOM_PERCENT, test_notify) == TX_SIZE_ERROR, "start without slice words");
+    test_check(tx_thread_stack_monitor_start(TEST_SLICE_WORDS, 0, TEST_HEADROOM_PERCENT, test_notify) == TX_SIZE_ERROR, "start without slice ticks");
+    test_check(tx_thread_stack_monitor_start(TEST_SLICE_WORDS, 1, 101, test_notify) == TX_OPTION_ERROR, "start above 100%");
+    test_check(tx_thread_stack_monitor_stop() == TX_NOT_DONE, "stop before start");
+    test_check(tx_thread_stack_monitor_info_get(TX_NULL, &used, &headroom, TX_NULL) == TX_THREAD_ERROR, "info of no thread");
+    test_check(tx_thread_stack_monitor_info_get(&test_deep_thread, &used, &headroom, TX_NULL) == TX_NOT_DONE, "info before start");
+
+    /* Mark a word deep in one stack, below the headroom threshold, and one in another, above it.  */
+    test_deep_stack[TEST_DEEP_WORD] =        0;
+    test_shallow_stack[TEST_SHALLOW_WORD] =  0;
+    test_check(tx_thread_stack_monitor_start(TEST_SLICE_WORDS, 1, TEST_HEADROOM_PERCENT, test_notify) == TX_SUCCESS, "start");
+    test_check(tx_thread_stack_monitor_start(TEST_SLICE_WORDS, 1, TEST_HEADROOM_PERCENT, test_notify) == TX_NOT_DONE, "start twice");
+    rounds =  test_rounds_wait(0);
+
+    /* The marks are exact, only the deep thread is reported, and the unused stacks have no mark.  */
+    test_check(tx_thread_stack_monitor_info_get(&test_deep_thread, &used, &headroom, TX_NULL) == TX_SUCCESS, "info of the deep thread");
+    test_check(used == (sizeof(test_deep_stack) - (TEST_DEEP_WORD * sizeof(ULONG))), "deep stack used");
+    test_check(headroom == (TEST_DEEP_WORD * sizeof(ULONG)), "deep headroom");
+    test_check(tx_thread_stack_monitor_info_get(&test_shallow_thread, &used, &headroom, TX_NULL) == TX_SUCCESS, "info of the shallow thread");
+    test_check(used == (sizeof(test_shallow_stack) - (TEST_SHALLOW_WORD * sizeof(ULONG))), "shallow stack used");
+    test_check(headroom == (TEST_SHALLOW_WORD * sizeof(ULONG)), "shallow headroom");
+    test_check(tx_thread_stack_monitor_info_get(&test_thread, TX_NULL, TX_NULL, TX_NULL) == TX_NOT_DONE, "unused stack");
+    test_check(test_deep_notifications == 1, "deep thread notified");
+    test_check(test_notify_used == (sizeof(test_deep_stack) - (TEST_DEEP_WORD * sizeof(ULONG))), "notified stack used");
+    test_check(test_other_notifications == 0, "shallow thread not notified");
+
+    /* A mark that stays the same is not reported again.  */
+    rounds =  test_rounds_wait(rounds);
+    test_check(test_deep_notifications == 1, "same mark not notified again");
+
+    /* A deeper mark is reported once more.  */
+    test_deep_stack[TEST_DEEPER_WORD] =  0;
+    rounds =  test_rounds_wait(rounds);
+    test_check(tx_thread_stack_monitor_info_get(&test_deep_thread, &used, &headroom, TX_NULL) == TX_SUCCESS, "info of the deeper mark");
+    test_check(used == (sizeof(test_deep_stack) - (TEST_DEEPER_WORD * sizeof(ULONG))), "deeper stack used");
+    test_check(test_deep_notifications == 2, "deeper mark notified");
+    test_check(test_notify_used == used, "notified deeper stack used");
+
+    /* A thread created while the monitor runs is scanned and reported. Its stack is filled when it is
+       created, so it is marked after.  */
+    tx_thread_create(&test_late_thread, "late", test_idle_entry, 0, test_late_stack, sizeof(test_late_stack),
+                     3, 3, TX_NO_TIME_SLICE, TX_DONT_START);
+    test_late_stack[TEST_LATE_WORD] =  0;
+    rounds =  test_rounds_wait(rounds);
+    test_check(tx_thread_stack_monitor_info_get(&test_late_thread, &used, TX_NULL, TX_NULL) == TX_SUCCESS, "info of the late thread");
+    test_check(used == (sizeof(test_late_stack) - (TEST_LATE_WORD * sizeof(ULONG))), "late stack used");
+    test_check(test_late_notifications == 1, "late thread notified");
+
+    /* A thread deleted while the monitor runs is no longer reported, and the scans go on.  */
+    test_check(tx_thread_terminate(&test_late_thread) == TX_SUCCESS, "terminate the late thread");
+    test_check(tx_thread_delete(&test_late_thread) == TX_SUCCESS, "delete the late thread");
+    test_check(tx_thread_stack_monitor_info_get(&test_late_thread, &used, TX_NULL, TX_NULL) == TX_THREAD_ERROR, "info of a deleted thread");
+    rounds =  test_rounds_wait(rounds);
+    test_check(test_late_notifications == 1, "deleted thread not notified");
+    test_check(test_deep_notifications == 2, "deep thread not notified again");
+
+    /* Once stopped, the scans stop.  */
+    test_check(tx_thread_stack_monitor_stop() == TX_SUCCESS, "stop");
+    test_check(tx_thread_stack_monitor_stop() == TX_NOT_DONE, "stop twice");
+    tx_thread_stack_monitor_info_get(TX_NULL, TX_NULL, TX_NULL, &before);
+    tx_thread_sleep(10);
+    tx_thread_stack_monitor_info_get(TX_NULL, TX_NULL, TX_NULL, &rounds);
+    test_check(rounds == before, "no scans after stop");
+
+    /* The monitor starts again without a notification, and keeps the marks found.  */
+    test_check(tx_thread_stack_monitor_start(TEST_SLICE_WORDS, 1, 100, TX_NULL) == TX_SUCCESS, "start again");
+    test_rounds_wait(0);
+    test_check(tx_thread_stack_monitor_info_get(&test_deep_thread, &used, TX_NULL, TX_NULL) == TX_SUCCESS, "info after restart");
+    test_check(used == (sizeof(test_deep_stack) - (TEST_DEEPER_WORD * sizeof(ULONG))), "stack used after restart");
+    test_check(test_deep_notifications == 2, "no notification without a function");
+    test_check(tx_thread_stack_monitor_stop() == TX_SUCCESS, "stop again");
+
+    if (test_failures != 0)
+    {
+        exit(1);
+    }
+    printf("tx_thread_stack_monitor_test: passed\n");
+    exit(0);
+}
+
+
+VOID tx_application_define(VOID *first_unused_memory)
+{
+
+    TX_PARAMETER_NOT_USED(first_unused_memory);
+
+    tx_thread_create(&test_thread, "test", test_entry, 0, test_thread_stack, sizeof(test_thread_stack),
+                     2, 2, TX_NO_TIME_SLICE, TX_AUTO_START);
+}
+
+
+int main(void)
+{
+
+    tx_kernel_enter();
+    return(0);
+}
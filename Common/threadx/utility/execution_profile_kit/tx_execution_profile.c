@@ -0,0 +1,1073 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Execution Profile Kit                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_execution_profile.h"
+
+
+#ifdef TX_ENABLE_EXECUTION_CHANGE_NOTIFY
+
+/* Define what is executing, which is charged for the time since the last change.  */
+
+#define TX_EXECUTION_NONE                       ((UINT) 0)
+#define TX_EXECUTION_THREAD                     ((UINT) 1)
+#define TX_EXECUTION_ISR                        ((UINT) 2)
+#define TX_EXECUTION_IDLE                       ((UINT) 3)
+
+
+/* Define the total time of all threads, of ISRs and of idle.  */
+
+EXECUTION_TIME              _tx_execution_thread_time_total;
+EXECUTION_TIME              _tx_execution_isr_time_total;
+EXECUTION_TIME              _tx_execution_idle_time_total;
+
+
+/* Define what is executing, the thread it is, when it started, and what the outermost ISR
+   interrupted.  */
+
+UINT                        _tx_execution_state;
+TX_THREAD                  *_tx_execution_thread_ptr;
+EXECUTION_TIME_SOURCE_TYPE  _tx_execution_last_start;
+UINT                        _tx_execution_isr_interrupted_state;
+TX_THREAD                  *_tx_execution_isr_interrupted_thread_ptr;
+ULONG                       _tx_execution_isr_nest_counter;
+
+
+/* Define the internal function that charges the time since the last change.  */
+
+static VOID  _tx_execution_update(VOID);
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_update                                PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function charges the time since the last change to the         */
+/*    thread, the ISR or the idle that is executing, and starts the next  */
+/*    interval. It is called with interrupts disabled.                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_execution_thread_enter        Thread starts executing           */
+/*    _tx_execution_thread_exit         Thread stops executing            */
+/*    _tx_execution_isr_enter           ISR begins                        */
+/*    _tx_execution_isr_exit            ISR ends                          */
+/*    _tx_execution_*_get               Get execution times               */
+/*    _tx_execution_*_reset             Reset execution times             */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+static VOID  _tx_execution_update(VOID)
+{
+
+EXECUTION_TIME_SOURCE_TYPE  current_time;
+EXECUTION_TIME_SOURCE_TYPE  last_start_time;
+EXECUTION_TIME              delta_time;
+
+
+    /* Pickup the current time.  */
+    current_time =  TX_EXECUTION_TIME_SOURCE;
+
+    /* Pickup the start of the interval and start the next one.  */
+    last_start_time =  _tx_execution_last_start;
+    _tx_execution_last_start =  current_time;
+
+    /* Calculate the time since the last change, allowing for the time source to wrap.  */
+    if (current_time >= last_start_time)
+    {
+        delta_time =  (EXECUTION_TIME) (current_time - last_start_time);
+    }
+    else
+    {
+        delta_time =  ((EXECUTION_TIME) (TX_EXECUTION_MAX_TIME_SOURCE - last_start_time)) + ((EXECUTION_TIME) current_time) + ((EXECUTION_TIME) 1);
+    }
+
+    /* Charge the time to what was executing.  */
+    if (_tx_execution_state == TX_EXECUTION_THREAD)
+    {
+        _tx_execution_thread_ptr -> tx_thread_execution_time_total =  _tx_execution_thread_ptr -> tx_thread_execution_time_total + delta_time;
+        _tx_execution_thread_time_total =  _tx_execution_thread_time_total + delta_time;
+    }
+    else if (_tx_execution_state == TX_EXECUTION_ISR)
+    {
+        _tx_execution_isr_time_total =  _tx_execution_isr_time_total + delta_time;
+    }
+    else if (_tx_execution_state == TX_EXECUTION_IDLE)
+    {
+        _tx_execution_idle_time_total =  _tx_execution_idle_time_total + delta_time;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_enter                          PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the port when the current thread starts  */
+/*    executing. The time since the last change is charged to idle, or    */
+/*    to the ISR the thread is scheduled from.                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX port                                                        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_thread_enter(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Charge the time since the last change.  */
+    _tx_execution_update();
+
+    /* Determine if the thread is scheduled from an ISR.  */
+    if (_tx_execution_isr_nest_counter)
+    {
+
+        /* Yes, the thread executes once the ISR ends.  */
+        _tx_execution_isr_interrupted_state =       TX_EXECUTION_THREAD;
+        _tx_execution_isr_interrupted_thread_ptr =  _tx_thread_current_ptr;
+    }
+    else
+    {
+
+        /* The current thread is now executing.  */
+        _tx_execution_state =       TX_EXECUTION_THREAD;
+        _tx_execution_thread_ptr =  _tx_thread_current_ptr;
+        _tx_thread_current_ptr -> tx_thread_execution_time_last_start =  (EXECUTION_TIME) _tx_execution_last_start;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_exit                           PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the port when the current thread stops   */
+/*    executing. The time since the last change is charged to the thread, */
+/*    and the time until the next thread starts is idle.                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX port                                                        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_thread_exit(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Charge the time since the last change.  */
+    _tx_execution_update();
+
+    /* Determine if the thread stops from an ISR.  */
+    if (_tx_execution_isr_nest_counter)
+    {
+
+        /* Yes, the system is idle once the ISR ends.  */
+        _tx_execution_isr_interrupted_state =       TX_EXECUTION_IDLE;
+        _tx_execution_isr_interrupted_thread_ptr =  TX_NULL;
+    }
+    else
+    {
+
+        /* No thread is executing until the next one starts.  */
+        _tx_execution_state =       TX_EXECUTION_IDLE;
+        _tx_execution_thread_ptr =  TX_NULL;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_enter                             PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the port when an ISR begins. The time    */
+/*    since the last change is charged to the interrupted thread or idle. */
+/*    Nested ISRs are accounted as one ISR.                               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX port                                                        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_isr_enter(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Determine if this is the outermost ISR.  */
+    if (_tx_execution_isr_nest_counter == 0)
+    {
+
+        /* Charge the time since the last change to what is interrupted.  */
+        _tx_execution_update();
+
+        /* Remember what is interrupted, it executes again once the ISR ends.  */
+        _tx_execution_isr_interrupted_state =       _tx_execution_state;
+        _tx_execution_isr_interrupted_thread_ptr =  _tx_execution_thread_ptr;
+
+        /* An ISR is now executing.  */
+        _tx_execution_state =  TX_EXECUTION_ISR;
+    }
+
+    /* Increment the ISR nesting.  */
+    _tx_execution_isr_nest_counter++;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_exit                              PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function is called by the port when an ISR ends. The time      */
+/*    since the last change is charged to ISRs, and what the ISR          */
+/*    interrupted executes again.                                         */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    ThreadX port                                                        */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+VOID  _tx_execution_isr_exit(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Decrement the ISR nesting.  */
+    if (_tx_execution_isr_nest_counter)
+    {
+        _tx_execution_isr_nest_counter--;
+
+        /* Determine if this is the outermost ISR.  */
+        if (_tx_execution_isr_nest_counter == 0)
+        {
+
+            /* Charge the time since the last change to ISRs.  */
+            _tx_execution_update();
+
+            /* What the ISR interrupted executes again.  */
+            _tx_execution_state =       _tx_execution_isr_interrupted_state;
+            _tx_execution_thread_ptr =  _tx_execution_isr_interrupted_thread_ptr;
+        }
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_time_reset                     PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resets the execution time of the specified thread.    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_thread_time_reset(TX_THREAD *thread_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Bring the execution times up to date.  */
+    _tx_execution_update();
+
+    /* Reset the execution time of the thread.  */
+    thread_ptr -> tx_thread_execution_time_total =  0;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_total_time_reset               PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resets the total execution time of all threads and    */
+/*    the execution time of each thread.                                  */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_thread_total_time_reset(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+TX_THREAD   *thread_ptr;
+ULONG       i;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Bring the execution times up to date.  */
+    _tx_execution_update();
+
+    /* Reset the total execution time of all threads.  */
+    _tx_execution_thread_time_total =  0;
+
+    /* Reset the execution time of each created thread.  */
+    thread_ptr =  _tx_thread_created_ptr;
+    for (i = 0; i < _tx_thread_created_count; i++)
+    {
+        thread_ptr -> tx_thread_execution_time_total =  0;
+        thread_ptr =  thread_ptr -> tx_thread_created_next;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_time_reset                        PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resets the total execution time of ISRs.              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_isr_time_reset(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Bring the execution times up to date.  */
+    _tx_execution_update();
+
+    /* Reset the total execution time of ISRs.  */
+    _tx_execution_isr_time_total =  0;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_idle_time_reset                       PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function resets the total idle time.                           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_idle_time_reset(VOID)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Bring the execution times up to date.  */
+    _tx_execution_update();
+
+    /* Reset the total idle time.  */
+    _tx_execution_idle_time_total =  0;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_time_get                       PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the execution time of the specified thread,   */
+/*    including the time it has been executing when called.               */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    thread_ptr                        Pointer to thread                 */
+/*    total_time                        Destination for the time          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_thread_time_get(TX_THREAD *thread_ptr, EXECUTION_TIME *total_time)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Bring the execution times up to date.  */
+    _tx_execution_update();
+
+    /* Return the execution time of the thread.  */
+    *total_time =  thread_ptr -> tx_thread_execution_time_total;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_thread_total_time_get                 PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the total execution time of all threads.      */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    total_time                        Destination for the time          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_thread_total_time_get(EXECUTION_TIME *total_time)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Bring the execution times up to date.  */
+    _tx_execution_update();
+
+    /* Return the total execution time of all threads.  */
+    *total_time =  _tx_execution_thread_time_total;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_isr_time_get                          PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the total execution time of ISRs.             */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    total_time                        Destination for the time          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_isr_time_get(EXECUTION_TIME *total_time)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Bring the execution times up to date.  */
+    _tx_execution_update();
+
+    /* Return the total execution time of ISRs.  */
+    *total_time =  _tx_execution_isr_time_total;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_idle_time_get                         PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the total idle time.                          */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    total_time                        Destination for the time          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_idle_time_get(EXECUTION_TIME *total_time)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Bring the execution times up to date.  */
+    _tx_execution_update();
+
+    /* Return the total idle time.  */
+    *total_time =  _tx_execution_idle_time_total;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_snapshot_get                          PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function takes a consistent snapshot of the total execution    */
+/*    time of all threads, of ISRs and of idle. The difference between    */
+/*    two snapshots is where the time in between went.                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    snapshot                          Destination for the snapshot      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_update              Charge the elapsed time           */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_snapshot_get(TX_EXECUTION_SNAPSHOT *snapshot)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Bring the execution times up to date.  */
+    _tx_execution_update();
+
+    /* Copy the total execution times.  */
+    snapshot -> tx_execution_snapshot_thread_time =  _tx_execution_thread_time_total;
+    snapshot -> tx_execution_snapshot_isr_time =     _tx_execution_isr_time_total;
+    snapshot -> tx_execution_snapshot_idle_time =    _tx_execution_idle_time_total;
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_execution_cpu_load_get                          PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function returns the percentage of the time spent in threads   */
+/*    and ISRs since the previous snapshot, and replaces the previous     */
+/*    snapshot with the current one for the next call. The previous       */
+/*    snapshot is initialized with _tx_execution_snapshot_get.            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    previous_snapshot                 Snapshot the load is measured     */
+/*                                        from, updated to now            */
+/*    load_percent                      Destination for the load          */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_execution_snapshot_get        Take the current snapshot         */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_execution_cpu_load_get(TX_EXECUTION_SNAPSHOT *previous_snapshot, ULONG *load_percent)
+{
+
+TX_EXECUTION_SNAPSHOT   current_snapshot;
+EXECUTION_TIME          busy_time;
+EXECUTION_TIME          idle_time;
+
+
+    /* Take the current snapshot.  */
+    _tx_execution_snapshot_get(&current_snapshot);
+
+    /* Calculate the time spent in threads and ISRs, and idle, since the previous snapshot.  */
+    busy_time =  (current_snapshot.tx_execution_snapshot_thread_time - previous_snapshot -> tx_execution_snapshot_thread_time) +
+                 (current_snapshot.tx_execution_snapshot_isr_time - previous_snapshot -> tx_execution_snapshot_isr_time);
+    idle_time =  current_snapshot.tx_execution_snapshot_idle_time - previous_snapshot -> tx_execution_snapshot_idle_time;
+
+    /* Calculate the load, which is zero if no time has been accounted.  */
+    if ((busy_time + idle_time) != ((EXECUTION_TIME) 0))
+    {
+        *load_percent =  (ULONG) ((busy_time * ((EXECUTION_TIME) 100)) / (busy_time + idle_time));
+    }
+    else
+    {
+        *load_percent =  0;
+    }
+
+    /* The current snapshot is the previous one of the next call.  */
+    *previous_snapshot =  current_snapshot;
+
+    /* Return success.  */
+    return(TX_SUCCESS);
+}
+
+#endif
+
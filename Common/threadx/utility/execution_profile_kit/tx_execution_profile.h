@@ -0,0 +1,120 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Execution Profile Kit                                               */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    tx_execution_profile.h                              PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the ThreadX execution profile kit, which          */
+/*    accumulates the time spent in each thread, in ISRs and idle. It is  */
+/*    assumed that tx_api.h and tx_port.h have already been included.     */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_EXECUTION_PROFILE_H
+#define TX_EXECUTION_PROFILE_H
+
+
+/* The execution profile kit is called by the port when a thread starts or stops executing and
+   when an ISR begins or ends, which ports do when TX_ENABLE_EXECUTION_CHANGE_NOTIFY is defined.
+   ISRs that do not use _tx_thread_context_save must call _tx_execution_isr_enter and
+   _tx_execution_isr_exit themselves, or their time is charged to the interrupted thread.
+   Nested ISRs are accounted as one ISR.
+
+   Time is read from TX_EXECUTION_TIME_SOURCE, a free running counter that wraps after
+   TX_EXECUTION_MAX_TIME_SOURCE. By default, this is the DWT cycle counter of Cortex-M, which
+   must be enabled by the application. Ports may supply another source in tx_port.h, as the
+   Linux port does with the host monotonic clock in nanoseconds. The source must not wrap more
+   than once between two calls of the kit, which the periodic timer interrupt guarantees.  */
+
+#ifndef TX_EXECUTION_TIME_SOURCE_TYPE
+#define TX_EXECUTION_TIME_SOURCE_TYPE           ULONG
+#endif
+
+#ifndef TX_EXECUTION_TIME_SOURCE
+#define TX_EXECUTION_TIME_SOURCE                (TX_EXECUTION_TIME_SOURCE_TYPE) *((volatile ULONG *) 0xE0001004)
+#endif
+
+#ifndef TX_EXECUTION_MAX_TIME_SOURCE
+#define TX_EXECUTION_MAX_TIME_SOURCE            ((TX_EXECUTION_TIME_SOURCE_TYPE) 0xFFFFFFFFUL)
+#endif
+
+
+/* Define the type of the accumulated times, which are in units of the time source.  */
+
+typedef unsigned long long                      EXECUTION_TIME;
+typedef TX_EXECUTION_TIME_SOURCE_TYPE           EXECUTION_TIME_SOURCE_TYPE;
+
+
+/* Define the execution profile snapshot, which holds the time accumulated by all threads, by
+   ISRs and by idle, including the time of the one that is executing when the snapshot is taken.
+   The sum of the three is the time elapsed since the profile started or was reset.  */
+
+typedef struct TX_EXECUTION_SNAPSHOT_STRUCT
+{
+
+    EXECUTION_TIME      tx_execution_snapshot_thread_time;
+    EXECUTION_TIME      tx_execution_snapshot_isr_time;
+    EXECUTION_TIME      tx_execution_snapshot_idle_time;
+} TX_EXECUTION_SNAPSHOT;
+
+
+/* Define the execution profile change functions, called by the port.  */
+
+VOID    _tx_execution_thread_enter(VOID);
+VOID    _tx_execution_thread_exit(VOID);
+VOID    _tx_execution_isr_enter(VOID);
+VOID    _tx_execution_isr_exit(VOID);
+
+
+/* Define the execution profile application functions.  */
+
+UINT    _tx_execution_thread_time_reset(TX_THREAD *thread_ptr);
+UINT    _tx_execution_thread_total_time_reset(VOID);
+UINT    _tx_execution_isr_time_reset(VOID);
+UINT    _tx_execution_idle_time_reset(VOID);
+
+UINT    _tx_execution_thread_time_get(TX_THREAD *thread_ptr, EXECUTION_TIME *total_time);
+UINT    _tx_execution_thread_total_time_get(EXECUTION_TIME *total_time);
+UINT    _tx_execution_isr_time_get(EXECUTION_TIME *total_time);
+UINT    _tx_execution_idle_time_get(EXECUTION_TIME *total_time);
+
+UINT    _tx_execution_snapshot_get(TX_EXECUTION_SNAPSHOT *snapshot);
+UINT    _tx_execution_cpu_load_get(TX_EXECUTION_SNAPSHOT *previous_snapshot, ULONG *load_percent);
+
+#endif
+
@@ -0,0 +1,962 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Object Pool Kit                                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+#define TX_SOURCE_CODE
+
+
+/* Include necessary system files.  */
+
+#include "tx_api.h"
+#include "tx_thread.h"
+#include "tx_block_pool.h"
+#include "tx_object_pool.h"
+
+
+/* Define the created list of object pools.  */
+
+TX_OBJECT_POOL              *_tx_object_pool_created_ptr;
+ULONG                       _tx_object_pool_created_count;
+
+
+#ifdef TX_OBJECT_POOL_ENABLE_POISON
+
+/* Define the internal functions that poison free objects and check the poison.  */
+
+static VOID  _tx_object_poison(TX_OBJECT_POOL *pool_ptr, VOID *object_ptr);
+static UINT  _tx_object_poison_check(TX_OBJECT_POOL *pool_ptr, VOID *object_ptr);
+#endif
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_object_pool_create                              PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function creates a pool of objects of the specified size in    */
+/*    the specified memory area. The objects are the blocks of a block    */
+/*    pool, which is created in the area.                                 */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to object pool            */
+/*    name_ptr                          Name of the object class          */
+/*    object_size                       Number of bytes in each object    */
+/*    pool_start                        Address of the pool memory area   */
+/*    pool_size                         Number of bytes in the area       */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*    TX_POOL_ERROR                     Invalid or already created pool   */
+/*    TX_PTR_ERROR                      Invalid memory area pointer       */
+/*    TX_SIZE_ERROR                     Invalid object size, or the area  */
+/*                                        cannot hold one object          */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_create             Create the block pool             */
+/*    _tx_object_poison                 Poison a free object              */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_object_pool_create(TX_OBJECT_POOL *pool_ptr, CHAR *name_ptr, ULONG object_size,
+                    VOID *pool_start, ULONG pool_size)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+TX_OBJECT_POOL      *next_pool;
+TX_OBJECT_POOL      *previous_pool;
+#ifdef TX_OBJECT_POOL_ENABLE_POISON
+UCHAR               *block_ptr;
+UCHAR               **block_link_ptr;
+#endif
+
+
+    /* Check for an invalid or already created pool.  */
+    if ((pool_ptr == TX_NULL) || (pool_ptr -> tx_object_pool_id == TX_OBJECT_POOL_ID))
+    {
+
+        /* Pool is invalid, return an error.  */
+        status =  TX_POOL_ERROR;
+    }
+
+    /* Check for an invalid memory area.  */
+    else if (pool_start == TX_NULL)
+    {
+
+        /* Memory area is invalid, return an error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Check for an invalid object size.  */
+    else if (object_size == ((ULONG) 0))
+    {
+
+        /* Object size is invalid, return an error.  */
+        status =  TX_SIZE_ERROR;
+    }
+    else
+    {
+
+        /* Initialize the object pool control block to all zeros.  */
+        TX_MEMSET(pool_ptr, 0, (sizeof(TX_OBJECT_POOL)));
+
+        /* Create the block pool that holds the objects.  */
+        status =  _tx_block_pool_create(&(pool_ptr -> tx_object_pool_block_pool), name_ptr, object_size, pool_start, pool_size);
+    }
+
+    /* Determine if the block pool is created.  */
+    if (status == TX_SUCCESS)
+    {
+
+#ifdef TX_OBJECT_POOL_ENABLE_POISON
+
+        /* Poison all the objects, which are free. The block pool is not used yet, so its available list
+           can be walked without disabling interrupts.  */
+        block_ptr =  pool_ptr -> tx_object_pool_block_pool.tx_block_pool_available_list;
+        while (block_ptr != TX_NULL)
+        {
+
+            /* Poison the object, which follows the link of the block.  */
+            _tx_object_poison(pool_ptr, TX_UCHAR_POINTER_ADD(block_ptr, (sizeof(UCHAR *))));
+
+            /* Move to the next block.  */
+            block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(block_ptr);
+            block_ptr =       *block_link_ptr;
+        }
+#endif
+
+        /* Save the name of the object class and the object size.  */
+        pool_ptr -> tx_object_pool_name =         name_ptr;
+        pool_ptr -> tx_object_pool_object_size =  object_size;
+
+        /* Disable interrupts to place the object pool on the created list.  */
+        TX_DISABLE
+
+        /* Setup the object pool ID to make it valid.  */
+        pool_ptr -> tx_object_pool_id =  TX_OBJECT_POOL_ID;
+
+        /* Place the object pool on the list of created object pools.  First,
+           check for an empty list.  */
+        if (_tx_object_pool_created_count == TX_EMPTY)
+        {
+
+            /* The created object pool list is empty.  Add object pool to empty list.  */
+            _tx_object_pool_created_ptr =                  pool_ptr;
+            pool_ptr -> tx_object_pool_created_next =      pool_ptr;
+            pool_ptr -> tx_object_pool_created_previous =  pool_ptr;
+        }
+        else
+        {
+
+            /* This list is not NULL, add to the end of the list.  */
+            next_pool =      _tx_object_pool_created_ptr;
+            previous_pool =  next_pool -> tx_object_pool_created_previous;
+
+            /* Place the new object pool in the list.  */
+            next_pool -> tx_object_pool_created_previous =  pool_ptr;
+            previous_pool -> tx_object_pool_created_next =  pool_ptr;
+
+            /* Setup this object pool's created links.  */
+            pool_ptr -> tx_object_pool_created_previous =  previous_pool;
+            pool_ptr -> tx_object_pool_created_next =      next_pool;
+        }
+
+        /* Increment the created count.  */
+        _tx_object_pool_created_count++;
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_object_pool_delete                              PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function deletes the specified object pool and its block       */
+/*    pool. Threads suspended on the pool are resumed with TX_DELETED.    */
+/*    Objects still in use must no longer be accessed.                    */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to object pool            */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*    TX_POOL_ERROR                     Invalid pool                      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_pool_delete             Delete the block pool             */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_object_pool_delete(TX_OBJECT_POOL *pool_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+TX_OBJECT_POOL      *next_pool;
+TX_OBJECT_POOL      *previous_pool;
+
+
+    /* Default status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Disable interrupts to remove the object pool from the created list.  */
+    TX_DISABLE
+
+    /* Check for an invalid pool.  */
+    if ((pool_ptr == TX_NULL) || (pool_ptr -> tx_object_pool_id != TX_OBJECT_POOL_ID))
+    {
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Pool is invalid, return an error.  */
+        status =  TX_POOL_ERROR;
+    }
+    else
+    {
+
+        /* Clear the object pool ID to make it invalid.  */
+        pool_ptr -> tx_object_pool_id =  TX_CLEAR_ID;
+
+        /* Decrement the number of object pools created.  */
+        _tx_object_pool_created_count--;
+
+        /* See if the object pool is the only one on the list.  */
+        if (_tx_object_pool_created_count == TX_EMPTY)
+        {
+
+            /* Only created object pool, just set the created list to NULL.  */
+            _tx_object_pool_created_ptr =  TX_NULL;
+        }
+        else
+        {
+
+            /* Link-up the neighbors.  */
+            next_pool =                                      pool_ptr -> tx_object_pool_created_next;
+            previous_pool =                                  pool_ptr -> tx_object_pool_created_previous;
+            next_pool -> tx_object_pool_created_previous =   previous_pool;
+            previous_pool -> tx_object_pool_created_next =   next_pool;
+
+            /* See if we have to update the created list head pointer.  */
+            if (_tx_object_pool_created_ptr == pool_ptr)
+            {
+
+                /* Yes, move the head pointer to the next link. */
+                _tx_object_pool_created_ptr =  next_pool;
+            }
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+        /* Delete the block pool, which resumes the threads suspended on it.  */
+        status =  _tx_block_pool_delete(&(pool_ptr -> tx_object_pool_block_pool));
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_object_allocate                                 PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function allocates an object from the specified object pool,   */
+/*    in constant time unless it suspends, and updates the statistics     */
+/*    of the pool. When poisoning is enabled, the poison of the object    */
+/*    is checked, and a damaged poison is counted as a corruption.        */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to object pool            */
+/*    object_ptr                        Destination for the object        */
+/*    wait_option                       Suspension option                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*    TX_POOL_ERROR                     Invalid pool                      */
+/*    TX_PTR_ERROR                      Invalid destination pointer       */
+/*    TX_WAIT_ERROR                     Invalid wait option               */
+/*    status                            Block allocation status           */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_block_allocate                Allocate the block                */
+/*    _tx_object_poison_check           Check the poison of an object     */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_object_allocate(TX_OBJECT_POOL *pool_ptr, VOID **object_ptr, ULONG wait_option)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        status;
+
+
+    /* Check for an invalid pool.  */
+    if ((pool_ptr == TX_NULL) || (pool_ptr -> tx_object_pool_id != TX_OBJECT_POOL_ID))
+    {
+
+        /* Pool is invalid, return an error.  */
+        status =  TX_POOL_ERROR;
+    }
+
+    /* Check for an invalid destination.  */
+    else if (object_ptr == TX_NULL)
+    {
+
+        /* Destination is invalid, return an error.  */
+        status =  TX_PTR_ERROR;
+    }
+
+    /* Only threads are allowed any form of suspension.  */
+    else if ((wait_option != TX_NO_WAIT) && (TX_THREAD_GET_SYSTEM_STATE() != ((ULONG) 0)))
+    {
+
+        /* A non-thread is trying to suspend, return an error.  */
+        status =  TX_WAIT_ERROR;
+    }
+    else
+    {
+
+        /* Allocate the block of the object.  */
+        status =  _tx_block_allocate(&(pool_ptr -> tx_object_pool_block_pool), object_ptr, wait_option);
+
+        /* Disable interrupts to update the statistics.  */
+        TX_DISABLE
+
+        /* Determine if the pool was deleted while the thread was suspended.  */
+        if (pool_ptr -> tx_object_pool_id == TX_OBJECT_POOL_ID)
+        {
+
+            /* Determine if the object is allocated.  */
+            if (status == TX_SUCCESS)
+            {
+
+                /* Yes, count the allocation and the object in use.  */
+                pool_ptr -> tx_object_pool_allocations++;
+                pool_ptr -> tx_object_pool_in_use++;
+
+                /* Update the most objects ever in use.  */
+                if (pool_ptr -> tx_object_pool_in_use > pool_ptr -> tx_object_pool_high_water)
+                {
+                    pool_ptr -> tx_object_pool_high_water =  pool_ptr -> tx_object_pool_in_use;
+                }
+            }
+            else
+            {
+
+                /* No, count the failed allocation.  */
+                pool_ptr -> tx_object_pool_failures++;
+            }
+        }
+
+        /* Restore interrupts.  */
+        TX_RESTORE
+
+#ifdef TX_OBJECT_POOL_ENABLE_POISON
+
+        /* Determine if the object is allocated.  */
+        if (status == TX_SUCCESS)
+        {
+
+            /* Check that the object was not written while it was free.  */
+            if (_tx_object_poison_check(pool_ptr, *object_ptr) != TX_SUCCESS)
+            {
+
+                /* Disable interrupts to count the corruption.  */
+                TX_DISABLE
+
+                /* It was, count the corruption.  */
+                pool_ptr -> tx_object_pool_corruptions++;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+            }
+        }
+#endif
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_object_free                                     PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function frees an object to the object pool it was allocated   */
+/*    from, in constant time. An object that is not in use in the pool    */
+/*    is rejected, which catches frees to the wrong pool and double       */
+/*    frees. When poisoning is enabled, the object is poisoned.           */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to object pool            */
+/*    object_ptr                        Pointer to object                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*    TX_POOL_ERROR                     Invalid pool                      */
+/*    TX_PTR_ERROR                      Object is not in use in the pool  */
+/*    status                            Block release status              */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    _tx_object_poison                 Poison a free object              */
+/*    _tx_block_release                 Release the block                 */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_object_free(TX_OBJECT_POOL *pool_ptr, VOID *object_ptr)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT                status;
+TX_BLOCK_POOL       *block_pool_ptr;
+UCHAR               *work_ptr;
+UCHAR               *pool_end;
+UCHAR               **block_link_ptr;
+
+
+    /* Check for an invalid pool.  */
+    if ((pool_ptr == TX_NULL) || (pool_ptr -> tx_object_pool_id != TX_OBJECT_POOL_ID))
+    {
+
+        /* Pool is invalid, return an error.  */
+        status =  TX_POOL_ERROR;
+    }
+    else
+    {
+
+        /* Pickup the block pool and the end of its memory area.  */
+        block_pool_ptr =  &(pool_ptr -> tx_object_pool_block_pool);
+        pool_end =        TX_UCHAR_POINTER_ADD(block_pool_ptr -> tx_block_pool_start, block_pool_ptr -> tx_block_pool_size);
+
+        /* Pickup the block of the object, which starts with its link.  */
+        work_ptr =  TX_VOID_TO_UCHAR_POINTER_CONVERT(object_ptr);
+
+        /* Check for an object outside the memory area of the pool.  */
+        if ((work_ptr < TX_UCHAR_POINTER_ADD(block_pool_ptr -> tx_block_pool_start, (sizeof(UCHAR *)))) || (work_ptr >= pool_end))
+        {
+
+            /* Object is not from this pool, return an error.  */
+            status =  TX_PTR_ERROR;
+        }
+        else
+        {
+
+            /* Pickup the link of the block, which points to the block pool while the block is allocated.  */
+            work_ptr =        TX_UCHAR_POINTER_SUB(work_ptr, (sizeof(UCHAR *)));
+            block_link_ptr =  TX_UCHAR_TO_INDIRECT_UCHAR_POINTER_CONVERT(work_ptr);
+
+            /* Disable interrupts to update the statistics.  */
+            TX_DISABLE
+
+            /* Check for an object that is not in use.  */
+            if (*block_link_ptr != TX_BLOCK_POOL_TO_UCHAR_POINTER_CONVERT(block_pool_ptr))
+            {
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+                /* Object is free or not an object, return an error.  */
+                status =  TX_PTR_ERROR;
+            }
+            else
+            {
+
+                /* One object less is in use.  */
+                pool_ptr -> tx_object_pool_in_use--;
+
+                /* Restore interrupts.  */
+                TX_RESTORE
+
+#ifdef TX_OBJECT_POOL_ENABLE_POISON
+
+                /* Poison the object before it is free.  */
+                _tx_object_poison(pool_ptr, object_ptr);
+#endif
+
+                /* Release the block of the object.  */
+                status =  _tx_block_release(object_ptr);
+            }
+        }
+    }
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_object_pool_info_get                            PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves information about the specified object      */
+/*    pool. Starting with _tx_object_pool_created_ptr and following       */
+/*    next_pool visits every object class.                                */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to object pool            */
+/*    name                              Destination for the class name    */
+/*    object_size                       Destination for the object size   */
+/*    total_objects                     Destination for the number of     */
+/*                                        objects in the pool             */
+/*    in_use                            Destination for the number of     */
+/*                                        objects in use                  */
+/*    high_water                        Destination for the most objects  */
+/*                                        ever in use                     */
+/*    next_pool                         Destination for the next pool on  */
+/*                                        the created list                */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*    TX_POOL_ERROR                     Invalid pool                      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_object_pool_info_get(TX_OBJECT_POOL *pool_ptr, CHAR **name, ULONG *object_size, ULONG *total_objects,
+                    ULONG *in_use, ULONG *high_water, TX_OBJECT_POOL **next_pool)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        status;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Check for an invalid pool.  */
+    if ((pool_ptr == TX_NULL) || (pool_ptr -> tx_object_pool_id != TX_OBJECT_POOL_ID))
+    {
+
+        /* Pool is invalid, return an error.  */
+        status =  TX_POOL_ERROR;
+    }
+    else
+    {
+
+        /* Retrieve all the pertinent information and return it in the supplied
+           destinations.  */
+
+        /* Retrieve the name of the object class.  */
+        if (name != TX_NULL)
+        {
+
+            *name =  pool_ptr -> tx_object_pool_name;
+        }
+
+        /* Retrieve the object size.  */
+        if (object_size != TX_NULL)
+        {
+
+            *object_size =  pool_ptr -> tx_object_pool_object_size;
+        }
+
+        /* Retrieve the number of objects in the pool.  */
+        if (total_objects != TX_NULL)
+        {
+
+            *total_objects =  (ULONG) pool_ptr -> tx_object_pool_block_pool.tx_block_pool_total;
+        }
+
+        /* Retrieve the number of objects in use.  */
+        if (in_use != TX_NULL)
+        {
+
+            *in_use =  pool_ptr -> tx_object_pool_in_use;
+        }
+
+        /* Retrieve the most objects ever in use.  */
+        if (high_water != TX_NULL)
+        {
+
+            *high_water =  pool_ptr -> tx_object_pool_high_water;
+        }
+
+        /* Retrieve the pointer to the next object pool created.  */
+        if (next_pool != TX_NULL)
+        {
+
+            *next_pool =  pool_ptr -> tx_object_pool_created_next;
+        }
+
+        /* Return success.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(status);
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_object_pool_performance_info_get                PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function retrieves the allocation statistics of the            */
+/*    specified object pool.                                              */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to object pool            */
+/*    allocations                       Destination for the number of     */
+/*                                        allocations                     */
+/*    failures                          Destination for the number of     */
+/*                                        allocations that failed         */
+/*    corruptions                       Destination for the number of     */
+/*                                        free objects found written      */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Successful completion             */
+/*    TX_POOL_ERROR                     Invalid pool                      */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    Application Code                                                    */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+UINT  _tx_object_pool_performance_info_get(TX_OBJECT_POOL *pool_ptr, ULONG *allocations, ULONG *failures,
+                    ULONG *corruptions)
+{
+
+TX_INTERRUPT_SAVE_AREA
+
+UINT        status;
+
+
+    /* Disable interrupts.  */
+    TX_DISABLE
+
+    /* Check for an invalid pool.  */
+    if ((pool_ptr == TX_NULL) || (pool_ptr -> tx_object_pool_id != TX_OBJECT_POOL_ID))
+    {
+
+        /* Pool is invalid, return an error.  */
+        status =  TX_POOL_ERROR;
+    }
+    else
+    {
+
+        /* Retrieve the number of allocations.  */
+        if (allocations != TX_NULL)
+        {
+
+            *allocations =  pool_ptr -> tx_object_pool_allocations;
+        }
+
+        /* Retrieve the number of allocations that failed.  */
+        if (failures != TX_NULL)
+        {
+
+            *failures =  pool_ptr -> tx_object_pool_failures;
+        }
+
+        /* Retrieve the number of corruptions found.  */
+        if (corruptions != TX_NULL)
+        {
+
+            *corruptions =  pool_ptr -> tx_object_pool_corruptions;
+        }
+
+        /* Return success.  */
+        status =  TX_SUCCESS;
+    }
+
+    /* Restore interrupts.  */
+    TX_RESTORE
+
+    /* Return completion status.  */
+    return(status);
+}
+#ifdef TX_OBJECT_POOL_ENABLE_POISON
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_object_poison                                   PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function fills the block of a free object with the poison      */
+/*    pattern.                                                            */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to object pool            */
+/*    object_ptr                        Pointer to object                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_object_pool_create            Create object pool                */
+/*    _tx_object_free                   Free object                       */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+static VOID  _tx_object_poison(TX_OBJECT_POOL *pool_ptr, VOID *object_ptr)
+{
+
+ULONG       *word_ptr;
+ULONG       words;
+
+
+    /* Pickup the object and its number of words. Blocks are a whole number of words.  */
+    word_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(object_ptr);
+    words =     ((ULONG) pool_ptr -> tx_object_pool_block_pool.tx_block_pool_block_size) / (sizeof(ULONG));
+
+    /* Fill the words with the poison pattern.  */
+    while (words != ((ULONG) 0))
+    {
+        *word_ptr =  TX_OBJECT_POOL_POISON;
+        word_ptr =   TX_ULONG_POINTER_ADD(word_ptr, 1);
+        words--;
+    }
+}
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  FUNCTION                                               RELEASE        */
+/*                                                                        */
+/*    _tx_object_poison_check                             PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This function checks that the block of an object allocated from     */
+/*    the pool is still filled with the poison pattern.                   */
+/*                                                                        */
+/*  INPUT                                                                 */
+/*                                                                        */
+/*    pool_ptr                          Pointer to object pool            */
+/*    object_ptr                        Pointer to object                 */
+/*                                                                        */
+/*  OUTPUT                                                                */
+/*                                                                        */
+/*    TX_SUCCESS                        Poison is intact                  */
+/*    TX_NOT_DONE                       Object was written while free     */
+/*                                                                        */
+/*  CALLS                                                                 */
+/*                                                                        */
+/*    None                                                                */
+/*                                                                        */
+/*  CALLED BY                                                             */
+/*                                                                        */
+/*    _tx_object_allocate               Allocate object                   */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+static UINT  _tx_object_poison_check(TX_OBJECT_POOL *pool_ptr, VOID *object_ptr)
+{
+
+ULONG       *word_ptr;
+ULONG       words;
+UINT        status;
+
+
+    /* Pickup the object and its number of words.  */
+    word_ptr =  TX_VOID_TO_ULONG_POINTER_CONVERT(object_ptr);
+    words =     ((ULONG) pool_ptr -> tx_object_pool_block_pool.tx_block_pool_block_size) / (sizeof(ULONG));
+
+    /* Default the status to success.  */
+    status =  TX_SUCCESS;
+
+    /* Check the words for the poison pattern.  */
+    while (words != ((ULONG) 0))
+    {
+
+        /* Determine if the word was written.  */
+        if (*word_ptr != TX_OBJECT_POOL_POISON)
+        {
+
+            /* Yes, the object was written while free.  */
+            status =  TX_NOT_DONE;
+        }
+        word_ptr =  TX_ULONG_POINTER_ADD(word_ptr, 1);
+        words--;
+    }
+
+    /* Return the status of the check.  */
+    return(status);
+}
+#endif
+
@@ -0,0 +1,125 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+
+/**************************************************************************/
+/**************************************************************************/
+/**                                                                       */
+/** ThreadX Component                                                     */
+/**                                                                       */
+/**   Object Pool Kit                                                     */
+/**                                                                       */
+/**************************************************************************/
+/**************************************************************************/
+
+
+/**************************************************************************/
+/*                                                                        */
+/*  COMPONENT DEFINITION                                   RELEASE        */
+/*                                                                        */
+/*    tx_object_pool.h                                    PORTABLE C      */
+/*                                                           6.1.2        */
+/*  AUTHOR                                                                */
+/*                                                                        */
+/*    agent                                                               */
+/*                                                                        */
+/*  DESCRIPTION                                                           */
+/*                                                                        */
+/*    This file defines the ThreadX object pool kit, which keeps typed    */
+/*    pools of fixed-size objects in block pools. It is assumed that      */
+/*    tx_api.h and tx_port.h have already been included.                  */
+/*                                                                        */
+/*  RELEASE HISTORY                                                       */
+/*                                                                        */
+/*    DATE              NAME                      DESCRIPTION             */
+/*                                                                        */
+/*  10-19-2026     agent                    Initial Version 6.1.2         */
+/*                                                                        */
+/**************************************************************************/
+
+#ifndef TX_OBJECT_POOL_H
+#define TX_OBJECT_POOL_H
+
+
+/* An object pool holds the objects of one class, such as the per-request bookkeeping of a
+   protocol client, in a block pool of blocks the size of the object. Objects are allocated
+   and freed in constant time and, unlike the byte pool, the pool never fragments, so steady
+   traffic cannot fail for lack of a large enough fragment. Each pool is named after its class
+   and counts the objects in use, the most ever in use, the allocations, the allocations that
+   failed and the corruptions found. Pools are kept on a created list, which
+   _tx_object_pool_info_get walks to examine every class.
+
+   An object can only be freed to the pool it was allocated from, and only once; other frees
+   are rejected with TX_PTR_ERROR. When TX_OBJECT_POOL_ENABLE_POISON is defined, free objects
+   are filled with TX_OBJECT_POOL_POISON, which is checked when they are allocated again, so
+   writes to freed objects are counted as corruptions, and allocated objects start out filled
+   with the pattern. Poisoning makes allocate and free proportional to the object size.  */
+
+#ifndef TX_OBJECT_POOL_POISON
+#define TX_OBJECT_POOL_POISON                   ((ULONG) 0xDEADBEEFUL)
+#endif
+
+
+/* Define the object pool ID, "OBJP", used for error checking.  */
+
+#define TX_OBJECT_POOL_ID                       ((ULONG) 0x4F424A50UL)
+
+
+/* Define the object pool control block.  */
+
+typedef struct TX_OBJECT_POOL_STRUCT
+{
+
+    /* Define the object pool ID used for error checking.  */
+    ULONG               tx_object_pool_id;
+
+    /* Define the name of the object class.  */
+    CHAR                *tx_object_pool_name;
+
+    /* Define the block pool that holds the objects, and the size of an object.  */
+    TX_BLOCK_POOL       tx_object_pool_block_pool;
+    ULONG               tx_object_pool_object_size;
+
+    /* Define the number of objects in use and the most ever in use.  */
+    ULONG               tx_object_pool_in_use;
+    ULONG               tx_object_pool_high_water;
+
+    /* Define the number of allocations, of failed allocations and of corruptions found.  */
+    ULONG               tx_object_pool_allocations;
+    ULONG               tx_object_pool_failures;
+    ULONG               tx_object_pool_corruptions;
+
+    /* Define the created list next and previous pointers.  */
+    struct TX_OBJECT_POOL_STRUCT
+                        *tx_object_pool_created_next,
+                        *tx_object_pool_created_previous;
+} TX_OBJECT_POOL;
+
+
+/* Define the created list of object pools.  */
+
+extern TX_OBJECT_POOL   *_tx_object_pool_created_ptr;
+extern ULONG            _tx_object_pool_created_count;
+
+
+/* Define the object pool functions.  */
+
+UINT    _tx_object_pool_create(TX_OBJECT_POOL *pool_ptr, CHAR *name_ptr, ULONG object_size,
+                    VOID *pool_start, ULONG pool_size);
+UINT    _tx_object_pool_delete(TX_OBJECT_POOL *pool_ptr);
+UINT    _tx_object_allocate(TX_OBJECT_POOL *pool_ptr, VOID **object_ptr, ULONG wait_option);
+UINT    _tx_object_free(TX_OBJECT_POOL *pool_ptr, VOID *object_ptr);
+UINT    _tx_object_pool_info_get(TX_OBJECT_POOL *pool_ptr, CHAR **name, ULONG *object_size, ULONG *total_objects,
+                    ULONG *in_use, ULONG *high_water, TX_OBJECT_POOL **next_pool);
+UINT    _tx_object_pool_performance_info_get(TX_OBJECT_POOL *pool_ptr, ULONG *allocations, ULONG *failures,
+                    ULONG *corruptions);
+
+#endif
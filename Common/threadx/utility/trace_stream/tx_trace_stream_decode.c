@@ -0,0 +1,572 @@
+/**************************************************************************/
+/*                                                                        */
+/*       Copyright (c) Microsoft Corporation. All rights reserved.        */
+/*                                                                        */
+/*       This software is licensed under the Microsoft Software License   */
+/*       Terms for Microsoft Azure RTOS. Full text of the license can be  */
+/*       found in the LICENSE file at https://aka.ms/AzureRTOS_EULA       */
+/*       and in the root directory of this software.                      */
+/*                                                                        */
+/**************************************************************************/
+
+/* This is the host decoder of the ThreadX trace stream, which is produced by tx_trace_stream_drain
+   when TX_TRACE_ENABLE_STREAMING is defined. The stream format is described in tx_trace.h. The
+   decoder reconstructs the timeline of the events, with the time stamps accumulated from their
+   deltas so the timeline continues past a wrap of the time source, and names the threads and
+   objects from the object records. It prints one line per event, followed by a summary of the
+   events of each thread and of the dropped events:
+
+        tx_trace_stream_decode [-s] <stream file>
+
+   With -s, only the summary is printed. Times are in units of the trace time source. Thread and
+   object pointers are the 32-bit ULONG values of the target. The Linux port only supports the trace
+   on 32-bit hosts, since the pointers of a 64-bit host do not fit.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* Define the stream records, see tx_trace.h.  */
+
+#define STREAM_VERSION              1UL
+#define STREAM_RECORD_HEADER        0x40
+#define STREAM_RECORD_OBJECT        0x41
+#define STREAM_RECORD_DROPPED       0x42
+#define STREAM_EVENT_LAST           0x3F
+#define STREAM_EVENT_THREAD         0x01
+#define STREAM_EVENT_PRIORITY       0x02
+#define STREAM_EVENT_INFO_1         0x04
+
+
+/* Define the special thread pointers of events outside of a thread.  */
+
+#define STREAM_THREAD_ISR           0xFFFFFFFFUL
+#define STREAM_THREAD_INITIALIZE    0xF0F0F0F0UL
+
+
+/* Define the first user event.  */
+
+#define STREAM_USER_EVENT_START     4096UL
+
+
+/* Define the limits of the decoder.  */
+
+#define DECODE_OBJECTS_MAX          1024
+#define DECODE_CONTEXTS_MAX         256
+#define DECODE_NAME_SIZE            64
+
+
+/* Define the ThreadX event names.  */
+
+typedef struct DECODE_EVENT_NAME_STRUCT
+{
+    unsigned long       id;
+    const char         *name;
+} DECODE_EVENT_NAME;
+
+static const DECODE_EVENT_NAME  decode_event_names[] =
+{
+    {   1, "THREAD_RESUME" },
+    {   2, "THREAD_SUSPEND" },
+    {   3, "ISR_ENTER" },
+    {   4, "ISR_EXIT" },
+    {   5, "TIME_SLICE" },
+    {   6, "RUNNING" },
+    {  10, "BLOCK_ALLOCATE" },
+    {  11, "BLOCK_POOL_CREATE" },
+    {  12, "BLOCK_POOL_DELETE" },
+    {  13, "BLOCK_POOL_INFO_GET" },
+    {  14, "BLOCK_POOL_PERFORMANCE_INFO_GET" },
+    {  15, "BLOCK_POOL__PERFORMANCE_SYSTEM_INFO_GET" },
+    {  16, "BLOCK_POOL_PRIORITIZE" },
+    {  17, "BLOCK_RELEASE" },
+    {  20, "BYTE_ALLOCATE" },
+    {  21, "BYTE_POOL_CREATE" },
+    {  22, "BYTE_POOL_DELETE" },
+    {  23, "BYTE_POOL_INFO_GET" },
+    {  24, "BYTE_POOL_PERFORMANCE_INFO_GET" },
+    {  25, "BYTE_POOL__PERFORMANCE_SYSTEM_INFO_GET" },
+    {  26, "BYTE_POOL_PRIORITIZE" },
+    {  27, "BYTE_RELEASE" },
+    {  30, "EVENT_FLAGS_CREATE" },
+    {  31, "EVENT_FLAGS_DELETE" },
+    {  32, "EVENT_FLAGS_GET" },
+    {  33, "EVENT_FLAGS_INFO_GET" },
+    {  34, "EVENT_FLAGS_PERFORMANCE_INFO_GET" },
+    {  35, "EVENT_FLAGS__PERFORMANCE_SYSTEM_INFO_GET" },
+    {  36, "EVENT_FLAGS_SET" },
+    {  37, "EVENT_FLAGS_SET_NOTIFY" },
+    {  40, "INTERRUPT_CONTROL" },
+    {  50, "MUTEX_CREATE" },
+    {  51, "MUTEX_DELETE" },
+    {  52, "MUTEX_GET" },
+    {  53, "MUTEX_INFO_GET" },
+    {  54, "MUTEX_PERFORMANCE_INFO_GET" },
+    {  55, "MUTEX_PERFORMANCE_SYSTEM_INFO_GET" },
+    {  56, "MUTEX_PRIORITIZE" },
+    {  57, "MUTEX_PUT" },
+    {  60, "QUEUE_CREATE" },
+    {  61, "QUEUE_DELETE" },
+    {  62, "QUEUE_FLUSH" },
+    {  63, "QUEUE_FRONT_SEND" },
+    {  64, "QUEUE_INFO_GET" },
+    {  65, "QUEUE_PERFORMANCE_INFO_GET" },
+    {  66, "QUEUE_PERFORMANCE_SYSTEM_INFO_GET" },
+    {  67, "QUEUE_PRIORITIZE" },
+    {  68, "QUEUE_RECEIVE" },
+    {  69, "QUEUE_SEND" },
+    {  70, "QUEUE_SEND_NOTIFY" },
+    {  71, "QUEUE_POINTER_RECEIVE" },
+    {  72, "QUEUE_POINTER_SEND" },
+    {  80, "SEMAPHORE_CEILING_PUT" },
+    {  81, "SEMAPHORE_CREATE" },
+    {  82, "SEMAPHORE_DELETE" },
+    {  83, "SEMAPHORE_GET" },
+    {  84, "SEMAPHORE_INFO_GET" },
+    {  85, "SEMAPHORE_PERFORMANCE_INFO_GET" },
+    {  86, "SEMAPHORE__PERFORMANCE_SYSTEM_INFO_GET" },
+    {  87, "SEMAPHORE_PRIORITIZE" },
+    {  88, "SEMAPHORE_PUT" },
+    {  89, "SEMAPHORE_PUT_NOTIFY" },
+    { 100, "THREAD_CREATE" },
+    { 101, "THREAD_DELETE" },
+    { 102, "THREAD_ENTRY_EXIT_NOTIFY" },
+    { 103, "THREAD_IDENTIFY" },
+    { 104, "THREAD_INFO_GET" },
+    { 105, "THREAD_PERFORMANCE_INFO_GET" },
+    { 106, "THREAD_PERFORMANCE_SYSTEM_INFO_GET" },
+    { 107, "THREAD_PREEMPTION_CHANGE" },
+    { 108, "THREAD_PRIORITY_CHANGE" },
+    { 109, "THREAD_RELINQUISH" },
+    { 110, "THREAD_RESET" },
+    { 111, "THREAD_RESUME_API" },
+    { 112, "THREAD_SLEEP" },
+    { 113, "THREAD_STACK_ERROR_NOTIFY" },
+    { 114, "THREAD_SUSPEND_API" },
+    { 115, "THREAD_TERMINATE" },
+    { 116, "THREAD_TIME_SLICE_CHANGE" },
+    { 117, "THREAD_WAIT_ABORT" },
+    { 120, "TIME_GET" },
+    { 121, "TIME_SET" },
+    { 122, "TIMER_ACTIVATE" },
+    { 123, "TIMER_CHANGE" },
+    { 124, "TIMER_CREATE" },
+    { 125, "TIMER_DEACTIVATE" },
+    { 126, "TIMER_DELETE" },
+    { 127, "TIMER_INFO_GET" },
+    { 128, "TIMER_PERFORMANCE_INFO_GET" },
+    { 129, "TIMER_PERFORMANCE_SYSTEM_INFO_GET" },
+};
+
+
+/* Define the objects, from the object records.  */
+
+typedef struct DECODE_OBJECT_STRUCT
+{
+    unsigned long       pointer;
+    unsigned int        type;
+    char                name[DECODE_NAME_SIZE];
+} DECODE_OBJECT;
+
+static DECODE_OBJECT    decode_objects[DECODE_OBJECTS_MAX];
+static unsigned long    decode_object_count;
+
+
+/* Define the per context statistics of the summary, where a context is a thread, ISRs or
+   initialization.  */
+
+typedef struct DECODE_CONTEXT_STRUCT
+{
+    unsigned long       pointer;
+    unsigned long       events;
+    unsigned long long  first_time;
+    unsigned long long  last_time;
+} DECODE_CONTEXT;
+
+static DECODE_CONTEXT   decode_contexts[DECODE_CONTEXTS_MAX];
+static unsigned long    decode_context_count;
+
+
+/* Define the stream being decoded.  */
+
+static unsigned char   *decode_data;
+static size_t           decode_size;
+static size_t           decode_offset;
+
+
+/* Read a byte of the stream. Returns 0 at the end of the stream.  */
+
+static int  decode_byte_get(unsigned int *value)
+{
+
+    if (decode_offset >= decode_size)
+    {
+        return(0);
+    }
+    *value =  decode_data[decode_offset++];
+    return(1);
+}
+
+
+/* Read an unsigned LEB128 varint of the stream. Returns 0 at the end of the stream.  */
+
+static int  decode_value_get(unsigned long *value)
+{
+
+unsigned int    byte;
+unsigned int    shift =  0;
+
+
+    *value =  0;
+    do
+    {
+        if ((decode_byte_get(&byte) == 0) || (shift > 28))
+        {
+            return(0);
+        }
+        *value |=  ((unsigned long) (byte & 0x7F)) << shift;
+        shift +=  7;
+    } while ((byte & 0x80) != 0);
+
+    /* Values are 32-bit.  */
+    *value &=  0xFFFFFFFFUL;
+    return(1);
+}
+
+
+/* Find the name of an event.  */
+
+static void  decode_event_name(unsigned long id, char *name, size_t size)
+{
+
+size_t  i;
+
+
+    for (i = 0; i < (sizeof(decode_event_names) / sizeof(decode_event_names[0])); i++)
+    {
+        if (decode_event_names[i].id == id)
+        {
+            snprintf(name, size, "%s", decode_event_names[i].name);
+            return;
+        }
+    }
+    if (id >= STREAM_USER_EVENT_START)
+    {
+        snprintf(name, size, "USER_EVENT_%lu", id - STREAM_USER_EVENT_START);
+    }
+    else
+    {
+        snprintf(name, size, "EVENT_%lu", id);
+    }
+}
+
+
+/* Find an object by its pointer.  */
+
+static DECODE_OBJECT  *decode_object_find(unsigned long pointer)
+{
+
+unsigned long   i;
+
+
+    for (i = 0; i < decode_object_count; i++)
+    {
+        if (decode_objects[i].pointer == pointer)
+        {
+            return(&decode_objects[i]);
+        }
+    }
+    return(NULL);
+}
+
+
+/* Find the name of a context.  */
+
+static void  decode_context_name(unsigned long pointer, char *name, size_t size)
+{
+
+DECODE_OBJECT  *object;
+
+
+    object =  decode_object_find(pointer);
+    if (pointer == STREAM_THREAD_ISR)
+    {
+        snprintf(name, size, "ISR");
+    }
+    else if (pointer == STREAM_THREAD_INITIALIZE)
+    {
+        snprintf(name, size, "initialize");
+    }
+    else if (object != NULL)
+    {
+        snprintf(name, size, "%s", object -> name);
+    }
+    else
+    {
+        snprintf(name, size, "thread 0x%08lx", pointer);
+    }
+}
+
+
+/* Account for an event in the statistics of its context.  */
+
+static void  decode_context_update(unsigned long pointer, unsigned long long time)
+{
+
+unsigned long   i;
+
+
+    for (i = 0; i < decode_context_count; i++)
+    {
+        if (decode_contexts[i].pointer == pointer)
+        {
+            break;
+        }
+    }
+    if (i == decode_context_count)
+    {
+        if (decode_context_count == DECODE_CONTEXTS_MAX)
+        {
+            return;
+        }
+        decode_context_count++;
+        decode_contexts[i].pointer =     pointer;
+        decode_contexts[i].events =      0;
+        decode_contexts[i].first_time =  time;
+    }
+    decode_contexts[i].events++;
+    decode_contexts[i].last_time =  time;
+}
+
+
+/* Define the decoder entry point.  */
+
+int  main(int argc, char **argv)
+{
+
+FILE                   *file;
+const char             *file_name;
+int                     summary_only =  0;
+long                    file_size;
+unsigned int            tag;
+unsigned int            byte;
+unsigned long           value;
+unsigned long           id;
+unsigned long           delta;
+unsigned long           info[4];
+unsigned long           thread =  0;
+unsigned long           priority =  0;
+unsigned long           time_mask =  0;
+unsigned long long      time =  0;
+unsigned long long      first_time =  0;
+unsigned long           events =  0;
+unsigned long           dropped =  0;
+unsigned long           headers =  0;
+unsigned long           i;
+size_t                  record_offset =  0;
+size_t                  name_length;
+char                    context_name[DECODE_NAME_SIZE];
+char                    event_name[DECODE_NAME_SIZE];
+DECODE_OBJECT          *object;
+int                     complete =  0;
+
+
+    /* Pickup the arguments.  */
+    if ((argc == 3) && (strcmp(argv[1], "-s") == 0))
+    {
+        summary_only =  1;
+        file_name =     argv[2];
+    }
+    else if (argc == 2)
+    {
+        file_name =  argv[1];
+    }
+    else
+    {
+        fprintf(stderr, "usage: %s [-s] <stream file>\n", argv[0]);
+        return(EXIT_FAILURE);
+    }
+
+    /* Read the whole stream.  */
+    file =  fopen(file_name, "rb");
+    if ((file == NULL) || (fseek(file, 0, SEEK_END) != 0) || ((file_size = ftell(file)) < 0) ||
+        (fseek(file, 0, SEEK_SET) != 0))
+    {
+        fprintf(stderr, "%s: cannot read %s\n", argv[0], file_name);
+        return(EXIT_FAILURE);
+    }
+    decode_size =  (size_t) file_size;
+    decode_data =  malloc(decode_size + 1);
+    if ((decode_data == NULL) || (fread(decode_data, 1, decode_size, file) != decode_size))
+    {
+        fprintf(stderr, "%s: cannot read %s\n", argv[0], file_name);
+        return(EXIT_FAILURE);
+    }
+    fclose(file);
+
+    /* Decode the records.  */
+    while (decode_offset < decode_size)
+    {
+
+        record_offset =  decode_offset;
+        decode_byte_get(&tag);
+        complete =  0;
+
+        if (tag == STREAM_RECORD_HEADER)
+        {
+
+            /* The stream starts, or the trace was enabled again. The timeline continues.  */
+            if ((decode_offset + 4 > decode_size) || (memcmp(&decode_data[decode_offset], "TXTS", 4) != 0))
+            {
+                break;
+            }
+            decode_offset +=  4;
+            if ((decode_value_get(&value) == 0) || (decode_value_get(&time_mask) == 0))
+            {
+                break;
+            }
+            if (value != STREAM_VERSION)
+            {
+                fprintf(stderr, "%s: unsupported stream version %lu\n", argv[0], value);
+                return(EXIT_FAILURE);
+            }
+            headers++;
+            thread =    0;
+            priority =  0;
+            if (summary_only == 0)
+            {
+                printf("--- trace header, time mask 0x%08lx\n", time_mask);
+            }
+            complete =  1;
+        }
+        else if (tag == STREAM_RECORD_OBJECT)
+        {
+
+            /* Name an object, or rename a reused one.  */
+            if ((decode_value_get(&value) == 0) || (decode_byte_get(&byte) == 0))
+            {
+                break;
+            }
+            object =  decode_object_find(value);
+            if ((object == NULL) && (decode_object_count < DECODE_OBJECTS_MAX))
+            {
+                object =  &decode_objects[decode_object_count++];
+            }
+            if ((decode_value_get(&info[0]) == 0) || (decode_value_get(&info[1]) == 0))
+            {
+                break;
+            }
+            name_length =  strnlen((const char *) &decode_data[decode_offset], decode_size - decode_offset);
+            if (decode_offset + name_length >= decode_size)
+            {
+                break;
+            }
+            if (object != NULL)
+            {
+                object -> pointer =  value;
+                object -> type =     byte;
+                snprintf(object -> name, sizeof(object -> name), "%s", (const char *) &decode_data[decode_offset]);
+            }
+            decode_offset +=  name_length + 1;
+            complete =  1;
+        }
+        else if (tag == STREAM_RECORD_DROPPED)
+        {
+
+            /* Events were overwritten before being drained, the next delta spans them.  */
+            if (decode_value_get(&value) == 0)
+            {
+                break;
+            }
+            dropped +=  value;
+            if (summary_only == 0)
+            {
+                printf("*** %lu events dropped\n", value);
+            }
+            complete =  1;
+        }
+        else if (tag <= STREAM_EVENT_LAST)
+        {
+
+            /* Decode the event against the previous one.  */
+            if ((headers == 0) || (decode_value_get(&id) == 0) || (decode_value_get(&delta) == 0))
+            {
+                break;
+            }
+            if (((tag & STREAM_EVENT_THREAD) != 0) && (decode_value_get(&thread) == 0))
+            {
+                break;
+            }
+            if (((tag & STREAM_EVENT_PRIORITY) != 0) && (decode_value_get(&priority) == 0))
+            {
+                break;
+            }
+            for (i = 0; i < 4; i++)
+            {
+                info[i] =  0;
+                if (((tag & (STREAM_EVENT_INFO_1 << i)) != 0) && (decode_value_get(&info[i]) == 0))
+                {
+                    break;
+                }
+            }
+            if (i != 4)
+            {
+                break;
+            }
+
+            /* Accumulate the time.  */
+            time +=  delta & time_mask;
+            if (events == 0)
+            {
+                first_time =  time;
+            }
+            events++;
+            decode_context_update(thread, time);
+
+            if (summary_only == 0)
+            {
+                decode_context_name(thread, context_name, sizeof(context_name));
+                decode_event_name(id, event_name, sizeof(event_name));
+                if ((priority & 0x80000000UL) != 0)
+                {
+                    printf("%14llu %10lu  %-20s prio %3lu  %-32s 0x%08lx 0x%08lx 0x%08lx 0x%08lx\n", time, delta, context_name,
+                           priority & 0xFFFFUL, event_name, info[0], info[1], info[2], info[3]);
+                }
+                else
+                {
+                    printf("%14llu %10lu  %-20s           %-32s 0x%08lx 0x%08lx 0x%08lx 0x%08lx\n", time, delta, context_name,
+                           event_name, info[0], info[1], info[2], info[3]);
+                }
+            }
+            complete =  1;
+        }
+        else
+        {
+
+            /* Not a record, the stream is damaged.  */
+            fprintf(stderr, "%s: invalid record 0x%02x at offset %lu\n", argv[0], tag, (unsigned long) record_offset);
+            return(EXIT_FAILURE);
+        }
+    }
+
+    /* A partial record can only be at the end, when the stream was cut.  */
+    if ((complete == 0) && (decode_size != 0))
+    {
+        fprintf(stderr, "%s: stream ends in a partial record at offset %lu\n", argv[0], (unsigned long) record_offset);
+    }
+
+    /* Print the summary.  */
+    printf("%lu events in %lu bytes, %.2f bytes per event, %lu dropped, time %llu to %llu\n",
+           events, (unsigned long) decode_size, (events != 0) ? ((double) decode_size / (double) events) : 0.0,
+           dropped, first_time, time);
+    for (i = 0; i < decode_context_count; i++)
+    {
+        decode_context_name(decode_contexts[i].pointer, context_name, sizeof(context_name));
+        printf("  %-20s %10lu events, time %llu to %llu\n", context_name, decode_contexts[i].events,
+               decode_contexts[i].first_time, decode_contexts[i].last_time);
+    }
+
+    free(decode_data);
+    return((complete != 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -24,6 +24,18 @@
 #include "StdComponent.h"
 #include "SampleCommonDefine.h"
 
+#ifdef SAMPLE_DTLS_TELEMETRY_ENABLE
+#include "nx_dtls_telemetry.h"
+
+#ifndef NX_SECURE_ENABLE_DTLS
+#error "SAMPLE_DTLS_TELEMETRY_ENABLE requires NX_SECURE_ENABLE_DTLS"
+#endif /* NX_SECURE_ENABLE_DTLS */
+
+#if defined(SAMPLE_DTLS_TELEMETRY_PSK) && !defined(NX_SECURE_ENABLE_PSK_CIPHERSUITES)
+#error "SAMPLE_DTLS_TELEMETRY_PSK requires NX_SECURE_ENABLE_PSK_CIPHERSUITES"
+#endif /* SAMPLE_DTLS_TELEMETRY_PSK && !NX_SECURE_ENABLE_PSK_CIPHERSUITES */
+#endif /* SAMPLE_DTLS_TELEMETRY_ENABLE */
+
 #define ENDPOINT  "global.azure-devices-provisioning.net"
 //#define DEBUG_FUNCTION_CALL
 
@@ -47,6 +59,23 @@ const CHAR response_description_failed[]  = "failed";
 #define SAMPLE_WAIT_OPTION                                              (NX_NO_WAIT)
 #endif /* SAMPLE_WAIT_OPTION */
 
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+/* Define the stack monitor settings. The monitor scans SAMPLE_STACK_MONITOR_SLICE_WORDS stack
+   words every SAMPLE_STACK_MONITOR_SLICE_TICKS ticks, and reports the threads that have less than
+   SAMPLE_STACK_MONITOR_HEADROOM percent of their stack left.  */
+#ifndef SAMPLE_STACK_MONITOR_SLICE_WORDS
+#define SAMPLE_STACK_MONITOR_SLICE_WORDS                                (64)
+#endif /* SAMPLE_STACK_MONITOR_SLICE_WORDS */
+
+#ifndef SAMPLE_STACK_MONITOR_SLICE_TICKS
+#define SAMPLE_STACK_MONITOR_SLICE_TICKS                                (1)
+#endif /* SAMPLE_STACK_MONITOR_SLICE_TICKS */
+
+#ifndef SAMPLE_STACK_MONITOR_HEADROOM
+#define SAMPLE_STACK_MONITOR_HEADROOM                                   (20)
+#endif /* SAMPLE_STACK_MONITOR_HEADROOM */
+#endif /* TX_THREAD_ENABLE_STACK_MONITOR */
+
 /* Sample events.  */
 
 /* Sample events.  */
@@ -61,6 +90,7 @@ const CHAR response_description_failed[]  = "failed";
 #define SAMPLE_DISCONNECT_EVENT                                         ((ULONG)0x00000080)
 #define SAMPLE_RECONNECT_EVENT                                          ((ULONG)0x00000100)
 #define SAMPLE_CONNECTED_EVENT                                          ((ULONG)0x00000200)
+#define SAMPLE_STACK_MONITOR_EVENT                                      ((ULONG)0x00000400)
 
 /* Sample states.  */
 #define SAMPLE_STATE_NONE                                               (0)
@@ -129,6 +159,22 @@ static UINT sample_device_info_sent;
 
 static UCHAR scratch_buffer[512];
 
+#ifdef SAMPLE_DTLS_TELEMETRY_ENABLE
+/* Define DTLS telemetry channel. Generic ciphersuites are used since the sample ones are for TLS only.  */
+extern NX_SECURE_TLS_CRYPTO nx_crypto_tls_ciphers;
+static NX_DTLS_TELEMETRY sample_dtls_telemetry;
+static UCHAR sample_dtls_telemetry_metadata_buffer[SAMPLE_DTLS_TELEMETRY_METADATA_SIZE];
+static UCHAR sample_dtls_telemetry_packet_buffer[SAMPLE_DTLS_TELEMETRY_PACKET_BUFFER_SIZE];
+#ifndef SAMPLE_DTLS_TELEMETRY_PSK
+static UCHAR sample_dtls_telemetry_cert_buffer[SAMPLE_DTLS_TELEMETRY_CERT_BUFFER_SIZE];
+
+/* A certificate can only be in one trusted store, so the collector CA gets its own copy.  */
+static NX_SECURE_X509_CERT sample_dtls_telemetry_ca_cert;
+#endif /* SAMPLE_DTLS_TELEMETRY_PSK */
+static NXD_ADDRESS sample_dtls_telemetry_server_address;
+static ULONG sample_dtls_telemetry_connect_time;
+#endif /* SAMPLE_DTLS_TELEMETRY_ENABLE */
+
 static UINT exponential_backoff_with_jitter()
 {
   double jitter_percent = (SAMPLE_MAX_EXPONENTIAL_BACKOFF_JITTER_PERCENT / 100.0) * (rand() / ((double)RAND_MAX));
@@ -441,6 +487,43 @@ static VOID sample_connection_error_recover(SAMPLE_CONTEXT *context)
   }
 }
 
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+/* The stack monitor calls this from the timer thread, so the report is left to the event loop.  */
+static VOID sample_stack_monitor_notify(TX_THREAD *thread_ptr, ULONG stack_used)
+{
+  NX_PARAMETER_NOT_USED(thread_ptr);
+  NX_PARAMETER_NOT_USED(stack_used);
+  
+  tx_event_flags_set(&(sample_context.sample_events), SAMPLE_STACK_MONITOR_EVENT, TX_OR);
+}
+
+/* Print the threads left with little stack, with their latest high-water marks.  */
+static VOID sample_stack_monitor_action(SAMPLE_CONTEXT *context)
+{
+  TX_THREAD *self_ptr = tx_thread_identify();
+  TX_THREAD *thread_ptr = self_ptr;
+  CHAR *thread_name;
+  ULONG stack_used;
+  ULONG stack_headroom;
+  
+  NX_PARAMETER_NOT_USED(context);
+  
+  do
+  {
+    if ((tx_thread_stack_monitor_info_get(thread_ptr, &stack_used, &stack_headroom, NX_NULL) == TX_SUCCESS) &&
+        ((stack_headroom * 100) < ((stack_used + stack_headroom) * SAMPLE_STACK_MONITOR_HEADROOM)))
+    {
+      tx_thread_info_get(thread_ptr, &thread_name, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+      AZURE_PRINTF("Stack monitor: %s used %lu of %lu bytes, %lu bytes left.\r\n",
+                   thread_name, stack_used, stack_used + stack_headroom, stack_headroom);
+    }
+    
+    /* The created threads form a ring.  */
+    tx_thread_info_get(thread_ptr, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL, &thread_ptr, NX_NULL);
+  } while (thread_ptr != self_ptr);
+}
+#endif /* TX_THREAD_ENABLE_STACK_MONITOR */
+
 static VOID sample_trigger_action(SAMPLE_CONTEXT *context)
 {
 #ifdef DEBUG_FUNCTION_CALL
@@ -941,6 +1024,14 @@ static VOID sample_event_loop(SAMPLE_CONTEXT *context)
       sample_connection_error_recover(context);
     }
     
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+    if (app_events & SAMPLE_STACK_MONITOR_EVENT)
+    {
+      AZURE_PRINTF("SAMPLE_STACK_MONITOR_EVENT\r\n");
+      sample_stack_monitor_action(context);
+    }
+#endif /* TX_THREAD_ENABLE_STACK_MONITOR */
+    
     sample_trigger_action(context);
   }
 }
@@ -963,6 +1054,108 @@ static VOID log_callback(az_log_classification classification, UCHAR *msg, UINT
   }
 }
 
+#ifdef SAMPLE_DTLS_TELEMETRY_ENABLE
+static UINT sample_dtls_telemetry_connect(NX_DTLS_TELEMETRY *telemetry_ptr)
+{
+  
+  sample_dtls_telemetry_connect_time = tx_time_get();
+  return(nx_dtls_telemetry_connect(telemetry_ptr, &sample_dtls_telemetry_server_address,
+                                   SAMPLE_DTLS_TELEMETRY_SERVER_PORT,
+                                   SAMPLE_DTLS_TELEMETRY_CONNECT_WAIT_OPTION));
+}
+
+static UINT sample_dtls_telemetry_sink(VOID *sink_context, UCHAR *data, UINT data_length)
+{
+  UINT status;
+  NX_DTLS_TELEMETRY *telemetry_ptr = (NX_DTLS_TELEMETRY *)sink_context;
+  
+  /* Samples are never queued. A failed send disconnects the channel, the caller then
+     sends the sample to IoT Hub and the collector is connected again later.  */
+  status = nx_dtls_telemetry_send(telemetry_ptr, data, data_length, NX_NO_WAIT);
+  if ((status == NX_NOT_CONNECTED) &&
+      ((tx_time_get() - sample_dtls_telemetry_connect_time) >= SAMPLE_DTLS_TELEMETRY_RECONNECT_PERIOD))
+  {
+    if ((status = sample_dtls_telemetry_connect(telemetry_ptr)))
+    {
+      AZURE_PRINTF("Failed to connect DTLS telemetry collector!: error code = 0x%08x\r\n", status);
+    }
+    else
+    {
+      status = nx_dtls_telemetry_send(telemetry_ptr, data, data_length, NX_NO_WAIT);
+    }
+  }
+  
+  return(status);
+}
+
+static UINT sample_dtls_telemetry_start(NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr)
+{
+  UINT status;
+  
+#ifdef DEBUG_FUNCTION_CALL
+  AZURE_PRINTF("-->sample_dtls_telemetry_start\r\n");
+#endif /* DEBUG_FUNCTION_CALL */
+  
+#ifdef SAMPLE_DTLS_TELEMETRY_PSK
+  if ((status = nx_dtls_telemetry_create(&sample_dtls_telemetry, "DTLS Telemetry", ip_ptr, pool_ptr,
+                                         &nx_crypto_tls_ciphers,
+                                         sample_dtls_telemetry_metadata_buffer,
+                                         sizeof(sample_dtls_telemetry_metadata_buffer),
+                                         sample_dtls_telemetry_packet_buffer,
+                                         sizeof(sample_dtls_telemetry_packet_buffer),
+                                         0, NX_NULL, 0)))
+  {
+    return(status);
+  }
+  
+  status = nx_dtls_telemetry_psk_add(&sample_dtls_telemetry,
+                                     (UCHAR *)SAMPLE_DTLS_TELEMETRY_PSK, sizeof(SAMPLE_DTLS_TELEMETRY_PSK) - 1,
+                                     (UCHAR *)SAMPLE_DTLS_TELEMETRY_PSK_IDENTITY,
+                                     sizeof(SAMPLE_DTLS_TELEMETRY_PSK_IDENTITY) - 1,
+                                     NX_NULL, 0);
+#else
+  if ((status = nx_dtls_telemetry_create(&sample_dtls_telemetry, "DTLS Telemetry", ip_ptr, pool_ptr,
+                                         &nx_crypto_tls_ciphers,
+                                         sample_dtls_telemetry_metadata_buffer,
+                                         sizeof(sample_dtls_telemetry_metadata_buffer),
+                                         sample_dtls_telemetry_packet_buffer,
+                                         sizeof(sample_dtls_telemetry_packet_buffer),
+                                         1, sample_dtls_telemetry_cert_buffer,
+                                         sizeof(sample_dtls_telemetry_cert_buffer))))
+  {
+    return(status);
+  }
+  
+  status = nx_secure_x509_certificate_initialize(&sample_dtls_telemetry_ca_cert,
+                                                 (UCHAR *)SAMPLE_DTLS_TELEMETRY_CA_CERT,
+                                                 (USHORT)SAMPLE_DTLS_TELEMETRY_CA_CERT_SIZE,
+                                                 NX_NULL, 0, NULL, 0, NX_SECURE_X509_KEY_TYPE_NONE);
+  if (!status)
+  {
+    status = nx_dtls_telemetry_trusted_certificate_add(&sample_dtls_telemetry, &sample_dtls_telemetry_ca_cert,
+                                                       (const UCHAR *)SAMPLE_DTLS_TELEMETRY_SERVER_NAME,
+                                                       sizeof(SAMPLE_DTLS_TELEMETRY_SERVER_NAME) - 1);
+  }
+#endif /* SAMPLE_DTLS_TELEMETRY_PSK */
+  
+  /* Set the sink even when the collector is not reachable yet, it connects again later.  */
+  if (!status)
+  {
+    status = StdComponent_telemetry_sink_set(&sample_StdComp, sample_dtls_telemetry_sink, &sample_dtls_telemetry);
+  }
+  
+  if (status)
+  {
+    nx_dtls_telemetry_delete(&sample_dtls_telemetry);
+    return(status);
+  }
+  
+  sample_dtls_telemetry_server_address.nxd_ip_version = NX_IP_VERSION_V4;
+  sample_dtls_telemetry_server_address.nxd_ip_address.v4 = SAMPLE_DTLS_TELEMETRY_SERVER_ADDRESS;
+  return(sample_dtls_telemetry_connect(&sample_dtls_telemetry));
+}
+#endif /* SAMPLE_DTLS_TELEMETRY_ENABLE */
+
 static UINT sample_components_init()
 {
   UINT status;
@@ -1021,8 +1214,25 @@ VOID sample_entry(NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr, NX_DNS *dns_ptr, UINT
     return;
   }
   
+#ifdef SAMPLE_DTLS_TELEMETRY_ENABLE
+  /* Start DTLS telemetry channel, telemetry goes to IoT Hub while the collector is not reachable.  */
+  if ((status = sample_dtls_telemetry_start(ip_ptr, pool_ptr)))
+  {
+    AZURE_PRINTF("Failed to start DTLS telemetry, using IoT Hub!: error code = 0x%08x\r\n", status);
+  }
+#endif /* SAMPLE_DTLS_TELEMETRY_ENABLE */
+  
   sample_context_init(&sample_context);
   
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+  /* Start the stack monitor, which reports through the event loop.  */
+  if ((status = tx_thread_stack_monitor_start(SAMPLE_STACK_MONITOR_SLICE_WORDS, SAMPLE_STACK_MONITOR_SLICE_TICKS,
+                                              SAMPLE_STACK_MONITOR_HEADROOM, sample_stack_monitor_notify)))
+  {
+    AZURE_PRINTF("Failed to start the stack monitor!: error code = 0x%08x\r\n", status);
+  }
+#endif /* TX_THREAD_ENABLE_STACK_MONITOR */
+  
   sample_context.state = SAMPLE_STATE_INIT;
   tx_event_flags_set(&(sample_context.sample_events), SAMPLE_INITIALIZATION_EVENT, TX_OR);
   
@@ -358,13 +358,31 @@ UINT StdComponent_init(STD_COMPONENT *handle,
   handle -> ReceivedDesiredMagFS     =0;
   handle -> ReceivedDesiredGyroFS    =0;
   
+  handle -> telemetry_sink = NX_NULL;
+  handle -> telemetry_sink_context = NX_NULL;
+  
+  return(NX_AZURE_IOT_SUCCESS);
+}
+
+UINT StdComponent_telemetry_sink_set(STD_COMPONENT *handle,
+                                     UINT (*telemetry_sink)(VOID *sink_context, UCHAR *data, UINT data_length),
+                                     VOID *sink_context)
+{
+  if (handle == NX_NULL)
+  {
+    return(NX_NOT_SUCCESSFUL);
+  }
+  
+  handle -> telemetry_sink = telemetry_sink;
+  handle -> telemetry_sink_context = sink_context;
+  
   return(NX_AZURE_IOT_SUCCESS);
 }
 
 UINT StdComponent_telemetry_send(STD_COMPONENT *handle, NX_AZURE_IOT_PNP_CLIENT *iotpnp_client_ptr)
 {
   UINT status;
-  NX_PACKET *packet_ptr;
+  NX_PACKET *packet_ptr = NX_NULL;
   NX_AZURE_IOT_JSON_WRITER json_writer;
   UINT buffer_length;
   
@@ -379,8 +397,9 @@ UINT StdComponent_telemetry_send(STD_COMPONENT *handle, NX_AZURE_IOT_PNP_CLIENT
     return(NX_NOT_SUCCESSFUL);
   }
   
-  /* Create a telemetry message packet. */
-  if ((status = nx_azure_iot_pnp_client_telemetry_message_create(iotpnp_client_ptr, handle -> component_name_ptr,
+  /* Create a telemetry message packet, a sink takes the JSON payload only. */
+  if ((handle -> telemetry_sink == NX_NULL) &&
+      (status = nx_azure_iot_pnp_client_telemetry_message_create(iotpnp_client_ptr, handle -> component_name_ptr,
                                                                  handle -> component_name_length,
                                                                  &packet_ptr, NX_WAIT_FOREVER)))
   {
@@ -392,7 +411,10 @@ UINT StdComponent_telemetry_send(STD_COMPONENT *handle, NX_AZURE_IOT_PNP_CLIENT
   if (nx_azure_iot_json_writer_with_buffer_init(&json_writer, scratch_buffer, sizeof(scratch_buffer)))
   {
     AZURE_PRINTF("Telemetry message failed to build message\r\n");
-    nx_azure_iot_pnp_client_telemetry_message_delete(packet_ptr);
+    if (packet_ptr)
+    {
+      nx_azure_iot_pnp_client_telemetry_message_delete(packet_ptr);
+    }
     return(NX_NOT_SUCCESSFUL);
   }
   
@@ -609,12 +631,34 @@ UINT StdComponent_telemetry_send(STD_COMPONENT *handle, NX_AZURE_IOT_PNP_CLIENT
   {
     AZURE_PRINTF("Telemetry message failed to build message for StdComp accelerometer sensor\r\n");
     nx_azure_iot_json_writer_deinit(&json_writer);
-    nx_azure_iot_pnp_client_telemetry_message_delete(packet_ptr);
+    if (packet_ptr)
+    {
+      nx_azure_iot_pnp_client_telemetry_message_delete(packet_ptr);
+    }
     return(NX_NOT_SUCCESSFUL);
   }
   
   buffer_length = nx_azure_iot_json_writer_get_bytes_used(&json_writer);
-  if ((status = nx_azure_iot_pnp_client_telemetry_send(iotpnp_client_ptr, packet_ptr,
+  if (handle -> telemetry_sink)
+  {
+    if ((status = handle -> telemetry_sink(handle -> telemetry_sink_context, (UCHAR *)scratch_buffer, buffer_length)))
+    {
+      
+      /* The sample is not lost, it goes to IoT Hub instead. */
+      AZURE_PRINTF("STD_COMP telemetry sink send failed, using IoT Hub!: error code = 0x%08x\r\n", status);
+      if ((status = nx_azure_iot_pnp_client_telemetry_message_create(iotpnp_client_ptr, handle -> component_name_ptr,
+                                                                     handle -> component_name_length,
+                                                                     &packet_ptr, NX_WAIT_FOREVER)))
+      {
+        AZURE_PRINTF("Telemetry message create failed!: error code = 0x%08x\r\n", status);
+        nx_azure_iot_json_writer_deinit(&json_writer);
+        return(status);
+      }
+    }
+  }
+  
+  if (packet_ptr &&
+      (status = nx_azure_iot_pnp_client_telemetry_send(iotpnp_client_ptr, packet_ptr,
                                                        (UCHAR *)scratch_buffer, buffer_length, NX_WAIT_FOREVER)))
   {
     AZURE_PRINTF("STD_COMP Accelerometer telemetry message send failed!: error code = 0x%08x\r\n", status);
@@ -96,6 +96,15 @@ typedef struct STD_COMPONENT_TAG
     /* Current Distance */
     double Distance;
     
+    /********
+     * Sink *
+     ********/
+
+    /* Telemetry sink, when set telemetry is sent to the sink instead of IoT Hub.
+       A sample the sink fails to send goes to IoT Hub */
+    UINT (*telemetry_sink)(VOID *sink_context, UCHAR *data, UINT data_length);
+    VOID *telemetry_sink_context;
+
     /************
      * Property *
      ************/
@@ -130,6 +139,10 @@ extern UINT StdComponent_report_all_properties(STD_COMPONENT *handle,
 extern UINT StdComponent_telemetry_send(STD_COMPONENT *handle,
                                         NX_AZURE_IOT_PNP_CLIENT *iotpnp_client_ptr);
 
+extern UINT StdComponent_telemetry_sink_set(STD_COMPONENT *handle,
+                                            UINT (*telemetry_sink)(VOID *sink_context, UCHAR *data, UINT data_length),
+                                            VOID *sink_context);
+
 extern UINT StdComponent_process_property_update(STD_COMPONENT *handle,
                                                  NX_AZURE_IOT_PNP_CLIENT *iotpnp_client_ptr,
                                                  const UCHAR *component_name_ptr, UINT component_name_length,
@@ -35,6 +35,72 @@ extern   "C" {
 #define SAMPLE_THREAD_PRIORITY                      (16)
 #endif /* SAMPLE_THREAD_PRIORITY */
 
+/* Define to send telemetry to a DTLS collector instead of IoT Hub. Properties and
+   commands still go through IoT Hub. The NetX Duo library must be built with
+   NX_SECURE_ENABLE_DTLS.  */
+/*
+#define SAMPLE_DTLS_TELEMETRY_ENABLE
+*/
+
+#ifdef SAMPLE_DTLS_TELEMETRY_ENABLE
+
+/* Define the collector address and port.  */
+#ifndef SAMPLE_DTLS_TELEMETRY_SERVER_ADDRESS
+#define SAMPLE_DTLS_TELEMETRY_SERVER_ADDRESS        IP_ADDRESS(192, 168, 1, 2)
+#endif /* SAMPLE_DTLS_TELEMETRY_SERVER_ADDRESS */
+
+#ifndef SAMPLE_DTLS_TELEMETRY_SERVER_PORT
+#define SAMPLE_DTLS_TELEMETRY_SERVER_PORT           (5684)
+#endif /* SAMPLE_DTLS_TELEMETRY_SERVER_PORT */
+
+/* Define the pre-shared key and identity to authenticate with the collector. The NetX
+   Duo library must be built with NX_SECURE_ENABLE_PSK_CIPHERSUITES. When not defined,
+   the collector certificate is verified against SAMPLE_DTLS_TELEMETRY_CA_CERT.  */
+/*
+#define SAMPLE_DTLS_TELEMETRY_PSK                   "telemetry-key"
+#define SAMPLE_DTLS_TELEMETRY_PSK_IDENTITY          "telemetry-device"
+*/
+
+/* Define the DER encoded CA that issues the collector certificate, and the DNS name the
+   collector certificate must be issued to. Use a CA dedicated to the collectors: a public
+   root such as the IoT Hub one would accept any host it has issued a certificate to.  */
+/*
+#define SAMPLE_DTLS_TELEMETRY_CA_CERT               sample_dtls_telemetry_ca
+#define SAMPLE_DTLS_TELEMETRY_CA_CERT_SIZE          sizeof(sample_dtls_telemetry_ca)
+#define SAMPLE_DTLS_TELEMETRY_SERVER_NAME           "collector.example.com"
+*/
+
+#ifndef SAMPLE_DTLS_TELEMETRY_PSK
+#if !defined(SAMPLE_DTLS_TELEMETRY_CA_CERT) || !defined(SAMPLE_DTLS_TELEMETRY_CA_CERT_SIZE) || \
+    !defined(SAMPLE_DTLS_TELEMETRY_SERVER_NAME)
+#error "SAMPLE_DTLS_TELEMETRY_ENABLE requires SAMPLE_DTLS_TELEMETRY_PSK, or SAMPLE_DTLS_TELEMETRY_CA_CERT and SAMPLE_DTLS_TELEMETRY_SERVER_NAME"
+#endif /* !SAMPLE_DTLS_TELEMETRY_CA_CERT || !SAMPLE_DTLS_TELEMETRY_CA_CERT_SIZE || !SAMPLE_DTLS_TELEMETRY_SERVER_NAME */
+#endif /* SAMPLE_DTLS_TELEMETRY_PSK */
+
+#ifndef SAMPLE_DTLS_TELEMETRY_METADATA_SIZE
+#define SAMPLE_DTLS_TELEMETRY_METADATA_SIZE         (9 * 1024)
+#endif /* SAMPLE_DTLS_TELEMETRY_METADATA_SIZE */
+
+#ifndef SAMPLE_DTLS_TELEMETRY_PACKET_BUFFER_SIZE
+#define SAMPLE_DTLS_TELEMETRY_PACKET_BUFFER_SIZE    (4 * 1024)
+#endif /* SAMPLE_DTLS_TELEMETRY_PACKET_BUFFER_SIZE */
+
+#ifndef SAMPLE_DTLS_TELEMETRY_CERT_BUFFER_SIZE
+#define SAMPLE_DTLS_TELEMETRY_CERT_BUFFER_SIZE      (2 * 1024)
+#endif /* SAMPLE_DTLS_TELEMETRY_CERT_BUFFER_SIZE */
+
+#ifndef SAMPLE_DTLS_TELEMETRY_CONNECT_WAIT_OPTION
+#define SAMPLE_DTLS_TELEMETRY_CONNECT_WAIT_OPTION   (10 * NX_IP_PERIODIC_RATE)
+#endif /* SAMPLE_DTLS_TELEMETRY_CONNECT_WAIT_OPTION */
+
+/* Define the minimum time between two attempts to connect the collector again after the
+   channel is lost. Samples go to IoT Hub in the meantime.  */
+#ifndef SAMPLE_DTLS_TELEMETRY_RECONNECT_PERIOD
+#define SAMPLE_DTLS_TELEMETRY_RECONNECT_PERIOD      (30 * NX_IP_PERIODIC_RATE)
+#endif /* SAMPLE_DTLS_TELEMETRY_RECONNECT_PERIOD */
+
+#endif /* SAMPLE_DTLS_TELEMETRY_ENABLE */
+
 #ifdef __cplusplus
 }
 #endif
@@ -47,6 +47,23 @@ const CHAR response_description_failed[]  = "failed";
 #define SAMPLE_WAIT_OPTION                                              (NX_NO_WAIT)
 #endif /* SAMPLE_WAIT_OPTION */
 
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+/* Define the stack monitor settings. The monitor scans SAMPLE_STACK_MONITOR_SLICE_WORDS stack
+   words every SAMPLE_STACK_MONITOR_SLICE_TICKS ticks, and reports the threads that have less than
+   SAMPLE_STACK_MONITOR_HEADROOM percent of their stack left.  */
+#ifndef SAMPLE_STACK_MONITOR_SLICE_WORDS
+#define SAMPLE_STACK_MONITOR_SLICE_WORDS                                (64)
+#endif /* SAMPLE_STACK_MONITOR_SLICE_WORDS */
+
+#ifndef SAMPLE_STACK_MONITOR_SLICE_TICKS
+#define SAMPLE_STACK_MONITOR_SLICE_TICKS                                (1)
+#endif /* SAMPLE_STACK_MONITOR_SLICE_TICKS */
+
+#ifndef SAMPLE_STACK_MONITOR_HEADROOM
+#define SAMPLE_STACK_MONITOR_HEADROOM                                   (20)
+#endif /* SAMPLE_STACK_MONITOR_HEADROOM */
+#endif /* TX_THREAD_ENABLE_STACK_MONITOR */
+
 /* Sample events.  */
 
 /* Sample events.  */
@@ -61,6 +78,7 @@ const CHAR response_description_failed[]  = "failed";
 #define SAMPLE_DISCONNECT_EVENT                                         ((ULONG)0x00000080)
 #define SAMPLE_RECONNECT_EVENT                                          ((ULONG)0x00000100)
 #define SAMPLE_CONNECTED_EVENT                                          ((ULONG)0x00000200)
+#define SAMPLE_STACK_MONITOR_EVENT                                      ((ULONG)0x00000400)
 
 /* Sample states.  */
 #define SAMPLE_STATE_NONE                                               (0)
@@ -441,6 +459,43 @@ static VOID sample_connection_error_recover(SAMPLE_CONTEXT *context)
   }
 }
 
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+/* The stack monitor calls this from the timer thread, so the report is left to the event loop.  */
+static VOID sample_stack_monitor_notify(TX_THREAD *thread_ptr, ULONG stack_used)
+{
+  NX_PARAMETER_NOT_USED(thread_ptr);
+  NX_PARAMETER_NOT_USED(stack_used);
+  
+  tx_event_flags_set(&(sample_context.sample_events), SAMPLE_STACK_MONITOR_EVENT, TX_OR);
+}
+
+/* Print the threads left with little stack, with their latest high-water marks.  */
+static VOID sample_stack_monitor_action(SAMPLE_CONTEXT *context)
+{
+  TX_THREAD *self_ptr = tx_thread_identify();
+  TX_THREAD *thread_ptr = self_ptr;
+  CHAR *thread_name;
+  ULONG stack_used;
+  ULONG stack_headroom;
+  
+  NX_PARAMETER_NOT_USED(context);
+  
+  do
+  {
+    if ((tx_thread_stack_monitor_info_get(thread_ptr, &stack_used, &stack_headroom, NX_NULL) == TX_SUCCESS) &&
+        ((stack_headroom * 100) < ((stack_used + stack_headroom) * SAMPLE_STACK_MONITOR_HEADROOM)))
+    {
+      tx_thread_info_get(thread_ptr, &thread_name, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL);
+      AZURE_PRINTF("Stack monitor: %s used %lu of %lu bytes, %lu bytes left.\r\n",
+                   thread_name, stack_used, stack_used + stack_headroom, stack_headroom);
+    }
+    
+    /* The created threads form a ring.  */
+    tx_thread_info_get(thread_ptr, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL, NX_NULL, &thread_ptr, NX_NULL);
+  } while (thread_ptr != self_ptr);
+}
+#endif /* TX_THREAD_ENABLE_STACK_MONITOR */
+
 static VOID sample_trigger_action(SAMPLE_CONTEXT *context)
 {
 #ifdef DEBUG_FUNCTION_CALL
@@ -926,6 +981,14 @@ static VOID sample_event_loop(SAMPLE_CONTEXT *context)
       sample_connection_error_recover(context);
     }
     
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+    if (app_events & SAMPLE_STACK_MONITOR_EVENT)
+    {
+      AZURE_PRINTF("SAMPLE_STACK_MONITOR_EVENT\r\n");
+      sample_stack_monitor_action(context);
+    }
+#endif /* TX_THREAD_ENABLE_STACK_MONITOR */
+    
     sample_trigger_action(context);
   }
 }
@@ -1008,6 +1071,15 @@ VOID sample_entry(NX_IP *ip_ptr, NX_PACKET_POOL *pool_ptr, NX_DNS *dns_ptr, UINT
   
   sample_context_init(&sample_context);
   
+#ifdef TX_THREAD_ENABLE_STACK_MONITOR
+  /* Start the stack monitor, which reports through the event loop.  */
+  if ((status = tx_thread_stack_monitor_start(SAMPLE_STACK_MONITOR_SLICE_WORDS, SAMPLE_STACK_MONITOR_SLICE_TICKS,
+                                              SAMPLE_STACK_MONITOR_HEADROOM, sample_stack_monitor_notify)))
+  {
+    AZURE_PRINTF("Failed to start the stack monitor!: error code = 0x%08x\r\n", status);
+  }
+#endif /* TX_THREAD_ENABLE_STACK_MONITOR */
+  
   sample_context.state = SAMPLE_STATE_INIT;
   tx_event_flags_set(&(sample_context.sample_events), SAMPLE_INITIALIZATION_EVENT, TX_OR);
   